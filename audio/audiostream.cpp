@@ -92,8 +92,17 @@ SeekableAudioStream *SeekableAudioStream::openStreamFile(const Common::Path &bas
 #pragma mark --- LoopingAudioStream ---
 #pragma mark -
 
+/**
+ * Size of the loop splice prebuffer, in samples. The decoded loop head is
+ * kept in memory so that the samples right at the loop point come straight
+ * from RAM, and the expensive seek of a compressed parent stream is deferred
+ * until the prebuffer has been played out.
+ */
+static const uint kLoopSpliceBufferSize = 4096;
+
 LoopingAudioStream::LoopingAudioStream(Common::DisposablePtr<RewindableAudioStream>&& stream, uint loops, bool rewind)
-        : _parent(Common::move(stream)), _loops(loops), _completeIterations(0) {
+        : _parent(Common::move(stream)), _loops(loops), _completeIterations(0),
+          _seekableParent(nullptr), _splicePos(0), _spliceSeekPending(false) {
 	assert(_parent);
 
 	if (rewind && !_parent->rewind()) {
@@ -104,6 +113,20 @@ LoopingAudioStream::LoopingAudioStream(Common::DisposablePtr<RewindableAudioStre
 		// Apparently this is an empty stream
 		_loops = _completeIterations = 1;
 	}
+
+	// When the parent can seek, decode the loop head ahead of time. Without
+	// the rewind above we cannot know that the parent is positioned at the
+	// loop start, so the head cannot be captured in that case.
+	if (rewind && _loops != 1) {
+		_seekableParent = dynamic_cast<SeekableAudioStream *>(_parent.get());
+		if (_seekableParent) {
+			_spliceBuffer.resize(kLoopSpliceBufferSize);
+			const int spliceSize = _parent->readBuffer(_spliceBuffer.begin(), kLoopSpliceBufferSize);
+			_spliceBuffer.resize(MAX(spliceSize, 0));
+			// The parent is already positioned past the captured head, so the
+			// first iteration is served from the buffer without any seek
+		}
+	}
 }
 
 LoopingAudioStream::LoopingAudioStream(RewindableAudioStream *stream, uint loops, DisposeAfterUse::Flag disposeAfterUse, bool rewind)
@@ -113,7 +136,30 @@ int LoopingAudioStream::readBuffer(int16 *buffer, const int numSamples) {
 	if ((_loops && _completeIterations == _loops) || !numSamples)
 		return 0;
 
-	int samplesRead = _parent->readBuffer(buffer, numSamples);
+	int samplesRead = 0;
+
+	// Splice in the prebuffered loop head, then reposition the parent right
+	// past it once the buffer has been played out
+	if (_splicePos < _spliceBuffer.size()) {
+		samplesRead = MIN<uint>(numSamples, _spliceBuffer.size() - _splicePos);
+		memcpy(buffer, _spliceBuffer.begin() + _splicePos, samplesRead * sizeof(int16));
+		_splicePos += samplesRead;
+
+		if (_splicePos == _spliceBuffer.size() && _spliceSeekPending) {
+			_spliceSeekPending = false;
+			const Timestamp spliceEnd = Timestamp(0, getRate() * (isStereo() ? 2 : 1)).addFrames(_spliceBuffer.size());
+			if (!_seekableParent->seek(spliceEnd)) {
+				// TODO: Properly indicate error
+				_loops = _completeIterations;
+				return samplesRead;
+			}
+		}
+
+		if (samplesRead == numSamples)
+			return samplesRead;
+	}
+
+	samplesRead += _parent->readBuffer(buffer + samplesRead, numSamples - samplesRead);
 
 	if (_parent->endOfStream()) {
 		++_completeIterations;
@@ -122,14 +168,21 @@ int LoopingAudioStream::readBuffer(int16 *buffer, const int numSamples) {
 
 		const int remainingSamples = numSamples - samplesRead;
 
-		if (!_parent->rewind()) {
-			// TODO: Properly indicate error
-			_loops = _completeIterations;
-			return samplesRead;
-		}
-		if (_parent->endOfStream()) {
-			// Apparently this is an empty stream
-			_loops = _completeIterations;
+		if (!_spliceBuffer.empty()) {
+			// Restart the loop from the prebuffered head; the deferred seek
+			// above replaces the rewind
+			_splicePos = 0;
+			_spliceSeekPending = true;
+		} else {
+			if (!_parent->rewind()) {
+				// TODO: Properly indicate error
+				_loops = _completeIterations;
+				return samplesRead;
+			}
+			if (_parent->endOfStream()) {
+				// Apparently this is an empty stream
+				_loops = _completeIterations;
+			}
 		}
 
 		return samplesRead + readBuffer(buffer + samplesRead, remainingSamples);
@@ -139,7 +192,13 @@ int LoopingAudioStream::readBuffer(int16 *buffer, const int numSamples) {
 }
 
 bool LoopingAudioStream::endOfData() const {
-	return (_loops != 0 && _completeIterations == _loops) || _parent->endOfData();
+	if (_loops != 0 && _completeIterations == _loops)
+		return true;
+	// Samples from the prebuffered loop head are still available even while
+	// the parent sits at its end of stream
+	if (_splicePos < _spliceBuffer.size())
+		return false;
+	return _parent->endOfData();
 }
 
 bool LoopingAudioStream::endOfStream() const {
@@ -182,10 +241,23 @@ SubLoopingAudioStream::SubLoopingAudioStream(SeekableAudioStream *stream,
 	: _parent(stream, disposeAfterUse), _loops(loops), _completeIterations(0),
 	  _pos(0, getRate() * (isStereo() ? 2 : 1)),
 	  _loopStart(convertTimeToStreamPos(loopStart, getRate(), isStereo())),
-	  _loopEnd(convertTimeToStreamPos(loopEnd, getRate(), isStereo())) {
+	  _loopEnd(convertTimeToStreamPos(loopEnd, getRate(), isStereo())),
+	  _splicePos(0), _spliceSeekPending(false) {
 	assert(loopStart < loopEnd);
 	assert(stream);
 
+	// Decode the loop head ahead of time, so the samples right at the loop
+	// point come straight from RAM and the seek back to the loop start is
+	// deferred until the prebuffer has been played out
+	if (_loops != 1 && _parent->seek(_loopStart)) {
+		const int spliceSize = MIN<int>(kLoopSpliceBufferSize, _loopEnd.frameDiff(_loopStart));
+		_spliceBuffer.resize(spliceSize);
+		const int got = _parent->readBuffer(_spliceBuffer.begin(), spliceSize);
+		_spliceBuffer.resize(MAX(got, 0));
+		// The head is only spliced in once the loop wraps around
+		_splicePos = _spliceBuffer.size();
+	}
+
 	if (!_parent->rewind())
 		_loops = _completeIterations = 1;
 }
@@ -194,39 +266,73 @@ int SubLoopingAudioStream::readBuffer(int16 *buffer, const int numSamples) {
 	if ((_loops && _completeIterations == _loops) || !numSamples)
 		return 0;
 
-	int framesLeft = MIN(_loopEnd.frameDiff(_pos), numSamples);
-	int framesRead = _parent->readBuffer(buffer, framesLeft);
+	int samplesRead = 0;
+
+	// Splice in the prebuffered loop head, then reposition the parent right
+	// past it once the buffer has been played out
+	if (_splicePos < _spliceBuffer.size()) {
+		samplesRead = MIN<uint>(numSamples, _spliceBuffer.size() - _splicePos);
+		memcpy(buffer, _spliceBuffer.begin() + _splicePos, samplesRead * sizeof(int16));
+		_splicePos += samplesRead;
+		_pos = _pos.addFrames(samplesRead);
+
+		if (_splicePos == _spliceBuffer.size() && _spliceSeekPending) {
+			_spliceSeekPending = false;
+			if (!_parent->seek(_loopStart.addFrames(_spliceBuffer.size()))) {
+				// TODO: Proper error indication.
+				_loops = _completeIterations;
+				return samplesRead;
+			}
+		}
+
+		if (samplesRead == numSamples)
+			return samplesRead;
+	}
+
+	int framesLeft = MIN(_loopEnd.frameDiff(_pos), numSamples - samplesRead);
+	int framesRead = _parent->readBuffer(buffer + samplesRead, framesLeft);
 	_pos = _pos.addFrames(framesRead);
+	samplesRead += framesRead;
 
 	if (framesRead < framesLeft && _parent->endOfStream()) {
 		// TODO: Proper error indication.
 		if (!_completeIterations)
 			_completeIterations = 1;
 		_loops = _completeIterations;
-		return framesRead;
+		return samplesRead;
 	} else if (_pos == _loopEnd) {
 		++_completeIterations;
 		if (_completeIterations == _loops)
-			return framesRead;
+			return samplesRead;
 
-		if (!_parent->seek(_loopStart)) {
+		if (!_spliceBuffer.empty()) {
+			// Restart the loop from the prebuffered head; the deferred seek
+			// above replaces the seek to the loop start
+			_splicePos = 0;
+			_spliceSeekPending = true;
+		} else if (!_parent->seek(_loopStart)) {
 			// TODO: Proper error indication.
 			_loops = _completeIterations;
-			return framesRead;
+			return samplesRead;
 		}
 
 		_pos = _loopStart;
-		framesLeft = numSamples - framesLeft;
-		return framesRead + readBuffer(buffer + framesRead, framesLeft);
+		return samplesRead + readBuffer(buffer + samplesRead, numSamples - samplesRead);
 	} else {
-		return framesRead;
+		return samplesRead;
 	}
 }
 
 bool SubLoopingAudioStream::endOfData() const {
 	// We're out of data if this stream is finished or the parent
 	// has run out of data for now.
-	return (_loops != 0 && _completeIterations == _loops) || _parent->endOfData();
+	if (_loops != 0 && _completeIterations == _loops)
+		return true;
+	// Samples from the prebuffered loop head are still available even while
+	// the parent sits at its end of stream
+	if (_splicePos < _spliceBuffer.size())
+		return false;
+	return _parent->endOfData();
 }
 
 bool SubLoopingAudioStream::endOfStream() const {
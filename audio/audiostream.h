@@ -22,6 +22,7 @@
 #ifndef AUDIO_AUDIOSTREAM_H
 #define AUDIO_AUDIOSTREAM_H
 
+#include "common/array.h"
 #include "common/ptr.h"
 #include "common/scummsys.h"
 #include "common/types.h"
@@ -135,11 +136,18 @@ public:
 	virtual void setRemainingIterations(uint loops) = 0;
 };
 
+class SeekableAudioStream;
+
 /**
  * A looping audio stream.
  *
  * This object does nothing besides using a RewindableAudioStream
  * to play a stream in a loop.
+ *
+ * When the underlying stream supports seeking, the head of the loop is
+ * decoded ahead of time and spliced in sample-accurately at the loop point,
+ * so the rewind of a compressed stream does not stall the mixer callback
+ * right at the loop boundary.
  */
 class LoopingAudioStream : public LoopableAudioStream {
 public:
@@ -185,6 +193,11 @@ private:
 
 	uint _loops;
 	uint _completeIterations;
+
+	SeekableAudioStream *_seekableParent; ///< Non-null when the parent can seek, which enables the loop splice prebuffer
+	Common::Array<int16> _spliceBuffer;   ///< Loop head decoded ahead of time, spliced in at the loop point
+	uint _splicePos;                      ///< Read position within _spliceBuffer
+	bool _spliceSeekPending;              ///< Whether the parent still has to be seeked past the prebuffered head
 };
 
 /**
@@ -278,6 +291,10 @@ AudioStream *makeLoopingAudioStream(SeekableAudioStream *stream, Timestamp start
  * A looping audio stream that features looping of a nested part of the
  * stream.
  *
+ * The head of the loop is decoded ahead of time and spliced in
+ * sample-accurately at the loop point, so the seek back to the loop start
+ * does not stall the mixer callback right at the loop boundary.
+ *
  * @note Currently this implementation stops after the nested loop finishes
  *       playback.
  *
@@ -320,6 +337,10 @@ private:
 	uint _completeIterations;
 	Timestamp _pos;
 	Timestamp _loopStart, _loopEnd;
+
+	Common::Array<int16> _spliceBuffer; ///< Loop head decoded ahead of time, spliced in at the loop point
+	uint _splicePos;                    ///< Read position within _spliceBuffer
+	bool _spliceSeekPending;            ///< Whether the parent still has to be seeked past the prebuffered head
 };
 
 
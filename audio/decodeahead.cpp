@@ -0,0 +1,301 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// pthread.h pulls in time.h on some libcs
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
+#include "audio/decodeahead.h"
+
+#include "audio/audiostream.h"
+#include "audio/timestamp.h"
+#include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/util.h"
+
+#if defined(POSIX)
+#define AUDIO_USE_DECODE_AHEAD_THREAD
+#include <pthread.h>
+#endif
+
+namespace Audio {
+
+// Streams shorter than this play from the decoder directly; spawning a
+// producer thread per sound effect would cost more than it saves.
+enum { kMinStreamLengthMs = 10000 };
+
+static uint32 s_underruns = 0;
+
+uint32 getDecodeAheadUnderruns() {
+	return s_underruns;
+}
+
+#ifdef AUDIO_USE_DECODE_AHEAD_THREAD
+
+/**
+ * SeekableAudioStream wrapper holding a single-producer/single-consumer
+ * PCM ring. The producer thread pulls from the wrapped decoder whenever
+ * there is room for a chunk; readBuffer() only copies out of the ring.
+ */
+class DecodeAheadStream : public SeekableAudioStream {
+public:
+	DecodeAheadStream(SeekableAudioStream *stream);
+	~DecodeAheadStream() override;
+
+	/** Spawn the producer thread. Returns false if that failed. */
+	bool start();
+
+	/** Hand the wrapped stream back for the fallback path. */
+	SeekableAudioStream *releaseStream();
+
+	int readBuffer(int16 *buffer, const int numSamples) override;
+	bool isStereo() const override { return _stereo; }
+	int getRate() const override { return _rate; }
+	bool endOfData() const override;
+	bool seek(const Timestamp &where) override;
+	Timestamp getLength() const override { return _length; }
+
+private:
+	static void *producerEntry(void *arg);
+	void producerLoop();
+
+	// Samples decoded per producer iteration, and the ring target:
+	// roughly 250ms of stereo CD audio, enough for several callbacks.
+	enum {
+		kChunkSamples = 2048,
+		kMinRingSamples = 8192
+	};
+
+	SeekableAudioStream *_stream;
+	bool _stereo;
+	int _rate;
+	Timestamp _length;
+
+	int16 *_ring;
+	int16 *_scratch;
+	uint32 _capacity;
+	uint32 _head;		///< next sample the mixer reads
+	uint32 _count;		///< filled samples in the ring
+
+	bool _finished;		///< the wrapped stream has no more data
+	bool _quit;
+	bool _seekPending;
+	bool _seekResult;
+	Timestamp _seekTarget;
+	uint32 _underruns;
+
+	bool _threadRunning;
+	pthread_t _thread;
+	mutable pthread_mutex_t _mutex;
+	pthread_cond_t _cond;
+};
+
+DecodeAheadStream::DecodeAheadStream(SeekableAudioStream *stream) :
+		_stream(stream),
+		_stereo(stream->isStereo()),
+		_rate(stream->getRate()),
+		_length(stream->getLength()),
+		_head(0), _count(0),
+		_finished(false), _quit(false),
+		_seekPending(false), _seekResult(false),
+		_seekTarget(0),
+		_underruns(0),
+		_threadRunning(false) {
+	// 250ms of PCM, in whole chunks
+	uint32 target = _rate * (_stereo ? 2 : 1) / 4;
+	if (target < kMinRingSamples)
+		target = kMinRingSamples;
+	_capacity = ((target + kChunkSamples - 1) / kChunkSamples) * kChunkSamples;
+
+	_ring = new int16[_capacity];
+	_scratch = new int16[kChunkSamples];
+
+	pthread_mutex_init(&_mutex, nullptr);
+	pthread_cond_init(&_cond, nullptr);
+
+	// Prime the ring so the first callbacks after playStream() do not
+	// race the producer thread's startup.
+	for (int i = 0; i < 2 && !_finished; i++) {
+		const int decoded = _stream->readBuffer(_ring + _count, kChunkSamples);
+		if (decoded > 0)
+			_count += decoded;
+		if (decoded <= 0 || _stream->endOfData())
+			_finished = true;
+	}
+}
+
+DecodeAheadStream::~DecodeAheadStream() {
+	if (_threadRunning) {
+		pthread_mutex_lock(&_mutex);
+		_quit = true;
+		pthread_cond_broadcast(&_cond);
+		pthread_mutex_unlock(&_mutex);
+		pthread_join(_thread, nullptr);
+	}
+
+	pthread_mutex_destroy(&_mutex);
+	pthread_cond_destroy(&_cond);
+
+	if (_underruns > 0)
+		debug(1, "DecodeAheadStream: %u underruns", _underruns);
+
+	delete[] _ring;
+	delete[] _scratch;
+	delete _stream;
+}
+
+bool DecodeAheadStream::start() {
+	_threadRunning = (pthread_create(&_thread, nullptr, producerEntry, this) == 0);
+	return _threadRunning;
+}
+
+SeekableAudioStream *DecodeAheadStream::releaseStream() {
+	SeekableAudioStream *stream = _stream;
+	_stream = nullptr;
+	return stream;
+}
+
+void *DecodeAheadStream::producerEntry(void *arg) {
+	((DecodeAheadStream *)arg)->producerLoop();
+	return nullptr;
+}
+
+void DecodeAheadStream::producerLoop() {
+	pthread_mutex_lock(&_mutex);
+	while (!_quit) {
+		if (_seekPending) {
+			pthread_mutex_unlock(&_mutex);
+			const bool ok = _stream->seek(_seekTarget);
+			pthread_mutex_lock(&_mutex);
+			_head = 0;
+			_count = 0;
+			_finished = !ok || _stream->endOfData();
+			_seekResult = ok;
+			_seekPending = false;
+			pthread_cond_broadcast(&_cond);
+			continue;
+		}
+
+		if (_finished || _capacity - _count < kChunkSamples) {
+			pthread_cond_wait(&_cond, &_mutex);
+			continue;
+		}
+
+		// Decode outside the lock; this is the part whose duration the
+		// mixer callback must not depend on.
+		pthread_mutex_unlock(&_mutex);
+		const int decoded = _stream->readBuffer(_scratch, kChunkSamples);
+		const bool atEnd = _stream->endOfData();
+		pthread_mutex_lock(&_mutex);
+
+		// A seek posted while we were decoding makes the samples stale
+		if (_seekPending || _quit)
+			continue;
+
+		if (decoded > 0) {
+			const uint32 tail = (_head + _count) % _capacity;
+			const uint32 contiguous = MIN<uint32>(decoded, _capacity - tail);
+			memcpy(_ring + tail, _scratch, contiguous * sizeof(int16));
+			if ((uint32)decoded > contiguous)
+				memcpy(_ring, _scratch + contiguous, (decoded - contiguous) * sizeof(int16));
+			_count += decoded;
+		}
+		if (decoded <= 0 || atEnd)
+			_finished = true;
+
+		pthread_cond_broadcast(&_cond);
+	}
+	pthread_mutex_unlock(&_mutex);
+}
+
+int DecodeAheadStream::readBuffer(int16 *buffer, const int numSamples) {
+	int total = 0;
+
+	pthread_mutex_lock(&_mutex);
+	while (total < numSamples && _count > 0) {
+		uint32 chunk = MIN<uint32>(numSamples - total, _count);
+		chunk = MIN<uint32>(chunk, _capacity - _head);
+		memcpy(buffer + total, _ring + _head, chunk * sizeof(int16));
+		_head = (_head + chunk) % _capacity;
+		_count -= chunk;
+		total += chunk;
+	}
+
+	// Never wait here: losing the rest of this pull to silence is the
+	// failure mode we can afford, blocking the mixer thread is not.
+	if (total < numSamples && !_finished && !_seekPending) {
+		_underruns++;
+		s_underruns++;
+	}
+
+	pthread_cond_signal(&_cond);
+	pthread_mutex_unlock(&_mutex);
+
+	return total;
+}
+
+bool DecodeAheadStream::endOfData() const {
+	pthread_mutex_lock(&_mutex);
+	const bool result = _finished && _count == 0 && !_seekPending;
+	pthread_mutex_unlock(&_mutex);
+	return result;
+}
+
+bool DecodeAheadStream::seek(const Timestamp &where) {
+	pthread_mutex_lock(&_mutex);
+	_seekTarget = where;
+	_seekPending = true;
+	// Keep the stream alive for the mixer until the producer reports back
+	_finished = false;
+	pthread_cond_broadcast(&_cond);
+	while (_seekPending)
+		pthread_cond_wait(&_cond, &_mutex);
+	const bool result = _seekResult;
+	pthread_mutex_unlock(&_mutex);
+	return result;
+}
+
+#endif // AUDIO_USE_DECODE_AHEAD_THREAD
+
+SeekableAudioStream *makeDecodeAheadStream(SeekableAudioStream *stream) {
+#ifdef AUDIO_USE_DECODE_AHEAD_THREAD
+	if (!stream)
+		return nullptr;
+
+	if (ConfMan.hasKey("audio_decode_ahead") && !ConfMan.getBool("audio_decode_ahead"))
+		return stream;
+
+	const uint32 lengthMs = stream->getLength().msecs();
+	if (lengthMs > 0 && lengthMs < kMinStreamLengthMs)
+		return stream;
+
+	DecodeAheadStream *ahead = new DecodeAheadStream(stream);
+	if (!ahead->start()) {
+		stream = ahead->releaseStream();
+		delete ahead;
+		return stream;
+	}
+	return ahead;
+#else
+	return stream;
+#endif
+}
+
+} // End of namespace Audio
@@ -0,0 +1,54 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AUDIO_DECODEAHEAD_H
+#define AUDIO_DECODEAHEAD_H
+
+#include "common/types.h"
+
+namespace Audio {
+
+class SeekableAudioStream;
+
+/**
+ * Wrap a compressed audio stream with a producer thread that decodes ahead
+ * into a PCM ring buffer (about 250ms), so the mixer callback only copies
+ * memory and is isolated from codec timing variance. The wrapper keeps the
+ * SeekableAudioStream contract: seek() flushes the ring and repositions the
+ * wrapped stream.
+ *
+ * Decode-ahead only engages for streams longer than a few seconds (short
+ * effects are not worth a thread) and on platforms with thread support; in
+ * every other case, and when the hidden audio_decode_ahead option is set to
+ * false, the input stream is returned unchanged. The wrapper always takes
+ * ownership of the input stream.
+ */
+SeekableAudioStream *makeDecodeAheadStream(SeekableAudioStream *stream);
+
+/**
+ * Process-wide number of mixer pulls that found the decode-ahead ring short
+ * of data. A rising count means the producer threads cannot keep up.
+ */
+uint32 getDecodeAheadUnderruns();
+
+} // End of namespace Audio
+
+#endif
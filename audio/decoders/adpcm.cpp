@@ -327,14 +327,21 @@ int MSIma_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
 			_blockPos[0] = _channels * 4;
 		}
 
-		// Decode a set of samples
+		// Decode a set of samples. The stream encodes four bytes per
+		// channel at a time; fetch them with a single read call instead
+		// of one virtual readByte call per byte.
+		byte data[8];
+		uint32 n = _stream->read(data, _channels * 4);
+		// A short read means we ran into the end of the stream; decode
+		// zero nibbles there, like readByte would have produced
+		memset(data + n, 0, _channels * 4 - n);
+		_blockPos[0] += _channels * 4;
+
 		for (int i = 0; i < _channels; i++) {
-			// The stream encodes four bytes per channel at a time
 			for (int j = 0; j < 4; j++) {
-				byte data = _stream->readByte();
-				_blockPos[0]++;
-				_buffer[i][j * 2] = decodeIMA(data & 0x0f, i);
-				_buffer[i][j * 2 + 1] = decodeIMA((data >> 4) & 0x0f, i);
+				byte d = data[i * 4 + j];
+				_buffer[i][j * 2] = decodeIMA(d & 0x0f, i);
+				_buffer[i][j * 2 + 1] = decodeIMA((d >> 4) & 0x0f, i);
 				_samplesLeft[i] += 2;
 			}
 		}
@@ -389,7 +396,6 @@ int16 MS_ADPCMStream::decodeMS(ADPCMChannelStatus *c, byte code) {
 
 int MS_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
 	int samples;
-	byte data;
 	int i;
 
 	for (samples = 0; samples < numSamples && !endOfData(); samples++) {
@@ -416,10 +422,21 @@ int MS_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
 
 				_blockPos[0] = _channels * 7;
 			} else {
-				data = _stream->readByte();
-				_blockPos[0]++;
-				_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[0], (data >> 4) & 0x0f);
-				_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[_channels - 1], data & 0x0f);
+				// Decode a whole run of data bytes with a single read
+				// call instead of one virtual readByte call per byte
+				byte data[kDecodeChunkSize];
+				uint32 todo = MIN<uint32>(_blockAlign - _blockPos[0], kDecodeChunkSize);
+				todo = MIN<uint32>(todo, _endpos - _stream->pos());
+				uint32 n = _stream->read(data, todo);
+				// Decode zero nibbles past a short read, like readByte
+				// would have produced
+				memset(data + n, 0, todo - n);
+				_blockPos[0] += todo;
+
+				for (uint32 j = 0; j < todo; j++) {
+					_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[0], (data[j] >> 4) & 0x0f);
+					_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[_channels - 1], data[j] & 0x0f);
+				}
 			}
 			_decodedSampleIndex = 0;
 		}
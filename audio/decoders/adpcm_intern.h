@@ -218,6 +218,8 @@ protected:
 	void reset() {
 		ADPCMStream::reset();
 		memset(&_status, 0, sizeof(_status));
+		_decodedSampleCount = 0;
+		_decodedSampleIndex = 0;
 	}
 
 public:
@@ -238,9 +240,15 @@ protected:
 	int16 decodeMS(ADPCMChannelStatus *c, byte);
 
 private:
+	enum {
+		// Number of data bytes decoded per bulk read from the stream;
+		// each byte yields two samples
+		kDecodeChunkSize = 32
+	};
+
 	uint8 _decodedSampleCount;
 	uint8 _decodedSampleIndex;
-	int16 _decodedSamples[4];
+	int16 _decodedSamples[2 * kDecodeChunkSize];
 };
 
 // Duck DK3 IMA ADPCM Decoder
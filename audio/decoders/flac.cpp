@@ -32,6 +32,7 @@
 #include "common/util.h"
 
 #include "audio/audiostream.h"
+#include "audio/decodeahead.h"
 
 #define FLAC__NO_DLL // that MS-magic gave me headaches - just link the library you like
 #include <FLAC/export.h>
@@ -634,7 +635,9 @@ SeekableAudioStream *makeFLACStream(
 		delete s;
 		return nullptr;
 	} else {
-		return s;
+		// Long streams get a producer thread so the mixer callback does
+		// not run the FLAC decoder
+		return makeDecodeAheadStream(s);
 	}
 }
 
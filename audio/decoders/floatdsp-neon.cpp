@@ -0,0 +1,127 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "audio/decoders/floatdsp.h"
+#include "audio/decoders/util.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Audio {
+
+void vectorFMulAddNEON(float *dst, const float *src0,
+                       const float *src1, const float *src2, int len) {
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		const float32x4_t a = vld1q_f32(src0 + i);
+		const float32x4_t b = vld1q_f32(src1 + i);
+		const float32x4_t c = vld1q_f32(src2 + i);
+		vst1q_f32(dst + i, vmlaq_f32(c, a, b));
+	}
+	for (; i < len; i++)
+		dst[i] = src0[i] * src1[i] + src2[i];
+}
+
+void vectorFMulReverseNEON(float *dst, const float *src0,
+                           const float *src1, int len) {
+	const float *rev = src1 + len;
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		rev -= 4;
+		const float32x4_t a = vld1q_f32(src0 + i);
+		// Reverse the four window lanes: swap within the pairs, then
+		// swap the pairs.
+		float32x4_t b = vrev64q_f32(vld1q_f32(rev));
+		b = vcombine_f32(vget_high_f32(b), vget_low_f32(b));
+		vst1q_f32(dst + i, vmulq_f32(a, b));
+	}
+	for (; i < len; i++)
+		dst[i] = src0[i] * src1[len - 1 - i];
+}
+
+/**
+ * clip(floor(x + 0.5)) for four lanes, matching floatToInt16() exactly:
+ * the input is clamped to [-32768, 32768] first so the truncating
+ * conversion cannot overflow, then the truncation is corrected down by
+ * one where it rounded a negative value towards zero. The final 32768
+ * collapses to 32767 in the saturating narrow.
+ */
+static inline int32x4_t floatToInt32x4(float32x4_t x) {
+	x = vaddq_f32(x, vdupq_n_f32(0.5f));
+	x = vmaxq_f32(x, vdupq_n_f32(-32768.0f));
+	x = vminq_f32(x, vdupq_n_f32(32768.0f));
+	int32x4_t t = vcvtq_s32_f32(x);
+	return vaddq_s32(t, vreinterpretq_s32_u32(vcgtq_f32(vcvtq_f32_s32(t), x)));
+}
+
+void floatToInt16NEON(int16 *dst, const float *src, int len) {
+	int i = 0;
+	for (; i + 8 <= len; i += 8) {
+		const int16x4_t a = vqmovn_s32(floatToInt32x4(vld1q_f32(src + i)));
+		const int16x4_t b = vqmovn_s32(floatToInt32x4(vld1q_f32(src + i + 4)));
+		vst1q_s16(dst + i, vcombine_s16(a, b));
+	}
+	for (; i < len; i++)
+		dst[i] = floatToInt16(src[i]);
+}
+
+void floatToInt16InterleaveStereoNEON(int16 *dst, const float *left,
+                                      const float *right, int len) {
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		int16x4x2_t lr;
+		lr.val[0] = vqmovn_s32(floatToInt32x4(vld1q_f32(left + i)));
+		lr.val[1] = vqmovn_s32(floatToInt32x4(vld1q_f32(right + i)));
+		vst2_s16(dst + 2 * i, lr);
+	}
+	for (; i < len; i++) {
+		dst[2 * i    ] = floatToInt16(left [i]);
+		dst[2 * i + 1] = floatToInt16(right[i]);
+	}
+}
+
+} // End of namespace Audio
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
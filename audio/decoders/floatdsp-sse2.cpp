@@ -0,0 +1,127 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include "audio/decoders/floatdsp.h"
+#include "audio/decoders/util.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Audio {
+
+void vectorFMulAddSSE2(float *dst, const float *src0,
+                       const float *src1, const float *src2, int len) {
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		const __m128 a = _mm_loadu_ps(src0 + i);
+		const __m128 b = _mm_loadu_ps(src1 + i);
+		const __m128 c = _mm_loadu_ps(src2 + i);
+		_mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(a, b), c));
+	}
+	for (; i < len; i++)
+		dst[i] = src0[i] * src1[i] + src2[i];
+}
+
+void vectorFMulReverseSSE2(float *dst, const float *src0,
+                           const float *src1, int len) {
+	const float *rev = src1 + len;
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		rev -= 4;
+		const __m128 a = _mm_loadu_ps(src0 + i);
+		__m128 b = _mm_loadu_ps(rev);
+		b = _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3));
+		_mm_storeu_ps(dst + i, _mm_mul_ps(a, b));
+	}
+	for (; i < len; i++)
+		dst[i] = src0[i] * src1[len - 1 - i];
+}
+
+/**
+ * clip(floor(x + 0.5)) for four lanes, matching floatToInt16() exactly:
+ * the input is clamped to [-32768, 32768] first so the truncating
+ * conversion cannot overflow, then the truncation is corrected down by
+ * one where it rounded a negative value towards zero. The final 32768
+ * collapses to 32767 in the saturating pack.
+ */
+static inline __m128i floatToInt32x4(__m128 x) {
+	x = _mm_add_ps(x, _mm_set1_ps(0.5f));
+	x = _mm_max_ps(x, _mm_set1_ps(-32768.0f));
+	x = _mm_min_ps(x, _mm_set1_ps(32768.0f));
+	__m128i t = _mm_cvttps_epi32(x);
+	return _mm_add_epi32(t, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(t), x)));
+}
+
+void floatToInt16SSE2(int16 *dst, const float *src, int len) {
+	int i = 0;
+	for (; i + 8 <= len; i += 8) {
+		const __m128i a = floatToInt32x4(_mm_loadu_ps(src + i));
+		const __m128i b = floatToInt32x4(_mm_loadu_ps(src + i + 4));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(a, b));
+	}
+	for (; i < len; i++)
+		dst[i] = floatToInt16(src[i]);
+}
+
+void floatToInt16InterleaveStereoSSE2(int16 *dst, const float *left,
+                                      const float *right, int len) {
+	int i = 0;
+	for (; i + 4 <= len; i += 4) {
+		const __m128i l = floatToInt32x4(_mm_loadu_ps(left + i));
+		const __m128i r = floatToInt32x4(_mm_loadu_ps(right + i));
+		// [l0 l1 l2 l3 r0 r1 r2 r3] -> [l0 r0 l1 r1 l2 r2 l3 r3]
+		const __m128i packed = _mm_packs_epi32(l, r);
+		const __m128i hi = _mm_shuffle_epi32(packed, _MM_SHUFFLE(3, 2, 3, 2));
+		_mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi16(packed, hi));
+	}
+	for (; i < len; i++) {
+		dst[2 * i    ] = floatToInt16(left [i]);
+		dst[2 * i + 1] = floatToInt16(right[i]);
+	}
+}
+
+} // End of namespace Audio
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // SCUMMVM_SSE2
@@ -0,0 +1,120 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "audio/decoders/floatdsp.h"
+#include "audio/decoders/util.h"
+
+#include "common/system.h"
+
+namespace Audio {
+
+static void vectorFMulAddGeneric(float *dst, const float *src0,
+                                 const float *src1, const float *src2, int len) {
+	while (len-- > 0)
+		*dst++ = *src0++ * *src1++ + *src2++;
+}
+
+VectorFMulAddFunc getVectorFMulAddFunc() {
+	static VectorFMulAddFunc func = nullptr;
+
+	// If no function has been selected yet, detect and select
+	if (!func) {
+		func = vectorFMulAddGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON)) func = vectorFMulAddNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2)) func = vectorFMulAddSSE2;
+#endif
+	}
+	return func;
+}
+
+static void vectorFMulReverseGeneric(float *dst, const float *src0,
+                                     const float *src1, int len) {
+	src1 += len - 1;
+
+	while (len-- > 0)
+		*dst++ = *src0++ * *src1--;
+}
+
+VectorFMulReverseFunc getVectorFMulReverseFunc() {
+	static VectorFMulReverseFunc func = nullptr;
+
+	// If no function has been selected yet, detect and select
+	if (!func) {
+		func = vectorFMulReverseGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON)) func = vectorFMulReverseNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2)) func = vectorFMulReverseSSE2;
+#endif
+	}
+	return func;
+}
+
+static void floatToInt16Generic(int16 *dst, const float *src, int len) {
+	while (len-- > 0)
+		*dst++ = floatToInt16(*src++);
+}
+
+FloatToInt16Func getFloatToInt16Func() {
+	static FloatToInt16Func func = nullptr;
+
+	// If no function has been selected yet, detect and select
+	if (!func) {
+		func = floatToInt16Generic;
+#ifdef SCUMMVM_NEON
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON)) func = floatToInt16NEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2)) func = floatToInt16SSE2;
+#endif
+	}
+	return func;
+}
+
+static void floatToInt16InterleaveStereoGeneric(int16 *dst, const float *left,
+                                                const float *right, int len) {
+	for (int i = 0; i < len; i++) {
+		dst[2 * i    ] = floatToInt16(left[i]);
+		dst[2 * i + 1] = floatToInt16(right[i]);
+	}
+}
+
+FloatToInt16InterleaveStereoFunc getFloatToInt16InterleaveStereoFunc() {
+	static FloatToInt16InterleaveStereoFunc func = nullptr;
+
+	// If no function has been selected yet, detect and select
+	if (!func) {
+		func = floatToInt16InterleaveStereoGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON)) func = floatToInt16InterleaveStereoNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2)) func = floatToInt16InterleaveStereoSSE2;
+#endif
+	}
+	return func;
+}
+
+} // End of namespace Audio
@@ -0,0 +1,93 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AUDIO_DECODERS_FLOATDSP_H
+#define AUDIO_DECODERS_FLOATDSP_H
+
+#include "common/scummsys.h"
+
+namespace Audio {
+
+/**
+ * Float vector primitives for the windowed overlap-add stage of the
+ * transform audio decoders (currently the WMA MDCT window). Dispatched
+ * once per process to an SSE2/NEON kernel from the CPU features the
+ * backend reports, the same scheme the rate converter kernels use.
+ */
+
+/**
+ * dst[i] = src0[i] * src1[i] + src2[i]. dst may equal src2 (the
+ * overlap-add case); no other overlap is allowed.
+ */
+typedef void (*VectorFMulAddFunc)(float *dst, const float *src0,
+                                  const float *src1, const float *src2, int len);
+
+/** Returns the best multiply-add kernel for this CPU. */
+VectorFMulAddFunc getVectorFMulAddFunc();
+
+/** dst[i] = src0[i] * src1[len - 1 - i]. The buffers must not overlap. */
+typedef void (*VectorFMulReverseFunc)(float *dst, const float *src0,
+                                      const float *src1, int len);
+
+/** Returns the best reversed-multiply kernel for this CPU. */
+VectorFMulReverseFunc getVectorFMulReverseFunc();
+
+/**
+ * dst[i] = clip(floor(src[i] + 0.5)) to int16, the output conversion of
+ * the transform decoders (Bink, WMA).
+ */
+typedef void (*FloatToInt16Func)(int16 *dst, const float *src, int len);
+
+/** Returns the best float-to-int16 conversion kernel for this CPU. */
+FloatToInt16Func getFloatToInt16Func();
+
+/**
+ * Same conversion, interleaving two planar channels:
+ * dst[2 * i] = convert(left[i]), dst[2 * i + 1] = convert(right[i]).
+ */
+typedef void (*FloatToInt16InterleaveStereoFunc)(int16 *dst, const float *left,
+                                                 const float *right, int len);
+
+/** Returns the best stereo interleave-and-convert kernel for this CPU. */
+FloatToInt16InterleaveStereoFunc getFloatToInt16InterleaveStereoFunc();
+
+#ifdef SCUMMVM_SSE2
+void vectorFMulAddSSE2(float *dst, const float *src0,
+                       const float *src1, const float *src2, int len);
+void vectorFMulReverseSSE2(float *dst, const float *src0,
+                           const float *src1, int len);
+void floatToInt16SSE2(int16 *dst, const float *src, int len);
+void floatToInt16InterleaveStereoSSE2(int16 *dst, const float *left,
+                                      const float *right, int len);
+#endif
+#ifdef SCUMMVM_NEON
+void vectorFMulAddNEON(float *dst, const float *src0,
+                       const float *src1, const float *src2, int len);
+void vectorFMulReverseNEON(float *dst, const float *src0,
+                           const float *src1, int len);
+void floatToInt16NEON(int16 *dst, const float *src, int len);
+void floatToInt16InterleaveStereoNEON(int16 *dst, const float *left,
+                                      const float *right, int len);
+#endif
+
+} // End of namespace Audio
+
+#endif // AUDIO_DECODERS_FLOATDSP_H
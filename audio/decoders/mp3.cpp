@@ -23,6 +23,7 @@
 
 #ifdef USE_MAD
 
+#include "common/array.h"
 #include "common/debug.h"
 #include "common/mutex.h"
 #include "common/ptr.h"
@@ -107,6 +108,26 @@ protected:
 	Timestamp _length;
 
 private:
+	enum {
+		// One seek index entry is kept every this many MP3 frames. At
+		// 26 ms per frame this gives a granularity of roughly 1.7
+		// seconds, which keeps the index small while still bounding the
+		// header scan a seek has to do.
+		kSeekIndexInterval = 64
+	};
+
+	// MP3 has no frame index of its own, so seeking means scanning
+	// headers from a known position. The index is built as a side effect
+	// of the length scan the constructor performs anyway and maps
+	// playback time to the stream position of a frame, letting seek()
+	// restart the scan close to the target instead of at the beginning.
+	struct SeekIndexEntry {
+		uint32 streamPos;	// position of the frame in _inStream
+		mad_timer_t time;	// playback time at the start of the frame
+	};
+
+	Common::Array<SeekIndexEntry> _seekIndex;
+
 	static Common::SeekableReadStream *skipID3(Common::SeekableReadStream *stream, DisposeAfterUse::Flag dispose);
 };
 
@@ -336,10 +357,27 @@ MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag
 	_channels = MAD_NCHANNELS(&_frame.header);
 	_rate = _frame.header.samplerate;
 
-	// Calculate the length of the stream
-	while (_state != MP3_STATE_EOS)
+	// Calculate the length of the stream, building the seek index from
+	// the frame headers as we pass them
+	uint frameCount = 0;
+	while (_state != MP3_STATE_EOS) {
 		readHeader(*_inStream);
 
+		if (_state == MP3_STATE_READY && (++frameCount % kSeekIndexInterval) == 0 && _stream.this_frame) {
+			SeekIndexEntry entry;
+			// The decode buffer holds the stream bytes just before the
+			// current read position, so the frame's position in the
+			// stream follows from its position in the buffer.
+			entry.streamPos = _inStream->pos() - (_stream.bufend - _stream.this_frame);
+			// _curTime already includes this frame's duration; the entry
+			// wants the time at the start of the frame.
+			entry.time = _frame.header.duration;
+			mad_timer_negate(&entry.time);
+			mad_timer_add(&entry.time, _curTime);
+			_seekIndex.push_back(entry);
+		}
+	}
+
 	// To rule out any invalid sample rate to be encountered here, say in case the
 	// MP3 stream is invalid, we just check the MAD error code here.
 	// We need to assure this, since else we might trigger an assertion in Timestamp
@@ -376,9 +414,30 @@ bool MP3Stream::seek(const Timestamp &where) {
 	mad_timer_t destination;
 	mad_timer_set(&destination, time / 1000, time % 1000, 1000);
 
-	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0) {
-		_inStream->seek(0);
+	// Find the last seek index entry at or before the destination
+	const SeekIndexEntry *entry = nullptr;
+	uint low = 0, high = _seekIndex.size();
+	while (low < high) {
+		uint mid = (low + high) / 2;
+		if (mad_timer_compare(_seekIndex[mid].time, destination) <= 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	if (low > 0)
+		entry = &_seekIndex[low - 1];
+
+	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _curTime) < 0 ||
+			(entry && mad_timer_compare(entry->time, _curTime) > 0)) {
+		// Restart the header scan from the index entry closest to the
+		// destination instead of the beginning of the stream. Like the
+		// frame skipping below, this loses the bit reservoir of the
+		// preceding frames, which mad_frame_decode reports as expected
+		// recoverable errors.
+		_inStream->seek(entry ? entry->streamPos : 0);
 		initStream(*_inStream);
+		if (entry)
+			_curTime = entry->time;
 	}
 
 	while (mad_timer_compare(destination, _curTime) > 0 && _state != MP3_STATE_EOS)
@@ -0,0 +1,132 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/endian.h"
+#include "common/stream.h"
+#include "common/textconsole.h"
+
+#include "audio/audiostream.h"
+#include "audio/decoders/probe.h"
+#include "audio/decoders/aiff.h"
+#include "audio/decoders/flac.h"
+#include "audio/decoders/mp3.h"
+#include "audio/decoders/raw.h"
+#include "audio/decoders/voc.h"
+#include "audio/decoders/vorbis.h"
+#include "audio/decoders/wave.h"
+
+namespace Audio {
+
+ProbedAudioFormat probeAudioFormat(Common::SeekableReadStream &stream) {
+	byte header[12];
+
+	const int64 startPos = stream.pos();
+	const uint32 read = stream.read(header, sizeof(header));
+	stream.seek(startPos);
+
+	if (read < 4)
+		return kAudioFormatUnknown;
+
+	switch (READ_BE_UINT32(header)) {
+	case MKTAG('R', 'I', 'F', 'F'):
+		return kAudioFormatWAV;
+	case MKTAG('F', 'O', 'R', 'M'):
+		if (read >= 12 && (READ_BE_UINT32(header + 8) == MKTAG('A', 'I', 'F', 'F') ||
+		                   READ_BE_UINT32(header + 8) == MKTAG('A', 'I', 'F', 'C')))
+			return kAudioFormatAIFF;
+		return kAudioFormatUnknown;
+	case MKTAG('f', 'L', 'a', 'C'):
+		return kAudioFormatFLAC;
+	case MKTAG('O', 'g', 'g', 'S'):
+		return kAudioFormatVorbis;
+	case MKTAG('C', 'r', 'e', 'a'):	// "Creative Voice File"
+		return kAudioFormatVOC;
+	default:
+		break;
+	}
+
+	// MP3 has no container magic: look for an ID3v2 tag or a frame sync
+	if (header[0] == 'I' && header[1] == 'D' && header[2] == '3')
+		return kAudioFormatMP3;
+	if (header[0] == 0xFF && (header[1] & 0xE0) == 0xE0)
+		return kAudioFormatMP3;
+
+	return kAudioFormatUnknown;
+}
+
+RewindableAudioStream *makeStreamForAudioFormat(ProbedAudioFormat format, Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse) {
+	switch (format) {
+	case kAudioFormatWAV:
+		return makeWAVStream(stream, disposeAfterUse);
+	case kAudioFormatAIFF:
+		return makeAIFFStream(stream, disposeAfterUse);
+	case kAudioFormatVOC:
+		return makeVOCStream(stream, Audio::FLAG_UNSIGNED, disposeAfterUse);
+	case kAudioFormatFLAC:
+#ifdef USE_FLAC
+		return makeFLACStream(stream, disposeAfterUse);
+#else
+		warning("makeStreamForAudioFormat: FLAC support is not compiled in");
+		break;
+#endif
+	case kAudioFormatVorbis:
+#ifdef USE_VORBIS
+		return makeVorbisStream(stream, disposeAfterUse);
+#else
+		warning("makeStreamForAudioFormat: Vorbis support is not compiled in");
+		break;
+#endif
+	case kAudioFormatMP3:
+#ifdef USE_MAD
+		return makeMP3Stream(stream, disposeAfterUse);
+#else
+		warning("makeStreamForAudioFormat: MP3 support is not compiled in");
+		break;
+#endif
+	default:
+		break;
+	}
+
+	if (disposeAfterUse == DisposeAfterUse::YES)
+		delete stream;
+
+	return nullptr;
+}
+
+RewindableAudioStream *makeProbedAudioStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, AudioFormatCache *cache, const Common::String &name) {
+	ProbedAudioFormat format;
+
+	if (cache && !name.empty()) {
+		AudioFormatCache::const_iterator it = cache->find(name);
+		if (it != cache->end()) {
+			format = it->_value;
+		} else {
+			format = probeAudioFormat(*stream);
+			(*cache)[name] = format;
+		}
+	} else {
+		format = probeAudioFormat(*stream);
+	}
+
+	return makeStreamForAudioFormat(format, stream, disposeAfterUse);
+}
+
+} // End of namespace Audio
@@ -0,0 +1,91 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * @file
+ * Content based audio container detection.
+ *
+ * Instead of handing a stream to each decoder factory in turn - with every
+ * factory re-reading and rejecting the header - the functions here read the
+ * magic bytes once and dispatch to the matching factory directly.
+ */
+
+#ifndef AUDIO_DECODERS_PROBE_H
+#define AUDIO_DECODERS_PROBE_H
+
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/str.h"
+#include "common/types.h"
+
+namespace Common {
+class SeekableReadStream;
+} // End of namespace Common
+
+namespace Audio {
+
+class RewindableAudioStream;
+
+/**
+ * Audio containers recognized by probeAudioFormat().
+ */
+enum ProbedAudioFormat {
+	kAudioFormatUnknown = 0,
+	kAudioFormatWAV,
+	kAudioFormatAIFF,
+	kAudioFormatVOC,
+	kAudioFormatFLAC,
+	kAudioFormatVorbis,
+	kAudioFormatMP3
+};
+
+/**
+ * Cache mapping sound names to their probed container format, so repeated
+ * opens of the same effect skip the header read entirely. Callers keep one
+ * per archive or sound directory and pass it to makeProbedAudioStream().
+ */
+typedef Common::HashMap<Common::String, ProbedAudioFormat, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> AudioFormatCache;
+
+/**
+ * Identify an audio container from its magic bytes. This reads the first
+ * few bytes of the stream in one go and seeks back to the start position.
+ */
+ProbedAudioFormat probeAudioFormat(Common::SeekableReadStream &stream);
+
+/**
+ * Create a stream for a container identified by probeAudioFormat().
+ *
+ * Returns nullptr (disposing the input as requested) when the format is
+ * unknown or its decoder is not compiled in.
+ */
+RewindableAudioStream *makeStreamForAudioFormat(ProbedAudioFormat format, Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse);
+
+/**
+ * Probe the stream and create the matching decoder in one step.
+ *
+ * When both a cache and a name are given, the probe result is looked up
+ * there first and stored on a miss.
+ */
+RewindableAudioStream *makeProbedAudioStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, AudioFormatCache *cache = nullptr, const Common::String &name = Common::String());
+
+} // End of namespace Audio
+
+#endif
@@ -25,6 +25,8 @@
 #include "common/types.h"
 #include "common/util.h"
 
+#include "audio/decoders/floatdsp.h"
+
 namespace Audio {
 
 // Convert one float sample into a int16 sample
@@ -36,10 +38,9 @@ static inline int16 floatToInt16(float src) {
 static inline void floatToInt16Interleave(int16 *dst, const float **src,
 										  uint32 length, uint8 channels) {
 	if (channels == 2) {
-		for (uint32 i = 0; i < length; i++) {
-			dst[2 * i    ] = floatToInt16(src[0][i]);
-			dst[2 * i + 1] = floatToInt16(src[1][i]);
-		}
+		getFloatToInt16InterleaveStereoFunc()(dst, src[0], src[1], length);
+	} else if (channels == 1) {
+		getFloatToInt16Func()(dst, src[0], length);
 	} else {
 		for (uint8 c = 0; c < channels; c++)
 			for (uint32 i = 0, j = c; i < length; i++, j += channels)
@@ -34,6 +34,7 @@
 #include "common/util.h"
 
 #include "audio/audiostream.h"
+#include "audio/decodeahead.h"
 
 #ifdef USE_TREMOR
 #ifdef USE_TREMOLO
@@ -247,7 +248,9 @@ SeekableAudioStream *makeVorbisStream(
 		delete s;
 		return nullptr;
 	} else {
-		return s;
+		// Long streams get a producer thread so the mixer callback does
+		// not run the Vorbis decoder
+		return makeDecodeAheadStream(s);
 	}
 }
 
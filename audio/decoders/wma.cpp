@@ -33,6 +33,7 @@
 
 #include "audio/audiostream.h"
 
+#include "audio/decoders/floatdsp.h"
 #include "audio/decoders/util.h"
 #include "audio/decoders/raw.h"
 #include "audio/decoders/wma.h"
@@ -49,20 +50,6 @@ static inline void butterflyFloats(float *v1, float *v2, int len) {
 	}
 }
 
-static inline void vectorFMulAdd(float *dst, const float *src0,
-						  const float *src1, const float *src2, int len) {
-	while (len-- > 0)
-		*dst++ = *src0++ * *src1++ + *src2++;
-}
-
-static inline void vectorFMulReverse(float *dst, const float *src0,
-									 const float *src1, int len) {
-	src1 += len - 1;
-
-	while (len-- > 0)
-		*dst++ = *src0++ * *src1--;
-}
-
 
 WMACodec::WMACodec(int version, uint32 sampleRate, uint8 channels,
 		uint32 bitRate, uint32 blockAlign, Common::SeekableReadStream *extraData) :
@@ -1404,6 +1391,9 @@ bool WMACodec::decodeRunLevel(Common::BitStream8MSB &bits, const HuffmanDecoder
  *  is always 1 (MDCT reconstruction rule).
  */
 void WMACodec::window(float *out) const {
+	const VectorFMulAddFunc vectorFMulAdd = getVectorFMulAddFunc();
+	const VectorFMulReverseFunc vectorFMulReverse = getVectorFMulReverseFunc();
+
 	const float *in = _output;
 
 	// Left part
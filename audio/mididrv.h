@@ -205,6 +205,33 @@ public:
 	 */
 	void send(int8 source, byte status, byte firstOp, byte secondOp);
 
+	/**
+	 * Announces that the events sent until the matching endEventBatch
+	 * call all belong to one timer tick. A driver which takes a mutex
+	 * for individual events can override these to claim it once for
+	 * the whole burst instead of hundreds of times on a dense tick;
+	 * the defaults do nothing. Batches may nest within the per-event
+	 * locks, so overrides must use recursive mutexes (Common::Mutex
+	 * is recursive on all backends).
+	 */
+	virtual void startEventBatch() { }
+
+	/** Closes the event batch opened by startEventBatch. */
+	virtual void endEventBatch() { }
+
+	/**
+	 * Opens an event batch on a driver for the lifetime of the scope.
+	 * This is safer than calling the methods directly when the code in
+	 * between can return early or even delete the event producer.
+	 */
+	class EventBatchScope {
+	public:
+		EventBatchScope(MidiDriver_BASE *driver) : _driver(driver) { _driver->startEventBatch(); }
+		~EventBatchScope() { _driver->endEventBatch(); }
+	private:
+		MidiDriver_BASE *_driver;
+	};
+
 	/**
 	 * Transmit a SysEx to the MIDI device.
 	 *
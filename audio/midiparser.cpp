@@ -47,6 +47,9 @@ _disableAllNotesOffMidiEvents(false),
 _disableAutoStartPlayback(false),
 _numTracks(0),
 _activeTrack(255),
+_parsedData(nullptr),
+_parsedSize(0),
+_parsedDigest(0),
 _abortParse(false),
 _jumpingToTick(false),
 _doParse(true),
@@ -201,6 +204,12 @@ void MidiParser::onTimer() {
 	if (!_position.isTracking() || !_driver || !_doParse || _pause || !_driver->isReady(_source))
 		return;
 
+	// Everything this tick delivers goes out as one batch, so drivers
+	// taking a mutex per event can take it once instead. The scope
+	// object matters here: processEvent() may delete this parser, but
+	// the driver outlives its own timer callback.
+	MidiDriver_BASE::EventBatchScope batchScope(_driver);
+
 	_abortParse = false;
 	endTime = _position._playTime + _timerRate;
 
@@ -667,6 +676,31 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 	return true;
 }
 
+// A cheap digest over the head and tail of a piece of MIDI data.
+// Together with the buffer address and size this identifies the data
+// well enough to tell "the same music again" apart from a reused
+// buffer that has been refilled with something else.
+static uint32 digestMusicData(const byte *data, uint32 size) {
+	const uint32 span = MIN<uint32>(size, 64);
+	uint32 digest = size;
+	for (uint32 i = 0; i < span; i++)
+		digest = digest * 33 + data[i];
+	for (uint32 i = size - span; i < size; i++)
+		digest = digest * 33 + data[i];
+	return digest;
+}
+
+bool MidiParser::isParsedMusicData(const byte *data, uint32 size) const {
+	return _numTracks > 0 && data == _parsedData && size == _parsedSize &&
+		digestMusicData(data, size) == _parsedDigest;
+}
+
+void MidiParser::rememberParsedMusicData(byte *data, uint32 size) {
+	_parsedData = data;
+	_parsedSize = size;
+	_parsedDigest = digestMusicData(data, size);
+}
+
 void MidiParser::unloadMusic() {
 	if (_numTracks == 0)
 		// No music data loaded
@@ -676,6 +710,8 @@ void MidiParser::unloadMusic() {
 	_numTracks = 0;
 	_activeTrack = 255;
 	_abortParse = true;
+	_parsedData = nullptr;
+	_parsedSize = 0;
 	memset(_tracks, 0, sizeof(_tracks));
 	memset(_numSubtracks, 1, sizeof(_numSubtracks));
 	for (int i = 0; i < MAXIMUM_SUBTRACKS; i++) {
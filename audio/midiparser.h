@@ -378,6 +378,10 @@ protected:
 	byte   _numSubtracks[MAXIMUM_TRACKS]; ///< The number of subtracks for each track.
 	byte   _activeTrack;   ///< Keeps track of the currently active track, in multi-track formats.
 
+	byte  *_parsedData;    ///< Buffer the current track table was scanned from, or nullptr.
+	uint32 _parsedSize;    ///< Size of that buffer.
+	uint32 _parsedDigest;  ///< Cheap digest over the head and tail of that buffer.
+
 	Tracker _position;      ///< The current time/position in the active track.
 	EventInfo *_nextEvent;  ///< The next event to transmit. Points to one of the _nextSubtrackEvents
 							///< entries. Will always point to _nextSubtrackEvents[0] for tracks without
@@ -423,6 +427,22 @@ protected:
 	void hangingNote(byte channel, byte note, uint32 ticksLeft, bool recycle = true);
 	void hangAllActiveNotes();
 
+	/**
+	 * Checks whether the track table from the previous loadMusic call
+	 * is still valid for this buffer. loadMusic implementations use
+	 * this to skip the chunk scan when a client reloads the same piece
+	 * of music to replay it; in that case restarting the music is just
+	 * a matter of rewinding. The check fails once unloadMusic has been
+	 * called, since that clears the track table.
+	 */
+	bool isParsedMusicData(const byte *data, uint32 size) const;
+
+	/**
+	 * Records the buffer the track table was just scanned from, so a
+	 * later loadMusic call with the same data can skip the scan.
+	 */
+	void rememberParsedMusicData(byte *data, uint32 size);
+
 	/**
 	 * Called before starting playback of a track.
 	 * Can be implemented by subclasses if they need to
@@ -122,6 +122,15 @@ bool MidiParser_SMF::loadMusic(byte *data, uint32 size) {
 	byte midiType;
 	byte numTrackChunks;
 
+	if (isParsedMusicData(data, size)) {
+		// The track table still points into this buffer, so replaying
+		// the piece does not need another chunk scan.
+		stopPlaying();
+		setTempo(500000);
+		setTrack(0);
+		return true;
+	}
+
 	unloadMusic();
 	byte *pos = data;
 
@@ -191,6 +200,7 @@ bool MidiParser_SMF::loadMusic(byte *data, uint32 size) {
 	// Note that we assume the original data passed in
 	// will persist beyond this call, i.e. we do NOT
 	// copy the data to our own buffer. Take warning....
+	rememberParsedMusicData(data, size);
 	resetTracking();
 	setTempo(500000);
 	setTrack(0);
@@ -338,6 +338,15 @@ bool MidiParser_XMIDI::loadMusic(byte *data, uint32 size) {
 
 	_loopCount = -1;
 
+	if (isParsedMusicData(data, size)) {
+		// Same buffer as last time: the track, branch and timbre tables
+		// all still point into it, so replaying skips the chunk scan.
+		stopPlaying();
+		setTempo(500000);
+		setTrack(0);
+		return true;
+	}
+
 	unloadMusic();
 	byte *pos = data;
 
@@ -507,6 +516,7 @@ bool MidiParser_XMIDI::loadMusic(byte *data, uint32 size) {
 		// Note that we assume the original data passed in
 		// will persist beyond this call, i.e. we do NOT
 		// copy the data to our own buffer. Take warning....
+		rememberParsedMusicData(data, size);
 		_ppqn = 60;
 		resetTracking();
 		setTempo(500000);
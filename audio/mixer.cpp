@@ -22,6 +22,7 @@
 #include "gui/EventRecorder.h"
 
 #include "common/util.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 
 #include "audio/mixer_intern.h"
@@ -227,7 +228,8 @@ private:
 #pragma mark -
 
 MixerImpl::MixerImpl(uint sampleRate, bool stereo, uint outBufSize)
-	: _mutex(), _sampleRate(sampleRate), _stereo(stereo), _outBufSize(outBufSize), _mixerReady(false), _handleSeed(0), _soundTypeSettings() {
+	: _mutex(), _sampleRate(sampleRate), _stereo(stereo), _outBufSize(outBufSize), _mixerReady(false), _handleSeed(0), _soundTypeSettings(),
+	  _cmdRead(0), _cmdWrite(0) {
 
 	assert(sampleRate > 0);
 
@@ -328,9 +330,79 @@ void MixerImpl::playStream(
 	insertChannel(handle, chan);
 }
 
+void MixerImpl::queueCommand(byte cmd, SoundHandle handle, int32 value) {
+	Common::StackLock lock(_cmdMutex);
+
+	const uint32 write = _cmdWrite.load(std::memory_order_relaxed);
+	if (write - _cmdRead.load(std::memory_order_acquire) == NUM_COMMANDS) {
+		// The ring is full. Fall back to the mixer mutex, flush what is
+		// pending ourselves and apply the new command directly, so that
+		// the order of the changes is kept.
+		Common::StackLock lock2(_mutex);
+		drainCommandQueue();
+		ChannelCommand command;
+		command.cmd = cmd;
+		command.handle = handle._val;
+		command.value = value;
+		applyCommand(command);
+		return;
+	}
+
+	ChannelCommand &command = _commandQueue[write & (NUM_COMMANDS - 1)];
+	command.cmd = cmd;
+	command.handle = handle._val;
+	command.value = value;
+	_cmdWrite.store(write + 1, std::memory_order_release);
+}
+
+/** Applies all queued parameter changes. Must be called with _mutex held. */
+void MixerImpl::drainCommandQueue() {
+	uint32 read = _cmdRead.load(std::memory_order_relaxed);
+	const uint32 write = _cmdWrite.load(std::memory_order_acquire);
+	while (read != write) {
+		applyCommand(_commandQueue[read & (NUM_COMMANDS - 1)]);
+		read++;
+	}
+	_cmdRead.store(read, std::memory_order_release);
+}
+
+void MixerImpl::applyCommand(const ChannelCommand &command) {
+	// Quietly drop changes for sounds that have already terminated, just
+	// like the setters used to
+	const int index = command.handle % NUM_CHANNELS;
+	Channel *chan = _channels[index];
+	if (!chan || chan->getHandle()._val != command.handle)
+		return;
+
+	switch (command.cmd) {
+	case kCmdSetVolume:
+		chan->setVolume((byte)command.value);
+		break;
+	case kCmdSetBalance:
+		chan->setBalance((int8)command.value);
+		break;
+	case kCmdSetFaderL:
+		chan->setFaderL((uint8)command.value);
+		break;
+	case kCmdSetFaderR:
+		chan->setFaderR((uint8)command.value);
+		break;
+	case kCmdSetRate:
+		chan->setRate((uint32)command.value);
+		break;
+	case kCmdResetRate:
+		chan->resetRate();
+		break;
+	default:
+		break;
+	}
+}
+
 int MixerImpl::mixCallback(byte *samples, uint len) {
 	assert(samples);
 
+	PROFILE_SCOPE("Mixer::mixCallback");
+
 	Common::StackLock lock(_mutex);
 
 	int16 *buf = (int16 *)samples;
@@ -338,6 +410,9 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 	// Since the mixer callback has been called, the mixer must be ready...
 	_mixerReady = true;
 
+	// Apply the parameter changes queued since the last mix block
+	drainCommandQueue();
+
 	//  zero the buf
 	memset(buf, 0, len);
 
@@ -416,16 +491,17 @@ bool MixerImpl::isSoundTypeMuted(SoundType type) const {
 }
 
 void MixerImpl::setChannelVolume(SoundHandle handle, byte volume) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	_channels[index]->setVolume(volume);
+	queueCommand(kCmdSetVolume, handle, volume);
 }
 
 byte MixerImpl::getChannelVolume(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+
+	// Apply any still-queued parameter changes first, so a getter right
+	// after a setter observes the value that was just set rather than
+	// whatever the last mix block left behind.
+	drainCommandQueue();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -434,16 +510,13 @@ byte MixerImpl::getChannelVolume(SoundHandle handle) {
 }
 
 void MixerImpl::setChannelBalance(SoundHandle handle, int8 balance) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	_channels[index]->setBalance(balance);
+	queueCommand(kCmdSetBalance, handle, balance);
 }
 
 int8 MixerImpl::getChannelBalance(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+	drainCommandQueue();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -452,16 +525,13 @@ int8 MixerImpl::getChannelBalance(SoundHandle handle) {
 }
 
 void MixerImpl::setChannelFaderL(SoundHandle handle, uint8 faderL) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	_channels[index]->setFaderL(faderL);
+	queueCommand(kCmdSetFaderL, handle, faderL);
 }
 
 uint8 MixerImpl::getChannelFaderL(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+	drainCommandQueue();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -470,16 +540,13 @@ uint8 MixerImpl::getChannelFaderL(SoundHandle handle) {
 }
 
 void MixerImpl::setChannelFaderR(SoundHandle handle, uint8 faderR) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	_channels[index]->setFaderR(faderR);
+	queueCommand(kCmdSetFaderR, handle, faderR);
 }
 
 uint8 MixerImpl::getChannelFaderR(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+	drainCommandQueue();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -488,16 +555,13 @@ uint8 MixerImpl::getChannelFaderR(SoundHandle handle) {
 }
 
 void MixerImpl::setChannelRate(SoundHandle handle, uint32 rate) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	_channels[index]->setRate(rate);
+	queueCommand(kCmdSetRate, handle, rate);
 }
 
 uint32 MixerImpl::getChannelRate(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+	drainCommandQueue();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -506,13 +570,7 @@ uint32 MixerImpl::getChannelRate(SoundHandle handle) {
 }
 
 void MixerImpl::resetChannelRate(SoundHandle handle) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	_channels[index]->resetRate();
+	queueCommand(kCmdResetRate, handle, 0);
 }
 
 uint32 MixerImpl::getSoundElapsedTime(SoundHandle handle) {
@@ -26,6 +26,8 @@
 #include "common/mutex.h"
 #include "audio/mixer.h"
 
+#include <atomic>
+
 namespace Audio {
 
 /**
@@ -79,6 +81,47 @@ private:
 	SoundTypeSettings _soundTypeSettings[4];
 	Channel *_channels[NUM_CHANNELS];
 
+	/**
+	 * A queued parameter change for a playing channel.
+	 *
+	 * Engines change volumes, balances and rates far more often than they
+	 * start or stop sounds (fades update every few milliseconds), and each
+	 * of those setter calls used to take the mixer mutex, which could make
+	 * the audio callback late when the game thread was preempted while
+	 * holding it. The setters now append to a small command ring instead,
+	 * and the callback applies the pending commands at the next mix block
+	 * boundary, before mixing.
+	 *
+	 * The ring is written under _cmdMutex, which the audio callback never
+	 * takes, and drained under _mutex; the read and write positions are
+	 * atomics so each side sees the other's progress without a shared lock.
+	 */
+	struct ChannelCommand {
+		byte cmd;
+		uint32 handle;
+		int32 value;
+	};
+
+	enum {
+		kCmdSetVolume,
+		kCmdSetBalance,
+		kCmdSetFaderL,
+		kCmdSetFaderR,
+		kCmdSetRate,
+		kCmdResetRate
+	};
+
+	enum {
+		NUM_COMMANDS = 256 // must be a power of two
+	};
+
+	Common::Mutex _cmdMutex;
+	ChannelCommand _commandQueue[NUM_COMMANDS];
+	std::atomic<uint32> _cmdRead, _cmdWrite;
+
+	void queueCommand(byte cmd, SoundHandle handle, int32 value);
+	void drainCommandQueue();
+	void applyCommand(const ChannelCommand &command);
 
 public:
 
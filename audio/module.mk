@@ -7,6 +7,7 @@ MODULE_OBJS := \
 	casio.o \
 	chip.o \
 	cms.o \
+	decodeahead.o \
 	fmopl.o \
 	mac_plugin.o \
 	mididrv.o \
@@ -32,10 +33,12 @@ MODULE_OBJS := \
 	decoders/apc.o \
 	decoders/asf.o \
 	decoders/flac.o \
+	decoders/floatdsp.o \
 	decoders/g711.o \
 	decoders/iff_sound.o \
 	decoders/mac_snd.o \
 	decoders/mp3.o \
+	decoders/probe.o \
 	decoders/qdm2.o \
 	decoders/quicktime.o \
 	decoders/raw.o \
@@ -132,5 +135,16 @@ MODULE_OBJS += \
 	soundfont/vab/vab.o
 endif
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	decoders/floatdsp-neon.o \
+	rate-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	decoders/floatdsp-sse2.o \
+	rate-sse2.o
+endif
+
 # Include common rules
 include $(srcdir)/rules.mk
@@ -421,6 +421,20 @@ void MidiDriver_MT32GM::send(int8 source, uint32 b) {
 	processEvent(source, b, outputChannel, controlData);
 }
 
+void MidiDriver_MT32GM::startEventBatch() {
+	// These two are taken and released for single events all over the
+	// event path; claiming them here collapses that into one contended
+	// acquisition per timer tick. The per-event locks keep working
+	// inside the batch because Common::Mutex is recursive.
+	_activeNotesMutex.lock();
+	_sysExQueueMutex.lock();
+}
+
+void MidiDriver_MT32GM::endEventBatch() {
+	_sysExQueueMutex.unlock();
+	_activeNotesMutex.unlock();
+}
+
 // MIDI messages can be found at https://web.archive.org/web/20120128110425/http://www.midi.org/techspecs/midimessages.php
 void MidiDriver_MT32GM::processEvent(int8 source, uint32 b, uint8 outputChannel, MidiChannelControlData &controlData, bool channelLockedByOtherSource) {
 	assert(source < MAXIMUM_SOURCES);
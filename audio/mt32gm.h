@@ -266,6 +266,8 @@ public:
 	using MidiDriver_BASE::send;
 	void send(uint32 b) override;
 	void send(int8 source, uint32 b) override;
+	void startEventBatch() override;
+	void endEventBatch() override;
 	void sysEx(const byte *msg, uint16 length) override;
 	uint16 sysExNoDelay(const byte *msg, uint16 length) override;
 	/**
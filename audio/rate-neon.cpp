@@ -0,0 +1,114 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "audio/rate-simd.h"
+#include "audio/mixer.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Audio {
+
+// Truncating division by 256, matching the scalar (x * vol) / 256:
+// add 255 to negative products before the arithmetic shift.
+static inline int32x4_t divTrunc256(int32x4_t x) {
+	const int32x4_t corr = vandq_s32(vshrq_n_s32(x, 31), vdupq_n_s32(255));
+	return vshrq_n_s32(vaddq_s32(x, corr), 8);
+}
+
+void mixStereoNEON(st_sample_t *out, const st_sample_t *in, uint frames,
+                   st_volume_t volL, st_volume_t volR) {
+	const int16_t volPair[2] = { (int16_t)volL, (int16_t)volR };
+	const int16x4_t vol4 = vreinterpret_s16_s32(vdup_n_s32(*(const int32_t *)volPair));
+
+	// 4 stereo frames (8 samples) per iteration.
+	while (frames >= 4) {
+		const int16x8_t inVec = vld1q_s16(in);
+		const int16x8_t outVec = vld1q_s16(out);
+
+		// Widening multiply gives the exact 32-bit product per sample;
+		// the volume vector is already interleaved L/R.
+		int32x4_t mixLo = divTrunc256(vmull_s16(vget_low_s16(inVec), vol4));
+		int32x4_t mixHi = divTrunc256(vmull_s16(vget_high_s16(inVec), vol4));
+
+		mixLo = vaddq_s32(mixLo, vmovl_s16(vget_low_s16(outVec)));
+		mixHi = vaddq_s32(mixHi, vmovl_s16(vget_high_s16(outVec)));
+
+		// Saturating narrow is the vector form of clampedAdd().
+		vst1q_s16(out, vcombine_s16(vqmovn_s32(mixLo), vqmovn_s32(mixHi)));
+
+		in += 8;
+		out += 8;
+		frames -= 4;
+	}
+
+	// Scalar tail
+	while (frames--) {
+		clampedAdd(out[0], (in[0] * (int)volL) / Mixer::kMaxMixerVolume);
+		clampedAdd(out[1], (in[1] * (int)volR) / Mixer::kMaxMixerVolume);
+		in += 2;
+		out += 2;
+	}
+}
+
+int32 sincDotNEON(const st_sample_t *src, const int16 *coeffs) {
+	// kSincTaps == 16: four widening multiply-accumulates cover the row
+	const int16x8_t a0 = vld1q_s16(src);
+	const int16x8_t a1 = vld1q_s16(src + 8);
+	const int16x8_t c0 = vld1q_s16(coeffs);
+	const int16x8_t c1 = vld1q_s16(coeffs + 8);
+
+	int32x4_t acc = vmull_s16(vget_low_s16(a0), vget_low_s16(c0));
+	acc = vmlal_s16(acc, vget_high_s16(a0), vget_high_s16(c0));
+	acc = vmlal_s16(acc, vget_low_s16(a1), vget_low_s16(c1));
+	acc = vmlal_s16(acc, vget_high_s16(a1), vget_high_s16(c1));
+
+	const int32x2_t sum = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+	return vget_lane_s32(vpadd_s32(sum, sum), 0);
+}
+
+} // End of namespace Audio
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,79 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AUDIO_RATE_SIMD_H
+#define AUDIO_RATE_SIMD_H
+
+#include "audio/rate.h"
+
+namespace Audio {
+
+/**
+ * Batch mixing kernel used by the 1:1 rate converter path: applies the
+ * per-channel volume to `frames` interleaved stereo frames from `in` and
+ * saturating-adds them into `out`. Must behave exactly like the scalar
+ * clampedAdd() loop, i.e. out += (in * vol) / kMaxMixerVolume with
+ * truncating division and clamping to the int16 range.
+ */
+typedef void (*MixStereoFunc)(st_sample_t *out, const st_sample_t *in, uint frames,
+                              st_volume_t volL, st_volume_t volR);
+
+/**
+ * Returns the best mixing kernel for this CPU. Selected once, on first
+ * use, from the CPU features the backend reports - the same scheme
+ * BlendBlit uses for the graphics kernels.
+ */
+MixStereoFunc getMixStereoFunc();
+
+#ifdef SCUMMVM_SSE2
+void mixStereoSSE2(st_sample_t *out, const st_sample_t *in, uint frames,
+                   st_volume_t volL, st_volume_t volR);
+#endif
+#ifdef SCUMMVM_NEON
+void mixStereoNEON(st_sample_t *out, const st_sample_t *in, uint frames,
+                   st_volume_t volL, st_volume_t volR);
+#endif
+
+/** Filter length of the windowed-sinc resampler, in taps. */
+enum {
+	kSincTaps = 16
+};
+
+/**
+ * Inner product of one polyphase filter row with kSincTaps input samples
+ * of a single channel. The Q14 coefficient rows are normalized so the
+ * accumulator cannot overflow 32 bits; the caller shifts and clamps.
+ */
+typedef int32 (*SincDotFunc)(const st_sample_t *src, const int16 *coeffs);
+
+/** Returns the best inner product kernel for this CPU. */
+SincDotFunc getSincDotFunc();
+
+#ifdef SCUMMVM_SSE2
+int32 sincDotSSE2(const st_sample_t *src, const int16 *coeffs);
+#endif
+#ifdef SCUMMVM_NEON
+int32 sincDotNEON(const st_sample_t *src, const int16 *coeffs);
+#endif
+
+} // End of namespace Audio
+
+#endif
@@ -0,0 +1,113 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "audio/rate-simd.h"
+#include "audio/mixer.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Audio {
+
+// Truncating division by 256, matching the scalar (x * vol) / 256:
+// add 255 to negative products before the arithmetic shift.
+static inline __m128i divTrunc256(__m128i x) {
+	const __m128i corr = _mm_and_si128(_mm_srai_epi32(x, 31), _mm_set1_epi32(255));
+	return _mm_srai_epi32(_mm_add_epi32(x, corr), 8);
+}
+
+void mixStereoSSE2(st_sample_t *out, const st_sample_t *in, uint frames,
+                   st_volume_t volL, st_volume_t volR) {
+	// Pair masks for pmaddwd: with (volL, 0) the per-pair sum collapses
+	// to Li * volL, with (0, volR) to Ri * volR.
+	const __m128i vmaskL = _mm_set1_epi32((uint16)volL);
+	const __m128i vmaskR = _mm_set1_epi32((uint32)volR << 16);
+
+	// 4 stereo frames (8 samples) per iteration.
+	while (frames >= 4) {
+		const __m128i inVec = _mm_loadu_si128((const __m128i *)in);
+		const __m128i outVec = _mm_loadu_si128((const __m128i *)out);
+
+		__m128i left = divTrunc256(_mm_madd_epi16(inVec, vmaskL));	// L0 L1 L2 L3
+		__m128i right = divTrunc256(_mm_madd_epi16(inVec, vmaskR));	// R0 R1 R2 R3
+
+		// Back to interleaved 32-bit lanes: L0 R0 L1 R1 / L2 R2 L3 R3
+		const __m128i mixLo = _mm_unpacklo_epi32(left, right);
+		const __m128i mixHi = _mm_unpackhi_epi32(left, right);
+
+		// Sign-extend the accumulator to 32 bit, add, and pack with
+		// signed saturation - the vector form of clampedAdd().
+		const __m128i outLo = _mm_srai_epi32(_mm_unpacklo_epi16(outVec, outVec), 16);
+		const __m128i outHi = _mm_srai_epi32(_mm_unpackhi_epi16(outVec, outVec), 16);
+
+		const __m128i sum = _mm_packs_epi32(_mm_add_epi32(outLo, mixLo), _mm_add_epi32(outHi, mixHi));
+		_mm_storeu_si128((__m128i *)out, sum);
+
+		in += 8;
+		out += 8;
+		frames -= 4;
+	}
+
+	// Scalar tail
+	while (frames--) {
+		clampedAdd(out[0], (in[0] * (int)volL) / Mixer::kMaxMixerVolume);
+		clampedAdd(out[1], (in[1] * (int)volR) / Mixer::kMaxMixerVolume);
+		in += 2;
+		out += 2;
+	}
+}
+
+int32 sincDotSSE2(const st_sample_t *src, const int16 *coeffs) {
+	// kSincTaps == 16: two pmaddwd cover the whole filter row
+	const __m128i a0 = _mm_loadu_si128((const __m128i *)src);
+	const __m128i a1 = _mm_loadu_si128((const __m128i *)(src + 8));
+	const __m128i c0 = _mm_loadu_si128((const __m128i *)coeffs);
+	const __m128i c1 = _mm_loadu_si128((const __m128i *)(coeffs + 8));
+
+	__m128i acc = _mm_add_epi32(_mm_madd_epi16(a0, c0), _mm_madd_epi16(a1, c1));
+	acc = _mm_add_epi32(acc, _mm_srli_si128(acc, 8));
+	acc = _mm_add_epi32(acc, _mm_srli_si128(acc, 4));
+	return _mm_cvtsi128_si32(acc);
+}
+
+} // End of namespace Audio
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
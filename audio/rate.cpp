@@ -29,9 +29,14 @@
 
 #include "audio/audiostream.h"
 #include "audio/rate.h"
+#include "audio/rate-simd.h"
 #include "audio/mixer.h"
+#include "common/config-manager.h"
+#include "common/system.h"
 #include "common/util.h"
 
+#include <math.h>
+
 namespace Audio {
 
 /**
@@ -45,6 +50,45 @@ enum {
 	FRAC_HALF_LOW = (1L << (FRAC_BITS_LOW-1))
 };
 
+enum {
+	/** Number of fractional phases the sinc filter bank is sampled at */
+	kSincPhaseBits = 8,
+	kSincPhases = 1 << kSincPhaseBits,
+	/** Unity gain of the Q14 filter coefficients */
+	kSincCoeffOne = 1 << 14,
+	/** Frames held in the per-channel input windows, on top of the filter length */
+	kSincWindowFrames = kSincTaps + 256
+};
+
+/**
+ * State of the optional windowed-sinc resampling path, allocated only
+ * when the user selected it, so converters on the default linear
+ * quality don't carry the 8K filter bank around.
+ */
+struct SincState {
+	/** Polyphase filter bank: one row of Q14 taps per fractional phase */
+	int16 coeffs[kSincPhases][kSincTaps];
+	/** Rates the filter bank was designed for */
+	st_rate_t designInRate, designOutRate;
+
+	/**
+	 * Deinterleaved input windows; the inner product kernels want each
+	 * channel contiguous.
+	 */
+	st_sample_t winL[kSincWindowFrames];
+	st_sample_t winR[kSincWindowFrames];
+	/** Frames currently in the windows, including end-of-stream padding */
+	int frames;
+	/** Frames in the windows that are real input rather than padding */
+	int realFrames;
+	/** Fixed-point read position, FRAC_BITS_LOW fractional bits */
+	frac_t pos;
+
+	SincDotFunc dot;
+
+	SincState() : designInRate(0), designOutRate(0), frames(0), realFrames(0), pos(0), dot(getSincDotFunc()) {}
+};
+
 template<bool inStereo, bool outStereo, bool reverseStereo>
 class RateConverter_Impl : public RateConverter {
 private:
@@ -76,13 +120,20 @@ private:
 	/** Current sample(s) in the input stream (left/right channel) */
 	st_sample_t _inCurL, _inCurR;
 
+	/** Windowed-sinc resampler state, or nullptr on the default linear quality */
+	SincState *_sinc;
+
 	int copyConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
 	int simpleConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
 	int interpolateConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+	int sincConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+
+	void buildSincFilter();
+	bool refillSincWindow(AudioStream &input);
 
 public:
-	RateConverter_Impl(st_rate_t inputRate, st_rate_t outputRate);
-	virtual ~RateConverter_Impl() {}
+	RateConverter_Impl(st_rate_t inputRate, st_rate_t outputRate, bool sincQuality);
+	virtual ~RateConverter_Impl() { delete _sinc; }
 
 	int convert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r) override;
 
@@ -92,9 +143,64 @@ public:
 	st_rate_t getInputRate() const override { return _inRate; }
 	st_rate_t getOutputRate() const override { return _outRate; }
 
-	bool needsDraining() const override { return _bufferSize != 0; }
+	bool needsDraining() const override {
+		if (_sinc && _sinc->realFrames - (int)(_sinc->pos >> FRAC_BITS_LOW) > 0)
+			return true;
+		return _bufferSize != 0;
+	}
 };
 
+static void mixStereoGeneric(st_sample_t *out, const st_sample_t *in, uint frames,
+                             st_volume_t volL, st_volume_t volR) {
+	while (frames--) {
+		clampedAdd(out[0], (in[0] * (int)volL) / Audio::Mixer::kMaxMixerVolume);
+		clampedAdd(out[1], (in[1] * (int)volR) / Audio::Mixer::kMaxMixerVolume);
+		in += 2;
+		out += 2;
+	}
+}
+
+MixStereoFunc getMixStereoFunc() {
+	static MixStereoFunc mixFunc = nullptr;
+
+	// If no function has been selected yet, detect and select
+	if (!mixFunc) {
+		mixFunc = mixStereoGeneric;
+#ifndef OUTPUT_UNSIGNED_AUDIO
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) mixFunc = mixStereoNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) mixFunc = mixStereoSSE2;
+#endif
+#endif
+	}
+	return mixFunc;
+}
+
+static int32 sincDotGeneric(const st_sample_t *src, const int16 *coeffs) {
+	int32 acc = 0;
+	for (int i = 0; i < kSincTaps; i++)
+		acc += src[i] * (int32)coeffs[i];
+	return acc;
+}
+
+SincDotFunc getSincDotFunc() {
+	static SincDotFunc dotFunc = nullptr;
+
+	// If no function has been selected yet, detect and select
+	if (!dotFunc) {
+		dotFunc = sincDotGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) dotFunc = sincDotNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) dotFunc = sincDotSSE2;
+#endif
+	}
+	return dotFunc;
+}
+
 template<bool inStereo, bool outStereo, bool reverseStereo>
 int RateConverter_Impl<inStereo, outStereo, reverseStereo>::copyConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
 	st_sample_t *outStart, *outEnd;
@@ -102,6 +208,31 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::copyConvert(AudioStr
 	outStart = outBuffer;
 	outEnd = outBuffer + numSamples * (outStereo ? 2 : 1);
 
+	// Stereo-to-stereo pass-through is by far the most common case and
+	// needs no per-sample channel logic, so hand whole spans to the
+	// (possibly vectorized) batch kernel between buffer refills.
+	if (inStereo && outStereo && !reverseStereo) {
+		const MixStereoFunc mixFunc = getMixStereoFunc();
+
+		while (outBuffer < outEnd) {
+			if (_bufferSize == 0) {
+				_bufferPos = _buffer;
+				_bufferSize = input.readBuffer(_buffer, ARRAYSIZE(_buffer));
+
+				if (_bufferSize <= 0)
+					return (outBuffer - outStart) / 2;
+			}
+
+			const uint frames = MIN<uint>(_bufferSize / 2, (outEnd - outBuffer) / 2);
+			mixFunc(outBuffer, _bufferPos, frames, volL, volR);
+			_bufferPos += frames * 2;
+			_bufferSize -= frames * 2;
+			outBuffer += frames * 2;
+		}
+
+		return (outBuffer - outStart) / 2;
+	}
+
 	while (outBuffer < outEnd) {
 		// Check if we have to refill the buffer
 		if (_bufferSize == 0) {
@@ -269,8 +400,178 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::interpolateConvert(A
 	return (outBuffer - outStart) / (outStereo ? 2 : 1);
 }
 
+/**
+ * (Re)designs the polyphase filter bank for the current rate pair.
+ *
+ * Each phase row is a Blackman-windowed sinc sampled at that fractional
+ * offset, with the cutoff a little below the narrower of the two Nyquist
+ * frequencies so that downsampling is band-limited too. The rows are
+ * normalized to exactly unity DC gain in Q14; the float math only runs
+ * here, at design time, never per sample.
+ */
+template<bool inStereo, bool outStereo, bool reverseStereo>
+void RateConverter_Impl<inStereo, outStereo, reverseStereo>::buildSincFilter() {
+	SincState &s = *_sinc;
+	s.designInRate = _inRate;
+	s.designOutRate = _outRate;
+
+	double cutoff = 0.925;
+	if (_outRate < _inRate)
+		cutoff = cutoff * _outRate / _inRate;
+
+	for (int phase = 0; phase < kSincPhases; phase++) {
+		const double offset = (double)phase / kSincPhases;
+		double taps[kSincTaps];
+		double sum = 0.0;
+
+		for (int i = 0; i < kSincTaps; i++) {
+			// Distance of this tap from the output point
+			const double t = (i - (kSincTaps / 2 - 1)) - offset;
+			const double sinc = (t == 0.0) ? cutoff : sin(M_PI * cutoff * t) / (M_PI * t);
+			// Blackman window over the filter span
+			const double u = (t + kSincTaps / 2) / kSincTaps;
+			const double window = 0.42 - 0.5 * cos(2 * M_PI * u) + 0.08 * cos(4 * M_PI * u);
+			taps[i] = sinc * window;
+			sum += taps[i];
+		}
+
+		int total = 0;
+		for (int i = 0; i < kSincTaps; i++) {
+			s.coeffs[phase][i] = (int16)floor(taps[i] * kSincCoeffOne / sum + 0.5);
+			total += s.coeffs[phase][i];
+		}
+		// Put the rounding residue on the biggest tap, so every row sums
+		// to exactly 1.0 and silence stays silence
+		s.coeffs[phase][kSincTaps / 2 - 1] += kSincCoeffOne - total;
+	}
+}
+
+/**
+ * Slides the input windows down to the current read position and tops
+ * them up from the stream, through the shared intermediate buffer.
+ *
+ * Returns false when no more output can be produced right now: either
+ * the stream has no data at the moment, or it has ended and the windows
+ * are drained.
+ */
+template<bool inStereo, bool outStereo, bool reverseStereo>
+bool RateConverter_Impl<inStereo, outStereo, reverseStereo>::refillSincWindow(AudioStream &input) {
+	SincState &s = *_sinc;
+
+	// Keep the unconsumed frames (always fewer than kSincTaps) at the front
+	const int idx = s.pos >> FRAC_BITS_LOW;
+	const int keep = s.frames - idx;
+	if (keep > 0) {
+		memmove(s.winL, s.winL + idx, keep * sizeof(st_sample_t));
+		if (inStereo)
+			memmove(s.winR, s.winR + idx, keep * sizeof(st_sample_t));
+	}
+	s.pos -= idx << FRAC_BITS_LOW;
+	s.frames = MAX(keep, 0);
+	s.realFrames = MAX(s.realFrames - idx, 0);
+
+	// Check if we have to refill the buffer
+	if (_bufferSize == 0) {
+		_bufferPos = _buffer;
+		_bufferSize = input.readBuffer(_buffer, ARRAYSIZE(_buffer));
+
+		if (_bufferSize <= 0) {
+			_bufferSize = 0;
+			// When the stream has really ended (and is not just out of
+			// data for the moment, like a queuing stream can be), pad the
+			// windows with silence once, so the last real samples still
+			// pass through the filter.
+			if (!input.endOfStream() || s.realFrames <= 0)
+				return false;
+			memset(s.winL + s.frames, 0, kSincTaps * sizeof(st_sample_t));
+			if (inStereo)
+				memset(s.winR + s.frames, 0, kSincTaps * sizeof(st_sample_t));
+			s.frames += kSincTaps;
+			return true;
+		}
+	}
+
+	// Deinterleave into the per-channel windows
+	const int space = kSincWindowFrames - s.frames;
+	const int avail = _bufferSize / (inStereo ? 2 : 1);
+	const int n = MIN(space, avail);
+	if (inStereo) {
+		for (int i = 0; i < n; i++) {
+			s.winL[s.frames + i] = _bufferPos[2 * i];
+			s.winR[s.frames + i] = _bufferPos[2 * i + 1];
+		}
+	} else {
+		memcpy(s.winL + s.frames, _bufferPos, n * sizeof(st_sample_t));
+	}
+	_bufferPos += n * (inStereo ? 2 : 1);
+	_bufferSize -= n * (inStereo ? 2 : 1);
+	s.frames += n;
+	s.realFrames = s.frames;
+
+	return true;
+}
+
+template<bool inStereo, bool outStereo, bool reverseStereo>
+int RateConverter_Impl<inStereo, outStereo, reverseStereo>::sincConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
+	SincState &s = *_sinc;
+
+	// Redesign the filter bank if the rates changed under us; engines use
+	// setInputRate() for pitch bending
+	if (s.designInRate != _inRate || s.designOutRate != _outRate)
+		buildSincFilter();
+
+	// How much to increment the read position by per output sample
+	const frac_t posInc = (_inRate << FRAC_BITS_LOW) / _outRate;
+
+	st_sample_t *outStart, *outEnd;
+	outStart = outBuffer;
+	outEnd = outBuffer + numSamples * (outStereo ? 2 : 1);
+
+	while (outBuffer < outEnd) {
+		// Slide and refill the windows whenever the filter would read
+		// past their end
+		int idx = s.pos >> FRAC_BITS_LOW;
+		while (idx + kSincTaps > s.frames) {
+			if (!refillSincWindow(input))
+				return (outBuffer - outStart) / (outStereo ? 2 : 1);
+			idx = s.pos >> FRAC_BITS_LOW;
+		}
+
+		const int16 *taps = s.coeffs[(s.pos >> (FRAC_BITS_LOW - kSincPhaseBits)) & (kSincPhases - 1)];
+
+		st_sample_t inL, inR;
+		inL = (st_sample_t)CLIP<int32>(s.dot(s.winL + idx, taps) >> 14, ST_SAMPLE_MIN, ST_SAMPLE_MAX);
+		inR = (inStereo ?
+					(st_sample_t)CLIP<int32>(s.dot(s.winR + idx, taps) >> 14, ST_SAMPLE_MIN, ST_SAMPLE_MAX) :
+					inL);
+
+		st_sample_t outL, outR;
+		outL = (inL * (int)volL) / Audio::Mixer::kMaxMixerVolume;
+		outR = (inR * (int)volR) / Audio::Mixer::kMaxMixerVolume;
+
+		if (outStereo) {
+			// Output left channel
+			clampedAdd(outBuffer[reverseStereo    ], outL);
+
+			// Output right channel
+			clampedAdd(outBuffer[reverseStereo ^ 1], outR);
+
+			outBuffer += 2;
+		} else {
+			// Output mono channel
+			clampedAdd(outBuffer[0], (outL + outR) / 2);
+
+			outBuffer += 1;
+		}
+
+		// Increment the read position
+		s.pos += posInc;
+	}
+	return (outBuffer - outStart) / (outStereo ? 2 : 1);
+}
+
 template<bool inStereo, bool outStereo, bool reverseStereo>
-RateConverter_Impl<inStereo, outStereo, reverseStereo>::RateConverter_Impl(st_rate_t inputRate, st_rate_t outputRate) :
+RateConverter_Impl<inStereo, outStereo, reverseStereo>::RateConverter_Impl(st_rate_t inputRate, st_rate_t outputRate, bool sincQuality) :
 	_inRate(inputRate),
 	_outRate(outputRate),
 	_outPos(1),
@@ -280,7 +581,11 @@ RateConverter_Impl<inStereo, outStereo, reverseStereo>::RateConverter_Impl(st_ra
 	_inCurL(0),
 	_inCurR(0),
 	_bufferSize(0),
-	_bufferPos(nullptr) {}
+	_bufferPos(nullptr),
+	_sinc(nullptr) {
+	if (sincQuality)
+		_sinc = new SincState();
+}
 
 template<bool inStereo, bool outStereo, bool reverseStereo>
 int RateConverter_Impl<inStereo, outStereo, reverseStereo>::convert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
@@ -288,6 +593,8 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::convert(AudioStream
 
 	if (_inRate == _outRate) {
 		return copyConvert(input, outBuffer, numSamples, volL, volR);
+	} else if (_sinc) {
+		return sincConvert(input, outBuffer, numSamples, volL, volR);
 	} else {
 		if ((_inRate % _outRate) == 0 && (_inRate < 65536)) {
 			return simpleConvert(input, outBuffer, numSamples, volL, volR);
@@ -298,19 +605,23 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::convert(AudioStream
 }
 
 RateConverter *makeRateConverter(st_rate_t inRate, st_rate_t outRate, bool inStereo, bool outStereo, bool reverseStereo) {
+	// The resampler choice applies to sounds started after a change; the
+	// converter is made once per channel.
+	const bool sinc = ConfMan.get("audio_resampler").equalsIgnoreCase("sinc");
+
 	if (inStereo) {
 		if (outStereo) {
 			if (reverseStereo)
-				return new RateConverter_Impl<true, true, true>(inRate, outRate);
+				return new RateConverter_Impl<true, true, true>(inRate, outRate, sinc);
 			else
-				return new RateConverter_Impl<true, true, false>(inRate, outRate);
+				return new RateConverter_Impl<true, true, false>(inRate, outRate, sinc);
 		} else
-			return new RateConverter_Impl<true, false, false>(inRate, outRate);
+			return new RateConverter_Impl<true, false, false>(inRate, outRate, sinc);
 	} else {
 		if (outStereo) {
-			return new RateConverter_Impl<false, true, false>(inRate, outRate);
+			return new RateConverter_Impl<false, true, false>(inRate, outRate, sinc);
 		} else
-			return new RateConverter_Impl<false, false, false>(inRate, outRate);
+			return new RateConverter_Impl<false, false, false>(inRate, outRate, sinc);
 	}
 }
 
@@ -19,6 +19,9 @@
  *
  */
 
+// pthread.h pulls in time.h on some libcs
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
 #if defined(HAVE_CONFIG_H)
 #include "config.h"
 #endif
@@ -40,6 +43,8 @@
 #include "common/scummsys.h"
 #include "common/config-manager.h"
 #include "common/error.h"
+#include "common/fs.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 #include "common/system.h"
 #include "common/archive.h"
@@ -65,6 +70,14 @@
 #define FS_API_VERSION 0
 #endif
 
+// Real FluidSynth 2+ synchronizes its synth API internally, so the
+// SoundFont can be parsed on a worker thread while the synth already
+// renders (silence) for the mixer.
+#if defined(POSIX) && !defined(USE_FLUIDLITE) && FS_API_VERSION >= 0x0200
+#define FS_ASYNC_SFLOAD
+#include <pthread.h>
+#endif
+
 #if FS_API_VERSION >= 0x0200
 static void logHandler(int level, const char *message, void *data)
 #else
@@ -93,6 +106,54 @@ static void logHandler(int level, char *message, void *data)
 	}
 }
 
+/**
+ * Session-persistent copy of the configured SoundFont's contents. The
+ * file is tens of megabytes and every game launch opens a fresh driver
+ * instance, so keeping the bytes around means only the first launch in
+ * a ScummVM session reads it from disk.
+ */
+struct SoundFontCache {
+	Common::Path path;
+	byte *data;
+	int64 size;
+};
+
+static SoundFontCache *s_soundFontCache = nullptr;
+
+/**
+ * Returns a read stream over the cached contents of the given SoundFont,
+ * (re)filling the cache if it holds a different file. The returned stream
+ * is a view which does not own the data, so the memory loader callbacks
+ * may delete it as usual. Returns nullptr if the file cannot be read.
+ */
+static Common::SeekableReadStream *getCachedSoundFontStream(const Common::Path &path) {
+	if (!s_soundFontCache || s_soundFontCache->path != path) {
+		Common::FSNode node(path);
+		Common::SeekableReadStream *file = node.createReadStream();
+		if (!file)
+			return nullptr;
+
+		const int64 size = file->size();
+		byte *data = (byte *)malloc(size);
+		if (!data || file->read(data, size) != (uint32)size) {
+			free(data);
+			delete file;
+			return nullptr;
+		}
+		delete file;
+
+		if (!s_soundFontCache)
+			s_soundFontCache = new SoundFontCache();
+		else
+			free(s_soundFontCache->data);
+		s_soundFontCache->path = path;
+		s_soundFontCache->data = data;
+		s_soundFontCache->size = size;
+	}
+
+	return new Common::MemoryReadStream(s_soundFontCache->data, s_soundFontCache->size);
+}
+
 class MidiDriver_FluidSynth : public MidiDriver_Emulated {
 private:
 	MidiChannel_MPU401 _midiChannels[16];
@@ -102,6 +163,15 @@ private:
 	int _outputRate;
 	Common::SeekableReadStream *_engineSoundFontData;
 
+#ifdef FS_ASYNC_SFLOAD
+	Common::String _soundFontName;
+	pthread_t _loaderThread;
+	bool _loaderThreadRunning;
+
+	static void *loaderThreadEntry(void *arg);
+	void loadSoundFont();
+#endif
+
 protected:
 	// Because GCC complains about casting from const to non-const...
 	void setInt(const char *name, int val);
@@ -135,6 +205,10 @@ public:
 MidiDriver_FluidSynth::MidiDriver_FluidSynth(Audio::Mixer *mixer)
 	: MidiDriver_Emulated(mixer), _engineSoundFontData(nullptr) {
 
+#ifdef FS_ASYNC_SFLOAD
+	_loaderThreadRunning = false;
+#endif
+
 	for (int i = 0; i < ARRAYSIZE(_midiChannels); i++) {
 		_midiChannels[i].init(this, i);
 	}
@@ -364,6 +438,15 @@ int MidiDriver_FluidSynth::open() {
 	}
 #endif
 
+#if defined(FS_HAS_STREAM_SUPPORT)
+	// Read the configured SoundFont through the session cache, so that
+	// only the first driver open in a ScummVM session hits the disk.
+	if (!isUsingInMemorySoundFontData && !ConfMan.get("soundfont").empty()) {
+		_engineSoundFontData = getCachedSoundFontStream(getSoundFontPath());
+		isUsingInMemorySoundFontData = _engineSoundFontData != nullptr;
+	}
+#endif
+
 	_settings = new_fluid_settings();
 
 	// The default gain setting is ridiculously low - at least for me. This
@@ -492,6 +575,26 @@ int MidiDriver_FluidSynth::open() {
 		soundfont = getSoundFontPath().toString(Common::Path::kNativeSeparator);
 	}
 
+#ifdef FS_ASYNC_SFLOAD
+	if (!(ConfMan.hasKey("fluidsynth_async_sfload") && !ConfMan.getBool("fluidsynth_async_sfload"))) {
+		// Parsing a large SoundFont takes seconds, so hand it to a
+		// worker thread and let the synth render silence until it is
+		// in. Bank and program numbers of events sent in the meantime
+		// are retained by the synth and resolve once the font arrives,
+		// since sfload re-evaluates the presets of every channel.
+		_soundFont = -1;
+		_soundFontName = soundfont;
+		_loaderThreadRunning = (pthread_create(&_loaderThread, nullptr, loaderThreadEntry, this) == 0);
+		if (_loaderThreadRunning) {
+			MidiDriver_Emulated::open();
+
+			_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
+
+			return 0;
+		}
+	}
+#endif
+
 	_soundFont = fluid_synth_sfload(_synth, soundfont.c_str(), 1);
 
 	if (_soundFont == -1) {
@@ -507,11 +610,36 @@ int MidiDriver_FluidSynth::open() {
 	return 0;
 }
 
+#ifdef FS_ASYNC_SFLOAD
+
+void *MidiDriver_FluidSynth::loaderThreadEntry(void *arg) {
+	((MidiDriver_FluidSynth *)arg)->loadSoundFont();
+	return nullptr;
+}
+
+void MidiDriver_FluidSynth::loadSoundFont() {
+	// FluidSynth 2+ synchronizes this against the render calls the
+	// mixer thread is already making.
+	_soundFont = fluid_synth_sfload(_synth, _soundFontName.c_str(), 1);
+
+	if (_soundFont == -1)
+		warning("FluidSynth: Failed loading custom SoundFont '%s'. Music is off.", _soundFontName.c_str());
+}
+
+#endif
+
 void MidiDriver_FluidSynth::close() {
 	if (!_isOpen)
 		return;
 	_isOpen = false;
 
+#ifdef FS_ASYNC_SFLOAD
+	if (_loaderThreadRunning) {
+		pthread_join(_loaderThread, nullptr);
+		_loaderThreadRunning = false;
+	}
+#endif
+
 	_mixer->stopHandle(_mixerSoundHandle);
 
 	if (_soundFont != -1)
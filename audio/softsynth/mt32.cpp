@@ -19,6 +19,9 @@
  *
  */
 
+// For the render thread wait timeout
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
 #include "common/scummsys.h"
 #include "common/system.h"
 
@@ -53,6 +56,12 @@
 
 #include "audio/softsynth/mt32/c_interface/cpp_interface.h"
 
+#if defined(POSIX)
+#define MT32EMU_USE_RENDER_THREAD
+#include <pthread.h>
+#include <atomic>
+#endif
+
 namespace MT32Emu {
 
 class ScummVMReportHandler : public MT32Emu::IReportHandler {
@@ -118,6 +127,41 @@ private:
 
 	int _outputRate;
 
+#if defined(MT32EMU_USE_RENDER_THREAD)
+	enum {
+		// Fixed point shift of the tick interleave, matching
+		// MidiDriver_Emulated::readBuffer()
+		kRenderFixpShift = 16,
+		// Stereo sample ring the render thread runs ahead into; must be
+		// a power of two. 8K frames is a quarter second at 32kHz.
+		kRingSamples = 8192 * 2,
+		// Frames rendered per synth lock, so send() is never blocked
+		// for longer than this takes to synthesize
+		kRenderChunkFrames = 256
+	};
+
+	int16 *_ringBuffer;
+	// Positions only ever grow and are reduced modulo kRingSamples on
+	// access, so the producer and consumer never write the same field
+	std::atomic<uint32> _ringReadPos, _ringWritePos;
+
+	pthread_t _renderThread;
+	pthread_mutex_t _renderMutex;
+	pthread_cond_t _renderCond;
+	bool _renderThreadRunning;
+	volatile bool _renderQuit;
+
+	Common::TimerManager::TimerProc _renderTimerProc;
+	void *_renderTimerParam;
+	int _renderNextTick;
+	int _renderSamplesPerTick;
+
+	void startRenderThread();
+	void stopRenderThread();
+	void renderLoop();
+	static void *renderEntry(void *driver);
+#endif
+
 protected:
 	void generateSamples(int16 *buf, int len) override;
 
@@ -135,9 +179,12 @@ public:
 	MidiChannel *allocateChannel() override;
 	MidiChannel *getPercussionChannel() override;
 
+	void setTimerCallback(void *timerParam, Common::TimerManager::TimerProc timerProc) override;
+
 	// AudioStream API
 	bool isStereo() const override { return true; }
 	int getRate() const override { return _outputRate; }
+	int readBuffer(int16 *data, const int numSamples) override;
 };
 
 ////////////////////////////////////////
@@ -155,6 +202,18 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_outputRate = 0;
 	_controlData = nullptr;
 	_pcmData = nullptr;
+
+#if defined(MT32EMU_USE_RENDER_THREAD)
+	_ringBuffer = nullptr;
+	_ringReadPos.store(0);
+	_ringWritePos.store(0);
+	_renderThreadRunning = false;
+	_renderQuit = false;
+	_renderTimerProc = nullptr;
+	_renderTimerParam = nullptr;
+	_renderNextTick = 0;
+	_renderSamplesPerTick = 0;
+#endif
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -220,6 +279,10 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+#if defined(MT32EMU_USE_RENDER_THREAD)
+	startRenderThread();
+#endif
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -273,6 +336,11 @@ void MidiDriver_MT32::close() {
 	// Detach the mixer callback handler
 	_mixer->stopHandle(_mixerSoundHandle);
 
+#if defined(MT32EMU_USE_RENDER_THREAD)
+	// With the mixer detached, the render thread can be taken down
+	stopRenderThread();
+#endif
+
 	Common::StackLock lock(_mutex);
 	_service.closeSynth();
 	_service.freeContext();
@@ -287,6 +355,178 @@ void MidiDriver_MT32::generateSamples(int16 *data, int len) {
 	_service.renderBit16s(data, len);
 }
 
+void MidiDriver_MT32::setTimerCallback(void *timerParam, Common::TimerManager::TimerProc timerProc) {
+#if defined(MT32EMU_USE_RENDER_THREAD)
+	if (_renderThreadRunning) {
+		// The render thread drives the MIDI timer, so hand the callback
+		// over to it
+		pthread_mutex_lock(&_renderMutex);
+		_renderTimerProc = timerProc;
+		_renderTimerParam = timerParam;
+		pthread_mutex_unlock(&_renderMutex);
+		return;
+	}
+#endif
+	MidiDriver_Emulated::setTimerCallback(timerParam, timerProc);
+}
+
+int MidiDriver_MT32::readBuffer(int16 *data, const int numSamples) {
+#if defined(MT32EMU_USE_RENDER_THREAD)
+	if (_renderThreadRunning) {
+		// Lock-free consumer side of the ring: copy whatever the render
+		// thread has produced and zero-fill on underrun rather than
+		// rendering (and blowing the callback budget) ourselves.
+		uint32 readPos = _ringReadPos.load(std::memory_order_relaxed);
+		uint32 avail = _ringWritePos.load(std::memory_order_acquire) - readPos;
+		uint32 count = MIN<uint32>(avail, (uint32)numSamples);
+
+		uint32 index = readPos % kRingSamples;
+		uint32 tail = kRingSamples - index;
+		if (tail >= count) {
+			memcpy(data, _ringBuffer + index, count * sizeof(int16));
+		} else {
+			memcpy(data, _ringBuffer + index, tail * sizeof(int16));
+			memcpy(data + tail, _ringBuffer, (count - tail) * sizeof(int16));
+		}
+		_ringReadPos.store(readPos + count, std::memory_order_release);
+
+		if (count < (uint32)numSamples)
+			memset(data + count, 0, ((uint32)numSamples - count) * sizeof(int16));
+
+		// Wake the render thread; signaling without the mutex held is
+		// fine since it only ever waits with a timeout
+		pthread_cond_signal(&_renderCond);
+		return numSamples;
+	}
+#endif
+	return MidiDriver_Emulated::readBuffer(data, numSamples);
+}
+
+#if defined(MT32EMU_USE_RENDER_THREAD)
+
+void MidiDriver_MT32::startRenderThread() {
+	// Give the user a way out if the threaded renderer misbehaves
+	if (ConfMan.hasKey("mt32_threaded_render") && !ConfMan.getBool("mt32_threaded_render"))
+		return;
+
+	_ringBuffer = new int16[kRingSamples];
+	_ringReadPos.store(0);
+	_ringWritePos.store(0);
+	_renderQuit = false;
+	_renderTimerProc = nullptr;
+	_renderTimerParam = nullptr;
+
+	// Same fixed point tick math as MidiDriver_Emulated::open()
+	int d = getRate() / _baseFreq;
+	int r = getRate() % _baseFreq;
+	_renderSamplesPerTick = (d << kRenderFixpShift) + (r << kRenderFixpShift) / _baseFreq;
+	_renderNextTick = 0;
+
+	pthread_mutex_init(&_renderMutex, nullptr);
+	pthread_cond_init(&_renderCond, nullptr);
+
+	if (pthread_create(&_renderThread, nullptr, renderEntry, this) != 0) {
+		warning("MT32: Could not create the render thread, rendering in the mixer callback");
+		pthread_mutex_destroy(&_renderMutex);
+		pthread_cond_destroy(&_renderCond);
+		delete[] _ringBuffer;
+		_ringBuffer = nullptr;
+		return;
+	}
+
+	_renderThreadRunning = true;
+}
+
+void MidiDriver_MT32::stopRenderThread() {
+	if (!_renderThreadRunning)
+		return;
+
+	pthread_mutex_lock(&_renderMutex);
+	_renderQuit = true;
+	pthread_cond_signal(&_renderCond);
+	pthread_mutex_unlock(&_renderMutex);
+	pthread_join(_renderThread, nullptr);
+
+	pthread_mutex_destroy(&_renderMutex);
+	pthread_cond_destroy(&_renderCond);
+	delete[] _ringBuffer;
+	_ringBuffer = nullptr;
+	_renderThreadRunning = false;
+}
+
+void MidiDriver_MT32::renderLoop() {
+	int16 chunk[kRenderChunkFrames * 2];
+
+	pthread_mutex_lock(&_renderMutex);
+	while (!_renderQuit) {
+		uint32 used = _ringWritePos.load(std::memory_order_relaxed) - _ringReadPos.load(std::memory_order_acquire);
+		if (kRingSamples - used < (uint32)kRenderChunkFrames * 2) {
+			// Far enough ahead; wait for the mixer to drain the ring
+			struct timespec ts;
+			clock_gettime(CLOCK_REALTIME, &ts);
+			ts.tv_nsec += 10 * 1000000;
+			if (ts.tv_nsec >= 1000000000) {
+				ts.tv_nsec -= 1000000000;
+				ts.tv_sec++;
+			}
+			pthread_cond_timedwait(&_renderCond, &_renderMutex, &ts);
+			continue;
+		}
+
+		Common::TimerManager::TimerProc timerProc = _renderTimerProc;
+		void *timerParam = _renderTimerParam;
+		pthread_mutex_unlock(&_renderMutex);
+
+		// Render one chunk, interleaving the MIDI timer callback at the
+		// same fixed point tick positions MidiDriver_Emulated::readBuffer()
+		// uses. Events stay synchronous to sample generation this way,
+		// which playing MIDI messages immediately relies on; see the
+		// comment on MIDIDelayMode_IMMEDIATE in open().
+		int16 *out = chunk;
+		int len = kRenderChunkFrames;
+		do {
+			int step = len;
+			if (step > (_renderNextTick >> kRenderFixpShift))
+				step = _renderNextTick >> kRenderFixpShift;
+
+			generateSamples(out, step);
+
+			_renderNextTick -= step << kRenderFixpShift;
+			if (!(_renderNextTick >> kRenderFixpShift)) {
+				if (timerProc)
+					(*timerProc)(timerParam);
+
+				_renderNextTick += _renderSamplesPerTick;
+			}
+
+			out += step * 2;
+			len -= step;
+		} while (len);
+
+		// Publish the chunk to the ring
+		uint32 writePos = _ringWritePos.load(std::memory_order_relaxed);
+		uint32 index = writePos % kRingSamples;
+		uint32 tail = kRingSamples - index;
+		if (tail >= (uint32)kRenderChunkFrames * 2) {
+			memcpy(_ringBuffer + index, chunk, kRenderChunkFrames * 2 * sizeof(int16));
+		} else {
+			memcpy(_ringBuffer + index, chunk, tail * sizeof(int16));
+			memcpy(_ringBuffer, chunk + tail, (kRenderChunkFrames * 2 - tail) * sizeof(int16));
+		}
+		_ringWritePos.store(writePos + kRenderChunkFrames * 2, std::memory_order_release);
+
+		pthread_mutex_lock(&_renderMutex);
+	}
+	pthread_mutex_unlock(&_renderMutex);
+}
+
+void *MidiDriver_MT32::renderEntry(void *driver) {
+	((MidiDriver_MT32 *)driver)->renderLoop();
+	return nullptr;
+}
+
+#endif // MT32EMU_USE_RENDER_THREAD
+
 uint32 MidiDriver_MT32::property(int prop, uint32 param) {
 	switch (prop) {
 	case PROP_CHANNEL_MASK:
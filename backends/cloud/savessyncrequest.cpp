@@ -35,8 +35,28 @@
 
 namespace Cloud {
 
+namespace {
+
+/**
+ * A member-method callback which also carries the index of the transfer
+ * slot it was created for, so parallel transfers can report back to the
+ * right slot.
+ */
+template<class T, typename S> class SlotCallback : public Common::BaseCallback<S> {
+	typedef void (T::*SlotMethod)(uint32, S);
+	T *_object;
+	SlotMethod _method;
+	uint32 _slot;
+
+public:
+	SlotCallback(T *object, SlotMethod method, uint32 slot) : _object(object), _method(method), _slot(slot) {}
+	void operator()(S data) override { (_object->*_method)(_slot, data); }
+};
+
+} // End of anonymous namespace
+
 SavesSyncRequest::SavesSyncRequest(Storage *storage, Storage::BoolCallback callback, Networking::ErrorCallback ecb):
-	Request(nullptr, ecb), _storage(storage), _boolCallback(callback),
+	Request(nullptr, ecb), _storage(storage), _boolCallback(callback), _downloading(true),
 	_workingRequest(nullptr), _ignoreCallback(false), _bytesToDownload(0), _bytesDownloaded(0) {
 	start();
 }
@@ -45,6 +65,9 @@ SavesSyncRequest::~SavesSyncRequest() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
+	for (uint32 i = 0; i < _transferSlots.size(); ++i)
+		if (_transferSlots[i].request)
+			_transferSlots[i].request->finish();
 	delete _boolCallback;
 }
 
@@ -53,14 +76,25 @@ void SavesSyncRequest::start() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
-	_currentDownloadingFile = StorageFile();
-	_currentUploadingFile = "";
+	for (uint32 i = 0; i < _transferSlots.size(); ++i)
+		if (_transferSlots[i].request)
+			_transferSlots[i].request->finish();
+	_transferSlots.clear();
+	_downloading = true;
 	_filesToDownload.clear();
 	_filesToUpload.clear();
 	_localFilesTimestamps.clear();
 	_totalFilesToHandle = 0;
 	_ignoreCallback = false;
 
+	//how many files to transfer at once
+	uint32 parallelTransfers = kDefaultParallelTransfers;
+	if (ConfMan.hasKey("cloud_sync_parallel_transfers"))
+		parallelTransfers = ConfMan.getInt("cloud_sync_parallel_transfers");
+	if (parallelTransfers < 1)
+		parallelTransfers = 1;
+	_transferSlots.resize(parallelTransfers);
+
 	//load timestamps
 	_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
 
@@ -162,12 +196,8 @@ void SavesSyncRequest::directoryListedCallback(const Storage::ListDirectoryRespo
 	}
 	_totalFilesToHandle = _filesToDownload.size() + _filesToUpload.size();
 
-	// Start downloading files
-	if (!_filesToDownload.empty()) {
-		downloadNextFile();
-	} else {
-		uploadNextFile();
-	}
+	// Start the parallel transfers, downloads first
+	startTransfers();
 }
 
 void SavesSyncRequest::directoryListedErrorCallback(const Networking::ErrorResponse &error) {
@@ -271,51 +301,95 @@ void SavesSyncRequest::directoryCreatedErrorCallback(const Networking::ErrorResp
 	finishError(error);
 }
 
-void SavesSyncRequest::downloadNextFile() {
-	if (_filesToDownload.empty()) {
-		_currentDownloadingFile = StorageFile("", 0, 0, false); //so getFilesToDownload() would return an empty array
-		uploadNextFile();
-		return;
+uint32 SavesSyncRequest::activeTransfers() const {
+	uint32 count = 0;
+	for (uint32 i = 0; i < _transferSlots.size(); ++i)
+		if (_transferSlots[i].request)
+			++count;
+	return count;
+}
+
+uint32 SavesSyncRequest::activeDownloads() const {
+	uint32 count = 0;
+	for (uint32 i = 0; i < _transferSlots.size(); ++i)
+		if (_transferSlots[i].downloadingFile.name() != "")
+			++count;
+	return count;
+}
+
+void SavesSyncRequest::startTransfers() {
+	if (_downloading) {
+		// Fill the idle slots with queued downloads
+		for (uint32 i = 0; i < _transferSlots.size() && !_filesToDownload.empty(); ++i) {
+			if (!_transferSlots[i].request) {
+				startDownload(i);
+				if (_state == Networking::FINISHED)
+					return; //startDownload() failed and finishError() was called
+			}
+		}
+
+		// The upload phase starts only once the last download finished
+		if (activeTransfers() > 0 || !_filesToDownload.empty())
+			return;
+		_downloading = false;
+	}
+
+	// Fill the idle slots with queued uploads
+	for (uint32 i = 0; i < _transferSlots.size() && !_filesToUpload.empty(); ++i) {
+		if (!_transferSlots[i].request) {
+			startUpload(i);
+			if (_state == Networking::FINISHED)
+				return; //startUpload() failed and finishError() was called
+		}
 	}
 
-	_currentDownloadingFile = _filesToDownload.back();
+	if (activeTransfers() == 0 && _filesToUpload.empty())
+		finishSync(true);
+}
+
+void SavesSyncRequest::startDownload(uint32 slot) {
+	TransferSlot &transfer = _transferSlots[slot];
+	transfer.downloadingFile = _filesToDownload.back();
 	_filesToDownload.pop_back();
 
-	debug(9, "\nSavesSyncRequest: downloading %s (%d %%)", _currentDownloadingFile.name().c_str(), (int)(getProgress() * 100));
-	_workingRequest = _storage->downloadById(
-		_currentDownloadingFile.id(),
-		DefaultSaveFileManager::concatWithSavesPath(_currentDownloadingFile.name()),
-		new Common::Callback<SavesSyncRequest, const Storage::BoolResponse &>(this, &SavesSyncRequest::fileDownloadedCallback),
-		new Common::Callback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileDownloadedErrorCallback)
+	debug(9, "\nSavesSyncRequest: downloading %s (%d %%)", transfer.downloadingFile.name().c_str(), (int)(getProgress() * 100));
+	transfer.request = _storage->downloadById(
+		transfer.downloadingFile.id(),
+		DefaultSaveFileManager::concatWithSavesPath(transfer.downloadingFile.name()),
+		new SlotCallback<SavesSyncRequest, const Storage::BoolResponse &>(this, &SavesSyncRequest::fileDownloadedCallback, slot),
+		new SlotCallback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileDownloadedErrorCallback, slot)
 	);
-	if (!_workingRequest)
-		finishError(Networking::ErrorResponse(this, "SavesSyncRequest::downloadNextFile: Storage couldn't create Request to download a file"));
+	if (!transfer.request)
+		finishError(Networking::ErrorResponse(this, "SavesSyncRequest::startDownload: Storage couldn't create Request to download a file"));
 }
 
-void SavesSyncRequest::fileDownloadedCallback(const Storage::BoolResponse &response) {
-	_workingRequest = nullptr;
+void SavesSyncRequest::fileDownloadedCallback(uint32 slot, const Storage::BoolResponse &response) {
+	TransferSlot &transfer = _transferSlots[slot];
+	transfer.request = nullptr;
 	if (_ignoreCallback)
 		return;
 
 	//stop syncing if download failed
 	if (!response.value) {
 		//delete the incomplete file
-		g_system->getSavefileManager()->removeSavefile(_currentDownloadingFile.name());
+		g_system->getSavefileManager()->removeSavefile(transfer.downloadingFile.name());
+		transfer.downloadingFile = StorageFile();
 		finishError(Networking::ErrorResponse(this, false, true, "SavesSyncRequest::fileDownloadedCallback: failed to download a file", -1));
 		return;
 	}
 
 	//update local timestamp for downloaded file
-	_localFilesTimestamps[_currentDownloadingFile.name()] = _currentDownloadingFile.timestamp();
+	_localFilesTimestamps[transfer.downloadingFile.name()] = transfer.downloadingFile.timestamp();
 	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
-	_bytesDownloaded += _currentDownloadingFile.size();
+	_bytesDownloaded += transfer.downloadingFile.size();
+	transfer.downloadingFile = StorageFile();
 
 	//continue downloading files
-	downloadNextFile();
+	startTransfers();
 }
 
-void SavesSyncRequest::fileDownloadedErrorCallback(const Networking::ErrorResponse &error) {
-	_workingRequest = nullptr;
+void SavesSyncRequest::fileDownloadedErrorCallback(uint32 slot, const Networking::ErrorResponse &error) {
+	_transferSlots[slot].request = nullptr;
 	if (_ignoreCallback)
 		return;
 
@@ -323,49 +397,48 @@ void SavesSyncRequest::fileDownloadedErrorCallback(const Networking::ErrorRespon
 	finishError(error);
 }
 
-void SavesSyncRequest::uploadNextFile() {
-	if (_filesToUpload.empty()) {
-		finishSync(true);
-		return;
-	}
-
-	_currentUploadingFile = _filesToUpload.back();
+void SavesSyncRequest::startUpload(uint32 slot) {
+	TransferSlot &transfer = _transferSlots[slot];
+	transfer.uploadingName = _filesToUpload.back();
 	_filesToUpload.pop_back();
 
-	debug(9, "\nSavesSyncRequest: uploading %s (%d %%)", _currentUploadingFile.c_str(), (int)(getProgress() * 100));
+	debug(9, "\nSavesSyncRequest: uploading %s (%d %%)", transfer.uploadingName.c_str(), (int)(getProgress() * 100));
 	if (_storage->uploadStreamSupported()) {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			g_system->getSavefileManager()->openRawFile(_currentUploadingFile),
-			new Common::Callback<SavesSyncRequest, const Storage::UploadResponse &>(this, &SavesSyncRequest::fileUploadedCallback),
-			new Common::Callback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileUploadedErrorCallback)
+		transfer.request = _storage->upload(
+			_storage->savesDirectoryPath() + transfer.uploadingName,
+			g_system->getSavefileManager()->openRawFile(transfer.uploadingName),
+			new SlotCallback<SavesSyncRequest, const Storage::UploadResponse &>(this, &SavesSyncRequest::fileUploadedCallback, slot),
+			new SlotCallback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileUploadedErrorCallback, slot)
 		);
 	} else {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			DefaultSaveFileManager::concatWithSavesPath(_currentUploadingFile),
-			new Common::Callback<SavesSyncRequest, const Storage::UploadResponse &>(this, &SavesSyncRequest::fileUploadedCallback),
-			new Common::Callback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileUploadedErrorCallback)
+		transfer.request = _storage->upload(
+			_storage->savesDirectoryPath() + transfer.uploadingName,
+			DefaultSaveFileManager::concatWithSavesPath(transfer.uploadingName),
+			new SlotCallback<SavesSyncRequest, const Storage::UploadResponse &>(this, &SavesSyncRequest::fileUploadedCallback, slot),
+			new SlotCallback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileUploadedErrorCallback, slot)
 		);
 	}
-	if (!_workingRequest) finishError(Networking::ErrorResponse(this, "SavesSyncRequest::uploadNextFile: Storage couldn't create Request to upload a file"));
+	if (!transfer.request)
+		finishError(Networking::ErrorResponse(this, "SavesSyncRequest::startUpload: Storage couldn't create Request to upload a file"));
 }
 
-void SavesSyncRequest::fileUploadedCallback(const Storage::UploadResponse &response) {
-	_workingRequest = nullptr;
+void SavesSyncRequest::fileUploadedCallback(uint32 slot, const Storage::UploadResponse &response) {
+	TransferSlot &transfer = _transferSlots[slot];
+	transfer.request = nullptr;
 	if (_ignoreCallback)
 		return;
 
 	//update local timestamp for the uploaded file
-	_localFilesTimestamps[_currentUploadingFile] = response.value.timestamp();
+	_localFilesTimestamps[transfer.uploadingName] = response.value.timestamp();
 	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
+	transfer.uploadingName = "";
 
 	//continue uploading files
-	uploadNextFile();
+	startTransfers();
 }
 
-void SavesSyncRequest::fileUploadedErrorCallback(const Networking::ErrorResponse &error) {
-	_workingRequest = nullptr;
+void SavesSyncRequest::fileUploadedErrorCallback(uint32 slot, const Networking::ErrorResponse &error) {
+	_transferSlots[slot].request = nullptr;
 	if (_ignoreCallback)
 		return;
 
@@ -393,7 +466,7 @@ double SavesSyncRequest::getDownloadingProgress() const {
 	}
 
 	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size();
-	uint32 filesLeftToDownload = _filesToDownload.size() + (_currentDownloadingFile.name() != "" ? 1 : 0);
+	uint32 filesLeftToDownload = _filesToDownload.size() + activeDownloads();
 	if (filesLeftToDownload > totalFilesToDownload)
 		filesLeftToDownload = totalFilesToDownload;
 	return (double)(totalFilesToDownload - filesLeftToDownload) / (double)(totalFilesToDownload);
@@ -404,7 +477,7 @@ void SavesSyncRequest::getDownloadingInfo(Storage::SyncDownloadingInfo &info) co
 	info.bytesToDownload = getBytesToDownload();
 
 	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size();
-	uint32 filesLeftToDownload = _filesToDownload.size() + (_currentDownloadingFile.name() != "" ? 1 : 0);
+	uint32 filesLeftToDownload = _filesToDownload.size() + activeDownloads();
 	if (filesLeftToDownload > totalFilesToDownload)
 		filesLeftToDownload = totalFilesToDownload;
 	info.filesDownloaded = totalFilesToDownload - filesLeftToDownload;
@@ -427,19 +500,25 @@ Common::Array<Common::String> SavesSyncRequest::getFilesToDownload() {
 	Common::Array<Common::String> result;
 	for (uint32 i = 0; i < _filesToDownload.size(); ++i)
 		result.push_back(_filesToDownload[i].name());
-	if (_currentDownloadingFile.name() != "")
-		result.push_back(_currentDownloadingFile.name());
+	for (uint32 i = 0; i < _transferSlots.size(); ++i)
+		if (_transferSlots[i].downloadingFile.name() != "")
+			result.push_back(_transferSlots[i].downloadingFile.name());
 	return result;
 }
 
 uint32 SavesSyncRequest::getDownloadedBytes() const {
-	double currentFileProgress = 0;
-	if (const DownloadRequest *downloadRequest = dynamic_cast<DownloadRequest *>(_workingRequest))
-		currentFileProgress = downloadRequest->getProgress();
-	else if (const Id::IdDownloadRequest *idDownloadRequest = dynamic_cast<Id::IdDownloadRequest *>(_workingRequest))
-		currentFileProgress = idDownloadRequest->getProgress();
+	double inFlightBytes = 0;
+	for (uint32 i = 0; i < _transferSlots.size(); ++i) {
+		const TransferSlot &transfer = _transferSlots[i];
+		if (!transfer.request)
+			continue;
+		if (const DownloadRequest *downloadRequest = dynamic_cast<DownloadRequest *>(transfer.request))
+			inFlightBytes += downloadRequest->getProgress() * transfer.downloadingFile.size();
+		else if (const Id::IdDownloadRequest *idDownloadRequest = dynamic_cast<Id::IdDownloadRequest *>(transfer.request))
+			inFlightBytes += idDownloadRequest->getProgress() * transfer.downloadingFile.size();
+	}
 
-	return _bytesDownloaded + currentFileProgress * _currentDownloadingFile.size();
+	return _bytesDownloaded + inFlightBytes;
 }
 
 uint32 SavesSyncRequest::getBytesToDownload() const {
@@ -448,21 +527,31 @@ uint32 SavesSyncRequest::getBytesToDownload() const {
 
 void SavesSyncRequest::finishError(const Networking::ErrorResponse &error, Networking::RequestState state) {
 	debug(9, "SavesSync::finishError");
-	//if we were downloading a file - remember the name
-	//and make the Request close() it, so we can delete it
-	Common::String name = _currentDownloadingFile.name();
+	//if we were downloading files - remember their names
+	//and make the Requests close() them, so we can delete them
+	Common::Array<Common::String> incompleteFiles;
+	_ignoreCallback = true;
 	if (_workingRequest) {
-		_ignoreCallback = true;
 		_workingRequest->finish();
 		_workingRequest = nullptr;
-		_ignoreCallback = false;
 	}
+	for (uint32 i = 0; i < _transferSlots.size(); ++i) {
+		TransferSlot &transfer = _transferSlots[i];
+		if (transfer.downloadingFile.name() != "")
+			incompleteFiles.push_back(transfer.downloadingFile.name());
+		if (transfer.request) {
+			transfer.request->finish();
+			transfer.request = nullptr;
+		}
+		transfer.downloadingFile = StorageFile();
+		transfer.uploadingName = "";
+	}
+	_ignoreCallback = false;
 	//unlock all the files by making getFilesToDownload() return empty array
-	_currentDownloadingFile = StorageFile();
 	_filesToDownload.clear();
-	//delete the incomplete file
-	if (name != "")
-		g_system->getSavefileManager()->removeSavefile(name);
+	//delete the incomplete files
+	for (uint32 i = 0; i < incompleteFiles.size(); ++i)
+		g_system->getSavefileManager()->removeSavefile(incompleteFiles[i]);
 	Request::finishError(error);
 }
 
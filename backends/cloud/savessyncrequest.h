@@ -30,13 +30,30 @@
 namespace Cloud {
 
 class SavesSyncRequest: public Networking::Request {
+	/** How many files are transferred at once unless the user overrides it. */
+	static const uint32 kDefaultParallelTransfers = 4;
+
+	/**
+	 * One parallel transfer. While the slot is busy, request points to
+	 * the Storage's download/upload Request and either downloadingFile
+	 * or uploadingName (depending on the phase) names the file it works
+	 * on. Idle slots have a null request.
+	 */
+	struct TransferSlot {
+		Request *request;
+		StorageFile downloadingFile;
+		Common::String uploadingName;
+
+		TransferSlot() : request(nullptr) {}
+	};
+
 	Storage *_storage;
 	Storage::BoolCallback _boolCallback;
 	Common::HashMap<Common::String, uint32> _localFilesTimestamps;
 	Common::Array<StorageFile> _filesToDownload;
 	Common::Array<Common::String> _filesToUpload;
-	StorageFile _currentDownloadingFile;
-	Common::String _currentUploadingFile;
+	Common::Array<TransferSlot> _transferSlots;
+	bool _downloading;
 	Request *_workingRequest;
 	bool _ignoreCallback;
 	uint32 _totalFilesToHandle;
@@ -48,12 +65,15 @@ class SavesSyncRequest: public Networking::Request {
 	void directoryListedErrorCallback(const Networking::ErrorResponse &error);
 	void directoryCreatedCallback(const Storage::BoolResponse &response);
 	void directoryCreatedErrorCallback(const Networking::ErrorResponse &error);
-	void fileDownloadedCallback(const Storage::BoolResponse &response);
-	void fileDownloadedErrorCallback(const Networking::ErrorResponse &error);
-	void fileUploadedCallback(const Storage::UploadResponse &response);
-	void fileUploadedErrorCallback(const Networking::ErrorResponse &error);
-	void downloadNextFile();
-	void uploadNextFile();
+	void fileDownloadedCallback(uint32 slot, const Storage::BoolResponse &response);
+	void fileDownloadedErrorCallback(uint32 slot, const Networking::ErrorResponse &error);
+	void fileUploadedCallback(uint32 slot, const Storage::UploadResponse &response);
+	void fileUploadedErrorCallback(uint32 slot, const Networking::ErrorResponse &error);
+	void startTransfers();
+	void startDownload(uint32 slot);
+	void startUpload(uint32 slot);
+	uint32 activeTransfers() const;
+	uint32 activeDownloads() const;
 	void finishError(const Networking::ErrorResponse &error, Networking::RequestState state = Networking::FINISHED) override;
 	void finishSync(bool success);
 
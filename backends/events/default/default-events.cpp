@@ -69,13 +69,9 @@ DefaultEventManager::~DefaultEventManager() {
 
 void DefaultEventManager::init() {
 #ifdef ENABLE_VKEYBD
+	// The keyboard pack (an XML layout plus bitmaps) is only parsed once
+	// the keyboard is actually summoned, to keep it off the start-up path.
 	_vk = new Common::VirtualKeyboard();
-
-	if (ConfMan.hasKey("vkeybd_pack_name")) {
-		_vk->loadKeyboardPack(ConfMan.get("vkeybd_pack_name"));
-	} else {
-		_vk->loadKeyboardPack("vkeybd_default");
-	}
 #endif
 }
 
@@ -162,6 +158,13 @@ bool DefaultEventManager::pollEvent(Common::Event &event) {
 		if (_vk->isDisplaying()) {
 			_vk->close(true);
 		} else {
+			if (!_vk->isLoaded()) {
+				if (ConfMan.hasKey("vkeybd_pack_name")) {
+					_vk->loadKeyboardPack(ConfMan.get("vkeybd_pack_name"));
+				} else {
+					_vk->loadKeyboardPack("vkeybd_default");
+				}
+			}
 			PauseToken pt;
 			if (g_engine)
 				pt = g_engine->pauseEngine();
@@ -36,6 +36,54 @@ SdlEventSource::~SdlEventSource() {
 	closeJoystick();
 }
 
+bool SdlEventSource::pollEvent(Common::Event &event) {
+	// Deliver the event that was polled right after a motion run last call.
+	if (_hasDeferredEvent) {
+		event = _deferredEvent;
+		_hasDeferredEvent = false;
+		return true;
+	}
+
+	// A high-polling-rate mouse can queue hundreds of motion events per
+	// frame, and each delivered event takes a keymapper pass and an engine
+	// round trip. Merge consecutive motions into one event carrying the
+	// final position and the summed relative movement. Any other event type
+	// flushes the pending motion first, so ordering is preserved.
+	bool hasPendingMotion = false;
+	Common::Event pendingMotion;
+
+	Common::Event polled;
+	while (pollSdlEvent(polled)) {
+		if (polled.type == Common::EVENT_MOUSEMOVE) {
+			if (hasPendingMotion) {
+				pendingMotion.mouse = polled.mouse;
+				pendingMotion.relMouse += polled.relMouse;
+			} else {
+				pendingMotion = polled;
+				hasPendingMotion = true;
+			}
+			continue;
+		}
+
+		if (hasPendingMotion) {
+			_deferredEvent = polled;
+			_hasDeferredEvent = true;
+			event = pendingMotion;
+			return true;
+		}
+
+		event = polled;
+		return true;
+	}
+
+	if (hasPendingMotion) {
+		event = pendingMotion;
+		return true;
+	}
+
+	return false;
+}
+
 bool SdlEventSource::processMouseEvent(Common::Event &event, int x, int y, int relx, int rely) {
 	_mouseX = x;
 	_mouseY = y;
@@ -46,6 +46,10 @@ public:
 
 	/**
 	 * Gets and processes SDL events.
+	 *
+	 * Runs of consecutive mouse motion events are coalesced into a single
+	 * event carrying the final position and the summed relative movement,
+	 * so high-polling-rate mice cannot flood the keymapper and the engine.
 	 */
 	virtual bool pollEvent(Common::Event &event);
 
@@ -109,6 +113,18 @@ protected:
 	 */
 	void closeJoystick();
 
+	/**
+	 * Polls and translates a single SDL event.
+	 *
+	 * Implemented per SDL version; called by pollEvent(), which merges
+	 * runs of mouse motion events before they reach the dispatcher.
+	 */
+	bool pollSdlEvent(Common::Event &event);
+
+	/** Event held back while a coalesced mouse motion is delivered first. */
+	bool _hasDeferredEvent;
+	Common::Event _deferredEvent;
+
 	/**
 	 * Pre process an event before it is dispatched.
 	 */
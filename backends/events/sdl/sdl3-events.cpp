@@ -75,7 +75,7 @@ void SdlEventSource::loadGameControllerMappingFile() {
 SdlEventSource::SdlEventSource()
 	: EventSource(), _scrollLock(false), _joystick(nullptr), _lastScreenID(0), _graphicsManager(nullptr), _queuedFakeMouseMove(false),
 	  _lastHatPosition(SDL_HAT_CENTERED), _mouseX(0), _mouseY(0), _engineRunning(false)
-	  , _queuedFakeKeyUp(false), _fakeKeyUp(), _controller(nullptr) {
+	  , _queuedFakeKeyUp(false), _fakeKeyUp(), _controller(nullptr), _hasDeferredEvent(false) {
 	int joystick_num = ConfMan.getInt("joystick_num");
 	if (joystick_num >= 0) {
 		// Initialize SDL joystick subsystem
@@ -613,7 +613,7 @@ void SdlEventSource::preprocessFingerMotion(SDL_Event *event) {
 	}
 }
 
-bool SdlEventSource::pollEvent(Common::Event &event) {
+bool SdlEventSource::pollSdlEvent(Common::Event &event) {
 	finishSimulatedMouseClicks();
 
 	// In case we still need to send a key up event for a key down from a
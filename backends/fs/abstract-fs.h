@@ -192,6 +192,17 @@ public:
 	 */
 	virtual Common::SeekableReadStream *createReadStreamForAltStream(Common::AltStreamType altStreamType);
 
+	/**
+	 * Creates a SeekableReadStream instance corresponding to the file
+	 * referred by this node, backed by a read-only memory mapping of the
+	 * file where the backend supports one. The default implementation
+	 * falls back to createReadStream(), so a valid stream is returned
+	 * whenever the file is readable at all.
+	 *
+	 * @return pointer to the stream object, 0 in case of a failure
+	 */
+	virtual Common::SeekableReadStream *createReadStreamMapped();
+
 	/**
 	 * Creates a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
@@ -100,6 +100,10 @@ Common::SeekableReadStream *ChRootFilesystemNode::createReadStream() {
 	return _realNode->createReadStream();
 }
 
+Common::SeekableReadStream *ChRootFilesystemNode::createReadStreamMapped() {
+	return _realNode->createReadStreamMapped();
+}
+
 Common::SeekableWriteStream *ChRootFilesystemNode::createWriteStream(bool atomic) {
 	return _realNode->createWriteStream(atomic);
 }
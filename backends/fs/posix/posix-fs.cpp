@@ -34,6 +34,7 @@
 #include "backends/fs/posix/posix-fs.h"
 #include "backends/fs/posix/posix-iostream.h"
 #include "common/algorithm.h"
+#include "common/memstream.h"
 
 #include <sys/param.h>
 #include <sys/stat.h>
@@ -50,6 +51,12 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#if defined(POSIX) && !defined(PLAYSTATION3) && !defined(PSP2) && !defined(__DS__) && !defined(__OS2__)
+// Memory-mapped read streams, see createReadStreamMapped().
+#define SCUMMVM_POSIX_MMAP
+#include <sys/mman.h>
+#endif
+
 #ifdef __OS2__
 #define INCL_DOS
 #include <os2.h>
@@ -68,6 +75,26 @@ bool POSIXFilesystemNode::isWritable() const {
 }
 
 void POSIXFilesystemNode::setFlags() {
+#if defined(__linux__) && defined(STATX_TYPE)
+	// Only query the file type, which is all we keep. Together with
+	// AT_STATX_DONT_SYNC this lets the kernel answer from cached
+	// attributes on network filesystems instead of synchronizing with
+	// the server for fields we never look at.
+	struct statx stx;
+
+	if (statx(AT_FDCWD, _path.c_str(), AT_STATX_DONT_SYNC, STATX_TYPE, &stx) == 0) {
+		_isValid = true;
+		_isDirectory = S_ISDIR(stx.stx_mode);
+		return;
+	}
+
+	// statx() is not available on old kernels; fall back to stat() then.
+	if (errno != ENOSYS) {
+		_isValid = false;
+		_isDirectory = false;
+		return;
+	}
+#endif
 	struct stat st;
 
 	_isValid = (0 == stat(_path.c_str(), &st));
@@ -279,6 +306,58 @@ Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
 	return PosixIoStream::makeFromPath(getPath(), StdioStream::WriteMode_Read);
 }
 
+#ifdef SCUMMVM_POSIX_MMAP
+
+namespace {
+
+/**
+ * A read stream served from a read-only memory mapping of the whole
+ * file. The mapping lives exactly as long as the stream.
+ */
+class PosixMappedFileStream final : public Common::MemoryReadStream {
+public:
+	PosixMappedFileStream(const byte *data, uint32 size) :
+		Common::MemoryReadStream(data, size), _mapData(data), _mapSize(size) {}
+
+	~PosixMappedFileStream() override {
+		munmap(const_cast<byte *>(_mapData), _mapSize);
+	}
+
+private:
+	const byte *_mapData;
+	size_t _mapSize;
+};
+
+} // End of anonymous namespace
+
+#endif // SCUMMVM_POSIX_MMAP
+
+Common::SeekableReadStream *POSIXFilesystemNode::createReadStreamMapped() {
+#ifdef SCUMMVM_POSIX_MMAP
+	int fd = open(_path.c_str(), O_RDONLY);
+	if (fd >= 0) {
+		struct stat st;
+
+		// MemoryReadStream carries a 32 bit size, so only map files that
+		// fit; empty files cannot be mapped at all.
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+				st.st_size > 0 && (uint64)st.st_size <= 0xFFFFFFFFu) {
+			void *addr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr != MAP_FAILED) {
+				close(fd);
+				return new PosixMappedFileStream((const byte *)addr, (uint32)st.st_size);
+			}
+		}
+
+		close(fd);
+	}
+#endif
+
+	// Fall back to the buffered stdio stream when mapping is unavailable
+	// or failed (e.g. on filesystems that do not support mmap).
+	return createReadStream();
+}
+
 Common::SeekableReadStream *POSIXFilesystemNode::createReadStreamForAltStream(Common::AltStreamType altStreamType) {
 #ifdef MACOSX
 	if (altStreamType == Common::AltStreamType::MacResourceFork) {
@@ -33,6 +33,7 @@
 
 // Include this after windows.h so we don't get a warning for redefining ARRAYSIZE
 #include "backends/fs/stdiostream.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 
 #if defined(__DC__)
@@ -48,7 +49,8 @@
 #define STDIOSTREAM_NO_ATOMIC_SUPPORT
 #endif
 
-StdioStream::StdioStream(void *handle) : _handle(handle), _path(nullptr) {
+StdioStream::StdioStream(void *handle) : _handle(handle), _path(nullptr),
+		_ioStats(Common::Profiler::instance().ioChannel(Common::Profiler::currentIoTag())) {
 	assert(handle);
 }
 
@@ -142,19 +144,26 @@ int64 StdioStream::size() const {
 }
 
 bool StdioStream::seek(int64 offs, int whence) {
+	const uint32 start = Common::Profiler::ioClock();
 #if defined(WIN32)
-	return _fseeki64((FILE *)_handle, offs, whence) == 0;
+	bool success = _fseeki64((FILE *)_handle, offs, whence) == 0;
 #elif defined(HAS_FSEEKO_OFFT_64)
-	return fseeko((FILE *)_handle, offs, whence) == 0;
+	bool success = fseeko((FILE *)_handle, offs, whence) == 0;
 #elif defined(HAS_FSEEKO64)
-	return fseeko64((FILE *)_handle, offs, whence) == 0;
+	bool success = fseeko64((FILE *)_handle, offs, whence) == 0;
 #else
-	return fseek((FILE *)_handle, offs, whence) == 0;
+	bool success = fseek((FILE *)_handle, offs, whence) == 0;
 #endif
+	_ioStats->addSeek(Common::Profiler::ioClock() - start);
+	return success;
 }
 
 uint32 StdioStream::read(void *ptr, uint32 len) {
-	return fread((byte *)ptr, 1, len, (FILE *)_handle);
+	const uint32 start = Common::Profiler::ioClock();
+	uint32 bytesRead = fread((byte *)ptr, 1, len, (FILE *)_handle);
+	Common::Profiler::countIoRead(bytesRead);
+	_ioStats->addRead(bytesRead, Common::Profiler::ioClock() - start);
+	return bytesRead;
 }
 
 bool StdioStream::setBufferSize(uint32 bufferSize) {
@@ -166,7 +175,11 @@ bool StdioStream::setBufferSize(uint32 bufferSize) {
 }
 
 uint32 StdioStream::write(const void *ptr, uint32 len) {
-	return fwrite(ptr, 1, len, (FILE *)_handle);
+	const uint32 start = Common::Profiler::ioClock();
+	uint32 bytesWritten = fwrite(ptr, 1, len, (FILE *)_handle);
+	Common::Profiler::countIoWrite(bytesWritten);
+	_ioStats->addWrite(bytesWritten, Common::Profiler::ioClock() - start);
+	return bytesWritten;
 }
 
 bool StdioStream::flush() {
@@ -24,6 +24,7 @@
 
 #include "common/scummsys.h"
 #include "common/noncopyable.h"
+#include "common/profiler.h"
 #include "common/stream.h"
 #include "common/str.h"
 
@@ -40,6 +41,9 @@ protected:
 	void *_handle;
 	Common::String *_path;
 
+	/** I/O accounting channel of the subsystem that opened the stream. */
+	Common::Profiler::IoChannelStats *_ioStats;
+
 	static StdioStream *makeFromPathHelper(const Common::String &path, WriteMode writeMode,
 			StdioStream *(*factory)(void *handle));
 
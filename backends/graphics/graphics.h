@@ -22,6 +22,7 @@
 #ifndef BACKENDS_GRAPHICS_ABSTRACT_H
 #define BACKENDS_GRAPHICS_ABSTRACT_H
 
+#include "common/array.h"
 #include "common/system.h"
 #include "common/noncopyable.h"
 #include "common/keyboard.h"
@@ -92,6 +93,28 @@ public:
 	virtual void fillScreen(const Common::Rect &r, uint32 col) = 0;
 	virtual void updateScreen() = 0;
 	virtual void presentBuffer() {}
+
+	/**
+	 * Retrieve the regions of the final output that were changed by the most
+	 * recent updateScreen() call, in output pixel coordinates.
+	 *
+	 * Capture and streaming layers can use this to restrict encoding work to
+	 * the changed tiles instead of diffing whole frames. Backends that do not
+	 * track damage return false, in which case the caller has to treat the
+	 * entire output as changed. An empty list on a true return means nothing
+	 * changed.
+	 */
+	virtual bool getLastFrameChangedRects(Common::Array<Common::Rect> &rects) const { return false; }
+
+	/**
+	 * Copy the final composited output of the most recent updateScreen()
+	 * call into @p surface, in the output pixel format.
+	 *
+	 * For paletted output formats the palette has to be fetched separately
+	 * through grabPalette(). Returns false when the backend cannot provide
+	 * the composited output.
+	 */
+	virtual bool grabLastFrame(Graphics::Surface &surface) const { return false; }
 	virtual void setShakePos(int shakeXOffset, int shakeYOffset) = 0;
 	virtual void setFocusRectangle(const Common::Rect& rect) = 0;
 	virtual void clearFocusRectangle() = 0;
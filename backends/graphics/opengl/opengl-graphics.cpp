@@ -30,6 +30,7 @@
 #include "graphics/opengl/debug.h"
 
 #include "common/array.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #include "common/algorithm.h"
@@ -82,7 +83,7 @@ OpenGLGraphicsManager::OpenGLGraphicsManager()
 	  _cursorHotspotXScaled(0), _cursorHotspotYScaled(0), _cursorWidthScaled(0), _cursorHeightScaled(0),
 	  _cursorKeyColor(0), _cursorUseKey(true), _cursorDontScale(false), _cursorPaletteEnabled(false), _shakeOffsetScaled()
 #if !USE_FORCED_GLES
-	  , _libretroPipeline(nullptr)
+	  , _libretroPipeline(nullptr), _gpuScalerActive(false)
 #endif
 #if defined(USE_OPENGL_GAME) || defined(USE_OPENGL_SHADERS)
 	  , _renderer3d(nullptr)
@@ -413,6 +414,8 @@ bool OpenGLGraphicsManager::setShader(const Common::Path &fileName) {
 
 bool OpenGLGraphicsManager::loadShader(const Common::Path &fileName) {
 #if !USE_FORCED_GLES
+	_gpuScalerActive = false;
+
 	if (!_libretroPipeline) {
 		warning("Libretro is not supported");
 		return true;
@@ -428,7 +431,7 @@ bool OpenGLGraphicsManager::loadShader(const Common::Path &fileName) {
 			warning("Failed to load shader %s", fileName.toString().c_str());
 			return false;
 		}
-	} else {
+	} else if (!loadBuiltinScalerShader()) {
 		_libretroPipeline->close();
 	}
 #endif
@@ -436,6 +439,47 @@ bool OpenGLGraphicsManager::loadShader(const Common::Path &fileName) {
 	return true;
 }
 
+#if !USE_FORCED_GLES
+bool OpenGLGraphicsManager::loadBuiltinScalerShader() {
+#ifdef USE_SCALERS
+	// Map the active scaler selection to the GLSL port shipped in
+	// shaders.dat, so that on shader-capable contexts the filter runs in
+	// the present pass at no CPU cost. Only scalers with a faithful port
+	// are mapped; everything else keeps its CPU implementation. A user
+	// selected shader preset always takes precedence (see loadShader()).
+	if (ConfMan.hasKey("gpu_scalers") && !ConfMan.getBool("gpu_scalers"))
+		return false;
+
+	const char *scalerName = _scalerPlugins[_currentState.scalerIndex]->get<ScalerPluginObject>().getName();
+	const int factor = _currentState.scaleFactor;
+
+	Common::String preset;
+	if (!strcmp(scalerName, "hq") && factor >= 2 && factor <= 4)
+		preset = Common::String::format("hqx/hq%dx.glslp", factor);
+	else if (!strcmp(scalerName, "advmame") && (factor == 2 || factor == 3))
+		preset = Common::String::format("scalenx/scale%dx.glslp", factor);
+
+	if (preset.empty())
+		return false;
+
+	Common::SearchSet shaderSet;
+
+	Common::generateZipSet(shaderSet, "shaders.dat", "shaders*.dat");
+
+	if (!_libretroPipeline->open(Common::Path(preset), shaderSet)) {
+		debug(1, "Failed to load built-in scaler shader %s", preset.c_str());
+		return false;
+	}
+
+	debug(1, "Scaler '%s' at factor %d runs on the GPU (%s)", scalerName, factor, preset.c_str());
+	_gpuScalerActive = true;
+	return true;
+#else
+	return false;
+#endif
+}
+#endif
+
 void OpenGLGraphicsManager::beginGFXTransaction() {
 	assert(_transactionMode == kTransactionNone);
 
@@ -456,6 +500,10 @@ OSystem::TransactionError OpenGLGraphicsManager::endGFXTransaction() {
 		setupNewGameScreen = true;
 	}
 
+#if !USE_FORCED_GLES
+	const bool hadGpuScaler = _gpuScalerActive;
+#endif
+
 #ifdef USE_RGB_COLOR
 	if (_oldState.gameFormat != _currentState.gameFormat) {
 		setupNewGameScreen = true;
@@ -586,6 +634,13 @@ OSystem::TransactionError OpenGLGraphicsManager::endGFXTransaction() {
 		_currentState.valid = true;
 	} while (_transactionMode == kTransactionRollback);
 
+#if !USE_FORCED_GLES
+	// Switching between a CPU scaler and its GPU port changes whether the
+	// game screen needs a scaled backing texture
+	if (hadGpuScaler != _gpuScalerActive)
+		setupNewGameScreen = true;
+#endif
+
 	if (setupNewGameScreen) {
 		delete _gameScreen;
 		_gameScreen = nullptr;
@@ -596,7 +651,9 @@ OSystem::TransactionError OpenGLGraphicsManager::endGFXTransaction() {
 			_renderer3d->enter3D();
 #endif
 		} else {
-			const bool wantScaler = _currentState.scaleFactor > 1;
+			// With a GPU scaler the game screen stays unscaled; the GLSL
+			// port does the filtering in the present pass
+			const bool wantScaler = _currentState.scaleFactor > 1 && !gpuScalerActive();
 
 #ifdef USE_RGB_COLOR
 			_gameScreen = createSurface(_currentState.gameFormat, false, wantScaler);
@@ -730,6 +787,8 @@ void OpenGLGraphicsManager::updateScreen() {
 		return;
 	}
 
+	PROFILE_SCOPE("OpenGLGraphicsManager::updateScreen");
+
 #ifdef USE_OSD
 	if (_osdMessageChangeRequest) {
 		osdMessageUpdateSurface();
@@ -764,6 +823,8 @@ void OpenGLGraphicsManager::updateScreen() {
 		return;
 	}
 
+	Common::Profiler::instance().frameBegin();
+
 #if defined(USE_OPENGL_GAME) || defined(USE_OPENGL_SHADERS)
 	if (_renderer3d) {
 		_renderer3d->leave3D();
@@ -939,7 +1000,9 @@ void OpenGLGraphicsManager::updateScreen() {
 
 	_cursorNeedsRedraw = false;
 	_forceRedraw = false;
+	Common::Profiler::instance().framePresentBegin();
 	refreshScreen();
+	Common::Profiler::instance().frameEnd();
 
 #if defined(USE_OPENGL_GAME) || defined(USE_OPENGL_SHADERS)
 	if (_renderer3d) {
@@ -1102,7 +1165,7 @@ void OpenGLGraphicsManager::setMouseCursor(const void *buf, uint w, uint h, int
 	}
 
 #ifdef USE_SCALERS
-	bool wantScaler = (_currentState.scaleFactor > 1) && !dontScale && _scalerPlugins[_currentState.scalerIndex]->get<ScalerPluginObject>().canDrawCursor();
+	bool wantScaler = (_currentState.scaleFactor > 1) && !dontScale && !gpuScalerActive() && _scalerPlugins[_currentState.scalerIndex]->get<ScalerPluginObject>().canDrawCursor();
 #else
 	bool wantScaler = false;
 #endif
@@ -321,7 +321,30 @@ private:
 	 * OpenGL pipeline used for post-processing.
 	 */
 	LibRetroPipeline *_libretroPipeline;
+
+	/**
+	 * Whether the active scaler runs as a built-in GLSL port on the GPU
+	 * instead of a CPU scaler (see loadBuiltinScalerShader()).
+	 */
+	bool _gpuScalerActive;
+
+	/**
+	 * Try to map the active scaler selection to the GLSL port shipped in
+	 * shaders.dat and open it in the LibRetro pipeline.
+	 *
+	 * @return true when a port was loaded; _gpuScalerActive is updated.
+	 */
+	bool loadBuiltinScalerShader();
+#endif
+
+	/** Convenience accessor for _gpuScalerActive that builds everywhere. */
+	bool gpuScalerActive() const {
+#if !USE_FORCED_GLES
+		return _gpuScalerActive;
+#else
+		return false;
 #endif
+	}
 
 protected:
 	/**
@@ -44,7 +44,7 @@ namespace OpenGL {
 //
 
 Surface::Surface()
-	: _allDirty(false), _dirtyArea() {
+	: _allDirty(false), _dirtyArea(), _numDirtyRects(0) {
 }
 
 void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcPtr, uint srcPitch) {
@@ -94,6 +94,24 @@ void Surface::addDirtyArea(const Common::Rect &r) {
 	} else {
 		_dirtyArea.extend(r);
 	}
+
+	// Keep the individual rectangles as well, merging with any existing one
+	// the new rectangle touches so repeated writes to the same region do not
+	// eat up the slots. Once the list is full the bounding box above remains
+	// the only record.
+	if (r.isEmpty())
+		return;
+
+	for (uint i = 0; i < _numDirtyRects && i < kMaxDirtyRects; i++) {
+		if (_dirtyRects[i].intersects(r) || _dirtyRects[i].contains(r)) {
+			_dirtyRects[i].extend(r);
+			return;
+		}
+	}
+
+	if (_numDirtyRects < kMaxDirtyRects)
+		_dirtyRects[_numDirtyRects] = r;
+	_numDirtyRects++;
 }
 
 Common::Rect Surface::getDirtyArea() const {
@@ -104,6 +122,16 @@ Common::Rect Surface::getDirtyArea() const {
 	}
 }
 
+const Common::Rect *Surface::getDirtyRects(uint &count) const {
+	if (_allDirty || _numDirtyRects > kMaxDirtyRects) {
+		count = 0;
+		return nullptr;
+	}
+
+	count = _numDirtyRects;
+	return _dirtyRects;
+}
+
 //
 // Surface implementations
 //
@@ -165,6 +193,28 @@ void TextureSurface::updateGLTexture() {
 		return;
 	}
 
+	// When the dirty regions were few enough to track individually, upload
+	// them separately if that transfers less than half of their bounding
+	// box; otherwise one upload of the bounding box wins.
+	uint numRects;
+	const Common::Rect *trackedRects = getDirtyRects(numRects);
+	if (trackedRects && numRects > 1) {
+		Common::Rect rects[kMaxDirtyRects];
+		uint32 rectArea = 0;
+		for (uint i = 0; i < numRects; i++) {
+			rects[i] = trackedRects[i];
+			rectArea += rects[i].width() * rects[i].height();
+		}
+
+		const Common::Rect bound = getDirtyArea();
+		if (rectArea * 2 <= (uint32)(bound.width() * bound.height())) {
+			for (uint i = 0; i < numRects; i++) {
+				updateGLTexture(rects[i]);
+			}
+			return;
+		}
+	}
+
 	Common::Rect dirtyArea = getDirtyArea();
 
 	updateGLTexture(dirtyArea);
@@ -148,13 +148,28 @@ public:
 	 */
 	virtual const Texture &getGLTexture() const = 0;
 protected:
-	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); }
+	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); _numDirtyRects = 0; }
 
 	void addDirtyArea(const Common::Rect &r);
 	Common::Rect getDirtyArea() const;
+
+	enum { kMaxDirtyRects = 4 };
+
+	/**
+	 * Obtain the individual dirty rectangles when they were few enough to
+	 * track. Returns nullptr when the list overflowed or the whole surface
+	 * was flagged, in which case getDirtyArea() has to be used instead.
+	 *
+	 * Disjoint small updates - an OSD popup fading in one corner while a
+	 * widget blinks in another - stay separate this way instead of being
+	 * widened to their common bounding box on upload.
+	 */
+	const Common::Rect *getDirtyRects(uint &count) const;
 private:
 	bool _allDirty;
 	Common::Rect _dirtyArea;
+	Common::Rect _dirtyRects[kMaxDirtyRects];
+	uint _numDirtyRects; ///< Exceeds kMaxDirtyRects once the list overflowed.
 };
 
 /**
@@ -26,6 +26,7 @@
 #include "backends/events/sdl/sdl-events.h"
 #include "common/config-manager.h"
 #include "common/mutex.h"
+#include "common/profiler.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #include "common/util.h"
@@ -1008,6 +1009,15 @@ bool SurfaceSdlGraphicsManager::loadGFXMode() {
 	// SDL_SetColors does nothing for non indexed surfaces.
 	SDL_SetColors(_screen, _currentPalette, 0, 256);
 
+	// Treat the whole palette as dirty until the first update flushes it.
+	// setPalette() skips entries that match _currentPalette, so a first
+	// palette identical to the zero-initialized one (all black) would
+	// otherwise never reach the freshly created SDL surfaces, which start
+	// out with their own defaults (all white on SDL2, alpha 0 from the
+	// sync above).
+	_paletteDirtyStart = 0;
+	_paletteDirtyEnd = 256;
+
 	//
 	// Create the surface that contains the scaled graphics in 16 bit mode
 	//
@@ -1086,6 +1096,7 @@ bool SurfaceSdlGraphicsManager::loadGFXMode() {
 		error("allocating _tmpscreen2 failed");
 
 	if (_isHwPalette) {
+		SDL_SetColors(_tmpscreen, _currentPalette, 0, 256);
 		SDL_SetColors(_tmpscreen2, _overlayPalette, 0, 256);
 		SDL_SetColors(_overlayscreen, _overlayPalette, 0, 256);
 	}
@@ -1202,6 +1213,8 @@ bool SurfaceSdlGraphicsManager::hotswapGFXMode() {
 void SurfaceSdlGraphicsManager::updateScreen() {
 	assert(_transactionMode == kTransactionNone);
 
+	PROFILE_SCOPE("SurfaceSdlGraphicsManager::updateScreen");
+
 	Common::StackLock lock(_graphicsMutex);	// Lock the mutex until this function ends
 
 	internUpdateScreen();
@@ -1221,6 +1234,8 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 	if (debugger)
 		debugger->onFrame();
 
+	Common::Profiler::instance().frameBegin();
+
 	bool curCursorNeedsRedraw = _cursorNeedsRedraw;
 	if (_prevCursorNeedsRedraw && _isDoubleBuf) {
 		_cursorNeedsRedraw = true;
@@ -1376,10 +1391,17 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		_numPrevDirtyRects = _numDirtyRects;
 	}
 
+	// Fold overlapping rects together (the cursor rects in particular
+	// tend to repeat between frames) so no pixel is copied and scaled
+	// more than once.
+	if (!doRedraw && actualDirtyRects > 1)
+		actualDirtyRects = coalesceDirtyRectList(_dirtyRectList, actualDirtyRects, actualDirtyRects);
+
 	// Only draw anything if necessary
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 	bool doPresent = false;
 #endif
+	_lastFrameChangedRects.clear();
 	if (actualDirtyRects > 0 || _cursorNeedsRedraw) {
 		SDL_Rect *r;
 		SDL_Rect dst;
@@ -1453,8 +1475,8 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 				if (_videoMode.aspectRatioCorrection && !_overlayInGUI)
 					dst_y = real2Aspect(dst_y);
 
-				_scaler->scale((byte *)srcSurf->pixels + (src_x + _maxExtraPixels) * bpp + (src_y + _maxExtraPixels) * srcPitch, srcPitch,
-						(byte *)_hwScreen->pixels + dst_x * bpp + dst_y * dstPitch, dstPitch, dst_w, dst_h, src_x, src_y);
+				const byte *scaleSrc = (byte *)srcSurf->pixels + (src_x + _maxExtraPixels) * bpp + (src_y + _maxExtraPixels) * srcPitch;
+				byte *scaleDst = (byte *)_hwScreen->pixels + dst_x * bpp + dst_y * dstPitch;
 
 				r->x = dst_x;
 				r->y = dst_y;
@@ -1463,8 +1485,14 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 
 #ifdef USE_ASPECT
 				if (_videoMode.aspectRatioCorrection && orig_dst_y < height && !_overlayInGUI)
-					r->h = stretch200To240((uint8 *) _hwScreen->pixels, dstPitch, r->w, r->h, r->x, r->y, orig_dst_y * scale1, _videoMode.filtering, 	convertSDLPixelFormat(_hwScreen->format));
+					// Composed pipeline: the stretched rows are emitted
+					// straight from the scaler's band buffer instead of
+					// being re-read from _hwScreen afterwards.
+					r->h = _scaler->scaleAndStretch200To240(scaleSrc, srcPitch, scaleDst, dstPitch,
+							dst_w, dst_h, src_x, src_y, orig_dst_y * scale1, _videoMode.filtering);
+				else
 #endif
+					_scaler->scale(scaleSrc, srcPitch, scaleDst, dstPitch, dst_w, dst_h, src_x, src_y);
 			}
 		}
 		SDL_UnlockSurface(srcSurf);
@@ -1574,8 +1602,18 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		}
 #endif
 
+		// Publish the changed regions for getLastFrameChangedRects() before
+		// the list is reset; at this point the rects are in final output
+		// coordinates. This happens even with the display disabled so that
+		// headless capture setups still see the damage stream.
+		for (int i = 0; i < actualDirtyRects; i++) {
+			const SDL_Rect &sr = _dirtyRectList[i];
+			_lastFrameChangedRects.push_back(Common::Rect(sr.x, sr.y, sr.x + sr.w, sr.y + sr.h));
+		}
+
 		// Finally, blit all our changes to the screen
 		if (!_displayDisabled) {
+			Common::Profiler::instance().framePresentBegin();
 			updateScreen(_dirtyRectList, actualDirtyRects);
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 			doPresent = true;
@@ -1604,6 +1642,35 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 	if (_isDoubleBuf)
 		SDL_Flip(_hwScreen);
 #endif
+
+	// Only records when a present actually happened above.
+	Common::Profiler::instance().frameEnd();
+}
+
+bool SurfaceSdlGraphicsManager::getLastFrameChangedRects(Common::Array<Common::Rect> &rects) const {
+	Common::StackLock lock(_graphicsMutex);
+
+	rects = _lastFrameChangedRects;
+	return true;
+}
+
+bool SurfaceSdlGraphicsManager::grabLastFrame(Graphics::Surface &surface) const {
+	Common::StackLock lock(_graphicsMutex);
+
+	if (!_hwScreen)
+		return false;
+
+	if (!lockSurface(_hwScreen))
+		return false;
+
+	Graphics::PixelFormat format = convertSDLPixelFormat(_hwScreen->format);
+	Graphics::Surface data;
+	data.init(_hwScreen->w, _hwScreen->h, _hwScreen->pitch, _hwScreen->pixels, format);
+	surface.copyFrom(data);
+
+	SDL_UnlockSurface(_hwScreen);
+
+	return true;
 }
 
 bool SurfaceSdlGraphicsManager::saveScreenshot(const Common::Path &filename) const {
@@ -1802,13 +1869,84 @@ void SurfaceSdlGraphicsManager::fillScreen(const Common::Rect &r, uint32 col) {
 	unlockScreen();
 }
 
+static uint32 dirtyRectArea(const SDL_Rect &r) {
+	return (uint32)r.w * (uint32)r.h;
+}
+
+static SDL_Rect dirtyRectUnion(const SDL_Rect &a, const SDL_Rect &b) {
+	SDL_Rect u;
+	u.x = MIN(a.x, b.x);
+	u.y = MIN(a.y, b.y);
+	u.w = MAX(a.x + a.w, b.x + b.w) - u.x;
+	u.h = MAX(a.y + a.h, b.y + b.h) - u.y;
+	return u;
+}
+
+/**
+ * Coalesce a dirty rect list in place and return the new count.
+ *
+ * The first stage merges any pair whose bounding box is no larger than
+ * the two rects combined - duplicates, contained rects, and heavily
+ * overlapping or adjacent ones - which never increases the number of
+ * pixels to copy. If the list is still longer than @p target (i.e. it
+ * overflowed), a second stage greedily merges whichever pair wastes the
+ * least area, trading a little overdraw for not falling back to a
+ * full-screen update.
+ */
+static int coalesceDirtyRectList(SDL_Rect *list, int count, int target) {
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (int i = 0; i < count; ++i) {
+			for (int j = i + 1; j < count; ++j) {
+				SDL_Rect u = dirtyRectUnion(list[i], list[j]);
+				if (dirtyRectArea(u) <= dirtyRectArea(list[i]) + dirtyRectArea(list[j])) {
+					list[i] = u;
+					list[j] = list[--count];
+					changed = true;
+					--j;
+				}
+			}
+		}
+	}
+
+	while (count > target) {
+		int bestI = 0, bestJ = 1;
+		// Signed: merges made here can open up "free" (negative cost)
+		// pairs, which should win immediately.
+		int32 bestCost = 0x7fffffff;
+		for (int i = 0; i < count; ++i) {
+			for (int j = i + 1; j < count; ++j) {
+				SDL_Rect u = dirtyRectUnion(list[i], list[j]);
+				int32 cost = (int32)dirtyRectArea(u) - (int32)(dirtyRectArea(list[i]) + dirtyRectArea(list[j]));
+				if (cost < bestCost) {
+					bestCost = cost;
+					bestI = i;
+					bestJ = j;
+				}
+			}
+		}
+		list[bestI] = dirtyRectUnion(list[bestI], list[bestJ]);
+		list[bestJ] = list[--count];
+	}
+
+	return count;
+}
+
 void SurfaceSdlGraphicsManager::addDirtyRect(int x, int y, int w, int h, bool inOverlay, bool realCoordinates) {
 	if (_forceRedraw)
 		return;
 
 	if (_numDirtyRects == NUM_DIRTY_RECT) {
-		_forceRedraw = true;
-		return;
+		// Make room by coalescing instead of giving up and updating the
+		// whole screen; scenes with many small blits overflow the list
+		// every frame, and a full update is almost always costlier than
+		// the slightly coarser merged rects.
+		_numDirtyRects = coalesceDirtyRectList(_dirtyRectList, _numDirtyRects, NUM_DIRTY_RECT / 2);
+		if (_numDirtyRects >= NUM_DIRTY_RECT) {
+			_forceRedraw = true;
+			return;
+		}
 	}
 
 	int height, width;
@@ -1892,21 +2030,37 @@ void SurfaceSdlGraphicsManager::setPalette(const byte *colors, uint start, uint
 
 	const byte *b = colors;
 	uint i;
+
+	// Narrow the update to the entries that actually changed. Engines
+	// commonly re-send a full palette that is mostly or fully unchanged,
+	// and any non-empty dirty range forces a full screen redraw.
+	uint changedStart = num;
+	uint changedEnd = 0;
+
 	SDL_Color *base = _currentPalette + start;
 	for (i = 0; i < num; i++, b += 3) {
-		base[i].r = b[0];
-		base[i].g = b[1];
-		base[i].b = b[2];
+		if (base[i].r != b[0] || base[i].g != b[1] || base[i].b != b[2]) {
+			base[i].r = b[0];
+			base[i].g = b[1];
+			base[i].b = b[2];
+
+			if (i < changedStart)
+				changedStart = i;
+			changedEnd = i + 1;
+		}
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 		base[i].a = 255;
 #endif
 	}
 
-	if (start < _paletteDirtyStart)
-		_paletteDirtyStart = start;
+	if (changedStart >= changedEnd)
+		return;
+
+	if (start + changedStart < _paletteDirtyStart)
+		_paletteDirtyStart = start + changedStart;
 
-	if (start + num > _paletteDirtyEnd)
-		_paletteDirtyEnd = start + num;
+	if (start + changedEnd > _paletteDirtyEnd)
+		_paletteDirtyEnd = start + changedEnd;
 
 	// Some games blink cursors with palette
 	if (_cursorPaletteDisabled)
@@ -2814,6 +2968,29 @@ void SurfaceSdlGraphicsManager::removeOSDMessage() {
 #endif
 }
 
+void SurfaceSdlGraphicsManager::addOSDDirtyRect(const SDL_Rect &rect) {
+	// The OSD surfaces are blitted in hardware screen coordinates, but the
+	// dirty rect list is kept in virtual coordinates, so undo the scaling,
+	// aspect ratio correction and shake offset that updateScreen() will
+	// apply. The conversion rounds outwards; addDirtyRect() additionally
+	// pads the result, so rounding errors are covered.
+	const int scale = _overlayVisible ? 1 : _videoMode.scaleFactor;
+
+	int y0 = rect.y;
+	int y1 = rect.y + rect.h;
+	if (_videoMode.aspectRatioCorrection && !_overlayInGUI) {
+		y0 = y0 * 5 / 6;
+		y1 = aspect2Real(y1);
+	}
+
+	int x0 = rect.x / scale - _currentShakeXOffset;
+	int x1 = (rect.x + rect.w + scale - 1) / scale - _currentShakeXOffset;
+	y0 = y0 / scale - _currentShakeYOffset;
+	y1 = (y1 + scale - 1) / scale - _currentShakeYOffset;
+
+	addDirtyRect(x0, y0, x1 - x0, y1 - y0, _overlayVisible);
+}
+
 void SurfaceSdlGraphicsManager::updateOSD() {
 	// OSD message visible (i.e. non-transparent)?
 	if (_osdMessageAlpha != SDL_ALPHA_TRANSPARENT) {
@@ -2841,10 +3018,16 @@ void SurfaceSdlGraphicsManager::updateOSD() {
 		}
 	}
 
-	if (_osdIconSurface || _osdMessageSurface) {
-		// Redraw the area below the icon and message for the transparent blit to give correct results.
-		_forceRedraw = true;
-	}
+	// Redraw the area below the icon and message each frame, both for the
+	// transparent blit to give correct results and so the updated fade
+	// alpha reaches the screen. Dirtying just those areas instead of
+	// forcing a full redraw keeps a fading OSD message from rescaling and
+	// re-uploading the whole frame for the duration of the fade.
+	if (_osdMessageSurface)
+		addOSDDirtyRect(getOSDMessageRect());
+
+	if (_osdIconSurface)
+		addOSDDirtyRect(getOSDIconRect());
 }
 
 void SurfaceSdlGraphicsManager::drawOSD() {
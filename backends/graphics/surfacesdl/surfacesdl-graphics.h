@@ -107,6 +107,8 @@ public:
 	void fillScreen(uint32 col) override;
 	void fillScreen(const Common::Rect &r, uint32 col) override;
 	void updateScreen() override;
+	bool getLastFrameChangedRects(Common::Array<Common::Rect> &rects) const override;
+	bool grabLastFrame(Graphics::Surface &surface) const override;
 	void setFocusRectangle(const Common::Rect& rect) override;
 	void clearFocusRectangle() override;
 
@@ -161,6 +163,9 @@ protected:
 	/** Screen rectangle where the OSD background activity icon is drawn */
 	SDL_Rect getOSDIconRect() const;
 
+	/** Mark the virtual screen area below an OSD rect as dirty */
+	void addOSDDirtyRect(const SDL_Rect &rect);
+
 	void updateOSD();
 	void drawOSD();
 #endif
@@ -352,7 +357,7 @@ protected:
 	int _screenChangeCount;
 
 	enum {
-		NUM_DIRTY_RECT = 100,
+		NUM_DIRTY_RECT = 256,
 		MAX_SCALING = 3
 	};
 
@@ -366,6 +371,10 @@ protected:
 	SDL_Rect _prevDirtyRectList[NUM_DIRTY_RECT];
 	int _numPrevDirtyRects;
 
+	// Output-coordinate regions changed by the most recent update, published
+	// for getLastFrameChangedRects()
+	Common::Array<Common::Rect> _lastFrameChangedRects;
+
 	struct MousePos {
 		// The size and hotspot of the original cursor image.
 		int16 w, h;
@@ -56,9 +56,14 @@ Keymap::Keymap(KeymapType type, const String &id, const String &description) :
 
 }
 
+uint32 Keymap::s_mappingsGeneration = 0;
+
 Keymap::~Keymap() {
 	for (auto *action : _actions)
 		delete action;
+
+	// Make sure cached lookups referencing this keymap's actions get dropped
+	s_mappingsGeneration++;
 }
 
 void Keymap::addAction(Action *action) {
@@ -75,6 +80,7 @@ void Keymap::registerMapping(Action *action, const HardwareInput &hwInput) {
 	ActionArray::const_iterator found = find(actionArray.begin(), actionArray.end(), action);
 	if (found == actionArray.end()) {
 		actionArray.push_back(action);
+		s_mappingsGeneration++;
 	}
 }
 
@@ -91,6 +97,8 @@ void Keymap::unregisterMapping(Action *action) {
 			_hwActionMap.erase(hwAction._key);
 		}
 	}
+
+	s_mappingsGeneration++;
 }
 
 void Keymap::resetMapping(Action *action) {
@@ -282,6 +290,7 @@ void Keymap::loadMappings() {
 	String prefix = KEYMAP_KEY_PREFIX + _id + "_";
 
 	_hwActionMap.clear();
+	s_mappingsGeneration++;
 	for (auto &action : _actions) {
 		String confKey = prefix + action->id;
 
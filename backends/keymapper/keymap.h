@@ -165,7 +165,19 @@ public:
 	 * Defines if the keymap is considered when mapping events
 	 */
 	bool isEnabled() const { return _enabled; }
-	void setEnabled(bool enabled) { _enabled = enabled; }
+	void setEnabled(bool enabled) {
+		if (_enabled != enabled) {
+			_enabled = enabled;
+			s_mappingsGeneration++;
+		}
+	}
+
+	/**
+	 * Generation counter covering the bindings and enabled state of all
+	 * keymaps. It is incremented on every change, so cached lookup results
+	 * can be discarded once they are stale.
+	 */
+	static uint32 getMappingsGeneration() { return s_mappingsGeneration; }
 
 	/** Helper to return an array with a single keymap element */
 	static Array<Keymap *> arrayOf(Keymap *keymap) {
@@ -190,6 +202,8 @@ private:
 	ActionArray _actions;
 	HardwareActionMap _hwActionMap;
 
+	static uint32 s_mappingsGeneration;
+
 	ConfigManager::Domain *_configDomain;
 	HardwareInputSet *_hardwareInputSet;
 	const KeymapperDefaultBindings *_backendDefaultBindings;
@@ -38,6 +38,7 @@ Keymapper::Keymapper(EventManager *eventMan) :
 		_hardwareInputs(nullptr),
 		_backendDefaultBindings(nullptr),
 		_delayedEventSource(new DelayedEventSource()),
+		_mappedActionCacheGeneration(Keymap::getMappingsGeneration()),
 		_enabled(true),
 		_enabledKeymapType(Keymap::kKeymapTypeGame) {
 	_eventMan->getEventDispatcher()->registerSource(_delayedEventSource, true);
@@ -53,6 +54,7 @@ void Keymapper::clear() {
 		delete keymap;
 	}
 	_keymaps.clear();
+	_mappedActionCache.clear();
 
 	delete _backendDefaultBindings;
 	_backendDefaultBindings = nullptr;
@@ -137,6 +139,8 @@ void Keymapper::cleanupGameKeymaps() {
 			it++;
 		}
 	}
+
+	_mappedActionCache.clear();
 }
 
 void Keymapper::setGameKeymapState(const String &id, bool enable) {
@@ -172,7 +176,65 @@ void Keymapper::reloadAllMappings() {
 
 void Keymapper::setEnabledKeymapType(Keymap::KeymapType type) {
 	assert(type == Keymap::kKeymapTypeGui || type == Keymap::kKeymapTypeGame);
-	_enabledKeymapType = type;
+	if (_enabledKeymapType != type) {
+		_enabledKeymapType = type;
+		_mappedActionCache.clear();
+	}
+}
+
+/**
+ * Builds a key identifying the part of an event getMappedActions() looks at,
+ * so the resolved actions can be cached. Events mapping to the same actions,
+ * like the down and up halves of a button press, share a signature.
+ */
+static uint64 eventSignature(const Event &ev) {
+	uint64 type = ev.type;
+	uint64 payload = 0;
+
+	switch (ev.type) {
+	case EVENT_KEYUP:
+		type = EVENT_KEYDOWN;
+		// fall through
+	case EVENT_KEYDOWN: {
+		KeyState normalizedKeystate = KeyboardHardwareInputSet::normalizeKeyState(ev.kbd);
+		payload = ((uint64)normalizedKeystate.flags << 32) | (uint32)normalizedKeystate.keycode;
+		break;
+	}
+	case EVENT_LBUTTONUP:
+		type = EVENT_LBUTTONDOWN;
+		break;
+	case EVENT_RBUTTONUP:
+		type = EVENT_RBUTTONDOWN;
+		break;
+	case EVENT_MBUTTONUP:
+		type = EVENT_MBUTTONDOWN;
+		break;
+	case EVENT_X1BUTTONUP:
+		type = EVENT_X1BUTTONDOWN;
+		break;
+	case EVENT_X2BUTTONUP:
+		type = EVENT_X2BUTTONDOWN;
+		break;
+	case EVENT_JOYBUTTON_UP:
+		type = EVENT_JOYBUTTON_DOWN;
+		// fall through
+	case EVENT_JOYBUTTON_DOWN:
+		payload = ev.joystick.button;
+		break;
+	case EVENT_JOYAXIS_MOTION:
+		// Only the half axis matters for the mapping; at position zero the
+		// actions bound to both halves trigger.
+		payload = ((uint64)ev.joystick.axis << 2)
+		        | (ev.joystick.position == 0 ? 2 : (ev.joystick.position > 0 ? 1 : 0));
+		break;
+	case EVENT_CUSTOM_BACKEND_HARDWARE:
+		payload = ev.customType;
+		break;
+	default:
+		break;
+	}
+
+	return (type << 56) | payload;
 }
 
 bool Keymapper::mapEvent(const Event &ev, List<Event> &mappedEvents) {
@@ -182,17 +244,30 @@ bool Keymapper::mapEvent(const Event &ev, List<Event> &mappedEvents) {
 
 	hardcodedEventMapping(ev);
 
+	if (_mappedActionCacheGeneration != Keymap::getMappingsGeneration()) {
+		_mappedActionCache.clear();
+		_mappedActionCacheGeneration = Keymap::getMappingsGeneration();
+	}
+
 	Keymap::ActionArray actions;
-	Keymap::KeymapMatch match = getMappedActions(ev, actions, _enabledKeymapType);
-	if (match != Keymap::kKeymapMatchExact) {
-		// If we found exact matching actions this input in the game / gui keymaps,
-		// no need to look at the global keymaps. An input resulting in actions
-		// from system and game keymaps would lead to unexpected user experience.
-		Keymap::ActionArray globalActions;
-		match = getMappedActions(ev, globalActions, Keymap::kKeymapTypeGlobal);
-		if (match == Keymap::kKeymapMatchExact || actions.empty()) {
-			actions = globalActions;
+	const uint64 signature = eventSignature(ev);
+	HashMap<uint64, Keymap::ActionArray, EventSignature_Hash>::const_iterator cached = _mappedActionCache.find(signature);
+	if (cached != _mappedActionCache.end()) {
+		actions = cached->_value;
+	} else {
+		Keymap::KeymapMatch match = getMappedActions(ev, actions, _enabledKeymapType);
+		if (match != Keymap::kKeymapMatchExact) {
+			// If we found exact matching actions this input in the game / gui keymaps,
+			// no need to look at the global keymaps. An input resulting in actions
+			// from system and game keymaps would lead to unexpected user experience.
+			Keymap::ActionArray globalActions;
+			match = getMappedActions(ev, globalActions, Keymap::kKeymapTypeGlobal);
+			if (match == Keymap::kKeymapMatchExact || actions.empty()) {
+				actions = globalActions;
+			}
 		}
+
+		_mappedActionCache[signature] = actions;
 	}
 
 	bool matchedAction = !actions.empty();
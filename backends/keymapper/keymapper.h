@@ -165,6 +165,21 @@ private:
 
 	KeymapArray _keymaps;
 
+	struct EventSignature_Hash {
+		uint operator()(uint64 x) const { return (uint)(x ^ (x >> 32)); }
+	};
+
+	/**
+	 * Cache of the actions the active keymap stack resolves an input to,
+	 * keyed by the event signature built by eventSignature(). It makes
+	 * mapping a repeated input a single hash lookup instead of a walk over
+	 * all keymaps, and is discarded whenever a keymap changes (tracked
+	 * through Keymap::getMappingsGeneration()) or the enabled keymap type
+	 * is switched.
+	 */
+	HashMap<uint64, Keymap::ActionArray, EventSignature_Hash> _mappedActionCache;
+	uint32 _mappedActionCacheGeneration;
+
 	bool _joystickAxisPreviouslyPressed[8]; // size should match the number of valid axis entries of defaultJoystickAxes (in hardware-input.cpp)
 
 	Keymap::KeymapMatch getMappedActions(const Event &event, Keymap::ActionArray &actions, Keymap::KeymapType keymapType) const;
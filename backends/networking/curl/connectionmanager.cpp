@@ -44,6 +44,20 @@ namespace Networking {
 ConnectionManager::ConnectionManager(): _multi(nullptr), _timerStarted(false), _frame(0) {
 	curl_global_init(CURL_GLOBAL_ALL);
 	_multi = curl_multi_init();
+
+	// Keep a pool of warm connections around, so consecutive requests to
+	// the same host (cloud folder listings, DLC chunks) reuse them instead
+	// of paying TCP/TLS setup for every file.
+	curl_multi_setopt(_multi, CURLMOPT_MAXCONNECTS, 8L);
+#if LIBCURL_VERSION_NUM >= 0x071E00
+	// Added in libcurl 7.30.0
+	curl_multi_setopt(_multi, CURLMOPT_MAX_HOST_CONNECTIONS, 6L);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x072B00
+	// Added in libcurl 7.43.0: let parallel requests share one HTTP/2
+	// connection where the server supports multiplexing.
+	curl_multi_setopt(_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
 }
 
 ConnectionManager::~ConnectionManager() {
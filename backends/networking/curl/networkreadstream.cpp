@@ -116,6 +116,15 @@ void NetworkReadStream::initCurl(const char *url, curl_slist *headersList) {
 		curl_easy_setopt(_easy, CURLOPT_TCP_KEEPINTVL, _keepAliveInterval);
 	}
 #endif
+
+#if LIBCURL_VERSION_NUM >= 0x072F00
+	// Added in libcurl 7.47.0: negotiate HTTP/2 over TLS when available
+	// and wait for an existing connection to become multiplexable instead
+	// of always opening another one, so parallel requests to the same
+	// host share a single TLS session.
+	curl_easy_setopt(_easy, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+	curl_easy_setopt(_easy, CURLOPT_PIPEWAIT, 1L);
+#endif
 }
 
 bool NetworkReadStream::reuseCurl(const char *url, curl_slist *headersList) {
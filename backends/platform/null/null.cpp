@@ -42,6 +42,7 @@ typedef void (*sighandler_t)(int);
 #define FORBIDDEN_SYMBOL_EXCEPTION_stderr
 #define FORBIDDEN_SYMBOL_EXCEPTION_fputs
 #define FORBIDDEN_SYMBOL_EXCEPTION_exit
+#define FORBIDDEN_SYMBOL_EXCEPTION_getenv
 #define FORBIDDEN_SYMBOL_EXCEPTION_time_h
 
 #include "common/scummsys.h"
@@ -50,6 +51,7 @@ typedef void (*sighandler_t)(int);
 #include "backends/modular-backend.h"
 #include "backends/mutex/null/null-mutex.h"
 #include "base/main.h"
+#include "common/config-manager.h"
 
 #ifndef NULL_DRIVER_USE_FOR_TEST
 #include "backends/saves/default/default-saves.h"
@@ -102,10 +104,17 @@ private:
 	DWORD _startTime;
 #endif
 	bool _silenceLogs;
+
+	// Batch simulation mode: getMillis()/delayMillis() advance a virtual
+	// clock instead of tracking wall-clock time, so automated runs don't
+	// sleep. Enabled through the null_batch_mode config key or the
+	// SCUMMVM_NULL_BATCH environment variable.
+	bool _batchMode;
+	uint32 _virtualMillis;
 };
 
 OSystem_NULL::OSystem_NULL(bool silenceLogs) :
-	_silenceLogs(silenceLogs) {
+	_silenceLogs(silenceLogs), _batchMode(false), _virtualMillis(0) {
 	#if defined(__amigaos4__)
 		_fsFactory = new AmigaOSFilesystemFactory();
 	#elif defined(__MORPHOS__)
@@ -147,6 +156,10 @@ void OSystem_NULL::initBackend() {
 	last_handler = signal(SIGINT, intHandler);
 #endif
 
+	_batchMode = ConfMan.getBool("null_batch_mode");
+	if (!_batchMode && getenv("SCUMMVM_NULL_BATCH"))
+		_batchMode = true;
+
 	_timerManager = new DefaultTimerManager();
 	_eventManager = new DefaultEventManager(this);
 	_savefileManager = new DefaultSaveFileManager();
@@ -191,6 +204,13 @@ Common::MutexInternal *OSystem_NULL::createMutex() {
 }
 
 uint32 OSystem_NULL::getMillis(bool skipRecord) {
+	if (_batchMode) {
+		// Tick the virtual clock on every query so loops which poll
+		// getMillis() without ever calling delayMillis() still make
+		// progress.
+		return ++_virtualMillis;
+	}
+
 #ifdef POSIX
 	timeval curTime;
 
@@ -206,6 +226,24 @@ uint32 OSystem_NULL::getMillis(bool skipRecord) {
 }
 
 void OSystem_NULL::delayMillis(uint msecs) {
+	if (_batchMode) {
+		// Advance the virtual clock in small slices and service the timers
+		// after each one, so callbacks scheduled to expire during the delay
+		// fire in the same order as during a real wait.
+		uint remaining = msecs;
+		while (remaining > 0) {
+			const uint slice = MIN<uint>(remaining, 10);
+			_virtualMillis += slice;
+			remaining -= slice;
+
+#ifndef NULL_DRIVER_USE_FOR_TEST
+			((DefaultTimerManager *)getTimerManager())->checkTimers();
+			((NullMixerManager *)_mixerManager)->update(1);
+#endif
+		}
+		return;
+	}
+
 #ifdef POSIX
 	usleep(msecs * 1000);
 #elif defined(WIN32)
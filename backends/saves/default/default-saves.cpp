@@ -19,12 +19,17 @@
  *
  */
 
+// Disable symbol overrides so that we can use the POSIX thread API for the
+// background save writer (pthread.h drags in time.h)
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
 #include "common/scummsys.h"
 
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 #include "backends/cloud/cloudmanager.h"
 #endif
 #include "common/file.h"
+#include "common/profiler.h"
 #include "common/system.h"
 
 #if !defined(DISABLE_DEFAULT_SAVEFILEMANAGER)
@@ -37,20 +42,235 @@
 #include "common/archive.h"
 #include "common/config-manager.h"
 #include "common/compression/deflate.h"
+#include "common/memstream.h"
 
 #include <errno.h>	// for removeSavefile()
 
+#if defined(POSIX)
+#define BACKEND_SAVES_ASYNC_WRITER
+#include <pthread.h>
+#endif
+
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 const char *const DefaultSaveFileManager::TIMESTAMPS_FILENAME = "timestamps";
 #endif
 
-DefaultSaveFileManager::DefaultSaveFileManager() {
+#ifdef BACKEND_SAVES_ASYNC_WRITER
+
+/**
+ * Shared state of the background save writer. A single writer thread is
+ * started lazily on the first asynchronous save and services a FIFO of
+ * pending savegame buffers. Each buffer is compressed and written to a
+ * temporary file which is then renamed over the target, so an interrupted
+ * write can never leave a truncated save behind.
+ */
+struct DefaultSaveFileManager::AsyncSaveManager {
+	struct SaveJob {
+		Common::Path path;   ///< final location of the save
+		byte *data;          ///< malloc'd savegame contents, owned by the job
+		uint32 size;
+		bool compress;
+		SaveJob *next;
+	};
+
+	/**
+	 * The stream handed out by openForSavingAsync(). Collects the savegame
+	 * in memory and submits the buffer to the writer thread on finalize().
+	 */
+	class BufferStream : public Common::MemoryWriteStreamDynamic {
+	public:
+		BufferStream(AsyncSaveManager *writer, const Common::Path &path, bool compress) :
+			Common::MemoryWriteStreamDynamic(DisposeAfterUse::YES),
+			_writer(writer), _path(path), _compress(compress), _finalized(false) {}
+
+		void finalize() override {
+			if (_finalized)
+				return;
+			_finalized = true;
+
+			// The job takes ownership of the buffer.
+			_writer->submit(_path, _data, _size, _compress);
+			_disposeMemory = DisposeAfterUse::NO;
+		}
+
+	private:
+		AsyncSaveManager *_writer;
+		Common::Path _path;
+		bool _compress;
+		bool _finalized;
+	};
+
+	pthread_t _thread;
+	pthread_mutex_t _mutex;
+	pthread_cond_t _jobAvailable;
+	pthread_cond_t _jobDone;
+
+	SaveJob *_queueHead, *_queueTail;
+	uint _pendingJobs;   ///< queued plus in-flight jobs
+	bool _quit;
+	bool _started;       ///< whether the writer thread is running
+
+	// First error since the last drain(), reported by the writer thread.
+	bool _hadError;
+	Common::String _errorDesc;
+
+	AsyncSaveManager() :
+		_queueHead(nullptr), _queueTail(nullptr), _pendingJobs(0),
+		_quit(false), _started(false), _hadError(false) {
+		pthread_mutex_init(&_mutex, nullptr);
+		pthread_cond_init(&_jobAvailable, nullptr);
+		pthread_cond_init(&_jobDone, nullptr);
+		_started = (pthread_create(&_thread, nullptr, writerMain, this) == 0);
+	}
+
+	~AsyncSaveManager() {
+		if (_started) {
+			pthread_mutex_lock(&_mutex);
+			_quit = true;
+			pthread_cond_signal(&_jobAvailable);
+			pthread_mutex_unlock(&_mutex);
+			pthread_join(_thread, nullptr);
+		}
+		pthread_mutex_destroy(&_mutex);
+		pthread_cond_destroy(&_jobAvailable);
+		pthread_cond_destroy(&_jobDone);
+	}
+
+	void submit(const Common::Path &path, byte *data, uint32 size, bool compress) {
+		SaveJob *const job = new SaveJob();
+		// Deep-copy the path: String refcounting is not atomic, so the
+		// job must not share a string buffer with engine-thread objects
+		// across the thread boundary.
+		job->path = Common::Path(path.toString(Common::Path::kNativeSeparator).c_str(), Common::Path::kNativeSeparator);
+		job->data = data;
+		job->size = size;
+		job->compress = compress;
+		job->next = nullptr;
+
+		pthread_mutex_lock(&_mutex);
+		if (_queueTail)
+			_queueTail->next = job;
+		else
+			_queueHead = job;
+		_queueTail = job;
+		_pendingJobs++;
+		pthread_cond_signal(&_jobAvailable);
+		pthread_mutex_unlock(&_mutex);
+	}
+
+	bool busy() {
+		pthread_mutex_lock(&_mutex);
+		const bool result = _pendingJobs > 0;
+		pthread_mutex_unlock(&_mutex);
+		return result;
+	}
+
+	/**
+	 * Wait until the queue has drained. Returns false and passes out the
+	 * description of the first failed write since the previous drain.
+	 */
+	bool drain(Common::String &errorDesc) {
+		pthread_mutex_lock(&_mutex);
+		while (_pendingJobs > 0)
+			pthread_cond_wait(&_jobDone, &_mutex);
+		const bool result = !_hadError;
+		if (_hadError)
+			errorDesc = _errorDesc;
+		_hadError = false;
+		_errorDesc.clear();
+		pthread_mutex_unlock(&_mutex);
+		return result;
+	}
+
+	static void *writerMain(void *writer) {
+		((AsyncSaveManager *)writer)->writeLoop();
+		return nullptr;
+	}
+
+	void writeLoop() {
+		pthread_mutex_lock(&_mutex);
+		for (;;) {
+			while (!_quit && !_queueHead)
+				pthread_cond_wait(&_jobAvailable, &_mutex);
+			if (!_queueHead)
+				break; // told to quit, and nothing left to flush
+
+			SaveJob *const job = _queueHead;
+			_queueHead = job->next;
+			if (!_queueHead)
+				_queueTail = nullptr;
+			pthread_mutex_unlock(&_mutex);
+
+			Common::String errorDesc;
+			const bool success = writeJob(job, errorDesc);
+			free(job->data);
+			delete job;
+
+			pthread_mutex_lock(&_mutex);
+			if (!success && !_hadError) {
+				_hadError = true;
+				_errorDesc = errorDesc;
+			}
+			_pendingJobs--;
+			pthread_cond_broadcast(&_jobDone);
+		}
+		pthread_mutex_unlock(&_mutex);
+	}
+
+	bool writeJob(const SaveJob *job, Common::String &errorDesc) {
+		// Write to a temporary file next to the target and only rename it
+		// into place once it is complete on disk.
+		Common::Path tmpPath = job->path;
+		tmpPath.appendInPlace(".tmp");
+		const Common::String tmp = tmpPath.toString(Common::Path::kNativeSeparator);
+		const Common::String target = job->path.toString(Common::Path::kNativeSeparator);
+
+		Common::SeekableWriteStream *const sf = Common::FSNode(tmpPath).createWriteStream();
+		if (!sf) {
+			errorDesc = Common::String::format("Failed to create '%s'", tmp.c_str());
+			return false;
+		}
+
+		// Compression level 1: savegames are written during gameplay, so
+		// compression speed matters far more than the last few percent of
+		// size, and gzip readers decode any level transparently.
+		Common::WriteStream *const ws = job->compress ? Common::wrapCompressedWriteStream(sf, 1) : sf;
+		ws->write(job->data, job->size);
+		ws->finalize();
+		const bool writeOk = !ws->err();
+		delete ws;
+
+		if (!writeOk) {
+			errorDesc = Common::String::format("Failed to write savefile '%s'", target.c_str());
+			remove(tmp.c_str());
+			return false;
+		}
+
+		if (rename(tmp.c_str(), target.c_str()) != 0) {
+			errorDesc = Common::String::format("Failed to rename '%s' to '%s'", tmp.c_str(), target.c_str());
+			remove(tmp.c_str());
+			return false;
+		}
+		return true;
+	}
+};
+
+#endif // BACKEND_SAVES_ASYNC_WRITER
+
+DefaultSaveFileManager::DefaultSaveFileManager() : _asyncSaves(nullptr) {
 }
 
-DefaultSaveFileManager::DefaultSaveFileManager(const Common::Path &defaultSavepath) {
+DefaultSaveFileManager::DefaultSaveFileManager(const Common::Path &defaultSavepath) : _asyncSaves(nullptr) {
 	ConfMan.registerDefault("savepath", defaultSavepath);
 }
 
+DefaultSaveFileManager::~DefaultSaveFileManager() {
+#ifdef BACKEND_SAVES_ASYNC_WRITER
+	finishSaving();
+	delete _asyncSaves;
+#endif
+}
+
 
 void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 	clearError();
@@ -72,6 +292,9 @@ void DefaultSaveFileManager::updateSavefilesList(Common::StringArray &lockedFile
 }
 
 Common::StringArray DefaultSaveFileManager::listSavefiles(const Common::String &pattern) {
+	// Make sure any pending background save has hit the disk.
+	finishSaving();
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -92,6 +315,11 @@ Common::StringArray DefaultSaveFileManager::listSavefiles(const Common::String &
 }
 
 Common::InSaveFile *DefaultSaveFileManager::openRawFile(const Common::String &filename) {
+	Common::IoTagScope ioTag("saves");
+
+	// Make sure any pending background save has hit the disk.
+	finishSaving();
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -108,6 +336,11 @@ Common::InSaveFile *DefaultSaveFileManager::openRawFile(const Common::String &fi
 }
 
 Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String &filename) {
+	Common::IoTagScope ioTag("saves");
+
+	// Make sure any pending background save has hit the disk.
+	finishSaving();
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -132,6 +365,8 @@ Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String
 }
 
 Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String &filename, bool compress) {
+	Common::IoTagScope ioTag("saves");
+
 	// Assure the savefile name cache is up-to-date.
 	const Common::Path savePathName = getSavePath();
 	assureCached(savePathName);
@@ -167,7 +402,8 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 	Common::SeekableWriteStream *const sf = fileNode.createWriteStream();
 	if (!sf)
 		return nullptr;
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	// See writeJob(): favor compression speed for savegames.
+	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf, 1) : sf);
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
@@ -175,7 +411,78 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 	return result;
 }
 
+Common::OutSaveFile *DefaultSaveFileManager::openForSavingAsync(const Common::String &filename, bool compress) {
+#ifdef BACKEND_SAVES_ASYNC_WRITER
+	if (!_asyncSaves)
+		_asyncSaves = new AsyncSaveManager();
+	if (!_asyncSaves->_started) {
+		// The writer thread could not be started; save synchronously.
+		return openForSaving(filename, compress);
+	}
+
+	// Same bookkeeping as openForSaving().
+	const Common::Path savePathName = getSavePath();
+	assureCached(savePathName);
+	if (getError().getCode() != Common::kNoError)
+		return nullptr;
+
+	for (const auto &lockedFile : _lockedFiles) {
+		if (filename == lockedFile) {
+			return nullptr; // file is locked, no saving available
+		}
+	}
+
+#if defined(USE_CLOUD) && defined(USE_LIBCURL)
+	// Update file's timestamp
+	Common::HashMap<Common::String, uint32> timestamps = loadTimestamps();
+	timestamps[filename] = INVALID_TIMESTAMP;
+	saveTimestamps(timestamps);
+#endif
+
+	// Obtain node.
+	SaveFileCache::const_iterator file = _saveFileCache.find(filename);
+	Common::FSNode fileNode;
+
+	// If the file did not exist before, we add it to the cache.
+	if (file == _saveFileCache.end()) {
+		const Common::FSNode savePath(savePathName);
+		fileNode = savePath.getChild(filename);
+	} else {
+		fileNode = file->_value;
+	}
+
+	// Add file to cache; the writer thread creates it shortly.
+	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
+
+	return new Common::OutSaveFile(new AsyncSaveManager::BufferStream(_asyncSaves, fileNode.getPath(), compress));
+#else
+	return openForSaving(filename, compress);
+#endif
+}
+
+bool DefaultSaveFileManager::isSavingInProgress() const {
+#ifdef BACKEND_SAVES_ASYNC_WRITER
+	return _asyncSaves && _asyncSaves->busy();
+#else
+	return false;
+#endif
+}
+
+void DefaultSaveFileManager::finishSaving() {
+#ifdef BACKEND_SAVES_ASYNC_WRITER
+	if (!_asyncSaves)
+		return;
+
+	Common::String errorDesc;
+	if (!_asyncSaves->drain(errorDesc))
+		setError(Common::kWritingFailed, errorDesc);
+#endif
+}
+
 bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
+	// Make sure any pending background save has hit the disk.
+	finishSaving();
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -35,12 +35,16 @@ class DefaultSaveFileManager : public Common::SaveFileManager {
 public:
 	DefaultSaveFileManager();
 	DefaultSaveFileManager(const Common::Path &defaultSavepath);
+	~DefaultSaveFileManager() override;
 
 	void updateSavefilesList(Common::StringArray &lockedFiles) override;
 	Common::StringArray listSavefiles(const Common::String &pattern) override;
 	Common::InSaveFile *openRawFile(const Common::String &filename) override;
 	Common::InSaveFile *openForLoading(const Common::String &filename) override;
 	Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true) override;
+	Common::OutSaveFile *openForSavingAsync(const Common::String &filename, bool compress = true) override;
+	bool isSavingInProgress() const override;
+	void finishSaving() override;
 	bool removeSavefile(const Common::String &filename) override;
 	bool exists(const Common::String &filename) override;
 
@@ -104,6 +108,14 @@ private:
 	 * The currently cached directory.
 	 */
 	Common::Path _cachedDirectory;
+
+	/**
+	 * Background writer state for openForSavingAsync(). Created lazily on
+	 * the first asynchronous save; stays null on platforms without thread
+	 * support, where openForSavingAsync() degrades to openForSaving().
+	 */
+	struct AsyncSaveManager;
+	AsyncSaveManager *_asyncSaves;
 };
 
 #endif
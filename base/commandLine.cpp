@@ -325,6 +325,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("midi_gain", 100);
 
 	ConfMan.registerDefault("music_driver", "auto");
+	ConfMan.registerDefault("audio_resampler", "linear");
 	ConfMan.registerDefault("mt32_device", "null");
 	ConfMan.registerDefault("gm_device", "auto");
 	ConfMan.registerDefault("opl2lpt_parport", "null");
@@ -387,6 +388,7 @@ void registerDefaults() {
 	ConfMan.registerDefault("gui_browser_native", true);
 	ConfMan.registerDefault("gui_return_to_launcher_at_exit", false);
 	ConfMan.registerDefault("gui_launcher_chooser", "list");
+	ConfMan.registerDefault("gui_theme_cache", true);
 	ConfMan.registerDefault("grid_items_per_row", 4);
 	// Specify threshold for scanning directories in the launcher
 	// If number of game entries in scummvm.ini exceeds the specified
@@ -1061,6 +1063,10 @@ static void listGames(const Common::String &engineID) {
 	printf("Game ID                        Full Title                                                 \n"
 	       "------------------------------ -----------------------------------------------------------\n");
 
+	// Make sure the listing is complete even when engine plugin loading
+	// was deferred at startup
+	PluginManager::instance().loadDeferredPlugins();
+
 	const PluginList &plugins = EngineMan.getPlugins(PLUGIN_TYPE_ENGINE);
 	for (const auto &plugin : plugins) {
 		const Plugin *p = EngineMan.findDetectionPlugin(plugin->getName());
@@ -1108,6 +1114,8 @@ static void listEngines() {
 	printf("Engine ID       Engine Name                                           \n"
 	       "--------------- ------------------------------------------------------\n");
 
+	PluginManager::instance().loadDeferredPlugins();
+
 	const PluginList &plugins = EngineMan.getPlugins(PLUGIN_TYPE_ENGINE);
 	for (const auto &plugin : plugins) {
 		const Plugin *p = EngineMan.findDetectionPlugin(plugin->getName());
@@ -601,7 +601,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	MusicManager::instance();
 	Common::DebugManager::instance();
 
-	// Init the event manager. As the virtual keyboard is loaded here, it must
+	// Init the event manager. As the virtual keyboard is created here, it must
 	// take place after the backend is initiated and the screen has been setup
 	system.getEventManager()->init();
 
@@ -628,13 +628,17 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 #endif
 
 #ifdef ANDROID_BACKEND
-	// This early popup message for Android, informing the users about important
-	// changes to file access, needs to be *after* language for the GUI has been selected.
-	// Hence, we instantiate GUI Manager here, to take care of this.
-	GUI::GuiManager::instance();
 	if (AndroidFilesystemFactory::instance().hasSAF()
 		&& !ConfMan.hasKey("android_saf_dialog_shown")) {
 
+		// This early popup message for Android, informing the users about
+		// important changes to file access, needs to be *after* language for
+		// the GUI has been selected. Hence, we instantiate GUI Manager here,
+		// to take care of this. Only do it when the popup will actually be
+		// shown: the GUI manager parses the full theme on creation, which is
+		// wasted start-up time when a game is being launched directly.
+		GUI::GuiManager::instance();
+
 		bool cancelled = false;
 
 		if (!ConfMan.getGameDomains().empty()) {
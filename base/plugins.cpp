@@ -31,6 +31,7 @@
 #endif
 
 #include "base/detection/detection.h"
+#include "base/version.h"
 
 #include "engines/advancedDetector.h"
 
@@ -275,6 +276,14 @@ PluginManager::~PluginManager() {
 	// Explicitly unload all loaded plugins
 	unloadAllPlugins();
 
+#ifdef DYNAMIC_MODULES
+	// Delete the engine plugins which were deferred and never loaded
+	for (auto *deferredPlugin : _deferredPlugins) {
+		delete deferredPlugin;
+	}
+	_deferredPlugins.clear();
+#endif
+
 	// Delete the plugin providers
 	for (auto *pluginProvider : _providers) {
 		delete pluginProvider;
@@ -495,11 +504,36 @@ bool PluginManagerUncached::loadNextPlugin() {
  * one plugin in memory at a time.
  **/
 void PluginManager::loadAllPlugins() {
+#ifdef DYNAMIC_MODULES
+	bool rememberedNew = false;
+#endif
 	for (auto &pluginProvider : _providers) {
 		PluginList pl(pluginProvider->getPlugins());
+#ifdef DYNAMIC_MODULES
+		if (pluginProvider->isFilePluginProvider()) {
+			// Plugin files which a previous run of this very version recorded
+			// as engine plugins are left on disk for now: the launcher only
+			// needs the detection side, and findEnginePlugin() loads a
+			// deferred plugin the moment a game actually needs it. Unknown
+			// files are still loaded (and recorded) here, so freshly
+			// installed plugins keep working as before.
+			for (auto &curPlugin : pl) {
+				if (isRememberedEnginePlugin(curPlugin->getFileName()))
+					_deferredPlugins.push_back(curPlugin);
+				else if (tryLoadPlugin(curPlugin))
+					rememberedNew |= rememberEnginePluginFileName(curPlugin);
+			}
+			continue;
+		}
+#endif
 		Common::for_each(pl.begin(), pl.end(), Common::bind1st(Common::mem_fun(&PluginManager::tryLoadPlugin), this));
 	}
 
+#ifdef DYNAMIC_MODULES
+	if (rememberedNew)
+		ConfMan.flushToDisk();
+#endif
+
 #ifndef DETECTION_STATIC
 	/*
 	 * When detection is dynamic, loading above only gets us a PLUGIN_TYPE_DETECTION plugin
@@ -516,6 +550,15 @@ void PluginManager::loadAllPlugins() {
 }
 
 void PluginManager::loadAllPluginsOfType(PluginType type) {
+#ifdef DYNAMIC_MODULES
+	if (type == PLUGIN_TYPE_ENGINE) {
+		// The caller wants the full engine list: drop the deferral
+		// bookkeeping, the provider scan below recreates these plugins.
+		for (auto *deferredPlugin : _deferredPlugins)
+			delete deferredPlugin;
+		_deferredPlugins.clear();
+	}
+#endif
 	for (auto &pluginProvider : _providers) {
 		PluginList pluginList(pluginProvider->getPlugins());
 		for (auto *plugin : pluginList) {
@@ -535,6 +578,44 @@ void PluginManager::loadAllPluginsOfType(PluginType type) {
 	}
 }
 
+void PluginManager::loadDeferredPlugins() {
+#ifdef DYNAMIC_MODULES
+	bool rememberedNew = false;
+	for (auto *deferredPlugin : _deferredPlugins) {
+		if (tryLoadPlugin(deferredPlugin))
+			rememberedNew |= rememberEnginePluginFileName(deferredPlugin);
+	}
+	_deferredPlugins.clear();
+
+	if (rememberedNew)
+		ConfMan.flushToDisk();
+#endif
+}
+
+/**
+ * Load a single deferred engine plugin, using the file name recorded in the
+ * configuration under the domain 'engine_plugin_files' for this engine ID.
+ * Counterpart of the uncached manager's override.
+ **/
+bool PluginManager::loadPluginFromEngineId(const Common::String &engineId) {
+#ifdef DYNAMIC_MODULES
+	Common::ConfigManager::Domain *domain = ConfMan.getDomain("engine_plugin_files");
+	if (!domain || !domain->contains(engineId))
+		return false;
+
+	Common::Path filename(Common::Path::fromConfig((*domain)[engineId]));
+
+	for (PluginList::iterator it = _deferredPlugins.begin(); it != _deferredPlugins.end(); ++it) {
+		if ((*it)->getFileName() == filename) {
+			Plugin *plugin = *it;
+			_deferredPlugins.erase(it);
+			return tryLoadPlugin(plugin);
+		}
+	}
+#endif
+	return false;
+}
+
 void PluginManager::unloadAllPlugins() {
 	for (int i = 0; i < PLUGIN_TYPE_MAX; i++)
 		unloadPluginsExcept((PluginType)i, nullptr);
@@ -768,6 +849,59 @@ const Plugin *EngineManager::findDetectionPlugin(const Common::String &engineId)
 	return nullptr;
 }
 
+#ifdef DYNAMIC_MODULES
+/**
+ * Check whether the given plugin file was recorded as an engine plugin by a
+ * run of this very ScummVM version. Stale entries (after an upgrade, or for
+ * a plugin which moved) never match, so such a file simply gets loaded the
+ * normal way again.
+ **/
+bool PluginManager::isRememberedEnginePlugin(const Common::Path &filename) const {
+	Common::ConfigManager::Domain *domain = ConfMan.getDomain("engine_plugin_files");
+	if (!domain || !domain->contains("version") || (*domain)["version"] != gScummVMVersion)
+		return false;
+
+	Common::String config = filename.toConfig();
+	if (config.empty())
+		return false;
+
+	for (const auto &entry : *domain) {
+		if (entry._key != "version" && entry._value == config)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Record the file name of a freshly loaded engine plugin, so the next run
+ * can defer loading it. Counterpart of the uncached manager's
+ * updateConfigWithFileName(); additionally stamps the ScummVM version the
+ * entries were recorded with.
+ *
+ * @return true if the configuration changed and needs flushing
+ **/
+bool PluginManager::rememberEnginePluginFileName(Plugin *plugin) {
+	if (plugin->getType() != PLUGIN_TYPE_ENGINE || plugin->getFileName().empty())
+		return false;
+
+	if (!ConfMan.hasMiscDomain("engine_plugin_files"))
+		ConfMan.addMiscDomain("engine_plugin_files");
+
+	Common::ConfigManager::Domain *domain = ConfMan.getDomain("engine_plugin_files");
+	assert(domain);
+
+	const Common::String engineId = plugin->get<MetaEngine>().getName();
+	const Common::String config = plugin->getFileName().toConfig();
+	if (domain->contains(engineId) && (*domain)[engineId] == config &&
+			domain->contains("version") && (*domain)["version"] == gScummVMVersion)
+		return false;
+
+	domain->setVal(engineId, config);
+	domain->setVal("version", gScummVMVersion);
+	return true;
+}
+#endif
+
 const Plugin *PluginManager::findLoadedPlugin(const Common::String &engineId) {
 	const PluginList &plugins = getPlugins(PLUGIN_TYPE_ENGINE);
 
@@ -804,6 +938,18 @@ const Plugin *PluginManager::findEnginePlugin(const Common::String &engineId) {
 		}
 	} while (PluginMan.loadNextPlugin());
 
+#ifdef DYNAMIC_MODULES
+	// Last chance for the cached manager: bring in whatever engine plugins
+	// are still deferred from startup and look again. For the uncached
+	// manager the deferred list is always empty.
+	if (!_deferredPlugins.empty()) {
+		loadDeferredPlugins();
+		plugin = findLoadedPlugin(engineId);
+		if (plugin)
+			return plugin;
+	}
+#endif
+
 	return nullptr;
 }
 
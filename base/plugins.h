@@ -294,6 +294,19 @@ protected:
 	void addToPluginsInMemList(Plugin *plugin);
 	const Plugin *findLoadedPlugin(const Common::String &engineId);
 
+#ifdef DYNAMIC_MODULES
+	/**
+	 * Engine plugins whose file names were recorded in the configuration by
+	 * an earlier run. loadAllPlugins() leaves these on disk so startup does
+	 * not dlopen every engine; findEnginePlugin() loads one the moment its
+	 * engine is actually needed.
+	 */
+	PluginList _deferredPlugins;
+
+	bool isRememberedEnginePlugin(const Common::Path &filename) const;
+	bool rememberEnginePluginFileName(Plugin *plugin);
+#endif
+
 	static PluginManager *_instance;
 	PluginManager();
 
@@ -319,7 +332,7 @@ public:
 	virtual void init()	{}
 	virtual void loadFirstPlugin() {}
 	virtual bool loadNextPlugin() { return false; }
-	virtual bool loadPluginFromEngineId(const Common::String &engineId) { return false; }
+	virtual bool loadPluginFromEngineId(const Common::String &engineId);
 	virtual void updateConfigWithFileName(const Common::String &engineId) {}
 	virtual void loadDetectionPlugin() {}
 	virtual void unloadDetectionPlugin() {}
@@ -328,6 +341,13 @@ public:
 	virtual void loadAllPlugins();
 	virtual void loadAllPluginsOfType(PluginType type);
 
+	/**
+	 * Load every engine plugin which loadAllPlugins() deferred. Call this
+	 * before enumerating getPlugins(PLUGIN_TYPE_ENGINE) when the complete
+	 * list is wanted. A no-op for the uncached manager and static builds.
+	 */
+	void loadDeferredPlugins();
+
 	void unloadPluginsExcept(PluginType type, const Plugin *plugin, bool deletePlugin = true);
 
 	const PluginList &getPlugins(PluginType t) { return _pluginsInMem[t]; }
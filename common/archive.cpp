@@ -128,6 +128,10 @@ Common::Error Archive::dumpArchive(const Path &destPath) {
 
 	listMembers(files);
 
+	// We are about to walk every member in order
+	const AccessPattern oldPattern = getAccessPattern();
+	setAccessPattern(kAccessPatternSequential);
+
 	byte *data = nullptr;
 	uint dataSize = 0;
 
@@ -152,6 +156,7 @@ Common::Error Archive::dumpArchive(const Path &destPath) {
 		Common::DumpFile out;
 		Common::Path outPath = destPath.join(filePath);
 		if (!out.open(outPath, true)) {
+			setAccessPattern(oldPattern);
 			return Common::Error(Common::kCreatingFileFailed, "Cannot open/create dump file " + outPath.toString(Common::Path::kNativeSeparator));
 		} else {
 			uint32 writtenBytes = out.write(data, len);
@@ -160,6 +165,7 @@ Common::Error Archive::dumpArchive(const Path &destPath) {
 				out.close();
 				delete stream;
 				free(data);
+				setAccessPattern(oldPattern);
 				return Common::Error(Common::kWritingFailed, "Not enough storage space! Please free up some storage and try again");
 			}
 			out.flush();
@@ -170,6 +176,7 @@ Common::Error Archive::dumpArchive(const Path &destPath) {
 	}
 
 	free(data);
+	setAccessPattern(oldPattern);
 	return Common::kNoError;
 }
 
@@ -344,6 +351,8 @@ void SearchSet::add(const String &name, Archive *archive, int priority, bool aut
 	if (find(name) == _list.end()) {
 		Node node(priority, name, archive, autoFree);
 		insert(node);
+		// A new archive may shadow or provide cached names
+		invalidateLookupCache();
 	} else {
 		if (autoFree)
 			delete archive;
@@ -430,6 +439,7 @@ void SearchSet::remove(const String &name) {
 		if (it->_autoFree)
 			delete it->_arc;
 		_list.erase(it);
+		invalidateLookupCache();
 	}
 }
 
@@ -453,6 +463,7 @@ void SearchSet::clear() {
 	}
 
 	_list.clear();
+	invalidateLookupCache();
 }
 
 void SearchSet::setPriority(const String &name, int priority) {
@@ -469,17 +480,44 @@ void SearchSet::setPriority(const String &name, int priority) {
 	_list.erase(it);
 	node._priority = priority;
 	insert(node);
+	// The resolution order has changed
+	invalidateLookupCache();
+}
+
+// The cache deliberately has a size cap: an engine that probes an
+// unbounded set of generated names must not grow it without limit, so we
+// simply start over when it fills up.
+static const uint32 kLookupCacheMaxEntries = 4096;
+
+Archive *SearchSet::lookupCachedArchive(const Path &path, bool &known) const {
+	LookupCache::const_iterator it = _lookupCache.find(path);
+	known = (it != _lookupCache.end());
+	return known ? it->_value : nullptr;
+}
+
+void SearchSet::cacheLookup(const Path &path, Archive *arc) const {
+	if (_lookupCache.size() >= kLookupCacheMaxEntries)
+		_lookupCache.clear();
+	_lookupCache[path] = arc;
 }
 
 bool SearchSet::hasFile(const Path &path) const {
 	if (path.empty())
 		return false;
 
+	bool known;
+	Archive *cached = lookupCachedArchive(path, known);
+	if (known)
+		return cached != nullptr;
+
 	for (const auto &archive : _list) {
-		if (archive._arc->hasFile(path))
+		if (archive._arc->hasFile(path)) {
+			cacheLookup(path, archive._arc);
 			return true;
+		}
 	}
 
+	cacheLookup(path, nullptr);
 	return false;
 }
 
@@ -555,15 +593,31 @@ const ArchiveMemberPtr SearchSet::getMember(const Path &path, Archive **containe
 	if (path.empty())
 		return ArchiveMemberPtr();
 
+	bool known;
+	Archive *cached = lookupCachedArchive(path, known);
+	if (known) {
+		if (!cached)
+			return ArchiveMemberPtr();
+		if (cached->hasFile(path)) {
+			if (container) {
+				*container = cached;
+			}
+			return cached->getMember(path);
+		}
+		// Stale entry; rescan below.
+	}
+
 	for (const auto &archive : _list) {
 		if (archive._arc->hasFile(path)) {
 			if (container) {
 				*container = archive._arc;
 			}
+			cacheLookup(path, archive._arc);
 			return archive._arc->getMember(path);
 		}
 	}
 
+	cacheLookup(path, nullptr);
 	return ArchiveMemberPtr();
 }
 
@@ -575,12 +629,26 @@ SeekableReadStream *SearchSet::createReadStreamForMember(const Path &path) const
 	if (path.empty())
 		return nullptr;
 
+	bool known;
+	Archive *cached = lookupCachedArchive(path, known);
+	if (known) {
+		if (!cached)
+			return nullptr;
+		SeekableReadStream *stream = cached->createReadStreamForMember(path);
+		if (stream)
+			return stream;
+		// Stale entry; rescan below.
+	}
+
 	for (const auto &archive : _list) {
 		SeekableReadStream *stream = archive._arc->createReadStreamForMember(path);
-		if (stream)
+		if (stream) {
+			cacheLookup(path, archive._arc);
 			return stream;
+		}
 	}
 
+	cacheLookup(path, nullptr);
 	return nullptr;
 }
 
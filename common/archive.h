@@ -140,10 +140,22 @@ private:
  */
 class Archive {
 public:
-	Archive() : _mapsAreReady(false) { }
+	Archive() : _mapsAreReady(false), _accessPattern(kAccessPatternRandom) { }
 
 	virtual ~Archive() { }
 
+	/**
+	 * Expected pattern of upcoming member accesses, settable through
+	 * setAccessPattern(). Purely a performance hint: implementations may
+	 * keep container streams open and read ahead across members while a
+	 * sequential scan is announced, and drop those buffers again for
+	 * random access. Results are the same either way.
+	 */
+	enum AccessPattern {
+		kAccessPatternRandom,
+		kAccessPatternSequential
+	};
+
 	/**
 	 * Check if a member with the given @p name is present in the Archive.
 	 * Patterns are not allowed, as this is meant to be a quick File::exists()
@@ -209,6 +221,17 @@ public:
 	 */
 	Common::Error dumpArchive(const Path &destPath);
 
+	/**
+	 * Announce the expected access pattern for upcoming member reads.
+	 * The base implementation only records the hint; see AccessPattern.
+	 */
+	virtual void setAccessPattern(AccessPattern pattern) { _accessPattern = pattern; }
+
+	/**
+	 * The access pattern last announced with setAccessPattern().
+	 */
+	AccessPattern getAccessPattern() const { return _accessPattern; }
+
 	/**
 	 * Returns the separator used by internal paths in the archive
 	 */
@@ -226,6 +249,7 @@ private:
 	void prepareMaps() const;
 
 	mutable bool _mapsAreReady;
+	AccessPattern _accessPattern;
 	typedef HashMap<String, bool, IgnoreCase_Hash, IgnoreCase_EqualTo> SubfileSet;
 	typedef HashMap<Path, SubfileSet, Path::IgnoreCase_Hash, Path::IgnoreCase_EqualTo> AllfileMap;
 	mutable AllfileMap _directoryMap, _fileMap;
@@ -345,6 +369,23 @@ class SearchSet : public Archive {
 
 	void insert(const Node& node); //!< Add an archive while keeping the list sorted by descending priority.
 
+	/**
+	 * Cache of member resolutions: maps a queried path to the archive that
+	 * resolved it first, or to nullptr for a known miss. Engines commonly
+	 * probe the same (often nonexistent) names over and over, and without
+	 * the cache every probe walks the whole priority list. The cache is
+	 * dropped whenever the set of archives changes; a stale positive entry
+	 * (the file has meanwhile vanished from its archive) falls back to a
+	 * full scan.
+	 */
+	typedef HashMap<Path, Archive *, Path::Hash, Path::EqualTo> LookupCache;
+	mutable LookupCache _lookupCache;
+
+	void invalidateLookupCache() { _lookupCache.clear(); }
+	//! Look up a cached resolution; sets known to whether an entry exists.
+	Archive *lookupCachedArchive(const Path &path, bool &known) const;
+	void cacheLookup(const Path &path, Archive *arc) const;
+
 	bool _ignoreClashes;
 
 public:
@@ -86,8 +86,13 @@ private:
 
 	/** Fill the container with at least @p min bits. */
 	FORCEINLINE void fillContainer(size_t min) {
-		while (_bitsLeft < min) {
+		if (_bitsLeft >= min)
+			return;
 
+		// Once a refill is needed, top the container up completely instead
+		// of stopping at min bits, so its cost is amortized over as many
+		// reads as the container holds.
+		do {
 			CONTAINER data;
 			if (_pos + _bitsLeft + valueBits <= _size) {
 				data = readData();
@@ -107,8 +112,8 @@ private:
 				_bitContainer |= data << _bitsLeft;
 
 			_bitsLeft += valueBits;
-		}
-}
+		} while (_bitsLeft + valueBits <= (int)(sizeof(_bitContainer) * 8));
+	}
 
 	/** Get @p n bits from the bit container. */
 	FORCEINLINE static uint32 getNBits(CONTAINER value, size_t n) {
@@ -127,8 +132,12 @@ private:
 	FORCEINLINE void skipBits(size_t n) {
 		assert(n <= _bitsLeft);
 
-		// Shift to the next bit
-		if (MSB2LSB)
+		// Shift to the next bit. Shifting by the full container width is
+		// undefined, and n can reach it when a completely filled container
+		// is drained in one go.
+		if (n >= sizeof(_bitContainer) * 8)
+			_bitContainer = 0;
+		else if (MSB2LSB)
 			_bitContainer <<= n;
 		else
 			_bitContainer >>= n;
@@ -0,0 +1,242 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Disable symbol overrides so that we can use the POSIX thread API
+// (pthread.h drags in time.h)
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
+#include "common/bufferedstream.h"
+#include "common/ptr.h"
+#include "common/util.h"
+
+#if defined(POSIX)
+#define BUFFEREDSTREAM_USE_PTHREADS
+#include <pthread.h>
+#endif
+
+namespace Common {
+
+#ifdef BUFFEREDSTREAM_USE_PTHREADS
+
+namespace {
+
+/**
+ * Double-buffered wrapper around a ReadStream. A background thread keeps
+ * refilling the buffer the consumer is not currently draining, so that a
+ * slow underlying stream does not stall the consumer on every underrun.
+ *
+ * The worker and the consumer walk the two buffers in the same
+ * round-robin order: the worker only fills a buffer whose filled flag is
+ * clear, the consumer only drains one whose flag is set, and the flag is
+ * flipped under the mutex. The parent stream itself is therefore touched
+ * by the worker thread alone. Once the parent reports EOS the worker
+ * exits; whatever it buffered up to that point is still delivered.
+ */
+class PrefetchingReadStream : public ReadStream {
+protected:
+	DisposablePtr<ReadStream> _parentStream;
+	uint32 _bufSize;
+	byte *_buf[2];
+
+	pthread_mutex_t _mutex;
+	pthread_cond_t _dataAvailable;
+	pthread_cond_t _spaceAvailable;
+	pthread_t _thread;
+	bool _threadRunning;
+
+	// Shared state, protected by _mutex.
+	bool _filled[2];
+	uint32 _fillSize[2];
+	bool _srcEos;  ///< the worker has hit EOS on the parent and exited
+	bool _srcErr;
+	bool _quit;
+
+	// Consumer side only.
+	int _current;      ///< buffer being drained
+	uint32 _curSize;   ///< its fill size, copied out under the mutex
+	uint32 _pos;
+	bool _haveBuffer;  ///< whether _current is checked out for draining
+	bool _eos;
+	bool _err;
+
+	static void *workerMain(void *stream);
+
+public:
+	PrefetchingReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream);
+	~PrefetchingReadStream() override;
+
+	bool eos() const override { return _eos; }
+	bool err() const override { return _err; }
+	void clearErr() override { _eos = false; _err = false; }
+
+	uint32 read(void *dataPtr, uint32 dataSize) override;
+};
+
+void *PrefetchingReadStream::workerMain(void *stream) {
+	PrefetchingReadStream *self = (PrefetchingReadStream *)stream;
+	int next = 0;
+
+	pthread_mutex_lock(&self->_mutex);
+	for (;;) {
+		while (!self->_quit && self->_filled[next])
+			pthread_cond_wait(&self->_spaceAvailable, &self->_mutex);
+		if (self->_quit)
+			break;
+
+		// The consumer never touches an unfilled buffer, so the actual
+		// (possibly slow) read can run without the lock held.
+		pthread_mutex_unlock(&self->_mutex);
+		const uint32 n = self->_parentStream->read(self->_buf[next], self->_bufSize);
+		pthread_mutex_lock(&self->_mutex);
+
+		self->_fillSize[next] = n;
+		self->_filled[next] = true;
+		if (self->_parentStream->err())
+			self->_srcErr = true;
+		// Stop once the parent is exhausted. An empty read without the
+		// EOS flag would just spin, so treat it as the end as well.
+		if (self->_parentStream->eos() || n == 0) {
+			self->_srcEos = true;
+			pthread_cond_broadcast(&self->_dataAvailable);
+			break;
+		}
+		pthread_cond_broadcast(&self->_dataAvailable);
+		next ^= 1;
+	}
+	pthread_mutex_unlock(&self->_mutex);
+	return nullptr;
+}
+
+PrefetchingReadStream::PrefetchingReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream)
+	: _parentStream(parentStream, disposeParentStream),
+	_bufSize(bufSize),
+	_threadRunning(false),
+	_srcEos(false),
+	_srcErr(false),
+	_quit(false),
+	_current(0),
+	_curSize(0),
+	_pos(0),
+	_haveBuffer(false),
+	_eos(false),
+	_err(false) {
+
+	assert(parentStream);
+	_buf[0] = new byte[bufSize];
+	_buf[1] = new byte[bufSize];
+	_filled[0] = _filled[1] = false;
+	_fillSize[0] = _fillSize[1] = 0;
+
+	pthread_mutex_init(&_mutex, nullptr);
+	pthread_cond_init(&_dataAvailable, nullptr);
+	pthread_cond_init(&_spaceAvailable, nullptr);
+
+	if (pthread_create(&_thread, nullptr, workerMain, this) == 0)
+		_threadRunning = true;
+}
+
+PrefetchingReadStream::~PrefetchingReadStream() {
+	if (_threadRunning) {
+		pthread_mutex_lock(&_mutex);
+		_quit = true;
+		pthread_cond_broadcast(&_spaceAvailable);
+		pthread_mutex_unlock(&_mutex);
+		pthread_join(_thread, nullptr);
+	}
+
+	pthread_mutex_destroy(&_mutex);
+	pthread_cond_destroy(&_dataAvailable);
+	pthread_cond_destroy(&_spaceAvailable);
+	delete[] _buf[0];
+	delete[] _buf[1];
+}
+
+uint32 PrefetchingReadStream::read(void *dataPtr, uint32 dataSize) {
+	if (!_threadRunning) {
+		// The thread could not be started; read through directly.
+		const uint32 n = _parentStream->read(dataPtr, dataSize);
+		_eos = _parentStream->eos();
+		_err = _parentStream->err();
+		return n;
+	}
+
+	byte *dst = (byte *)dataPtr;
+	uint32 total = 0;
+
+	while (dataSize > 0) {
+		if (_haveBuffer && _pos < _curSize) {
+			const uint32 n = MIN(dataSize, _curSize - _pos);
+			memcpy(dst, _buf[_current] + _pos, n);
+			_pos += n;
+			dst += n;
+			dataSize -= n;
+			total += n;
+			continue;
+		}
+
+		// The current buffer is drained (or we have none yet); hand it
+		// back to the worker and wait for the next one.
+		pthread_mutex_lock(&_mutex);
+		if (_haveBuffer) {
+			_filled[_current] = false;
+			pthread_cond_broadcast(&_spaceAvailable);
+			_current ^= 1;
+			_haveBuffer = false;
+		}
+		while (!_filled[_current] && !_srcEos)
+			pthread_cond_wait(&_dataAvailable, &_mutex);
+		if (_filled[_current]) {
+			_curSize = _fillSize[_current];
+			_pos = 0;
+			_haveBuffer = true;
+		} else {
+			// The worker hit EOS and everything buffered is consumed.
+			_eos = true;
+		}
+		if (_srcErr)
+			_err = true;
+		pthread_mutex_unlock(&_mutex);
+
+		if (_eos)
+			break;
+	}
+
+	return total;
+}
+
+} // End of anonymous namespace
+
+#endif // BUFFEREDSTREAM_USE_PTHREADS
+
+ReadStream *wrapBufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream, bool prefetch) {
+	if (!parentStream)
+		return nullptr;
+
+#ifdef BUFFEREDSTREAM_USE_PTHREADS
+	if (prefetch)
+		return new PrefetchingReadStream(parentStream, bufSize, disposeParentStream);
+#endif
+	// Without thread support the plain buffered wrapper is the best we
+	// can do.
+	return wrapBufferedReadStream(parentStream, bufSize, disposeParentStream);
+}
+
+} // End of namespace Common
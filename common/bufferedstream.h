@@ -51,6 +51,26 @@ namespace Common {
  */
 ReadStream *wrapBufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream);
 
+/**
+ * Like the plain wrapBufferedReadStream(), but when prefetch is true the
+ * wrapper double-buffers: while the caller drains one buffer of bufSize
+ * bytes, a background thread already fills the second one from the
+ * wrapped stream. This hides the latency of slow media (network mounts,
+ * optical drives) from streaming consumers such as audio and video
+ * decoders.
+ *
+ * The wrapped stream is read exclusively by the prefetch thread and must
+ * not be touched by the caller for the lifetime of the wrapper. The
+ * returned stream is not seekable. On platforms without thread support
+ * this degrades to the plain buffered wrapper.
+ *
+ * @param parentStream        The ReadStream to wrap in a custom stream.
+ * @param bufSize             Size of each of the two buffers.
+ * @param disposeParentStream Flag indicating whether to dispose of the wrapped stream.
+ * @param prefetch            If true, fill the buffers from a background thread.
+ */
+ReadStream *wrapBufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream, bool prefetch);
+
 /**
  * Take an arbitrary SeekableReadStream and wrap it in a custom stream that
  * transparently provides buffering.
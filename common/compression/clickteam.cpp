@@ -221,6 +221,11 @@ void applyClickteamPatch(Common::WriteStream *outStream, Common::SeekableReadStr
 			 Common::SeekableReadStream *patchStream, Common::SeekableReadStream *literalsStream) {
 	uint32 referenceBaseOffset = 0;
 
+	// Reused for both literal runs (at most 32 bytes) and reference runs
+	// (copied in chunks); allocating per patch operation dominated the
+	// patching time.
+	byte buf[0x1000];
+
 	while (!patchStream->eos() && !outStream->err()) {
                 uint32 referenceReadSize = 0;
 		byte patchByte = patchStream->readByte();
@@ -230,10 +235,8 @@ void applyClickteamPatch(Common::WriteStream *outStream, Common::SeekableReadStr
 				litteralReadSize = ((patchByte & 0x1f) + 1);
 			else
 				referenceReadSize = (patchByte & 0x1f) + 2;
-			byte *buf = new byte[litteralReadSize]; // optimize this
 			literalsStream->read(buf, litteralReadSize);
-			outStream->write(buf,litteralReadSize);
-			delete[] buf;
+			outStream->write(buf, litteralReadSize);
                 } else if (patchByte == 0)
 			referenceReadSize = patchStream->readUint16LE() + 0x81;
                 else
@@ -254,16 +257,25 @@ void applyClickteamPatch(Common::WriteStream *outStream, Common::SeekableReadStr
 			} else
 				referenceOffsetDelta = signExtendAndOffset(((patchByte & 0x7f) << 8) | patchStream->readByte(), 14, 0x20);
 			uint32 referenseOffset = referenceOffsetDelta + referenceBaseOffset;
-			byte *buf = new byte[referenceReadSize]; // optimize this
+			// TODO: Handle zero-out blocks. We never encountered any so far
 			if (referenseOffset < refStream->size()) {
 				refStream->seek(referenseOffset);
-				refStream->read(buf, referenceReadSize);
+				for (uint32 left = referenceReadSize; left > 0; ) {
+					uint32 chunk = MIN<uint32>(left, sizeof(buf));
+					uint32 actual = refStream->read(buf, chunk);
+					if (actual < chunk)
+						memset(buf + actual, 0, chunk - actual);
+					outStream->write(buf, chunk);
+					left -= chunk;
+				}
 			} else {
-				memset(buf, 0, referenceReadSize);
+				memset(buf, 0, MIN<uint32>(referenceReadSize, sizeof(buf)));
+				for (uint32 left = referenceReadSize; left > 0; ) {
+					uint32 chunk = MIN<uint32>(left, sizeof(buf));
+					outStream->write(buf, chunk);
+					left -= chunk;
+				}
 			}
-			// TODO: Handle zero-out blocks. We never encountered any so far
-			outStream->write(buf, referenceReadSize);
-			delete[] buf;
 			referenceBaseOffset += referenceOffsetDelta + referenceReadSize;
                 }
 	}
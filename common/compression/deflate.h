@@ -177,8 +177,13 @@ SeekableReadStream *wrapClickteamReadStream(SeekableReadStream *toBeWrapped,
  *
  * It is safe to call this with a NULL parameter (in this case, NULL is
  * returned).
+ *
+ * @param level	zlib compression level (0-9, or -1 for zlib's default).
+ *		Lower levels compress considerably faster at a modest size
+ *		cost; the output stays a regular gzip stream either way, so
+ *		readers are unaffected by the choice.
  */
-WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped);
+WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped, int level = -1);
 
 /** @} */
 
@@ -24,8 +24,8 @@
 #ifndef COMMON_HUFFMAN_H
 #define COMMON_HUFFMAN_H
 
+#include "common/algorithm.h"
 #include "common/array.h"
-#include "common/list.h"
 #include "common/types.h"
 
 namespace Common {
@@ -76,13 +76,17 @@ private:
 		uint32 code;
 		uint32 symbol;
 
+		Symbol() : code(0), symbol(0) {}
 		Symbol(uint32 c, uint32 s) : code(c), symbol(s) {}
+
+		bool operator<(const Symbol &right) const { return code < right.code; }
 	};
 
-	typedef List<Symbol> CodeList;
+	typedef Array<Symbol> CodeList;
 	typedef Array<CodeList> CodeLists;
 
-	/** Lists of codes and their symbols, sorted by code length. */
+	/** Codes and their symbols, grouped by code length and sorted by code
+	 *  so that the decode path can binary search them. */
 	CodeLists _codes;
 
 	/** Prefix lookup table used to speed up the decoding of short codes. */
@@ -141,6 +145,10 @@ Huffman<BITSTREAM>::Huffman(uint8 maxLength, uint32 codeCount, const uint32 *cod
 			_codes[lengths[i] - 1 - _prefixTableBits].push_back(Symbol(codes[i], symbol));
 		}
 	}
+
+	// Sort each length's codes so getSymbol() can binary search them.
+	for (uint32 i = 0; i < _codes.size(); i++)
+		sort(_codes[i].begin(), _codes[i].end());
 }
 
 template <class BITSTREAM>
@@ -158,9 +166,18 @@ uint32 Huffman<BITSTREAM>::getSymbol(BITSTREAM &bits) const {
 		for (uint32 i = 0; i < _codes.size(); i++) {
 			bits.addBit(code, i + _prefixTableBits);
 
-			for (typename CodeList::const_iterator cCode = _codes[i].begin(); cCode != _codes[i].end(); ++cCode)
-				if (code == cCode->code)
-					return cCode->symbol;
+			const CodeList &codes = _codes[i];
+			uint32 lo = 0, hi = codes.size();
+			while (lo < hi) {
+				uint32 mid = (lo + hi) / 2;
+				if (codes[mid].code < code)
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+
+			if (lo < codes.size() && codes[lo].code == code)
+				return codes[lo].symbol;
 		}
 	}
 
@@ -51,6 +51,7 @@
 #include "common/ptr.h"
 #include "common/compression/deflate.h"
 #include "common/file.h"
+#include "common/bufferedstream.h"
 
 namespace Common {
 
@@ -95,6 +96,7 @@ public:
 	int listMembers(ArchiveMemberList &list) const override;
 	const ArchiveMemberPtr getMember(const Path &path) const override;
 	SeekableReadStream *createReadStreamForMember(const Path &path) const override;
+	void setAccessPattern(AccessPattern pattern) override;
 
 private:
 	enum Flags { kSplit = 1, kObfuscated = 2, kCompressed = 4, kInvalid = 8 };
@@ -133,9 +135,20 @@ private:
 
 	Path getHeaderName() const;
 	Path getVolumeName(uint volume) const;
+
+	SeekableReadStream *openVolume(uint volume) const;
+	void closeVolume() const;
+
+	// The currently open volume, kept between members while a sequential
+	// scan is announced so consecutive members do not reopen the file.
+	mutable ScopedPtr<SeekableReadStream> _volumeStream;
+	mutable int _volumeNum;
 };
 
-InstallShieldCabinet::InstallShieldCabinet() : _version(0), _archive(nullptr) {
+// Readahead window used while a sequential scan is announced
+static const uint32 kVolumeReadaheadSize = 64 * 1024;
+
+InstallShieldCabinet::InstallShieldCabinet() : _version(0), _archive(nullptr), _volumeNum(-1) {
 }
 
 bool InstallShieldCabinet::open(const Path *baseName, Common::Archive *archive, const FSNode *node) {
@@ -330,6 +343,49 @@ void InstallShieldCabinet::close() {
 	_map.clear();
 	_volumeHeaders.clear();
 	_version = 0;
+	closeVolume();
+}
+
+void InstallShieldCabinet::setAccessPattern(AccessPattern pattern) {
+	Archive::setAccessPattern(pattern);
+	if (pattern != kAccessPatternSequential)
+		closeVolume();
+}
+
+SeekableReadStream *InstallShieldCabinet::openVolume(uint volume) const {
+	if (_volumeStream && _volumeNum == (int)volume)
+		return _volumeStream.get();
+
+	closeVolume();
+
+	SeekableReadStream *stream = nullptr;
+	if (_archive) {
+		stream = _archive->createReadStreamForMember(getVolumeName(volume));
+	} else {
+		Common::File *file = new Common::File();
+		if (file->open(Common::FSNode(getVolumeName(volume))))
+			stream = file;
+		else
+			delete file;
+	}
+
+	if (!stream)
+		return nullptr;
+
+	// During sequential scans the volume stays open across members and
+	// reads go through a readahead buffer, so the data of the following
+	// members comes out of one large read.
+	if (getAccessPattern() == kAccessPatternSequential)
+		stream = wrapBufferedSeekableReadStream(stream, kVolumeReadaheadSize, DisposeAfterUse::YES);
+
+	_volumeStream.reset(stream);
+	_volumeNum = volume;
+	return stream;
+}
+
+void InstallShieldCabinet::closeVolume() const {
+	_volumeStream.reset();
+	_volumeNum = -1;
 }
 
 bool InstallShieldCabinet::hasFile(const Path &path) const {
@@ -358,15 +414,7 @@ SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &
 		return nullptr;
 	}
 
-	ScopedPtr<SeekableReadStream> stream;
-	if (_archive) {
-		stream.reset(_archive->createReadStreamForMember(getVolumeName((entry.volume))));
-	} else {
-		stream.reset(new Common::File());
-		if (!((Common::File *)stream.get())->open(Common::FSNode(getVolumeName((entry.volume))))) {
-			stream.reset(nullptr);
-		}
-	}
+	SeekableReadStream *stream = openVolume(entry.volume);
 
 	if (!stream) {
 		warning("Failed to open volume for file '%s'", path.toString().c_str());
@@ -387,15 +435,9 @@ SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &
 
 		// Then, iterate through the next volumes until we've read all the data for the file
 		while (bytesRead < entry.compressedSize) {
-			if (_archive) {
-				stream.reset(_archive->createReadStreamForMember(getVolumeName((++volume))));
-			} else {
-				if (!((Common::File *)stream.get())->open(Common::FSNode(getVolumeName((++volume))))) {
-					stream.reset(nullptr);
-				}
-			}
-			
-			if (!stream.get()) {
+			stream = openVolume(++volume);
+
+			if (!stream) {
 				warning("Failed to read split file %s", path.toString().c_str());
 				free(src);
 				return nullptr;
@@ -409,12 +451,22 @@ SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &
 	// Uncompressed file
 	if (!(entry.flags & kCompressed)) {
 		if (src == nullptr) {
-			// File not split, return a substream
-			return new SeekableSubReadStream(stream.release(), entry.offset, entry.offset + entry.uncompressedSize, DisposeAfterUse::YES);
+			if (getAccessPattern() == kAccessPatternSequential) {
+				// Copy the data out so the cached volume stream stays
+				// available for the next member
+				src = (byte *)malloc(entry.uncompressedSize);
+				stream->seek(entry.offset);
+				stream->read(src, entry.uncompressedSize);
+				return new MemoryReadStream(src, entry.uncompressedSize, DisposeAfterUse::YES);
+			}
+			// File not split, return a substream owning the volume stream
+			SeekableReadStream *volumeStream = _volumeStream.release();
+			_volumeNum = -1;
+			return new SeekableSubReadStream(volumeStream, entry.offset, entry.offset + entry.uncompressedSize, DisposeAfterUse::YES);
 		} else {
 			// File split, return the assembled data
 			return new MemoryReadStream(src, entry.uncompressedSize, DisposeAfterUse::YES);
-		}		
+		}
 	}
 
 	byte *dst = (byte *)malloc(entry.uncompressedSize);
@@ -425,6 +477,10 @@ SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &
 		stream->read(src, entry.compressedSize);
 	}
 
+	// Outside a sequential scan, do not keep the volume open
+	if (getAccessPattern() != kAccessPatternSequential)
+		closeVolume();
+
 	// Entries with size 0 are valid, and do not need to be inflated
 	if (entry.compressedSize != 0) {
 		if (!inflateZlibInstallShield(dst, entry.uncompressedSize, src, entry.compressedSize)) {
@@ -95,10 +95,23 @@ typedef Byte Bytef;
 #include "common/compression/deflate.h"
 #include "common/compression/unzip.h"
 #include "common/memstream.h"
+#include "common/bufferedstream.h"
 
 #include "common/hashmap.h"
 #include "common/hash-str.h"
 
+#if defined(POSIX)
+// Memory-mapped reading of ZIP archives. The mapping is used both for
+// parsing the central directory (no seek/read round trips) and for
+// serving stored (uncompressed) members as zero-copy stream views.
+#define SCUMMVM_ZIP_MMAP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #if defined(STRICTUNZIP) || defined(STRICTZIPUNZIP)
 /* like the STRICT of WIN32, we define a pointer that cannot be converted
     from (void *) without cast */
@@ -280,6 +293,9 @@ int unzGetLocalExtrafield(unzFile file, voidp buf, unsigned len);
 #define UNZ_BUFSIZE (16384)
 #endif
 
+// Readahead window used while a sequential scan is announced
+#define ZIP_READAHEAD_BUFFER_SIZE (64 * 1024)
+
 #ifndef UNZ_MAXFILENAMEINZIP
 #define UNZ_MAXFILENAMEINZIP (256)
 #endif
@@ -1027,16 +1043,72 @@ Common::SharedArchiveContents unzOpenCurrentFile (unzFile file
 
 namespace Common {
 
+#ifdef SCUMMVM_ZIP_MMAP
+
+/**
+ * A read-only memory mapping of a whole ZIP file. Owned by the
+ * ZipArchive, which keeps it alive for as long as streams handed out
+ * by the archive may reference the mapped bytes.
+ */
+class MappedZipFile {
+public:
+	static MappedZipFile *open(const String &nativePath) {
+		int fd = ::open(nativePath.c_str(), O_RDONLY);
+		if (fd < 0)
+			return nullptr;
+
+		struct stat st;
+		// The ZIP format (without ZIP64) and our offset arithmetic are
+		// both 32 bit, so map only archives that fit.
+		if (fstat(fd, &st) != 0 || st.st_size <= 0 || (uint64)st.st_size > 0xFFFFFFFFu) {
+			::close(fd);
+			return nullptr;
+		}
+
+		void *addr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (addr == MAP_FAILED)
+			return nullptr;
+
+		return new MappedZipFile((const byte *)addr, (uint32)st.st_size);
+	}
+
+	~MappedZipFile() {
+		munmap(const_cast<byte *>(_data), _size);
+	}
+
+	const byte *data() const { return _data; }
+	uint32 size() const { return _size; }
+
+private:
+	MappedZipFile(const byte *data, uint32 size) : _data(data), _size(size) {}
+
+	const byte *_data;
+	uint32 _size;
+};
+
+#endif // SCUMMVM_ZIP_MMAP
+
 
 class ZipArchive : public MemcachingCaseInsensitiveArchive {
 	unzFile _zipFile;
 #ifndef USE_ZLIB
 	Common::CRC32 _crc;
+#endif
+#ifdef SCUMMVM_ZIP_MMAP
+	MappedZipFile *_mapping;
 #endif
 	bool _flattenTree;
 
+	// The container stream before it was wrapped for readahead, or null
+	// while no sequential scan is announced. See setAccessPattern().
+	Common::SeekableReadStream *_unbufferedStream;
+
 public:
 	ZipArchive(unzFile zipFile, bool flattenTree);
+#ifdef SCUMMVM_ZIP_MMAP
+	ZipArchive(unzFile zipFile, bool flattenTree, MappedZipFile *mapping);
+#endif
 
 
 	~ZipArchive();
@@ -1049,6 +1121,7 @@ public:
 	Common::Path translatePath(const Common::Path &path) const override {
 		return _flattenTree ? path.getLastComponent() : path;
 	}
+	void setAccessPattern(AccessPattern pattern) override;
 };
 
 /*
@@ -1069,12 +1142,52 @@ public:
 };
 */
 
-ZipArchive::ZipArchive(unzFile zipFile, bool flattenTree) : _zipFile(zipFile), _flattenTree(flattenTree) {
+ZipArchive::ZipArchive(unzFile zipFile, bool flattenTree) : _zipFile(zipFile),
+#ifdef SCUMMVM_ZIP_MMAP
+	_mapping(nullptr),
+#endif
+	_flattenTree(flattenTree), _unbufferedStream(nullptr) {
+	assert(_zipFile);
+}
+
+#ifdef SCUMMVM_ZIP_MMAP
+ZipArchive::ZipArchive(unzFile zipFile, bool flattenTree, MappedZipFile *mapping) :
+	_zipFile(zipFile), _mapping(mapping), _flattenTree(flattenTree), _unbufferedStream(nullptr) {
 	assert(_zipFile);
 }
+#endif
 
 ZipArchive::~ZipArchive() {
+	setAccessPattern(kAccessPatternRandom);
 	unzClose(_zipFile);
+#ifdef SCUMMVM_ZIP_MMAP
+	delete _mapping;
+#endif
+}
+
+void ZipArchive::setAccessPattern(AccessPattern pattern) {
+	Archive::setAccessPattern(pattern);
+
+#ifdef SCUMMVM_ZIP_MMAP
+	// The container is memory-backed already, nothing to read ahead.
+	if (_mapping)
+		return;
+#endif
+
+	unz_s *s = (unz_s *)_zipFile;
+	if (pattern == kAccessPatternSequential && !_unbufferedStream) {
+		// Route the container through a readahead buffer: the per-member
+		// header reads and the contents of members smaller than the
+		// buffer are then served from one large read each, instead of a
+		// seek and several small reads per member.
+		_unbufferedStream = s->_stream;
+		s->_stream = Common::wrapBufferedSeekableReadStream(_unbufferedStream,
+				ZIP_READAHEAD_BUFFER_SIZE, DisposeAfterUse::NO);
+	} else if (pattern == kAccessPatternRandom && _unbufferedStream) {
+		delete s->_stream;
+		s->_stream = _unbufferedStream;
+		_unbufferedStream = nullptr;
+	}
 }
 
 bool ZipArchive::hasFile(const Path &path) const {
@@ -1114,6 +1227,33 @@ const ArchiveMemberPtr ZipArchive::getMember(const Path &path) const {
 Common::SharedArchiveContents ZipArchive::readContentsForPath(const Common::Path &path) const {
 	if (unzLocateFile(_zipFile, path, 2) != UNZ_OK)
 		return Common::SharedArchiveContents();
+
+#ifdef SCUMMVM_ZIP_MMAP
+	// Stored (uncompressed) members of a mapped archive are served as
+	// views straight into the mapping: no allocation, no copy, and no
+	// cache churn. The data is exactly the on-disk bytes, so the CRC
+	// check that guards decompression is of no extra value here.
+	if (_mapping) {
+		unz_s *s = (unz_s *)_zipFile;
+		if (s->cur_file_info.compression_method == 0) {
+			uInt iSizeVar;
+			uLong offset_local_extrafield;
+			uInt size_local_extrafield;
+
+			if (unzlocal_CheckCurrentFileCoherencyHeader(s, &iSizeVar,
+						&offset_local_extrafield, &size_local_extrafield) == UNZ_OK) {
+				uLong dataOffset = s->cur_file_info_internal.offset_curfile +
+					SIZEZIPLOCALHEADER + iSizeVar + s->byte_before_the_zipfile;
+
+				if (dataOffset + s->cur_file_info.uncompressed_size <= _mapping->size())
+					return Common::SharedArchiveContents::bypass(
+						new Common::MemoryReadStream(_mapping->data() + dataOffset,
+							s->cur_file_info.uncompressed_size));
+			}
+		}
+	}
+#endif
+
 #ifndef USE_ZLIB
 	return unzOpenCurrentFile(_zipFile, _crc);
 #else
@@ -1126,6 +1266,23 @@ Archive *makeZipArchive(const Path &name, bool flattenTree) {
 }
 
 Archive *makeZipArchive(const FSNode &node, bool flattenTree) {
+#ifdef SCUMMVM_ZIP_MMAP
+	// Map the archive if the OS lets us: the central directory is then
+	// parsed from memory and stored members become zero-copy views.
+	// Falls through to the stream path for anything that cannot be
+	// mapped (virtual nodes, oversized archives, ...).
+	MappedZipFile *mapping = MappedZipFile::open(node.getPath().toString('/'));
+	if (mapping) {
+		SeekableReadStream *stream = new MemoryReadStream(mapping->data(), mapping->size());
+		unzFile zipFile = unzOpen(stream, flattenTree);
+		if (!zipFile) {
+			// stream gets deleted by unzOpen() on failure.
+			delete mapping;
+			return nullptr;
+		}
+		return new ZipArchive(zipFile, flattenTree, mapping);
+	}
+#endif
 	return makeZipArchive(node.createReadStream(), flattenTree);
 }
 
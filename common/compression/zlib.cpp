@@ -308,15 +308,16 @@ protected:
 	}
 
 public:
-	GZipWriteStream(WriteStream *w) : _wrapped(w), _stream(), _pos(0) {
+	GZipWriteStream(WriteStream *w, int level = Z_DEFAULT_COMPRESSION) : _wrapped(w), _stream(), _pos(0) {
 		assert(w != nullptr);
+		assert(level >= Z_DEFAULT_COMPRESSION && level <= Z_BEST_COMPRESSION);
 
 		// Adding 16 to windowBits indicates to zlib that it is supposed to
 		// write gzip headers. This feature was added in zlib 1.2.0.4,
 		// released 10 August 2003.
 		// Note: This is *crucial* for savegame compatibility, do *not* remove!
 		_zlibErr = deflateInit2(&_stream,
-		                 Z_DEFAULT_COMPRESSION,
+		                 level,
 		                 Z_DEFLATED,
 		                 MAX_WBITS + 16,
 		                 8,
@@ -422,10 +423,10 @@ SeekableReadStream *wrapDeflateReadStream(SeekableReadStream *toBeWrapped, Dispo
 	return new GZipReadStream(toBeWrapped, disposeParent, knownSize, dict, dictLen);
 }
 
-WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped) {
+WriteStream *wrapCompressedWriteStream(WriteStream *toBeWrapped, int level) {
 	if (!toBeWrapped)
 		return nullptr;
-	return new GZipWriteStream(toBeWrapped);
+	return new GZipWriteStream(toBeWrapped, level);
 }
 
 } // End of namespace Common
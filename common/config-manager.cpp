@@ -23,8 +23,11 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/memstream.h"
+#include "common/profiler.h"
 #include "common/system.h"
 #include "common/textconsole.h"
+#include "common/util.h"
 
 static bool isValidDomainName(const Common::String &domName) {
 	const char *p = domName.c_str();
@@ -104,6 +107,7 @@ bool ConfigManager::loadDefaultConfigFile(const Path &fallbackFilename) {
 }
 
 bool ConfigManager::loadConfigFile(const Path &filename, const Path &fallbackFilename) {
+	IoTagScope ioTag("config");
 	_filename = filename;
 
 	FSNode node(filename);
@@ -233,7 +237,7 @@ bool ConfigManager::loadFromStream(SeekableReadStream &stream) {
 
 			domainName = String(line.c_str() + 1, p);
 
-			domain.setDomainComment(comment);
+			domain.setDomainComment(Common::move(comment));
 			comment.clear();
 
 		} else {
@@ -270,11 +274,13 @@ bool ConfigManager::loadFromStream(SeekableReadStream &stream) {
 			value.trim();
 
 			// Finally, store the key/value pair in the active domain
-			domain.setVal(key, value);
+			domain.setVal(key, Common::move(value));
 
 			// Store comment
-			domain.setKVComment(key, comment);
-			comment.clear();
+			if (!comment.empty()) {
+				domain.setKVComment(key, Common::move(comment));
+				comment.clear();
+			}
 		}
 	}
 
@@ -285,6 +291,7 @@ bool ConfigManager::loadFromStream(SeekableReadStream &stream) {
 
 void ConfigManager::flushToDisk() {
 #ifndef __DC__
+	IoTagScope ioTag("config");
 	WriteStream *stream;
 
 	if (_filename.empty()) {
@@ -306,36 +313,48 @@ void ConfigManager::flushToDisk() {
 		stream = dump;
 	}
 
+	// Assemble the whole file in memory first, so the backend stream gets
+	// one large write instead of a few small ones per key. With thousands
+	// of game domains this is the largest write ScummVM does in normal
+	// operation, and some backend config streams are unbuffered.
+	MemoryWriteStreamDynamic buffer(DisposeAfterUse::YES);
+
 	// Write the application domain
-	writeDomain(*stream, kApplicationDomain, _appDomain);
+	writeDomain(buffer, kApplicationDomain, _appDomain);
 
 	// Write the keymapper domain
-	writeDomain(*stream, kKeymapperDomain, _keymapperDomain);
+	writeDomain(buffer, kKeymapperDomain, _keymapperDomain);
 #ifdef USE_CLOUD
 	// Write the cloud domain
-	writeDomain(*stream, kCloudDomain, _cloudDomain);
+	writeDomain(buffer, kCloudDomain, _cloudDomain);
 #endif
 
 	// Write the miscellaneous domains next
 	for (const auto &misc : _miscDomains) {
-		writeDomain(*stream, misc._key, misc._value);
+		writeDomain(buffer, misc._key, misc._value);
 	}
 
 	// First write the domains in _domainSaveOrder, in that order.
 	// Note: It's possible for _domainSaveOrder to list domains which
 	// are not present anymore, so we validate each name.
+	// Also build a hash set of the ordered names, so the loop over all
+	// game domains below does not degrade to a linear scan per domain.
+	HashMap<String, bool, IgnoreCase_Hash, IgnoreCase_EqualTo> orderedNames;
 	for (const auto &domain : _domainSaveOrder) {
 		if (_gameDomains.contains(domain)) {
-			writeDomain(*stream, domain, _gameDomains[domain]);
+			writeDomain(buffer, domain, _gameDomains[domain]);
 		}
+		orderedNames[domain] = true;
 	}
 
 	// Now write the domains which haven't been written yet
 	for (auto &domain : _gameDomains) {
-		if (find(_domainSaveOrder.begin(), _domainSaveOrder.end(), domain._key) == _domainSaveOrder.end())
-			writeDomain(*stream, domain._key, domain._value);
+		if (!orderedNames.contains(domain._key))
+			writeDomain(buffer, domain._key, domain._value);
 	}
 
+	stream->write(buffer.getData(), buffer.size());
+
 	delete stream;
 
 #endif // !__DC__
@@ -808,6 +827,9 @@ bool ConfigManager::isKeyTemporary(const String &key) const {
 void ConfigManager::Domain::setDomainComment(const String &comment) {
 	_domainComment = comment;
 }
+void ConfigManager::Domain::setDomainComment(String &&comment) {
+	_domainComment = Common::move(comment);
+}
 const String &ConfigManager::Domain::getDomainComment() const {
 	return _domainComment;
 }
@@ -815,6 +837,9 @@ const String &ConfigManager::Domain::getDomainComment() const {
 void ConfigManager::Domain::setKVComment(const String &key, const String &comment) {
 	_keyValueComments[key] = comment;
 }
+void ConfigManager::Domain::setKVComment(const String &key, String &&comment) {
+	_keyValueComments.setVal(key, Common::move(comment));
+}
 const String &ConfigManager::Domain::getKVComment(const String &key) const {
 	return _keyValueComments[key];
 }
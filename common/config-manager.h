@@ -97,9 +97,11 @@ public:
 		void           erase(const String &key) { _entries.erase(key); } /*!< Remove a key from the domain. */
 
 		void           setDomainComment(const String &comment); /*!< Add a @p comment for this configuration domain. */
+		void           setDomainComment(String &&comment); /*!< @overload */
 		const String  &getDomainComment() const; /*!< Retrieve the comment of this configuration domain. */
 
 		void           setKVComment(const String &key, const String &comment); /*!< Add a key-value @p comment to a @p key. */
+		void           setKVComment(const String &key, String &&comment); /*!< @overload */
 		const String  &getKVComment(const String &key) const; /*!< Retrieve the key-value comment of a @p key. */
 		bool           hasKVComment(const String &key) const; /*!< Check whether a @p key has a key-value comment. */
 	};
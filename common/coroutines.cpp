@@ -163,6 +163,7 @@ void CoroutineScheduler::reset() {
 
 	// no active processes
 	pCurrent = active->pNext = nullptr;
+	_processIndex.clear();
 
 	// place first process on free list
 	pFreeProcesses = processList;
@@ -534,6 +535,11 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 	// set new process id
 	pProc->pid = pid;
 
+	// index the process by pid; with duplicated pids the existing
+	// entry is just as good, so keep it
+	if (!_processIndex.contains(pid))
+		_processIndex[pid] = pProc;
+
 	// set new process specific info
 	if (sizeParam) {
 		assert(sizeParam > 0 && sizeParam <= CORO_PARAM_SIZE);
@@ -575,6 +581,8 @@ void CoroutineScheduler::killProcess(PROCESS *pKillProc) {
 	delete pKillProc->state;
 	pKillProc->state = nullptr;
 
+	removeFromProcessIndex(pKillProc);
+
 	// Take the process out of the active chain list
 	pKillProc->pPrevious->pNext = pKillProc->pNext;
 	if (pKillProc->pNext)
@@ -624,6 +632,8 @@ int CoroutineScheduler::killMatchingProcess(uint32 pidKill, int pidMask) {
 				delete pProc->state;
 				pProc->state = nullptr;
 
+				removeFromProcessIndex(pProc);
+
 				// make prev point to next to unlink pProc
 				pPrev->pNext = pProc->pNext;
 				if (pProc->pNext)
@@ -657,21 +667,31 @@ void CoroutineScheduler::setResourceCallback(VFPTRPP pFunc) {
 	pRCfunction = pFunc;
 }
 
-PROCESS *CoroutineScheduler::getProcess(uint32 pid) {
-	PROCESS *pProc = active->pNext;
-	while ((pProc != nullptr) && (pProc->pid != pid))
-		pProc = pProc->pNext;
+void CoroutineScheduler::removeFromProcessIndex(PROCESS *pProc) {
+	ProcessIndexMap::iterator it = _processIndex.find(pProc->pid);
+	if (it == _processIndex.end() || it->_value != pProc)
+		return;
 
-	return pProc;
+	// Another process may share this pid; point the entry at it, if any.
+	// The dying process is still linked here, so skip it in the scan.
+	PROCESS *p = active->pNext;
+	while (p != nullptr && (p == pProc || p->pid != pProc->pid))
+		p = p->pNext;
+
+	if (p)
+		it->_value = p;
+	else
+		_processIndex.erase(it);
 }
 
-EVENT *CoroutineScheduler::getEvent(uint32 pid) {
-	for (auto &event : _events) {
-		if (event->pid == pid)
-			return event;
-	}
+PROCESS *CoroutineScheduler::getProcess(uint32 pid) {
+	ProcessIndexMap::iterator it = _processIndex.find(pid);
+	return it != _processIndex.end() ? it->_value : nullptr;
+}
 
-	return nullptr;
+EVENT *CoroutineScheduler::getEvent(uint32 pid) {
+	EventIndexMap::iterator it = _eventIndex.find(pid);
+	return it != _eventIndex.end() ? it->_value : nullptr;
 }
 
 
@@ -683,6 +703,7 @@ uint32 CoroutineScheduler::createEvent(bool bManualReset, bool bInitialState) {
 	evt->pulsing = false;
 
 	_events.push_back(evt);
+	_eventIndex[evt->pid] = evt;
 	return evt->pid;
 }
 
@@ -690,6 +711,7 @@ void CoroutineScheduler::closeEvent(uint32 pidEvent) {
 	EVENT *evt = getEvent(pidEvent);
 	if (evt) {
 		_events.remove(evt);
+		_eventIndex.erase(evt->pid);
 		delete evt;
 	}
 }
@@ -24,6 +24,7 @@
 
 #include "common/scummsys.h"
 #include "common/util.h"    // for SCUMMVM_CURRENT_FUNCTION
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "common/singleton.h"
 
@@ -364,6 +365,27 @@ private:
 	/** Event list. */
 	Common::List<EVENT *> _events;
 
+	/**
+	 * Index of live processes by pid, so the wait methods do not scan
+	 * the whole active list every cycle for every waiting process.
+	 * Several processes may share a pid; the entry then points at any
+	 * one of them, which is enough for the liveness checks getProcess()
+	 * is used for.
+	 */
+	typedef Common::HashMap<uint32, PROCESS *> ProcessIndexMap;
+	ProcessIndexMap _processIndex;
+
+	/** Index of events by pid. Event pids are unique. */
+	typedef Common::HashMap<uint32, EVENT *> EventIndexMap;
+	EventIndexMap _eventIndex;
+
+	/**
+	 * Drops a process about to be taken off the active list from the
+	 * pid index, repointing its entry at another process sharing the
+	 * pid if one exists.
+	 */
+	void removeFromProcessIndex(PROCESS *pProc);
+
 #ifdef DEBUG
 	/** Diagnostic process counters. */
 	int numProcs;
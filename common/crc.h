@@ -37,6 +37,7 @@
 #ifndef COMMON_CRC_H
 #define COMMON_CRC_H
 
+#include "common/endian.h"
 #include "common/system.h" // For types.
 
 namespace Common {
@@ -69,7 +70,7 @@ public:
 	T finalize(T remainder) const { return remainder ^ _final_xor; }
 
 private:
-  	T _crcTable[256];
+  	T _crcTables[8][256];
 	const T _reflected_init_remainder;
 	const T _final_xor;
 };
@@ -137,8 +138,20 @@ CRCReflected<T>::CRCReflected(T reflected_poly, T reflected_init_remainder, T fi
 		/*
 		 * Store the result into the table.
 		 */
-		_crcTable[dividend] = remainder;
-	}	
+		_crcTables[0][dividend] = remainder;
+	}
+
+	/*
+	 * Derive the slice-by-8 tables: entry [k][b] is the CRC of byte b
+	 * followed by k zero bytes, which lets crcFast() fold eight message
+	 * bytes per step with eight independent lookups.
+	 */
+	for (int slice = 1; slice < 8; ++slice) {
+		for (int dividend = 0; dividend < 256; ++dividend) {
+			T remainder = _crcTables[slice - 1][dividend];
+			_crcTables[slice][dividend] = _crcTables[0][remainder & 0xFF] ^ (remainder >> 8);
+		}
+	}
 }
 
 /*********************************************************************
@@ -186,11 +199,30 @@ T CRCReflected<T>::crcFast(byte const message[], int nBytes) const {
 	T remainder = _reflected_init_remainder;
 
 	/*
-	 * Divide the message by the polynomial, a byte at a time.
+	 * Fold eight message bytes per step through the slice-by-8 tables.
+	 * The result is bit-identical to the byte-at-a-time loop below.
+	 */
+	while (nBytes >= 8) {
+		const uint32 low = READ_LE_UINT32(message) ^ remainder;
+		const uint32 high = READ_LE_UINT32(message + 4);
+		remainder = _crcTables[7][low & 0xFF] ^
+		            _crcTables[6][(low >> 8) & 0xFF] ^
+		            _crcTables[5][(low >> 16) & 0xFF] ^
+		            _crcTables[4][(low >> 24) & 0xFF] ^
+		            _crcTables[3][high & 0xFF] ^
+		            _crcTables[2][(high >> 8) & 0xFF] ^
+		            _crcTables[1][(high >> 16) & 0xFF] ^
+		            _crcTables[0][(high >> 24) & 0xFF];
+		message += 8;
+		nBytes -= 8;
+	}
+
+	/*
+	 * Divide the remaining message bytes by the polynomial, one at a time.
 	 */
 	for (int b = 0; b < nBytes; ++b) {
 		byte data = message[b] ^ remainder;
-		remainder = _crcTable[data] ^ (remainder >> 8);
+		remainder = _crcTables[0][data] ^ (remainder >> 8);
 	}
 
 	/*
@@ -210,7 +242,7 @@ template<typename T>
 T CRCReflected<T>::processByte(byte byteVal, T remainder) const {
 	byte data = byteVal ^ remainder;
 
-	return _crcTable[data] ^ (remainder >> 8);
+	return _crcTables[0][data] ^ (remainder >> 8);
 }
 
 class CRC_CCITT : public CRCNormal<uint16> {
@@ -252,6 +252,21 @@ Common::FSNode DataArchiveProxy::getNode(const Common::Path &name) const {
 
 bool load_engine_data(const Common::Path &datFilename, const Common::String &subfolder, int reqMajorVersion,
 		int reqMinorVersion, Common::U32String &errorMsg, bool useDataPrefix) {
+	// Packs mounted earlier in the session are reused as-is: the zip index
+	// stays parsed and already-read members stay cached, so relaunching an
+	// engine does not locate, open and validate its data file again. The
+	// map deliberately lives for the whole session.
+	static Common::HashMap<Common::String, Common::Archive *> *mountedPacks;
+
+	Common::String packKey = Common::String::format("%s|%s|%d.%d|%d",
+		datFilename.toString().c_str(), subfolder.c_str(),
+		reqMajorVersion, reqMinorVersion, useDataPrefix ? 1 : 0);
+
+	if (mountedPacks && mountedPacks->contains(packKey)) {
+		SearchMan.add("data", (*mountedPacks)[packKey], 0, false);
+		return true;
+	}
+
 	Common::Archive *dataArchive = nullptr;
 	Common::File f;
 
@@ -300,13 +315,21 @@ bool load_engine_data(const Common::Path &datFilename, const Common::String &sub
 	// It was all validated correctly
 	Common::Archive *archive;
 #ifndef RELEASE_BUILD
-	if (!dataArchive)
+	if (!dataArchive) {
+		// The debugging proxy reads straight from the filesystem and is
+		// cheap to recreate, so it is not worth retaining.
 		archive = new DataArchiveProxy(folder, useDataPrefix);
-	else
+		SearchMan.add("data", archive);
+		return true;
+	}
 #endif
-		archive = new DataArchive(dataArchive, Common::Path(subfolder), useDataPrefix);
+	archive = new DataArchive(dataArchive, Common::Path(subfolder), useDataPrefix);
+
+	if (!mountedPacks)
+		mountedPacks = new Common::HashMap<Common::String, Common::Archive *>();
+	(*mountedPacks)[packKey] = archive;
 
-	SearchMan.add("data", archive);
+	SearchMan.add("data", archive, 0, false);
 	return true;
 }
 
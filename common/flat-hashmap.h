@@ -0,0 +1,470 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_FLAT_HASHMAP_H
+#define COMMON_FLAT_HASHMAP_H
+
+#include "common/func.h"
+#include "common/util.h"
+
+// For the Hash/EqualTo specializations and unknownKeyError.
+#include "common/hashmap.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_flat_hashmap Flat hash table (FlatHashMap)
+ * @ingroup common
+ *
+ * @brief API for operations on an open-addressing hash table.
+ *
+ * @{
+ */
+
+/**
+ * FlatHashMap<Key,Val> is an open-addressing alternative to HashMap.
+ *
+ * Instead of allocating a node per entry and chasing a pointer on every
+ * probe, all entries live in one contiguous slot array, with a separate
+ * metadata byte per slot holding a 7-bit fragment of the key's hash.
+ * A lookup therefore scans the (small, cache-resident) metadata array
+ * first and only touches a slot when the hash fragment matches, which
+ * avoids most of the cache misses of the chained design.
+ *
+ * The public API mirrors the subset of HashMap that call sites commonly
+ * use, so a typedef can usually be switched over without code changes.
+ * Erased slots are tombstoned rather than compacted, so - as with
+ * HashMap - erasing through an iterator keeps all other iterators valid.
+ *
+ * The important behavioral difference from HashMap: inserting can
+ * rehash, which moves entries. Do not keep pointers or references to
+ * values inside the map across insertions; store pointers as values
+ * instead if you need stable addresses.
+ */
+template<class Key, class Val, class HashFunc = Hash<Key>, class EqualFunc = EqualTo<Key> >
+class FlatHashMap {
+public:
+	typedef uint size_type;
+
+	struct Node {
+		Val _value;
+		const Key _key;
+		explicit Node(const Key &key) : _key(key), _value() {}
+		Node(const Key &key, const Val &value) : _key(key), _value(value) {}
+	};
+
+private:
+	typedef FlatHashMap<Key, Val, HashFunc, EqualFunc> FHM_t;
+
+	enum {
+		FLAT_HASHMAP_MIN_CAPACITY = 16,
+
+		// Same load factor as HashMap: the table grows once it is
+		// two thirds full (counting tombstones, which also slow
+		// down probing until the next rehash sweeps them away).
+		FLAT_HASHMAP_LOADFACTOR_NUMERATOR = 2,
+		FLAT_HASHMAP_LOADFACTOR_DENOMINATOR = 3,
+
+		FLAT_HASHMAP_PERTURB_SHIFT = 5
+	};
+
+	// Metadata byte values. Full slots store the low 7 bits of the
+	// key's hash, so these two markers use the high bit.
+	static const byte kMetaEmpty = 0x80;
+	static const byte kMetaDeleted = 0x81;
+
+	static bool isFull(byte meta) { return (meta & 0x80) == 0; }
+
+	/** Default value, returned by the const getVal. */
+	Val _defaultVal;
+
+	byte *_meta;		///< one metadata byte per slot, _mask + 1 of them
+	Node *_slots;		///< uninitialized slot storage, _mask + 1 entries
+	size_type _mask;	///< capacity minus one; capacity is a power of two
+	size_type _size;
+	size_type _deleted;	///< number of tombstoned slots
+
+	HashFunc _hash;
+	EqualFunc _equal;
+
+	void allocStorage(size_type capacity) {
+		_meta = new byte[capacity];
+		memset(_meta, kMetaEmpty, capacity);
+		_slots = (Node *)(new byte[capacity * sizeof(Node)]);
+		_mask = capacity - 1;
+		_size = 0;
+		_deleted = 0;
+	}
+
+	void freeStorage() {
+		for (size_type i = 0; i <= _mask; ++i) {
+			if (isFull(_meta[i]))
+				_slots[i].~Node();
+		}
+		delete[] _meta;
+		delete[] (byte *)_slots;
+		_meta = nullptr;
+		_slots = nullptr;
+	}
+
+	void assign(const FHM_t &map);
+	size_type lookup(const Key &key) const;
+	size_type lookupAndCreateIfMissing(const Key &key);
+	void expandStorage(size_type newCapacity);
+
+	template<class T> friend class FlatIteratorImpl;
+
+	/**
+	 * Simple FlatHashMap iterator implementation.
+	 */
+	template<class NodeType>
+	class FlatIteratorImpl {
+		friend class FlatHashMap;
+		template<class T> friend class FlatIteratorImpl;
+	protected:
+		typedef const FlatHashMap hashmap_t;
+
+		size_type _idx;
+		hashmap_t *_hashmap;
+
+	protected:
+		FlatIteratorImpl(size_type idx, hashmap_t *hashmap) : _idx(idx), _hashmap(hashmap) {}
+
+		NodeType *deref() const {
+			assert(_hashmap != nullptr);
+			assert(_idx <= _hashmap->_mask);
+			assert(isFull(_hashmap->_meta[_idx]));
+			return &_hashmap->_slots[_idx];
+		}
+
+	public:
+		FlatIteratorImpl() : _idx(0), _hashmap(nullptr) {}
+		template<class T>
+		FlatIteratorImpl(const FlatIteratorImpl<T> &c) : _idx(c._idx), _hashmap(c._hashmap) {}
+
+		NodeType &operator*() const { return *deref(); }
+		NodeType *operator->() const { return deref(); }
+
+		bool operator==(const FlatIteratorImpl &iter) const { return _idx == iter._idx && _hashmap == iter._hashmap; }
+		bool operator!=(const FlatIteratorImpl &iter) const { return !(*this == iter); }
+
+		FlatIteratorImpl &operator++() {
+			assert(_hashmap);
+			do {
+				_idx++;
+			} while (_idx <= _hashmap->_mask && !isFull(_hashmap->_meta[_idx]));
+			if (_idx > _hashmap->_mask)
+				_idx = (size_type)-1;
+
+			return *this;
+		}
+
+		FlatIteratorImpl operator++(int) {
+			FlatIteratorImpl old = *this;
+			operator ++();
+			return old;
+		}
+	};
+
+public:
+	typedef FlatIteratorImpl<Node> iterator;
+	typedef FlatIteratorImpl<const Node> const_iterator;
+
+	FlatHashMap() : _defaultVal() {
+		allocStorage(FLAT_HASHMAP_MIN_CAPACITY);
+	}
+
+	FlatHashMap(const FHM_t &map) : _defaultVal() {
+		assign(map);
+	}
+
+	~FlatHashMap() {
+		freeStorage();
+	}
+
+	FHM_t &operator=(const FHM_t &map) {
+		if (this == &map)
+			return *this;
+
+		freeStorage();
+		assign(map);
+		return *this;
+	}
+
+	bool contains(const Key &key) const {
+		size_type ctr = lookup(key);
+		return isFull(_meta[ctr]);
+	}
+
+	Val &operator[](const Key &key) {
+		return getOrCreateVal(key);
+	}
+
+	const Val &operator[](const Key &key) const {
+		return getVal(key);
+	}
+
+	Val &getOrCreateVal(const Key &key) {
+		size_type ctr = lookupAndCreateIfMissing(key);
+		return _slots[ctr]._value;
+	}
+
+	Val &getVal(const Key &key) {
+		size_type ctr = lookup(key);
+		if (isFull(_meta[ctr]))
+			return _slots[ctr]._value;
+		else
+			unknownKeyError(key);
+	}
+
+	const Val &getVal(const Key &key) const {
+		return getValOrDefault(key, _defaultVal);
+	}
+
+	const Val &getValOrDefault(const Key &key) const {
+		return getValOrDefault(key, _defaultVal);
+	}
+
+	const Val &getValOrDefault(const Key &key, const Val &defaultVal) const {
+		size_type ctr = lookup(key);
+		if (isFull(_meta[ctr]))
+			return _slots[ctr]._value;
+		else
+			return defaultVal;
+	}
+
+	bool tryGetVal(const Key &key, Val &out) const {
+		size_type ctr = lookup(key);
+		if (isFull(_meta[ctr])) {
+			out = _slots[ctr]._value;
+			return true;
+		} else {
+			return false;
+		}
+	}
+
+	void setVal(const Key &key, const Val &val) {
+		size_type ctr = lookupAndCreateIfMissing(key);
+		_slots[ctr]._value = val;
+	}
+
+	void clear(bool shrinkArray = false) {
+		const size_type capacity = shrinkArray ? (size_type)FLAT_HASHMAP_MIN_CAPACITY : _mask + 1;
+		freeStorage();
+		allocStorage(capacity);
+	}
+
+	void erase(iterator entry) {
+		assert(entry._hashmap == this);
+		const size_type ctr = entry._idx;
+		assert(ctr <= _mask && isFull(_meta[ctr]));
+
+		_slots[ctr].~Node();
+		_meta[ctr] = kMetaDeleted;
+		_size--;
+		_deleted++;
+	}
+
+	void erase(const Key &key) {
+		size_type ctr = lookup(key);
+		if (!isFull(_meta[ctr]))
+			return;
+
+		_slots[ctr].~Node();
+		_meta[ctr] = kMetaDeleted;
+		_size--;
+		_deleted++;
+	}
+
+	size_type size() const { return _size; }
+
+	iterator	begin() {
+		// Find and return the first full slot
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (isFull(_meta[ctr]))
+				return iterator(ctr, this);
+		}
+		return end();
+	}
+	iterator	end() {
+		return iterator((size_type)-1, this);
+	}
+
+	const_iterator	begin() const {
+		// Find and return the first full slot
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (isFull(_meta[ctr]))
+				return const_iterator(ctr, this);
+		}
+		return end();
+	}
+	const_iterator	end() const {
+		return const_iterator((size_type)-1, this);
+	}
+
+	iterator	find(const Key &key) {
+		size_type ctr = lookup(key);
+		if (isFull(_meta[ctr]))
+			return iterator(ctr, this);
+		return end();
+	}
+
+	const_iterator	find(const Key &key) const {
+		size_type ctr = lookup(key);
+		if (isFull(_meta[ctr]))
+			return const_iterator(ctr, this);
+		return end();
+	}
+
+	/** Return true if the hashmap is empty. */
+	bool empty() const {
+		return (_size == 0);
+	}
+};
+
+//-------------------------------------------------------
+// FlatHashMap functions
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::assign(const FHM_t &map) {
+	allocStorage(map._mask + 1);
+
+	// Re-insert every entry instead of mirroring the source's slot layout:
+	// the source may contain tombstones, and copying only the full slots
+	// would sever every probe chain that passes through one. Rehashing
+	// into the fresh table also leaves the copy tombstone-free.
+	for (size_type i = 0; i <= map._mask; ++i) {
+		if (!isFull(map._meta[i]))
+			continue;
+
+		const uint hash = _hash(map._slots[i]._key);
+		size_type ctr = hash & _mask;
+		for (size_type perturb = hash; _meta[ctr] != kMetaEmpty; perturb >>= FLAT_HASHMAP_PERTURB_SHIFT)
+			ctr = (5 * ctr + perturb + 1) & _mask;
+
+		new (&_slots[ctr]) Node(map._slots[i]._key, map._slots[i]._value);
+		_meta[ctr] = hash & 0x7f;
+	}
+	_size = map._size;
+}
+
+/**
+ * Probe for the given key. Returns the index of the slot holding it,
+ * or, if the key is absent, the index of the empty slot that ended
+ * the probe sequence.
+ */
+template<class Key, class Val, class HashFunc, class EqualFunc>
+typename FlatHashMap<Key, Val, HashFunc, EqualFunc>::size_type FlatHashMap<Key, Val, HashFunc, EqualFunc>::lookup(const Key &key) const {
+	const uint hash = _hash(key);
+	const byte fragment = hash & 0x7f;
+	size_type ctr = hash & _mask;
+
+	for (size_type perturb = hash; ; perturb >>= FLAT_HASHMAP_PERTURB_SHIFT) {
+		const byte meta = _meta[ctr];
+		if (meta == kMetaEmpty)
+			break;
+		if (meta == fragment && _equal(_slots[ctr]._key, key))
+			break;
+
+		ctr = (5 * ctr + perturb + 1) & _mask;
+	}
+
+	return ctr;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+typename FlatHashMap<Key, Val, HashFunc, EqualFunc>::size_type FlatHashMap<Key, Val, HashFunc, EqualFunc>::lookupAndCreateIfMissing(const Key &key) {
+	const uint hash = _hash(key);
+	const byte fragment = hash & 0x7f;
+	size_type ctr = hash & _mask;
+	size_type firstDeleted = (size_type)-1;
+
+	for (size_type perturb = hash; ; perturb >>= FLAT_HASHMAP_PERTURB_SHIFT) {
+		const byte meta = _meta[ctr];
+		if (meta == kMetaEmpty)
+			break;
+		if (meta == kMetaDeleted && firstDeleted == (size_type)-1)
+			firstDeleted = ctr;
+		if (meta == fragment && _equal(_slots[ctr]._key, key))
+			return ctr;
+
+		ctr = (5 * ctr + perturb + 1) & _mask;
+	}
+
+	// The key is not present; insert it, preferring to recycle a
+	// tombstone seen on the way.
+	if (firstDeleted != (size_type)-1) {
+		ctr = firstDeleted;
+		_deleted--;
+	}
+
+	new (&_slots[ctr]) Node(key);
+	_meta[ctr] = fragment;
+	_size++;
+
+	// Keep the load factor below the threshold, counting tombstones
+	// since they lengthen probe sequences just like full slots do.
+	if ((_size + _deleted) * FLAT_HASHMAP_LOADFACTOR_DENOMINATOR > (_mask + 1) * FLAT_HASHMAP_LOADFACTOR_NUMERATOR) {
+		const size_type newCapacity = (_size * FLAT_HASHMAP_LOADFACTOR_DENOMINATOR > (_mask + 1) * FLAT_HASHMAP_LOADFACTOR_NUMERATOR) ? (_mask + 1) * 2 : _mask + 1;
+		expandStorage(newCapacity);
+		ctr = lookup(key);
+		assert(isFull(_meta[ctr]));
+	}
+
+	return ctr;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::expandStorage(size_type newCapacity) {
+	assert((newCapacity & (newCapacity - 1)) == 0);
+
+	byte *oldMeta = _meta;
+	Node *oldSlots = _slots;
+	const size_type oldMask = _mask;
+	const size_type oldSize = _size;
+
+	allocStorage(newCapacity);
+
+	// Rehash all full slots into the new storage; tombstones die here.
+	for (size_type i = 0; i <= oldMask; ++i) {
+		if (!isFull(oldMeta[i]))
+			continue;
+
+		const uint hash = _hash(oldSlots[i]._key);
+		size_type ctr = hash & _mask;
+		for (size_type perturb = hash; _meta[ctr] != kMetaEmpty; perturb >>= FLAT_HASHMAP_PERTURB_SHIFT)
+			ctr = (5 * ctr + perturb + 1) & _mask;
+
+		new (&_slots[ctr]) Node(oldSlots[i]._key, Common::move(oldSlots[i]._value));
+		_meta[ctr] = hash & 0x7f;
+		oldSlots[i].~Node();
+	}
+	_size = oldSize;
+
+	delete[] oldMeta;
+	delete[] (byte *)oldSlots;
+}
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
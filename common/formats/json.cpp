@@ -101,6 +101,273 @@ JSONValue *JSON::parse(const char *data) {
 	return value;
 }
 
+/**
+* Parses a complete JSON encoded string, emitting SAX-style events to the
+* given handler instead of building a JSONValue tree
+*
+* @access public
+*
+* @param char* data The JSON text
+* @param JSONSAXHandler& handler Receiver of the parse events
+*
+* @return bool Returns true if the document was well-formed and no callback stopped the parse
+*/
+bool JSON::parseStream(const char *data, JSONSAXHandler &handler) {
+	// Skip any preceding whitespace, end of data = no JSON = fail
+	if (!skipWhitespace(&data))
+		return false;
+
+	// We need the start of a value here now...
+	if (!parseStreamValue(&data, handler))
+		return false;
+
+	// Can be white space now and should be at the end of the string then...
+	return !skipWhitespace(&data);
+}
+
+/**
+* Parses one JSON value, emitting events to the given handler. This mirrors
+* JSONValue::parse() but allocates no nodes
+*
+* @access private
+*
+* @param char** data Pointer to a char* that contains the JSON text
+* @param JSONSAXHandler& handler Receiver of the parse events
+*
+* @return bool Returns true on success, false on a parse error or when a callback stopped the parse
+*/
+bool JSON::parseStreamValue(const char **data, JSONSAXHandler &handler) {
+	// Is it a string?
+	if (**data == '"') {
+		String str;
+		if (!extractString(&(++(*data)), str))
+			return false;
+		return handler.onString(str);
+	}
+
+	// Is it a boolean?
+	else if ((simplejson_wcsnlen(*data, 4) && scumm_strnicmp(*data, "true", 4) == 0) || (simplejson_wcsnlen(*data, 5) && scumm_strnicmp(*data, "false", 5) == 0)) {
+		bool value = scumm_strnicmp(*data, "true", 4) == 0;
+		(*data) += value ? 4 : 5;
+		return handler.onBool(value);
+	}
+
+	// Is it a null?
+	else if (simplejson_wcsnlen(*data, 4) && scumm_strnicmp(*data, "null", 4) == 0) {
+		(*data) += 4;
+		return handler.onNull();
+	}
+
+	// Is it a number?
+	else if (**data == '-' || (**data >= '0' && **data <= '9')) {
+		long long int integer = 0;
+		double number = 0.0;
+		bool onlyInteger = true;
+
+		if (!parseNumber(data, number, integer, onlyInteger))
+			return false;
+
+		if (onlyInteger)
+			return handler.onIntegerNumber(integer);
+
+		return handler.onNumber(number);
+	}
+
+	// An object?
+	else if (**data == '{') {
+		if (!handler.onObjectStart())
+			return false;
+
+		(*data)++;
+
+		bool first = true;
+		while (**data != 0) {
+			// Whitespace at the start?
+			if (!skipWhitespace(data))
+				return false;
+
+			// Special case - empty object
+			if (first && **data == '}') {
+				(*data)++;
+				return handler.onObjectEnd();
+			}
+			first = false;
+
+			// We want a string now...
+			String name;
+			if (!extractString(&(++(*data)), name))
+				return false;
+
+			if (!handler.onKey(name))
+				return false;
+
+			// More whitespace?
+			if (!skipWhitespace(data))
+				return false;
+
+			// Need a : now
+			if (*((*data)++) != ':')
+				return false;
+
+			// More whitespace?
+			if (!skipWhitespace(data))
+				return false;
+
+			// The value is here
+			if (!parseStreamValue(data, handler))
+				return false;
+
+			// More whitespace?
+			if (!skipWhitespace(data))
+				return false;
+
+			// End of object?
+			if (**data == '}') {
+				(*data)++;
+				return handler.onObjectEnd();
+			}
+
+			// Want a , now
+			if (**data != ',')
+				return false;
+
+			(*data)++;
+		}
+
+		// Only here if we ran out of data
+		return false;
+	}
+
+	// An array?
+	else if (**data == '[') {
+		if (!handler.onArrayStart())
+			return false;
+
+		(*data)++;
+
+		bool first = true;
+		while (**data != 0) {
+			// Whitespace at the start?
+			if (!skipWhitespace(data))
+				return false;
+
+			// Special case - empty array
+			if (first && **data == ']') {
+				(*data)++;
+				return handler.onArrayEnd();
+			}
+			first = false;
+
+			// Get the value
+			if (!parseStreamValue(data, handler))
+				return false;
+
+			// More whitespace?
+			if (!skipWhitespace(data))
+				return false;
+
+			// End of array?
+			if (**data == ']') {
+				(*data)++;
+				return handler.onArrayEnd();
+			}
+
+			// Want a , now
+			if (**data != ',')
+				return false;
+
+			(*data)++;
+		}
+
+		// Only here if we ran out of data
+		return false;
+	}
+
+	// Ran out of possibilites, it's bad!
+	else {
+		return false;
+	}
+}
+
+/**
+* Parses a JSON number as defined by the spec, shared between the tree and
+* the streaming parser
+*
+* @access protected
+*
+* @param char** data Pointer to a char* that contains the JSON text
+* @param double& number Receives the value when it has a fractional part or exponent
+* @param long long int& integer Receives the value when it is a plain integer
+* @param bool& isInteger Set to whether the integer output is the valid one
+*
+* @return bool Returns true on success, false on failure
+*/
+bool JSON::parseNumber(const char **data, double &number, long long int &integer, bool &isInteger) {
+	// Negative?
+	bool neg = **data == '-';
+	if (neg) (*data)++;
+
+	integer = 0;
+	number = 0.0;
+	isInteger = true;
+
+	// Parse the whole part of the number - only if it wasn't 0
+	if (**data == '0')
+		(*data)++;
+	else if (**data >= '1' && **data <= '9')
+		number = integer = (long long int)parseInt(data);
+	else
+		return false;
+
+	// Could be a decimal now...
+	if (**data == '.') {
+		(*data)++;
+
+		// Not get any digits?
+		if (!(**data >= '0' && **data <= '9'))
+			return false;
+
+		// Find the decimal and sort the decimal place out
+		// Use ParseDecimal as ParseInt won't work with decimals less than 0.1
+		// thanks to Javier Abadia for the report & fix
+		double decimal = parseDecimal(data);
+
+		// Save the number
+		number += decimal;
+		isInteger = false;
+	}
+
+	// Could be an exponent now...
+	if (**data == 'E' || **data == 'e') {
+		(*data)++;
+
+		// Check signage of expo
+		bool neg_expo = false;
+		if (**data == '-' || **data == '+') {
+			neg_expo = **data == '-';
+			(*data)++;
+		}
+
+		// Not get any digits?
+		if (!(**data >= '0' && **data <= '9'))
+			return false;
+
+		// Sort the expo out
+		double expo = parseInt(data);
+		for (double i = 0.0; i < expo; i++)
+			number = neg_expo ? (number / 10.0) : (number * 10.0);
+		isInteger = false;
+	}
+
+	// Was it neg?
+	if (neg) {
+		number *= -1;
+		integer = -integer;
+	}
+
+	return true;
+}
+
 /**
 * Turns the passed in JSONValue into a JSON encode string
 *
@@ -362,86 +629,35 @@ JSONValue *JSONValue::parse(const char **data) {
 
 	// Is it a number?
 	else if (**data == '-' || (**data >= '0' && **data <= '9')) {
-		// Negative?
-		bool neg = **data == '-';
-		if (neg) (*data)++;
-
 		long long int integer = 0;
 		double number = 0.0;
 		bool onlyInteger = true;
 
-		// Parse the whole part of the number - only if it wasn't 0
-		if (**data == '0')
-			(*data)++;
-		else if (**data >= '1' && **data <= '9')
-			number = integer = JSON::parseInt(data);
-		else
+		if (!JSON::parseNumber(data, number, integer, onlyInteger))
 			return nullptr;
 
-		// Could be a decimal now...
-		if (**data == '.') {
-			(*data)++;
-
-			// Not get any digits?
-			if (!(**data >= '0' && **data <= '9'))
-				return nullptr;
-
-			// Find the decimal and sort the decimal place out
-			// Use ParseDecimal as ParseInt won't work with decimals less than 0.1
-			// thanks to Javier Abadia for the report & fix
-			double decimal = JSON::parseDecimal(data);
-
-			// Save the number
-			number += decimal;
-			onlyInteger = false;
-		}
-
-		// Could be an exponent now...
-		if (**data == 'E' || **data == 'e') {
-			(*data)++;
-
-			// Check signage of expo
-			bool neg_expo = false;
-			if (**data == '-' || **data == '+') {
-				neg_expo = **data == '-';
-				(*data)++;
-			}
-
-			// Not get any digits?
-			if (!(**data >= '0' && **data <= '9'))
-				return nullptr;
-
-			// Sort the expo out
-			double expo = JSON::parseInt(data);
-			for (double i = 0.0; i < expo; i++)
-				number = neg_expo ? (number / 10.0) : (number * 10.0);
-			onlyInteger = false;
-		}
-
-		// Was it neg?
-		if (neg) number *= -1;
-
 		if (onlyInteger)
-			return new JSONValue(neg ? -integer : integer);
+			return new JSONValue(integer);
 
 		return new JSONValue(number);
 	}
 
 	// An object?
 	else if (**data == '{') {
-		JSONObject object;
+		JSONObject *object = new JSONObject();
 
 		(*data)++;
 
 		while (**data != 0) {
 			// Whitespace at the start?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_OBJECT(object);
+				FREE_OBJECT(*object);
+				delete object;
 				return nullptr;
 			}
 
 			// Special case - empty object
-			if (object.size() == 0 && **data == '}') {
+			if (object->size() == 0 && **data == '}') {
 				(*data)++;
 				return new JSONValue(object);
 			}
@@ -449,43 +665,49 @@ JSONValue *JSONValue::parse(const char **data) {
 			// We want a string now...
 			String name;
 			if (!JSON::extractString(&(++(*data)), name)) {
-				FREE_OBJECT(object);
+				FREE_OBJECT(*object);
+				delete object;
 				return nullptr;
 			}
 
 			// More whitespace?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_OBJECT(object);
+				FREE_OBJECT(*object);
+				delete object;
 				return nullptr;
 			}
 
 			// Need a : now
 			if (*((*data)++) != ':') {
-				FREE_OBJECT(object);
+				FREE_OBJECT(*object);
+				delete object;
 				return nullptr;
 			}
 
 			// More whitespace?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_OBJECT(object);
+				FREE_OBJECT(*object);
+				delete object;
 				return nullptr;
 			}
 
 			// The value is here
 			JSONValue *value = parse(data);
 			if (value == nullptr) {
-				FREE_OBJECT(object);
+				FREE_OBJECT(*object);
+				delete object;
 				return nullptr;
 			}
 
 			// Add the name:value
-			if (object.find(name) != object.end())
-				delete object[name];
-			object[name] = value;
+			if (object->find(name) != object->end())
+				delete (*object)[name];
+			(*object)[name] = value;
 
 			// More whitespace?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_OBJECT(object);
+				FREE_OBJECT(*object);
+				delete object;
 				return nullptr;
 			}
 
@@ -497,7 +719,8 @@ JSONValue *JSONValue::parse(const char **data) {
 
 			// Want a , now
 			if (**data != ',') {
-				FREE_OBJECT(object);
+				FREE_OBJECT(*object);
+				delete object;
 				return nullptr;
 			}
 
@@ -505,25 +728,27 @@ JSONValue *JSONValue::parse(const char **data) {
 		}
 
 		// Only here if we ran out of data
-		FREE_OBJECT(object);
+		FREE_OBJECT(*object);
+				delete object;
 		return nullptr;
 	}
 
 	// An array?
 	else if (**data == '[') {
-		JSONArray array;
+		JSONArray *array = new JSONArray();
 
 		(*data)++;
 
 		while (**data != 0) {
 			// Whitespace at the start?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_ARRAY(array);
+				FREE_ARRAY(*array);
+				delete array;
 				return nullptr;
 			}
 
 			// Special case - empty array
-			if (array.empty() && **data == ']') {
+			if (array->empty() && **data == ']') {
 				(*data)++;
 				return new JSONValue(array);
 			}
@@ -531,16 +756,18 @@ JSONValue *JSONValue::parse(const char **data) {
 			// Get the value
 			JSONValue *value = parse(data);
 			if (value == nullptr) {
-				FREE_ARRAY(array);
+				FREE_ARRAY(*array);
+				delete array;
 				return nullptr;
 			}
 
 			// Add the value
-			array.push_back(value);
+			array->push_back(value);
 
 			// More whitespace?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_ARRAY(array);
+				FREE_ARRAY(*array);
+				delete array;
 				return nullptr;
 			}
 
@@ -552,7 +779,8 @@ JSONValue *JSONValue::parse(const char **data) {
 
 			// Want a , now
 			if (**data != ',') {
-				FREE_ARRAY(array);
+				FREE_ARRAY(*array);
+				delete array;
 				return nullptr;
 			}
 
@@ -560,7 +788,8 @@ JSONValue *JSONValue::parse(const char **data) {
 		}
 
 		// Only here if we ran out of data
-		FREE_ARRAY(array);
+		FREE_ARRAY(*array);
+				delete array;
 		return nullptr;
 	}
 
@@ -663,6 +892,32 @@ JSONValue::JSONValue(const JSONObject &objectValue) {
 	_objectValue = new JSONObject(objectValue);
 }
 
+/**
+* Constructor for creating a JSON Value of type Array, taking ownership of
+* the passed array instead of copying it. Used by parse()
+*
+* @access private
+*
+* @param JSONArray* m_array_value The JSONArray to take over as the value
+*/
+JSONValue::JSONValue(JSONArray *arrayValue) {
+	_type = JSONType_Array;
+	_arrayValue = arrayValue;
+}
+
+/**
+* Constructor for creating a JSON Value of type Object, taking ownership of
+* the passed object instead of copying it. Used by parse()
+*
+* @access private
+*
+* @param JSONObject* m_object_value The JSONObject to take over as the value
+*/
+JSONValue::JSONValue(JSONObject *objectValue) {
+	_type = JSONType_Object;
+	_objectValue = objectValue;
+}
+
 /**
 * Copy constructor to perform a deep copy of array / object values
 *
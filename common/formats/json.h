@@ -129,6 +129,11 @@ protected:
 	static JSONValue *parse(const char **data);
 
 private:
+	// Constructors taking ownership of an already built container, used by
+	// parse() to avoid copying large objects and arrays into the node.
+	explicit JSONValue(JSONArray *arrayValue);
+	explicit JSONValue(JSONObject *objectValue);
+
 	static String stringifyString(const String &str);
 	static uint32 decodeUtf8Char(String::const_iterator &begin, const String::const_iterator &end);
 	static uint8 decodeUtf8Byte(uint8 state, uint32 &codepoint, uint8 byte);
@@ -148,6 +153,35 @@ private:
 
 };
 
+/**
+ * Receiver interface for JSON::parseStream(). The parser calls one method
+ * per token in document order; object members are announced with onKey()
+ * followed by the events of their value. Every callback returns whether
+ * parsing should continue, so a handler can stop early once it has what it
+ * needs. The default implementations accept and ignore everything.
+ *
+ * Use this instead of JSON::parse() when the document is large and only
+ * some fields matter: no tree is built, so parsing allocates nothing
+ * beyond the transient strings passed to the callbacks.
+ */
+class JSONSAXHandler {
+public:
+	virtual ~JSONSAXHandler() {}
+
+	virtual bool onNull() { return true; }
+	virtual bool onBool(bool value) { return true; }
+	virtual bool onNumber(double value) { return true; }
+	virtual bool onIntegerNumber(long long int value) { return true; }
+	virtual bool onString(const String &value) { return true; }
+
+	/** Called before the value events of each object member. */
+	virtual bool onKey(const String &name) { return true; }
+	virtual bool onObjectStart() { return true; }
+	virtual bool onObjectEnd() { return true; }
+	virtual bool onArrayStart() { return true; }
+	virtual bool onArrayEnd() { return true; }
+};
+
 class JSON {
 	friend class JSONValue;
 
@@ -156,6 +190,16 @@ public:
 	static char *zeroTerminateContents(Common::MemoryWriteStreamDynamic &stream);
 
 	static JSONValue *parse(const char *data);
+
+	/**
+	 * Parses a complete JSON encoded string, emitting SAX-style events to
+	 * @p handler instead of building a tree.
+	 *
+	 * @return Whether the document was well-formed and no callback asked
+	 *         to stop.
+	 */
+	static bool parseStream(const char *data, JSONSAXHandler &handler);
+
 	static String stringify(const JSONValue *value);
 protected:
 	static bool skipWhitespace(const char **data);
@@ -163,7 +207,10 @@ protected:
 	static uint32 parseUnicode(const char **data);
 	static double parseInt(const char **data);
 	static double parseDecimal(const char **data);
+	static bool parseNumber(const char **data, double &number, long long int &integer, bool &isInteger);
 private:
+	static bool parseStreamValue(const char **data, JSONSAXHandler &handler);
+
 	JSON();
 };
 
@@ -27,10 +27,12 @@
 // Seek function by Gael Chardon gael.dev@4now.net
 //
 
+#include "common/array.h"
 #include "common/debug.h"
 #include "common/endian.h"
 #include "common/macresman.h"
 #include "common/memstream.h"
+#include "common/span.h"
 #include "common/formats/quicktime.h"
 #include "common/textconsole.h"
 #include "common/util.h"
@@ -345,18 +347,19 @@ int QuickTimeParser::readCMOV(Atom atom) {
 		return -1;
 	uint32 uncompressedSize = _fd->readUint32BE();
 
-	// Read in data
-	byte *compressedData = (byte *)malloc(compressedSize);
-	_fd->read(compressedData, compressedSize);
+	// Read in data; no copy is made when the stream is memory-backed
+	Array<byte> compressedStorage;
+	Span<const byte> compressedData = _fd->readSpan(compressedSize, compressedStorage);
+	if (compressedData.size() != compressedSize)
+		return -1;
 
 	// Create uncompressed stream
 	byte *uncompressedData = (byte *)malloc(uncompressedSize);
 
 	// Uncompress the data
 	unsigned long dstLen = uncompressedSize;
-	if (!inflateZlib(uncompressedData, &dstLen, compressedData, compressedSize)) {
+	if (!inflateZlib(uncompressedData, &dstLen, compressedData.data(), compressedSize)) {
 		warning ("Could not uncompress cmov chunk");
-		free(compressedData);
 		free(uncompressedData);
 		return -1;
 	}
@@ -370,7 +373,6 @@ int QuickTimeParser::readCMOV(Atom atom) {
 	int err = readDefault(a);
 
 	// Assign the file handle back to the original handle
-	free(compressedData);
 	delete _fd;
 	_fd = oldStream;
 
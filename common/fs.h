@@ -271,6 +271,18 @@ public:
 	 */
 	SeekableReadStream *createReadStreamForAltStream(AltStreamType altStreamType) const override;
 
+	/**
+	 * Create a SeekableReadStream instance corresponding to the file
+	 * referred by this node, backed by a read-only memory mapping of the
+	 * file on backends that support one. Backends without memory mapping,
+	 * and files that cannot be mapped, transparently fall back to a plain
+	 * createReadStream(), so this can be used wherever a read stream is
+	 * acceptable.
+	 *
+	 * @return Pointer to the stream object, nullptr in case of a failure.
+	 */
+	SeekableReadStream *createReadStreamMapped() const;
+
 	/**
 	 * Create a WriteStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
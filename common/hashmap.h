@@ -248,6 +248,7 @@ public:
 	const Val &getValOrDefault(const Key &key, const Val &defaultVal) const;
 	bool tryGetVal(const Key &key, Val &out) const;
 	void setVal(const Key &key, const Val &val);
+	void setVal(const Key &key, Val &&val);
 
 	void clear(bool shrinkArray = 0);
 
@@ -702,6 +703,13 @@ void HashMap<Key, Val, HashFunc, EqualFunc>::setVal(const Key &key, const Val &v
 	_storage[ctr]->_value = val;
 }
 
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void HashMap<Key, Val, HashFunc, EqualFunc>::setVal(const Key &key, Val &&val) {
+	size_type ctr = lookupAndCreateIfMissing(key);
+	assert(_storage[ctr] != nullptr);
+	_storage[ctr]->_value = static_cast<Val &&>(val);
+}
+
 /**
  * Erase an element referred to by an iterator.
  */
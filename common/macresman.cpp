@@ -20,6 +20,7 @@
  */
 
 #include "common/scummsys.h"
+#include "common/algorithm.h"
 #include "common/crc.h"
 #include "common/debug.h"
 #include "common/util.h"
@@ -27,6 +28,7 @@
 #include "common/fs.h"
 #include "common/macresman.h"
 #include "common/md5.h"
+#include "common/memstream.h"
 #include "common/substream.h"
 #include "common/textconsole.h"
 #include "common/archive.h"
@@ -863,6 +865,57 @@ MacResIDArray MacResManager::getResIDArray(uint32 typeID) {
 	return res;
 }
 
+MacResArray MacResManager::getResources(uint32 typeID) {
+	MacResArray res;
+
+	int typeNum = -1;
+
+	for (int i = 0; i < _resMap.numTypes; i++)
+		if (_resTypes[i].id == typeID) {
+			typeNum = i;
+			break;
+		}
+
+	if (typeNum == -1)
+		return res;
+
+	// Visit the resources in data offset order, so the fork is swept
+	// through once sequentially instead of seeking per resource.
+	struct OffsetIndex {
+		uint32 offset;
+		int index;
+
+		bool operator<(const OffsetIndex &right) const { return offset < right.offset; }
+	};
+
+	Array<OffsetIndex> order;
+	order.resize(_resTypes[typeNum].items);
+
+	for (int i = 0; i < _resTypes[typeNum].items; i++) {
+		order[i].offset = _resLists[typeNum][i].dataOffset;
+		order[i].index = i;
+	}
+
+	sort(order.begin(), order.end());
+
+	res.resize(_resTypes[typeNum].items);
+
+	for (uint i = 0; i < order.size(); i++) {
+		MacResource &out = res[order[i].index];
+		out.id = _resLists[typeNum][order[i].index].id;
+		out.stream = nullptr;
+
+		_stream->seek(_dataOffset + order[i].offset);
+		uint32 len = _stream->readUint32BE();
+
+		// Ignore resources with 0 length, as getResource() does
+		if (len)
+			out.stream = _stream->readStream(len);
+	}
+
+	return res;
+}
+
 MacResTagArray MacResManager::getResTagArray() {
 	MacResTagArray tagArray;
 
@@ -998,28 +1051,36 @@ uint32 MacResManager::getResLength(uint32 typeID, uint16 resID) {
 }
 
 void MacResManager::readMap() {
-	_stream->seek(_mapOffset + 22);
-
-	_resMap.resAttr = _stream->readUint16BE();
-	_resMap.typeOffset = _stream->readUint16BE();
-	_resMap.nameOffset = _stream->readUint16BE();
-	_resMap.numTypes = _stream->readUint16BE();
+	// Pull the whole map into memory first. Parsing it involves hundreds of
+	// tiny reads and a seek per resource name, which is costly on archive
+	// backed or compressed streams that engines reopen constantly.
+	byte *mapData = new byte[_mapLength];
+	_stream->seek(_mapOffset);
+	uint32 mapDataSize = _stream->read(mapData, _mapLength);
+	MemoryReadStream mapStream(mapData, mapDataSize, DisposeAfterUse::NO);
+
+	mapStream.seek(22);
+
+	_resMap.resAttr = mapStream.readUint16BE();
+	_resMap.typeOffset = mapStream.readUint16BE();
+	_resMap.nameOffset = mapStream.readUint16BE();
+	_resMap.numTypes = mapStream.readUint16BE();
 	_resMap.numTypes++;
 
-	_stream->seek(_mapOffset + _resMap.typeOffset + 2);
+	mapStream.seek(_resMap.typeOffset + 2);
 	_resTypes = new ResType[_resMap.numTypes];
 
 	debug(8, "numResTypes: %d total size: %u", _resMap.numTypes, unsigned(_stream->size()));
 
-	if (_stream->pos() + _resMap.numTypes * 8 > _stream->size())
+	if (_mapOffset + mapStream.pos() + _resMap.numTypes * 8 > (uint32)_stream->size())
 		error("MacResManager::readMap(): incorrect resource map, too big, %d types", _resMap.numTypes);
 
 	int totalItems = 0;
 
 	for (int i = 0; i < _resMap.numTypes; i++) {
-		_resTypes[i].id = _stream->readUint32BE();
-		_resTypes[i].items = _stream->readUint16BE();
-		_resTypes[i].offset = _stream->readUint16BE();
+		_resTypes[i].id = mapStream.readUint32BE();
+		_resTypes[i].items = mapStream.readUint16BE();
+		_resTypes[i].offset = mapStream.readUint16BE();
 		_resTypes[i].items++;
 
 		totalItems += _resTypes[i].items;
@@ -1034,15 +1095,15 @@ void MacResManager::readMap() {
 
 	for (int i = 0; i < _resMap.numTypes; i++) {
 		_resLists[i] = new Resource[_resTypes[i].items];
-		_stream->seek(_resTypes[i].offset + _mapOffset + _resMap.typeOffset);
+		mapStream.seek(_resTypes[i].offset + _resMap.typeOffset);
 
 		for (int j = 0; j < _resTypes[i].items; j++) {
 			ResPtr resPtr = _resLists[i] + j;
 
-			resPtr->id = _stream->readUint16BE();
-			resPtr->nameOffset = _stream->readUint16BE();
-			resPtr->dataOffset = _stream->readUint32BE();
-			_stream->readUint32BE();
+			resPtr->id = mapStream.readUint16BE();
+			resPtr->nameOffset = mapStream.readUint16BE();
+			resPtr->dataOffset = mapStream.readUint32BE();
+			mapStream.readUint32BE();
 			resPtr->name = nullptr;
 
 			resPtr->attr = resPtr->dataOffset >> 24;
@@ -1051,15 +1112,17 @@ void MacResManager::readMap() {
 
 		for (int j = 0; j < _resTypes[i].items; j++) {
 			if (_resLists[i][j].nameOffset != -1) {
-				_stream->seek(_resLists[i][j].nameOffset + _mapOffset + _resMap.nameOffset);
+				mapStream.seek(_resLists[i][j].nameOffset + _resMap.nameOffset);
 
-				byte len = _stream->readByte();
+				byte len = mapStream.readByte();
 				_resLists[i][j].name = new char[len + 1];
 				_resLists[i][j].name[len] = 0;
-				_stream->read(_resLists[i][j].name, len);
+				mapStream.read(_resLists[i][j].name, len);
 			}
 		}
 	}
+
+	delete[] mapData;
 }
 
 Path MacResManager::constructAppleDoubleName(const Path &name) {
@@ -55,6 +55,16 @@ namespace Common {
 
 typedef Array<uint16> MacResIDArray;
 typedef Array<uint32> MacResTagArray;
+
+/**
+ * A resource loaded by MacResManager::getResources().
+ */
+struct MacResource {
+	uint16 id;                   /*!< Resource ID. */
+	SeekableReadStream *stream;  /*!< Resource contents, nullptr for zero-length resources. Owned by the caller. */
+};
+
+typedef Array<MacResource> MacResArray;
 typedef bool (* ProgressUpdateCallback)(void *, int);
 
 /**
@@ -302,6 +312,18 @@ public:
 	 */
 	MacResIDArray getResIDArray(uint32 typeID);
 
+	/**
+	 * Read all resources with the specified type ID in one pass.
+	 *
+	 * The returned array is ordered like getResIDArray(), but the fork is
+	 * read in data offset order, so loading a whole type is a single
+	 * sequential sweep instead of one seek per resource.
+	 *
+	 * @param typeID FourCC of the type
+	 * @return The resources of that type. The caller owns the streams.
+	 */
+	MacResArray getResources(uint32 typeID);
+
 	/**
 	 * Return list of resource tags
 	 */
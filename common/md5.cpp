@@ -32,31 +32,22 @@
 
 namespace Common {
 
-struct md5_context {
-	uint32 total[2];
-	uint32 state[4];
-	uint8 buffer[64];
-};
-
-static void md5_starts(md5_context *ctx);
-static void md5_update(md5_context *ctx, const uint8 *input, uint32 length);
-static void md5_finish(md5_context *ctx, uint8 digest[16]);
-
-
 #define GET_UINT32(n, b, i)	(n) = READ_LE_UINT32(b + i)
 #define PUT_UINT32(n, b, i)	WRITE_LE_UINT32(b + i, n)
 
-void md5_starts(md5_context *ctx) {
-	ctx->total[0] = 0;
-	ctx->total[1] = 0;
+void MD5::reset() {
+	_total[0] = 0;
+	_total[1] = 0;
 
-	ctx->state[0] = 0x67452301;
-	ctx->state[1] = 0xEFCDAB89;
-	ctx->state[2] = 0x98BADCFE;
-	ctx->state[3] = 0x10325476;
+	_state[0] = 0x67452301;
+	_state[1] = 0xEFCDAB89;
+	_state[2] = 0x98BADCFE;
+	_state[3] = 0x10325476;
 }
 
-static void md5_process(md5_context *ctx, const uint8 data[64]) {
+// Transform one 64 byte block. Shared between the incremental MD5 class and
+// the multi-buffer path below, which drives it directly for lane remainders.
+static void md5ProcessBlock(uint32 state[4], const uint8 data[64]) {
 	uint32 X[16], A, B, C, D;
 
 	GET_UINT32(X[0],  data,  0);
@@ -83,10 +74,10 @@ static void md5_process(md5_context *ctx, const uint8 data[64]) {
 	a += F(b,c,d) + X[k] + t; a = S(a,s) + b; \
 }
 
-	A = ctx->state[0];
-	B = ctx->state[1];
-	C = ctx->state[2];
-	D = ctx->state[3];
+	A = state[0];
+	B = state[1];
+	C = state[2];
+	D = state[3];
 
 #define F(x, y, z) (z ^ (x & (y ^ z)))
 
@@ -172,43 +163,43 @@ static void md5_process(md5_context *ctx, const uint8 data[64]) {
 
 #undef F
 
-	ctx->state[0] += A;
-	ctx->state[1] += B;
-	ctx->state[2] += C;
-	ctx->state[3] += D;
+	state[0] += A;
+	state[1] += B;
+	state[2] += C;
+	state[3] += D;
 }
 
-void md5_update(md5_context *ctx, const uint8 *input, uint32 length) {
+void MD5::update(const uint8 *input, uint32 length) {
 	uint32 left, fill;
 
 	if (!length)
 		return;
 
-	left = ctx->total[0] & 0x3F;
+	left = _total[0] & 0x3F;
 	fill = 64 - left;
 
-	ctx->total[0] += length;
-	ctx->total[0] &= 0xFFFFFFFF;
+	_total[0] += length;
+	_total[0] &= 0xFFFFFFFF;
 
-	if (ctx->total[0] < length)
-		ctx->total[1]++;
+	if (_total[0] < length)
+		_total[1]++;
 
 	if (left && length >= fill) {
-		memcpy((void *)(ctx->buffer + left), (const void *)input, fill);
-		md5_process(ctx, ctx->buffer);
+		memcpy((void *)(_buffer + left), (const void *)input, fill);
+		md5ProcessBlock(_state, _buffer);
 		length -= fill;
 		input  += fill;
 		left = 0;
 	}
 
 	while (length >= 64) {
-		md5_process(ctx, input);
+		md5ProcessBlock(_state, input);
 		length -= 64;
 		input  += 64;
 	}
 
 	if (length) {
-		memcpy((void *)(ctx->buffer + left), (const void *)input, length);
+		memcpy((void *)(_buffer + left), (const void *)input, length);
 	}
 }
 
@@ -219,27 +210,39 @@ static const uint8 md5_padding[64] = {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
 
-void md5_finish(md5_context *ctx, uint8 digest[16]) {
+void MD5::finish(uint8 digest[16]) {
 	uint32 last, padn;
 	uint32 high, low;
 	uint8 msglen[8];
 
-	high = (ctx->total[0] >> 29) | (ctx->total[1] << 3);
-	low  = (ctx->total[0] <<  3);
+	high = (_total[0] >> 29) | (_total[1] << 3);
+	low  = (_total[0] <<  3);
 
 	PUT_UINT32(low,  msglen, 0);
 	PUT_UINT32(high, msglen, 4);
 
-	last = ctx->total[0] & 0x3F;
+	last = _total[0] & 0x3F;
 	padn = (last < 56) ? (56 - last) : (120 - last);
 
-	md5_update(ctx, md5_padding, padn);
-	md5_update(ctx, msglen, 8);
+	update(md5_padding, padn);
+	update(msglen, 8);
+
+	PUT_UINT32(_state[0], digest,  0);
+	PUT_UINT32(_state[1], digest,  4);
+	PUT_UINT32(_state[2], digest,  8);
+	PUT_UINT32(_state[3], digest, 12);
+}
+
+String MD5::finishAsString() {
+	uint8 digest[16];
+	String md5;
+
+	finish(digest);
+	for (int i = 0; i < 16; i++) {
+		md5 += String::format("%02x", (int)digest[i]);
+	}
 
-	PUT_UINT32(ctx->state[0], digest,  0);
-	PUT_UINT32(ctx->state[1], digest,  4);
-	PUT_UINT32(ctx->state[2], digest,  8);
-	PUT_UINT32(ctx->state[3], digest, 12);
+	return md5;
 }
 
 
@@ -248,7 +251,7 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length, Progr
 #ifdef DISABLE_MD5
 	memset(digest, 0, 16);
 #else
-	md5_context ctx;
+	MD5 ctx;
 	int i;
 	unsigned char buf[1000];
 	bool restricted = (length != 0);
@@ -259,15 +262,13 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length, Progr
 	else
 		readlen = length;
 
-	md5_starts(&ctx);
-
 	while ((i = stream.read(buf, readlen)) > 0) {
 
 		if (progressUpdateCallback != nullptr && !progressUpdateCallback(callbackParameter, i)) {
 			return false;
 		}
 
-		md5_update(&ctx, buf, i);
+		ctx.update(buf, i);
 
 		if (restricted) {
 			length -= i;
@@ -279,7 +280,7 @@ bool computeStreamMD5(ReadStream &stream, uint8 digest[16], uint32 length, Progr
 		}
 	}
 
-	md5_finish(&ctx, digest);
+	ctx.finish(digest);
 #endif
 	return true;
 }
@@ -296,4 +297,284 @@ String computeStreamMD5AsString(ReadStream &stream, uint32 length, ProgressUpdat
 	return md5;
 }
 
+
+/*
+ * Multi-buffer MD5. The block transform has a strict sequential dependency,
+ * so a single digest cannot be vectorized; four independent messages can be
+ * hashed in lockstep instead, one per 32 bit SIMD lane. SSE2 is the x86-64
+ * baseline and NEON the ARMv8 one, so a compile-time check is sufficient.
+ */
+#ifndef DISABLE_MD5
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#define MD5_SIMD_LANES
+#include <emmintrin.h>
+
+typedef __m128i MD5Vec;
+
+static inline MD5Vec md5VecConst(uint32 x)         { return _mm_set1_epi32((int)x); }
+static inline MD5Vec md5VecAdd(MD5Vec a, MD5Vec b) { return _mm_add_epi32(a, b); }
+static inline MD5Vec md5VecAnd(MD5Vec a, MD5Vec b) { return _mm_and_si128(a, b); }
+static inline MD5Vec md5VecOr(MD5Vec a, MD5Vec b)  { return _mm_or_si128(a, b); }
+static inline MD5Vec md5VecXor(MD5Vec a, MD5Vec b) { return _mm_xor_si128(a, b); }
+static inline MD5Vec md5VecNot(MD5Vec a)           { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+static inline MD5Vec md5VecSet(uint32 l0, uint32 l1, uint32 l2, uint32 l3) {
+	return _mm_set_epi32((int)l3, (int)l2, (int)l1, (int)l0);
+}
+static inline void md5VecStore(uint32 out[4], MD5Vec v) { _mm_storeu_si128((__m128i *)out, v); }
+
+#define MD5V_ROL(v, n) _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - (n)))
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+#define MD5_SIMD_LANES
+#include <arm_neon.h>
+
+typedef uint32x4_t MD5Vec;
+
+static inline MD5Vec md5VecConst(uint32 x)         { return vdupq_n_u32(x); }
+static inline MD5Vec md5VecAdd(MD5Vec a, MD5Vec b) { return vaddq_u32(a, b); }
+static inline MD5Vec md5VecAnd(MD5Vec a, MD5Vec b) { return vandq_u32(a, b); }
+static inline MD5Vec md5VecOr(MD5Vec a, MD5Vec b)  { return vorrq_u32(a, b); }
+static inline MD5Vec md5VecXor(MD5Vec a, MD5Vec b) { return veorq_u32(a, b); }
+static inline MD5Vec md5VecNot(MD5Vec a)           { return vmvnq_u32(a); }
+static inline MD5Vec md5VecSet(uint32 l0, uint32 l1, uint32 l2, uint32 l3) {
+	const uint32 tmp[4] = {l0, l1, l2, l3};
+	return vld1q_u32(tmp);
+}
+static inline void md5VecStore(uint32 out[4], MD5Vec v) { vst1q_u32(out, v); }
+
+#define MD5V_ROL(v, n) vorrq_u32(vshlq_n_u32(v, n), vshrq_n_u32(v, 32 - (n)))
+
+#endif
+#endif // !DISABLE_MD5
+
+#ifdef MD5_SIMD_LANES
+
+// Transform one 64 byte block in each of the four lanes at once. The round
+// structure mirrors md5ProcessBlock() exactly, with every 32 bit operation
+// widened to one operation per lane.
+static void md5ProcessBlockX4(uint32 state[4][4], const uint8 *const data[4]) {
+	MD5Vec X[16], A, B, C, D;
+
+	for (int k = 0; k < 16; k++)
+		X[k] = md5VecSet(READ_LE_UINT32(data[0] + 4 * k), READ_LE_UINT32(data[1] + 4 * k),
+		                 READ_LE_UINT32(data[2] + 4 * k), READ_LE_UINT32(data[3] + 4 * k));
+
+#define VP(a, b, c, d, k, s, t)                                                \
+{                                                                              \
+	a = md5VecAdd(a, md5VecAdd(VF(b, c, d), md5VecAdd(X[k], md5VecConst(t)))); \
+	a = md5VecAdd(MD5V_ROL(a, s), b);                                          \
+}
+
+	A = md5VecSet(state[0][0], state[1][0], state[2][0], state[3][0]);
+	B = md5VecSet(state[0][1], state[1][1], state[2][1], state[3][1]);
+	C = md5VecSet(state[0][2], state[1][2], state[2][2], state[3][2]);
+	D = md5VecSet(state[0][3], state[1][3], state[2][3], state[3][3]);
+
+#define VF(x, y, z) md5VecXor(z, md5VecAnd(x, md5VecXor(y, z)))
+
+	VP(A, B, C, D,  0,  7, 0xD76AA478);
+	VP(D, A, B, C,  1, 12, 0xE8C7B756);
+	VP(C, D, A, B,  2, 17, 0x242070DB);
+	VP(B, C, D, A,  3, 22, 0xC1BDCEEE);
+	VP(A, B, C, D,  4,  7, 0xF57C0FAF);
+	VP(D, A, B, C,  5, 12, 0x4787C62A);
+	VP(C, D, A, B,  6, 17, 0xA8304613);
+	VP(B, C, D, A,  7, 22, 0xFD469501);
+	VP(A, B, C, D,  8,  7, 0x698098D8);
+	VP(D, A, B, C,  9, 12, 0x8B44F7AF);
+	VP(C, D, A, B, 10, 17, 0xFFFF5BB1);
+	VP(B, C, D, A, 11, 22, 0x895CD7BE);
+	VP(A, B, C, D, 12,  7, 0x6B901122);
+	VP(D, A, B, C, 13, 12, 0xFD987193);
+	VP(C, D, A, B, 14, 17, 0xA679438E);
+	VP(B, C, D, A, 15, 22, 0x49B40821);
+
+#undef VF
+
+#define VF(x, y, z) md5VecXor(y, md5VecAnd(z, md5VecXor(x, y)))
+
+	VP(A, B, C, D,  1,  5, 0xF61E2562);
+	VP(D, A, B, C,  6,  9, 0xC040B340);
+	VP(C, D, A, B, 11, 14, 0x265E5A51);
+	VP(B, C, D, A,  0, 20, 0xE9B6C7AA);
+	VP(A, B, C, D,  5,  5, 0xD62F105D);
+	VP(D, A, B, C, 10,  9, 0x02441453);
+	VP(C, D, A, B, 15, 14, 0xD8A1E681);
+	VP(B, C, D, A,  4, 20, 0xE7D3FBC8);
+	VP(A, B, C, D,  9,  5, 0x21E1CDE6);
+	VP(D, A, B, C, 14,  9, 0xC33707D6);
+	VP(C, D, A, B,  3, 14, 0xF4D50D87);
+	VP(B, C, D, A,  8, 20, 0x455A14ED);
+	VP(A, B, C, D, 13,  5, 0xA9E3E905);
+	VP(D, A, B, C,  2,  9, 0xFCEFA3F8);
+	VP(C, D, A, B,  7, 14, 0x676F02D9);
+	VP(B, C, D, A, 12, 20, 0x8D2A4C8A);
+
+#undef VF
+
+#define VF(x, y, z) md5VecXor(x, md5VecXor(y, z))
+
+	VP(A, B, C, D,  5,  4, 0xFFFA3942);
+	VP(D, A, B, C,  8, 11, 0x8771F681);
+	VP(C, D, A, B, 11, 16, 0x6D9D6122);
+	VP(B, C, D, A, 14, 23, 0xFDE5380C);
+	VP(A, B, C, D,  1,  4, 0xA4BEEA44);
+	VP(D, A, B, C,  4, 11, 0x4BDECFA9);
+	VP(C, D, A, B,  7, 16, 0xF6BB4B60);
+	VP(B, C, D, A, 10, 23, 0xBEBFBC70);
+	VP(A, B, C, D, 13,  4, 0x289B7EC6);
+	VP(D, A, B, C,  0, 11, 0xEAA127FA);
+	VP(C, D, A, B,  3, 16, 0xD4EF3085);
+	VP(B, C, D, A,  6, 23, 0x04881D05);
+	VP(A, B, C, D,  9,  4, 0xD9D4D039);
+	VP(D, A, B, C, 12, 11, 0xE6DB99E5);
+	VP(C, D, A, B, 15, 16, 0x1FA27CF8);
+	VP(B, C, D, A,  2, 23, 0xC4AC5665);
+
+#undef VF
+
+#define VF(x, y, z) md5VecXor(y, md5VecOr(x, md5VecNot(z)))
+
+	VP(A, B, C, D,  0,  6, 0xF4292244);
+	VP(D, A, B, C,  7, 10, 0x432AFF97);
+	VP(C, D, A, B, 14, 15, 0xAB9423A7);
+	VP(B, C, D, A,  5, 21, 0xFC93A039);
+	VP(A, B, C, D, 12,  6, 0x655B59C3);
+	VP(D, A, B, C,  3, 10, 0x8F0CCC92);
+	VP(C, D, A, B, 10, 15, 0xFFEFF47D);
+	VP(B, C, D, A,  1, 21, 0x85845DD1);
+	VP(A, B, C, D,  8,  6, 0x6FA87E4F);
+	VP(D, A, B, C, 15, 10, 0xFE2CE6E0);
+	VP(C, D, A, B,  6, 15, 0xA3014314);
+	VP(B, C, D, A, 13, 21, 0x4E0811A1);
+	VP(A, B, C, D,  4,  6, 0xF7537E82);
+	VP(D, A, B, C, 11, 10, 0xBD3AF235);
+	VP(C, D, A, B,  2, 15, 0x2AD7D2BB);
+	VP(B, C, D, A,  9, 21, 0xEB86D391);
+
+#undef VF
+#undef VP
+
+	uint32 lanesA[4], lanesB[4], lanesC[4], lanesD[4];
+	md5VecStore(lanesA, A);
+	md5VecStore(lanesB, B);
+	md5VecStore(lanesC, C);
+	md5VecStore(lanesD, D);
+
+	for (int lane = 0; lane < 4; lane++) {
+		state[lane][0] += lanesA[lane];
+		state[lane][1] += lanesB[lane];
+		state[lane][2] += lanesC[lane];
+		state[lane][3] += lanesD[lane];
+	}
+}
+
+static const uint32 md5_init_state[4] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476};
+
+// Finish one lane: feed the remaining tail bytes plus the standard MD5
+// padding and length field through the scalar block transform.
+static void md5FinishLane(uint32 state[4], uint64 processed, const uint8 *tail, uint32 tailLen, uint8 digest[16]) {
+	uint8 block[128];
+	const uint64 msgLen = processed + tailLen;
+	const uint32 blocks = (tailLen + 9 <= 64) ? 1 : 2;
+
+	memcpy(block, tail, tailLen);
+	memset(block + tailLen, 0, blocks * 64 - tailLen);
+	block[tailLen] = 0x80;
+	PUT_UINT32((uint32)(msgLen << 3), block, blocks * 64 - 8);
+	PUT_UINT32((uint32)(msgLen >> 29), block, blocks * 64 - 4);
+
+	for (uint32 b = 0; b < blocks; b++)
+		md5ProcessBlock(state, block + 64 * b);
+
+	PUT_UINT32(state[0], digest,  0);
+	PUT_UINT32(state[1], digest,  4);
+	PUT_UINT32(state[2], digest,  8);
+	PUT_UINT32(state[3], digest, 12);
+}
+
+#endif // MD5_SIMD_LANES
+
+void computeBatchMD5(const byte *const *buffers, const uint32 *lengths, uint count, uint8 (*digests)[16]) {
+#if defined(DISABLE_MD5)
+	for (uint i = 0; i < count; i++)
+		memset(digests[i], 0, 16);
+#elif defined(MD5_SIMD_LANES)
+	const uint8 *ptr[4];
+	uint32 remaining[4];
+	uint64 processed[4];
+	uint32 states[4][4];
+	uint job[4];
+	bool occupied[4] = {false, false, false, false};
+	uint next = 0;
+
+	for (uint lane = 0; lane < 4 && next < count; lane++) {
+		job[lane] = next;
+		ptr[lane] = buffers[next];
+		remaining[lane] = lengths[next];
+		processed[lane] = 0;
+		memcpy(states[lane], md5_init_state, sizeof(md5_init_state));
+		occupied[lane] = true;
+		next++;
+	}
+
+	if (occupied[0] && occupied[1] && occupied[2] && occupied[3]) {
+		for (;;) {
+			// Retire lanes whose message is done and pull in the next one,
+			// so that the lockstep loop stays fully populated
+			bool haveFour = true;
+			for (uint lane = 0; lane < 4; lane++) {
+				while (occupied[lane] && remaining[lane] < 64) {
+					md5FinishLane(states[lane], processed[lane], ptr[lane], remaining[lane], digests[job[lane]]);
+					occupied[lane] = false;
+					if (next < count) {
+						job[lane] = next;
+						ptr[lane] = buffers[next];
+						remaining[lane] = lengths[next];
+						processed[lane] = 0;
+						memcpy(states[lane], md5_init_state, sizeof(md5_init_state));
+						occupied[lane] = true;
+						next++;
+					}
+				}
+				if (!occupied[lane])
+					haveFour = false;
+			}
+			if (!haveFour)
+				break;
+
+			const uint8 *blocks[4] = {ptr[0], ptr[1], ptr[2], ptr[3]};
+			md5ProcessBlockX4(states, blocks);
+			for (uint lane = 0; lane < 4; lane++) {
+				ptr[lane] += 64;
+				remaining[lane] -= 64;
+				processed[lane] += 64;
+			}
+		}
+	}
+
+	// Drain the lanes left without lockstep partners
+	for (uint lane = 0; lane < 4; lane++) {
+		if (!occupied[lane])
+			continue;
+
+		while (remaining[lane] >= 64) {
+			md5ProcessBlock(states[lane], ptr[lane]);
+			ptr[lane] += 64;
+			remaining[lane] -= 64;
+			processed[lane] += 64;
+		}
+		md5FinishLane(states[lane], processed[lane], ptr[lane], remaining[lane], digests[job[lane]]);
+	}
+#else
+	for (uint i = 0; i < count; i++) {
+		MD5 ctx;
+		ctx.update(buffers[i], lengths[i]);
+		ctx.finish(digests[i]);
+	}
+#endif
+}
+
 } // End of namespace Common
@@ -20,10 +20,127 @@
  */
 
 #include "common/memory.h"
+#include "common/mutex.h"
+#include "common/str.h"
 #include "common/util.h"
 
 namespace Common {
 
+DECLARE_SINGLETON(AllocTracker);
+
+AllocTracker::AllocTracker() : _enabled(false), _numSites(0) {
+	_mutex = new Mutex();
+	memset(_sites, 0, sizeof(_sites));
+}
+
+AllocTracker::~AllocTracker() {
+	delete _mutex;
+}
+
+void AllocTracker::setEnabled(bool enabled) {
+	StackLock lock(*_mutex);
+	_enabled = enabled;
+}
+
+AllocTracker::SiteStats *AllocTracker::findSite(const char *name) {
+	// Sites are almost always string literals, so try pointer identity
+	// first and only fall back to a string compare for literals that got
+	// duplicated across translation units
+	for (uint i = 0; i < _numSites; ++i) {
+		if (_sites[i].name == name || !strcmp(_sites[i].name, name))
+			return &_sites[i];
+	}
+
+	if (_numSites == kMaxSites)
+		return nullptr;
+
+	SiteStats &site = _sites[_numSites++];
+	site.name = name;
+	return &site;
+}
+
+static uint sizeClassIndex(size_t size) {
+	uint idx = 0;
+	size_t limit = 16;
+	while (size > limit && idx < AllocTracker::kNumSizeClasses - 1) {
+		limit <<= 1;
+		++idx;
+	}
+	return idx;
+}
+
+void AllocTracker::recordAlloc(const char *siteName, size_t size) {
+	StackLock lock(*_mutex);
+	if (!_enabled)
+		return;
+
+	SiteStats *site = findSite(siteName);
+	if (!site)
+		return;
+
+	site->allocCount++;
+	site->allocBytes += size;
+	site->sizeClasses[sizeClassIndex(size)]++;
+}
+
+void AllocTracker::recordFree(const char *siteName, size_t size) {
+	StackLock lock(*_mutex);
+	if (!_enabled)
+		return;
+
+	SiteStats *site = findSite(siteName);
+	if (!site)
+		return;
+
+	site->freeCount++;
+	site->freeBytes += size;
+}
+
+void AllocTracker::reset() {
+	StackLock lock(*_mutex);
+	memset(_sites, 0, sizeof(_sites));
+	_numSites = 0;
+}
+
+void AllocTracker::getSummary(String &out) {
+	StackLock lock(*_mutex);
+
+	// Order the sites by total allocated bytes, heaviest first
+	uint order[kMaxSites];
+	for (uint i = 0; i < _numSites; ++i)
+		order[i] = i;
+	for (uint i = 1; i < _numSites; ++i) {
+		for (uint j = i; j > 0 && _sites[order[j]].allocBytes > _sites[order[j - 1]].allocBytes; --j)
+			SWAP(order[j], order[j - 1]);
+	}
+
+	for (uint i = 0; i < _numSites; ++i) {
+		const SiteStats &site = _sites[order[i]];
+
+		out += String::format("%-32s %8u allocs %10llu bytes",
+			site.name, site.allocCount, (unsigned long long)site.allocBytes);
+		if (site.freeCount)
+			out += String::format("   live %d (%lld bytes)",
+				(int)(site.allocCount - site.freeCount),
+				(long long)(site.allocBytes - site.freeBytes));
+		out += '\n';
+
+		out += "    ";
+		for (uint cls = 0; cls < kNumSizeClasses; ++cls) {
+			if (!site.sizeClasses[cls])
+				continue;
+			const uint32 limit = 16u << cls;
+			if (cls == kNumSizeClasses - 1)
+				out += String::format(" >%uK:%u", (limit >> 1) / 1024, site.sizeClasses[cls]);
+			else if (limit >= 1024)
+				out += String::format(" <=%uK:%u", limit / 1024, site.sizeClasses[cls]);
+			else
+				out += String::format(" <=%u:%u", limit, site.sizeClasses[cls]);
+		}
+		out += '\n';
+	}
+}
+
 void memset64(uint64 *dst, uint64 val, size_t count) {
 	if (!count)
 		return;
@@ -23,9 +23,13 @@
 #define COMMON_MEMORY_H
 
 #include "common/util.h"
+#include "common/singleton.h"
 
 namespace Common {
 
+class Mutex;
+class String;
+
 /**
  * @defgroup common_memory Memory
  * @ingroup common
@@ -96,6 +100,97 @@ void uninitialized_fill_n(Type *dst, size_t n, const Value &x) {
 		new ((void *)dst++) Type(x);
 }
 
+/**
+ * Opt-in allocation telemetry for engines whose object models churn the
+ * heap. Engines tag their allocation choke points with ALLOC_TRACK (and
+ * ALLOC_TRACK_FREE where the matching release is equally central); while
+ * tracking is off this costs a single flag test. Recording is toggled
+ * from the GUI debugger ("alloctrack on"), and "alloctrack summary"
+ * prints, per site, the allocation count, total bytes, live balance and
+ * a power-of-two size-class histogram, with the heaviest sites first.
+ *
+ * Reading the output for arena adoption: a site with a high count, small
+ * size classes and a live balance that returns to zero at a natural
+ * boundary (scene change, frame end) is the arena sweet spot - replace
+ * it with an Arena reset at that boundary. A site whose live balance
+ * grows monotonically is a leak or a cache without an eviction policy,
+ * not an arena candidate. Sites with few large allocations are better
+ * served by reuse of a single buffer. Site names are dotted
+ * "engine.subsystem" labels, so the histogram can be read next to the
+ * profiler's per-zone timings ("profiler summary") to decide whether a
+ * site is also hot, not just big.
+ */
+class AllocTracker : public Singleton<AllocTracker> {
+public:
+	enum {
+		// Size classes are <=16 bytes, <=32, ... doubling, with
+		// everything above 256K falling into the last class
+		kNumSizeClasses = 16,
+		kMaxSites = 64
+	};
+
+	/** Accumulated statistics for one allocation site. */
+	struct SiteStats {
+		const char *name;           /*!< Static string passed to ALLOC_TRACK; not owned. */
+		uint32 allocCount;
+		uint32 freeCount;           /*!< Zero when the site does not instrument frees. */
+		uint64 allocBytes;
+		uint64 freeBytes;
+		uint32 sizeClasses[kNumSizeClasses];
+	};
+
+	AllocTracker();
+	~AllocTracker();
+
+	/** Start or stop recording. */
+	void setEnabled(bool enabled);
+
+	bool isEnabled() const { return _enabled; }
+
+	/** Record one allocation. Called through ALLOC_TRACK, not directly. */
+	void recordAlloc(const char *site, size_t size);
+
+	/** Record one release. Called through ALLOC_TRACK_FREE, not directly. */
+	void recordFree(const char *site, size_t size);
+
+	/** Drop all accumulated statistics. */
+	void reset();
+
+	/**
+	 * Append a per-site summary to @p out, heaviest sites by total
+	 * allocated bytes first, one stats line plus one histogram line each.
+	 */
+	void getSummary(String &out);
+
+private:
+	// Held by pointer: memory.h is included from array.h, so it cannot
+	// pull in the mutex header without creating an include cycle
+	Mutex *_mutex;
+	bool _enabled;
+	uint _numSites;
+	SiteStats _sites[kMaxSites];
+
+	SiteStats *findSite(const char *name);
+};
+
+/**
+ * Record an allocation of @p size bytes against the given site while
+ * allocation tracking is enabled. @p site must be a string literal
+ * (it is stored by pointer, not copied).
+ */
+#define ALLOC_TRACK(site, size) \
+	do { \
+		if (Common::AllocTracker::instance().isEnabled()) \
+			Common::AllocTracker::instance().recordAlloc(site, size); \
+	} while (false)
+
+/** Record the release of @p size bytes against the given site. */
+#define ALLOC_TRACK_FREE(site, size) \
+	do { \
+		if (Common::AllocTracker::instance().isEnabled()) \
+			Common::AllocTracker::instance().recordFree(site, size); \
+	} while (false)
+
 /** @} */
 
 } // End of namespace Common
@@ -174,4 +174,66 @@ void MemoryPool::freeUnusedPages() {
 	}
 }
 
+
+Arena::Arena(size_t blockSize)
+	: _blockSize(blockSize), _curBlock(0), _curOffset(0) {
+	assert(blockSize > 0);
+}
+
+Arena::~Arena() {
+	for (size_t i = 0; i < _blocks.size(); ++i)
+		::free(_blocks[i].start);
+}
+
+void *Arena::alloc(size_t size, size_t alignment) {
+	assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+	for (;;) {
+		if (_curBlock < _blocks.size()) {
+			const Block &block = _blocks[_curBlock];
+			// malloc'ed blocks are aligned for any fundamental type, so
+			// aligning the offset aligns the returned pointer.
+			const size_t offset = (_curOffset + alignment - 1) & ~(alignment - 1);
+			if (offset + size <= block.size && offset + size >= size) {
+				_curOffset = offset + size;
+				return block.start + offset;
+			}
+
+			// This block is full (or too small); move on to the next one.
+			// The wasted tail is reclaimed by the next reset.
+			++_curBlock;
+			_curOffset = 0;
+			continue;
+		}
+
+		// Grow. Allocations beyond the default block size get a block of
+		// their own rather than bumping up the regular block size.
+		Block block;
+		block.size = MAX(_blockSize, size + alignment);
+		block.start = (byte *)malloc(block.size);
+		assert(block.start);
+		_blocks.push_back(block);
+	}
+}
+
+void Arena::reset() {
+	_curBlock = 0;
+	_curOffset = 0;
+}
+
+void Arena::rewindTo(const Marker &marker) {
+	assert(marker.block <= _curBlock);
+	assert(marker.block < _curBlock || marker.offset <= _curOffset);
+	_curBlock = marker.block;
+	_curOffset = marker.offset;
+}
+
+void Arena::freeBlocks() {
+	for (size_t i = 0; i < _blocks.size(); ++i)
+		::free(_blocks[i].start);
+	_blocks.clear();
+	_curBlock = 0;
+	_curOffset = 0;
+}
+
 } // End of namespace Common
@@ -148,6 +148,105 @@ public:
 	}
 };
 
+/**
+ * A bump allocator: allocations just advance a pointer inside larger
+ * malloc'ed blocks and there is no per-allocation free. Instead the whole
+ * arena is rewound at once, either completely with reset() or back to a
+ * previously taken marker (see ArenaScope). Blocks are kept around across
+ * resets, so a warmed-up arena serves short-lived allocations without
+ * touching malloc at all.
+ *
+ * This complements MemoryPool: the pool recycles chunks of one fixed
+ * size with individual frees, the arena handles mixed-size temporaries
+ * with a common lifetime (typically one frame or one function call).
+ *
+ * An arena is not thread safe; give each thread its own.
+ */
+class Arena {
+protected:
+	Arena(const Arena &);
+	Arena &operator=(const Arena &);
+
+	struct Block {
+		byte *start;
+		size_t size;
+	};
+
+	Array<Block> _blocks;
+	size_t _blockSize;
+	uint _curBlock;     ///< block currently being bumped
+	size_t _curOffset;  ///< fill level of that block
+
+public:
+	/** An allocation watermark; see mark() and rewindTo(). */
+	struct Marker {
+		uint block;
+		size_t offset;
+	};
+
+	/**
+	 * Constructor for an arena with the given default block size.
+	 * Allocations larger than this get a dedicated block.
+	 */
+	explicit Arena(size_t blockSize = 8192);
+	~Arena();
+
+	/**
+	 * Allocate size bytes with the given alignment (a power of two).
+	 * The memory stays valid until the arena is rewound past it.
+	 */
+	void *alloc(size_t size, size_t alignment = sizeof(void *));
+
+	/** Allocate uninitialized storage for count objects of type T. */
+	template<typename T>
+	T *allocArray(size_t count) {
+		return (T *)alloc(sizeof(T) * count, alignof(T));
+	}
+
+	/** Rewind the whole arena, keeping the blocks for reuse. */
+	void reset();
+
+	/** Return the current allocation watermark. */
+	Marker mark() const {
+		Marker m;
+		m.block = _curBlock;
+		m.offset = _curOffset;
+		return m;
+	}
+
+	/**
+	 * Rewind to a watermark previously obtained from mark(), releasing
+	 * everything allocated since. Usually used through ArenaScope.
+	 */
+	void rewindTo(const Marker &marker);
+
+	/**
+	 * Release all blocks back to the OS. Only useful to trim a
+	 * transiently oversized arena; the equivalent of
+	 * MemoryPool::freeUnusedPages().
+	 */
+	void freeBlocks();
+};
+
+/**
+ * Scoped reset for an Arena: takes a watermark on construction and
+ * rewinds the arena to it on destruction. This makes it safe to carve
+ * temporaries out of a shared arena (such as the per-frame scratch arena,
+ * see OSystem::getScratchArena()) from code that does not control when
+ * that arena is fully reset.
+ */
+class ArenaScope {
+	Arena &_arena;
+	Arena::Marker _marker;
+
+	ArenaScope(const ArenaScope &);
+	ArenaScope &operator=(const ArenaScope &);
+
+public:
+	explicit ArenaScope(Arena &arena) : _arena(arena), _marker(arena.mark()) {}
+	~ArenaScope() { _arena.rewindTo(_marker); }
+};
+
 /** @} */
 
 } // End of namespace Common
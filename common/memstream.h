@@ -85,6 +85,7 @@ public:
 		_eos(false) {}
 
 	uint32 read(void *dataPtr, uint32 dataSize);
+	bool readSpanNoCopy(uint32 dataSize, Span<const byte> &span) override;
 
 	bool eos() const { return _eos; }
 	void clearErr() { _eos = false; }
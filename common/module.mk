@@ -4,6 +4,7 @@ MODULE_OBJS := \
 	archive.o \
 	base64.o \
 	btea.o \
+	bufferedstream.o \
 	concatstream.o \
 	config-manager.o \
 	coroutines.o \
@@ -26,6 +27,7 @@ MODULE_OBJS := \
 	osd_message_queue.o \
 	path.o \
 	platform.o \
+	profiler.o \
 	punycode.o \
 	random.o \
 	rational.o \
@@ -40,6 +42,7 @@ MODULE_OBJS := \
 	system.o \
 	textconsole.o \
 	text-to-speech.o \
+	threadpool.o \
 	tokenizer.o \
 	translation.o \
 	unicode-bidi.o \
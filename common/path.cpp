@@ -517,7 +517,7 @@ Path &Path::appendInPlace(const char *str, char separator) {
 	escape(tmp, SEPARATOR, _str.c_str(), _str.c_str() + _str.size());
 	escape(tmp, separator, str);
 	// Replace ourselves
-	_str = tmp;
+	_str = static_cast<String &&>(tmp);
 
 	return *this;
 }
@@ -758,7 +758,63 @@ Path Path::relativeTo(const Common::Path &other) const {
 	return extract(suffix);
 }
 
+bool Path::isNormalized() const {
+	const char *cur = _str.c_str();
+
+	if (!*cur)
+		// An empty path normalizes to an empty path
+		return true;
+
+	if (*cur == SEPARATOR) {
+		cur++;
+		if (!*cur)
+			// A lone separator is preserved
+			return true;
+	}
+
+	// Leading ".." components survive normalization, but only as long as
+	// nothing else came before them
+	bool dotdotPrefix = true;
+
+	while (*cur) {
+		const char *start = cur;
+		while (*cur && *cur != SEPARATOR) {
+			if (*cur == ESCAPE)
+				// Leave anything involving escapes to normalize()
+				return false;
+			cur++;
+		}
+
+		const size_t len = cur - start;
+		if (len == 0)
+			// Consecutive separators
+			return false;
+		if (len == 1 && start[0] == '.')
+			return false;
+		if (len == 2 && start[0] == '.' && start[1] == '.') {
+			if (!dotdotPrefix)
+				return false;
+		} else {
+			dotdotPrefix = false;
+		}
+
+		if (*cur == SEPARATOR) {
+			cur++;
+			if (!*cur)
+				// Trailing separator
+				return false;
+		}
+	}
+
+	return true;
+}
+
 Path Path::normalize() const {
+	if (isNormalized()) {
+		// Nothing to do, and the string buffer can be shared
+		return *this;
+	}
+
 	if (_str.empty()) {
 		return Path();
 	}
@@ -1202,7 +1258,7 @@ Path Path::fromConfig(const String &value) {
 		// As / is forbidden in paths under WIN32, this will never be a collision
 		value_.replace(Path::kNativeSeparator, '/');
 		// As we have \, we are sure we didn't punyencode this path
-		return Path(value_, '/');
+		return Path(static_cast<String &&>(value_), '/');
 	}
 #endif
 
@@ -1286,7 +1342,7 @@ Path Path::fromCommandLine(const String &value) {
 		// User may have mixed \ and /
 		// As / is forbidden in paths under WIN32, this will never be a collision
 		value_.replace(Path::kNativeSeparator, '/');
-		return Path(value_, '/');
+		return Path(static_cast<String &&>(value_), '/');
 	}
 #endif
 	// Unlike for options the paths provided by the user are not punyencoded
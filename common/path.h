@@ -239,6 +239,9 @@ public:
 	/** Construct a copy of the given path. */
 	Path(const Path &path) : _str(path._str) { }
 
+	/** Construct a path by stealing the storage of the given path. */
+	Path(Path &&path) : _str(static_cast<String &&>(path._str)) { }
+
 	/**
 	 * Construct a new path from the given NULL-terminated C string.
 	 *
@@ -263,6 +266,18 @@ public:
 	explicit Path(const String &str, char separator = '/') :
 		_str(needsEncoding(str.c_str(), separator) ? encode(str.c_str(), separator) : str) { }
 
+	/**
+	 * @overload
+	 * Steals the storage of the given String when no re-encoding of the
+	 * separator is needed.
+	 */
+	explicit Path(String &&str, char separator = '/') {
+		if (needsEncoding(str.c_str(), separator))
+			_str = encode(str.c_str(), separator);
+		else
+			_str = static_cast<String &&>(str);
+	}
+
 	/**
 	 * Converts a path to a string using the given directory separator.
 	 * Collisions in resulting path are checked and warned once.
@@ -360,6 +375,12 @@ public:
 		return *this;
 	}
 
+	/** Move the given path into this path. */
+	Path &operator=(Path &&path) {
+		_str = static_cast<String &&>(path._str);
+		return *this;
+	}
+
 	/** @overload */
 	Path &operator=(const char *str) {
 		set(str);
@@ -559,6 +580,17 @@ public:
 	 */
 	Path normalize() const;
 
+	/**
+	 * Check whether the path already is in the canonical form produced
+	 * by normalize(). Runs in one pass without allocating, and lets
+	 * normalize() return early: callers normalizing defensively (archive
+	 * lookups, search paths) mostly pass paths that are already normal.
+	 *
+	 * Escaped paths always report false and are left to normalize(),
+	 * which works out whether the escape can be dropped.
+	 */
+	bool isNormalized() const;
+
 	/**
 	 * Splits into path components. After every component except
 	 * last there is an implied separator. First component is empty
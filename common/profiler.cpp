@@ -0,0 +1,336 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/profiler.h"
+#include "common/algorithm.h"
+#include "common/file.h"
+#include "common/system.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(Profiler);
+
+uint64 Profiler::_ioReadCalls = 0;
+uint64 Profiler::_ioReadBytes = 0;
+uint64 Profiler::_ioWriteCalls = 0;
+uint64 Profiler::_ioWriteBytes = 0;
+
+const char *Profiler::_currentIoTag = "other";
+Profiler::IoChannelStats Profiler::_ioChannels[Profiler::kMaxIoChannels];
+uint Profiler::_ioChannelCount = 0;
+Profiler::IoChannelStats Profiler::_ioOverflowChannel = { "overflow", 0, 0, 0, 0, 0, {} };
+
+Profiler::Profiler() : _enabled(false), _nextEvent(0), _wrapped(false),
+		_nextFrame(0), _framesWrapped(false), _frameSubmit(0), _framePresent(0),
+		_frameOpen(false), _framePresenting(false) {
+	memset(_frames, 0, sizeof(_frames));
+}
+
+void Profiler::setEnabled(bool enabled) {
+	StackLock lock(_mutex);
+	if (enabled && _events.empty())
+		_events.resize(kMaxEvents);
+	_enabled = enabled;
+}
+
+void Profiler::addZone(const char *name, uint32 start, uint32 duration) {
+	StackLock lock(_mutex);
+	if (!_enabled)
+		return;
+
+	ZoneEvent &event = _events[_nextEvent];
+	event.name = name;
+	event.start = start;
+	event.duration = duration;
+	if (++_nextEvent == kMaxEvents) {
+		_nextEvent = 0;
+		_wrapped = true;
+	}
+
+	ZoneStats &stats = _stats.getOrCreateVal(name);
+	stats.count++;
+	stats.totalMs += duration;
+	if (duration > stats.maxMs)
+		stats.maxMs = duration;
+}
+
+void Profiler::frameBegin() {
+	if (!_enabled)
+		return;
+
+	StackLock lock(_mutex);
+	_frameSubmit = g_system->getMillis();
+	_frameOpen = true;
+	_framePresenting = false;
+}
+
+void Profiler::framePresentBegin() {
+	if (!_enabled)
+		return;
+
+	StackLock lock(_mutex);
+	if (!_frameOpen)
+		return;
+	_framePresent = g_system->getMillis();
+	_framePresenting = true;
+}
+
+void Profiler::frameEnd() {
+	if (!_enabled)
+		return;
+
+	StackLock lock(_mutex);
+	if (!_frameOpen || !_framePresenting)
+		return;
+
+	FrameEvent &frame = _frames[_nextFrame];
+	frame.submit = _frameSubmit;
+	frame.convertMs = _framePresent - _frameSubmit;
+	frame.presentMs = g_system->getMillis() - _framePresent;
+	if (++_nextFrame == kMaxFrames) {
+		_nextFrame = 0;
+		_framesWrapped = true;
+	}
+
+	_frameOpen = false;
+	_framePresenting = false;
+}
+
+static uint32 percentileOf(const Array<uint32> &sorted, uint percent) {
+	return sorted[(sorted.size() - 1) * percent / 100];
+}
+
+void Profiler::getFrameSummary(String &out) {
+	StackLock lock(_mutex);
+
+	const uint count = _framesWrapped ? (uint)kMaxFrames : _nextFrame;
+	if (count < 2)
+		return;
+
+	const uint first = _framesWrapped ? _nextFrame : 0;
+	Array<uint32> intervals, convert, present;
+	for (uint i = 0; i < count; i++) {
+		const FrameEvent &frame = _frames[(first + i) % kMaxFrames];
+		if (i > 0)
+			intervals.push_back(frame.submit - _frames[(first + i - 1) % kMaxFrames].submit);
+		convert.push_back(frame.convertMs);
+		present.push_back(frame.presentMs);
+	}
+
+	sort(intervals.begin(), intervals.end());
+	sort(convert.begin(), convert.end());
+	sort(present.begin(), present.end());
+
+	// Intervals well above the median mean the frame missed its slot; with
+	// only a millisecond clock this is the best missed-vsync estimate we
+	// can give.
+	const uint32 median = percentileOf(intervals, 50);
+	uint overshoots = 0;
+	for (uint i = 0; i < intervals.size(); i++) {
+		if (intervals[i] > median + median / 2)
+			overshoots++;
+	}
+
+	out += String::format("%u frames presented\n", count);
+	out += String::format("interval p50 %3u ms  p95 %3u ms  max %3u ms\n",
+		percentileOf(intervals, 50), percentileOf(intervals, 95), percentileOf(intervals, 100));
+	out += String::format("convert  p50 %3u ms  p95 %3u ms  max %3u ms\n",
+		percentileOf(convert, 50), percentileOf(convert, 95), percentileOf(convert, 100));
+	out += String::format("present  p50 %3u ms  p95 %3u ms  max %3u ms\n",
+		percentileOf(present, 50), percentileOf(present, 95), percentileOf(present, 100));
+	if (median > 0)
+		out += String::format("%u frames over 1.5x the median interval\n", overshoots);
+}
+
+Profiler::IoChannelStats *Profiler::ioChannel(const char *tag) {
+	StackLock lock(_mutex);
+
+	for (uint i = 0; i < _ioChannelCount; i++) {
+		if (!strcmp(_ioChannels[i].name, tag))
+			return &_ioChannels[i];
+	}
+
+	if (_ioChannelCount == kMaxIoChannels)
+		return &_ioOverflowChannel;
+
+	IoChannelStats &channel = _ioChannels[_ioChannelCount++];
+	channel.name = tag;
+	return &channel;
+}
+
+uint32 Profiler::ioClock() {
+	return g_system ? g_system->getMillis() : 0;
+}
+
+static void appendIoChannel(String &out, const Profiler::IoChannelStats &channel) {
+	out += String::format("%-8s reads %llu calls %llu KB, writes %llu calls %llu KB, seeks %llu\n",
+		channel.name,
+		(unsigned long long)channel.readCalls, (unsigned long long)(channel.readBytes / 1024),
+		(unsigned long long)channel.writeCalls, (unsigned long long)(channel.writeBytes / 1024),
+		(unsigned long long)channel.seekCalls);
+
+	// Everything in the lowest bucket was served within the clock
+	// resolution; only print the histogram when something was slower.
+	uint64 slow = 0;
+	for (uint i = 1; i < Profiler::kIoLatencyBuckets; i++)
+		slow += channel.latency[i];
+	if (slow == 0)
+		return;
+
+	out += "         latency";
+	for (uint i = 0; i < Profiler::kIoLatencyBuckets; i++) {
+		if (i == 0)
+			out += String::format(" <1ms:%u", channel.latency[i]);
+		else if (i == Profiler::kIoLatencyBuckets - 1)
+			out += String::format(" %ums+:%u", 1 << (i - 1), channel.latency[i]);
+		else
+			out += String::format(" %u-%ums:%u", 1 << (i - 1), (1 << i) - 1, channel.latency[i]);
+	}
+	out += "\n";
+}
+
+void Profiler::getIoSummary(String &out) {
+	out += String::format("file reads:  %llu calls, %llu KB\n",
+		(unsigned long long)_ioReadCalls, (unsigned long long)(_ioReadBytes / 1024));
+	out += String::format("file writes: %llu calls, %llu KB\n",
+		(unsigned long long)_ioWriteCalls, (unsigned long long)(_ioWriteBytes / 1024));
+
+	StackLock lock(_mutex);
+	for (uint i = 0; i < _ioChannelCount; i++)
+		appendIoChannel(out, _ioChannels[i]);
+	if (_ioOverflowChannel.readCalls || _ioOverflowChannel.writeCalls || _ioOverflowChannel.seekCalls)
+		appendIoChannel(out, _ioOverflowChannel);
+}
+
+static void dumpIoCsvRow(DumpFile &out, const Profiler::IoChannelStats &channel) {
+	out.writeString(String::format("%s,%llu,%llu,%llu,%llu,%llu",
+		channel.name,
+		(unsigned long long)channel.readCalls, (unsigned long long)channel.readBytes,
+		(unsigned long long)channel.writeCalls, (unsigned long long)channel.writeBytes,
+		(unsigned long long)channel.seekCalls));
+	for (uint i = 0; i < Profiler::kIoLatencyBuckets; i++)
+		out.writeString(String::format(",%u", channel.latency[i]));
+	out.writeString("\n");
+}
+
+bool Profiler::dumpIoCsv(const String &filename) {
+	DumpFile out;
+	if (!out.open(Path(filename)))
+		return false;
+
+	out.writeString("subsystem,read_calls,read_bytes,write_calls,write_bytes,seek_calls");
+	for (uint i = 0; i < kIoLatencyBuckets; i++) {
+		if (i == 0)
+			out.writeString(",lat_lt1ms");
+		else if (i == kIoLatencyBuckets - 1)
+			out.writeString(String::format(",lat_%ums_plus", 1 << (i - 1)));
+		else
+			out.writeString(String::format(",lat_%u_%ums", 1 << (i - 1), (1 << i) - 1));
+	}
+	out.writeString("\n");
+
+	StackLock lock(_mutex);
+	for (uint i = 0; i < _ioChannelCount; i++)
+		dumpIoCsvRow(out, _ioChannels[i]);
+	if (_ioOverflowChannel.readCalls || _ioOverflowChannel.writeCalls || _ioOverflowChannel.seekCalls)
+		dumpIoCsvRow(out, _ioOverflowChannel);
+
+	bool success = !out.err();
+	out.close();
+	return success;
+}
+
+void Profiler::reset() {
+	StackLock lock(_mutex);
+	_nextEvent = 0;
+	_wrapped = false;
+	_stats.clear();
+	_nextFrame = 0;
+	_framesWrapped = false;
+	_frameOpen = false;
+	_framePresenting = false;
+	_ioReadCalls = _ioReadBytes = 0;
+	_ioWriteCalls = _ioWriteBytes = 0;
+
+	// Zero the channel counters but keep the channels themselves: open
+	// streams hold pointers into the table.
+	for (uint i = 0; i < _ioChannelCount; i++) {
+		const char *name = _ioChannels[i].name;
+		memset(&_ioChannels[i], 0, sizeof(_ioChannels[i]));
+		_ioChannels[i].name = name;
+	}
+	const char *overflowName = _ioOverflowChannel.name;
+	memset(&_ioOverflowChannel, 0, sizeof(_ioOverflowChannel));
+	_ioOverflowChannel.name = overflowName;
+}
+
+bool Profiler::dumpTrace(const String &filename) {
+	StackLock lock(_mutex);
+
+	DumpFile out;
+	if (!out.open(Path(filename)))
+		return false;
+
+	// Chrome trace event format: complete events ("ph":"X") with
+	// microsecond timestamps. We only have milliseconds, so scale up.
+	out.writeString("{\"traceEvents\":[\n");
+
+	const uint count = _wrapped ? (uint)kMaxEvents : _nextEvent;
+	const uint first = _wrapped ? _nextEvent : 0;
+	for (uint i = 0; i < count; i++) {
+		const ZoneEvent &event = _events[(first + i) % kMaxEvents];
+		out.writeString(String::format(
+			"{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%u000,\"dur\":%u000,\"pid\":1,\"tid\":1}%s\n",
+			event.name, event.start, event.duration,
+			(i + 1 < count) ? "," : ""));
+	}
+
+	out.writeString("]}\n");
+	bool success = !out.err();
+	out.close();
+	return success;
+}
+
+void Profiler::getSummary(String &out) {
+	StackLock lock(_mutex);
+
+	for (const auto &entry : _stats) {
+		const ZoneStats &stats = entry._value;
+		out += String::format("%-40s %8u calls %8u ms total %6u.%02u ms avg %6u ms max\n",
+			entry._key.c_str(), stats.count, stats.totalMs,
+			stats.totalMs / stats.count, (stats.totalMs * 100 / stats.count) % 100,
+			stats.maxMs);
+	}
+}
+
+ProfileScope::ProfileScope(const char *name) : _name(name), _start(0), _active(false) {
+	if (Profiler::instance().isEnabled()) {
+		_active = true;
+		_start = g_system->getMillis();
+	}
+}
+
+ProfileScope::~ProfileScope() {
+	if (_active)
+		Profiler::instance().addZone(_name, _start, g_system->getMillis() - _start);
+}
+
+} // End of namespace Common
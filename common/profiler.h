@@ -0,0 +1,303 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/mutex.h"
+#include "common/singleton.h"
+#include "common/str.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_profiler Scoped-zone profiler
+ * @ingroup common
+ *
+ * @brief Lightweight timing instrumentation for hot paths.
+ *
+ * @{
+ */
+
+/**
+ * Collects timings of named code zones into a ring buffer and a running
+ * per-zone summary. Zones are recorded through the PROFILE_SCOPE macro;
+ * recording is off by default and costs a single flag test per zone until
+ * enabled from the GUI debugger ("profiler on").
+ *
+ * The clock is OSystem::getMillis(), the finest timer the OSystem API
+ * exposes, so sub-millisecond zones show up in the counts and the trace
+ * timeline but not in the accumulated times.
+ */
+class Profiler : public Singleton<Profiler> {
+public:
+	Profiler();
+
+	/** One completed zone, as recorded in the ring buffer. */
+	struct ZoneEvent {
+		const char *name;   /*!< Static string passed to PROFILE_SCOPE; not owned. */
+		uint32 start;       /*!< OSystem::getMillis() when the zone was entered. */
+		uint32 duration;    /*!< Time spent inside the zone, in milliseconds. */
+	};
+
+	/** Accumulated statistics for one zone name. */
+	struct ZoneStats {
+		uint32 count;       /*!< Number of times the zone was recorded. */
+		uint32 totalMs;     /*!< Accumulated time, in milliseconds. */
+		uint32 maxMs;       /*!< Longest single occurrence, in milliseconds. */
+		ZoneStats() : count(0), totalMs(0), maxMs(0) {}
+	};
+
+	/** Start or stop recording. Enabling allocates the ring buffer lazily. */
+	void setEnabled(bool enabled);
+
+	bool isEnabled() const { return _enabled; }
+
+	/** Record a completed zone. Called by ProfileScope, not directly. */
+	void addZone(const char *name, uint32 start, uint32 duration);
+
+	/**
+	 * Mark the presentation points of the frame being shown. The graphics
+	 * managers call these from their updateScreen implementations:
+	 * frameBegin() when the engine's screen contents are picked up,
+	 * framePresentBegin() once backend-side conversion and upload are done
+	 * and the present call is about to be issued, and frameEnd() when the
+	 * present call has returned. A frame is only recorded once all three
+	 * marks were seen, so skipped updates (nothing changed on screen) do
+	 * not pollute the statistics.
+	 */
+	void frameBegin();
+	void framePresentBegin();
+	void frameEnd();
+
+	/**
+	 * Append presentation statistics to @p out: percentiles of the
+	 * frame-to-frame interval, the backend conversion time and the present
+	 * time over the most recent frames, plus a count of frames whose
+	 * interval overshot 1.5x the median - the closest thing to a missed
+	 * vsync the OSystem clock can observe.
+	 */
+	void getFrameSummary(String &out);
+
+	/**
+	 * File I/O counters, bumped by the backend stream implementations on
+	 * every read and write call. They are plain counters without locking;
+	 * an occasional lost increment from concurrent streams does not
+	 * matter for telemetry, a mutex around every fread would.
+	 */
+	static void countIoRead(uint32 bytes) {
+		_ioReadCalls++;
+		_ioReadBytes += bytes;
+	}
+
+	static void countIoWrite(uint32 bytes) {
+		_ioWriteCalls++;
+		_ioWriteBytes += bytes;
+	}
+
+	enum {
+		/** Distinct I/O attribution channels tracked before overflowing. */
+		kMaxIoChannels = 16,
+		/** Latency histogram buckets: below clock resolution, then doubling. */
+		kIoLatencyBuckets = 8
+	};
+
+	/**
+	 * Per-subsystem file I/O statistics. A channel is created the first
+	 * time a stream is opened under its attribution tag; the backend
+	 * stream keeps a pointer to its channel and bumps the counters
+	 * directly on every call. Like the global counters above these are
+	 * deliberately unlocked.
+	 *
+	 * The latency histogram uses the same millisecond clock as the rest
+	 * of the profiler: bucket 0 holds calls that finished within the
+	 * clock resolution, bucket n calls that took [2^(n-1), 2^n) ms, and
+	 * the last bucket has no upper bound. Cache-served reads all land in
+	 * bucket 0; the buckets above it are the ones that show a slow medium.
+	 */
+	struct IoChannelStats {
+		const char *name;   /*!< Attribution tag; a static string, not owned. */
+		uint64 readCalls;
+		uint64 readBytes;
+		uint64 writeCalls;
+		uint64 writeBytes;
+		uint64 seekCalls;
+		uint32 latency[kIoLatencyBuckets];
+
+		void addLatency(uint32 ms) {
+			uint bucket = 0;
+			while (ms > 0 && bucket < kIoLatencyBuckets - 1) {
+				ms >>= 1;
+				bucket++;
+			}
+			latency[bucket]++;
+		}
+
+		void addRead(uint32 bytes, uint32 ms) {
+			readCalls++;
+			readBytes += bytes;
+			addLatency(ms);
+		}
+
+		void addWrite(uint32 bytes, uint32 ms) {
+			writeCalls++;
+			writeBytes += bytes;
+			addLatency(ms);
+		}
+
+		void addSeek(uint32 ms) {
+			seekCalls++;
+			addLatency(ms);
+		}
+	};
+
+	/**
+	 * Return the accounting channel for @p tag, creating it on first use.
+	 * Once all slots are taken, further tags share an overflow channel.
+	 * Channels are never destroyed, so the returned pointer stays valid
+	 * for the lifetime of the process.
+	 */
+	IoChannelStats *ioChannel(const char *tag);
+
+	/** The attribution tag applying to streams opened right now. */
+	static const char *currentIoTag() { return _currentIoTag; }
+
+	/**
+	 * Millisecond clock for I/O latency measurements. Safe to call before
+	 * the backend exists (the config file is read that early), in which
+	 * case it returns 0 and the calls land in the lowest latency bucket.
+	 */
+	static uint32 ioClock();
+
+	/** Append the file I/O counters to @p out, one block per channel. */
+	void getIoSummary(String &out);
+
+	/**
+	 * Write the per-subsystem I/O counters as CSV, one row per channel,
+	 * with the latency histogram spread over the trailing columns.
+	 */
+	bool dumpIoCsv(const String &filename);
+
+	/** Drop all buffered events and accumulated statistics. */
+	void reset();
+
+	/**
+	 * Write the buffered events to a JSON file in the Chrome trace event
+	 * format, loadable in chrome://tracing or https://ui.perfetto.dev.
+	 */
+	bool dumpTrace(const String &filename);
+
+	/** Append a per-zone summary to @p out, one line per zone. */
+	void getSummary(String &out);
+
+private:
+	enum {
+		kMaxEvents = 8192,
+		kMaxFrames = 256
+	};
+
+	/** Timing of one presented frame. */
+	struct FrameEvent {
+		uint32 submit;     ///< getMillis() when updateScreen picked up the frame.
+		uint32 convertMs;  ///< Backend-side conversion and upload time.
+		uint32 presentMs;  ///< Time spent inside the present call.
+	};
+
+	Mutex _mutex;
+	bool _enabled;
+	Array<ZoneEvent> _events;      ///< Ring buffer of the most recent zones.
+	uint _nextEvent;               ///< Write cursor into _events.
+	bool _wrapped;                 ///< Whether the ring buffer has wrapped.
+	HashMap<String, ZoneStats> _stats;
+
+	FrameEvent _frames[kMaxFrames]; ///< Ring buffer of the most recent frames.
+	uint _nextFrame;               ///< Write cursor into _frames.
+	bool _framesWrapped;           ///< Whether the frame ring buffer has wrapped.
+	uint32 _frameSubmit;           ///< frameBegin() time of the frame in flight.
+	uint32 _framePresent;          ///< framePresentBegin() time of the frame in flight.
+	bool _frameOpen;               ///< Whether frameBegin() was seen since the last frameEnd().
+	bool _framePresenting;         ///< Whether framePresentBegin() was seen as well.
+
+	static uint64 _ioReadCalls;    ///< Number of read calls on backend file streams.
+	static uint64 _ioReadBytes;    ///< Bytes returned by those reads.
+	static uint64 _ioWriteCalls;   ///< Number of write calls on backend file streams.
+	static uint64 _ioWriteBytes;   ///< Bytes written by those writes.
+
+	static const char *_currentIoTag;              ///< Tag set by the innermost IoTagScope.
+	static IoChannelStats _ioChannels[kMaxIoChannels];
+	static uint _ioChannelCount;
+	static IoChannelStats _ioOverflowChannel;      ///< Absorbs tags beyond kMaxIoChannels.
+
+	friend class IoTagScope;
+};
+
+/**
+ * RAII helper recording the time between its construction and destruction
+ * as a zone. Use through PROFILE_SCOPE rather than directly.
+ */
+class ProfileScope {
+public:
+	explicit ProfileScope(const char *name);
+	~ProfileScope();
+
+private:
+	const char *_name;
+	uint32 _start;
+	bool _active;
+};
+
+/**
+ * Time the rest of the enclosing scope as a profiler zone. @p name must be
+ * a string literal (it is stored by pointer, not copied).
+ */
+#define PROFILE_SCOPE(name) Common::ProfileScope profileScope_(name)
+
+/**
+ * Attributes file streams opened during its lifetime to a subsystem for
+ * the I/O accounting shown by the debugger's "perf io" command. The tag
+ * is captured when the backend stream is opened, so reads on the stream
+ * stay attributed to the opener even after the scope ends. @p tag must be
+ * a string literal. Not thread-aware: opens on worker threads are
+ * attributed to whatever tag the main thread has current, which is good
+ * enough for telemetry.
+ */
+class IoTagScope {
+public:
+	explicit IoTagScope(const char *tag) : _previous(Profiler::_currentIoTag) {
+		Profiler::_currentIoTag = tag;
+	}
+
+	~IoTagScope() {
+		Profiler::_currentIoTag = _previous;
+	}
+
+private:
+	const char *_previous;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
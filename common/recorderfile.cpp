@@ -25,11 +25,12 @@
 #include "common/recorderfile.h"
 #include "common/savefile.h"
 #include "common/bufferedstream.h"
+#include "common/compression/deflate.h"
 #include "graphics/thumbnail.h"
 #include "graphics/surface.h"
 #include "graphics/scaler.h"
 
-#define RECORD_VERSION 1
+#define RECORD_VERSION 2
 
 namespace Common {
 
@@ -133,6 +134,7 @@ bool PlaybackFile::checkPlaybackFileVersion() {
 	_version = _readStream->readUint32BE();
 	switch (_version) {
 	case 1:
+	case 2:
 		break;
 	default:
 		warning("Unknown playback file version %d. Maximum supported version is %d.", _version, RECORD_VERSION);
@@ -341,7 +343,7 @@ RecorderEvent PlaybackFile::getNextEvent() {
 	if (isEventsBufferEmpty()) {
 		PlaybackFile::ChunkHeader header;
 		header.id = kFormatIdTag;
-		while (header.id != kEventTag) {
+		while ((header.id != kEventTag) && (header.id != kCompressedEventTag)) {
 			if (!readChunkHeader(header) || _readStream->eos()) {
 				break;
 			}
@@ -349,6 +351,9 @@ RecorderEvent PlaybackFile::getNextEvent() {
 			case kEventTag:
 				readEventsToBuffer(header.len);
 				break;
+			case kCompressedEventTag:
+				readCompressedEventsToBuffer(header.len);
+				break;
 			case kScreenShotTag:
 				_readStream->seek(-4, SEEK_CUR);
 				header.len = _readStream->readUint32BE();
@@ -452,6 +457,25 @@ void PlaybackFile::readEventsToBuffer(uint32 size) {
 	_eventsSize = size;
 }
 
+void PlaybackFile::readCompressedEventsToBuffer(uint32 size) {
+	uint32 uncompressedSize = _readStream->readUint32BE();
+	if (uncompressedSize > kRecordBuffSize) {
+		warning("Invalid size %u of compressed event chunk", uncompressedSize);
+		_readStream->skip(size - 4);
+		return;
+	}
+	byte *compressed = (byte *)malloc(size - 4);
+	_readStream->read(compressed, size - 4);
+	// wrapCompressedReadStream detects by the gzip magic whether the chunk
+	// is actually deflated, so chunks written without zlib support read
+	// back fine too.
+	SeekableReadStream *payload = wrapCompressedReadStream(new MemoryReadStream(compressed, size - 4, DisposeAfterUse::YES));
+	payload->read(_tmpBuffer.data(), uncompressedSize);
+	delete payload;
+	_tmpPlaybackFile.seek(0);
+	_eventsSize = uncompressedSize;
+}
+
 void PlaybackFile::saveScreenShot(Graphics::Surface &screen, byte md5[16]) {
 	dumpRecordsToFile();
 	_writeStream->writeUint32BE(kMD5Tag);
@@ -468,9 +492,26 @@ void PlaybackFile::dumpRecordsToFile() {
 	if (_recordCount == 0) {
 		return;
 	}
-	_writeStream->writeUint32BE(kEventTag);
-	_writeStream->writeUint32BE(_tmpRecordFile.pos());
-	_writeStream->write(_tmpBuffer.data(), _tmpRecordFile.pos());
+	uint32 size = _tmpRecordFile.pos();
+
+	// Deflate the chunk payload: hour-scale recordings are dominated by
+	// mouse-move events and compress very well. Without zlib support the
+	// wrapper passes the data through unchanged, which the reader copes
+	// with as well.
+	MemoryWriteStreamDynamic *payload = new MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+	WriteStream *comp = wrapCompressedWriteStream(payload);
+	comp->write(_tmpBuffer.data(), size);
+	comp->finalize();
+	byte *data = payload->getData();
+	uint32 compressedSize = payload->size();
+	delete comp;
+
+	_writeStream->writeUint32BE(kCompressedEventTag);
+	_writeStream->writeUint32BE(compressedSize + 4);
+	_writeStream->writeUint32BE(size);
+	_writeStream->write(data, compressedSize);
+	free(data);
+
 	_tmpRecordFile.seek(0);
 	_recordCount = 0;
 }
@@ -742,7 +783,7 @@ void PlaybackFile::skipHeader() {
 		if (_readStream->eos()) {
 			break;
 		}
-		if ((id == kScreenShotTag) || (id == kEventTag) || (id == kMD5Tag)) {
+		if ((id == kScreenShotTag) || (id == kEventTag) || (id == kCompressedEventTag) || (id == kMD5Tag)) {
 			_readStream->seek(-4, SEEK_CUR);
 			return;
 		}
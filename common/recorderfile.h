@@ -102,6 +102,7 @@ class PlaybackFile {
 		kHashSectionTag = MKTAG('H','A','S','H'),
 		kRandomSectionTag = MKTAG('R','A','N','D'),
 		kEventTag = MKTAG('E','V','N','T'),
+		kCompressedEventTag = MKTAG('Z','E','V','T'),
 		kScreenShotTag = MKTAG('T','H','M','B'),
 		kSettingsSectionTag = MKTAG('S','E','T','T'),
 		kAuthorTag = MKTAG('H','A','U','T'),
@@ -204,6 +205,7 @@ private:
 	bool skipToNextScreenshot();
 	void readEvent(RecorderEvent& event);
 	void readEventsToBuffer(uint32 size);
+	void readCompressedEventsToBuffer(uint32 size);
 	bool grabScreenAndComputeMD5(Graphics::Surface &screen, uint8 md5[16]);
 };
 
@@ -201,6 +201,46 @@ public:
 	 */
 	virtual OutSaveFile *openForSaving(const String &name, bool compress = true) = 0;
 
+	/**
+	 * Open the save file with the specified @p name for saving, deferring
+	 * compression and the disk write to a background thread where the
+	 * backend supports it.
+	 *
+	 * The returned stream collects the written data in memory; finalize()
+	 * hands the buffer to a writer thread which compresses it and commits
+	 * the target file atomically. Because the data is buffered in memory,
+	 * the stream is seekable even when @p compress is true.
+	 *
+	 * Errors from the background write surface through getError() only
+	 * once the write has finished; call finishSaving() before reading the
+	 * file back or shutting down to be sure it has been committed.
+	 *
+	 * Backends without background writing fall back to openForSaving().
+	 *
+	 * @param name      Name of the save file.
+	 * @param compress  Whether to compress the resulting save file (default) or not.
+	 *
+	 * @return Pointer to an OutSaveFile, or NULL if an error occurred.
+	 */
+	virtual OutSaveFile *openForSavingAsync(const String &name, bool compress = true) {
+		return openForSaving(name, compress);
+	}
+
+	/**
+	 * Check whether saves opened with openForSavingAsync() are still being
+	 * written out in the background.
+	 *
+	 * @return True if a background write is pending, false otherwise.
+	 */
+	virtual bool isSavingInProgress() const { return false; }
+
+	/**
+	 * Block until all saves opened with openForSavingAsync() have been
+	 * committed to disk. An error from a background write is transferred
+	 * to getError() here.
+	 */
+	virtual void finishSaving() {}
+
 	/**
 	 * Open the file with the specified @p name in the given directory for loading.
 	 *
@@ -22,8 +22,10 @@
 #ifndef COMMON_SERIALIZER_H
 #define COMMON_SERIALIZER_H
 
+#include "common/endian.h"
 #include "common/stream.h"
 #include "common/str.h"
+#include "common/util.h"
 
 namespace Common {
 
@@ -288,15 +290,155 @@ public:
 		}
 	}
 
+	/**
+	 * Sync an array of entries through a per-entry serializer function.
+	 *
+	 * Arrays of fixed-width integers synced through the primitive helpers
+	 * (Serializer::Uint32LE and friends) are recognized and streamed in
+	 * blocks, with one stream call per block and bulk endian conversion,
+	 * instead of one virtual stream call per field.
+	 */
 	template <typename T>
 	void syncArray(T *arr, size_t entries, void (*serializer)(Serializer &, T &), Version minVersion = 0, Version maxVersion = kLastVersion) {
 		if (_version < minVersion || _version > maxVersion)
 			return;
 
+		if (entries > 0 && tryBulkSync(arr, entries, serializer))
+			return;
+
 		for (size_t i = 0; i < entries; ++i) {
 			serializer(*this, arr[i]);
 		}
 	}
+
+private:
+	/** Block-sync @p entries 16-bit fields with bulk endian conversion. */
+	template <typename T>
+	void bulkSync16(T *arr, size_t entries, bool bigEndian) {
+		byte buf[512];
+		while (entries > 0) {
+			const size_t n = MIN<size_t>(entries, sizeof(buf) / 2);
+			if (isLoading()) {
+				_loadStream->read(buf, n * 2);
+				for (size_t i = 0; i < n; ++i)
+					arr[i] = static_cast<T>(bigEndian ? READ_BE_UINT16(buf + i * 2) : READ_LE_UINT16(buf + i * 2));
+			} else {
+				for (size_t i = 0; i < n; ++i) {
+					if (bigEndian)
+						WRITE_BE_UINT16(buf + i * 2, static_cast<uint16>(arr[i]));
+					else
+						WRITE_LE_UINT16(buf + i * 2, static_cast<uint16>(arr[i]));
+				}
+				_saveStream->write(buf, n * 2);
+			}
+			_bytesSynced += n * 2;
+			arr += n;
+			entries -= n;
+		}
+	}
+
+	/** Block-sync @p entries 32-bit fields with bulk endian conversion. */
+	template <typename T>
+	void bulkSync32(T *arr, size_t entries, bool bigEndian) {
+		byte buf[512];
+		while (entries > 0) {
+			const size_t n = MIN<size_t>(entries, sizeof(buf) / 4);
+			if (isLoading()) {
+				_loadStream->read(buf, n * 4);
+				for (size_t i = 0; i < n; ++i)
+					arr[i] = static_cast<T>(bigEndian ? READ_BE_UINT32(buf + i * 4) : READ_LE_UINT32(buf + i * 4));
+			} else {
+				for (size_t i = 0; i < n; ++i) {
+					if (bigEndian)
+						WRITE_BE_UINT32(buf + i * 4, static_cast<uint32>(arr[i]));
+					else
+						WRITE_LE_UINT32(buf + i * 4, static_cast<uint32>(arr[i]));
+				}
+				_saveStream->write(buf, n * 4);
+			}
+			_bytesSynced += n * 4;
+			arr += n;
+			entries -= n;
+		}
+	}
+
+	bool tryBulkSync(byte *arr, size_t entries, void (*serializer)(Serializer &, byte &)) {
+		if (serializer != static_cast<void (*)(Serializer &, byte &)>(Byte))
+			return false;
+		syncBytes(arr, entries);
+		return true;
+	}
+
+	bool tryBulkSync(int8 *arr, size_t entries, void (*serializer)(Serializer &, int8 &)) {
+		if (serializer != static_cast<void (*)(Serializer &, int8 &)>(SByte))
+			return false;
+		syncBytes(reinterpret_cast<byte *>(arr), entries);
+		return true;
+	}
+
+	bool tryBulkSync(uint16 *arr, size_t entries, void (*serializer)(Serializer &, uint16 &)) {
+		// The signed and unsigned helpers of one width and endianness
+		// produce identical bytes, so both take the same bulk path.
+		if (serializer == static_cast<void (*)(Serializer &, uint16 &)>(Uint16LE) ||
+		    serializer == static_cast<void (*)(Serializer &, uint16 &)>(Sint16LE)) {
+			bulkSync16(arr, entries, false);
+			return true;
+		}
+		if (serializer == static_cast<void (*)(Serializer &, uint16 &)>(Uint16BE) ||
+		    serializer == static_cast<void (*)(Serializer &, uint16 &)>(Sint16BE)) {
+			bulkSync16(arr, entries, true);
+			return true;
+		}
+		return false;
+	}
+
+	bool tryBulkSync(int16 *arr, size_t entries, void (*serializer)(Serializer &, int16 &)) {
+		if (serializer == static_cast<void (*)(Serializer &, int16 &)>(Uint16LE) ||
+		    serializer == static_cast<void (*)(Serializer &, int16 &)>(Sint16LE)) {
+			bulkSync16(arr, entries, false);
+			return true;
+		}
+		if (serializer == static_cast<void (*)(Serializer &, int16 &)>(Uint16BE) ||
+		    serializer == static_cast<void (*)(Serializer &, int16 &)>(Sint16BE)) {
+			bulkSync16(arr, entries, true);
+			return true;
+		}
+		return false;
+	}
+
+	bool tryBulkSync(uint32 *arr, size_t entries, void (*serializer)(Serializer &, uint32 &)) {
+		if (serializer == static_cast<void (*)(Serializer &, uint32 &)>(Uint32LE) ||
+		    serializer == static_cast<void (*)(Serializer &, uint32 &)>(Sint32LE)) {
+			bulkSync32(arr, entries, false);
+			return true;
+		}
+		if (serializer == static_cast<void (*)(Serializer &, uint32 &)>(Uint32BE) ||
+		    serializer == static_cast<void (*)(Serializer &, uint32 &)>(Sint32BE)) {
+			bulkSync32(arr, entries, true);
+			return true;
+		}
+		return false;
+	}
+
+	bool tryBulkSync(int32 *arr, size_t entries, void (*serializer)(Serializer &, int32 &)) {
+		if (serializer == static_cast<void (*)(Serializer &, int32 &)>(Uint32LE) ||
+		    serializer == static_cast<void (*)(Serializer &, int32 &)>(Sint32LE)) {
+			bulkSync32(arr, entries, false);
+			return true;
+		}
+		if (serializer == static_cast<void (*)(Serializer &, int32 &)>(Uint32BE) ||
+		    serializer == static_cast<void (*)(Serializer &, int32 &)>(Sint32BE)) {
+			bulkSync32(arr, entries, true);
+			return true;
+		}
+		return false;
+	}
+
+	/** Everything else keeps the per-entry serializer loop. */
+	template <typename T>
+	bool tryBulkSync(T *, size_t, void (*)(Serializer &, T &)) {
+		return false;
+	}
 };
 
 #undef SYNC_PRIMITIVE
@@ -373,6 +373,16 @@ public:
 	 */
 	void trim();
 
+	/**
+	 * Preallocate storage for a string of up to the given length, so that
+	 * appending up to that length does not reallocate. Does not change
+	 * the contents or the size of the string.
+	 */
+	void reserve(uint32 stringLength) {
+		if (stringLength > _size)
+			ensureCapacity(stringLength, true);
+	}
+
 	uint hash() const;
 
 protected:
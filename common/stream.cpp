@@ -19,7 +19,9 @@
  *
  */
 
+#include "common/array.h"
 #include "common/ptr.h"
+#include "common/span.h"
 #include "common/stream.h"
 #include "common/memstream.h"
 #include "common/substream.h"
@@ -110,6 +112,30 @@ Common::String ReadStream::readPascalString(bool transformCR) {
 	return s;
 }
 
+bool SeekableReadStream::readSpanNoCopy(uint32 dataSize, Span<const byte> &span) {
+	return false;
+}
+
+Span<const byte> SeekableReadStream::readSpan(uint32 dataSize, Array<byte> &fallback) {
+	if (dataSize == 0)
+		return Span<const byte>();
+
+	Span<const byte> span;
+	if (readSpanNoCopy(dataSize, span))
+		return span;
+
+	fallback.resize(dataSize);
+	const uint32 bytesRead = read(fallback.begin(), dataSize);
+	return Span<const byte>(fallback.begin(), bytesRead);
+}
+
+Span<const byte> SeekableReadStream::peekSpan(uint32 dataSize, Array<byte> &fallback) {
+	const int64 initialPos = pos();
+	Span<const byte> span = readSpan(dataSize, fallback);
+	seek(initialPos);
+	return span;
+}
+
 uint32 MemoryReadStream::read(void *dataPtr, uint32 dataSize) {
 	if (!dataPtr)
 		return 0;
@@ -127,6 +153,21 @@ uint32 MemoryReadStream::read(void *dataPtr, uint32 dataSize) {
 	return dataSize;
 }
 
+bool MemoryReadStream::readSpanNoCopy(uint32 dataSize, Span<const byte> &span) {
+	// Read at most as many bytes as are still available...
+	if (dataSize > _size - _pos) {
+		dataSize = _size - _pos;
+		_eos = true;
+	}
+
+	span = Span<const byte>(_ptr, dataSize);
+
+	_ptr += dataSize;
+	_pos += dataSize;
+
+	return true;
+}
+
 bool MemoryReadStream::seek(int64 offs, int whence) {
 	// Pre-Condition
 	assert(_pos <= _size);
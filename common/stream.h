@@ -41,6 +41,8 @@ namespace Common {
 
 class ReadStream;
 class SeekableReadStream;
+template<class T> class Array;
+template<typename ValueType> class Span;
 
 /**
  * Virtual base class for both ReadStream and WriteStream.
@@ -836,6 +838,31 @@ public:
 	 */
 	virtual String readLine(bool handleCR = true);
 
+	/**
+	 * Read @p dataSize bytes from the stream and return them as a span.
+	 *
+	 * Streams backed by memory, such as MemoryReadStream, return a view
+	 * into their buffer without copying; that view stays valid at least
+	 * until the next seek on the stream, and becomes invalid when the
+	 * stream is destroyed. Other streams read into @p fallback, resizing
+	 * it as needed; the view then stays valid until @p fallback is
+	 * modified or destroyed.
+	 *
+	 * In either case the stream position advances by the number of bytes
+	 * actually read, and the returned span is shorter than @p dataSize
+	 * when the end of the stream is reached.
+	 *
+	 * @param dataSize	Number of bytes to read.
+	 * @param fallback	Buffer used when the stream cannot return a view.
+	 */
+	Span<const byte> readSpan(uint32 dataSize, Array<byte> &fallback);
+
+	/**
+	 * Like readSpan(), but restores the stream position afterwards, so
+	 * the data can be examined without consuming it.
+	 */
+	Span<const byte> peekSpan(uint32 dataSize, Array<byte> &fallback);
+
 	/**
 	 * Print a hexdump of the stream while maintaing position. The number
 	 * of bytes per line is customizable.
@@ -845,6 +872,15 @@ public:
 	 * @param startOffset	Shift the shown offsets by the starting offset (default: 0).
 	 */
 	void hexdump(int len, int bytesPerLine = 16, int startOffset = 0);
+
+protected:
+	/**
+	 * Hook for readSpan(): streams whose contents live in memory override
+	 * this to store a view into their buffer in @p span, advance their
+	 * position and return true. The default returns false, which makes
+	 * readSpan() fall back to copying.
+	 */
+	virtual bool readSpanNoCopy(uint32 dataSize, Span<const byte> &span);
 };
 
 /**
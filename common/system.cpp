@@ -25,6 +25,7 @@
 #include "common/events.h"
 #include "common/fs.h"
 #include "common/file.h"
+#include "common/memorypool.h"
 #include "common/savefile.h"
 #include "common/str.h"
 #include "common/taskbar.h"
@@ -272,6 +273,13 @@ Common::TimerManager *OSystem::getTimerManager() {
 	return _timerManager;
 }
 
+Common::Arena &OSystem::getScratchArena() {
+	// Created on first use and never destroyed, so that it is available
+	// during late shutdown as well.
+	static Common::Arena *arena = new Common::Arena(16 * 1024);
+	return *arena;
+}
+
 Common::SaveFileManager *OSystem::getSavefileManager() {
 	return _savefileManager;
 }
@@ -53,6 +53,7 @@ class Store;
 }
 
 namespace Common {
+class Arena;
 class EventManager;
 class MutexInternal;
 struct Rect;
@@ -1580,6 +1581,19 @@ public:
 	 */
 	virtual Common::TimerManager *getTimerManager();
 
+	/**
+	 * Return the scratch arena for short-lived, frame-local allocations
+	 * on the main thread.
+	 *
+	 * The code driving the active main loop is expected to reset() the
+	 * arena once per frame (the GUI does this for its own loop); code
+	 * that merely borrows it should use Common::ArenaScope so that its
+	 * temporaries are released even when nobody resets the arena.
+	 *
+	 * For more information, see @ref Common::Arena.
+	 */
+	Common::Arena &getScratchArena();
+
 	/**
 	 * Return the event manager singleton.
 	 *
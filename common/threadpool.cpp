@@ -0,0 +1,226 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Disable symbol overrides so that we can use the POSIX thread API
+// (pthread.h drags in time.h, and we use unistd.h for sysconf())
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+#define FORBIDDEN_SYMBOL_EXCEPTION_unistd_h
+
+#include "common/threadpool.h"
+
+#if defined(POSIX)
+#define THREADPOOL_USE_PTHREADS
+#endif
+
+#ifdef THREADPOOL_USE_PTHREADS
+
+#include <pthread.h>
+#include <unistd.h>
+
+namespace Common {
+
+struct ThreadPool::PoolImpl {
+	pthread_mutex_t mutex;
+	pthread_cond_t workAvailable;
+	pthread_cond_t workDone;
+
+	// The current batch. proc == nullptr means "no work"; quit tells the
+	// workers to exit instead of waiting for the next batch.
+	TaskProc proc;
+	void *data;
+	uint taskCount;
+	uint nextTask;    ///< next index to hand out
+	uint doneTasks;   ///< indices fully processed in this batch
+	uint generation;  ///< bumped per batch so sleeping workers can tell batches apart
+	bool quit;
+
+	uint workerCount;
+	pthread_t *workers;
+
+	static void *workerMain(void *pool);
+	void workLoop(bool isWorker);
+};
+
+void *ThreadPool::PoolImpl::workerMain(void *pool) {
+	PoolImpl *impl = (PoolImpl *)pool;
+
+	pthread_mutex_lock(&impl->mutex);
+	for (;;) {
+		// Sleep unless there is still an unclaimed index. A batch whose
+		// indices are all claimed but not yet finished offers nothing to
+		// do here; the threads running the last tasks will complete it.
+		while (!impl->quit && (impl->proc == nullptr || impl->nextTask >= impl->taskCount))
+			pthread_cond_wait(&impl->workAvailable, &impl->mutex);
+		if (impl->quit)
+			break;
+
+		impl->workLoop(true);
+	}
+	pthread_mutex_unlock(&impl->mutex);
+	return nullptr;
+}
+
+// Pulls indices from the current batch until it is drained. Called with
+// the mutex held; the mutex is released while a task runs.
+void ThreadPool::PoolImpl::workLoop(bool isWorker) {
+	const uint myGeneration = generation;
+	const TaskProc myProc = proc;
+	void *const myData = data;
+
+	while (proc != nullptr && generation == myGeneration && nextTask < taskCount) {
+		const uint index = nextTask++;
+
+		pthread_mutex_unlock(&mutex);
+		myProc(myData, index);
+		pthread_mutex_lock(&mutex);
+
+		if (++doneTasks == taskCount) {
+			proc = nullptr;
+			pthread_cond_broadcast(&workDone);
+		}
+	}
+}
+
+ThreadPool::ThreadPool(uint numThreads) : _impl(nullptr), _workerCount(0) {
+	if (numThreads == 0)
+		numThreads = hardwareThreads();
+
+	_impl = new PoolImpl();
+	pthread_mutex_init(&_impl->mutex, nullptr);
+	pthread_cond_init(&_impl->workAvailable, nullptr);
+	pthread_cond_init(&_impl->workDone, nullptr);
+	_impl->proc = nullptr;
+	_impl->data = nullptr;
+	_impl->taskCount = _impl->nextTask = _impl->doneTasks = 0;
+	_impl->generation = 0;
+	_impl->quit = false;
+	_impl->workers = new pthread_t[numThreads];
+	_impl->workerCount = 0;
+
+	// The calling thread works too, so start one thread less than the
+	// requested level of parallelism.
+	for (uint i = 0; i + 1 < numThreads; ++i) {
+		if (pthread_create(&_impl->workers[i], nullptr, PoolImpl::workerMain, _impl) != 0)
+			break;
+		_impl->workerCount++;
+	}
+	_workerCount = _impl->workerCount;
+}
+
+ThreadPool::~ThreadPool() {
+	pthread_mutex_lock(&_impl->mutex);
+	_impl->quit = true;
+	pthread_cond_broadcast(&_impl->workAvailable);
+	pthread_mutex_unlock(&_impl->mutex);
+
+	for (uint i = 0; i < _impl->workerCount; ++i)
+		pthread_join(_impl->workers[i], nullptr);
+
+	pthread_mutex_destroy(&_impl->mutex);
+	pthread_cond_destroy(&_impl->workAvailable);
+	pthread_cond_destroy(&_impl->workDone);
+	delete[] _impl->workers;
+	delete _impl;
+}
+
+void ThreadPool::runTasks(TaskProc proc, void *data, uint count) {
+	if (count == 0)
+		return;
+
+	if (_workerCount == 0) {
+		for (uint i = 0; i < count; ++i)
+			proc(data, i);
+		return;
+	}
+
+	pthread_mutex_lock(&_impl->mutex);
+
+	// Serialize submitters: if another thread has a batch in flight, wait
+	// for it to drain before starting ours. The original submitter also
+	// waits on workDone, but checks its generation, so both wake correctly
+	// when the running batch completes.
+	while (_impl->proc != nullptr)
+		pthread_cond_wait(&_impl->workDone, &_impl->mutex);
+
+	_impl->proc = proc;
+	_impl->data = data;
+	_impl->taskCount = count;
+	_impl->nextTask = 0;
+	_impl->doneTasks = 0;
+	_impl->generation++;
+	pthread_cond_broadcast(&_impl->workAvailable);
+
+	// Help drain the batch, then wait for stragglers.
+	_impl->workLoop(false);
+	const uint myGeneration = _impl->generation;
+	while (_impl->proc != nullptr && _impl->generation == myGeneration)
+		pthread_cond_wait(&_impl->workDone, &_impl->mutex);
+	pthread_mutex_unlock(&_impl->mutex);
+}
+
+uint ThreadPool::hardwareThreads() {
+#ifdef _SC_NPROCESSORS_ONLN
+	const long count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (count > 0)
+		return (uint)count;
+#endif
+	return 1;
+}
+
+} // End of namespace Common
+
+#else
+
+namespace Common {
+
+// No thread support on this platform: the pool is a stub and runTasks()
+// executes everything on the calling thread.
+
+struct ThreadPool::PoolImpl {};
+
+ThreadPool::ThreadPool(uint numThreads) : _impl(nullptr), _workerCount(0) {
+}
+
+ThreadPool::~ThreadPool() {
+}
+
+void ThreadPool::runTasks(TaskProc proc, void *data, uint count) {
+	for (uint i = 0; i < count; ++i)
+		proc(data, i);
+}
+
+uint ThreadPool::hardwareThreads() {
+	return 1;
+}
+
+} // End of namespace Common
+
+#endif
+
+namespace Common {
+
+ThreadPool &ThreadPool::instance() {
+	// Never destroyed; workers may still be parked in it at exit time.
+	static ThreadPool *pool = new ThreadPool();
+	return *pool;
+}
+
+} // End of namespace Common
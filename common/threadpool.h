@@ -0,0 +1,112 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_THREADPOOL_H
+#define COMMON_THREADPOOL_H
+
+#include "common/scummsys.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_threadpool Thread pool
+ * @ingroup common
+ *
+ * @brief A small pool of worker threads for data-parallel work.
+ *
+ * @{
+ */
+
+/**
+ * A fixed pool of worker threads that executes a batch of independent,
+ * indexed tasks and waits for all of them to finish.
+ *
+ * This is meant for embarrassingly parallel work such as scaling or
+ * decoding independent bands of an image: the caller hands in a function
+ * and a task count, each worker repeatedly grabs the next unprocessed
+ * index, and runTasks() returns once every index has been handled.
+ *
+ * On platforms without thread support the pool degrades to running all
+ * tasks serially on the calling thread, so callers do not need their own
+ * fallback path; they can check workerCount() if they want to skip the
+ * slicing overhead entirely.
+ *
+ * The task function must not touch the pool itself and must not assume
+ * anything about the order or the thread on which indices run.
+ */
+class ThreadPool {
+public:
+	typedef void (*TaskProc)(void *data, uint index);
+
+	/**
+	 * Create a pool.
+	 *
+	 * @param numThreads Number of worker threads, or 0 to use one per
+	 *                   logical CPU as reported by the OS.
+	 */
+	explicit ThreadPool(uint numThreads = 0);
+	~ThreadPool();
+
+	/**
+	 * Number of worker threads actually running. 0 means the pool could
+	 * not start any threads and runTasks() will execute serially.
+	 */
+	uint workerCount() const { return _workerCount; }
+
+	/**
+	 * Run proc(data, index) for every index in [0, count) and block
+	 * until all of them have completed. The calling thread participates
+	 * in the work, so a pool is useful even with a single worker.
+	 *
+	 * Concurrent calls from different threads are safe: submitters are
+	 * serialized, so a second batch blocks until the one in flight has
+	 * drained. Must not be called from inside a task.
+	 */
+	void runTasks(TaskProc proc, void *data, uint count);
+
+	/** Number of logical CPUs, or 1 if it cannot be determined. */
+	static uint hardwareThreads();
+
+	/**
+	 * The shared process-wide pool, created on first use and sized to the
+	 * hardware concurrency. Subsystems that slice frame-sized work
+	 * (scalers, color conversion, software rasterization) should use this
+	 * instead of growing a private pool, so that they do not oversubscribe
+	 * the CPU when several of them are active in the same frame.
+	 *
+	 * On single-core machines and ports without thread support the
+	 * instance has workerCount() == 0 and runTasks() executes serially.
+	 * Only callers with special sizing needs (e.g. I/O bound work wanting
+	 * more threads than cores) should still construct their own pool.
+	 */
+	static ThreadPool &instance();
+
+private:
+	struct PoolImpl;
+	PoolImpl *_impl;
+	uint _workerCount;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
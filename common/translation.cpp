@@ -44,7 +44,7 @@ bool operator<(const TLanguage &l, const TLanguage &r) {
 	return l.name < r.name;
 }
 
-TranslationManager::TranslationManager(const Common::String &fileName) : _currentLang(-1) {
+TranslationManager::TranslationManager(const Common::String &fileName) : _currentLang(-1), _messageIdsLoaded(false) {
 	loadTranslationsInfoDat(fileName);
 
 	// Set the default language
@@ -306,6 +306,43 @@ void TranslationManager::loadTranslationsInfoDat(const Common::String &name) {
 		_langNames[i] = String(buf, len - 1);
 	}
 
+	// The message ids that follow are only needed to look up translations,
+	// so they are loaded lazily by loadMessageIds() once a language is
+	// actually selected. English configurations never parse them.
+}
+
+void TranslationManager::loadMessageIds() {
+	if (_messageIdsLoaded)
+		return;
+
+	// Do not retry on failure: the file will not get any better until the
+	// language changes again, and loadLanguageDat() already warned.
+	_messageIdsLoaded = true;
+
+	File in;
+	if (!openTranslationsFile(in))
+		return;
+
+	char buf[256];
+	int len;
+
+	// Get number of translations
+	int nbTranslations = in.readUint16BE();
+
+	// Skip translation description & size for the original language (english) block
+	// Also skip size of each translation block. Each block is written in Uint32BE.
+	for (int i = 0; i < nbTranslations + 2; i++) {
+		in.readUint32BE();
+	}
+
+	// Skip the list of languages
+	for (int i = 0; i < nbTranslations; ++i) {
+		len = in.readUint16BE();
+		in.skip(len);
+		len = in.readUint16BE();
+		in.skip(len);
+	}
+
 	// Read messages
 	int numMessages = in.readUint16BE();
 	_messageIds.resize(numMessages);
@@ -327,9 +364,15 @@ void TranslationManager::loadLanguageDat(int index) {
 	if (index < 0 || index >= (int)_langs.size()) {
 		if (index != -1)
 			warning("Invalid language index %d passed to TranslationManager::loadLanguageDat", index);
+		// Back to the builtin language: the message ids are no longer
+		// needed, release them.
+		_messageIds.clear();
+		_messageIdsLoaded = false;
 		return;
 	}
 
+	loadMessageIds();
+
 	File in;
 	if (!openTranslationsFile(in))
 		return;
@@ -234,6 +234,14 @@ private:
 	 */
 	void loadLanguageDat(int index);
 
+	/**
+	 * Load the message ids from the translations.dat file, if not already loaded.
+	 *
+	 * They are only needed once a translation is active, so English
+	 * configurations never pay for parsing them.
+	 */
+	void loadMessageIds();
+
 	/**
 	 * Check the header of the given file to make sure it is a valid translations data file.
 	 */
@@ -243,6 +251,7 @@ private:
 	StringArray _langNames;
 
 	StringArray _messageIds;
+	bool _messageIdsLoaded;
 	Array<PoMessageEntry> _currentTranslationMessages;
 	int _currentLang;
 	Common::String _translationsFileName;
@@ -21,8 +21,11 @@
 
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
+#include "common/array.h"
 #include "common/ustr.h"
 #include "common/unicode-bidi.h"
+#include "common/memorypool.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 #ifdef USE_FRIBIDI
@@ -31,6 +34,43 @@
 
 namespace Common {
 
+#ifdef USE_FRIBIDI
+namespace {
+
+// Reordering is a pure function of the logical string and the paragraph
+// direction, and the GUI converts the same labels over and over: every
+// ThemeEngine::drawText call on RTL locales comes through here, once per
+// frame per widget. Keep the most recent results in a small direct-mapped
+// cache. Since the mapping never changes, no invalidation is needed.
+struct BiDiCacheEntry {
+	bool valid;
+	uint32 inDir;  // paragraph direction the conversion was requested with
+	uint32 outDir; // direction resolved by fribidi
+	U32String logical;
+	U32String visual;
+	Array<uint32> logToVis;
+	Array<uint32> visToLog;
+
+	BiDiCacheEntry() : valid(false), inDir(0), outDir(0) {}
+};
+
+enum {
+	kBiDiCacheSize = 64,
+	kBiDiCacheMaxLength = 256
+};
+
+BiDiCacheEntry s_bidiCache[kBiDiCacheSize];
+
+uint32 bidiCacheHash(const U32String &str, uint32 dir) {
+	uint32 hash = dir;
+	for (uint32 i = 0; i < str.size(); i++)
+		hash = hash * 31 + str[i];
+	return hash;
+}
+
+} // End of anonymous namespace
+#endif
+
 uint32 GetFriBiDiParType(BiDiParagraph dir) {
 #ifdef USE_FRIBIDI
 	if (dir == BIDI_PAR_ON) {
@@ -79,8 +119,30 @@ void UnicodeBiDiText::initWithU32String(const U32String &input) {
 
 #ifdef USE_FRIBIDI
 	uint32 input_size = input.size();
+
+	BiDiCacheEntry *cached = nullptr;
+	if (input_size > 0 && input_size <= kBiDiCacheMaxLength) {
+		cached = &s_bidiCache[bidiCacheHash(input, _pbase_dir) % kBiDiCacheSize];
+		if (cached->valid && cached->inDir == _pbase_dir && cached->logical == input) {
+			_log_to_vis_index = new uint32[input_size];
+			_vis_to_log_index = new uint32[input_size];
+			memcpy(_log_to_vis_index, &cached->logToVis[0], input_size * sizeof(uint32));
+			memcpy(_vis_to_log_index, &cached->visToLog[0], input_size * sizeof(uint32));
+			visual = cached->visual;
+			_pbase_dir = cached->outDir;
+			return;
+		}
+	}
+
+	const uint32 requestedDir = _pbase_dir;
 	uint32 buff_length = (input_size + 2) * 2;		// it's more than enough, but it's better to be on the safe side
-	FriBidiChar *visual_str = new FriBidiChar[buff_length * sizeof(FriBidiChar)];
+	// The visual string is copied into a U32String below, so it only
+	// lives for the duration of this call: carve it out of the scratch
+	// arena instead of the heap. Text conversion runs once per drawn
+	// string, which made this allocation show up on slow-malloc targets.
+	Arena &scratch = g_system->getScratchArena();
+	ArenaScope scratchScope(scratch);
+	FriBidiChar *visual_str = scratch.allocArray<FriBidiChar>(buff_length);
 	_log_to_vis_index = new uint32[input_size];
 	_vis_to_log_index = new uint32[input_size];
 
@@ -97,7 +159,6 @@ void UnicodeBiDiText::initWithU32String(const U32String &input) {
 		nullptr									// embedding_level_list
 	)) {
 		warning("initWithU32String: calling fribidi_log2vis failed");
-		delete[] visual_str;
 		delete[] _log_to_vis_index;
 		delete[] _vis_to_log_index;
 		visual = input;
@@ -105,9 +166,19 @@ void UnicodeBiDiText::initWithU32String(const U32String &input) {
 		_vis_to_log_index = nullptr;
 	} else {
 		visual = U32String((Common::u32char_type_t *)visual_str, input.size());
-		delete[] visual_str;
 	}
 	_pbase_dir = pbase_dir;
+
+	// Remember successful conversions; failures keep retrying.
+	if (cached && _log_to_vis_index) {
+		cached->valid = true;
+		cached->inDir = requestedDir;
+		cached->outDir = _pbase_dir;
+		cached->logical = input;
+		cached->visual = visual;
+		cached->logToVis = Array<uint32>(_log_to_vis_index, input_size);
+		cached->visToLog = Array<uint32>(_vis_to_log_index, input_size);
+	}
 #else
 	static bool fribidiWarning = true;
 	if (fribidiWarning) {
@@ -34,13 +34,46 @@ namespace Common {
 DECLARE_SINGLETON(AchievementsManager);
 
 
+// Stat counters can be updated every frame by achievement-happy games, so
+// their writes are batched: setters only mark the ini file dirty and it is
+// flushed to the save file at most once per this period. Unlocks, resets
+// and shutdown always flush immediately.
+static const uint32 kStatsFlushPeriodMillis = 5000;
+
 AchievementsManager::AchievementsManager() {
 	_iniFile = nullptr;
+	_iniDirty = false;
+	_iniDirtyTime = 0;
 	unsetActiveDomain();
 }
 
 
 AchievementsManager::~AchievementsManager() {
+	if (isReady()) {
+		flushIfDirty(true);
+	}
+}
+
+
+void AchievementsManager::setDirty() const {
+	if (!_iniDirty) {
+		_iniDirty = true;
+		_iniDirtyTime = g_system->getMillis();
+	}
+}
+
+
+void AchievementsManager::flushIfDirty(bool force) const {
+	if (!_iniDirty) {
+		return;
+	}
+
+	if (!force && g_system->getMillis() - _iniDirtyTime < kStatsFlushPeriodMillis) {
+		return;
+	}
+
+	_iniFile->saveToSaveFile(_iniFileName);
+	_iniDirty = false;
 }
 
 bool AchievementsManager::setActiveDomain(const AchievementsInfo &info) {
@@ -198,6 +231,10 @@ bool AchievementsManager::loadAchievementsData(const char *platform, const char
 bool AchievementsManager::unsetActiveDomain() {
 	debug(2, "AchievementsManager::unsetActiveDomain()");
 
+	if (_iniFile) {
+		flushIfDirty(true);
+	}
+
 	_iniFileName = "";
 
 	delete _iniFile;
@@ -234,7 +271,8 @@ bool AchievementsManager::setAchievement(const String &id) {
 	debug(2, "AchievementsManager::setAchievement('%s'): '%s'", id.c_str(), displayedMessage.c_str());
 
 	_iniFile->setKey(id, "achievements", "true");
-	_iniFile->saveToSaveFile(_iniFileName);
+	setDirty();
+	flushIfDirty(true);
 
 	if (!ConfMan.getBool("disable_achievement_unlocked_osd") && !displayedMessage.empty() && g_system) {
 		U32String msg;
@@ -264,7 +302,8 @@ bool AchievementsManager::clearAchievement(const String &id) {
 	}
 
 	_iniFile->removeKey(id, "achievements");
-	_iniFile->saveToSaveFile(_iniFileName);
+	setDirty();
+	flushIfDirty(true);
 	return true;
 }
 
@@ -276,7 +315,8 @@ bool AchievementsManager::setStatFloatEx(const String &id, float value, const St
 
 	String tmp = Common::String::format("%8.8f", value);
 	_iniFile->setKey(id, section, tmp);
-	_iniFile->saveToSaveFile(_iniFileName);
+	setDirty();
+	flushIfDirty(false);
 	return 0;
 }
 
@@ -336,7 +376,8 @@ bool AchievementsManager::setStatInt(String const &id, int value) {
 
 	String tmp = Common::String::format("%d", value);
 	_iniFile->setKey(id, "statistics", tmp);
-	_iniFile->saveToSaveFile(_iniFileName);
+	setDirty();
+	flushIfDirty(false);
 	return 0;
 }
 
@@ -369,7 +410,8 @@ bool AchievementsManager::setSpecialString(String const &id, String const &value
 	}
 
 	_iniFile->setKey(id, "special", value);
-	_iniFile->saveToSaveFile(_iniFileName);
+	setDirty();
+	flushIfDirty(false);
 	return 0;
 }
 
@@ -380,7 +422,8 @@ bool AchievementsManager::resetAllAchievements() {
 	}
 
 	_iniFile->removeSection("achievements");
-	_iniFile->saveToSaveFile(_iniFileName);
+	setDirty();
+	flushIfDirty(true);
 	return 0;
 }
 
@@ -392,7 +435,8 @@ bool AchievementsManager::resetAllStats() {
 
 	_iniFile->removeSection("statistics");
 	_iniFile->removeSection("rates");
-	_iniFile->saveToSaveFile(_iniFileName);
+	setDirty();
+	flushIfDirty(true);
 	return 0;
 }
 
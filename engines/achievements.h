@@ -268,8 +268,23 @@ private:
 	float getStatFloatEx(const String &id, const String &section) const;
 	bool setStatFloatEx(const String &id, float value, const String &section) const;
 
+	/**
+	 * Mark the ini file as having unsaved changes.
+	 *
+	 * All getters read from the in-memory ini file, so writes do not have
+	 * to reach storage immediately. Stat updates can happen every frame
+	 * and are only flushed periodically; unlocks, resets and shutdown
+	 * flush right away.
+	 */
+	void setDirty() const;
+
+	/** Write the ini file out if it has unsaved changes. */
+	void flushIfDirty(bool force) const;
+
 	INIFile *_iniFile;
 	String _iniFileName;
+	mutable bool _iniDirty;
+	mutable uint32 _iniDirtyTime;
 	Common::Array<StatDescription> _stats;
 	Common::HashMap<String, Common::Array<AchievementDescription> > _achievements;
 };
@@ -548,16 +548,153 @@ bool AdvancedMetaEngineDetectionBase::getFileProperties(const FileMap &allFiles,
 		return true;
 	}
 
+	// Next, consult the on-disk cache, which survives between runs. It is
+	// keyed by the absolute path (so identical relative names in different
+	// game directories cannot collide) and only used for plain files:
+	// Mac forks and archive members have no cheaply checkable size.
+	Common::String diskKey;
+	int64 diskSize = -1;
+	if (!(md5prop & (kMD5MacResFork | kMD5MacDataFork | kMD5Archive)) && allFiles.contains(fname)) {
+		diskKey = md5PropToCachePrefix(md5prop);
+		diskKey += ':';
+		diskKey += allFiles[fname].getPath().toString('/');
+		diskKey += ':';
+		diskKey += Common::String::format("%d", _md5Bytes);
+
+		Common::SeekableReadStream *probe = allFiles[fname].createReadStream();
+		if (probe) {
+			diskSize = probe->size();
+			delete probe;
+
+			Common::String md5;
+			if (ADCacheMan.lookupPersistentMD5(diskKey, diskSize, md5)) {
+				fileProps.md5 = md5;
+				fileProps.size = diskSize;
+				fileProps.md5prop = (MD5Properties)(md5prop & kMD5Tail);
+				ADCacheMan.setMD5(hashname, fileProps.md5);
+				ADCacheMan.setSize(hashname, fileProps.size);
+				return true;
+			}
+		}
+	}
+
 	bool res = getFilePropertiesIntern(_md5Bytes, allFiles, md5prop, fname, fileProps);
 
 	if (res) {
 		ADCacheMan.setMD5(hashname, fileProps.md5);
 		ADCacheMan.setSize(hashname, fileProps.size);
+
+		if (!diskKey.empty() && fileProps.size == diskSize)
+			ADCacheMan.storePersistentMD5(diskKey, fileProps.size, fileProps.md5);
 	}
 
 	return res;
 }
 
+namespace {
+
+Common::FSNode persistentMD5CacheNode() {
+	Common::FSNode configFile(g_system->getDefaultConfigFileName());
+	Common::FSNode dir = configFile.getParent();
+	if (!dir.isDirectory())
+		return Common::FSNode();
+	return dir.getChild("scummvm-md5.cache");
+}
+
+} // End of anonymous namespace
+
+// On-disk format: one entry per line, "<size> <md5> <key>". The key goes
+// last since it may contain spaces.
+void AdvancedDetectorCacheManager::loadPersistentMD5Cache() {
+	persistentLoaded = true;
+
+	Common::FSNode node = persistentMD5CacheNode();
+	if (!node.exists())
+		return;
+
+	Common::ScopedPtr<Common::SeekableReadStream> stream(node.createReadStream());
+	if (!stream)
+		return;
+
+	uint count = 0;
+	while (!stream->eos()) {
+		Common::String line = stream->readLine();
+		if (line.empty())
+			continue;
+
+		uint32 firstSpace = line.findFirstOf(' ');
+		if (firstSpace == Common::String::npos)
+			continue;
+		uint32 secondSpace = line.findFirstOf(' ', firstSpace + 1);
+		if (secondSpace == Common::String::npos)
+			continue;
+
+		PersistentMD5Entry entry;
+		entry.size = (int64)strtoll(line.substr(0, firstSpace).c_str(), nullptr, 10);
+		entry.md5 = line.substr(firstSpace + 1, secondSpace - firstSpace - 1);
+		Common::String key = line.substr(secondSpace + 1);
+
+		if (key.empty() || entry.md5.size() != 32)
+			continue;
+
+		persistentMD5Map.setVal(key, entry);
+		count++;
+	}
+
+	debugC(1, kDebugGlobalDetection, "Loaded %u entries from the persistent MD5 cache", count);
+}
+
+bool AdvancedDetectorCacheManager::lookupPersistentMD5(const Common::String &key, int64 size, Common::String &md5) {
+	if (!persistentLoaded)
+		loadPersistentMD5Cache();
+
+	PersistentMD5Map::const_iterator it = persistentMD5Map.find(key);
+	if (it == persistentMD5Map.end())
+		return false;
+
+	if (it->_value.size != size) {
+		// The file changed since the entry was recorded; drop it. The
+		// caller will recompute and store a fresh entry.
+		persistentMD5Map.erase(key);
+		persistentDirty = true;
+		return false;
+	}
+
+	md5 = it->_value.md5;
+	return true;
+}
+
+void AdvancedDetectorCacheManager::storePersistentMD5(const Common::String &key, int64 size, const Common::String &md5) {
+	if (!persistentLoaded)
+		loadPersistentMD5Cache();
+
+	PersistentMD5Entry entry;
+	entry.size = size;
+	entry.md5 = md5;
+	persistentMD5Map.setVal(key, entry);
+	persistentDirty = true;
+}
+
+void AdvancedDetectorCacheManager::savePersistentMD5Cache() {
+	if (!persistentDirty)
+		return;
+
+	Common::FSNode node = persistentMD5CacheNode();
+	if (node.getPath().empty())
+		return;
+
+	Common::ScopedPtr<Common::SeekableWriteStream> stream(node.createWriteStream());
+	if (!stream) {
+		warning("Could not write the persistent MD5 cache to '%s'", node.getPath().toString().c_str());
+		return;
+	}
+
+	for (PersistentMD5Map::const_iterator it = persistentMD5Map.begin(); it != persistentMD5Map.end(); ++it)
+		stream->writeString(Common::String::format("%lld %s %s\n", (long long)it->_value.size, it->_value.md5.c_str(), it->_key.c_str()));
+
+	persistentDirty = false;
+}
+
 bool AdvancedMetaEngineBase::getFilePropertiesExtern(uint md5Bytes, const FileMap &allFiles, MD5Properties md5prop, const Common::Path &fname, FileProperties &fileProps) const {
 	return getFilePropertiesIntern(md5Bytes, allFiles, md5prop, fname, fileProps);
 }
@@ -719,28 +856,19 @@ ADDetectedGames AdvancedMetaEngineDetectionBase::detectGame(const Common::FSNode
 
 	// Check which files are included in some ADGameDescription *and* whether
 	// they are present. Compute MD5s and file sizes for the available files.
-	for (descPtr = _gameDescriptors; ((const ADGameDescription *)descPtr)->gameId != nullptr; descPtr += _descItemSize) {
-		g = (const ADGameDescription *)descPtr;
-
-		for (fileDesc = g->filesDescriptions; fileDesc->fileName; fileDesc++) {
-			MD5Properties md5prop = gameFileToMD5Props(fileDesc, g->flags);
-			Common::String fname = fileDesc->fileName;
-			Common::String key = md5PropToCachePrefix(md5prop);
-				key += ':';
-				key += fname;
-
-			if (filesProps.contains(key))
-				continue;
-
-			FileProperties tmp;
-			if (getFileProperties(allFiles, md5prop, Common::Path(fname), tmp)) {
-				debugC(3, kDebugGlobalDetection, "> '%s': '%s' %ld", key.c_str(), tmp.md5.c_str(), long(tmp.size));
-			}
-
-			// Both positive and negative results are cached to avoid
-			// repeatedly checking for files.
-			filesProps[key] = tmp;
+	// preprocessDescriptions() collected the unique file list up front, so
+	// this only walks each referenced file once instead of the whole table.
+	for (uint fileIdx = 0; fileIdx < _detectionFiles.size(); ++fileIdx) {
+		const DetectionFile &df = _detectionFiles[fileIdx];
+
+		FileProperties tmp;
+		if (getFileProperties(allFiles, df.md5prop, Common::Path(df.fileName), tmp)) {
+			debugC(3, kDebugGlobalDetection, "> '%s': '%s' %ld", df.cacheKey.c_str(), tmp.md5.c_str(), long(tmp.size));
 		}
+
+		// Both positive and negative results are cached to avoid
+		// repeatedly checking for files.
+		filesProps[df.cacheKey] = tmp;
 	}
 
 	int maxFilesMatched = 0;
@@ -768,6 +896,14 @@ ADDetectedGames AdvancedMetaEngineDetectionBase::detectGame(const Common::FSNode
 			continue;
 		}
 
+		// An entry can only have all of its files present when its first
+		// file is, and the properties cache above already knows that.
+		// This rejects the vast majority of entries without building any
+		// per-file cache keys.
+		if (_firstFileIndex[i] != kNoDetectionFile &&
+				filesProps[_detectionFiles[_firstFileIndex[i]].cacheKey].size == -1)
+			continue;
+
 		ADDetectedGame game(g);
 		bool allFilesPresent = true;
 		int curFilesMatched = 0;
@@ -983,11 +1119,42 @@ void AdvancedMetaEngineDetectionBase::preprocessDescriptions() {
 	}
 
 	// Now scan all detection entries
+	Common::HashMap<Common::String, uint32> keyIndexMap;
 	for (const byte *descPtr = _gameDescriptors; ((const ADGameDescription *)descPtr)->gameId != nullptr; descPtr += _descItemSize) {
 		const ADGameDescription *g = (const ADGameDescription *)descPtr;
 
+		bool firstFile = true;
+
 		// Scan for potential directory globs
 		for (const ADGameFileDescription *fileDesc = g->filesDescriptions; fileDesc->fileName; fileDesc++) {
+			// Collect the unique set of files referenced by the table, and
+			// remember where each entry's first file sits in that set, so
+			// detectGame() can work from this list instead of rescanning
+			// the whole table for every directory
+			MD5Properties md5prop = gameFileToMD5Props(fileDesc, g->flags);
+			Common::String key = md5PropToCachePrefix(md5prop);
+			key += ':';
+			key += fileDesc->fileName;
+
+			uint32 keyIndex;
+			if (keyIndexMap.contains(key)) {
+				keyIndex = keyIndexMap[key];
+			} else {
+				keyIndex = _detectionFiles.size();
+				keyIndexMap[key] = keyIndex;
+
+				DetectionFile df;
+				df.cacheKey = key;
+				df.fileName = fileDesc->fileName;
+				df.md5prop = md5prop;
+				_detectionFiles.push_back(df);
+			}
+
+			if (firstFile) {
+				_firstFileIndex.push_back(keyIndex);
+				firstFile = false;
+			}
+
 			if (strchr(fileDesc->fileName, '/')) {
 				if (!(_flags & kADFlagMatchFullPaths))
 					warning("Path component detected in entry for '%s:%s' but no kADFlagMatchFullPaths is set",
@@ -1016,6 +1183,10 @@ void AdvancedMetaEngineDetectionBase::preprocessDescriptions() {
 			}
 		}
 
+		// Entries without any files cannot be rejected by file presence
+		if (firstFile)
+			_firstFileIndex.push_back(kNoDetectionFile);
+
 		// Check if the detection entry have only files from the blacklist
 		if (isEntryGrayListed(g)) {
 			debug(0, "WARNING: Detection entry for '%s:%s' contains only blacklisted names. Add more files to the entry (%s)",
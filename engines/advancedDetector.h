@@ -552,6 +552,25 @@ private:
 	void detectClashes() const;
 
 private:
+	/**
+	 * One unique detection file of the description table: the properties
+	 * cache key used by detectGame() together with what is needed to
+	 * compute the file properties. Collected once by
+	 * preprocessDescriptions(), so detectGame() does not have to rescan
+	 * the whole table for every directory it looks at.
+	 */
+	struct DetectionFile {
+		Common::String cacheKey;
+		Common::String fileName;
+		MD5Properties md5prop;
+	};
+
+	enum : uint32 { kNoDetectionFile = 0xFFFFFFFFu };
+
+	Common::Array<DetectionFile> _detectionFiles;
+	/** For each table entry, the index of its first file in _detectionFiles. */
+	Common::Array<uint32> _firstFileIndex;
+
 	Common::HashMap<Common::String, bool, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> _grayListMap;
 	Common::HashMap<Common::String, bool, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> _globsMap;
 	bool _hashMapsInited;
@@ -778,7 +797,7 @@ public:
 		return archiveHashMap.getValOrDefault(node.getPath(), nullptr);
 	}
 
-	AdvancedDetectorCacheManager() {
+	AdvancedDetectorCacheManager() : persistentLoaded(false), persistentDirty(false) {
 		clear();
 	}
 
@@ -793,17 +812,46 @@ public:
 		md5HashMap.clear(true);
 		sizeHashMap.clear(true);
 		clearArchives();
+		// The in-memory maps above are per-scan; the persistent MD5 map
+		// survives, it is just flushed to disk at this point.
+		savePersistentMD5Cache();
 	}
 
+	/**
+	 * Looks up an MD5 in the on-disk cache. Only returns a hit if the
+	 * cached file size still matches, which is the staleness check for
+	 * entries surviving between runs.
+	 */
+	bool lookupPersistentMD5(const Common::String &key, int64 size, Common::String &md5);
+
+	/** Adds or refreshes an entry in the on-disk MD5 cache. */
+	void storePersistentMD5(const Common::String &key, int64 size, const Common::String &md5);
+
+	/** Writes the persistent MD5 cache back to disk if it changed. */
+	void savePersistentMD5Cache();
+
 private:
 	friend class Common::Singleton<AdvancedDetectorCacheManager>;
 
+	void loadPersistentMD5Cache();
+
 	typedef Common::HashMap<Common::String, Common::String, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> FileHashMap;
 	typedef Common::HashMap<Common::String, int64, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SizeHashMap;
 	typedef Common::HashMap<Common::Path, Common::Archive *, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> ArchiveHashMap;
 	FileHashMap md5HashMap;
 	SizeHashMap sizeHashMap;
 	ArchiveHashMap archiveHashMap;
+
+	struct PersistentMD5Entry {
+		Common::String md5;
+		int64 size;
+
+		PersistentMD5Entry() : size(-1) {}
+	};
+	typedef Common::HashMap<Common::String, PersistentMD5Entry, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> PersistentMD5Map;
+	PersistentMD5Map persistentMD5Map;
+	bool persistentLoaded;
+	bool persistentDirty;
 };
 
 /** Convenience shortcut for accessing the MD5CacheManager. */
@@ -395,6 +395,23 @@ void GfxMgr::clear(byte color, byte priority) {
 	memset(_priorityScreen, priority, _pixels);
 }
 
+/**
+ * Copies the game and priority screens to the given buffers.
+ * Each buffer must be SCRIPT_WIDTH * SCRIPT_HEIGHT bytes.
+ */
+void GfxMgr::saveScreens(byte *gameScreen, byte *priorityScreen) const {
+	memcpy(gameScreen, _gameScreen, _pixels);
+	memcpy(priorityScreen, _priorityScreen, _pixels);
+}
+
+/**
+ * Restores the game and priority screens from the given buffers
+ */
+void GfxMgr::restoreScreens(const byte *gameScreen, const byte *priorityScreen) {
+	memcpy(_gameScreen, gameScreen, _pixels);
+	memcpy(_priorityScreen, priorityScreen, _pixels);
+}
+
 /**
  * Clears the display screen and copies it to screen
  */
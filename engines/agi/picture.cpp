@@ -65,6 +65,15 @@ PictureMgr::PictureMgr(AgiBase *agi, GfxMgr *gfx) {
 
 	_width = 0;
 	_height = 0;
+
+	_decodedPictureCacheNextSlot = 0;
+}
+
+PictureMgr::~PictureMgr() {
+	for (int i = 0; i < kDecodedPictureCacheSize; i++) {
+		free(_decodedPictureCache[i].visual);
+		free(_decodedPictureCache[i].priority);
+	}
 }
 
 /**
@@ -768,14 +777,27 @@ void PictureMgr::decodePicture(int16 resourceNr, bool clearScreen, bool agi256,
 	_width = width;
 	_height = height;
 
-	if (clearScreen) {
-		_gfx->clear(15, getInitialPriorityColor()); // white, priority 4 or 1
-	}
-
-	if (!agi256) {
-		drawPicture();
+	// A picture drawn over cleared screens always produces the same result,
+	// so a cached copy of the screens can stand in for decoding it again.
+	// Pictures drawn over existing screen contents depend on those contents
+	// and are not cached.
+	DecodedPictureCacheEntry *cached = clearScreen ? findDecodedPicture(resourceNr, agi256, width, height) : nullptr;
+	if (cached != nullptr) {
+		_gfx->restoreScreens(cached->visual, cached->priority);
 	} else {
-		drawPicture_AGI256();
+		if (clearScreen) {
+			_gfx->clear(15, getInitialPriorityColor()); // white, priority 4 or 1
+		}
+
+		if (!agi256) {
+			drawPicture();
+		} else {
+			drawPicture_AGI256();
+		}
+
+		if (clearScreen) {
+			cacheDecodedPicture(resourceNr, agi256, width, height);
+		}
 	}
 
 	if (clearScreen) {
@@ -784,6 +806,47 @@ void PictureMgr::decodePicture(int16 resourceNr, bool clearScreen, bool agi256,
 	_vm->recordImageStackCall(ADD_PIC, resourceNr, clearScreen, agi256, 0, 0, 0, 0);
 }
 
+/**
+ * Returns the cache entry for a previously decoded picture, or nullptr
+ */
+PictureMgr::DecodedPictureCacheEntry *PictureMgr::findDecodedPicture(int16 resourceNr, bool agi256, int16 width, int16 height) {
+	for (int i = 0; i < kDecodedPictureCacheSize; i++) {
+		DecodedPictureCacheEntry &entry = _decodedPictureCache[i];
+		if (entry.visual != nullptr && entry.resourceNr == resourceNr &&
+		    entry.agi256 == agi256 && entry.width == width && entry.height == height) {
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+/**
+ * Snapshots the screens of a just decoded picture into the cache.
+ * Cache slots are reused round-robin once all are in use.
+ */
+void PictureMgr::cacheDecodedPicture(int16 resourceNr, bool agi256, int16 width, int16 height) {
+	DecodedPictureCacheEntry &entry = _decodedPictureCache[_decodedPictureCacheNextSlot];
+	_decodedPictureCacheNextSlot = (_decodedPictureCacheNextSlot + 1) % kDecodedPictureCacheSize;
+
+	if (entry.visual == nullptr) {
+		entry.visual = (byte *)malloc(SCRIPT_WIDTH * SCRIPT_HEIGHT);
+		entry.priority = (byte *)malloc(SCRIPT_WIDTH * SCRIPT_HEIGHT);
+		if (entry.visual == nullptr || entry.priority == nullptr) {
+			free(entry.visual);
+			free(entry.priority);
+			entry.visual = nullptr;
+			entry.priority = nullptr;
+			return;
+		}
+	}
+
+	entry.resourceNr = resourceNr;
+	entry.agi256 = agi256;
+	entry.width = width;
+	entry.height = height;
+	_gfx->saveScreens(entry.visual, entry.priority);
+}
+
 /**
  * Draws a picture from a buffer to the visual and control screens.
  * This interface is used by PreAGI games.
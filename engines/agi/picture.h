@@ -48,7 +48,7 @@ class GfxMgr;
 class PictureMgr {
 public:
 	PictureMgr(AgiBase *agi, GfxMgr *gfx);
-	virtual ~PictureMgr() { }
+	virtual ~PictureMgr();
 
 	int16 getResourceNr() const { return _resourceNr; };
 
@@ -117,6 +117,34 @@ protected:
 
 	int16 _width;
 	int16 _height;
+
+	enum {
+		kDecodedPictureCacheSize = 4
+	};
+
+	/**
+	 * Screen snapshots of a decoded picture. Decoding a picture with
+	 * clearScreen always produces the same screens, so redrawing a
+	 * cached picture restores the snapshots instead of running the
+	 * vector instructions again.
+	 */
+	struct DecodedPictureCacheEntry {
+		int16 resourceNr;
+		bool agi256;
+		int16 width;
+		int16 height;
+		byte *visual;    /**< game screen snapshot, or nullptr if unused */
+		byte *priority;  /**< priority screen snapshot */
+
+		DecodedPictureCacheEntry() : resourceNr(-1), agi256(false),
+			width(0), height(0), visual(nullptr), priority(nullptr) { }
+	};
+
+	DecodedPictureCacheEntry _decodedPictureCache[kDecodedPictureCacheSize];
+	uint8 _decodedPictureCacheNextSlot;
+
+	DecodedPictureCacheEntry *findDecodedPicture(int16 resourceNr, bool agi256, int16 width, int16 height);
+	void cacheDecodedPicture(int16 resourceNr, bool agi256, int16 width, int16 height);
 };
 
 } // End of namespace Agi
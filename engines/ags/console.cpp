@@ -22,6 +22,7 @@
 #include "ags/console.h"
 #include "ags/ags.h"
 #include "ags/globals.h"
+#include "ags/engine/ac/draw.h"
 #include "ags/shared/ac/sprite_cache.h"
 #include "ags/shared/gfx/allegro_bitmap.h"
 #include "ags/shared/script/cc_common.h"
@@ -35,6 +36,7 @@ AGSConsole::AGSConsole(AGSEngine *vm) : GUI::Debugger(), _vm(vm), _logOutputTarg
 	registerCmd("ags_set_script_dump", WRAP_METHOD(AGSConsole, Cmd_SetScriptDump));
 	registerCmd("ags_sprite_info",   WRAP_METHOD(AGSConsole, Cmd_getSpriteInfo));
 	registerCmd("ags_sprite_dump",  WRAP_METHOD(AGSConsole, Cmd_dumpSprite));
+	registerCmd("ags_sprite_cache",  WRAP_METHOD(AGSConsole, Cmd_getSpriteCacheInfo));
 
 	_logOutputTarget = new LogOutputTarget();
 	_agsDebuggerOutput = _GP(DbgMgr).RegisterOutput("ScummVMLog", _logOutputTarget, AGS3::AGS::Shared::kDbgMsg_None);
@@ -207,6 +209,25 @@ bool AGSConsole::Cmd_getSpriteInfo(int argc, const char **argv) {
 	return true;
 }
 
+bool AGSConsole::Cmd_getSpriteCacheInfo(int argc, const char **argv) {
+	if (argc != 1) {
+		debugPrintf("Usage: %s\n", argv[0]);
+		debugPrintf("Prints the sprite cache budgets and hit/miss telemetry\n");
+		return true;
+	}
+
+	const auto &spriteset = _GP(spriteset);
+	debugPrintf("Sprite cache: %u / %u KB used (%u KB locked), %u hits, %u misses, %u evictions\n",
+				(uint32)(spriteset.GetCacheSize() / 1024), (uint32)(spriteset.GetMaxCacheSize() / 1024),
+				(uint32)(spriteset.GetLockedSize() / 1024),
+				spriteset.GetCacheHits(), spriteset.GetCacheMisses(), spriteset.GetCacheEvictions());
+	const auto &scaled = _G(drawstate).ScaledSprites;
+	debugPrintf("Scaled-sprite cache: %u / %u KB used, %u hits, %u misses, %u evictions\n",
+				(uint32)(scaled.CacheSize / 1024), (uint32)(scaled.MaxSize / 1024),
+				scaled.Hits, scaled.Misses, scaled.Evictions);
+	return true;
+}
+
 bool AGSConsole::Cmd_dumpSprite(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Usage: %s SpriteNumber\n", argv[0]);
@@ -396,6 +396,121 @@ void dispose_draw_method() {
 	destroy_blank_image();
 }
 
+//-----------------------------------------------------------------------------
+// ScaledSpriteCache
+//-----------------------------------------------------------------------------
+
+bool ScaledSpriteCache::MakeKey(sprkey_t sprnum, const Size &dst_sz, bool mirror, bool aa, uint64_t &key) {
+	// Sizes beyond the packed range are simply not cached
+	if (sprnum < 0 || dst_sz.Width <= 0 || dst_sz.Height <= 0 ||
+		dst_sz.Width >= (1 << 15) || dst_sz.Height >= (1 << 15))
+		return false;
+	key = (static_cast<uint64_t>(sprnum) << 32) |
+		  (static_cast<uint64_t>(dst_sz.Width) << 17) |
+		  (static_cast<uint64_t>(dst_sz.Height) << 2) |
+		  (static_cast<uint64_t>(mirror) << 1) |
+		  (static_cast<uint64_t>(aa));
+	return true;
+}
+
+Bitmap *ScaledSpriteCache::Lookup(sprkey_t sprnum, const Size &dst_sz, bool mirror, bool aa) {
+	uint64_t key;
+	if (!MakeKey(sprnum, dst_sz, mirror, aa, key))
+		return nullptr;
+	auto it = _entries.find(key);
+	if (it == _entries.end()) {
+		Misses++;
+		return nullptr;
+	}
+	// Move to the beginning of the MRU list
+	_mru.splice(_mru.begin(), _mru, it->_value.MruIt);
+	Hits++;
+	return it->_value.Image.get();
+}
+
+void ScaledSpriteCache::Put(sprkey_t sprnum, const Size &dst_sz, bool mirror, bool aa, Bitmap *image) {
+	uint64_t key;
+	if (!MakeKey(sprnum, dst_sz, mirror, aa, key))
+		return;
+	if (_entries.find(key) != _entries.end())
+		return; // this variant is already stored
+	const size_t size = image->GetWidth() * image->GetHeight() * image->GetBPP();
+	// Don't let a single giant image flush the whole cache
+	if (size > MaxSize / 2)
+		return;
+	// Clear up space before adding to cache
+	FreeMem(MaxSize - size);
+	Entry entry;
+	entry.Image.reset(BitmapHelper::CreateBitmapCopy(image));
+	if (!entry.Image)
+		return;
+	entry.Size = size;
+	entry.Pinned = _pinned.count(sprnum) != 0;
+	entry.MruIt = _mru.insert(_mru.begin(), key);
+	CacheSize += size;
+	_entries[key] = std::move(entry);
+}
+
+void ScaledSpriteCache::OnSpriteChanged(sprkey_t sprnum) {
+	std::vector<uint64_t> stale;
+	for (auto &ent : _entries) {
+		if (static_cast<sprkey_t>(ent._key >> 32) == sprnum)
+			stale.push_back(ent._key);
+	}
+	for (const auto key : stale) {
+		auto it = _entries.find(key);
+		CacheSize -= it->_value.Size;
+		_mru.erase(it->_value.MruIt);
+		_entries.erase(it);
+	}
+}
+
+void ScaledSpriteCache::Pin(sprkey_t sprnum) {
+	if (_pinned.count(sprnum) != 0)
+		return;
+	_pinned.insert(sprnum);
+	for (auto &ent : _entries) {
+		if (static_cast<sprkey_t>(ent._key >> 32) == sprnum)
+			ent._value.Pinned = true;
+	}
+}
+
+void ScaledSpriteCache::UnpinAll() {
+	_pinned.clear();
+	for (auto &ent : _entries)
+		ent._value.Pinned = false;
+}
+
+void ScaledSpriteCache::Clear() {
+	_entries.clear();
+	_mru.clear();
+	_pinned.clear();
+	CacheSize = 0u;
+	Hits = 0u;
+	Misses = 0u;
+	Evictions = 0u;
+}
+
+void ScaledSpriteCache::SetMaxSize(size_t size) {
+	FreeMem(size);
+	MaxSize = size;
+}
+
+void ScaledSpriteCache::FreeMem(size_t budget) {
+	// Walk the MRU list from the oldest entry; pinned entries are skipped
+	for (auto it = _mru.end(); it != _mru.begin() && CacheSize > budget;) {
+		--it;
+		auto ent = _entries.find(*it);
+		assert(ent != _entries.end());
+		if (ent == _entries.end() || ent->_value.Pinned)
+			continue;
+		CacheSize -= ent->_value.Size;
+		Evictions++;
+		_entries.erase(ent);
+		it = _mru.erase(it);
+	}
+}
+
 void init_game_drawdata() {
 	// character and object caches
 	_GP(charcache).resize(_GP(game).numcharacters);
@@ -469,6 +584,9 @@ void clear_drawobj_cache() {
 	// Clear sprite update notification blocks
 	_G(drawstate).SpriteNotifyMap.clear();
 
+	// Drop all the cached scaled sprites
+	_G(drawstate).ScaledSprites.Clear();
+
 	dispose_debug_room_drawdata();
 }
 
@@ -647,6 +765,9 @@ void notify_sprite_changed(int sprnum, bool deleted) {
 		*it_notify->_value = UINT32_MAX;
 		_G(drawstate).SpriteNotifyMap.erase(sprnum);
 	}
+
+	// Drop any scaled variants of the old image
+	_G(drawstate).ScaledSprites.OnSpriteChanged(sprnum);
 }
 
 void mark_screen_dirty() {
@@ -1180,8 +1301,26 @@ static Bitmap *transform_sprite(Bitmap *src, bool src_has_alpha, std::unique_ptr
 // Used for software render mode only.
 static bool scale_and_flip_sprite(ObjTexture &actsp, int sppic, int width, int height, bool hmirror) {
 	Bitmap *src = _GP(spriteset)[sppic];
-	Bitmap *result = transform_sprite(src, (_GP(game).SpriteInfos[sppic].Flags & SPF_ALPHACHANNEL) != 0,
-		actsp.Bmp, Size(width, height), hmirror ? kFlip_Horizontal : kFlip_None);
+	const bool src_has_alpha = (_GP(game).SpriteInfos[sppic].Flags & SPF_ALPHACHANNEL) != 0;
+	const Size dst_sz = Size(width, height);
+	const GraphicFlip flip = hmirror ? kFlip_Horizontal : kFlip_None;
+
+	// Scaling is the expensive part of the transform; check whether this
+	// sprite was already scaled to the wanted size, and reuse the result
+	auto &scaled_cache = _G(drawstate).ScaledSprites;
+	const bool aa = (IS_ANTIALIAS_SPRITES) && !src_has_alpha;
+	if (src->GetSize() != dst_sz) {
+		Bitmap *cached = scaled_cache.Lookup(sppic, dst_sz, hmirror, aa);
+		if (cached) {
+			recycle_bitmap(actsp.Bmp, cached->GetColorDepth(), dst_sz.Width, dst_sz.Height);
+			actsp.Bmp->Blit(cached, 0, 0, 0, 0, dst_sz.Width, dst_sz.Height);
+			return true;
+		}
+	}
+
+	Bitmap *result = transform_sprite(src, src_has_alpha, actsp.Bmp, dst_sz, flip);
+	if ((result != src) && (src->GetSize() != dst_sz))
+		scaled_cache.Put(sppic, dst_sz, hmirror, aa, result);
 	return result != src;
 }
 
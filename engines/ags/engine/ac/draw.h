@@ -22,7 +22,11 @@
 #ifndef AGS_ENGINE_AC_DRAW_H
 #define AGS_ENGINE_AC_DRAW_H
 
+#include "common/std/list.h"
+#include "common/std/map.h"
 #include "common/std/memory.h"
+#include "common/std/unordered_set.h"
+#include "ags/shared/core/platform.h"
 #include "ags/shared/core/types.h"
 #include "ags/shared/ac/common_defines.h"
 #include "ags/shared/gfx/gfx_def.h"
@@ -47,6 +51,13 @@ using namespace AGS; // FIXME later
 
 #define IS_ANTIALIAS_SPRITES _GP(usetup).enable_antialiasing && (_GP(play).disable_antialiasing == 0)
 
+// Default budget of the scaled-sprite cache, in KB
+#if AGS_PLATFORM_OS_ANDROID || AGS_PLATFORM_OS_IOS
+#define DEFAULT_SCALEDCACHESIZE_KB (4 * 1024)
+#else
+#define DEFAULT_SCALEDCACHESIZE_KB (16 * 1024)
+#endif
+
 // Render stage flags, for filtering out certain elements
 // during room transitions, capturing screenshots, etc.
 // NOTE: these values are internal and purely arbitrary atm.
@@ -70,6 +81,67 @@ struct RoomCameraDrawData {
 };
 
 typedef int32_t sprkey_t;
+
+// ScaledSpriteCache is a second-level sprite cache for the software render
+// mode: it keeps the results of scaling a sprite to a particular size
+// (optionally mirrored and/or anti-aliased) in the game's display format,
+// so that objects which show a sprite at a steady zoom level do not re-run
+// the stretch on every texture rebuild. Entries are budgeted in bytes and
+// dropped in least-recently-used order; sprites may be pinned as a hint
+// that they belong to the current room and should survive normal evictions.
+struct ScaledSpriteCache {
+	// A cached scaled image, with a reference into the MRU list
+	struct Entry {
+		std::unique_ptr<Shared::Bitmap> Image;
+		size_t Size = 0;
+		bool Pinned = false;
+		std::list<uint64_t>::iterator MruIt;
+
+		Entry() = default;
+		Entry(Entry &&other) = default;
+		Entry &operator=(Entry &&other) = default;
+	};
+
+	// Returns a scaled variant of the sprite, or null if none is cached;
+	// refreshes the entry's position in the MRU list
+	Shared::Bitmap *Lookup(sprkey_t sprnum, const Size &dst_sz, bool mirror, bool aa);
+	// Stores a copy of the scaled image; may evict older unpinned entries
+	void Put(sprkey_t sprnum, const Size &dst_sz, bool mirror, bool aa, Shared::Bitmap *image);
+	// Removes all scaled variants of the given sprite (e.g. it was updated)
+	void OnSpriteChanged(sprkey_t sprnum);
+	// Marks present and future variants of the sprite as pinned
+	void Pin(sprkey_t sprnum);
+	// Clears the pinned hints, e.g. when the current room is unloaded
+	void UnpinAll();
+	// Deletes all cached images and resets the telemetry
+	void Clear();
+	// Sets the cache budget, in bytes, disposing entries if necessary
+	void SetMaxSize(size_t size);
+
+	// Current and maximal size of the cache, in bytes
+	size_t CacheSize = 0u;
+	size_t MaxSize = DEFAULT_SCALEDCACHESIZE_KB * 1024u;
+	// Cache telemetry, for the debug console
+	uint32_t Hits = 0u;
+	uint32_t Misses = 0u;
+	uint32_t Evictions = 0u;
+
+private:
+	// Packs a lookup key; returns false if the size cannot be represented
+	// (such images are simply not cached)
+	static bool MakeKey(sprkey_t sprnum, const Size &dst_sz, bool mirror, bool aa, uint64_t &key);
+	// Disposes least-recently-used unpinned entries until the cache fits
+	// the given budget
+	void FreeMem(size_t budget);
+
+	// Scaled images, keyed by sprite index + destination size + flags
+	std::unordered_map<uint64_t, Entry> _entries;
+	// MRU list: least recently used entries are dropped first
+	std::list<uint64_t> _mru;
+	// Sprites hinted as belonging to the current room
+	std::unordered_set<sprkey_t> _pinned;
+};
+
 // TODO: refactor the draw unit into a virtual interface with
 // two implementations: for software and video-texture render,
 // instead of checking whether the current method is "software".
@@ -98,6 +170,9 @@ struct DrawState {
 	// kinds of renderers, thus saving on 1 extra notification mechanism.
 	std::unordered_map<sprkey_t, std::shared_ptr<uint32_t> >
 		SpriteNotifyMap;
+
+	// Second-level cache of pre-scaled sprite images (software render mode)
+	ScaledSpriteCache ScaledSprites;
 };
 
 // ObjTexture is a helper struct that pairs a raw bitmap with
@@ -244,6 +244,8 @@ void unload_old_room() {
 	debug_script_log("Unloading room %d", _G(displayed_room));
 
 	dispose_room_drawdata();
+	// Remove the pinning hints from the old room's sprites
+	_G(drawstate).ScaledSprites.UnpinAll();
 
 	for (uint32_t ff = 0; ff < _G(croom)->numobj; ff++)
 		_G(objs)[ff].moving = 0;
@@ -621,6 +623,11 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 
 	_G(objs) = _G(croom)->obj.size() > 0 ? &_G(croom)->obj[0] : nullptr;
 
+	// Hint the scaled-sprite cache that these sprites belong to the new room,
+	// so their scaled variants are kept until the player leaves it
+	for (size_t cc = 0; cc < _G(croom)->numobj; cc++)
+		_G(drawstate).ScaledSprites.Pin(_G(croom)->obj[cc].num);
+
 	for (size_t cc = 0; cc < _G(croom)->numobj; cc++) {
 		// export the object's script object
 		if (_GP(thisroom).Objects[cc].ScriptName.IsEmpty())
@@ -901,6 +908,7 @@ void new_room(int newnum, CharacterInfo *forchar) {
 	if (_GP(usetup).clear_cache_on_room_change) {
 		// Delete all cached sprites
 		_GP(spriteset).DisposeAllFreeCached();
+		_G(drawstate).ScaledSprites.Clear();
 	}
 
 	load_new_room(newnum, forchar);
@@ -19,7 +19,7 @@
  *
  */
 
-#include "common/std/thread.h"
+#include "common/system.h"
 #include "ags/engine/ac/timer.h"
 #include "ags/shared/core/platform.h"
 #include "ags/engine/ac/sys_events.h"
@@ -31,11 +31,19 @@ namespace AGS3 {
 
 namespace {
 const auto MAXIMUM_FALL_BEHIND = 3; // number of full frames
+
+// Current time in microseconds. The backend timer only has millisecond
+// resolution, but keeping the frame deadlines in microseconds avoids the
+// sub-millisecond truncation error from accumulating across frames.
+int64 timer_now_micros() {
+	return (int64)g_system->getMillis() * 1000;
 }
+} // namespace
 
-std::chrono::microseconds GetFrameDuration() {
+// Duration of a game frame, in microseconds
+int64 GetFrameDuration() {
 	if (_G(framerate_maxed)) {
-		return std::chrono::microseconds(0);
+		return 0;
 	}
 	return _G(tick_duration);
 }
@@ -45,7 +53,7 @@ int setTimerFps(int new_fps) {
 	if (new_fps <= 0)
 		return _G(framerate);
 	int old_fps = _G(framerate);
-	_G(tick_duration) = std::chrono::microseconds(1000000LL / new_fps);
+	_G(tick_duration) = 1000000LL / new_fps;
 	_G(framerate) = new_fps;
 	_G(framerate_maxed) = new_fps >= 1000;
 
@@ -59,11 +67,11 @@ bool isTimerFpsMaxed() {
 }
 
 void WaitForNextFrame() {
-	const auto now = AGS_Clock::now();
-	const auto frameDuration = GetFrameDuration();
+	const int64 now = timer_now_micros();
+	const int64 frameDuration = GetFrameDuration();
 
 	// early exit if we're trying to maximise framerate
-	if (frameDuration <= std::chrono::milliseconds::zero()) {
+	if (frameDuration <= 0) {
 		_G(last_tick_time) = _G(next_frame_timestamp);
 		_G(next_frame_timestamp) = now;
 		// suspend while the game is being switched out
@@ -80,8 +88,14 @@ void WaitForNextFrame() {
 	}
 
 	if (_G(next_frame_timestamp) > now) {
-		auto frame_time_remaining = _G(next_frame_timestamp) - now;
-		std::this_thread::sleep_for(frame_time_remaining);
+		const int64 frame_time_remaining = _G(next_frame_timestamp) - now;
+		// Sleep the bulk of the wait, then spin the final millisecond:
+		// delayMillis() may oversleep by a scheduler tick, and the frame
+		// deadline usually does not fall on a millisecond boundary.
+		const int64 sleep_ms = frame_time_remaining / 1000;
+		if (sleep_ms > 1)
+			g_system->delayMillis(sleep_ms - 1);
+		while (timer_now_micros() + 999 < _G(next_frame_timestamp)) {}
 	}
 
 	_G(last_tick_time) = _G(next_frame_timestamp);
@@ -95,8 +109,8 @@ void WaitForNextFrame() {
 }
 
 void skipMissedTicks() {
-	_G(last_tick_time) = AGS_Clock::now();
-	_G(next_frame_timestamp) = AGS_Clock::now();
+	_G(last_tick_time) = timer_now_micros();
+	_G(next_frame_timestamp) = timer_now_micros();
 }
 
 } // namespace AGS3
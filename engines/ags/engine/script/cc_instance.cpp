@@ -152,7 +152,7 @@ struct ScriptCommands {
 		ScriptCommandInfo(SCMD_NEWUSEROBJECT   , "newuserobject"     , 2, kScOpOneArgIsReg),
 	};
 
-	const ScriptCommandInfo &operator[](uint idx) {
+	const ScriptCommandInfo &operator[](uint idx) const {
 		return _items[idx];
 	}
 };
@@ -560,6 +560,14 @@ int ccInstance::Run(int32_t curpc) {
 	thisbase[0] = 0;
 	funcstart[0] = pc;
 	ccInstance *codeInst = runningInst;
+	// The executed code array and the command table cannot change while this
+	// Run() call is on the stack (script-to-script calls recurse through
+	// Run() and restore runningInst afterwards), so cache them in locals
+	// rather than re-reading the members and the global table pointer on
+	// every instruction.
+	const intptr_t *const cur_code = codeInst->code;
+	const int32_t cur_codesize = codeInst->codesize;
+	const ScriptCommands &commands = *g_commands;
 	ScriptOperation codeOp;
 	FunctionCallStack func_callstack;
 #if DEBUG_CC_EXEC
@@ -583,30 +591,30 @@ int ccInstance::Run(int32_t curpc) {
 		//
 		/* Read operation */
 		//=====================================================================
-		codeOp.Instruction.Code         = codeInst->code[pc];
+		codeOp.Instruction.Code         = cur_code[pc];
 		codeOp.Instruction.InstanceId   = (codeOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
 		codeOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
 
 		CC_ERROR_IF_RETCODE((codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS),
 							"invalid instruction %d found in code stream", codeOp.Instruction.Code);
 
-		codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
+		codeOp.ArgCount = commands[codeOp.Instruction.Code].ArgCount;
 
-		CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= codeInst->codesize,
-							"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
+		CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= cur_codesize,
+							"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, cur_codesize);
 
 
 		// Read arguments; use switch as it proved to be faster than the loop
 
 		switch (codeOp.ArgCount) {
 		case 3:
-			codeOp.Args[2].SetInt32(static_cast<int32_t>(codeInst->code[pc + 3]));
+			codeOp.Args[2].SetInt32(static_cast<int32_t>(cur_code[pc + 3]));
 			/* fall-through */
 		case 2:
-			codeOp.Args[1].SetInt32(static_cast<int32_t>(codeInst->code[pc + 2]));
+			codeOp.Args[1].SetInt32(static_cast<int32_t>(cur_code[pc + 2]));
 			/* fall-through */
 		case 1:
-			codeOp.Args[0].SetInt32(static_cast<int32_t>(codeInst->code[pc + 1]));
+			codeOp.Args[0].SetInt32(static_cast<int32_t>(cur_code[pc + 1]));
 			break;
 		default:
 			break;
@@ -692,7 +700,7 @@ int ccInstance::Run(int32_t curpc) {
 			// be only up to 4 bytes large;
 			// I guess that's an obsolete way to do WRITE, WRITEW and WRITEB
 			const auto arg_size = codeOp.Arg1i();
-			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
+			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], cur_code[pc + 2], this->stack, codeInst->strings);
 			ASSERT_CC_ERROR();
 			const auto &arg_value = codeOp.Arg2();
 			switch (arg_size) {
@@ -729,7 +737,7 @@ int ccInstance::Run(int32_t curpc) {
 		}
 		case SCMD_LITTOREG: {
 			auto &reg1 = registers[codeOp.Arg1i()];
-			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], codeInst->code[pc + 2], this->stack, codeInst->strings);
+			FixupArgument(codeOp.Args[1], codeInst->code_fixups[pc + 2], cur_code[pc + 2], this->stack, codeInst->strings);
 			ASSERT_CC_ERROR();
 			const auto &arg_value = codeOp.Arg2();
 			reg1 = arg_value;
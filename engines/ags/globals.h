@@ -1362,12 +1362,14 @@ public:
 	 * @{
 	 */
 
-	std::chrono::microseconds _tick_duration = std::chrono::microseconds(1000000LL / 40);
+	// Frame times are kept in microseconds at full precision, so that e.g.
+	// a 60 fps game paces at 16.67ms per frame rather than a truncated 16ms
+	int64 _tick_duration = 1000000LL / 40;
 	bool _framerate_maxed = false;
 	int _framerate = 0;
 
-	uint32 _last_tick_time = 0; // AGS_Clock::now();
-	uint32 _next_frame_timestamp = 0; // AGS_Clock::now();
+	int64 _last_tick_time = 0; // in microseconds
+	int64 _next_frame_timestamp = 0; // in microseconds
 
 	/**@}*/
 
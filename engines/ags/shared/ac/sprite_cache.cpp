@@ -60,7 +60,8 @@ namespace Shared {
 
 SpriteCache::SpriteCache(std::vector<SpriteInfo> &sprInfos, const Callbacks &callbacks)
 	: _sprInfos(sprInfos), _maxCacheSize(DEFAULTCACHESIZE_KB * 1024u),
-	  _cacheSize(0u), _lockedSize(0u) {
+	  _cacheSize(0u), _lockedSize(0u),
+	  _cacheHits(0u), _cacheMisses(0u), _evictions(0u) {
 	_callbacks.AdjustSize = (callbacks.AdjustSize) ? callbacks.AdjustSize : DummyAdjustSize;
 	_callbacks.InitSprite = (callbacks.InitSprite) ? callbacks.InitSprite : DummyInitSprite;
 	_callbacks.PostInitSprite = (callbacks.PostInitSprite) ? callbacks.PostInitSprite : DummyPostInitSprite;
@@ -82,6 +83,18 @@ size_t SpriteCache::GetMaxCacheSize() const {
 	return _maxCacheSize;
 }
 
+uint32_t SpriteCache::GetCacheHits() const {
+	return _cacheHits;
+}
+
+uint32_t SpriteCache::GetCacheMisses() const {
+	return _cacheMisses;
+}
+
+uint32_t SpriteCache::GetCacheEvictions() const {
+	return _evictions;
+}
+
 size_t SpriteCache::GetSpriteSlotCount() const {
 	return _spriteData.size();
 }
@@ -223,15 +236,19 @@ Bitmap *SpriteCache::operator[](sprkey_t index) {
 		return _placeholder.get();
 
 	// Externally added sprite or locked sprite, don't put it into MRU list
-	if (_spriteData[index].IsExternalSprite() || _spriteData[index].IsLocked())
+	if (_spriteData[index].IsExternalSprite() || _spriteData[index].IsLocked()) {
+		_cacheHits++;
 		return _spriteData[index].Image.get();
+	}
 	// Either use ready image, or load one from assets
 	if (_spriteData[index].Image) {
 		// Move to the beginning of the MRU list
 		_mru.splice(_mru.begin(), _mru, _spriteData[index].MruIt);
+		_cacheHits++;
 		return _spriteData[index].Image.get();
 	} else {
 		// Sprite exists in file but is not in mem, load it and add to MRU list
+		_cacheMisses++;
 		if (LoadSprite(index)) {
 			_spriteData[index].MruIt = _mru.insert(_mru.begin(), index);
 			return _spriteData[index].Image.get();
@@ -276,6 +293,7 @@ void SpriteCache::DisposeOldest() {
 	if (!_spriteData[sprnum].IsLocked()) {
 		_cacheSize -= _spriteData[sprnum].Size;
 		_spriteData[sprnum].Image.reset();
+		_evictions++;
 		SprCacheLog("DisposeOldest: disposed %d, size now %d KB", sprnum, _cacheSize / 1024);
 	}
 	// Remove from the mru list
@@ -128,6 +128,12 @@ public:
 	size_t      GetLockedSize() const;
 	// Returns maximal size limit of the cache, in bytes; this includes locked size too!
 	size_t      GetMaxCacheSize() const;
+	// Returns number of times a requested sprite was served from memory
+	uint32_t    GetCacheHits() const;
+	// Returns number of times a requested sprite had to be loaded from the file
+	uint32_t    GetCacheMisses() const;
+	// Returns number of times a cached image was disposed to free space
+	uint32_t    GetCacheEvictions() const;
 	// Returns number of sprite slots in the bank (this includes both actual sprites and free slots)
 	size_t      GetSpriteSlotCount() const;
 	// Tells if the sprite storage still has unoccupied slots to put new sprites in
@@ -240,6 +246,11 @@ private:
 	size_t _lockedSize;    // size in bytes of currently locked images
 	size_t _cacheSize;     // size in bytes of currently cached images
 
+	// Cache telemetry, for the debug console
+	uint32_t _cacheHits;   // number of requests served from memory
+	uint32_t _cacheMisses; // number of requests that required a file load
+	uint32_t _evictions;   // number of images disposed to free space
+
 	// MRU list: the way to track which sprites were used recently.
 	// When clearing up space for new sprites, cache first deletes the sprites
 	// that were last time used long ago.
@@ -935,7 +935,9 @@ bool Actor::draw(Common::Rect *screenRect) {
 	}
 
 	_vm->_sliceRenderer->drawInWorld(_animationId, _animationFrame, drawPosition, drawAngle, drawScale, _vm->_surfaceFront, _vm->_zbuffer->getData());
-	_vm->_sliceRenderer->getScreenRectangle(screenRect, _animationId, _animationFrame, drawPosition, drawAngle, drawScale);
+	// drawInWorld() has just set up this frame, so reuse its screen rectangle
+	// instead of running the whole frame setup again via getScreenRectangle().
+	*screenRect = _vm->_sliceRenderer->getLastScreenRectangle();
 
 	return !screenRect->isEmpty();
 }
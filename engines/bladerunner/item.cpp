@@ -89,7 +89,9 @@ bool Item::tick(Common::Rect *screenRect, bool special) {
 	Vector3 position(_position.x, -_position.z, _position.y);
 	int animationId = _animationId + (special ? 1 : 0);
 	_vm->_sliceRenderer->drawInWorld(animationId, 0, position, M_PI - _angle, 1.0f, _vm->_surfaceFront, _vm->_zbuffer->getData());
-	_vm->_sliceRenderer->getScreenRectangle(&_screenRectangle, animationId, 0, position, M_PI - _angle, 1.0f);
+	// Reuse the screen rectangle computed by drawInWorld() above rather than
+	// setting up the same frame a second time.
+	_screenRectangle = _vm->_sliceRenderer->getLastScreenRectangle();
 
 	if (!_screenRectangle.isEmpty()) {
 		*screenRect = _screenRectangle;
@@ -101,6 +101,11 @@ public:
 
 	void setupFrameInWorld(int animationId, int animationFrame, Vector3 position, float facing, float scale = 1.0f);
 	void getScreenRectangle(Common::Rect *screenRectangle, int animationId, int animationFrame, Vector3 position, float facing, float scale);
+	// Screen rectangle left behind by the last setupFrameInWorld() - both
+	// drawInWorld() and getScreenRectangle() go through it. Lets a caller that
+	// has just drawn a frame fetch the rectangle without paying for the frame
+	// page lookup and bounding rect projection a second time.
+	const Common::Rect &getLastScreenRectangle() const { return _screenRectangle; }
 	void drawInWorld(int animationId, int animationFrame, Vector3 position, float facing, float scale, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawOnScreen(int animationId, int animationFrame, int screenX, int screenY, float facing, float scale, Graphics::Surface &surface);
 
@@ -497,6 +497,10 @@ void Score::updateCurrentFrame() {
 		// this copies in the frame data and updates _curFrameNumber
 		loadFrame(nextFrameNumberToLoad, true);
 
+		// warm the cast member cache for the frames coming up, so channel-heavy
+		// movies do not decode everything on the frame a member first appears
+		prefetchCastMembers();
+
 		// finally, update the channels and buffer any dirty rectangles
 		updateSprites(kRenderModeNormal, true);
 	} else if (!_vm->_playbackPaused) {
@@ -1905,6 +1909,39 @@ void Score::setSpriteCasts() {
 	}
 }
 
+void Score::prefetchCastMembers() {
+	// The score is fully parsed into _scoreCache at load time, so the cast
+	// members the next few frames will reference are known ahead of time.
+	// Load a few of them per frame advance, so the decode cost is spread
+	// over the preceding frames instead of hitting the frame where a member
+	// first appears.
+	uint32 lastFrame = MIN<uint32>(_curFrameNumber + kCastPrefetchLookAhead, _scoreCache.size());
+	int budget = kCastPrefetchMaxLoads;
+
+	for (uint32 f = _curFrameNumber + 1; f <= lastFrame && budget > 0; f++) {
+		Frame *frame = _scoreCache[f - 1];
+
+		for (uint16 ch = 0; ch < frame->_sprites.size() && budget > 0; ch++) {
+			CastMemberID castId = frame->_sprites[ch]->_castId;
+			if (castId.member == 0)
+				continue;
+
+			Cast *cast = _movie->getCast(castId);
+			CastMember *member = cast ? cast->getCastMember(castId.member, false) : nullptr;
+			if (!member && _movie->getSharedCast()) {
+				cast = _movie->getSharedCast();
+				member = cast->getCastMember(castId.member, false);
+			}
+			if (!member || member->isLoaded())
+				continue;
+
+			debugC(5, kDebugLoading, "Score::prefetchCastMembers(): preloading %s for frame %d", castId.asString().c_str(), f);
+			cast->getCastMember(castId.member, true);
+			budget--;
+		}
+	}
+}
+
 void Score::loadLabels(Common::SeekableReadStreamEndian &stream) {
 	if (debugChannelSet(5, kDebugLoading)) {
 		debug("Score::loadLabels()");
@@ -104,6 +104,7 @@ public:
 	Sprite *getOriginalSpriteById(uint16 id);
 
 	void setSpriteCasts();
+	void prefetchCastMembers();
 
 	int getPreviousLabelNumber(int referenceFrame);
 	int getCurrentLabelNumber();
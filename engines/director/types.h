@@ -35,6 +35,11 @@ enum {
 	kShotPercentPixelThreshold = 1
 };
 
+enum {
+	kCastPrefetchLookAhead = 8,
+	kCastPrefetchMaxLoads = 3
+};
+
 #define kQuirksCacheArchive "quirks"
 
 enum MovieFlag {
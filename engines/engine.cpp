@@ -32,6 +32,7 @@
 #include "common/ustr.h"
 #include "common/error.h"
 #include "common/list.h"
+#include "common/profiler.h"
 #include "common/memstream.h"
 #include "common/savefile.h"
 #include "common/scummsys.h"
@@ -628,6 +629,9 @@ void Engine::warnMissingExtractedCDAudio() {
 }
 
 void Engine::handleAutoSave() {
+	// Engines call this once per main loop iteration, so the zone both
+	// paces the trace and exposes autosave hitches.
+	PROFILE_SCOPE("Engine::handleAutoSave");
 #ifdef ENABLE_EVENTRECORDER
 	if (!g_eventRec.processAutosave())
 		return;
@@ -984,7 +988,14 @@ bool Engine::canLoadGameStateCurrently(Common::U32String *msg) {
 }
 
 Common::Error Engine::saveGameState(int slot, const Common::String &desc, bool isAutosave) {
-	Common::OutSaveFile *saveFile = _saveFileMan->openForSaving(getSaveStateName(slot));
+	// Autosaves happen mid-play, so write them through the asynchronous
+	// path where the backend has one: the engine fills an in-memory
+	// buffer and play resumes while compression and the disk commit run
+	// in the background. Loads and save listings flush pending writes
+	// first, so the slot is never observed half-written.
+	Common::OutSaveFile *saveFile = isAutosave
+		? _saveFileMan->openForSavingAsync(getSaveStateName(slot))
+		: _saveFileMan->openForSaving(getSaveStateName(slot));
 
 	if (!saveFile)
 		return Common::kWritingFailed;
@@ -24,10 +24,8 @@
 #include "glk/events.h"
 #include "common/file.h"
 #include "audio/audiostream.h"
-#include "audio/decoders/aiff.h"
-#include "audio/decoders/mp3.h"
+#include "audio/decoders/probe.h"
 #include "audio/decoders/raw.h"
-#include "audio/decoders/wave.h"
 
 namespace Glk {
 
@@ -94,14 +92,9 @@ uint SoundChannel::play(uint soundNum, uint repeats, uint notify) {
 		return 1;
 
 	// Find a sound of the given name
-	Audio::AudioStream *stream;
+	Audio::AudioStream *stream = nullptr;
 	Common::File f;
 	Common::Path nameSnd(Common::String::format("sound%u.snd", soundNum));
-	Common::Path nameWav(Common::String::format("sound%u.wav", soundNum));
-	Common::Path nameAiff(Common::String::format("sound%u.aiff", soundNum));
-#ifdef USE_MAD
-	Common::Path nameMp3(Common::String::format("sound%u.mp3", soundNum));
-#endif
 
 	if (f.exists(nameSnd) && f.open(nameSnd)) {
 		if (f.readUint16BE() != (f.size() - 2))
@@ -117,22 +110,29 @@ uint SoundChannel::play(uint soundNum, uint repeats, uint notify) {
 		Common::SeekableReadStream *s = f.readStream(size);
 		stream = Audio::makeRawStream(s, freq, Audio::FLAG_UNSIGNED);
 
-#ifdef USE_MAD
-	} else if (f.exists(nameMp3) && f.open(nameMp3)) {
-		Common::SeekableReadStream *s = f.readStream(f.size());
-		stream = Audio::makeMP3Stream(s, DisposeAfterUse::YES);
-#endif
-	} else if (f.exists(nameWav) && f.open(nameWav)) {
-		Common::SeekableReadStream *s = f.readStream(f.size());
-		stream = Audio::makeWAVStream(s, DisposeAfterUse::YES);
-
-	} else if (f.exists(nameAiff) && f.open(nameAiff)) {
-		Common::SeekableReadStream *s = f.readStream(f.size());
-		stream = Audio::makeAIFFStream(s, DisposeAfterUse::YES);
-
 	} else {
-		warning("Could not find sound %u", soundNum);
-		return 1;
+		// The other formats are identified from their content by the
+		// shared probe; the owner's cache means replaying a sound skips
+		// the header read
+		const Common::Path names[] = {
+			Common::Path(Common::String::format("sound%u.mp3", soundNum)),
+			Common::Path(Common::String::format("sound%u.wav", soundNum)),
+			Common::Path(Common::String::format("sound%u.aiff", soundNum))
+		};
+
+		for (uint idx = 0; idx < ARRAYSIZE(names) && !stream; ++idx) {
+			if (f.exists(names[idx]) && f.open(names[idx])) {
+				Common::SeekableReadStream *s = f.readStream(f.size());
+				stream = Audio::makeProbedAudioStream(s, DisposeAfterUse::YES,
+						&_owner->_formatCache, names[idx].toString());
+				f.close();
+			}
+		}
+
+		if (!stream) {
+			warning("Could not find sound %u", soundNum);
+			return 1;
+		}
 	}
 
 	_soundNum = soundNum;
@@ -24,6 +24,7 @@
 
 #include "glk/glk_types.h"
 #include "audio/audiostream.h"
+#include "audio/decoders/probe.h"
 #include "audio/mixer.h"
 #include "common/array.h"
 
@@ -100,6 +101,12 @@ class Sounds {
 	friend class SoundChannel;
 private:
 	Common::Array<schanid_t> _sounds;
+
+	/**
+	 * Probed container formats of previously played sound files, so
+	 * replaying a sound skips the header read
+	 */
+	Audio::AudioFormatCache _formatCache;
 private:
 	/**
 	 * Remove a sound from the sounds list
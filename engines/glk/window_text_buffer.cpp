@@ -240,7 +240,12 @@ void TextBufferWindow::touchScroll() {
 	g_vm->_selection->clearSelection();
 	_windows->repaint(_bbox);
 
-	for (int i = 0; i < _scrollMax; i++)
+	// Only the lines within the visible region need to be marked; every
+	// change of the scroll position comes back through here, so off-screen
+	// lines get marked before they can come into view. Touching the whole
+	// scrollback instead makes each appended line cost O(transcript length).
+	int last = MIN(_scrollMax, _scrollPos + _height);
+	for (int i = _scrollPos; i < last; i++)
 		_lines[i]._dirty = true;
 }
 
@@ -856,10 +861,13 @@ void TextBufferWindow::redraw() {
 		if (selrow)
 			_lines[i]._dirty = true;
 
-		TextBufferRow ln(_lines[i]);
+		// Work on the stored row directly instead of copying it; the only
+		// mutation below, reversing attributes for the selection, is undone
+		// once the line has been drawn.
+		TextBufferRow &ln = _lines[i];
 
-		// skip if we can
-		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw && _scrollPos == 0)
+		// skip if we can; any scroll position change re-marks the visible lines
+		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw)
 			continue;
 
 		// repaint previously selected lines if needed
@@ -1046,6 +1054,12 @@ void TextBufferWindow::redraw() {
 		font = ln._attrs[a].attrFont(_styles);
 		color = link ? _font._linkColor : ln._attrs[a].attrFg(_styles);
 		screen.drawStringUni(Point(x, y + _font._baseLine), font, color, Common::U32String(ln._chars + a, linelen - a), spw);
+
+		// restore the attributes we reversed for the selection
+		if (selrow && !Windows::_claimSelect && selchar) {
+			for (tsc = lsc; tsc <= rsc; tsc++)
+				ln._attrs[tsc].reverse = !ln._attrs[tsc].reverse;
+		}
 	}
 
 	/*
@@ -364,6 +364,66 @@ uint32 Surface::getColorFromIndex(uint8 index) const {
 		return _highColorMap[index];
 }
 
+// Typed row workers for the blit and fill loops below. Going through
+// Pixel/ConstPixel costs a color depth branch and two bounds asserts per
+// pixel; these run on plain typed pointers instead, with the clipping
+// already done by the caller.
+
+template<typename DstType, typename SrcType>
+static void blitRows(byte *dst, const byte *src, uint32 dstPitch, uint32 srcPitch,
+		uint16 width, uint16 height, int32 transp, bool yAxisReflection, const uint32 *highColorMap) {
+
+	while (height-- > 0) {
+		DstType *dstRow = (DstType *)dst;
+		const SrcType *srcRow = (const SrcType *)src;
+
+		int srcStep = 1;
+		if (yAxisReflection) {
+			srcRow += width - 1;
+			srcStep = -1;
+		}
+
+		for (uint16 i = 0; i < width; i++, dstRow++, srcRow += srcStep) {
+			uint32 color = *srcRow;
+			if (color == ((uint32) transp))
+				continue;
+
+			*dstRow = (DstType)(highColorMap ? highColorMap[color] : color);
+		}
+
+		dst += dstPitch;
+		src += srcPitch;
+	}
+}
+
+template<typename DstType>
+static void fillRows(byte *dst, uint32 dstPitch, uint16 width, uint16 height, uint32 color) {
+	while (height-- > 0) {
+		DstType *dstRow = (DstType *)dst;
+
+		for (uint16 i = 0; i < width; i++)
+			dstRow[i] = (DstType)color;
+
+		dst += dstPitch;
+	}
+}
+
+template<typename DstType>
+static void fillRowsKeepBackground(byte *dst, uint32 dstPitch, uint16 width, uint16 height,
+		uint32 fillColor, uint32 backgroundColor) {
+
+	while (height-- > 0) {
+		DstType *dstRow = (DstType *)dst;
+
+		for (uint16 i = 0; i < width; i++) {
+			if (dstRow[i] != (DstType)backgroundColor)
+				dstRow[i] = (DstType)fillColor;
+		}
+
+		dst += dstPitch;
+	}
+}
+
 void Surface::blit(const Surface &from, int16 left, int16 top, int16 right, int16 bottom,
 		int16 x, int16 y, int32 transp, bool yAxisReflection) {
 
@@ -393,8 +453,11 @@ void Surface::blit(const Surface &from, int16 left, int16 top, int16 right, int1
 		return;
 	}
 
-	if (transp == -1 && !yAxisReflection && from._bpp == _bpp && _bpp == 1) {
-		// We don't have to look for transparency => we can use memmove line-wise
+	if (transp == -1 && !yAxisReflection && from._bpp == _bpp && _bpp <= 2) {
+		// We don't have to look for transparency => we can use memmove line-wise.
+		// At 32bpp a pixel can carry the raw value 0xFFFFFFFF, which the copy
+		// loop below has always treated as transparent here, so that depth
+		// keeps going through it.
 
 		// Pointers to the blit destination and source start points
 		      byte *dst =      getData(x   , y);
@@ -413,41 +476,26 @@ void Surface::blit(const Surface &from, int16 left, int16 top, int16 right, int1
 	// Otherwise, we have to copy by pixel
 
 	// Pointers to the blit destination and source start points
-	     Pixel dst =      get(x   , y);
-	ConstPixel src = from.get(left, top);
+	      byte *dst =      getData(x   , y);
+	const byte *src = from.getData(left, top);
 
-	while (height-- > 0) {
-		     Pixel dstRow = dst;
-		ConstPixel srcRow = src;
+	const uint32 dstPitch = _width * _bpp;
+	const uint32 srcPitch = from._width * from._bpp;
 
-		if (yAxisReflection) {
-			srcRow += width - 1;
-			for (uint16 i = 0; i < width; i++, ++dstRow, --srcRow) {
-				if (srcRow.get() != ((uint32) transp)) {
-					if (_bpp == from._bpp)
-						dstRow.set(srcRow.get());
-					else {
-						uint32 index = srcRow.get();
-						dstRow.set(from._highColorMap[index]);
-					}
-				}
-			}
-		} else {
-			for (uint16 i = 0; i < width; i++, ++dstRow, ++srcRow) {
-				if (srcRow.get() != ((uint32) transp)) {
-					if (_bpp == from._bpp)
-						dstRow.set(srcRow.get());
-					else {
-						uint32 index = srcRow.get();
-						dstRow.set(from._highColorMap[index]);
-					}
-				}
-			}
-		}
+	// The high color map is only consulted when the color depths differ,
+	// matching the per-pixel copy this replaces
+	const uint32 *highColorMap = (_bpp != from._bpp) ? from._highColorMap : nullptr;
 
-		dst +=      _width;
-		src += from._width;
-	}
+	if (_bpp == 1)
+		blitRows<byte, byte>(dst, src, dstPitch, srcPitch, width, height, transp, yAxisReflection, highColorMap);
+	else if (_bpp == 2 && from._bpp == 2)
+		blitRows<uint16, uint16>(dst, src, dstPitch, srcPitch, width, height, transp, yAxisReflection, highColorMap);
+	else if (_bpp == 2)
+		blitRows<uint16, byte>(dst, src, dstPitch, srcPitch, width, height, transp, yAxisReflection, highColorMap);
+	else if (_bpp == 4 && from._bpp == 4)
+		blitRows<uint32, uint32>(dst, src, dstPitch, srcPitch, width, height, transp, yAxisReflection, highColorMap);
+	else
+		blitRows<uint32, byte>(dst, src, dstPitch, srcPitch, width, height, transp, yAxisReflection, highColorMap);
 }
 
 void Surface::blit(const Surface &from, int16 x, int16 y, int32 transp) {
@@ -644,13 +692,10 @@ void Surface::fillRectRaw(int16 left, int16 top, int16 right, int16 bottom, uint
 
 	// Otherwise, we have to fill by pixel
 
-	Pixel p = get(left, top);
-	while (height-- > 0) {
-		for (uint16 i = 0; i < width; i++, ++p)
-			p.set(color);
-
-		p += _width - width;
-	}
+	if (_bpp == 2)
+		fillRows<uint16>(getData(left, top), _width * _bpp, width, height, color);
+	else
+		fillRows<uint32>(getData(left, top), _width * _bpp, width, height, color);
 }
 
 void Surface::fillRect(int16 left, int16 top, int16 right, int16 bottom, uint8 colorIndex) {
@@ -686,14 +731,12 @@ void Surface::fillArea(int16 left, int16 top, int16 right, int16 bottom, uint8 f
 	uint32 fillColor = getColorFromIndex(fillColorIndex);
 	uint32 backgroundColor = getColorFromIndex(backgroundColorIndex);
 
-	Pixel p = get(left, top);
-	while (height-- > 0) {
-		for (uint16 i = 0; i < width; i++, ++p)
-			if (p.get() != backgroundColor)
-				p.set(fillColor);
-
-		p += _width - width;
-	}
+	if (_bpp == 1)
+		fillRowsKeepBackground<byte>(getData(left, top), _width * _bpp, width, height, fillColor, backgroundColor);
+	else if (_bpp == 2)
+		fillRowsKeepBackground<uint16>(getData(left, top), _width * _bpp, width, height, fillColor, backgroundColor);
+	else
+		fillRowsKeepBackground<uint32>(getData(left, top), _width * _bpp, width, height, fillColor, backgroundColor);
 }
 
 Common::Rect Surface::fillAreaAtPoint(int16 left, int16 top, uint8 fillColorIndex) {
@@ -1148,6 +1148,38 @@ void GfxOpenGL::createBitmap(BitmapData *bitmap) {
 
 		delete[] texData;
 		bitmap->freeData();
+
+		if (bitmap->_format == 1) {
+			// The tile quads of a bitmap never change, so bake one display
+			// list per image here; drawBitmap() replays it under the current
+			// translation and scale instead of re-issuing immediate mode
+			// vertices every frame.
+			GLuint lists = glGenLists(bitmap->_numImages);
+			if (lists) {
+				for (int pic = 0; pic < bitmap->_numImages; pic++) {
+					glNewList(lists + pic, GL_COMPILE);
+					int cur_tex_idx = bitmap->_numTex * pic;
+					for (int y = 0; y < bitmap->_height; y += BITMAP_TEXTURE_SIZE) {
+						for (int x = 0; x < bitmap->_width; x += BITMAP_TEXTURE_SIZE) {
+							glBindTexture(GL_TEXTURE_2D, textures[cur_tex_idx]);
+							glBegin(GL_QUADS);
+							glTexCoord2f(0.0f, 0.0f);
+							glVertex2f(x, y);
+							glTexCoord2f(1.0f, 0.0f);
+							glVertex2f(x + BITMAP_TEXTURE_SIZE, y);
+							glTexCoord2f(1.0f, 1.0f);
+							glVertex2f(x + BITMAP_TEXTURE_SIZE, y + BITMAP_TEXTURE_SIZE);
+							glTexCoord2f(0.0f, 1.0f);
+							glVertex2f(x, y + BITMAP_TEXTURE_SIZE);
+							glEnd();
+							cur_tex_idx++;
+						}
+					}
+					glEndList();
+				}
+				bitmap->_userData = (void *)(uintptr)lists;
+			}
+		}
 	}
 }
 
@@ -1259,22 +1291,33 @@ void GfxOpenGL::drawBitmap(const Bitmap *bitmap, int dx, int dy, uint32 layer) {
 
 	glEnable(GL_SCISSOR_TEST);
 	glScissor((int)(dx * _scaleW), _screenHeight - (int)(((dy + bitmap->getHeight())) * _scaleH), (int)(bitmap->getWidth() * _scaleW), (int)(bitmap->getHeight() * _scaleH));
-	int cur_tex_idx = bitmap->getNumTex() * (bitmap->getActiveImage() - 1);
-	for (int y = dy; y < (dy + bitmap->getHeight()); y += BITMAP_TEXTURE_SIZE) {
-		for (int x = dx; x < (dx + bitmap->getWidth()); x += BITMAP_TEXTURE_SIZE) {
-			textures = (GLuint *)bitmap->getTexIds();
-			glBindTexture(GL_TEXTURE_2D, textures[cur_tex_idx]);
-			glBegin(GL_QUADS);
-			glTexCoord2f(0.0f, 0.0f);
-			glVertex2f(x * _scaleW, y * _scaleH);
-			glTexCoord2f(1.0f, 0.0f);
-			glVertex2f((x + BITMAP_TEXTURE_SIZE) * _scaleW, y * _scaleH);
-			glTexCoord2f(1.0f, 1.0f);
-			glVertex2f((x + BITMAP_TEXTURE_SIZE) * _scaleW, (y + BITMAP_TEXTURE_SIZE)  * _scaleH);
-			glTexCoord2f(0.0f, 1.0f);
-			glVertex2f(x * _scaleW, (y + BITMAP_TEXTURE_SIZE) * _scaleH);
-			glEnd();
-			cur_tex_idx++;
+	if (bitmap->getFormat() == 1 && bitmap->_data->_userData) {
+		// Replay the tile geometry baked in createBitmap().
+		glMatrixMode(GL_MODELVIEW);
+		glPushMatrix();
+		glTranslatef(dx * _scaleW, dy * _scaleH, 0.0f);
+		glScalef(_scaleW, _scaleH, 1.0f);
+		glCallList((GLuint)(uintptr)bitmap->_data->_userData + (bitmap->getActiveImage() - 1));
+		glPopMatrix();
+		glMatrixMode(GL_TEXTURE);
+	} else {
+		int cur_tex_idx = bitmap->getNumTex() * (bitmap->getActiveImage() - 1);
+		for (int y = dy; y < (dy + bitmap->getHeight()); y += BITMAP_TEXTURE_SIZE) {
+			for (int x = dx; x < (dx + bitmap->getWidth()); x += BITMAP_TEXTURE_SIZE) {
+				textures = (GLuint *)bitmap->getTexIds();
+				glBindTexture(GL_TEXTURE_2D, textures[cur_tex_idx]);
+				glBegin(GL_QUADS);
+				glTexCoord2f(0.0f, 0.0f);
+				glVertex2f(x * _scaleW, y * _scaleH);
+				glTexCoord2f(1.0f, 0.0f);
+				glVertex2f((x + BITMAP_TEXTURE_SIZE) * _scaleW, y * _scaleH);
+				glTexCoord2f(1.0f, 1.0f);
+				glVertex2f((x + BITMAP_TEXTURE_SIZE) * _scaleW, (y + BITMAP_TEXTURE_SIZE)  * _scaleH);
+				glTexCoord2f(0.0f, 1.0f);
+				glVertex2f(x * _scaleW, (y + BITMAP_TEXTURE_SIZE) * _scaleH);
+				glEnd();
+				cur_tex_idx++;
+			}
 		}
 	}
 	glDisable(GL_SCISSOR_TEST);
@@ -1300,6 +1343,10 @@ void GfxOpenGL::destroyBitmap(BitmapData *bitmap) {
 		delete[] textures;
 		bitmap->_texIds = nullptr;
 	}
+	if (bitmap->_userData) {
+		glDeleteLists((GLuint)(uintptr)bitmap->_userData, bitmap->_numImages);
+		bitmap->_userData = nullptr;
+	}
 }
 
 struct FontUserData {
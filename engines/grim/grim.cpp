@@ -37,6 +37,7 @@
 #include "backends/keymapper/keymap.h"
 #include "backends/keymapper/standard-actions.h"
 
+#include "graphics/framelimiter.h"
 #include "graphics/renderer.h"
 
 #if defined(USE_OPENGL_GAME) || defined(USE_OPENGL_SHADERS)
@@ -661,9 +662,11 @@ void GrimEngine::playAspyrLogo() {
 	g_movie = CreateQuickTimePlayer();
 	g_movie->play("AMWI.m4b", false, 0, 0);
 	setMode(SmushMode);
+	Graphics::FrameLimiter frameLimiter(g_system, _speedLimitMs != 0 ? 1000 / _speedLimitMs : 0);
+	frameLimiter.initialize();
 	while (g_movie->isPlaying()) {
 		_doFlip = true;
-		uint32 startTime = g_system->getMillis();
+		frameLimiter.startFrame();
 
 		updateDisplayScene();
 		doFlip();
@@ -678,16 +681,7 @@ void GrimEngine::playAspyrLogo() {
 			}
 		}
 
-		uint32 endTime = g_system->getMillis();
-		if (startTime > endTime)
-			continue;
-		uint32 diffTime = endTime - startTime;
-		if (_speedLimitMs == 0)
-			continue;
-		if (diffTime < _speedLimitMs) {
-			uint32 delayTime = _speedLimitMs - diffTime;
-			g_system->delayMillis(delayTime);
-		}
+		frameLimiter.delayBeforeSwap();
 	}
 	delete g_movie;
 	setMode(NormalMode);
@@ -1006,8 +1000,15 @@ void GrimEngine::mainLoop() {
 	_changeHardwareState = false;
 	_setupChanged = true;
 
+	// Pace the loop with the shared frame limiter. Unlike delaying by the
+	// remaining budget, it pays back late frames from the following ones,
+	// so a scene spike shifts the frames after it instead of slowing the
+	// whole sequence down, and it defers to hardware vsync when active.
+	Graphics::FrameLimiter frameLimiter(g_system, _speedLimitMs != 0 ? 1000 / _speedLimitMs : 0);
+	frameLimiter.initialize();
+
 	for (;;) {
-		uint32 startTime = g_system->getMillis();
+		frameLimiter.startFrame();
 		if (_shortFrame) {
 			if (resetShortFrame) {
 				_shortFrame = false;
@@ -1158,21 +1159,13 @@ void GrimEngine::mainLoop() {
 			g_imuseState = -1;
 		}
 
-		uint32 endTime = g_system->getMillis();
-		if (startTime > endTime)
-			continue;
-		uint32 diffTime = endTime - startTime;
-		if (diffTime < _speedLimitMs) {
-			uint32 delayTime = _speedLimitMs - diffTime;
-			g_system->delayMillis(delayTime);
-		}
+		frameLimiter.delayBeforeSwap();
 #if defined(__EMSCRIPTEN__)
-		else {
-			// If SDL_HINT_EMSCRIPTEN_ASYNCIFY is enabled, SDL pauses the application and gives
-			// back control to the browser automatically by calling emscripten_sleep via SDL_Delay.
-			// Without this the page would completely lock up.
-			g_system->delayMillis(0);
-		}
+		// If SDL_HINT_EMSCRIPTEN_ASYNCIFY is enabled, SDL pauses the application and gives
+		// back control to the browser automatically by calling emscripten_sleep via SDL_Delay.
+		// Without this the page would completely lock up, so yield even when the limiter
+		// did not need to delay.
+		g_system->delayMillis(0);
 #endif
 	}
 }
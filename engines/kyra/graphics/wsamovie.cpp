@@ -114,6 +114,8 @@ int WSAMovie_v1::open(const char *filename, int offscreenDecode, Palette *palBuf
 	if (firstFrame)
 		Screen::decodeFrame4(_frameData, _deltaBuffer, _deltaBufferSize);
 
+	precomputeFrameSpans();
+
 	delete[] p;
 	_opened = true;
 
@@ -126,6 +128,10 @@ void WSAMovie_v1::close() {
 		delete[] _offscreenBuffer;
 		delete[] _frameOffsTable;
 		delete[] _frameData;
+		_frameSpans.clear();
+		_frameSpanStart.clear();
+		_frameSpanCount.clear();
+		_frameSpanData.clear();
 		_opened = false;
 	}
 }
@@ -209,6 +215,15 @@ void WSAMovie_v1::processFrame(int frameNum, uint8 *dst) {
 	if (!_opened)
 		return;
 	assert(frameNum <= _numFrames);
+
+	if (hasFrameSpans(frameNum)) {
+		if (_flags & WF_OFFSCREEN_DECODE)
+			applyFrameSpans(frameNum, dst, false);
+		else
+			applyFrameSpansToPage(frameNum, dst, false);
+		return;
+	}
+
 	const uint8 *src = _frameData + _frameOffsTable[frameNum];
 	Screen::decodeFrame4(src, _deltaBuffer, _deltaBufferSize);
 	if (_flags & WF_OFFSCREEN_DECODE)
@@ -217,6 +232,239 @@ void WSAMovie_v1::processFrame(int frameNum, uint8 *dst) {
 		Screen::decodeFrameDeltaPage(dst, _deltaBuffer, _width, false);
 }
 
+/**
+ * Decodes the delta stream of every frame once and stores the result as
+ * span lists, so that playback applies each frame with wide copies and
+ * fills instead of decoding its stream again.
+ *
+ * If any frame's stream turns out to be malformed, all spans are dropped
+ * and playback stays on the original per-frame decoders, which also keeps
+ * the exact decoding sequence for such animations.
+ */
+void WSAMovie_v1::precomputeFrameSpans() {
+	_frameSpanStart.clear();
+	_frameSpanCount.clear();
+	_frameSpans.clear();
+	_frameSpanData.clear();
+
+	// Frame 0 is the base frame; it is decoded into _deltaBuffer at open
+	// and applied directly by displayFrame, so it needs no spans.
+	_frameSpanStart.resize(_numFrames + 1);
+	_frameSpanCount.resize(_numFrames + 1);
+	for (int i = 0; i <= _numFrames; ++i) {
+		_frameSpanStart[i] = kNoSpans;
+		_frameSpanCount[i] = 0;
+	}
+
+	uint8 *delta = new uint8[_deltaBufferSize]();
+	for (int i = 1; i <= _numFrames; ++i) {
+		const uint8 *src = _frameData + _frameOffsTable[i];
+		uint deltaSize = Screen::decodeFrame4(src, delta, _deltaBufferSize);
+
+		uint32 spanStart = _frameSpans.size();
+		if (!parseFrameSpans(delta, deltaSize)) {
+			_frameSpanStart.clear();
+			_frameSpanCount.clear();
+			_frameSpans.clear();
+			_frameSpanData.clear();
+			break;
+		}
+		_frameSpanStart[i] = spanStart;
+		_frameSpanCount[i] = _frameSpans.size() - spanStart;
+	}
+	delete[] delta;
+}
+
+/**
+ * Parses one frame's delta stream into spans, appended to _frameSpans and
+ * _frameSpanData. Returns false if the stream runs out of bounds before
+ * its terminator, or writes outside the frame.
+ */
+bool WSAMovie_v1::parseFrameSpans(const uint8 *src, uint32 srcSize) {
+	const uint8 *end = src + srcSize;
+	const uint32 frameSize = _width * _height;
+	const uint32 firstSpan = _frameSpans.size();
+	uint32 dstOffset = 0;
+
+	while (1) {
+		if (src >= end)
+			return false;
+
+		uint8 code = *src++;
+		uint32 len = 0;
+		const uint8 *data = nullptr;
+		uint8 fillValue = 0;
+
+		if (code == 0) {
+			if (src + 2 > end)
+				return false;
+			len = *src++;
+			fillValue = *src++;
+		} else if (code & 0x80) {
+			code -= 0x80;
+			if (code != 0) {
+				dstOffset += code;
+				continue;
+			}
+			if (src + 2 > end)
+				return false;
+			uint16 subcode = READ_LE_UINT16(src); src += 2;
+			if (subcode == 0)
+				break;
+			if (subcode & 0x8000) {
+				subcode -= 0x8000;
+				if (subcode & 0x4000) {
+					if (src >= end)
+						return false;
+					len = subcode - 0x4000;
+					fillValue = *src++;
+				} else {
+					if (src + subcode > end)
+						return false;
+					len = subcode;
+					data = src;
+					src += len;
+				}
+			} else {
+				dstOffset += subcode;
+				continue;
+			}
+		} else {
+			if (src + code > end)
+				return false;
+			len = code;
+			data = src;
+			src += len;
+		}
+
+		if (len == 0)
+			continue;
+		if (dstOffset + len > frameSize)
+			return false;
+
+		if (data != nullptr) {
+			// Literal bytes land at the end of _frameSpanData, so a
+			// literal span that continues the previous one can simply
+			// extend it.
+			FrameSpan *prev = _frameSpans.size() > firstSpan ? &_frameSpans.back() : nullptr;
+			if (prev != nullptr && prev->dataOffset != kSpanFill &&
+			    prev->dstOffset + prev->length == dstOffset &&
+			    prev->dataOffset + prev->length == _frameSpanData.size()) {
+				prev->length += len;
+			} else {
+				FrameSpan span;
+				span.dstOffset = dstOffset;
+				span.length = len;
+				span.dataOffset = _frameSpanData.size();
+				span.fillValue = 0;
+				_frameSpans.push_back(span);
+			}
+			const uint32 dataEnd = _frameSpanData.size();
+			_frameSpanData.resize(dataEnd + len);
+			memcpy(&_frameSpanData[dataEnd], data, len);
+		} else {
+			FrameSpan span;
+			span.dstOffset = dstOffset;
+			span.length = len;
+			span.dataOffset = kSpanFill;
+			span.fillValue = fillValue;
+			_frameSpans.push_back(span);
+		}
+		dstOffset += len;
+	}
+
+	return true;
+}
+
+/**
+ * Applies a frame's spans to a linear buffer of frame size
+ */
+void WSAMovie_v1::applyFrameSpans(int frameNum, uint8 *dst, bool noXor) const {
+	const FrameSpan *span = _frameSpans.begin() + _frameSpanStart[frameNum];
+	for (uint32 n = _frameSpanCount[frameNum]; n != 0; --n, ++span) {
+		uint8 *d = dst + span->dstOffset;
+		if (span->dataOffset == kSpanFill) {
+			if (noXor)
+				memset(d, span->fillValue, span->length);
+			else
+				xorFill(d, span->fillValue, span->length);
+		} else {
+			const uint8 *s = _frameSpanData.begin() + span->dataOffset;
+			if (noXor)
+				memcpy(d, s, span->length);
+			else
+				xorRun(d, s, span->length);
+		}
+	}
+}
+
+/**
+ * Applies a frame's spans to a screen page rect of SCREEN_W pitch,
+ * splitting each span at the frame's row boundaries.
+ */
+void WSAMovie_v1::applyFrameSpansToPage(int frameNum, uint8 *dst, bool noXor) const {
+	const FrameSpan *span = _frameSpans.begin() + _frameSpanStart[frameNum];
+	for (uint32 n = _frameSpanCount[frameNum]; n != 0; --n, ++span) {
+		uint32 offset = span->dstOffset;
+		uint32 len = span->length;
+		const uint8 *s = span->dataOffset != kSpanFill ? _frameSpanData.begin() + span->dataOffset : nullptr;
+
+		while (len != 0) {
+			const uint32 col = offset % _width;
+			const uint32 chunk = MIN<uint32>(len, _width - col);
+			uint8 *d = dst + (offset / _width) * Screen::SCREEN_W + col;
+
+			if (s == nullptr) {
+				if (noXor)
+					memset(d, span->fillValue, chunk);
+				else
+					xorFill(d, span->fillValue, chunk);
+			} else {
+				if (noXor)
+					memcpy(d, s, chunk);
+				else
+					xorRun(d, s, chunk);
+				s += chunk;
+			}
+
+			offset += chunk;
+			len -= chunk;
+		}
+	}
+}
+
+void WSAMovie_v1::xorRun(uint8 *dst, const uint8 *src, uint32 len) {
+	// XOR in register-wide chunks; going through memcpy keeps the
+	// accesses alignment-safe and still compiles to plain word loads
+	// and stores.
+	while (len >= sizeof(uint32)) {
+		uint32 d, s;
+		memcpy(&d, dst, sizeof(d));
+		memcpy(&s, src, sizeof(s));
+		d ^= s;
+		memcpy(dst, &d, sizeof(d));
+		dst += sizeof(uint32);
+		src += sizeof(uint32);
+		len -= sizeof(uint32);
+	}
+	while (len--)
+		*dst++ ^= *src++;
+}
+
+void WSAMovie_v1::xorFill(uint8 *dst, uint8 value, uint32 len) {
+	const uint32 pattern = value * 0x01010101u;
+	while (len >= sizeof(uint32)) {
+		uint32 d;
+		memcpy(&d, dst, sizeof(d));
+		d ^= pattern;
+		memcpy(dst, &d, sizeof(d));
+		dst += sizeof(uint32);
+		len -= sizeof(uint32);
+	}
+	while (len--)
+		*dst++ ^= value;
+}
+
 #pragma mark -
 
 WSAMovieAmiga::WSAMovieAmiga(KyraEngine_v1 *vm) : WSAMovie_v1(vm), _buffer(nullptr) {}
@@ -331,9 +579,14 @@ void WSAMovieAmiga::processFrame(int frameNum, uint8 *dst) {
 
 	memset(dst, 0, _width * _height);
 
-	const uint8 *src = _frameData + _frameOffsTable[frameNum];
-	Screen::decodeFrame4(src, _deltaBuffer, _deltaBufferSize);
-	Screen::decodeFrameDelta(dst, _deltaBuffer, true);
+	const uint8 *src;
+	if (hasFrameSpans(frameNum)) {
+		applyFrameSpans(frameNum, dst, true);
+	} else {
+		src = _frameData + _frameOffsTable[frameNum];
+		Screen::decodeFrame4(src, _deltaBuffer, _deltaBufferSize);
+		Screen::decodeFrameDelta(dst, _deltaBuffer, true);
+	}
 	Screen::convertAmigaGfx(dst, _width, _height, 5, (_flags & WF_FLIPPED) != 0);
 
 	src = dst;
@@ -449,6 +702,8 @@ int WSAMovie_v2::open(const char *filename, int unk1, Palette *palBuf) {
 	if (firstFrame)
 		Screen::decodeFrame4(_frameData, _deltaBuffer, _deltaBufferSize);
 
+	precomputeFrameSpans();
+
 	delete[] p;
 	_opened = true;
 
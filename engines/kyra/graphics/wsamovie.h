@@ -24,6 +24,8 @@
 
 #include "kyra/kyra_v1.h"
 
+#include "common/array.h"
+
 namespace Kyra {
 
 class Palette;
@@ -84,6 +86,39 @@ public:
 protected:
 	virtual void processFrame(int frameNum, uint8 *dst);
 
+	/**
+	 * One run from a frame's decoded delta stream: either a run of
+	 * literal delta bytes stored in _frameSpanData, or a run of a
+	 * single repeated byte. The spans of each frame are precomputed
+	 * at load time, so that playback applies wide copies and fills
+	 * instead of decoding the delta stream again for every frame.
+	 */
+	struct FrameSpan {
+		uint32 dstOffset;   ///< linear offset into the frame
+		uint32 length;
+		uint32 dataOffset;  ///< offset into _frameSpanData, or kSpanFill
+		uint8 fillValue;    ///< fill byte, used when dataOffset == kSpanFill
+	};
+
+	static const uint32 kSpanFill = 0xFFFFFFFF; ///< dataOffset marker for fill spans
+	static const uint32 kNoSpans = 0xFFFFFFFF;  ///< _frameSpanStart marker for uncovered frames
+
+	void precomputeFrameSpans();
+	bool parseFrameSpans(const uint8 *src, uint32 srcSize);
+	bool hasFrameSpans(int frameNum) const {
+		return (uint)frameNum < _frameSpanStart.size() && _frameSpanStart[frameNum] != kNoSpans;
+	}
+	void applyFrameSpans(int frameNum, uint8 *dst, bool noXor) const;
+	void applyFrameSpansToPage(int frameNum, uint8 *dst, bool noXor) const;
+
+	static void xorRun(uint8 *dst, const uint8 *src, uint32 len);
+	static void xorFill(uint8 *dst, uint8 value, uint32 len);
+
+	Common::Array<FrameSpan> _frameSpans;
+	Common::Array<uint32> _frameSpanStart;  ///< per frame: first span, or kNoSpans
+	Common::Array<uint32> _frameSpanCount;  ///< per frame: number of spans
+	Common::Array<uint8> _frameSpanData;    ///< literal bytes of all spans
+
 	uint16 _currentFrame;
 	uint16 _numFrames;
 	uint16 _width;
@@ -457,15 +457,26 @@ void ImageAsset::blitDirect(Graphics::ManagedSurface *target, int ox, int oy, co
 	uint sx, sy, w, h;
 	calculateSectionToDraw(target, ox, oy, bitWidth, bitHeight, sx, sy, w, h);
 
+	// One row pointer per scanline and one source byte per 8 pixels;
+	// calculateSectionToDraw() already clamped the section to the target.
 	for (uint y = 0; y < h; y++) {
-		uint bmpofs = (y + sy) * rowBytes;
-		byte pix = 0;
-		for (uint x = 0; x < w; x++) {
-			assert(ox + x <= (uint)target->w);
-			assert(oy + y <= (uint)target->h);
-			pix = data[bmpofs + ((x + sx) >> 3)] & (1 << (7 - ((x + sx) & 7)));
-			pix = pix ? kColorBlack : kColorWhite;
-			*((byte *)target->getBasePtr(ox + x, oy + y)) = pix;
+		const byte *src = &data[(y + sy) * rowBytes];
+		byte *dst = (byte *)target->getBasePtr(ox, oy + y);
+		uint bitPos = sx;
+		for (uint x = 0; x < w;) {
+			const byte bits = src[bitPos >> 3];
+			const uint run = MIN<uint>(8 - (bitPos & 7), w - x);
+			if (bits == 0) {
+				memset(dst + x, kColorWhite, run);
+			} else if (bits == 0xFF) {
+				memset(dst + x, kColorBlack, run);
+			} else {
+				byte m = 1 << (7 - (bitPos & 7));
+				for (uint i = 0; i < run; i++, m >>= 1)
+					dst[x + i] = (bits & m) ? kColorBlack : kColorWhite;
+			}
+			x += run;
+			bitPos += run;
 		}
 	}
 }
@@ -474,16 +485,25 @@ void ImageAsset::blitBIC(Graphics::ManagedSurface *target, int ox, int oy, const
 	uint sx, sy, w, h;
 	calculateSectionToDraw(target, ox, oy, bitWidth, bitHeight, sx, sy, w, h);
 
+	// Masks are mostly empty or solid, so handle a whole source byte at
+	// a time and skip the clear ones.
 	for (uint y = 0; y < h; y++) {
-		uint bmpofs = (y + sy) * rowBytes;
-		byte pix = 0;
-		for (uint x = 0; x < w; x++) {
-			assert(ox + x <= (uint)target->w);
-			assert(oy + y <= (uint)target->h);
-			pix = data[bmpofs + ((x + sx) >> 3)] & (1 << (7 - ((x + sx) & 7)));
-			if (pix) {
-				*((byte *)target->getBasePtr(ox + x, oy + y)) = kColorWhite;
+		const byte *src = &data[(y + sy) * rowBytes];
+		byte *dst = (byte *)target->getBasePtr(ox, oy + y);
+		uint bitPos = sx;
+		for (uint x = 0; x < w;) {
+			const byte bits = src[bitPos >> 3];
+			const uint run = MIN<uint>(8 - (bitPos & 7), w - x);
+			if (bits == 0xFF) {
+				memset(dst + x, kColorWhite, run);
+			} else if (bits) {
+				byte m = 1 << (7 - (bitPos & 7));
+				for (uint i = 0; i < run; i++, m >>= 1)
+					if (bits & m)
+						dst[x + i] = kColorWhite;
 			}
+			x += run;
+			bitPos += run;
 		}
 	}
 }
@@ -493,15 +513,22 @@ void ImageAsset::blitOR(Graphics::ManagedSurface *target, int ox, int oy, const
 	calculateSectionToDraw(target, ox, oy, bitWidth, bitHeight, sx, sy, w, h);
 
 	for (uint y = 0; y < h; y++) {
-		uint bmpofs = (y + sy) * rowBytes;
-		byte pix = 0;
-		for (uint x = 0; x < w; x++) {
-			assert(ox + x <= (uint)target->w);
-			assert(oy + y <= (uint)target->h);
-			pix = data[bmpofs + ((x + sx) >> 3)] & (1 << (7 - ((x + sx) & 7)));
-			if (pix) {
-				*((byte *)target->getBasePtr(ox + x, oy + y)) = kColorBlack;
+		const byte *src = &data[(y + sy) * rowBytes];
+		byte *dst = (byte *)target->getBasePtr(ox, oy + y);
+		uint bitPos = sx;
+		for (uint x = 0; x < w;) {
+			const byte bits = src[bitPos >> 3];
+			const uint run = MIN<uint>(8 - (bitPos & 7), w - x);
+			if (bits == 0xFF) {
+				memset(dst + x, kColorBlack, run);
+			} else if (bits) {
+				byte m = 1 << (7 - (bitPos & 7));
+				for (uint i = 0; i < run; i++, m >>= 1)
+					if (bits & m)
+						dst[x + i] = kColorBlack;
 			}
+			x += run;
+			bitPos += run;
 		}
 	}
 }
@@ -511,17 +538,21 @@ void ImageAsset::blitXOR(Graphics::ManagedSurface *target, int ox, int oy, const
 	calculateSectionToDraw(target, ox, oy, bitWidth, bitHeight, sx, sy, w, h);
 
 	for (uint y = 0; y < h; y++) {
-		uint bmpofs = (y + sy) * rowBytes;
-		byte pix = 0;
-		for (uint x = 0; x < w; x++) {
-			pix = data[bmpofs + ((x + sx) >> 3)] & (1 << (7 - ((x + sx) & 7)));
-			if (pix) { // We need to xor
-				assert(ox + x <= (uint)target->w);
-				assert(oy + y <= (uint)target->h);
-				byte p = *((byte *)target->getBasePtr(ox + x, oy + y));
-				*((byte *)target->getBasePtr(ox + x, oy + y)) =
-					(p == kColorWhite) ? kColorBlack : kColorWhite;
+		const byte *src = &data[(y + sy) * rowBytes];
+		byte *dst = (byte *)target->getBasePtr(ox, oy + y);
+		uint bitPos = sx;
+		for (uint x = 0; x < w;) {
+			const byte bits = src[bitPos >> 3];
+			const uint run = MIN<uint>(8 - (bitPos & 7), w - x);
+			if (bits) {
+				byte m = 1 << (7 - (bitPos & 7));
+				for (uint i = 0; i < run; i++, m >>= 1) {
+					if (bits & m) // We need to xor
+						dst[x + i] = (dst[x + i] == kColorWhite) ? kColorBlack : kColorWhite;
+				}
 			}
+			x += run;
+			bitPos += run;
 		}
 	}
 }
@@ -402,9 +402,19 @@ SaveStateList MetaEngine::listSaves(const char *target) const {
 		int slotNum = atoi(slotStr);
 
 		if (slotNum >= 0 && slotNum <= getMaximumSaveSlot()) {
-			SaveStateDescriptor desc = querySaveMetaInfos(target, slotNum);
-			if (desc.getSaveSlot() != -1) {
-				saveList.push_back(desc);
+			// Read the header without decoding the thumbnail. The save/load
+			// dialogs query the full meta info (including the thumbnail) per
+			// displayed slot, so decoding every thumbnail here would make
+			// opening the dialog scale with the total number of saves.
+			Common::ScopedPtr<Common::InSaveFile> in(saveFileMan->openForLoading(getSavegameFile(slotNum, target)));
+			if (in) {
+				ExtendedSavegameHeader header;
+				if (readSavegameHeader(in.get(), &header, true)) {
+					SaveStateDescriptor desc(this, slotNum, Common::U32String());
+					parseSavegameHeader(&header, &desc);
+					desc.setAutosave(header.isAutosave);
+					saveList.push_back(desc);
+				}
 			}
 		}
 	}
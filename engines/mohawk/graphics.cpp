@@ -29,6 +29,11 @@
 
 namespace Mohawk {
 
+// Maximum total size of the decoded images kept across card changes.
+// Big enough for several cards worth of images, so that revisiting a
+// card does not decode its images all over again.
+static const uint32 kImageCacheBudget = 8 * 1024 * 1024;
+
 MohawkSurface::MohawkSurface() : _surface(nullptr), _palette(nullptr) {
 	_offsetX = 0;
 	_offsetY = 0;
@@ -67,7 +72,7 @@ void MohawkSurface::convertToTrueColor() {
 	_surface = surface;
 }
 
-GraphicsManager::GraphicsManager() {
+GraphicsManager::GraphicsManager() : _cacheTick(0) {
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -85,16 +90,47 @@ void GraphicsManager::clearCache() {
 
 	_cache.clear();
 	_subImageCache.clear();
+	_cacheLastUsed.clear();
+}
+
+uint32 GraphicsManager::surfaceSize(MohawkSurface *image) {
+	const Graphics::Surface *surface = image->getSurface();
+
+	uint32 size = surface->pitch * surface->h;
+	if (image->getPalette())
+		size += 256 * 3;
+
+	return size;
+}
+
+void GraphicsManager::trimCache() {
+	uint32 totalSize = 0;
+	for (Common::HashMap<uint16, MohawkSurface *>::const_iterator it = _cache.begin(); it != _cache.end(); it++)
+		totalSize += surfaceSize(it->_value);
+
+	while (totalSize > kImageCacheBudget && !_cache.empty()) {
+		// Find the least recently used image. The cache never holds
+		// more than a few dozen images, so a linear scan is fine.
+		Common::HashMap<uint16, MohawkSurface *>::iterator lru = _cache.begin();
+		for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+			if (_cacheLastUsed[it->_key] < _cacheLastUsed[lru->_key])
+				lru = it;
+		}
+
+		totalSize -= surfaceSize(lru->_value);
+		delete lru->_value;
+		_cacheLastUsed.erase(lru->_key);
+		_cache.erase(lru->_key);
+	}
 }
 
 MohawkSurface *GraphicsManager::findImage(uint16 id) {
 	if (!_cache.contains(id))
 		_cache[id] = decodeImage(id);
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	// Track when the image was last requested so that trimCache() can
+	// evict the images least likely to be needed again first.
+	_cacheLastUsed[id] = ++_cacheTick;
 
 	return _cache[id];
 }
@@ -227,6 +263,7 @@ void GraphicsManager::addImageToCache(uint16 id, MohawkSurface *surface) {
 		error("Image %d already in cache", id);
 
 	_cache[id] = surface;
+	_cacheLastUsed[id] = ++_cacheTick;
 }
 
 } // End of namespace Mohawk
@@ -73,6 +73,11 @@ public:
 	// Free all surfaces in the cache
 	void clearCache();
 
+	// Evict the least recently used images until the cache fits in its
+	// byte budget. Called on card changes, where a full flush would
+	// force images shared between cards to be decoded again.
+	void trimCache();
+
 	// findImage will search the cache to find the image.
 	// If not found, it will call decodeImage to get a new one.
 	MohawkSurface *findImage(uint16 id);
@@ -99,6 +104,12 @@ private:
 	// An image cache that stores images until clearCache() is called
 	Common::HashMap<uint16, MohawkSurface *> _cache;
 	Common::HashMap<uint16, Common::Array<MohawkSurface *> > _subImageCache;
+
+	// Last use counters for trimCache()
+	Common::HashMap<uint16, uint32> _cacheLastUsed;
+	uint32 _cacheTick;
+
+	static uint32 surfaceSize(MohawkSurface *image);
 };
 
 } // End of namespace Mohawk
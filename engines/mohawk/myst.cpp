@@ -945,9 +945,10 @@ void MohawkEngine_Myst::changeToCard(uint16 card, TransitionType transition) {
 
 	_video->stopVideos();
 
-	// Clear the resource cache and image cache
+	// Clear the resource cache and trim the image cache down to its
+	// byte budget, keeping the images of recently visited cards
 	_cache.clear();
-	_gfx->clearCache();
+	_gfx->trimCache();
 
 	_mouseClicked = false;
 	_mouseMoved = false;
@@ -4228,6 +4228,9 @@ VThreadState KeyEventDispatch::continuePropagating(Runtime *runtime) {
 	// which may itself contain a keyboard messenger.  (Do multiple messengers respond to keystrokes?)
 	while (_dispatchIndex < _keyboardMessengers.size()) {
 		Common::SharedPtr<RuntimeObject> obj = _keyboardMessengers[_dispatchIndex++].lock();
+		if (!obj)
+			continue;	// Destroyed since the messenger index was built
+
 		assert(obj->isModifier());
 
 		Modifier *modifier = static_cast<Modifier *>(obj.get());
@@ -4552,7 +4555,7 @@ Runtime::Runtime(OSystem *system, Audio::Mixer *mixer, ISaveUIProvider *saveProv
 	  _forceCursorRefreshOnce(true), _autoResetCursor(false), _haveModifierOverrideCursor(false), _haveCursorElement(false), _sceneGraphChanged(false), _isQuitting(false),
 	  _collisionCheckTime(0), /*_elementCursorUpdateTime(0), */_defaultVolumeState(true), _activeSceneTransitionEffect(nullptr), _sceneTransitionStartTime(0), _sceneTransitionEndTime(0),
 	  _sharedSceneWasSetExplicitly(false), _modifierOverrideCursorID(0), _subtitleRenderer(subRenderer), _multiClickStartTime(0), _multiClickInterval(500), _multiClickCount(0), _numMouseBlockers(0),
-	  _pendingSceneReturnCount(0) {
+	  _pendingSceneReturnCount(0), _structuralLookupsDirty(true) {
 	_random.reset(new Common::RandomSource("mtropolis"));
 
 	_coroManager.reset(ICoroutineManager::create());
@@ -4644,7 +4647,16 @@ bool Runtime::runFrame() {
 					// messenger fires and disables or enables other keyboard messengers.
 					// Not sure this is actually possible though... can multiple messengers respond to
 					// the same keystroke?  Not sure.
-					_project->recursiveCollectObjectsMatchingCriteria(dispatch->getKeyboardMessengerArray(), KeyEventDispatch::keyboardMessengerFilterFunc, dispatch.get(), false);
+					//
+					// The set of keyboard messengers only changes when the structural hierarchy does,
+					// so the project walk result is cached until invalidateStructuralLookups is called.
+					if (_structuralLookupsDirty) {
+						_cachedKeyboardMessengers.clear();
+						_project->recursiveCollectObjectsMatchingCriteria(_cachedKeyboardMessengers, KeyEventDispatch::keyboardMessengerFilterFunc, nullptr, false);
+						_structuralLookupsDirty = false;
+					}
+
+					dispatch->getKeyboardMessengerArray() = _cachedKeyboardMessengers;
 
 					if (dispatch->getKeyboardMessengerArray().size() > 0) {
 						DispatchKeyTaskData *taskData = _vthread->pushTask("Runtime::dispatchKeyTask", this, &Runtime::dispatchKeyTask);
@@ -5134,6 +5146,8 @@ Common::SharedPtr<Structural> Runtime::findDefaultSharedSceneForScene(Structural
 }
 
 void Runtime::executeTeardown(const Teardown &teardown) {
+	invalidateStructuralLookups();
+
 	if (Common::SharedPtr<Structural> structural = teardown.structural.lock()) {
 		recursiveDeactivateStructural(structural.get());
 
@@ -5231,6 +5245,8 @@ void Runtime::executeSceneChangeRecursiveVisibilityChange(Structural *structural
 void Runtime::executeChangeObjectParent(RuntimeObject *object, RuntimeObject *newParent) {
 	// TODO: Should do circularity checks
 
+	invalidateStructuralLookups();
+
 	if (object->isModifier()) {
 		Common::SharedPtr<Modifier> modifier = object->getSelfReference().lock().staticCast<Modifier>();
 
@@ -5296,6 +5312,8 @@ void Runtime::executeChangeObjectParent(RuntimeObject *object, RuntimeObject *ne
 }
 
 void Runtime::executeCloneObject(RuntimeObject *object) {
+	invalidateStructuralLookups();
+
 	Common::HashMap<RuntimeObject *, RuntimeObject *> objectRemaps;
 
 	if (object->isModifier()) {
@@ -5864,6 +5882,8 @@ void Runtime::loadScene(const Common::SharedPtr<Structural> &scene) {
 		recursiveActivateStructural(scene.get());
 		debug(1, "Structural elements activated OK");
 
+		invalidateStructuralLookups();
+
 #ifdef MTROPOLIS_DEBUG_ENABLE
 		if (_debugger) {
 			_debugger->complainAboutUnfinished(scene.get());
@@ -6793,6 +6813,11 @@ void Runtime::setSceneGraphDirty() {
 	_sceneGraphChanged = true;
 }
 
+void Runtime::invalidateStructuralLookups() {
+	_structuralLookupsDirty = true;
+	_cachedKeyboardMessengers.clear();
+}
+
 void Runtime::clearSceneGraphDirty() {
 	_sceneGraphChanged = false;
 }
@@ -7291,6 +7316,8 @@ void Runtime::unloadProject() {
 		removeWindow(_mainWindow.lock().get());
 	}
 
+	invalidateStructuralLookups();
+
 	// These should be last
 	_project.reset();
 	_rootLinkingScope.reset();
@@ -8033,18 +8060,12 @@ void Project::forceLoadAsset(uint32 assetID, Common::Array<Common::SharedPtr<Ass
 }
 
 bool Project::getAssetIDByName(const Common::String &assetName, uint32 &outAssetID) const {
-	for (uint32 assetID = 0; assetID < _assetsByID.size(); assetID++) {
-		const AssetDesc *assetDesc = _assetsByID[assetID];
-		if (!assetDesc)
-			continue;
-
-		if (caseInsensitiveEqual(assetName, assetDesc->name)) {
-			outAssetID = assetID;
-			return true;
-		}
-	}
+	Common::HashMap<Common::String, size_t>::const_iterator it = _assetNameToID.find(toCaseInsensitive(assetName));
+	if (it == _assetNameToID.end())
+		return false;
 
-	return false;
+	outAssetID = it->_value;
+	return true;
 }
 
 size_t Project::getSegmentForStreamIndex(size_t streamIndex) const {
@@ -8345,8 +8366,13 @@ void Project::loadAssetCatalog(const Data::AssetCatalog &assetCatalog) {
 			assetDesc.filePosition = assetInfo.filePosition;
 
 			_assetsByID[assetDesc.id] = &assetDesc;
-			if (!assetDesc.name.empty())
-				_assetNameToID[assetDesc.name] = assetDesc.id;
+			if (!assetDesc.name.empty()) {
+				// Keyed case-insensitively; keep the lowest ID on duplicate names to match
+				// what a linear catalog scan would find
+				Common::String nameKey = toCaseInsensitive(assetDesc.name);
+				if (!_assetNameToID.contains(nameKey))
+					_assetNameToID[nameKey] = assetDesc.id;
+			}
 		}
 	}
 }
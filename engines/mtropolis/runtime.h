@@ -1686,6 +1686,11 @@ public:
 	void clearSceneGraphDirty();
 	bool isSceneGraphDirty() const;
 
+	// Discards cached results of whole-project structural walks.  Must be called whenever
+	// objects are added to, removed from, or moved within the project hierarchy so that
+	// incremental lookups (e.g. the keyboard messenger index) are rebuilt.
+	void invalidateStructuralLookups();
+
 	void addCollider(ICollider *collider);
 	void removeCollider(ICollider *collider);
 	void checkCollisions(ICollider *optRestrictToCollider);
@@ -1919,6 +1924,10 @@ private:
 	Common::SharedPtr<Structural> _activeSharedScene;
 	Common::Array<SceneReturnListEntry> _sceneReturnList;
 
+	// Cached whole-project walk results, rebuilt lazily after structural changes
+	Common::Array<Common::WeakPtr<RuntimeObject> > _cachedKeyboardMessengers;
+	bool _structuralLookupsDirty;
+
 	SceneTransitionState _sceneTransitionState;
 	SceneTransitionEffect _sourceSceneTransitionEffect;
 	SceneTransitionEffect _destinationSceneTransitionEffect;
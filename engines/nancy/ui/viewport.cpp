@@ -36,6 +36,9 @@
 namespace Nancy {
 namespace UI {
 
+// Byte budget for composited scene backgrounds kept across scene changes
+static const uint32 kBackgroundCacheMaxBytes = 8 * 1024 * 1024;
+
 // does NOT put the object in a valid state until loadVideo is called
 void Viewport::init() {
 	auto *bootSummary = GetEngineData(BSUM);
@@ -213,10 +216,39 @@ void Viewport::handleInput(NancyInput &input) {
 }
 
 void Viewport::loadVideo(const Common::Path &filename, uint frameNr, uint verticalScroll, byte panningType, uint16 format, const Common::Path &palette) {
+	const Common::String cacheKey = makeBackgroundCacheKey(filename, palette, format);
+
 	if (_decoder.isVideoLoaded()) {
 		_decoder.close();
 	}
 
+	if (CachedBackground *cached = lookupCachedBackground(cacheKey)) {
+		// Static scene background we have shown before; reuse the composited
+		// frame instead of re-opening and re-decoding the video
+		_videoFormat = format;
+
+		enableEdges(kUp | kDown | kLeft | kRight);
+
+		_panningType = panningType;
+
+		_fullFrame.copyFrom(cached->fullFrame);
+		_cachedFrameCount = 1;
+		_currentFrame = 0;
+		_needsRedraw = true;
+
+		setVerticalScroll(verticalScroll);
+
+		if (!palette.empty()) {
+			setPalette(palette);
+		}
+
+		_movementLastFrame = 0;
+		_nextMovementTime = 0;
+		return;
+	}
+
+	_cachedFrameCount = 0;
+
 	if (!_decoder.loadFile(filename.append(".avf"))) {
 		error("Couldn't load video file %s", filename.toString().c_str());
 	}
@@ -235,10 +267,74 @@ void Viewport::loadVideo(const Common::Path &filename, uint frameNr, uint vertic
 		setPalette(palette);
 	}
 
+	// Single-frame videos are static backgrounds; remember the composited
+	// frame so revisits blit instead of re-decoding
+	if (_decoder.getFrameCount() == 1) {
+		storeCachedBackground(cacheKey);
+	}
+
 	_movementLastFrame = 0;
 	_nextMovementTime = 0;
 }
 
+Common::String Viewport::makeBackgroundCacheKey(const Common::Path &filename, const Common::Path &palette, uint16 format) {
+	return Common::String::format("%s#%s#%u", filename.toString().c_str(), palette.toString().c_str(), format);
+}
+
+Viewport::CachedBackground *Viewport::lookupCachedBackground(const Common::String &key) {
+	if (!_backgroundCache.contains(key)) {
+		return nullptr;
+	}
+
+	// Move the entry to the front of the eviction order
+	for (Common::List<Common::String>::iterator it = _backgroundCacheOrder.begin(); it != _backgroundCacheOrder.end(); ++it) {
+		if (*it == key) {
+			_backgroundCacheOrder.erase(it);
+			break;
+		}
+	}
+	_backgroundCacheOrder.push_front(key);
+
+	return _backgroundCache[key];
+}
+
+void Viewport::storeCachedBackground(const Common::String &key) {
+	CachedBackground *entry = new CachedBackground();
+	entry->fullFrame.copyFrom(_fullFrame);
+	entry->byteSize = entry->fullFrame.pitch * entry->fullFrame.h;
+
+	if (entry->byteSize > kBackgroundCacheMaxBytes) {
+		entry->fullFrame.free();
+		delete entry;
+		return;
+	}
+
+	_backgroundCache[key] = entry;
+	_backgroundCacheOrder.push_front(key);
+	_backgroundCacheBytes += entry->byteSize;
+
+	// Evict the least recently shown backgrounds once over budget
+	while (_backgroundCacheBytes > kBackgroundCacheMaxBytes && _backgroundCacheOrder.size() > 1) {
+		const Common::String &oldKey = _backgroundCacheOrder.back();
+		CachedBackground *old = _backgroundCache[oldKey];
+		_backgroundCacheBytes -= old->byteSize;
+		old->fullFrame.free();
+		delete old;
+		_backgroundCache.erase(oldKey);
+		_backgroundCacheOrder.pop_back();
+	}
+}
+
+void Viewport::clearBackgroundCache() {
+	for (auto &entry : _backgroundCache) {
+		entry._value->fullFrame.free();
+		delete entry._value;
+	}
+	_backgroundCache.clear();
+	_backgroundCacheOrder.clear();
+	_backgroundCacheBytes = 0;
+}
+
 void Viewport::setFrame(uint frameNr) {
 	assert(frameNr < _decoder.getFrameCount());
 
@@ -22,6 +22,10 @@
 #ifndef NANCY_UI_VIEWPORT_H
 #define NANCY_UI_VIEWPORT_H
 
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/list.h"
+
 #include "engines/nancy/time.h"
 #include "engines/nancy/video.h"
 
@@ -49,9 +53,11 @@ public:
 		_stickyCursorPos(-1, -1),
 		_panningType(kPanNone),
 		_decoder(AVFDecoder::kLoadBidirectional),
+		_cachedFrameCount(0),
+		_backgroundCacheBytes(0),
 		_autoMove(false) {}
 
-	virtual ~Viewport() { _decoder.close(); _fullFrame.free(); }
+	virtual ~Viewport() { _decoder.close(); _fullFrame.free(); clearBackgroundCache(); }
 
 	void init() override;
 	void handleInput(NancyInput &input);
@@ -66,7 +72,7 @@ public:
 	void scrollUp(uint delta);
 	void scrollDown(uint delta);
 
-	uint16 getFrameCount() const { return _decoder.isVideoLoaded() ? _decoder.getFrameCount() : 0; }
+	uint16 getFrameCount() const { return _decoder.isVideoLoaded() ? _decoder.getFrameCount() : _cachedFrameCount; }
 	uint16 getCurFrame() const { return _currentFrame; }
 	uint16 getCurVerticalScroll() const { return _drawSurface.getOffsetFromOwner().y; }
 	uint16 getMaxScroll() const;
@@ -78,8 +84,20 @@ public:
 	void enableEdges(byte edges);
 
 protected:
+	// Fully composited single-frame scene background, kept across scene
+	// changes so that revisits blit instead of re-decoding the video
+	struct CachedBackground {
+		Graphics::ManagedSurface fullFrame;
+		uint32 byteSize;
+	};
+
 	void setEdgesSize(uint16 upSize, uint16 downSize, uint16 leftSize, uint16 rightSize);
 
+	static Common::String makeBackgroundCacheKey(const Common::Path &filename, const Common::Path &palette, uint16 format);
+	CachedBackground *lookupCachedBackground(const Common::String &key);
+	void storeCachedBackground(const Common::String &key);
+	void clearBackgroundCache();
+
 	Common::Rect _nonScrollZone;
 	byte _edgesMask;
 
@@ -89,6 +107,12 @@ protected:
 	byte _panningType;
 
 	AVFDecoder _decoder;
+	uint16 _cachedFrameCount;
+
+	Common::HashMap<Common::String, CachedBackground *> _backgroundCache;
+	Common::List<Common::String> _backgroundCacheOrder; // most recently used first
+	uint32 _backgroundCacheBytes;
+
 	uint16 _currentFrame;
 	uint16 _videoFormat;
 	Graphics::ManagedSurface _fullFrame;
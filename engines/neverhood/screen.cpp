@@ -399,6 +399,36 @@ void Screen::queueBlit(const Graphics::Surface *surface, int16 destX, int16 dest
 
 }
 
+// Copies copySource to dest wherever source differs from alphaColor.
+// Runs are classified eight pixels at a time: a word without the key byte
+// becomes one wide copy, a word of only key bytes is skipped, and only
+// mixed words fall back to testing per pixel.
+static void blitRowKeyed(byte *dest, const byte *source, const byte *copySource, int16 width, byte alphaColor) {
+	const uint64 keyPattern = 0x0101010101010101ULL * alphaColor;
+	int16 xc = 0;
+
+	for (; xc + 8 <= width; xc += 8) {
+		uint64 word;
+		memcpy(&word, source + xc, 8);
+		if (word == keyPattern)
+			continue;
+
+		const uint64 keyed = word ^ keyPattern;
+		if (!((keyed - 0x0101010101010101ULL) & ~keyed & 0x8080808080808080ULL)) {
+			// No key byte in this word
+			memcpy(dest + xc, copySource + xc, 8);
+		} else {
+			for (int16 i = xc; i < xc + 8; i++)
+				if (source[i] != alphaColor)
+					dest[i] = copySource[i];
+		}
+	}
+
+	for (; xc < width; xc++)
+		if (source[xc] != alphaColor)
+			dest[xc] = copySource[xc];
+}
+
 void Screen::blitRenderItem(const RenderItem &renderItem, const Common::Rect &clipRect) {
 
 	const Graphics::Surface *surface = renderItem._surface;
@@ -419,9 +449,7 @@ void Screen::blitRenderItem(const RenderItem &renderItem, const Common::Rect &cl
 	if (shadowSurface) {
 		const byte *shadowSource = (const byte*)shadowSurface->getBasePtr(x0, y0);
 		while (height--) {
-			for (int xc = 0; xc < width; xc++)
-				if (source[xc] != 0)
-					dest[xc] = shadowSource[xc];
+			blitRowKeyed(dest, source, shadowSource, width, 0);
 			source += surface->pitch;
 			shadowSource += shadowSurface->pitch;
 			dest += _backScreen->pitch;
@@ -432,19 +460,9 @@ void Screen::blitRenderItem(const RenderItem &renderItem, const Common::Rect &cl
 			source += surface->pitch;
 			dest += _backScreen->pitch;
 		}
-	} else if (renderItem._alphaColor == 0) {
-		while (height--) {
-			for (int xc = 0; xc < width; xc++)
-				if (source[xc] != 0)
-					dest[xc] = source[xc];
-			source += surface->pitch;
-			dest += _backScreen->pitch;
-		}
 	} else {
 		while (height--) {
-			for (int xc = 0; xc < width; xc++)
-				if (source[xc] != renderItem._alphaColor)
-					dest[xc] = source[xc];
+			blitRowKeyed(dest, source, source, width, renderItem._alphaColor);
 			source += surface->pitch;
 			dest += _backScreen->pitch;
 		}
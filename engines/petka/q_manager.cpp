@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/memory.h"
 #include "common/memstream.h"
 #include "common/system.h"
 #include "common/substream.h"
@@ -97,6 +98,7 @@ Graphics::Surface *QManager::getSurface(uint32 id, uint16 w, uint16 h) {
 	res.type = QResource::kSurface;
 	res.surface = new Graphics::Surface;
 	res.surface->create(w, h, _vm._system->getScreenFormat());
+	ALLOC_TRACK("petka.surfaces", sizeof(Graphics::Surface) + res.surface->pitch * res.surface->h);
 
 	return res.surface;
 }
@@ -120,6 +122,7 @@ Graphics::Surface *QManager::getSurface(uint32 id) {
 	Common::ScopedPtr<Common::SeekableReadStream> preloaded_stream (stream->readStream(stream->size()));
 	Graphics::Surface *s = loadBitmapSurface(*preloaded_stream);
 	if (s) {
+		ALLOC_TRACK("petka.surfaces", sizeof(Graphics::Surface) + s->pitch * s->h);
 		QResource &res = _resourceMap.getOrCreateVal(id);
 		res.type = QResource::kSurface;
 		res.surface = s;
@@ -147,6 +150,7 @@ FlicDecoder *QManager::getFlic(uint32 id) {
 
 	FlicDecoder *flc = new FlicDecoder;
 	flc->load(stream, _vm.openFile(name, false));
+	ALLOC_TRACK("petka.flics", sizeof(FlicDecoder));
 
 	QResource &res = _resourceMap.getOrCreateVal(id);
 	res.type = QResource::kFlic;
@@ -196,6 +200,7 @@ Graphics::Surface *QManager::loadBitmapSurface(Common::SeekableReadStream &strea
 
 	stream.seek(0, SEEK_SET);
 	byte *convertedBmp = new byte[realFileSize];
+	ALLOC_TRACK("petka.bitmapConvert", realFileSize);
 
 	stream.read(convertedBmp, kHeaderSize);
 	WRITE_LE_INT16(convertedBmp + 28, 24); // bitsPerPixel
@@ -223,9 +228,12 @@ Graphics::Surface *QManager::loadBitmapSurface(Common::SeekableReadStream &strea
 
 QManager::QResource::~QResource() {
 	if (type == QResource::kSurface && surface) {
+		ALLOC_TRACK_FREE("petka.surfaces", sizeof(Graphics::Surface) + surface->pitch * surface->h);
 		surface->free();
 		delete surface;
 	} else {
+		if (flcDecoder)
+			ALLOC_TRACK_FREE("petka.flics", sizeof(FlicDecoder));
 		delete flcDecoder;
 	}
 }
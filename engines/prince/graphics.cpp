@@ -92,22 +92,48 @@ void GraphicsMan::draw(Graphics::Surface *screen, const Graphics::Surface *s) {
 	change();
 }
 
+// Returns true when any byte of the word matches value
+static inline bool rowHasColor(uint64 word, byte value) {
+	const uint64 pattern = word ^ (0x0101010101010101ULL * value);
+	return ((pattern - 0x0101010101010101ULL) & ~pattern & 0x8080808080808080ULL) != 0;
+}
+
+// Copies src to dst, skipping pixels of transColor1 (and transColor2 unless
+// it is negative). Eight pixels are checked at once, so the opaque interior
+// of a sprite is copied in word-sized chunks and only runs containing a
+// transparent color fall back to testing per pixel.
+static void drawRowKeyed(byte *dst, const byte *src, int width, byte transColor1, int transColor2) {
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		uint64 word;
+		memcpy(&word, src + x, 8);
+		if (!rowHasColor(word, transColor1) && (transColor2 < 0 || !rowHasColor(word, (byte)transColor2))) {
+			memcpy(dst + x, src + x, 8);
+		} else {
+			for (int i = x; i < x + 8; i++)
+				if (src[i] != transColor1 && src[i] != transColor2)
+					dst[i] = src[i];
+		}
+	}
+
+	for (; x < width; x++)
+		if (src[x] != transColor1 && src[x] != transColor2)
+			dst[x] = src[x];
+}
+
 // Black (value = 0) as a primary transparent color, fix for FLC animations
 void GraphicsMan::drawTransparentSurface(Graphics::Surface *screen, int32 posX, int32 posY, const Graphics::Surface *s, int secondTransColor) {
 	const byte *src1 = (const byte *)s->getBasePtr(0, 0);
 	byte *dst1 = (byte *)screen->getBasePtr(posX, posY);
+
+	// Clip the horizontal range once instead of testing it per pixel
+	const int xStart = MAX<int32>(0, -posX);
+	const int xEnd = MIN<int32>(s->w, screen->w - posX);
+
 	for (int y = 0; y < s->h; y++) {
-		if (y + posY < screen->h && y + posY >= 0) {
-			const byte *src2 = src1;
-			byte *dst2 = dst1;
-			for (int x = 0; x < s->w; x++, src2++, dst2++) {
-				if (*src2 && *src2 != secondTransColor) {
-					if (x + posX < screen->w && x + posX >= 0) {
-						*dst2 = *src2;
-					}
-				}
-			}
-		}
+		if (y + posY < screen->h && y + posY >= 0 && xEnd > xStart)
+			drawRowKeyed(dst1 + xStart, src1 + xStart, xEnd - xStart, 0, secondTransColor);
 		src1 += s->pitch;
 		dst1 += screen->pitch;
 	}
@@ -175,18 +201,14 @@ void GraphicsMan::drawTransparentWithBlendSurface(Graphics::Surface *screen, int
 void GraphicsMan::drawTransparentDrawNode(Graphics::Surface *screen, DrawNode *drawNode) {
 	byte *src1 = (byte *)drawNode->s->getBasePtr(0, 0);
 	byte *dst1 = (byte *)screen->getBasePtr(drawNode->posX, drawNode->posY);
+
+	// Clip the horizontal range once instead of testing it per pixel
+	const int xStart = MAX<int32>(0, -drawNode->posX);
+	const int xEnd = MIN<int32>(drawNode->s->w, screen->w - drawNode->posX);
+
 	for (int y = 0; y < drawNode->s->h; y++) {
-		if (y + drawNode->posY < screen->h && y + drawNode->posY >= 0) {
-			byte *src2 = src1;
-			byte *dst2 = dst1;
-			for (int x = 0; x < drawNode->s->w; x++, src2++, dst2++) {
-				if (*src2 != 255) {
-					if (x + drawNode->posX < screen->w && x + drawNode->posX >= 0) {
-						*dst2 = *src2;
-					}
-				}
-			}
-		}
+		if (y + drawNode->posY < screen->h && y + drawNode->posY >= 0 && xEnd > xStart)
+			drawRowKeyed(dst1 + xStart, src1 + xStart, xEnd - xStart, 255, -1);
 		src1 += drawNode->s->pitch;
 		dst1 += screen->pitch;
 	}
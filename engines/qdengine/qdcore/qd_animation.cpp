@@ -21,6 +21,7 @@
 
 #include "common/debug.h"
 #include "common/file.h"
+#include "common/memory.h"
 
 #include "backends/imgui/IconsMaterialSymbols.h"
 
@@ -671,12 +672,14 @@ bool qdAnimation::qda_load(const Common::Path &fpath) {
 
 		for (int i = 0; i < num_fr; i++) {
 			qdAnimationFrame *p = new qdAnimationFrame;
+			ALLOC_TRACK("qdengine.animFrames", sizeof(qdAnimationFrame));
 			p->qda_load(fh, version);
 			add_frame(p);
 		}
 
 		for (int i = 0; i < num_fr * num_scales; i++) {
 			qdAnimationFrame *p = new qdAnimationFrame;
+			ALLOC_TRACK("qdengine.animFrames", sizeof(qdAnimationFrame));
 			p->qda_load(fh, version);
 			_scaled_frames.push_back(p);
 		}
@@ -692,6 +695,7 @@ bool qdAnimation::qda_load(const Common::Path &fpath) {
 			length = fh->readFloatLE();
 
 			qdAnimationFrame *p = new qdAnimationFrame;
+			ALLOC_TRACK("qdengine.animFrames", sizeof(qdAnimationFrame));
 			p->set_start_time(start_time);
 			p->set_length(length);
 			add_frame(p);
@@ -1107,10 +1111,14 @@ bool qdAnimation::copy_frames(const qdAnimation &anm) {
 }
 
 void qdAnimation::clear_frames() {
-	for (qdAnimationFrameList::iterator it = _frames.begin(); it != _frames.end(); ++it)
+	for (qdAnimationFrameList::iterator it = _frames.begin(); it != _frames.end(); ++it) {
+		ALLOC_TRACK_FREE("qdengine.animFrames", sizeof(qdAnimationFrame));
 		delete *it;
-	for (qdAnimationFrameList::iterator it = _scaled_frames.begin(); it != _scaled_frames.end(); ++it)
+	}
+	for (qdAnimationFrameList::iterator it = _scaled_frames.begin(); it != _scaled_frames.end(); ++it) {
+		ALLOC_TRACK_FREE("qdengine.animFrames", sizeof(qdAnimationFrame));
 		delete *it;
+	}
 
 	_frames.clear();
 	_scaled_frames.clear();
@@ -1130,13 +1138,16 @@ bool qdAnimation::add_scale(float value) {
 bool qdAnimation::create_scaled_frames() {
 	if (check_flag(QD_ANIMATION_FLAG_REFERENCE)) return false;
 
-	for (qdAnimationFrameList::iterator it = _scaled_frames.begin(); it != _scaled_frames.end(); ++it)
+	for (qdAnimationFrameList::iterator it = _scaled_frames.begin(); it != _scaled_frames.end(); ++it) {
+		ALLOC_TRACK_FREE("qdengine.animFrames", sizeof(qdAnimationFrame));
 		delete *it;
+	}
 	_scaled_frames.clear();
 
 	for (uint i = 0; i < _scales.size(); i++) {
 		for (qdAnimationFrameList::iterator it = _frames.begin(); it != _frames.end(); ++it) {
 			_scaled_frames.push_back((*it)->clone());
+			ALLOC_TRACK("qdengine.animFrames", sizeof(qdAnimationFrame));
 			_scaled_frames.back()->scale(_scales[i], _scales[i]);
 		}
 	}
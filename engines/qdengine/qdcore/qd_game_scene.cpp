@@ -20,6 +20,7 @@
  */
 
 #include "common/config-manager.h"
+#include "common/memory.h"
 #include "common/debug.h"
 #include "common/stream.h"
 
@@ -319,16 +320,19 @@ void qdGameScene::load_script(const xml::tag *p) {
 			break;
 		case QDSCR_STATIC_OBJECT:
 			obj = new qdGameObjectStatic;
+			ALLOC_TRACK("qdengine.sceneObjects", sizeof(qdGameObjectStatic));
 			obj->load_script(&*it);
 			add_object(obj);
 			break;
 		case QDSCR_ANIMATED_OBJECT:
 			obj = new qdGameObjectAnimated;
+			ALLOC_TRACK("qdengine.sceneObjects", sizeof(qdGameObjectAnimated));
 			obj->load_script(&*it);
 			add_object(obj);
 			break;
 		case QDSCR_MOVING_OBJECT:
 			obj = new qdGameObjectMoving;
+			ALLOC_TRACK("qdengine.sceneObjects", sizeof(qdGameObjectMoving));
 			obj->load_script(&*it);
 			add_object(obj);
 			personages_count++;
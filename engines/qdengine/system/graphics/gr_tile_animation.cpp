@@ -21,6 +21,7 @@
 
 #include "common/debug.h"
 #include "common/file.h"
+#include "common/memory.h"
 
 #include "graphics/managed_surface.h"
 #include "image/png.h"
@@ -310,6 +311,9 @@ bool grTileAnimation::load(Common::SeekableReadStream *fh, int version) {
 	for (uint i = 0; i < size; i++)
 		_tileData[i] = fh->readUint32LE();
 
+	ALLOC_TRACK("qdengine.tileData",
+		(_frameIndex.size() + _tileOffsets.size() + _tileData.size()) * sizeof(uint32));
+
 	debugC(dL + 1, kDebugLoad, "  --> grTileAnimation::load(): pos: %d remaining: %d", (int)fh->pos(), (int)(fh->size() - fh->pos()));
 
 	return true;
@@ -115,6 +115,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("resource_id",		WRAP_METHOD(Console, cmdResourceId));
 	registerCmd("resource_info",		WRAP_METHOD(Console, cmdResourceInfo));
 	registerCmd("resource_types",		WRAP_METHOD(Console, cmdResourceTypes));
+	registerCmd("resource_cache",		WRAP_METHOD(Console, cmdResourceCache));
 	registerCmd("list",				WRAP_METHOD(Console, cmdList));
 	registerCmd("alloc_list",				WRAP_METHOD(Console, cmdAllocList));
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
@@ -355,6 +356,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" resource_id - Identifies a resource number by splitting it up in resource type and resource number\n");
 	debugPrintf(" resource_info - Shows info about a resource\n");
 	debugPrintf(" resource_types - Shows the valid resource types\n");
+	debugPrintf(" resource_cache - Shows usage statistics of the LRU resource cache\n");
 	debugPrintf(" list - Lists all the resources of a given type\n");
 	debugPrintf(" alloc_list - Lists all allocated resources\n");
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
@@ -1191,6 +1193,25 @@ bool Console::cmdResourceInfo(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdResourceCache(int argc, const char **argv) {
+	ResourceManager *resMan = _engine->getResMan();
+	const uint32 hits = resMan->getCacheHits();
+	const uint32 misses = resMan->getCacheMisses();
+	const uint32 requests = hits + misses;
+
+	debugPrintf("LRU resource cache (override budget with the resource_cache_size setting, in KiB):\n");
+	debugPrintf("Budget: %d bytes\n", resMan->getMaxMemoryLRU());
+	debugPrintf("In use: %d bytes under LRU control, %d bytes locked\n",
+			resMan->getMemoryLRU(), resMan->getMemoryLocked());
+	debugPrintf("Requests: %u (%u hits, %u misses", requests, hits, misses);
+	if (requests > 0)
+		debugPrintf(", %.1f%% hit rate", 100.0 * hits / requests);
+	debugPrintf(")\n");
+	debugPrintf("Evictions: %u\n", resMan->getCacheEvictions());
+
+	return true;
+}
+
 bool Console::cmdResourceTypes(int argc, const char **argv) {
 	debugPrintf("The %d valid resource types are:\n", kResourceTypeInvalid);
 	for (int i = 0; i < kResourceTypeInvalid; i++) {
@@ -91,6 +91,8 @@ void CelObj::init() {
 	_nextCacheId = 1;
 	_scaler = new CelScaler();
 	_cache = new CelCache(100);
+	_scaledCache = new ScaledCelCache(32);
+	_scaledCacheSize = 0;
 }
 
 void CelObj::deinit() {
@@ -98,6 +100,8 @@ void CelObj::deinit() {
 	_scaler = nullptr;
 	delete _cache;
 	_cache = nullptr;
+	delete _scaledCache;
+	_scaledCache = nullptr;
 }
 
 #pragma mark -
@@ -280,19 +284,65 @@ struct SCALER_Scale {
 					_valuesY[y] = table.valuesY[y] - unscaledY;
 				}
 			} else {
-				if (FLIP) {
-					const int lastIndex = celObj._width - 1;
+				// Without the global scaling pattern the cadence of source
+				// pixels depends only on the scaling ratios, so the scaled
+				// image is identical wherever the cel ends up on screen.
+				// Scale the cel once, keep the result in the scaled cel
+				// cache and serve repeated draws from there. Cels rendered
+				// from mutable memory bitmaps are excluded, since their
+				// pixels may change without their identity changing.
+				const int16 scaledWidth = (celObj._width * scaleX).toInt();
+				const int16 scaledHeight = (celObj._height * scaleY).toInt();
+				const bool cacheable = celObj._info.type != kCelTypeMem &&
+					scaledWidth > 0 && scaledHeight > 0 &&
+					scaledWidth <= kCelScalerTableSize && scaledHeight <= kCelScalerTableSize &&
+					scaledWidth * scaledHeight <= kScaledCelCacheMaxSize / 2;
+				if (cacheable) {
+					_sourceBuffer = celObj.searchScaledCache(scaleX, scaleY, FLIP);
+					if (!_sourceBuffer) {
+						_sourceBuffer = Common::SharedPtr<Buffer>(new Buffer(), Graphics::SurfaceDeleter());
+						_sourceBuffer->create(scaledWidth, scaledHeight, Graphics::PixelFormat::createFormatCLUT8());
+						const int lastIndex = celObj._width - 1;
+						const int lastRow = celObj._height - 1;
+						for (int16 y = 0; y < scaledHeight; ++y) {
+							const byte *sourceRow = _reader.getRow(MIN<int>(table.valuesY[y], lastRow));
+							byte *targetRow = static_cast<byte *>(_sourceBuffer->getBasePtr(0, y));
+							if (FLIP) {
+								for (int16 x = 0; x < scaledWidth; ++x) {
+									targetRow[x] = sourceRow[lastIndex - MIN<int>(table.valuesX[x], lastIndex)];
+								}
+							} else {
+								for (int16 x = 0; x < scaledWidth; ++x) {
+									targetRow[x] = sourceRow[MIN<int>(table.valuesX[x], lastIndex)];
+								}
+							}
+						}
+						celObj.putScaledInCache(scaleX, scaleY, FLIP, _sourceBuffer);
+					}
+
+					// Map target positions directly onto the scaled image,
+					// which already includes any mirroring
 					for (int16 x = targetRect.left; x < targetRect.right; ++x) {
-						_valuesX[x] = lastIndex - table.valuesX[x - scaledPosition.x];
+						_valuesX[x] = CLIP<int16>(x - scaledPosition.x, 0, scaledWidth - 1);
+					}
+					for (int16 y = targetRect.top; y < targetRect.bottom; ++y) {
+						_valuesY[y] = CLIP<int16>(y - scaledPosition.y, 0, scaledHeight - 1);
 					}
 				} else {
-					for (int16 x = targetRect.left; x < targetRect.right; ++x) {
-						_valuesX[x] = table.valuesX[x - scaledPosition.x];
+					if (FLIP) {
+						const int lastIndex = celObj._width - 1;
+						for (int16 x = targetRect.left; x < targetRect.right; ++x) {
+							_valuesX[x] = lastIndex - table.valuesX[x - scaledPosition.x];
+						}
+					} else {
+						for (int16 x = targetRect.left; x < targetRect.right; ++x) {
+							_valuesX[x] = table.valuesX[x - scaledPosition.x];
+						}
 					}
-				}
 
-				for (int16 y = targetRect.top; y < targetRect.bottom; ++y) {
-					_valuesY[y] = table.valuesY[y - scaledPosition.y];
+					for (int16 y = targetRect.top; y < targetRect.bottom; ++y) {
+						_valuesY[y] = table.valuesY[y - scaledPosition.y];
+					}
 				}
 			}
 		}
@@ -700,6 +750,8 @@ void CelObj::submitPalette() const {
 
 int CelObj::_nextCacheId = 1;
 CelCache *CelObj::_cache = nullptr;
+ScaledCelCache *CelObj::_scaledCache = nullptr;
+int CelObj::_scaledCacheSize = 0;
 
 int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
 	*nextInsertIndex = -1;
@@ -739,6 +791,75 @@ void CelObj::putCopyInCache(const int cacheIndex) const {
 	entry.id = ++_nextCacheId;
 }
 
+Common::SharedPtr<Buffer> CelObj::searchScaledCache(const Ratio &scaleX, const Ratio &scaleY, const bool mirrorX) const {
+	for (int i = 0, len = _scaledCache->size(); i < len; ++i) {
+		ScaledCelCacheEntry &entry = (*_scaledCache)[i];
+
+		if (entry.buffer && entry.celInfo == _info &&
+			entry.scaleX == scaleX && entry.scaleY == scaleY &&
+			entry.mirrorX == mirrorX) {
+			entry.id = ++_nextCacheId;
+			return entry.buffer;
+		}
+	}
+
+	return Common::SharedPtr<Buffer>();
+}
+
+void CelObj::putScaledInCache(const Ratio &scaleX, const Ratio &scaleY, const bool mirrorX, const Common::SharedPtr<Buffer> &buffer) const {
+	const int size = buffer->w * buffer->h;
+
+	// Do not let one giant image evict everything else
+	if (size > kScaledCelCacheMaxSize / 2) {
+		return;
+	}
+
+	int oldestId = _nextCacheId + 1;
+	int insertIndex = 0;
+	for (int i = 0, len = _scaledCache->size(); i < len; ++i) {
+		ScaledCelCacheEntry &entry = (*_scaledCache)[i];
+
+		if (!entry.buffer) {
+			insertIndex = i;
+			break;
+		} else if (oldestId > entry.id) {
+			oldestId = entry.id;
+			insertIndex = i;
+		}
+	}
+
+	ScaledCelCacheEntry &entry = (*_scaledCache)[insertIndex];
+	if (entry.buffer) {
+		_scaledCacheSize -= entry.buffer->w * entry.buffer->h;
+	}
+	entry.celInfo = _info;
+	entry.scaleX = scaleX;
+	entry.scaleY = scaleY;
+	entry.mirrorX = mirrorX;
+	entry.buffer = buffer;
+	entry.id = ++_nextCacheId;
+	_scaledCacheSize += size;
+
+	// Drop the least recently used images until the cache fits its budget
+	while (_scaledCacheSize > kScaledCelCacheMaxSize) {
+		oldestId = _nextCacheId + 1;
+		int oldestIndex = -1;
+		for (int i = 0, len = _scaledCache->size(); i < len; ++i) {
+			ScaledCelCacheEntry &other = (*_scaledCache)[i];
+			if (other.buffer && i != insertIndex && oldestId > other.id) {
+				oldestId = other.id;
+				oldestIndex = i;
+			}
+		}
+		if (oldestIndex == -1) {
+			break;
+		}
+		ScaledCelCacheEntry &oldest = (*_scaledCache)[oldestIndex];
+		_scaledCacheSize -= oldest.buffer->w * oldest.buffer->h;
+		oldest.buffer.reset();
+	}
+}
+
 #pragma mark -
 #pragma mark CelObj - Drawing
 
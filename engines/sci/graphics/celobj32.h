@@ -148,6 +148,46 @@ struct CelCacheEntry {
 
 typedef Common::Array<CelCacheEntry> CelCache;
 
+struct ScaledCelCacheEntry {
+	/**
+	 * A monotonically increasing cache ID used to identify the least recently
+	 * used item in the cache for replacement.
+	 */
+	int id;
+
+	/**
+	 * The identity of the source cel.
+	 */
+	CelInfo32 celInfo;
+
+	/**
+	 * The scale ratios the image was generated with.
+	 */
+	Ratio scaleX;
+	Ratio scaleY;
+
+	/**
+	 * Whether the image was generated mirrored.
+	 */
+	bool mirrorX;
+
+	/**
+	 * The decompressed, scaled image.
+	 */
+	Common::SharedPtr<Buffer> buffer;
+
+	ScaledCelCacheEntry() : id(0), mirrorX(false) {}
+};
+
+typedef Common::Array<ScaledCelCacheEntry> ScaledCelCache;
+
+enum {
+	/**
+	 * The maximum number of bytes of image data kept in the scaled cel cache.
+	 */
+	kScaledCelCacheMaxSize = 4 * 1024 * 1024
+};
+
 #pragma mark -
 #pragma mark CelScaler
 
@@ -474,6 +514,35 @@ protected:
 	 * Puts a copy of this CelObj into the cache at the given cache index.
 	 */
 	void putCopyInCache(int index) const;
+
+	/**
+	 * A cache of decompressed, scaled cel images, used to avoid rescaling
+	 * (and, for compressed cels, re-decompressing) cels which are drawn at
+	 * the same scale across consecutive frames. Only used when the global
+	 * scaling pattern does not apply, as only then is the generated image
+	 * independent of the cel's position on screen.
+	 */
+	static ScaledCelCache *_scaledCache;
+
+	/**
+	 * The total size, in bytes, of all images in the scaled cel cache.
+	 */
+	static int _scaledCacheSize;
+
+public:
+	/**
+	 * Searches the scaled cel cache for an image of this cel generated with
+	 * the given scale ratios and mirroring. Returns an empty pointer if
+	 * there is none.
+	 */
+	Common::SharedPtr<Buffer> searchScaledCache(const Ratio &scaleX, const Ratio &scaleY, bool mirrorX) const;
+
+	/**
+	 * Puts the given scaled image of this cel into the scaled cel cache,
+	 * evicting the least recently used images if the cache exceeds its
+	 * size budget.
+	 */
+	void putScaledInCache(const Ratio &scaleX, const Ratio &scaleY, bool mirrorX, const Common::SharedPtr<Buffer> &buffer) const;
 };
 
 #pragma mark -
@@ -33,12 +33,10 @@
 
 namespace Sci {
 int Decompressor::unpack(Common::ReadStream *src, byte *dest, uint32 nPacked, uint32 nUnpacked) {
-	while (nPacked && !(src->eos() || src->err())) {
-		uint32 chunk = MIN<uint32>(1024, nPacked);
-		src->read(dest, chunk);
-		nPacked -= chunk;
-		dest += chunk;
-	}
+	// Uncompressed resources are simply copied; the destination buffer is
+	// fully allocated, so read them in one go instead of 1 KiB chunks.
+	if (nPacked && src->read(dest, nPacked) != nPacked)
+		return 1;
 	return (src->eos() || src->err()) ? 1 : 0;
 }
 
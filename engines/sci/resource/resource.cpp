@@ -604,18 +604,19 @@ void ResourceSource::loadResource(ResourceManager *resMan, Resource *res) {
 	if (!fileStream)
 		return;
 
-	fileStream->seek(0, SEEK_SET);
-	ResourceType type = resMan->convertResType(fileStream->readByte());
 	ResVersion volVersion = resMan->getVolVersion();
 
 	// FIXME: if resource.msg has different version from SCI, this has to be modified.
-	if (
-		(
-			(type == kResourceTypeMessage && res->getType() == kResourceTypeMessage) ||
-			(type == kResourceTypeText && res->getType() == kResourceTypeText)
-		) &&
-		g_sci && g_sci->getLanguage() == Common::KO_KOR)
-		volVersion = kResVersionSci11;
+	// Only probe the volume's first type byte for the Korean special case;
+	// everybody else gets to skip the extra seek and read per resource.
+	if ((res->getType() == kResourceTypeMessage || res->getType() == kResourceTypeText) &&
+			g_sci && g_sci->getLanguage() == Common::KO_KOR) {
+		fileStream->seek(0, SEEK_SET);
+		ResourceType type = resMan->convertResType(fileStream->readByte());
+		if ((type == kResourceTypeMessage && res->getType() == kResourceTypeMessage) ||
+				(type == kResourceTypeText && res->getType() == kResourceTypeText))
+			volVersion = kResVersionSci11;
+	}
 	fileStream->seek(res->_fileOffset, SEEK_SET);
 
 	int error = res->decompress(volVersion, fileStream);
@@ -1008,6 +1009,9 @@ void ResourceManager::init() {
 	_maxMemoryLRU = 256 * 1024; // 256KiB
 	_memoryLocked = 0;
 	_memoryLRU = 0;
+	_cacheHits = 0;
+	_cacheMisses = 0;
+	_cacheEvictions = 0;
 	_LRU.clear();
 	_resMap.clear();
 	_audioMapSCI1 = nullptr;
@@ -1082,6 +1086,12 @@ void ResourceManager::init() {
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
 	}
 
+	// The budget above is only a default. Users on memory-starved or
+	// very slow targets can override it (value in KiB) to trade memory
+	// for fewer decompression passes, or vice versa.
+	if (ConfMan.hasKey("resource_cache_size"))
+		_maxMemoryLRU = ConfMan.getInt("resource_cache_size") * 1024;
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1154,6 +1164,7 @@ void ResourceManager::freeOldResources() {
 		Resource *goner = _LRU.back();
 		removeFromLRU(goner);
 		goner->unalloc();
+		_cacheEvictions++;
 #ifdef SCI_VERBOSE_RESMAN
 		debug("resMan-debug: LRU: Freeing %s (%d bytes)", goner->_id.toString().c_str(), goner->size);
 #endif
@@ -1196,15 +1207,21 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	if (!retval)
 		return nullptr;
 
-	if (retval->_status == kResStatusNoMalloc)
+	if (retval->_status == kResStatusNoMalloc) {
+		// Not in memory: the data has to be read and decompressed
+		// (again, if the resource was evicted earlier) - a cache miss.
+		_cacheMisses++;
 		loadResource(retval);
-	else if (retval->_status == kResStatusEnqueued)
-		// The resource is removed from its current position
-		// in the LRU list because it has been requested
-		// again. Below, it will either be locked, or it
-		// will be added back to the LRU list at the 'most
-		// recent' position.
-		removeFromLRU(retval);
+	} else {
+		_cacheHits++;
+		if (retval->_status == kResStatusEnqueued)
+			// The resource is removed from its current position
+			// in the LRU list because it has been requested
+			// again. Below, it will either be locked, or it
+			// will be added back to the LRU list at the 'most
+			// recent' position.
+			removeFromLRU(retval);
+	}
 
 	// Unless an error occurred, the resource is now either
 	// locked or allocated, but never queued or freed.
@@ -24,7 +24,7 @@
 
 #include "common/str.h"
 #include "common/list.h"
-#include "common/hashmap.h"
+#include "common/flat-hashmap.h"
 
 #include "sci/graphics/helpers.h"		// for ViewType
 #include "sci/resource/decompressor.h"
@@ -321,7 +321,10 @@ protected:
 	int readResourceInfo(ResVersion volVersion, Common::SeekableReadStream *file, uint32 &szPacked, ResourceCompression &compression);
 };
 
-typedef Common::HashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
+// The resource map is on the lookup-heavy path of every findResource()
+// call, so it uses the open-addressing FlatHashMap; Resource objects are
+// heap-allocated, so rehashing only moves the pointers.
+typedef Common::FlatHashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
 
 class IntMapResourceSource;
 class ResourceManager {
@@ -487,6 +490,17 @@ public:
 	 */
 	ResourceType convertResType(byte type);
 
+	/**
+	 * Usage statistics of the LRU resource cache, for the debugger
+	 * console.
+	 */
+	int getMaxMemoryLRU() const { return _maxMemoryLRU; }
+	int getMemoryLRU() const { return _memoryLRU; }
+	int getMemoryLocked() const { return _memoryLocked; }
+	uint32 getCacheHits() const { return _cacheHits; }
+	uint32 getCacheMisses() const { return _cacheMisses; }
+	uint32 getCacheEvictions() const { return _cacheEvictions; }
+
 protected:
 	bool _detectionMode;
 
@@ -501,6 +515,9 @@ protected:
 	SourcesList _sources;
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
+	uint32 _cacheHits;	///< Number of requests served without re-reading the resource
+	uint32 _cacheMisses;	///< Number of requests that had to (re-)load and decompress
+	uint32 _cacheEvictions;	///< Number of resources freed to stay within the budget
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
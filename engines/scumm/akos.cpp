@@ -528,6 +528,20 @@ void AkosRenderer::byleRLEDecode(ByleRLEData &dataBlock) {
 			len = *src++;
 
 		do {
+			if (!color && !_actorHitMode && _scaleY == 255 && len > 1) {
+				// Transparent runs dominate most cels; step over them in one
+				// go instead of once per pixel. A run may continue into the
+				// next column, so only skip what is left of this one and let
+				// the regular code below handle the final pixel.
+				uint16 step = MIN<uint16>(len - 1, height - 1);
+				if (step) {
+					dst += _out.pitch * step;
+					mask += _numStrips * step;
+					y += step;
+					height -= step;
+					len -= step;
+				}
+			}
 			if (_scaleY == 255 || *scaleytab++ < _scaleY) {
 				if (_actorHitMode) {
 					if (color && y == _actorHitY && dataBlock.x == _actorHitX) {
@@ -20,8 +20,10 @@
  */
 
 #include "scumm/cdda.h"
+#include "common/bufferedstream.h"
 #include "common/file.h"
 #include "common/stream.h"
+#include "common/util.h"
 #include "audio/audiostream.h"
 
 namespace Scumm {
@@ -84,18 +86,30 @@ bool CDDAStream::seek(const Audio::Timestamp &where) {
 }
 
 int CDDAStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
+	int samples = 0;
+	int8 raw[BLOCK_SIZE];
 
-	for (samples = 0 ; samples < numSamples && !_stream->eos() ; ) {
+	while (samples < numSamples && !_stream->eos()) {
 		if (!((_pos - START_OF_CDDA_DATA) % BLOCK_SIZE)) {
 			byte shiftVal = _stream->readByte();
 			_shiftLeft = shiftVal >> 4;
 			_shiftRight = shiftVal & 0x0F;
 			_pos++;
 		}
-		buffer[samples++] = _stream->readSByte() << _shiftLeft;
-		buffer[samples++] = _stream->readSByte() << _shiftRight;
-		_pos += 2;
+
+		// Fetch the rest of the block (or as much of it as was asked
+		// for) in one read instead of one stream call per sample byte.
+		// The shift values only change on block boundaries, so the
+		// whole run decodes with the current pair.
+		uint32 posInBlock = (_pos - START_OF_CDDA_DATA) % BLOCK_SIZE;
+		uint32 bytes = MIN<uint32>(BLOCK_SIZE - posInBlock, (uint32)(numSamples - samples));
+		bytes = _stream->read(raw, bytes);
+
+		for (uint32 i = 0; i + 2 <= bytes; i += 2) {
+			buffer[samples++] = raw[i] << _shiftLeft;
+			buffer[samples++] = raw[i + 1] << _shiftRight;
+		}
+		_pos += bytes;
 	}
 	return samples;
 }
@@ -114,7 +128,13 @@ Audio::SeekableAudioStream *makeCDDAStream(
 		return nullptr;
 	}
 
-	Audio::SeekableAudioStream *s = new CDDAStream(cdAudioFile, disposeAfterUse);
+	// Read ahead a good chunk of the audio image, so the mixer thread
+	// does not hit slow media for every block; seeks within the window
+	// (track loops included) are served from the buffer.
+	Common::SeekableReadStream *buffered =
+		Common::wrapBufferedSeekableReadStream(cdAudioFile, 64 * 1024, DisposeAfterUse::YES);
+
+	Audio::SeekableAudioStream *s = new CDDAStream(buffered, disposeAfterUse);
 	if (s && s->endOfData()) {
 		delete s;
 		return nullptr;
@@ -54,6 +54,30 @@ static void copy8Col(byte *dst, int dstPitch, const byte *src, int height, uint8
 #endif
 static void clear8Col(byte *dst, int dstPitch, int height, uint8 bitDepth);
 
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+typedef void (*DrawStripKernel)(int height, int width, const byte *text, const byte *src, byte *dst,
+	int vsPitchGap, int textPitchGap);
+
+// Picks the text compositing kernel once, based on the CPU features the
+// backend reports; nullptr selects the portable 4-pixel loop below.
+static DrawStripKernel getDrawStripKernel() {
+	static DrawStripKernel kernel = nullptr;
+	static bool checked = false;
+	if (!checked) {
+		checked = true;
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			kernel = drawStripToScreenSSE2;
+#endif
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			kernel = drawStripToScreenNEON;
+#endif
+	}
+	return kernel;
+}
+#endif
+
 struct StripTable {
 	int offsets[160];
 	int run[160];
@@ -594,16 +618,29 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 	int i;
 	int w = 8;
 	int start = 0;
+	int top = 0;
+	int bottom = 0;
 
 	for (i = 0; i < _gdi->_numStrips; i++) {
 		if (vs->bdirty[i]) {
-			const int top = vs->tdirty[i];
-			const int bottom = vs->bdirty[i];
+			if (i == start) {
+				top = vs->tdirty[i];
+				bottom = vs->bdirty[i];
+			} else {
+				// Part of a coalesced run; grow the union of the dirty ranges.
+				top = MIN<int>(top, vs->tdirty[i]);
+				bottom = MAX<int>(bottom, vs->bdirty[i]);
+			}
 			vs->tdirty[i] = vs->h;
 			vs->bdirty[i] = 0;
-			if (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] == bottom && vs->tdirty[i + 1] == top) {
-				// Simple optimizations: if two or more neighboring strips
-				// form one bigger rectangle, coalesce them.
+			if (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] &&
+					(int)vs->tdirty[i + 1] <= bottom && (int)vs->bdirty[i + 1] >= top) {
+				// Simple optimization: neighboring strips with overlapping
+				// (or identical) dirty ranges are coalesced into one wider
+				// blit covering the union of both ranges. The virtual screen
+				// always holds the complete image, so the extra rows this
+				// may cover are valid - and one wide copy beats a separate
+				// call per 8-pixel strip.
 				w += 8;
 				continue;
 			}
@@ -724,35 +761,44 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 #ifdef USE_ARM_GFX_ASM
 			asmDrawStripToScreen(height, width, text, src, _compositeBuf, vs->pitch, width, _textSurface.pitch);
 #else
-			// We blit four pixels at a time, for improved performance.
-			const uint32 *src32 = (const uint32 *)src;
-			uint32 *dst32 = (uint32 *)_compositeBuf;
-
-			vsPitch >>= 2;
-
-			const uint32 *text32 = (const uint32 *)text;
-			const int textPitch = (_textSurface.pitch - width * m) >> 2;
-			for (int h = height * m; h > 0; --h) {
-				for (int w = width * m; w > 0; w -= 4) {
-					uint32 temp = *text32++;
-
-					// Generate a byte mask for those text pixels (bytes) with
-					// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
-					// in mask will be either equal to 0x00 or 0xFF.
-					// Doing it this way avoids branches and bytewise operations,
-					// at the cost of readability ;).
-					uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
-					mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
-					mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
-
-					// The following line is equivalent to this code:
-					//   *dst32++ = (*src32++ & mask) | (temp & ~mask);
-					// However, some compilers can generate somewhat better
-					// machine code for this equivalent statement:
-					*dst32++ = ((temp ^ *src32++) & mask) ^ temp;
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+			DrawStripKernel kernel = getDrawStripKernel();
+			if (kernel) {
+				kernel(height * m, width * m, (const byte *)text, (const byte *)src, _compositeBuf,
+					vsPitch, _textSurface.pitch - width * m);
+			} else
+#endif
+			{
+				// We blit four pixels at a time, for improved performance.
+				const uint32 *src32 = (const uint32 *)src;
+				uint32 *dst32 = (uint32 *)_compositeBuf;
+
+				vsPitch >>= 2;
+
+				const uint32 *text32 = (const uint32 *)text;
+				const int textPitch = (_textSurface.pitch - width * m) >> 2;
+				for (int h = height * m; h > 0; --h) {
+					for (int w = width * m; w > 0; w -= 4) {
+						uint32 temp = *text32++;
+
+						// Generate a byte mask for those text pixels (bytes) with
+						// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
+						// in mask will be either equal to 0x00 or 0xFF.
+						// Doing it this way avoids branches and bytewise operations,
+						// at the cost of readability ;).
+						uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
+						mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
+						mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
+
+						// The following line is equivalent to this code:
+						//   *dst32++ = (*src32++ & mask) | (temp & ~mask);
+						// However, some compilers can generate somewhat better
+						// machine code for this equivalent statement:
+						*dst32++ = ((temp ^ *src32++) & mask) ^ temp;
+					}
+					src32 += vsPitch;
+					text32 += textPitch;
 				}
-				src32 += vsPitch;
-				text32 += textPitch;
 			}
 #endif
 		}
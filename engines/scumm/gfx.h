@@ -289,6 +289,15 @@ struct StripTable;
 #define CHARSET_MASK_TRANSPARENCY	 0xFD
 #define CHARSET_MASK_TRANSPARENCY_32 0xFDFDFDFD
 
+#ifdef SCUMMVM_SSE2
+void drawStripToScreenSSE2(int height, int width, const byte *text, const byte *src, byte *dst,
+	int vsPitchGap, int textPitchGap);
+#endif
+#ifdef SCUMMVM_NEON
+void drawStripToScreenNEON(int height, int width, const byte *text, const byte *src, byte *dst,
+	int vsPitchGap, int textPitchGap);
+#endif
+
 class Gdi {
 protected:
 	ScummEngine *_vm;
@@ -0,0 +1,97 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "scumm/gfx.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Scumm {
+
+/**
+ * Vector version of the text compositing loop in
+ * ScummEngine::drawStripToScreen(): wherever the text surface holds
+ * CHARSET_MASK_TRANSPARENCY the game pixel is copied, everywhere else the
+ * text pixel wins. Processes 16 pixels per step instead of 4; widths are
+ * multiples of 4, so the tail loop reuses the 4-pixel integer trick.
+ */
+void drawStripToScreenNEON(int height, int width, const byte *text, const byte *src, byte *dst,
+		int vsPitchGap, int textPitchGap) {
+	const uint8x16_t transMask = vdupq_n_u8(CHARSET_MASK_TRANSPARENCY);
+
+	for (int h = height; h > 0; --h) {
+		int w = width;
+		for (; w >= 16; w -= 16) {
+			const uint8x16_t textVec = vld1q_u8(text);
+			const uint8x16_t srcVec = vld1q_u8(src);
+
+			// 0xFF for text bytes equal to the transparency value,
+			// then bitwise select: game pixel where set, text pixel
+			// where clear.
+			const uint8x16_t mask = vceqq_u8(textVec, transMask);
+			vst1q_u8(dst, vbslq_u8(mask, srcVec, textVec));
+
+			text += 16;
+			src += 16;
+			dst += 16;
+		}
+		for (; w > 0; w -= 4) {
+			uint32 temp = READ_UINT32(text);
+			uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
+			mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
+			mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
+			WRITE_UINT32(dst, ((temp ^ READ_UINT32(src)) & mask) ^ temp);
+			text += 4;
+			src += 4;
+			dst += 4;
+		}
+		src += vsPitchGap;
+		text += textPitchGap;
+	}
+}
+
+} // End of namespace Scumm
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
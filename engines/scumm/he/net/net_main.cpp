@@ -825,8 +825,11 @@ int Net::remoteSendData(int typeOfSend, int sendTypeParam, int type, Common::Str
 		reliable == true ? "true" : "false", data.c_str());
 
 	debugC(DEBUG_NETWORK, "NETWORK: Sending data: %s", res.c_str());
-	Common::JSONValue *str = Common::JSON::parse(res.c_str());
 	if (_isHost) {
+		// Only the host queue needs the parsed JSON value; peers send the
+		// string we just built as-is. Parsing unconditionally also leaked
+		// the value on the peer path.
+		Common::JSONValue *str = Common::JSON::parse(res.c_str());
 		_hostDataQueue.push(str);
 		_peerIndexQueue.push(sendTypeParam - 1);
 	} else {
@@ -1380,9 +1383,14 @@ void Net::doNetworkOnceAFrame(int msecs) {
 	if (_isHost && _hostDataQueue.size()) {
 		if (_hostDataQueue.size() != _peerIndexQueue.size())
 			warning("NETWORK: Sizes of data and peer index queues does not match!  Expect some wonky stuff");
-		Common::JSONValue *json = _hostDataQueue.pop();
-		int peerIndex = _peerIndexQueue.pop();
-		handleGameDataHost(json, peerIndex);
+		// Drain the whole queue: scripts can push several messages per
+		// frame, and relaying only one per frame made bursts fall further
+		// and further behind.
+		while (_hostDataQueue.size()) {
+			Common::JSONValue *json = _hostDataQueue.pop();
+			int peerIndex = _peerIndexQueue.pop();
+			handleGameDataHost(json, peerIndex);
+		}
 	}
 }
 
@@ -152,9 +152,24 @@ BundleMgr::BundleMgr(const ScummEngine *vm, BundleDirCache *cache) {
 
 BundleMgr::~BundleMgr() {
 	close();
+	free(_readBuff);
 	delete _file;
 }
 
+bool BundleMgr::hasOpenFile(const char *filename) const {
+	return _file->isOpen() && scumm_stricmp(filename, _fileName) == 0;
+}
+
+byte *BundleMgr::ensureReadBuffer(int32 size) {
+	if (size > _readBuffSize) {
+		free(_readBuff);
+		_readBuff = (byte *)malloc(size);
+		assert(_readBuff);
+		_readBuffSize = size;
+	}
+	return _readBuff;
+}
+
 Common::SeekableReadStream *BundleMgr::getFile(const char *filename, int32 &offset, int32 &size) {
 	BundleDirCache::IndexNode target;
 	Common::strlcpy(target.filename, filename, sizeof(target.filename));
@@ -171,18 +186,31 @@ Common::SeekableReadStream *BundleMgr::getFile(const char *filename, int32 &offs
 }
 
 bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
-	if (_file->isOpen())
-		return true;
+	// A manager reused from the sound manager's pool may still have the
+	// right bundle file open; in that case only the per-sample state
+	// below needs resetting. A stale file from another bundle is closed.
+	if (_file->isOpen() && scumm_stricmp(filename, _fileName) != 0)
+		close();
 
-	if (g_scumm->openFile(*_file, filename) == false) {
-		if (errorFlag) {
-			error("BundleMgr::open() Can't open bundle file: %s", filename);
-		} else {
-			warning("BundleMgr::open() Can't open bundle file: %s", filename);
+	if (!_file->isOpen()) {
+		if (g_scumm->openFile(*_file, filename) == false) {
+			if (errorFlag) {
+				error("BundleMgr::open() Can't open bundle file: %s", filename);
+			} else {
+				warning("BundleMgr::open() Can't open bundle file: %s", filename);
+			}
+			return false;
 		}
-		return false;
+		Common::strlcpy(_fileName, filename, sizeof(_fileName));
 	}
 
+	free(_compTable);
+	_compTable = nullptr;
+	free(_compInputBuff);
+	_compInputBuff = nullptr;
+	_numCompItems = 0;
+	_curSampleId = -1;
+
 	int slot = _cache->matchFile(filename);
 	assert(slot != -1);
 	isCompressed = _cache->isSndDataExtComp(slot);
@@ -204,6 +232,7 @@ bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
 void BundleMgr::close() {
 	if (_file->isOpen()) {
 		_file->close();
+		_fileName[0] = '\0';
 		_bundleTable = nullptr;
 		_numFiles = 0;
 		_numCompItems = 0;
@@ -327,8 +356,7 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 
 		if (_isUncompressed) {
 			_file->seek(_bundleTable[found->index].offset + _curDecompressedFilePos + headerSize, SEEK_SET);
-			*comp_final = (byte *)malloc(size);
-			assert(*comp_final);
+			*comp_final = ensureReadBuffer(size);
 			_file->read(*comp_final, size);
 			_curDecompressedFilePos += size;
 			return size;
@@ -342,8 +370,9 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 			lastBlock = _numCompItems - 1;
 
 		int32 blocksFinalSize = DIMUSE_BUN_CHUNK_SIZE * (1 + lastBlock - firstBlock);
-		*comp_final = (byte *)malloc(blocksFinalSize);
-		assert(*comp_final);
+		// The streamer pulls fixed-size slices at a steady rate, so after
+		// the first call this is just a buffer reuse, not an allocation.
+		*comp_final = ensureReadBuffer(blocksFinalSize);
 		finalSize = 0;
 
 		skip = (_curDecompressedFilePos + headerSize) % DIMUSE_BUN_CHUNK_SIZE; // Excess length after the last block
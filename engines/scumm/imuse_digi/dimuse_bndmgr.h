@@ -90,9 +90,13 @@ private:
 	int _fileBundleId = 0;
 	byte _compOutputBuff[0x2000] = {};
 	byte *_compInputBuff = nullptr;
+	byte *_readBuff = nullptr;
+	int32 _readBuffSize = 0;
+	char _fileName[24] = "";
 	int _outputSize = 0;
 	int _lastBlock = 0;
 	bool loadCompTable(int32 index);
+	byte *ensureReadBuffer(int32 size);
 
 public:
 
@@ -103,8 +107,18 @@ public:
 	void close();
 	Common::SeekableReadStream *getFile(const char *filename, int32 &offset, int32 &size);
 	int32 seekFile(int32 offset, int size);
+
+	/**
+	 * Decompresses the requested slice of the named sound into an
+	 * internal buffer and points compFinal at it. The buffer is owned
+	 * by the manager and stays valid until the next readFile() call,
+	 * so the caller must not free it.
+	 */
 	int32 readFile(const char *name, int32 size, byte **compFinal, bool headerOutside);
 	bool isExtCompBun(byte gameId);
+
+	/** True if this manager currently has the given bundle file open. */
+	bool hasOpenFile(const char *filename) const;
 };
 
 } // End of namespace Scumm
@@ -240,7 +240,7 @@ int IMuseDigiFilesHandler::read(int soundId, uint8 *buf, int32 size, int bufId)
 							debug(5, "IMuseDigiFilesHandler::read(): WARNING: tried to read %d bytes, got %d instead (soundId %d (%s))", size, resultingSize, soundId, fileName);
 
 						memcpy(buf, tmpBuf, resultingSize);
-						free(tmpBuf);
+						// tmpBuf is the bundle manager's reusable read buffer
 						return resultingSize;
 					}
 				}
@@ -40,6 +40,8 @@ ImuseDigiSndMgr::ImuseDigiSndMgr(ScummEngine *scumm) {
 	for (int l = 0; l < MAX_IMUSE_SOUNDS; l++) {
 		memset(&_sounds[l], 0, sizeof(SoundDesc));
 	}
+	memset(_bundlePool, 0, sizeof(_bundlePool));
+	_bundlePoolSize = 0;
 	_vm = scumm;
 	_disk = 0;
 	_cacheBundleDir = new BundleDirCache(scumm);
@@ -52,10 +54,42 @@ ImuseDigiSndMgr::~ImuseDigiSndMgr() {
 		closeSound(&_sounds[l]);
 	}
 
+	for (int l = 0; l < _bundlePoolSize; l++) {
+		delete _bundlePool[l];
+	}
+
 	delete _cacheBundleDir;
 	BundleCodecs::releaseImcTables();
 }
 
+BundleMgr *ImuseDigiSndMgr::obtainBundle(const char *filename) {
+	// Prefer a pooled manager which still has this bundle file open;
+	// opening it again then skips the file system entirely.
+	for (int l = 0; l < _bundlePoolSize; l++) {
+		if (_bundlePool[l]->hasOpenFile(filename)) {
+			BundleMgr *bundle = _bundlePool[l];
+			_bundlePool[l] = _bundlePool[--_bundlePoolSize];
+			return bundle;
+		}
+	}
+
+	if (_bundlePoolSize > 0)
+		return _bundlePool[--_bundlePoolSize];
+
+	return new BundleMgr(_vm, _cacheBundleDir);
+}
+
+void ImuseDigiSndMgr::releaseBundle(BundleMgr *bundle) {
+	if (!bundle)
+		return;
+
+	if (_bundlePoolSize < MAX_IMUSE_SOUNDS) {
+		_bundlePool[_bundlePoolSize++] = bundle;
+	} else {
+		delete bundle;
+	}
+}
+
 ImuseDigiSndMgr::SoundDesc *ImuseDigiSndMgr::allocSlot() {
 	for (int l = 0; l < MAX_IMUSE_SOUNDS; l++) {
 		if (!_sounds[l].inUse) {
@@ -71,14 +105,12 @@ ImuseDigiSndMgr::SoundDesc *ImuseDigiSndMgr::allocSlot() {
 bool ImuseDigiSndMgr::openMusicBundle(SoundDesc *sound, int &disk) {
 	bool result = false;
 	bool compressed = false;
+	char musicfile[20];
 
-	sound->bundle = new BundleMgr(_vm, _cacheBundleDir);
-	assert(sound->bundle);
 	if (_vm->_game.id == GID_CMI) {
 		if (_vm->_game.features & GF_DEMO) {
-			result = sound->bundle->open("music.bun", compressed);
+			Common::strlcpy(musicfile, "music.bun", sizeof(musicfile));
 		} else {
-			char musicfile[20];
 			if (disk == -1)
 				disk = _vm->VAR(_vm->VAR_CURRENTDISK);
 			Common::sprintf_s(musicfile, "musdisk%d.bun", disk);
@@ -89,16 +121,18 @@ bool ImuseDigiSndMgr::openMusicBundle(SoundDesc *sound, int &disk) {
 //				sound->bundle->closeFile();
 //			}
 
-			result = sound->bundle->open(musicfile, compressed);
-
 			// FIXME: Shouldn't we only set _disk if result == true?
 			_disk = (byte)_vm->VAR(_vm->VAR_CURRENTDISK);
 		}
 	} else if (_vm->_game.id == GID_DIG)
-		result = sound->bundle->open("digmusic.bun", compressed);
+		Common::strlcpy(musicfile, "digmusic.bun", sizeof(musicfile));
 	else
 		error("ImuseDigiSndMgr::openMusicBundle() Don't know which bundle file to load");
 
+	sound->bundle = obtainBundle(musicfile);
+	assert(sound->bundle);
+	result = sound->bundle->open(musicfile, compressed);
+
 	_vm->VAR(_vm->VAR_MUSIC_BUNDLE_LOADED) = result ? 1 : 0;
 
 	return result;
@@ -107,14 +141,12 @@ bool ImuseDigiSndMgr::openMusicBundle(SoundDesc *sound, int &disk) {
 bool ImuseDigiSndMgr::openVoiceBundle(SoundDesc *sound, int &disk) {
 	bool result = false;
 	bool compressed = false;
+	char voxfile[20];
 
-	sound->bundle = new BundleMgr(_vm, _cacheBundleDir);
-	assert(sound->bundle);
 	if (_vm->_game.id == GID_CMI) {
 		if (_vm->_game.features & GF_DEMO) {
-			result = sound->bundle->open("voice.bun", compressed);
+			Common::strlcpy(voxfile, "voice.bun", sizeof(voxfile));
 		} else {
-			char voxfile[20];
 			if (disk == -1)
 				disk = _vm->VAR(_vm->VAR_CURRENTDISK);
 			Common::sprintf_s(voxfile, "voxdisk%d.bun", disk);
@@ -125,16 +157,18 @@ bool ImuseDigiSndMgr::openVoiceBundle(SoundDesc *sound, int &disk) {
 //				sound->bundle->closeFile();
 //			}
 
-			result = sound->bundle->open(voxfile, compressed);
-
 			// FIXME: Shouldn't we only set _disk if result == true?
 			_disk = (byte)_vm->VAR(_vm->VAR_CURRENTDISK);
 		}
 	} else if (_vm->_game.id == GID_DIG)
-		result = sound->bundle->open("digvoice.bun", compressed);
+		Common::strlcpy(voxfile, "digvoice.bun", sizeof(voxfile));
 	else
 		error("ImuseDigiSndMgr::openVoiceBundle() Don't know which bundle file to load");
 
+	sound->bundle = obtainBundle(voxfile);
+	assert(sound->bundle);
+	result = sound->bundle->open(voxfile, compressed);
+
 	_vm->VAR(_vm->VAR_VOICE_BUNDLE_LOADED) = result ? 1 : 0;
 
 	return result;
@@ -181,7 +215,6 @@ ImuseDigiSndMgr::SoundDesc *ImuseDigiSndMgr::openSound(int32 soundId, const char
 		if (soundName[0] != 0) {
 			if (sound->bundle->readFile(soundName, 0x2000, &ptr, header_outside) == 0 || ptr == nullptr) {
 				closeSound(sound);
-				free(ptr);
 				return nullptr;
 			}
 		}
@@ -195,9 +228,6 @@ ImuseDigiSndMgr::SoundDesc *ImuseDigiSndMgr::openSound(int32 soundId, const char
 	Common::strlcpy(sound->name, soundName, sizeof(sound->name));
 	sound->soundId = soundId;
 
-	if (soundType == IMUSE_BUNDLE) {
-		free(ptr);
-	}
 	return sound;
 }
 
@@ -216,7 +246,7 @@ void ImuseDigiSndMgr::closeSound(SoundDesc *soundDesc) {
 			_vm->_res->unlock(rtSound, soundDesc->soundId);
 	}
 
-	delete soundDesc->bundle;
+	releaseBundle(soundDesc->bundle);
 
 	memset(soundDesc, 0, sizeof(SoundDesc));
 }
@@ -266,7 +296,7 @@ void ImuseDigiSndMgr::closeSoundById(int soundId) {
 			_vm->_res->unlock(rtSound, soundDesc->soundId);
 		}
 
-		delete soundDesc->bundle;
+		releaseBundle(soundDesc->bundle);
 
 		memset(soundDesc, 0, sizeof(SoundDesc));
 	}
@@ -75,6 +75,18 @@ private:
 	byte _disk;
 	BundleDirCache *_cacheBundleDir;
 
+	/**
+	 * Closed sounds return their BundleMgr here instead of deleting it,
+	 * with its bundle file still open. Music transitions in DIG and COMI
+	 * close one bundle sound and open another, so reusing the managers
+	 * keeps track switches free of allocations and file reopens.
+	 */
+	BundleMgr *_bundlePool[MAX_IMUSE_SOUNDS];
+	int _bundlePoolSize;
+
+	BundleMgr *obtainBundle(const char *filename);
+	void releaseBundle(BundleMgr *bundle);
+
 	bool openMusicBundle(SoundDesc *sound, int &disk);
 	bool openVoiceBundle(SoundDesc *sound, int &disk);
 
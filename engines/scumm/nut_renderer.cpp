@@ -30,9 +30,7 @@ namespace Scumm {
 NutRenderer::NutRenderer(ScummEngine *vm, const char *filename) :
 	_vm(vm),
 	_numChars(0),
-	_maxCharSize(0),
 	_fontHeight(0),
-	_charBuffer(0),
 	_decodedData(0),
 	_2byteColorTable(0),
 	_2byteShadowXOffsetTable(0),
@@ -53,7 +51,8 @@ NutRenderer::NutRenderer(ScummEngine *vm, const char *filename) :
 }
 
 NutRenderer::~NutRenderer() {
-	delete[] _charBuffer;
+	for (int i = 0; i < ARRAYSIZE(_chars); i++)
+		delete[] _chars[i].unpacked;
 	delete[] _decodedData;
 	delete[] _2byteColorTable;
 }
@@ -140,10 +139,7 @@ void NutRenderer::loadFont(const char *filename) {
 		offset += READ_BE_UINT32(dataSrc + offset + 4) + 16;
 		int width = READ_LE_UINT16(dataSrc + offset + 14);
 		_fontHeight = READ_LE_UINT16(dataSrc + offset + 16);
-		int size = width * _fontHeight;
-		decodedLength += size;
-		if (size > _maxCharSize)
-			_maxCharSize = size;
+		decodedLength += width * _fontHeight;
 	}
 
 	debug(1, "NutRenderer::loadFont('%s') - decodedLength = %d", filename, decodedLength);
@@ -267,8 +263,6 @@ void NutRenderer::loadFont(const char *filename) {
 
 		delete[] _decodedData;
 		_decodedData = compressedData;
-
-		_charBuffer = new byte[_maxCharSize];
 	}
 
 	delete[] dataSrc;
@@ -299,6 +293,14 @@ byte *NutRenderer::unpackChar(byte c) {
 	if (_bpp == 8)
 		return _chars[c].src;
 
+	// Unpack each glyph the first time it is drawn and keep the result, so
+	// that redrawing the same text does not pay for the per-pixel unpacking
+	// over and over. In the worst case this converges on the plain 8 bpp
+	// decoded font, which is still smaller than the font file itself.
+	if (_chars[c].unpacked)
+		return _chars[c].unpacked;
+
+	byte *buffer = new byte[_chars[c].width * _chars[c].height];
 	byte *src = _chars[c].src;
 	int pitch = (_bpp * _chars[c].width + 7) / 8;
 
@@ -330,12 +332,13 @@ byte *NutRenderer::unpackChar(byte c) {
 					val |= (1 << i);
 			}
 
-			_charBuffer[ty * _chars[c].width + tx] = _palette[val];
+			buffer[ty * _chars[c].width + tx] = _palette[val];
 		}
 		src += pitch;
 	}
 
-	return _charBuffer;
+	_chars[c].unpacked = buffer;
+	return buffer;
 }
 
 void NutRenderer::drawFrame(byte *dst, int c, int x, int y) {
@@ -40,10 +40,8 @@ protected:
 
 	ScummEngine *_vm;
 	int _numChars;
-	int _maxCharSize;
 	int _fontHeight;
 	int _spacing;
-	byte *_charBuffer;
 	byte *_decodedData;
 	byte *_paletteMap;
 	byte _bpp;
@@ -60,6 +58,9 @@ protected:
 		uint16 width;
 		uint16 height;
 		byte *src;
+		// 8 bpp copy of a bit-packed glyph, filled in lazily on its first
+		// draw so repeated draws skip the per-pixel unpacking.
+		byte *unpacked;
 		byte transparency;
 	} _chars[256];
 
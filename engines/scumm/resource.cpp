@@ -19,6 +19,10 @@
  *
  */
 
+// Disable symbol overrides so that we can use the POSIX thread API
+// (pthread.h drags in time.h)
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
 #include "common/md5.h"
 #include "common/str.h"
 #include "common/memstream.h"
@@ -41,6 +45,11 @@
 #include "scumm/util.h"
 #include "scumm/verbs.h"
 
+#if defined(POSIX)
+#define SCUMM_ROOM_PREFETCH
+#include <pthread.h>
+#endif
+
 namespace Scumm {
 
 enum {
@@ -156,6 +165,162 @@ void ScummEngine::closeRoom() {
 	}
 }
 
+#ifdef SCUMM_ROOM_PREFETCH
+
+/**
+ * Best-effort background warmer for the OS file cache.
+ *
+ * The worker thread merely reads the hinted room's byte range into a
+ * scratch buffer; the data itself is thrown away. The file is opened on
+ * the engine thread - SearchMan and its lookup cache are not thread-safe
+ * - and the worker takes sole ownership of the handle, so it never
+ * touches _fileHandle, which belongs to the main thread.
+ */
+struct ScummEngine::RoomPrefetcher {
+	enum {
+		kQueueSize = 4,
+		kMaxPrefetchBytes = 512 * 1024,
+		kChunkSize = 16 * 1024
+	};
+
+	struct Request {
+		Common::SeekableReadStream *stream;
+		uint32 offset;
+	};
+
+	pthread_mutex_t _mutex;
+	pthread_cond_t _workAvailable;
+	pthread_t _thread;
+	bool _valid;
+
+	// Shared state, protected by _mutex.
+	Request _queue[kQueueSize];
+	int _queueStart, _queueLen;
+	bool _quit;
+
+	RoomPrefetcher() : _queueStart(0), _queueLen(0), _quit(false) {
+		pthread_mutex_init(&_mutex, nullptr);
+		pthread_cond_init(&_workAvailable, nullptr);
+		_valid = (pthread_create(&_thread, nullptr, workerMain, this) == 0);
+	}
+
+	~RoomPrefetcher() {
+		if (_valid) {
+			pthread_mutex_lock(&_mutex);
+			_quit = true;
+			pthread_cond_signal(&_workAvailable);
+			pthread_mutex_unlock(&_mutex);
+			pthread_join(_thread, nullptr);
+		}
+		// Release requests the worker never got to.
+		while (_queueLen--) {
+			delete _queue[_queueStart].stream;
+			_queueStart = (_queueStart + 1) % kQueueSize;
+		}
+		pthread_cond_destroy(&_workAvailable);
+		pthread_mutex_destroy(&_mutex);
+	}
+
+	/** Takes ownership of @p stream. */
+	void queue(Common::SeekableReadStream *stream, uint32 offset) {
+		if (!_valid) {
+			delete stream;
+			return;
+		}
+		pthread_mutex_lock(&_mutex);
+		// Drop the oldest entry when full; prefetching is best effort.
+		if (_queueLen == kQueueSize) {
+			delete _queue[_queueStart].stream;
+			_queueStart = (_queueStart + 1) % kQueueSize;
+			_queueLen--;
+		}
+		Request &req = _queue[(_queueStart + _queueLen) % kQueueSize];
+		req.stream = stream;
+		req.offset = offset;
+		_queueLen++;
+		pthread_cond_signal(&_workAvailable);
+		pthread_mutex_unlock(&_mutex);
+	}
+
+	static void *workerMain(void *prefetcher) {
+		RoomPrefetcher *self = (RoomPrefetcher *)prefetcher;
+		byte *scratch = new byte[kChunkSize];
+
+		pthread_mutex_lock(&self->_mutex);
+		for (;;) {
+			while (!self->_quit && self->_queueLen == 0)
+				pthread_cond_wait(&self->_workAvailable, &self->_mutex);
+			if (self->_quit)
+				break;
+
+			Request req = self->_queue[self->_queueStart];
+			self->_queueStart = (self->_queueStart + 1) % kQueueSize;
+			self->_queueLen--;
+			pthread_mutex_unlock(&self->_mutex);
+
+			if (req.stream->seek(req.offset)) {
+				uint32 remaining = kMaxPrefetchBytes;
+				while (remaining && !req.stream->eos()) {
+					uint32 n = req.stream->read(scratch, MIN<uint32>(kChunkSize, remaining));
+					if (n == 0)
+						break;
+					remaining -= n;
+				}
+			}
+			delete req.stream;
+
+			pthread_mutex_lock(&self->_mutex);
+		}
+		pthread_mutex_unlock(&self->_mutex);
+
+		delete[] scratch;
+		return nullptr;
+	}
+};
+
+#endif
+
+/**
+ * Hints that the given room may be entered soon, so its data is worth
+ * reading ahead of time. The actual reading happens on a background
+ * thread and only warms the OS file cache; nothing of the engine state
+ * is touched, and a wrong guess merely wastes some idle disk time.
+ */
+void ScummEngine::prefetchRoomHint(int room) {
+#ifdef SCUMM_ROOM_PREFETCH
+	if (room <= 0 || room >= _numRooms || room == _currentRoom)
+		return;
+	if (_res->_types[rtRoom].size() <= (uint)room)
+		return;
+	if (_res->_types[rtRoom][room]._roomoffs == RES_INVALID_OFFSET)
+		return;
+	// The Macintosh container games read through a wrapper stream which
+	// the worker cannot reproduce with a plain file handle.
+	if (!_containerFile.empty())
+		return;
+
+	if (!_roomPrefetcher)
+		_roomPrefetcher = new RoomPrefetcher();
+
+	// Open here on the engine thread: File::open() resolves through
+	// SearchMan, which must stay confined to one thread. The worker only
+	// ever sees the private handle.
+	Common::File *file = new Common::File();
+	if (!file->open(generateFilename(room))) {
+		delete file;
+		return;
+	}
+	_roomPrefetcher->queue(file, _res->_types[rtRoom][room]._roomoffs);
+#endif
+}
+
+void ScummEngine::freeRoomPrefetcher() {
+#ifdef SCUMM_ROOM_PREFETCH
+	delete _roomPrefetcher;
+#endif
+	_roomPrefetcher = nullptr;
+}
+
 /** Delete the currently loaded room offsets. */
 void ScummEngine::deleteRoomOffsets() {
 	for (int i = 0; i < _numRooms; i++) {
@@ -918,6 +1083,8 @@ ResourceManager::ResourceManager(ScummEngine *vm) : _vm(vm) {
 	_maxHeapThreshold = 0;
 	_minHeapThreshold = 0;
 	_expireCounter = 0;
+	_expiredCount = 0;
+	_expiredBytes = 0;
 }
 
 ResourceManager::~ResourceManager() {
@@ -1092,7 +1259,9 @@ void ResourceManager::expireResources(uint32 size) {
 	byte best_counter;
 	ResType best_type;
 	int best_res = 0;
+	uint32 best_size = 0;
 	uint32 oldAllocatedSize;
+	int expired = 0;
 
 	if (_expireCounter != 0xFF) {
 		_expireCounter = 0xFF;
@@ -1107,19 +1276,36 @@ void ResourceManager::expireResources(uint32 size) {
 	do {
 		best_type = rtInvalid;
 		best_counter = 2;
+		best_size = 0;
 
 		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
 			if (_types[type]._mode != kDynamicResTypeMode) {
 				// Resources of this type can be reloaded from the data files,
 				// so we can potentially unload them to free memory.
+
+				// Costumes and sounds are reloaded right away by the entry
+				// scripts of most v7/8 rooms, so let them age one extra
+				// generation before they become eviction candidates.
+				byte weight = 0;
+				if (_vm->_game.version >= 7 && (type == rtCostume || type == rtSound))
+					weight = 1;
+
 				ResId idx = _types[type].size();
 				while (idx-- > 0) {
 					Resource &tmp = _types[type][idx];
 					byte counter = tmp.getResourceCounter();
+					if (counter > weight)
+						counter -= weight;
 					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
+						// Among equally old resources, expire the largest
+						// one: freeing the requested amount in fewer
+						// evictions keeps more of the heap intact.
+						if (counter > best_counter || best_type == rtInvalid || tmp._size > best_size) {
+							best_counter = counter;
+							best_type = type;
+							best_res = idx;
+							best_size = tmp._size;
+						}
 					}
 				}
 			}
@@ -1128,11 +1314,16 @@ void ResourceManager::expireResources(uint32 size) {
 		if (!best_type)
 			break;
 		nukeResource(best_type, best_res);
+		expired++;
 	} while (size + _allocatedSize > _minHeapThreshold);
 
 	increaseResourceCounters();
 
-	debugC(DEBUG_RESOURCE, "Expired resources, mem %d -> %d", oldAllocatedSize, _allocatedSize);
+	_expiredCount += expired;
+	_expiredBytes += oldAllocatedSize - _allocatedSize;
+
+	debugC(DEBUG_RESOURCE, "Expired %d resources, mem %d -> %d (%d resources / %d bytes since start)",
+		expired, oldAllocatedSize, _allocatedSize, _expiredCount, _expiredBytes);
 }
 
 void ResourceManager::freeResources() {
@@ -1212,6 +1403,7 @@ void ResourceManager::resourceStats() {
 	}
 
 	debug("Total allocated size=%d, locked=%d(%d)", _allocatedSize, lockedSize, lockedNum);
+	debug("Expired since start: %d resources, %d bytes", _expiredCount, _expiredBytes);
 }
 
 void ScummEngine_v5::readMAXS(int blockSize) {
@@ -180,6 +180,8 @@ protected:
 	uint32 _allocatedSize;
 	uint32 _maxHeapThreshold, _minHeapThreshold;
 	byte _expireCounter;
+	uint32 _expiredCount;
+	uint32 _expiredBytes;
 
 public:
 	ResourceManager(ScummEngine *vm);
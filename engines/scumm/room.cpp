@@ -261,6 +261,14 @@ void ScummEngine::startScene(int room, Actor *a, int objectNr) {
 
 	_doEffect = true;
 
+	// SCUMM has no explicit room adjacency data, but the rooms of one
+	// game area are normally numbered together, so the numeric
+	// neighbours of the room just entered are the likeliest next
+	// transitions. Warm the file cache for them while the player is
+	// still looking at this room.
+	prefetchRoomHint(room - 1);
+	prefetchRoomHint(room + 1);
+
 	// Hint the backend about the virtual keyboard during copy protection screens
 	if (_game.id == GID_MONKEY2) {
 		bool hasCopyProtectionScreen = true;
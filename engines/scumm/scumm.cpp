@@ -489,6 +489,8 @@ ScummEngine::~ScummEngine() {
 	delete _versionDialog;
 	delete _fileHandle;
 
+	freeRoomPrefetcher();
+
 	if (_game.heversion == 0)
 		delete _sound;
 
@@ -1078,6 +1078,8 @@ protected:
 	void openRoom(int room);
 	void closeRoom();
 	void deleteRoomOffsets();
+	void prefetchRoomHint(int room);
+	void freeRoomPrefetcher();
 	virtual void readRoomsOffsets();
 	void askForDisk(const Common::Path &filename, int disknum);
 	bool openResourceFile(const Common::Path &filename, byte encByte);
@@ -1123,6 +1125,12 @@ protected:
 	void nukeCharset(int i);
 
 	int _lastLoadedRoom = 0;
+
+	// Best-effort background warmer for the OS file cache, so that the
+	// next room transition reads hot data. Only built where pthreads are
+	// available; stays null everywhere else.
+	struct RoomPrefetcher;
+	RoomPrefetcher *_roomPrefetcher = nullptr;
 public:
 	const byte *findResourceData(uint32 tag, const byte *ptr);
 	const byte *findResource(uint32 tag, const byte *ptr);
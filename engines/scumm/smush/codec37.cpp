@@ -437,11 +437,19 @@ void SmushDeltaBlocksDecoder::proc4WithFDFE(byte *dst, const byte *src, int32 ne
 			} else if (code == 0xFF) {
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
+				// A run of blocks copied straight from the previous frame.
+				// Merge the blocks sharing a block row into four wide row
+				// copies instead of copying them 4x4 block by block.
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + nextOffs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
+				while (length > 0) {
+					int32 run = MIN<int32>(length, i);
+					const byte *dst2 = dst + nextOffs;
+					for (int x = 0; x < 4; x++) {
+						memcpy(dst + pitch * x, dst2 + pitch * x, run * 4);
+					}
+					dst += run * 4;
+					length -= run;
+					i -= run;
 					if (i == 0) {
 						dst += pitch * 3;
 						bh--;
@@ -469,11 +477,19 @@ void SmushDeltaBlocksDecoder::proc4WithoutFDFE(byte *dst, const byte *src, int32
 			if (code == 0xFF) {
 				LITERAL_1X1(src, dst, pitch);
 			} else if (code == 0x00) {
+				// A run of blocks copied straight from the previous frame.
+				// Merge the blocks sharing a block row into four wide row
+				// copies instead of copying them 4x4 block by block.
 				int32 length = *src++ + 1;
-				for (int32 l = 0; l < length; l++) {
-					byte *dst2 = dst + nextOffs;
-					COPY_4X4(dst2, dst, pitch);
-					i--;
+				while (length > 0) {
+					int32 run = MIN<int32>(length, i);
+					const byte *dst2 = dst + nextOffs;
+					for (int x = 0; x < 4; x++) {
+						memcpy(dst + pitch * x, dst2 + pitch * x, run * 4);
+					}
+					dst += run * 4;
+					length -= run;
+					i -= run;
 					if (i == 0) {
 						dst += pitch * 3;
 						bh--;
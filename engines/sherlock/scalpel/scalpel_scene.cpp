@@ -232,25 +232,24 @@ void ScalpelScene::doBgAnim() {
 		if (_currentScene == DRAWING_ROOM)
 			vm.eraseBrumwellMirror();
 
-		// Restore the back buffer from the back buffer 2 in the changed area
+		// Restore the back buffer from the back buffer 2 in the changed area.
+		// The areas are queued and merged first, so overlapping sprites don't
+		// copy the same background pixels several times over
 		Common::Rect bounds(people[HOLMES]._oldPosition.x, people[HOLMES]._oldPosition.y,
 			people[HOLMES]._oldPosition.x + people[HOLMES]._oldSize.x,
 			people[HOLMES]._oldPosition.y + people[HOLMES]._oldSize.y);
-		Common::Point pt(bounds.left, bounds.top);
 
-		if (people[HOLMES]._type == CHARACTER)
-			screen.restoreBackground(bounds);
-		else if (people[HOLMES]._type == REMOVE)
-			screen.getBackBuffer()->SHblitFrom(screen._backBuffer2, pt, bounds);
+		if (people[HOLMES]._type == CHARACTER || people[HOLMES]._type == REMOVE)
+			screen.queueBackgroundRestore(bounds);
 
 		for (uint idx = 0; idx < _bgShapes.size(); ++idx) {
 			Object &o = _bgShapes[idx];
 			if (o._type == ACTIVE_BG_SHAPE || o._type == HIDE_SHAPE || o._type == REMOVE)
-				screen.restoreBackground(o.getOldBounds());
+				screen.queueBackgroundRestore(o.getOldBounds());
 		}
 
 		if (people._portraitLoaded)
-			screen.restoreBackground(Common::Rect(
+			screen.queueBackgroundRestore(Common::Rect(
 				people._portrait._oldPosition.x, people._portrait._oldPosition.y,
 				people._portrait._oldPosition.x + people._portrait._oldSize.x,
 				people._portrait._oldPosition.y + people._portrait._oldSize.y
@@ -260,8 +259,7 @@ void ScalpelScene::doBgAnim() {
 			Object &o = _bgShapes[idx];
 			if (o._type == NO_SHAPE && ((o._flags & OBJ_BEHIND) == 0)) {
 				// Restore screen area
-				screen.getBackBuffer()->SHblitFrom(screen._backBuffer2, o._position,
-					Common::Rect(o._position.x, o._position.y,
+				screen.queueBackgroundRestore(Common::Rect(o._position.x, o._position.y,
 					o._position.x + o._noShapeSize.x, o._position.y + o._noShapeSize.y));
 
 				o._oldPosition = o._position;
@@ -272,9 +270,11 @@ void ScalpelScene::doBgAnim() {
 		for (uint idx = 0; idx < _canimShapes.size(); ++idx) {
 			Object &o = *_canimShapes[idx];
 			if (o._type == ACTIVE_BG_SHAPE || o._type == HIDE_SHAPE || o._type == REMOVE)
-				screen.restoreBackground(Common::Rect(o._oldPosition.x, o._oldPosition.y,
+				screen.queueBackgroundRestore(Common::Rect(o._oldPosition.x, o._oldPosition.y,
 					o._oldPosition.x + o._oldSize.x, o._oldPosition.y + o._oldSize.y));
 		}
+
+		screen.flushBackgroundRestore();
 	}
 
 	//
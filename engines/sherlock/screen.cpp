@@ -170,6 +170,48 @@ void Screen::restoreBackground(const Common::Rect &r) {
 		_backBuffer.SHblitFrom(_backBuffer2, Common::Point(r.left, r.top), r);
 }
 
+void Screen::queueBackgroundRestore(const Common::Rect &r) {
+	if (r.width() <= 0 || r.height() <= 0)
+		return;
+
+	// If the area overlaps one that is already queued, grow that one instead,
+	// so the shared pixels are only copied once
+	for (Common::List<Common::Rect>::iterator i = _pendingBgRestores.begin(); i != _pendingBgRestores.end(); ++i) {
+		if ((*i).intersects(r)) {
+			(*i).extend(r);
+			return;
+		}
+	}
+
+	_pendingBgRestores.push_back(r);
+}
+
+void Screen::flushBackgroundRestore() {
+	// Growing a queued area may have made it overlap another one, so keep
+	// merging until the list is stable
+	bool merged = true;
+	while (merged) {
+		merged = false;
+
+		for (Common::List<Common::Rect>::iterator rOuter = _pendingBgRestores.begin();
+				rOuter != _pendingBgRestores.end() && !merged; ++rOuter) {
+			Common::List<Common::Rect>::iterator rInner = rOuter;
+			while (++rInner != _pendingBgRestores.end()) {
+				if ((*rOuter).intersects(*rInner)) {
+					(*rOuter).extend(*rInner);
+					_pendingBgRestores.erase(rInner);
+					merged = true;
+					break;
+				}
+			}
+		}
+	}
+
+	for (Common::List<Common::Rect>::iterator i = _pendingBgRestores.begin(); i != _pendingBgRestores.end(); ++i)
+		restoreBackground(*i);
+	_pendingBgRestores.clear();
+}
+
 void Screen::slamArea(int16 xp, int16 yp, int16 width_, int16 height_) {
 	slamRect(Common::Rect(xp, yp, xp + width_, yp + height_));
 }
@@ -40,6 +40,7 @@ class SherlockEngine;
 class Screen : public BaseSurface {
 private:
 	uint32 _transitionSeed;
+	Common::List<Common::Rect> _pendingBgRestores;
 
 	// Rose Tattoo fields
 	int _fadeBytesRead, _fadeBytesToRead;
@@ -117,6 +118,19 @@ public:
 	 */
 	void restoreBackground(const Common::Rect &r);
 
+	/**
+	 * Queues a section of the second back buffer for restoring into the main
+	 * back buffer. Queued areas that overlap are merged, so that the per-frame
+	 * restore loops don't copy the pixels shared by overlapping sprites more
+	 * than once. flushBackgroundRestore() performs the queued copies
+	 */
+	void queueBackgroundRestore(const Common::Rect &r);
+
+	/**
+	 * Restores all the areas queued by queueBackgroundRestore() in one pass
+	 */
+	void flushBackgroundRestore();
+
 	/**
 	 * Copies a given area to the screen
 	 */
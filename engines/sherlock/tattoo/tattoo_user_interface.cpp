@@ -769,9 +769,11 @@ void TattooUserInterface::doBgAnimEraseBackground() {
 		// Standard scene without mask, so call user interface to erase any UI elements as necessary
 		doBgAnimRestoreUI();
 
-		// Restore background for any areas covered by characters and shapes
+		// Restore background for any areas covered by characters and shapes.
+		// The areas are queued and merged first, so that overlapping sprites
+		// in crowded scenes don't copy the same pixels several times over
 		for (int idx = 0; idx < MAX_CHARACTERS; ++idx)
-			screen.restoreBackground(Common::Rect(people[idx]._oldPosition.x, people[idx]._oldPosition.y,
+			screen.queueBackgroundRestore(Common::Rect(people[idx]._oldPosition.x, people[idx]._oldPosition.y,
 				people[idx]._oldPosition.x + people[idx]._oldSize.x, people[idx]._oldPosition.y + people[idx]._oldSize.y));
 
 		for (uint idx = 0; idx < scene._bgShapes.size(); ++idx) {
@@ -779,11 +781,12 @@ void TattooUserInterface::doBgAnimEraseBackground() {
 
 			if ((obj._type == ACTIVE_BG_SHAPE && (obj._maxFrames > 1 || obj._delta.x != 0 || obj._delta.y != 0)) ||
 					obj._type == HIDE_SHAPE || obj._type == REMOVE)
-				screen._backBuffer1.SHblitFrom(screen._backBuffer2, obj._oldPosition,
-					Common::Rect(obj._oldPosition.x, obj._oldPosition.y, obj._oldPosition.x + obj._oldSize.x,
-						obj._oldPosition.y + obj._oldSize.y));
+				screen.queueBackgroundRestore(Common::Rect(obj._oldPosition.x, obj._oldPosition.y,
+					obj._oldPosition.x + obj._oldSize.x, obj._oldPosition.y + obj._oldSize.y));
 		}
 
+		screen.flushBackgroundRestore();
+
 		// If credits are active, erase the area they cover
 		if (_creditsWidget.active())
 			_creditsWidget.eraseCredits();
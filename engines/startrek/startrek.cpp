@@ -30,6 +30,7 @@
 #include "common/file.h"
 #include "common/macresman.h"
 
+#include "graphics/blit.h"
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 
@@ -374,16 +375,23 @@ void StarTrekEngine::playMovieMac(Common::String filename) {
 
 	qtDecoder->start();
 
+	// One conversion buffer, reused for every frame
+	const ::Graphics::PixelFormat screenFormat = _system->getScreenFormat();
+	::Graphics::Surface convertedFrame;
+
 	while (!qtDecoder->endOfVideo() && !shouldQuit() && continuePlaying) {
 		if (qtDecoder->needsUpdate()) {
 			const ::Graphics::Surface *frame = qtDecoder->decodeNextFrame();
 
 			if (frame) {
-				::Graphics::Surface *convertedFrame = frame->convertTo(_system->getScreenFormat());
-				_system->copyRectToScreen(convertedFrame->getPixels(), convertedFrame->pitch, 0, 0, convertedFrame->w, convertedFrame->h);
+				if (convertedFrame.w != frame->w || convertedFrame.h != frame->h) {
+					convertedFrame.free();
+					convertedFrame.create(frame->w, frame->h, screenFormat);
+				}
+				::Graphics::crossBlit((byte *)convertedFrame.getPixels(), (const byte *)frame->getPixels(),
+						convertedFrame.pitch, frame->pitch, frame->w, frame->h, screenFormat, frame->format);
+				_system->copyRectToScreen(convertedFrame.getPixels(), convertedFrame.pitch, 0, 0, convertedFrame.w, convertedFrame.h);
 				_system->updateScreen();
-				convertedFrame->free();
-				delete convertedFrame;
 			}
 		}
 
@@ -395,6 +403,7 @@ void StarTrekEngine::playMovieMac(Common::String filename) {
 		_system->delayMillis(10);
 	}
 
+	convertedFrame.free();
 	delete qtDecoder;
 
 	// Swap back to 8bpp mode
@@ -66,6 +66,13 @@ public:
 		return _pImage->getHeight();
 	}
 
+	/**
+	    @brief Gibt den Speicherverbrauch des dekodierten Bildes zurück.
+	*/
+	uint getMemoryUsage() const override {
+		return _pImage ? _pImage->getWidth() * _pImage->getHeight() * 4 : 0;
+	}
+
 	/**
 	    @brief Rendert das Bild in den Framebuffer.
 	    @param PosX die Position auf der X-Achse im Zielbild in Pixeln, an der das Bild gerendert werden soll.<br>
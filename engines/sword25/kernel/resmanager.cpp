@@ -45,6 +45,11 @@ namespace Sword25 {
 // are loaded, the resource manager will start purging resources till it
 // hits the minimum limit above
 #define SWORD25_RESOURCECACHE_MAX 500
+// Byte budget for decoded resource data. The count limits above know
+// nothing about resource size, and hundreds of full-screen bitmaps are far
+// more than a scene ever needs, so purging also starts once the decoded
+// data exceeds this many bytes.
+#define SWORD25_RESOURCECACHE_BUDGET (64 * 1024 * 1024)
 
 ResourceManager::~ResourceManager() {
 	// Clear all unlocked resources
@@ -86,7 +91,7 @@ bool ResourceManager::registerResourceService(ResourceService *pService) {
  */
 void ResourceManager::deleteResourcesIfNecessary() {
 	// If enough memory is available, or no resources are loaded, then the function can immediately end
-	if (_resources.size() < SWORD25_RESOURCECACHE_MAX)
+	if (_resources.size() < SWORD25_RESOURCECACHE_MAX && _usedMemory <= SWORD25_RESOURCECACHE_BUDGET)
 		return;
 
 	// Keep deleting resources until the memory usage of the process falls below the set maximum limit.
@@ -99,7 +104,8 @@ void ResourceManager::deleteResourcesIfNecessary() {
 		// The resource may be released only if it isn't locked
 		if ((*iter)->getLockCount() == 0)
 			iter = deleteResource(*iter);
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() &&
+	         (_resources.size() >= SWORD25_RESOURCECACHE_MIN || _usedMemory > SWORD25_RESOURCECACHE_BUDGET));
 
 	// Are we still above the minimum? If yes, then start releasing locked resources
 	// FIXME: This code shouldn't be needed at all, but it seems like there is a bug
@@ -259,6 +265,9 @@ Resource *ResourceManager::loadResource(const Common::String &fileName) {
 			// Also store the resource in the hash table for quick lookup
 			_resourceHashMap[pResource->getFileName()] = pResource;
 
+			// Update the used memory total
+			_usedMemory += pResource->getMemoryUsage();
+
 			return pResource;
 		}
 	}
@@ -292,6 +301,9 @@ Common::String ResourceManager::getUniqueFileName(const Common::String &fileName
  * Deletes a resource, removes it from the lists, and updates m_UsedMemory
  */
 Common::List<Resource *>::iterator ResourceManager::deleteResource(Resource *pResource) {
+	// Update the used memory total
+	_usedMemory -= pResource->getMemoryUsage();
+
 	// Remove the resource from the hash table
 	_resourceHashMap.erase(pResource->_fileName);
 
@@ -91,6 +91,14 @@ public:
 		return _type;
 	}
 
+	/**
+	 * Returns the approximate memory footprint of the decoded resource in
+	 * bytes, or 0 if the size is unknown
+	 */
+	virtual uint getMemoryUsage() const {
+		return 0;
+	}
+
 protected:
 	virtual ~Resource() {}
 
@@ -20,6 +20,7 @@
  */
 
 #include "graphics/opengl/system_headers.h"
+#include "graphics/opengl/texture.h"
 
 #include "tetraedge/tetraedge.h"
 #include "tetraedge/te/te_3d_texture_opengl.h"
@@ -129,13 +130,9 @@ bool Te3DTextureOpenGL::load(const TeImage &img) {
 	_texWidth = optimizedSz._x;
 	_texHeight = optimizedSz._y;
 
+	OpenGL::TextureUploadBatch uploadBatch;
+
 	glBindTexture(GL_TEXTURE_2D, _glTexture);
-	glPixelStorei(GL_UNPACK_SWAP_BYTES, GL_FALSE);
-	glPixelStorei(GL_UNPACK_LSB_FIRST, GL_FALSE);
-	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-	glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
-	glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
 	const void *imgdata = img.getPixels();
 	if (img.format == Graphics::PixelFormat::createFormatRGBA32()) {
@@ -162,17 +159,13 @@ bool Te3DTextureOpenGL::load(const TeImage &img) {
 		// a (half?)pixel outside the original texture. Clear one more row
 		// of the new texture with 0s to avoid artifacts.
 		if ((int)_texHeight > img.h) {
-			byte *buf = new byte[img.w * 4];
-			memset(buf, 0, img.w * 4);
+			const byte *buf = uploadBatch.zeroBuffer(img.w * 4);
 			glTexSubImage2D(GL_TEXTURE_2D, 0, 0, img.h, img.w, 1, GL_RGBA, GL_UNSIGNED_BYTE, buf);
-			delete [] buf;
 		}
 		// And the same for the right-hand-side
 		if ((int)_texWidth > img.w) {
-			byte *buf = new byte[img.h * 4];
-			memset(buf, 0, img.h * 4);
+			const byte *buf = uploadBatch.zeroBuffer(img.h * 4);
 			glTexSubImage2D(GL_TEXTURE_2D, 0, img.w, 0, 1, img.h, GL_RGBA, GL_UNSIGNED_BYTE, buf);
-			delete [] buf;
 		}
 
 		if (_alphaOnly)
@@ -217,13 +210,10 @@ void Te3DTextureOpenGL::update(const TeImage &img, uint xoff, uint yoff) {
 		return;
 
 	setAccessName(img.getAccessName().append(".3dtex"));
+
+	OpenGL::TextureUploadBatch uploadBatch;
+
 	glBindTexture(GL_TEXTURE_2D, _glTexture);
-	glPixelStorei(GL_UNPACK_SWAP_BYTES, GL_FALSE);
-	glPixelStorei(GL_UNPACK_LSB_FIRST, GL_FALSE);
-	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-	glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
-	glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
 	const void *imgdata = img.getPixels();
 	glTexSubImage2D(GL_TEXTURE_2D, 0, xoff, yoff, img.w, img.h, GL_RGBA, GL_UNSIGNED_BYTE, imgdata);
@@ -581,14 +581,28 @@ static void t2WrtNonZero(DRAWOBJECT *pObj, uint8 *srcP, uint8 *destP, bool apply
 				int runLength = numBytes - clipAmount;
 				x += numBytes - runLength;
 
-				for (int xp = 0; xp < runLength; ++xp) {
-					if ((yClip > 0) || (x >= (pObj->width - rightClip)))
-						++srcP;
-					else if (horizFlipped)
-						*tempP-- = pObj->constant + *srcP++;
-					else
-						*tempP++ = pObj->constant + *srcP++;
-					++x;
+				if (yClip == 0 && !horizFlipped && x + runLength <= pObj->width - rightClip) {
+					// Fast path for the usual case: the row is visible and
+					// the run is not cut off at the right edge.
+					if (pObj->constant == 0) {
+						memcpy(tempP, srcP, runLength);
+						tempP += runLength;
+						srcP += runLength;
+					} else {
+						for (int xp = 0; xp < runLength; ++xp)
+							*tempP++ = pObj->constant + *srcP++;
+					}
+					x += runLength;
+				} else {
+					for (int xp = 0; xp < runLength; ++xp) {
+						if ((yClip > 0) || (x >= (pObj->width - rightClip)))
+							++srcP;
+						else if (horizFlipped)
+							*tempP-- = pObj->constant + *srcP++;
+						else
+							*tempP++ = pObj->constant + *srcP++;
+						++x;
+					}
 				}
 			}
 		}
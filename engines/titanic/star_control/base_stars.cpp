@@ -59,11 +59,68 @@ bool CBaseStarEntry::operator==(const CBaseStarEntry &s) const {
 /*------------------------------------------------------------------------*/
 
 CBaseStars::CBaseStars() : _minVal(0.0), _maxVal(1.0), _range(0.0),
-		_value1(0.0), _value2(0.0), _value3(0.0), _value4(0.0) {
+		_value1(0.0), _value2(0.0), _value3(0.0), _value4(0.0),
+		_plotThreshold(0.0), _plotMethod(-1), _plotWidth(0), _plotHeight(0),
+		_plotPitch(0), _plotsValid(false), _plotsRecording(false) {
+	_plotValues[0] = _plotValues[1] = _plotValues[2] = _plotValues[3] = 0.0;
 }
 
 void CBaseStars::clear() {
 	_data.clear();
+	invalidatePlotCache();
+}
+
+bool CBaseStars::canReplayPlots(int method, const FPose &pose, double threshold,
+		const CSurfaceArea *surfaceArea) const {
+	return _plotsValid && method == _plotMethod
+		&& surfaceArea->_width == _plotWidth && surfaceArea->_height == _plotHeight
+		&& surfaceArea->_pitch == _plotPitch
+		&& threshold == _plotThreshold
+		&& _value1 == _plotValues[0] && _value2 == _plotValues[1]
+		&& _value3 == _plotValues[2] && _value4 == _plotValues[3]
+		&& pose._row1 == _plotPose._row1 && pose._row2 == _plotPose._row2
+		&& pose._row3 == _plotPose._row3 && pose._vector == _plotPose._vector;
+}
+
+void CBaseStars::replayPlots(const CSurfaceArea *surfaceArea) const {
+	for (uint idx = 0; idx < _plotCache.size(); ++idx) {
+		const CStarPlot &plot = _plotCache[idx];
+		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + plot._offset);
+		uint16 *rowP = pixelP + surfaceArea->_pitch / 2;
+
+		if (plot._orMode) {
+			*pixelP |= plot._rgb;
+			if (plot._thickness) {
+				*(pixelP + 1) |= plot._rgb;
+				*rowP |= plot._rgb;
+				*(rowP + 1) |= plot._rgb;
+			}
+		} else {
+			*pixelP = plot._rgb;
+			if (plot._thickness) {
+				*(pixelP + 1) = plot._rgb;
+				*rowP = plot._rgb;
+				*(rowP + 1) = plot._rgb;
+			}
+		}
+	}
+}
+
+void CBaseStars::startPlotRecording(int method, const FPose &pose, double threshold,
+		const CSurfaceArea *surfaceArea) {
+	_plotMethod = method;
+	_plotPose = pose;
+	_plotThreshold = threshold;
+	_plotValues[0] = _value1;
+	_plotValues[1] = _value2;
+	_plotValues[2] = _value3;
+	_plotValues[3] = _value4;
+	_plotWidth = surfaceArea->_width;
+	_plotHeight = surfaceArea->_height;
+	_plotPitch = surfaceArea->_pitch;
+	_plotCache.clear();
+	_plotsValid = false;
+	_plotsRecording = true;
 }
 
 void CBaseStars::initialize() {
@@ -101,6 +158,8 @@ void CBaseStars::loadData(Common::SeekableReadStream &s) {
 	// Iterate through reading the data for each entry
 	for (uint idx = 0; idx < count; ++idx)
 		_data[idx].load(s);
+
+	invalidatePlotCache();
 }
 
 void CBaseStars::loadData(const CString &resName) {
@@ -126,38 +185,77 @@ void CBaseStars::resetEntry(CBaseStarEntry &entry) {
 }
 
 void CBaseStars::draw(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup) {
-	if (!_data.empty()) {
-		switch (camera->getStarColor()) {
-		case WHITE: // draw white, green, and red stars (mostly white)
-			switch (surfaceArea->_bpp) {
-			case 1:
-				draw1(surfaceArea, camera, closeup);
-				break;
-			case 2:
-				draw2(surfaceArea, camera, closeup);
-				break;
-			default:
-				break;
-			}
-			break;
+	if (_data.empty())
+		return;
 
-		case PINK: // draw pink stars
-			switch (surfaceArea->_bpp) {
-			case 1:
-				draw3(surfaceArea, camera, closeup);
-				break;
-			case 2:
-				draw4(surfaceArea, camera, closeup);
-				break;
-			default:
-				break;
-			}
+	int method = 0;
+	switch (camera->getStarColor()) {
+	case WHITE: // draw white, green, and red stars (mostly white)
+		switch (surfaceArea->_bpp) {
+		case 1:
+			method = 1;
+			break;
+		case 2:
+			method = 2;
+			break;
+		default:
 			break;
+		}
+		break;
 
+	case PINK: // draw pink stars
+		switch (surfaceArea->_bpp) {
+		case 1:
+			method = 3;
+			break;
+		case 2:
+			method = 4;
+			break;
 		default:
 			break;
 		}
+		break;
+
+	default:
+		break;
 	}
+
+	if (!method)
+		return;
+
+	// When nothing has moved since the previous frame, the plots recorded
+	// back then produce the identical output, so replay them and skip the
+	// per-star projection entirely
+	FPose pose = camera->getPose();
+	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
+	double threshold = camera->getFrontClip();
+
+	if (canReplayPlots(method, pose, threshold, surfaceArea)) {
+		replayPlots(surfaceArea);
+		return;
+	}
+
+	startPlotRecording(method, pose, threshold, surfaceArea);
+
+	switch (method) {
+	case 1:
+		draw1(surfaceArea, camera, closeup);
+		break;
+	case 2:
+		draw2(surfaceArea, camera, closeup);
+		break;
+	case 3:
+		draw3(surfaceArea, camera, closeup);
+		break;
+	case 4:
+		draw4(surfaceArea, camera, closeup);
+		break;
+	default:
+		break;
+	}
+
+	_plotsValid = _plotsRecording;
+	_plotsRecording = false;
 }
 
 void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup) {
@@ -186,6 +284,8 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
+			// The closeup animates on its own, so this frame must not be cached
+			_plotsRecording = false;
 			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
 				surfaceArea, camera);
 			continue;
@@ -225,11 +325,13 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		int g = (int)(green - 0.5) & 0xfff8;
 		int b = (int)(blue - 0.5) & 0xfff8;
 		int rgb = ((g | (r << 5)) << 2) | ((b >> 3) & 0xfff8);
-		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+		uint32 offset = surfaceArea->_pitch * yStart + xStart * 2;
+		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + offset);
 
 		switch (entry._thickness) {
 		case 0:
 			*pixelP = rgb;
+			recordPlot(offset, rgb, 0, false);
 			break;
 
 		case 1:
@@ -237,6 +339,7 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			*(pixelP + 1) = rgb;
 			*(pixelP + surfaceArea->_pitch / 2) = rgb;
 			*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+			recordPlot(offset, rgb, 1, false);
 			break;
 
 		default:
@@ -271,6 +374,8 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
+			// The closeup animates on its own, so this frame must not be cached
+			_plotsRecording = false;
 			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
 				surfaceArea, camera);
 			continue;
@@ -311,11 +416,13 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		int b = (int)(blue - 0.5) & 0xfff8;
 
 		int rgb = ((g | (r << 5)) << 3) | (b >> 3);
-		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+		uint32 offset = surfaceArea->_pitch * yStart + xStart * 2;
+		uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + offset);
 
 		switch (entry._thickness) {
 		case 0:
 			*pixelP = rgb;
+			recordPlot(offset, rgb, 0, false);
 			break;
 
 		case 1:
@@ -323,6 +430,7 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			*(pixelP + 1) = rgb;
 			*(pixelP + surfaceArea->_pitch / 2) = rgb;
 			*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+			recordPlot(offset, rgb, 1, false);
 			break;
 
 		default:
@@ -345,6 +453,7 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 	double *v3Ptr = &_value3, *v4Ptr = &_value4;
 	double tempX, tempY, tempZ, total2, sVal;
 	int xStart, yStart, rgb;
+	uint32 offset;
 	uint16 *pixelP;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
@@ -360,6 +469,8 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
+			// The closeup animates on its own, so this frame must not be cached
+			_plotsRecording = false;
 			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
 				surfaceArea, camera);
 			continue;
@@ -382,12 +493,14 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			sVal = 255.0;
 
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			offset = surfaceArea->_pitch * yStart + xStart * 2;
+			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + offset);
 			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
 
 			switch (entry._thickness) {
 			case 0:
 				*pixelP = rgb;
+				recordPlot(offset, rgb, 0, false);
 				break;
 
 			case 1:
@@ -395,6 +508,7 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 				*(pixelP + 1) = rgb;
 				*(pixelP + surfaceArea->_pitch / 2) = rgb;
 				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+				recordPlot(offset, rgb, 1, false);
 				break;
 
 			default:
@@ -416,12 +530,14 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			sVal = 255.0;
 
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			offset = surfaceArea->_pitch * yStart + xStart * 2;
+			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + offset);
 			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
 
 			switch (entry._thickness) {
 			case 0:
 				*pixelP |= rgb;
+				recordPlot(offset, rgb, 0, true);
 				break;
 
 			case 1:
@@ -429,6 +545,7 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 				*(pixelP + 1) |= rgb;
 				*(pixelP + surfaceArea->_pitch / 2) |= rgb;
 				*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
+				recordPlot(offset, rgb, 1, true);
 				break;
 
 			default:
@@ -451,6 +568,7 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 	double *v1Ptr = &_value1, *v2Ptr = &_value2, *v3Ptr = &_value3, *v4Ptr = &_value4;
 	double tempX, tempY, tempZ, total2, sVal;
 	int xStart, yStart, rgb;
+	uint32 offset;
 	uint16 *pixelP;
 
 	for (uint idx = 0; idx < _data.size(); ++idx) {
@@ -467,7 +585,9 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
 		if (total2 < 1.0e12) {
-			// We're in close proximity to the given star, so draw a closeup of it
+			// We're in close proximity to the given star, so draw a closeup of it.
+			// The closeup animates on its own, so this frame must not be cached
+			_plotsRecording = false;
 			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
 				surfaceArea, camera);
 			continue;
@@ -490,12 +610,14 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			sVal = 255.0;
 
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			offset = surfaceArea->_pitch * yStart + xStart * 2;
+			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + offset);
 			rgb = ((int)(sVal - 0.5) & 0xf8) << 8;
 
 			switch (entry._thickness) {
 			case 0:
 				*pixelP = rgb;
+				recordPlot(offset, rgb, 0, false);
 				break;
 
 			case 1:
@@ -503,6 +625,7 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 				*(pixelP + 1) = rgb;
 				*(pixelP + surfaceArea->_pitch / 2) = rgb;
 				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+				recordPlot(offset, rgb, 1, false);
 				break;
 
 			default:
@@ -524,12 +647,14 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			sVal = 255.0;
 
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			offset = surfaceArea->_pitch * yStart + xStart * 2;
+			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + offset);
 			rgb = ((int)(sVal - 0.5) >> 3) & 0xff;
 
 			switch (entry._thickness) {
 			case 0:
 				*pixelP |= rgb;
+				recordPlot(offset, rgb, 0, true);
 				break;
 
 			case 1:
@@ -537,6 +662,7 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 				*(pixelP + 1) |= rgb;
 				*(pixelP + surfaceArea->_pitch / 2) |= rgb;
 				*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
+				recordPlot(offset, rgb, 1, true);
 				break;
 
 			default:
@@ -22,6 +22,7 @@
 #ifndef TITANIC_BASE_STARS_H
 #define TITANIC_BASE_STARS_H
 
+#include "titanic/star_control/fpose.h"
 #include "titanic/star_control/frange.h"
 #include "common/array.h"
 
@@ -73,11 +74,75 @@ struct CStarPosition : public Common::Point {
  */
 class CBaseStars {
 private:
+	/**
+	 * A single pixel plot recorded while drawing a frame
+	 */
+	struct CStarPlot {
+		uint32 _offset;		///< Byte offset of the pixel within the surface
+		uint16 _rgb;
+		byte _thickness;
+		bool _orMode;		///< Whether the color is OR-ed into the pixel
+	};
+
+	// Plots from the last fully drawn frame. While the camera pose, the
+	// clip settings and the target surface stay unchanged, every star
+	// projects to the same pixel, so the recorded plots can simply be
+	// replayed instead of redoing the per-star transform. Frames that
+	// trigger closeup renders are never cached, since the closeup
+	// animates independently of the camera.
+	Common::Array<CStarPlot> _plotCache;
+	FPose _plotPose;
+	double _plotThreshold;
+	double _plotValues[4];
+	int _plotMethod, _plotWidth, _plotHeight, _plotPitch;
+	bool _plotsValid, _plotsRecording;
+
+	/**
+	 * Returns true if the cached plots match the passed draw parameters
+	 * and can be replayed as-is
+	 */
+	bool canReplayPlots(int method, const FPose &pose, double threshold,
+		const CSurfaceArea *surfaceArea) const;
+
+	/**
+	 * Replays the cached plots onto the surface
+	 */
+	void replayPlots(const CSurfaceArea *surfaceArea) const;
+
+	/**
+	 * Starts recording the plots of a new frame for the given parameters
+	 */
+	void startPlotRecording(int method, const FPose &pose, double threshold,
+		const CSurfaceArea *surfaceArea);
+
+	/**
+	 * Records a single plot of the frame being drawn
+	 */
+	void recordPlot(uint32 offset, uint16 rgb, byte thickness, bool orMode) {
+		if (_plotsRecording) {
+			CStarPlot plot;
+			plot._offset = offset;
+			plot._rgb = rgb;
+			plot._thickness = thickness;
+			plot._orMode = orMode;
+			_plotCache.push_back(plot);
+		}
+	}
+
 	void draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
 	void draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
 	void draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
 	void draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
 protected:
+	/**
+	 * Drops the cached plots of the last frame. Must be called whenever
+	 * the star entries change
+	 */
+	void invalidatePlotCache() {
+		_plotsValid = false;
+		_plotCache.clear();
+	}
+
 	FRange _minMax;
 	double _minVal;
 	double _maxVal;
@@ -481,10 +481,12 @@ void Screen::drawSpriteCore(byte *dest, SpriteFilter &reader, const SpriteDrawIt
 				} else {
 					packet.pixel += sprite.baseColor - 1;
 				}
-				while (packet.count--) {
-					*dest = packet.pixel;
-					dest += destInc;
-				}
+				// The whole run is one color, so fill it in one go
+				if (destInc > 0)
+					memset(dest, packet.pixel, packet.count);
+				else
+					memset(dest - packet.count + 1, packet.pixel, packet.count);
+				dest += packet.count * destInc;
 			}
 		} else {
 			dest += packet.count * destInc;
@@ -5543,12 +5543,27 @@ void ToonEngine::addDirtyRect( int32 left, int32 top, int32 right, int32 bottom
 
 	Common::Rect rect(left, top, right, bottom);
 
-	for (uint32 i = 0; i < _dirtyRects.size(); ++i) {
-		if (_dirtyRects[i].contains(rect))
-			return;
-		if (rect.contains(_dirtyRects[i])) {
-			_dirtyRects.remove_at(i);
-			--i;
+	// Merge overlapping rects: the overlap would otherwise have its
+	// background restored, sprites drawn and pixels copied to the backend
+	// twice. Only merge when the union is no bigger than the two rects
+	// together, so far-apart rects that barely touch stay separate. A merge
+	// can create new overlaps with rects already scanned, so restart.
+	bool merged = true;
+	while (merged) {
+		merged = false;
+		for (uint32 i = 0; i < _dirtyRects.size(); ++i) {
+			if (_dirtyRects[i].contains(rect))
+				return;
+			if (rect.intersects(_dirtyRects[i])) {
+				Common::Rect u(rect);
+				u.extend(_dirtyRects[i]);
+				if (u.width() * u.height() <= rect.width() * rect.height() + _dirtyRects[i].width() * _dirtyRects[i].height()) {
+					rect = u;
+					_dirtyRects.remove_at(i);
+					merged = true;
+					break;
+				}
+			}
 		}
 	}
 
@@ -2918,9 +2918,13 @@ void SceneObject::draw() {
  * Refreshes the background around the area of a scene object prior to it's being redrawn,
  * in case it is moving
  */
-void SceneObject::updateScreen() {
-	Rect srcRect = _paneRects[CURRENT_PANENUM];
-	const Rect &sceneBounds = g_globals->_sceneManager._scene->_sceneBounds;
+/**
+ * Works out the screen area that needs refreshing for a given pane rect,
+ * aligned and clipped the same way SceneObject::updateScreen() does it.
+ * The result may be an invalid (empty) rect when nothing is covered
+ */
+static Rect getScreenUpdateRect(const Rect &paneRect) {
+	Rect srcRect = paneRect;
 	srcRect.left = (srcRect.left / 4) * 4;
 	srcRect.right = ((srcRect.right + 3) / 4) * 4;
 	srcRect.clip(g_globals->_sceneManager._scene->_sceneBounds);
@@ -2930,13 +2934,27 @@ void SceneObject::updateScreen() {
 			srcRect.bottom = MIN<int16>(srcRect.bottom, T2_GLOBALS._interfaceY);
 	}
 
-	if (srcRect.isValidRect()) {
-		Rect destRect  = srcRect;
-		destRect.translate(-sceneBounds.left, -sceneBounds.top);
-		srcRect.translate(-g_globals->_sceneOffset.x, -g_globals->_sceneOffset.y);
+	return srcRect;
+}
 
-		g_globals->_screen.copyFrom(g_globals->_sceneManager._scene->_backSurface, srcRect, destRect);
-	}
+/**
+ * Restores the given scene-coordinate area of the screen from the clean
+ * background surface
+ */
+static void restoreScreenRect(const Rect &updateRect) {
+	const Rect &sceneBounds = g_globals->_sceneManager._scene->_sceneBounds;
+	Rect srcRect = updateRect, destRect = updateRect;
+	destRect.translate(-sceneBounds.left, -sceneBounds.top);
+	srcRect.translate(-g_globals->_sceneOffset.x, -g_globals->_sceneOffset.y);
+
+	g_globals->_screen.copyFrom(g_globals->_sceneManager._scene->_backSurface, srcRect, destRect);
+}
+
+void SceneObject::updateScreen() {
+	Rect srcRect = getScreenUpdateRect(_paneRects[CURRENT_PANENUM]);
+
+	if (srcRect.isValidRect())
+		restoreScreenRect(srcRect);
 }
 
 void SceneObject::updateAngle(const Common::Point &pt) {
@@ -3134,13 +3152,56 @@ void SceneObjectList::draw() {
 			tempRect.translate(-g_globals->_sceneOffset.x, -g_globals->_sceneOffset.y);
 			ScenePalette::changeBackground(tempRect, g_globals->_sceneManager._fadeMode);
 		} else {
+			// Restore the screen under the changed objects in one pass over
+			// the merged areas, so that overlapping objects don't copy the
+			// background pixels they share several times over
+			Common::List<Rect> restoreRects;
 			for (uint objIndex = 0; objIndex < objList.size(); ++objIndex) {
 				SceneObject *obj = objList[objIndex];
 
-				if ((obj->_flags & flagMask) && obj->_paneRects[paneNum].isValidRect())
-					obj->updateScreen();
+				if ((obj->_flags & flagMask) && obj->_paneRects[paneNum].isValidRect() &&
+						obj->canUpdateScreen()) {
+					Rect updateRect = getScreenUpdateRect(obj->_paneRects[paneNum]);
+					if (!updateRect.isValidRect())
+						continue;
+
+					// Grow an already collected area when the new one overlaps it
+					bool mergedRect = false;
+					for (Common::List<Rect>::iterator i = restoreRects.begin(); i != restoreRects.end(); ++i) {
+						if ((*i).intersects(updateRect)) {
+							(*i).extend(updateRect);
+							mergedRect = true;
+							break;
+						}
+					}
+					if (!mergedRect)
+						restoreRects.push_back(updateRect);
+				}
 			}
 
+			// Growing an area may have made it overlap another one, so keep
+			// merging until the list is stable
+			bool mergedRects = true;
+			while (mergedRects) {
+				mergedRects = false;
+
+				for (Common::List<Rect>::iterator rOuter = restoreRects.begin();
+						rOuter != restoreRects.end() && !mergedRects; ++rOuter) {
+					Common::List<Rect>::iterator rInner = rOuter;
+					while (++rInner != restoreRects.end()) {
+						if ((*rOuter).intersects(*rInner)) {
+							(*rOuter).extend(*rInner);
+							restoreRects.erase(rInner);
+							mergedRects = true;
+							break;
+						}
+					}
+				}
+			}
+
+			for (Common::List<Rect>::iterator i = restoreRects.begin(); i != restoreRects.end(); ++i)
+				restoreScreenRect(*i);
+
 			g_globals->_paneRegions[paneNum].draw();
 		}
 
@@ -3353,11 +3414,15 @@ void SceneText::synchronize(Serializer &s) {
 		_textSurface.synchronize(s);
 }
 
-void SceneText::updateScreen() {
+bool SceneText::canUpdateScreen() const {
 	// FIXME: Hack for Blue Force to handle not refreshing the screen if the user interface
 	// has been re-activated after showing some scene text
-	if ((g_vm->getGameID() == GType_Ringworld) || (_bounds.top < UI_INTERFACE_Y) ||
-			!T2_GLOBALS._uiElements._visible)
+	return (g_vm->getGameID() == GType_Ringworld) || (_bounds.top < UI_INTERFACE_Y) ||
+			!T2_GLOBALS._uiElements._visible;
+}
+
+void SceneText::updateScreen() {
+	if (canUpdateScreen())
 		SceneObject::updateScreen();
 }
 
@@ -599,6 +599,7 @@ public:
 	virtual void reposition();
 	virtual void draw();
 	virtual void proc19() {}
+	virtual bool canUpdateScreen() const { return true; }
 	virtual void updateScreen();
 	// New methods introduced by Blue Force
 	virtual void updateAngle(const Common::Point &pt);
@@ -640,6 +641,7 @@ public:
 	void synchronize(Serializer &s) override;
 	Common::String getClassName() override { return "SceneText"; }
 	GfxSurface getFrame() override { return _textSurface; }
+	bool canUpdateScreen() const override;
 	void updateScreen() override;
 };
 
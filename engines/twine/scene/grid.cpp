@@ -145,15 +145,20 @@ void Grid::copyMask(int32 index, int32 x, int32 y, const Graphics::ManagedSurfac
 
 			width = *(ptr++); // copy size
 
-			for (int32 j = 0; j < width; j++) {
-				if (absX >= _engine->_interface->_clip.left && absX <= _engine->_interface->_clip.right) {
-					*outPtr = *inPtr;
-				}
-
-				absX++;
-				outPtr++;
-				inPtr++;
+			// copy only the part of the run inside the clip window in one
+			// go instead of testing every pixel against it
+			int32 skip = _engine->_interface->_clip.left - absX;
+			if (skip < 0) {
+				skip = 0;
 			}
+			int32 count = MIN<int32>(width, _engine->_interface->_clip.right - absX + 1) - skip;
+			if (count > 0) {
+				memcpy(outPtr + skip, inPtr + skip, count);
+			}
+
+			absX += width;
+			outPtr += width;
+			inPtr += width;
 		} while (--height);
 
 		absX = left;
@@ -45,10 +45,14 @@ namespace Ultima8 {
 static const uint32 TRANSPARENT_COLOR = TEX32_PACK_RGBA(0x7F, 0x00, 0x00, 0x7F);
 static const uint32 HIGHLIGHT_COLOR = TEX32_PACK_RGBA(0xFF, 0xFF, 0x00, 0x1F);
 
+// Size of a spatial index cell in screenspace pixels (as a shift amount)
+static const int GRID_CELL_SHIFT = 7;
+
 ItemSorter::ItemSorter(int capacity) :
 	_shapes(nullptr), _clipWindow(0, 0, 0, 0), _items(nullptr), _itemsTail(nullptr),
 	_itemsUnused(nullptr), _painted(nullptr), _camSx(0), _camSy(0),
-	_sortLimit(0), _sortLimitChanged(false) {
+	_sortLimit(0), _sortLimitChanged(false),
+	_gridCols(0), _gridRows(0), _visitId(0) {
 	int i = capacity;
 	while (i--) {
 		SortItem *next = _itemsUnused;
@@ -88,6 +92,15 @@ void ItemSorter::BeginDisplayList(const Rect &clipWindow, const Point3 &cam) {
 	_itemsTail = nullptr;
 	_painted = nullptr;
 
+	// Resize the spatial index to cover the clip window and mark all cells
+	// empty; cells keep their storage so this doesn't reallocate each frame
+	_gridCols = (_clipWindow.width() >> GRID_CELL_SHIFT) + 1;
+	_gridRows = (_clipWindow.height() >> GRID_CELL_SHIFT) + 1;
+	if (_grid.size() < (uint)(_gridCols * _gridRows))
+		_grid.resize(_gridCols * _gridRows);
+	for (uint i = 0; i < _grid.size(); i++)
+		_grid[i].count = 0;
+
 	// Screenspace bounding box bottom x coord (RNB x coord)
 	int32 camSx = (cam.x - cam.y) / 4;
 	// Screenspace bounding box bottom extent  (RNB y coord)
@@ -187,62 +200,98 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
-
-	// Ok,
+	// Get the insert point... which is before the first item that has higher z than us
 	SortItem *addpoint = nullptr;
 	for (SortItem *si2 = _items; si2 != nullptr; si2 = si2->_next) {
-		// Get the insert point... which is before the first item that has higher z than us
-		if (!addpoint && si->listLessThan(*si2))
+		if (si->listLessThan(*si2)) {
 			addpoint = si2;
+			break;
+		}
+	}
 
-		if (si2->_occluded)
-			continue;
+	// The range of spatial index cells this item's screen rect covers
+	int32 cx0 = CLIP<int32>((si->_sr.left - _clipWindow.left) >> GRID_CELL_SHIFT, 0, _gridCols - 1);
+	int32 cx1 = CLIP<int32>((si->_sr.right - _clipWindow.left) >> GRID_CELL_SHIFT, 0, _gridCols - 1);
+	int32 cy0 = CLIP<int32>((si->_sr.top - _clipWindow.top) >> GRID_CELL_SHIFT, 0, _gridRows - 1);
+	int32 cy1 = CLIP<int32>((si->_sr.bottom - _clipWindow.top) >> GRID_CELL_SHIFT, 0, _gridRows - 1);
+
+	// Compare against the items in the cells we cover. Only rects that share
+	// a cell can overlap on screen, so this checks the same pairs the full
+	// list walk used to find, minus the ones that trivially don't overlap.
+	_visitId++;
+	for (int32 cy = cy0; cy <= cy1 && !si->_occluded; cy++) {
+		for (int32 cx = cx0; cx <= cx1 && !si->_occluded; cx++) {
+			const GridCell &cell = _grid[cy * _gridCols + cx];
+			for (uint n = 0; n < cell.count; n++) {
+				SortItem *si2 = cell.items[n];
+
+				// Items spanning several cells are only checked once
+				if (si2->_visit == _visitId)
+					continue;
+				si2->_visit = _visitId;
+
+				if (si2->_occluded)
+					continue;
 
 #ifdef SORTITEM_OCCLUSION_EXPERIMENTAL
-		// Find adjoining rects for better occlusion
-		if (si->_occl && si2->_occl && si->_z == si2->_z) {
-			// Does this share an edge?
-			if (si->_y == si2->_y && si->_yFar == si2->_yFar) {
-				if (si->_xLeft == si2->_x) {
-					si->_xAdjoin = si2;
-				} else if (si->_x == si2->_xLeft) {
-					si2->_xAdjoin = si;
-				}
-			}
-			else if (si->_x == si2->_x && si->_xLeft == si2->_xLeft) {
-				if (si->_yFar == si2->_y) {
-					si->_yAdjoin = si2;
-				} else if (si->_y == si2->_yFar) {
-					si2->_yAdjoin = si;
+				// Find adjoining rects for better occlusion
+				if (si->_occl && si2->_occl && si->_z == si2->_z) {
+					// Does this share an edge?
+					if (si->_y == si2->_y && si->_yFar == si2->_yFar) {
+						if (si->_xLeft == si2->_x) {
+							si->_xAdjoin = si2;
+						} else if (si->_x == si2->_xLeft) {
+							si2->_xAdjoin = si;
+						}
+					}
+					else if (si->_x == si2->_x && si->_xLeft == si2->_xLeft) {
+						if (si->_yFar == si2->_y) {
+							si->_yAdjoin = si2;
+						} else if (si->_y == si2->_yFar) {
+							si2->_yAdjoin = si;
+						}
+					}
 				}
-			}
-		}
 #endif // SORTITEM_OCCLUSION_EXPERIMENTAL
 
-		// Attempt to find paint dependency order
-		if (si->overlap(*si2)) {
-			if (si->below(*si2)) {
-				if (si2->_occl && si2->occludes(*si)) {
-					// No need to do any more checks, this isn't visible
-					si->_occluded = true;
-					break;
-				} else {
-					// si1 is behind si2, so add it to si2's dependency list
-					si2->_depends.insert_sorted(si);
-				}
-			} else {
-				if (si->_occl && si->occludes(*si2)) {
-					// Occluded, but we can't remove it from the list
-					si2->_occluded = true;
-				} else {
-					// si2 is behind si1, so add it to si1's dependency list
-					si->_depends.insert_sorted(si2);
+				// Attempt to find paint dependency order
+				if (si->overlap(*si2)) {
+					if (si->below(*si2)) {
+						if (si2->_occl && si2->occludes(*si)) {
+							// No need to do any more checks, this isn't visible
+							si->_occluded = true;
+							break;
+						} else {
+							// si1 is behind si2, so add it to si2's dependency list
+							si2->_depends.insert_sorted(si);
+						}
+					} else {
+						if (si->_occl && si->occludes(*si2)) {
+							// Occluded, but we can't remove it from the list
+							si2->_occluded = true;
+						} else {
+							// si2 is behind si1, so add it to si1's dependency list
+							si->_depends.insert_sorted(si2);
+						}
+					}
 				}
 			}
 		}
 	}
 
+	// Add it to the spatial index; occluded items stay in it, like they stay
+	// in the list, and are skipped as candidates via the _occluded flag
+	for (int32 cy = cy0; cy <= cy1; cy++) {
+		for (int32 cx = cx0; cx <= cx1; cx++) {
+			GridCell &cell = _grid[cy * _gridCols + cx];
+			if (cell.count < cell.items.size())
+				cell.items[cell.count] = si;
+			else
+				cell.items.push_back(si);
+			cell.count++;
+		}
+	}
+
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
 
@@ -23,6 +23,7 @@
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
 #include "ultima/ultima8/misc/rect.h"
+#include "common/array.h"
 
 namespace Ultima {
 namespace Ultima8 {
@@ -46,6 +47,18 @@ class ItemSorter {
 	int32       _sortLimit;
 	bool        _sortLimitChanged;
 
+	// Spatial index of screenspace rects, so the paint dependency checks in
+	// AddItem only consider items whose rects share a grid cell instead of
+	// the whole display list.
+	struct GridCell {
+		Common::Array<SortItem *> items;
+		uint count;   // used entries; the array keeps its capacity across frames
+		GridCell() : count(0) {}
+	};
+	Common::Array<GridCell> _grid;
+	int32       _gridCols, _gridRows;
+	uint32      _visitId;   // current candidate-dedup marker for SortItem::_visit
+
 public:
 	ItemSorter(int capacity);
 	~ItemSorter();
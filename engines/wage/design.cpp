@@ -205,6 +205,7 @@ void Design::adjustBounds(int16 x, int16 y) {
 }
 
 class PlotDataPrimitives : public Graphics::Primitives {
+public:
 	void drawPoint(int x, int y, uint32 color, void *data) override {
 		PlotData *p = (PlotData *)data;
 
@@ -258,6 +259,48 @@ class PlotDataPrimitives : public Graphics::Primitives {
 					}
 		}
 	}
+
+	// Batched row fill for the 1 pixel pen: clip once, fetch the pattern
+	// row once and write the span without a virtual call and bounds check
+	// per pixel. Filled shapes all funnel through here.
+	void drawHLine(int x1, int x2, int y, uint32 color, void *data) override {
+		PlotData *p = (PlotData *)data;
+
+		if (p->fillType > p->patterns->size())
+			return;
+
+		if (p->thickness != 1) {
+			Graphics::Primitives::drawHLine(x1, x2, y, color, data);
+			return;
+		}
+
+		if (x1 > x2)
+			SWAP(x1, x2);
+
+		if (p->design && p->design->isBoundsCalculation()) {
+			// adjustBounds() only ever grows the bounds, so the span is
+			// covered by its rightmost in-bounds point.
+			if (y >= 0 && x2 >= 0)
+				p->design->adjustBounds(x2, y);
+			return;
+		}
+
+		if (y < 0 || y >= p->surface->h)
+			return;
+
+		x1 = MAX(x1, 0);
+		x2 = MIN(x2, p->surface->w - 1);
+
+		if (x1 > x2)
+			return;
+
+		const byte *pat = p->patterns->operator[](p->fillType - 1);
+		const byte patRow = pat[(uint)y % 8];
+		byte *ptr = (byte *)p->surface->getBasePtr(x1, y);
+
+		for (int x = x1; x <= x2; x++, ptr++)
+			*ptr = (patRow & (1 << (7 - (uint)x % 8))) ? color : (byte)kColorWhite;
+	}
 };
 
 class PlotDataCirclePrimitives : public Graphics::Primitives {
@@ -22,6 +22,7 @@
 #include "watchmaker/3d/render/opengl_texture.h"
 #include "common/textconsole.h"
 #include "graphics/opengl/system_headers.h"
+#include "graphics/opengl/texture.h"
 #include "watchmaker/3d/dds_header.h"
 #include "watchmaker/render.h"
 
@@ -55,6 +56,8 @@ public:
 	}
 	OpenGLTexture(unsigned int texId) : _texId(texId) {}
 	void assignData(const TextureData &data) override {
+		OpenGL::TextureUploadBatch uploadBatch;
+
 		glBindTexture(GL_TEXTURE_2D, _texId);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
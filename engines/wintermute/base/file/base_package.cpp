@@ -30,7 +30,9 @@
 #include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/file/dcpackage.h"
 #include "engines/wintermute/wintermute.h"
+#include "common/array.h"
 #include "common/file.h"
+#include "common/span.h"
 #include "common/stream.h"
 #include "common/debug.h"
 
@@ -50,7 +52,7 @@ Common::SeekableReadStream *BasePackage::getFilePointer() {
 }
 
 static bool findPackageSignature(Common::SeekableReadStream *f, uint32 *offset) {
-	byte buf[32768];
+	Common::Array<byte> bufStorage;
 
 	byte signature[8];
 	WRITE_LE_UINT32(signature + 0, PACKAGE_MAGIC_1);
@@ -63,13 +65,13 @@ static bool findPackageSignature(Common::SeekableReadStream *f, uint32 *offset)
 	while (bytesRead < fileSize - 16) {
 		uint32 toRead = MIN<unsigned int>((unsigned int)32768, fileSize - bytesRead);
 		f->seek((int32)startPos, SEEK_SET);
-		uint32 actuallyRead = f->read(buf, toRead);
-		if (actuallyRead != toRead) {
+		Common::Span<const byte> buf = f->readSpan(toRead, bufStorage);
+		if (buf.size() != toRead) {
 			return false;
 		}
 
 		for (uint32 i = 0; i < toRead - 8; i++)
-			if (!memcmp(buf + i, signature, 8)) {
+			if (!memcmp(buf.data() + i, signature, 8)) {
 				*offset =  startPos + i;
 				return true;
 			}
@@ -161,14 +163,12 @@ PackageSet::PackageSet(Common::FSNode file, const Common::String &filename, bool
 		pkg->_boundToExe = boundToExe;
 
 		// read package info
+		Common::Array<byte> nameStorage;
 		byte nameLength = stream->readByte();
-		char *pkgName = new char[nameLength];
-		stream->read(pkgName, nameLength);
-		pkg->_name = pkgName;
+		Common::Span<const byte> pkgName = stream->readSpan(nameLength, nameStorage);
+		pkg->_name = Common::String((const char *)pkgName.data(), Common::strnlen((const char *)pkgName.data(), pkgName.size()));
 		pkg->_cd = stream->readByte();
 		pkg->_priority = hdr._priority;
-		delete[] pkgName;
-		pkgName = nullptr;
 
 		if (!hdr._masterIndex) {
 			pkg->_cd = 0;    // override CD to fixed disk
@@ -40,6 +40,10 @@
 #include "common/config-manager.h"
 
 #define DIRTY_RECT_LIMIT 800
+// How many separate dirty regions we track before collapsing them into one
+#define DIRTY_RECT_MAX_COUNT 8
+// How many retired tickets we keep around for reuse
+#define TICKET_POOL_LIMIT 64
 
 namespace Wintermute {
 
@@ -74,6 +78,10 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
+	for (uint i = 0; i < _ticketPool.size(); i++) {
+		delete _ticketPool[i];
+	}
+
 	delete _dirtyRect;
 
 	_renderSurface->free();
@@ -150,6 +158,7 @@ bool BaseRenderOSystem::flip() {
 		_skipThisFrame = false;
 		delete _dirtyRect;
 		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -172,7 +181,7 @@ bool BaseRenderOSystem::flip() {
 			if ((*it)->_wantsDraw == false) {
 				RenderTicket *ticket = *it;
 				it = _renderQueue.erase(it);
-				delete ticket;
+				releaseTicket(ticket);
 			} else {
 				(*it)->_wantsDraw = false;
 				++it;
@@ -190,6 +199,7 @@ bool BaseRenderOSystem::flip() {
 		}
 		delete _dirtyRect;
 		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -256,8 +266,7 @@ Graphics::PixelFormat BaseRenderOSystem::getPixelFormat() const {
 void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
                                     Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
 	if (_disableDirtyRects) {
-		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
-		ticket->_wantsDraw = true;
+		RenderTicket *ticket = getTicket(owner, surf, srcRect, dstRect, transform);
 		_renderQueue.push_back(ticket);
 		drawFromSurface(ticket);
 		return;
@@ -269,7 +278,6 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	}
 
 	if (owner) { // Fade-tickets are owner-less
-		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
 		RenderQueueIterator it = _lastFrameIter;
 		++it;
 		// Avoid calling end() and operator* every time, when potentially going through
@@ -278,7 +286,7 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 		RenderTicket *compareTicket = nullptr;
 		for (; it != endIterator; ++it) {
 			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
+			if (compareTicket->matches(owner, srcRect, dstRect, transform) && compareTicket->_isValid) {
 				if (_disableDirtyRects) {
 					drawFromSurface(compareTicket);
 				} else {
@@ -288,16 +296,36 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 			}
 		}
 	}
-	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
+	RenderTicket *ticket = getTicket(owner, surf, srcRect, dstRect, transform);
 	if (!_disableDirtyRects) {
 		drawFromTicket(ticket);
 	} else {
-		ticket->_wantsDraw = true;
 		_renderQueue.push_back(ticket);
 		drawFromSurface(ticket);
 	}
 }
 
+RenderTicket *BaseRenderOSystem::getTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
+                                           Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
+	if (!_ticketPool.empty()) {
+		RenderTicket *ticket = _ticketPool.back();
+		_ticketPool.pop_back();
+		ticket->recycle(owner, surf, srcRect, dstRect, transform);
+		return ticket;
+	}
+	return new RenderTicket(owner, surf, srcRect, dstRect, transform);
+}
+
+void BaseRenderOSystem::releaseTicket(RenderTicket *ticket) {
+	if (_ticketPool.size() < TICKET_POOL_LIMIT) {
+		// Keep the ticket itself, but don't hoard the pixel data.
+		ticket->freeSurface();
+		_ticketPool.push_back(ticket);
+	} else {
+		delete ticket;
+	}
+}
+
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 	addDirtyRect(renderTicket->_dstRect);
 	renderTicket->_isValid = false;
@@ -356,6 +384,28 @@ void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
 		_dirtyRect->extend(rect);
 	}
 	_dirtyRect->clip(_renderRect);
+
+	// Besides the overall bounding rect, keep a small list of separate dirty
+	// regions, so that two small changes in opposite corners of the screen
+	// don't force recomposing everything in between.
+	Common::Rect clipped(rect);
+	clipped.clip(_renderRect);
+	if (clipped.width() == 0 || clipped.height() == 0) {
+		return;
+	}
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		if (_dirtyRects[i].intersects(clipped)) {
+			_dirtyRects[i].extend(clipped);
+			return;
+		}
+	}
+	if (_dirtyRects.size() < DIRTY_RECT_MAX_COUNT) {
+		_dirtyRects.push_back(clipped);
+	} else {
+		// Too fragmented, fall back to composing the bounding rect in one go.
+		_dirtyRects.clear();
+		_dirtyRects.push_back(*_dirtyRect);
+	}
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -369,7 +419,7 @@ void BaseRenderOSystem::drawTickets() {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
 			it = _renderQueue.erase(it);
-			delete ticket;
+			releaseTicket(ticket);
 		} else {
 			++it;
 		}
@@ -389,38 +439,45 @@ void BaseRenderOSystem::drawTickets() {
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
+	RenderTicket *soleOpaqueTicket = nullptr;
 	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		soleOpaqueTicket = *it;
+	}
+
+	// Compose each dirty region separately, so a stable scene with a couple
+	// of small changes only redraws those areas.
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+		// If our single opaque rect covers the dirty rect, we can skip filling.
+		if (!soleOpaqueTicket || !soleOpaqueTicket->_dstRect.contains(dirtyRect)) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
-	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+			RenderTicket *ticket = *it;
+			if (ticket->_dstRect.intersects(dirtyRect)) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty rect
+				dstClip.clip(dirtyRect);
+				// we need to keep track of the position to redraw the dirty rect
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+			}
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
-		ticket->_wantsDraw = false;
+		g_system->copyRectToScreen(_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+	}
+
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen(_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -429,7 +486,7 @@ void BaseRenderOSystem::drawTickets() {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
 			it = _renderQueue.erase(it);
-			delete ticket;
+			releaseTicket(ticket);
 		} else {
 			++it;
 		}
@@ -530,7 +587,7 @@ void BaseRenderOSystem::endSaveLoad() {
 	while (it != _renderQueue.end()) {
 		RenderTicket *ticket = *it;
 		it = _renderQueue.erase(it);
-		delete ticket;
+		releaseTicket(ticket);
 	}
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
@@ -30,6 +30,7 @@
 
 #include "engines/wintermute/base/gfx/base_renderer.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 #include "common/list.h"
 
@@ -127,8 +128,17 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
+	/**
+	 * Get a ticket for a draw-call, reusing a pooled one when possible.
+	 * Same arguments as the RenderTicket-constructor.
+	 */
+	RenderTicket *getTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
+	/** Return a retired ticket to the pool (or delete it if the pool is full). */
+	void releaseTicket(RenderTicket *ticket);
 	Common::Rect *_dirtyRect;
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	Common::Array<RenderTicket *> _ticketPool;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
@@ -44,6 +44,14 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	        _isValid(true),
 	        _wantsDraw(true),
 	        _transform(transform) {
+	copySurface(surf, srcRect, dstRect);
+}
+
+RenderTicket::~RenderTicket() {
+	freeSurface();
+}
+
+void RenderTicket::copySurface(const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect) {
 	if (surf) {
 		assert(surf->format.bytesPerPixel == 4);
 
@@ -59,11 +67,11 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 		// (Mirroring should most likely be done before rotation. See also
 		// TransformTools.)
 		if (_transform._angle != Graphics::kDefaultAngle) {
-			_surface = temp.rotoscale(transform, owner->_gameRef->getBilinearFiltering());
+			_surface = temp.rotoscale(_transform, _owner->_gameRef->getBilinearFiltering());
 		} else if ((dstRect->width() != srcRect->width() ||
 			    dstRect->height() != srcRect->height()) &&
 			    _transform._numTimesX * _transform._numTimesY == 1) {
-			_surface = temp.scale(dstRect->width(), dstRect->height(), owner->_gameRef->getBilinearFiltering());
+			_surface = temp.scale(dstRect->width(), dstRect->height(), _owner->_gameRef->getBilinearFiltering());
 		} else {
 			_surface = new Graphics::Surface();
 			_surface->copyFrom(temp);
@@ -73,10 +81,23 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	}
 }
 
-RenderTicket::~RenderTicket() {
+void RenderTicket::recycle(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
+                           Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) {
+	freeSurface();
+	_owner = owner;
+	_srcRect = *srcRect;
+	_dstRect = *dstRect;
+	_isValid = true;
+	_wantsDraw = true;
+	_transform = transform;
+	copySurface(surf, srcRect, dstRect);
+}
+
+void RenderTicket::freeSurface() {
 	if (_surface) {
 		_surface->free();
 		delete _surface;
+		_surface = nullptr;
 	}
 }
 
@@ -91,6 +112,14 @@ bool RenderTicket::operator==(const RenderTicket &t) const {
 	return true;
 }
 
+bool RenderTicket::matches(const BaseSurfaceOSystem *owner, const Common::Rect *srcRect,
+                           const Common::Rect *dstRect, const Graphics::TransformStruct &transform) const {
+	return (_owner == owner) &&
+		(_transform == transform) &&
+		(_dstRect == *dstRect) &&
+		(_srcRect == *srcRect);
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void RenderTicket::drawToSurface(Graphics::ManagedSurface *_targetSurface) const {
 	if (!getSurface()) {
@@ -51,8 +51,16 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _owner(nullptr), _surface(nullptr) {}
 	~RenderTicket();
+	/**
+	 * Re-initialize a pooled ticket in-place, as if it had just been
+	 * constructed with these arguments, dropping any pixel data held over
+	 * from the ticket's previous use.
+	 */
+	void recycle(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform);
+	/** Drop the internal copy of the pixel data, keeping the ticket itself reusable. */
+	void freeSurface();
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
 	void drawToSurface(Graphics::ManagedSurface *_targetSurface) const;
@@ -68,8 +76,12 @@ public:
 
 	BaseSurfaceOSystem *_owner;
 	bool operator==(const RenderTicket &a) const;
+	/** Like operator==, but without the need to construct a throwaway ticket. */
+	bool matches(const BaseSurfaceOSystem *owner, const Common::Rect *srcRect, const Common::Rect *dstRect, const Graphics::TransformStruct &transform) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
 private:
+	void copySurface(const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect);
+
 	Graphics::Surface *_surface;
 	Common::Rect _srcRect;
 };
@@ -156,9 +156,12 @@ void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcB
 				splitColor(sourceBuffer[srcIndexYT * _numColumns + srcIndexXR], rTR, gTR, bTR);
 				splitColor(sourceBuffer[srcIndexYB * _numColumns + srcIndexXL], rBL, gBL, bBL);
 				splitColor(sourceBuffer[srcIndexYB * _numColumns + srcIndexXR], rBR, gBR, bBR);
-				const uint32 rF = curP._fTL * rTL + curP._fTR * rTR + curP._fBL * rBL + curP._fBR * rBR;
-				const uint32 gF = curP._fTL * gTL + curP._fTR * gTR + curP._fBL * gBL + curP._fBR * gBR;
-				const uint32 bF = curP._fTL * bTL + curP._fTR * bTR + curP._fBL * bBL + curP._fBR * bBR;
+				// Integer filtering: the weights are 16.16 fixed point and sum
+				// to 1 << 16, and the largest channel value is 0x7c00, so the
+				// sums stay well within 32 bits.
+				const uint32 rF = (curP._iTL * rTL + curP._iTR * rTR + curP._iBL * rBL + curP._iBR * rBR) >> 16;
+				const uint32 gF = (curP._iTL * gTL + curP._iTR * gTR + curP._iBL * gBL + curP._iBR * gBR) >> 16;
+				const uint32 bF = (curP._iTL * bTL + curP._iTR * bTR + curP._iBL * bBL + curP._iBR * bBR) >> 16;
 				destBuffer[destOffset] = mergeColor(rF, gF, bF);
 				destOffset++;
 			}
@@ -37,7 +37,8 @@ public:
 	Common::Rect _src = Common::Rect(0, 0); // Coordinates of four panorama image pixels around actual working window pixel
 
 	float _fX, _fY, _fTL, _fTR, _fBL, _fBR;
-	
+	uint32 _iTL, _iTR, _iBL, _iBR; // 16.16 fixed point bilinear weights, summing to exactly 1 << 16
+
 	FilterPixel() {}
 	FilterPixel(float x, float y, bool highQuality = false) {
 		_src.left = int16(floor(x));
@@ -51,6 +52,15 @@ public:
 			_fTR = _fX * (1 - _fY);
 			_fBL = (1 - _fX) * _fY;
 			_fBR = _fX * _fY;
+			// Fixed point weights for the integer filtering loop in
+			// mutateImage(); products of two 0..256 factors, so the four
+			// always sum to exactly 1 << 16.
+			const uint32 iX = (uint32)(_fX * 256.0f + 0.5f);
+			const uint32 iY = (uint32)(_fY * 256.0f + 0.5f);
+			_iTL = (256 - iX) * (256 - iY);
+			_iTR = iX * (256 - iY);
+			_iBL = (256 - iX) * iY;
+			_iBR = iX * iY;
 		} else {
 			// Nearest neighbour
 			_xDir = (x - _src.left) > 0.5f;
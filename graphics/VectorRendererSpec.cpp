@@ -659,15 +659,33 @@ gradientFill(PixelType *ptr, int width, int x, int y) {
 	} else if (grad == 3 && ox) {
 		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			bool oy = ((j & 1) == 1);
+		// The dither pattern resolves to at most two colors per row, one
+		// for even and one for odd columns, so pick them once and fill
+		// without any per-pixel branching
+		PixelType colorEven, colorOdd;
+		if (grad == 2) {
+			colorEven = colorOdd = (ox ? _gradCache[curGrad + 1] : _gradCache[curGrad]);
+		} else if ((grad == 1 && ox) || (grad == 3 && !ox)) {
+			colorEven = _gradCache[curGrad];
+			colorOdd = _gradCache[curGrad + 1];
+		} else {
+			colorEven = colorOdd = _gradCache[curGrad];
+		}
 
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
+		if (colorEven == colorOdd) {
+			colorFill<PixelType>(ptr, ptr + width, colorEven);
+		} else {
+			int j = x;
+			if ((j & 1) && j < x + width) {
+				*ptr++ = colorOdd;
+				j++;
+			}
+			for (; j + 1 < x + width; j += 2, ptr += 2) {
+				ptr[0] = colorEven;
+				ptr[1] = colorOdd;
+			}
+			if (j < x + width)
+				*ptr = colorEven;
 		}
 	}
 }
@@ -701,16 +719,38 @@ gradientFillClip(PixelType *ptr, int width, int x, int y, int realX, int realY)
 	} else if (grad == 3 && ox) {
 		colorFillClip<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1], realX, realY, _clippingArea);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			if (realX + j - x < _clippingArea.left || realX + j - x >= _clippingArea.right) continue;
-			bool oy = ((j & 1) == 1);
-
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
+		// As in gradientFill, resolve the dither pattern to the even and
+		// odd column colors once, and clamp the loop to the horizontally
+		// visible range instead of testing every pixel against the clip
+		// rect
+		PixelType colorEven, colorOdd;
+		if (grad == 2) {
+			colorEven = colorOdd = (ox ? _gradCache[curGrad + 1] : _gradCache[curGrad]);
+		} else if ((grad == 1 && ox) || (grad == 3 && !ox)) {
+			colorEven = _gradCache[curGrad];
+			colorOdd = _gradCache[curGrad + 1];
+		} else {
+			colorEven = colorOdd = _gradCache[curGrad];
+		}
+
+		int j = MAX(x, x + (_clippingArea.left - realX));
+		int jEnd = MIN(x + width, x + (_clippingArea.right - realX));
+		ptr += j - x;
+
+		if (colorEven == colorOdd) {
+			if (j < jEnd)
+				colorFill<PixelType>(ptr, ptr + (jEnd - j), colorEven);
+		} else {
+			if ((j & 1) && j < jEnd) {
+				*ptr++ = colorOdd;
+				j++;
+			}
+			for (; j + 1 < jEnd; j += 2, ptr += 2) {
+				ptr[0] = colorEven;
+				ptr[1] = colorOdd;
+			}
+			if (j < jEnd)
+				*ptr = colorEven;
 		}
 	}
 }
@@ -897,6 +937,41 @@ blendPixelPtrClip(PixelType *ptr, PixelType color, uint8 alpha, int x, int y) {
 		blendPixelPtr(ptr, color, alpha);
 }
 
+template<typename PixelType>
+void VectorRendererSpec<PixelType>::
+blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
+	if (alpha == 0xff) {
+		// Fully opaque: degenerates to a plain fill
+		colorFill<PixelType>(first, last, color | _alphaMask);
+	} else if (sizeof(PixelType) == 4) {
+		// Same blend as blendPixelPtr, with the source channels, which
+		// are constant for the whole run, extracted only once
+		const byte sR = (color & _redMask) >> _format.rShift;
+		const byte sG = (color & _greenMask) >> _format.gShift;
+		const byte sB = (color & _blueMask) >> _format.bShift;
+
+		for (; first < last; first++) {
+			byte dR = (*first & _redMask) >> _format.rShift;
+			byte dG = (*first & _greenMask) >> _format.gShift;
+			byte dB = (*first & _blueMask) >> _format.bShift;
+			byte dA = (*first & _alphaMask) >> _format.aShift;
+
+			dR += ((sR - dR) * alpha) >> 8;
+			dG += ((sG - dG) * alpha) >> 8;
+			dB += ((sB - dB) * alpha) >> 8;
+			dA += ((0xff - dA) * alpha) >> 8;
+
+			*first = ((dR << _format.rShift) & _redMask)
+			       | ((dG << _format.gShift) & _greenMask)
+			       | ((dB << _format.bShift) & _blueMask)
+			       | ((dA << _format.aShift) & _alphaMask);
+		}
+	} else {
+		while (first < last)
+			blendPixelPtr(first++, color, alpha);
+	}
+}
+
 template<typename PixelType>
 inline void VectorRendererSpec<PixelType>::
 blendPixelDestAlphaPtr(PixelType *ptr, PixelType color, uint8 alpha) {
@@ -103,12 +103,20 @@ template <class T> bool Big5Font::drawReal(byte *dest, uint16 textChar, int maxX
 		T *cur = (T*) (dest + y * destPitch);
 		T *curMax = cur + maxX;
 
-		for (int byte = 0; byte < 2; byte++)
+		for (int byte = 0; byte < 2; byte++) {
+			// Glyphs are mostly transparent; step over all 8 pixels of an
+			// empty byte at once.
+			if (curMax - cur >= 8 && !glyph.bitmap[y][byte] && !(outline && glyph.outline[y][byte])) {
+				cur += 8;
+				continue;
+			}
+
 			for (int bit = 0; bit < 8 && cur < curMax; bit++, cur++)
 				if ((glyph.bitmap[y][byte] << bit) & 0x80)
 					*cur = color;
 				else if (outline && (((glyph.outline[y][byte] << bit) & 0x80)))
 					*cur = outlineColor;
+		}
 	}
 	return true;
 }
@@ -200,6 +200,14 @@ bool crossBlitMap(byte *dst, const byte *src,
 			   const uint w, const uint h,
 			   const uint bytesPerPixel, const uint32 *map);
 
+#ifdef SCUMMVM_AVX2
+// Gather-based 8bpp -> 32bpp palette expansion, see graphics/blit/blit-avx2.cpp.
+// Walks forward, so it must not be used when dst and src overlap.
+void crossBlitMap8To32AVX2(byte *dst, const byte *src,
+			   const uint dstPitch, const uint srcPitch,
+			   const uint w, const uint h, const uint32 *map);
+#endif
+
 bool crossKeyBlitMap(byte *dst, const byte *src,
 			   const uint dstPitch, const uint srcPitch,
 			   const uint w, const uint h,
@@ -317,6 +325,15 @@ private:
 	typedef void(*BlitFunc)(Args &, const TSpriteBlendMode &, const AlphaType &);
 	static BlitFunc blitFunc;
 
+#ifdef SCUMMVM_NEON
+	static void fillNEON(Args &args, const TSpriteBlendMode &blendMode);
+#endif
+#ifdef SCUMMVM_SSE2
+	static void fillSSE2(Args &args, const TSpriteBlendMode &blendMode);
+#endif
+#ifdef SCUMMVM_AVX2
+	static void fillAVX2(Args &args, const TSpriteBlendMode &blendMode);
+#endif
 	static void fillGeneric(Args &args, const TSpriteBlendMode &blendMode);
 	template<class T>
 	static void fillT(Args &args, const TSpriteBlendMode &blendMode);
@@ -86,6 +86,31 @@ public:
 		src = _mm256_andnot_si256(alphaMask, src);
 		return _mm256_or_si256(dst, src);
 	}
+
+	inline __m256i simdFill(__m256i dst) const {
+		const uint32 ina = this->ca;
+		const __m256i hold = _mm256_set1_epi32(255 - ina);
+
+		__m256i dstB = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		__m256i dstG = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		__m256i dstR = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		if (rgbmod) {
+			dstB = _mm256_add_epi32(_mm256_srli_epi32(_mm256_mullo_epi16(dstB, hold), 8), _mm256_set1_epi32(255 * ina * this->cb >> 16));
+			dstG = _mm256_add_epi32(_mm256_srli_epi32(_mm256_mullo_epi16(dstG, hold), 8), _mm256_set1_epi32(255 * ina * this->cg >> 16));
+			dstR = _mm256_add_epi32(_mm256_srli_epi32(_mm256_mullo_epi16(dstR, hold), 8), _mm256_set1_epi32(255 * ina * this->cr >> 16));
+		} else {
+			const __m256i full = _mm256_set1_epi32(255 * ina);
+			dstB = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(dstB, hold), full), 8);
+			dstG = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(dstG, hold), full), 8);
+			dstR = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(dstR, hold), full), 8);
+		}
+
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstB, BlendBlit::kBModShift), _mm256_set1_epi32(BlendBlit::kBModMask)), _mm256_set1_epi32(BlendBlit::kAModMask));
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstG, BlendBlit::kGModShift), _mm256_set1_epi32(BlendBlit::kGModMask)), dst);
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstR, BlendBlit::kRModShift), _mm256_set1_epi32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -135,6 +160,40 @@ public:
 		src = _mm256_andnot_si256(alphaMask, src);
 		return _mm256_or_si256(dst, src);
 	}
+
+	inline __m256i simdFill(__m256i dst) const {
+		const uint32 ina = this->ca;
+		if (ina == 0 || (ina == 255 && !rgbmod))
+			return dst;
+
+		uint32 fb, fg, fr;
+		if (ina == 255) {
+			fb = this->cb;
+			fg = this->cg;
+			fr = this->cr;
+		} else if (rgbmod) {
+			fb = (this->cb * ina) >> 8;
+			fg = (this->cg * ina) >> 8;
+			fr = (this->cr * ina) >> 8;
+		} else {
+			fb = fg = fr = ina;
+		}
+
+		__m256i dstB = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		__m256i dstG = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		__m256i dstR = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		dstB = _mm256_srli_epi32(_mm256_mullo_epi16(dstB, _mm256_set1_epi32(fb)), 8);
+		dstG = _mm256_srli_epi32(_mm256_mullo_epi16(dstG, _mm256_set1_epi32(fg)), 8);
+		dstR = _mm256_srli_epi32(_mm256_mullo_epi16(dstR, _mm256_set1_epi32(fr)), 8);
+
+		// The alpha channel is left untouched, like in the scalar version
+		dst = _mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kAModMask));
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstB, BlendBlit::kBModShift), _mm256_set1_epi32(BlendBlit::kBModMask)), dst);
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstG, BlendBlit::kGModShift), _mm256_set1_epi32(BlendBlit::kGModMask)), dst);
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstR, BlendBlit::kRModShift), _mm256_set1_epi32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -215,6 +274,27 @@ public:
 		src = _mm256_andnot_si256(alphaMask, src);
 		return _mm256_or_si256(dst, src);
 	}
+
+	inline __m256i simdFill(__m256i dst) const {
+		const uint32 ina = this->ca;
+		if (ina == 0)
+			return dst;
+
+		uint32 kb, kg, kr;
+		if (ina == 255) {
+			kb = rgbmod ? this->cb : 255;
+			kg = rgbmod ? this->cg : 255;
+			kr = rgbmod ? this->cr : 255;
+		} else {
+			kb = rgbmod ? ((this->cb * ina) >> 8) : ina;
+			kg = rgbmod ? ((this->cg * ina) >> 8) : ina;
+			kr = rgbmod ? ((this->cr * ina) >> 8) : ina;
+		}
+
+		// Per-byte wrapping add, matching the scalar version's byte stores;
+		// the alpha byte of the constant is zero so the channel is kept
+		return _mm256_add_epi8(dst, _mm256_set1_epi32((kr << BlendBlit::kRModShift) | (kg << BlendBlit::kGModShift) | (kb << BlendBlit::kBModShift)));
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -237,6 +317,27 @@ public:
 
 		return _mm256_or_si256(_mm256_set1_epi32(BlendBlit::kAModMask), _mm256_or_si256(srcb, _mm256_or_si256(srcg, srcr)));
 	}
+
+	inline __m256i simdFill(__m256i dst) const {
+		if (!rgbmod) {
+			// The scalar version zeroes the color channels and sets full alpha
+			return _mm256_set1_epi32(BlendBlit::kAModMask);
+		}
+
+		__m256i dstB = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		__m256i dstG = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		__m256i dstR = _mm256_srli_epi32(_mm256_and_si256(dst, _mm256_set1_epi32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		// out -= (c * out) >> 8 can never go below zero, so no clamp is needed
+		dstB = _mm256_sub_epi32(dstB, _mm256_srli_epi32(_mm256_mullo_epi16(dstB, _mm256_set1_epi32(this->cb)), 8));
+		dstG = _mm256_sub_epi32(dstG, _mm256_srli_epi32(_mm256_mullo_epi16(dstG, _mm256_set1_epi32(this->cg)), 8));
+		dstR = _mm256_sub_epi32(dstR, _mm256_srli_epi32(_mm256_mullo_epi16(dstR, _mm256_set1_epi32(this->cr)), 8));
+
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstB, BlendBlit::kBModShift), _mm256_set1_epi32(BlendBlit::kBModMask)), _mm256_set1_epi32(BlendBlit::kAModMask));
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstG, BlendBlit::kGModShift), _mm256_set1_epi32(BlendBlit::kGModMask)), dst);
+		dst = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(dstR, BlendBlit::kRModShift), _mm256_set1_epi32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 public:
@@ -315,12 +416,67 @@ static void blitInnerLoop(BlendBlit::Args &args) {
 	}
 }
 
+template<template <bool RGBMOD, bool ALPHAMOD> class PixelFunc, bool rgbmod, bool alphamod>
+static void fillInnerLoop(BlendBlit::Args &args) {
+	byte *out;
+
+	const PixelFunc<rgbmod, alphamod> pixelFunc(args.color);
+
+	for (uint32 i = 0; i < args.height; i++) {
+		out = args.outo;
+
+		uint32 j = 0;
+		for (; j + 8 <= args.width; j += 8) {
+			const __m256i dstPixels = _mm256_loadu_si256((const __m256i *)out);
+			_mm256_storeu_si256((__m256i *)out, pixelFunc.simdFill(dstPixels));
+			out += 4ULL * 8;
+		}
+		for (; j < args.width; j++) {
+			pixelFunc.fill(out);
+
+			out += 4;
+		}
+		args.outo += args.dstPitch;
+	}
+}
+
 }; // end of class BlendBlitImpl_AVX2
 
 void BlendBlit::blitAVX2(Args &args, const TSpriteBlendMode &blendMode, const AlphaType &alphaType) {
 	blitT<BlendBlitImpl_AVX2>(args, blendMode, alphaType);
 }
 
+void BlendBlit::fillAVX2(Args &args, const TSpriteBlendMode &blendMode) {
+	fillT<BlendBlitImpl_AVX2>(args, blendMode);
+}
+
+// 8bpp -> 32bpp palette expansion: one gather replaces eight scalar table
+// lookups of the pre-converted map. Only used for non-overlapping buffers,
+// see crossBlitMap().
+void crossBlitMap8To32AVX2(byte *dst, const byte *src,
+						   const uint dstPitch, const uint srcPitch,
+						   const uint w, const uint h, const uint32 *map) {
+	const uint srcDelta = srcPitch - w;
+	const uint dstDelta = dstPitch - w * 4;
+
+	for (uint y = 0; y < h; ++y) {
+		uint x = w;
+		for (; x >= 8; x -= 8) {
+			const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)src));
+			_mm256_storeu_si256((__m256i *)dst, _mm256_i32gather_epi32((const int *)map, indices, 4));
+			src += 8;
+			dst += 32;
+		}
+		for (; x > 0; --x) {
+			*(uint32 *)dst = map[*src];
+			src += 1;
+			dst += 4;
+		}
+		src += srcDelta;
+		dst += dstDelta;
+	}
+}
+
 } // End of namespace Graphics
 
 #if defined(__clang__)
@@ -54,10 +54,145 @@ static void swapBlit(byte *dst, const byte *src,
 	}
 }
 
+// Byte index of a color channel inside a pixel, given its bit shift.
+#ifdef SCUMM_BIG_ENDIAN
+#define CHAN_BYTE_24(shift) (2 - (shift) / 8)
+#define CHAN_BYTE_32(shift) (3 - (shift) / 8)
+#else
+#define CHAN_BYTE_24(shift) ((shift) / 8)
+#define CHAN_BYTE_32(shift) ((shift) / 8)
+#endif
+
+template<int sR, int sG, int sB, int dR, int dG, int dB, int dA>
+static void expandBlit(byte *dst, const byte *src,
+                       const uint dstPitch, const uint srcPitch,
+                       const uint w, const uint h) {
+	// Blit from bottom right to top left, so that converting a buffer
+	// to a wider format in place never overwrites unread source pixels.
+	src += (h - 1) * srcPitch + (w - 1) * 3;
+	dst += (h - 1) * dstPitch + (w - 1) * 4;
+
+	for (uint y = 0; y < h; ++y) {
+		const byte *s = src;
+		byte *d = dst;
+		for (uint x = 0; x < w; ++x) {
+			const byte r = s[sR], g = s[sG], b = s[sB];
+			d[dR] = r;
+			d[dG] = g;
+			d[dB] = b;
+			d[dA] = 0xff;
+			s -= 3;
+			d -= 4;
+		}
+		src -= srcPitch;
+		dst -= dstPitch;
+	}
+}
+
+template<int sR, int sG, int sB, int dR, int dG, int dB>
+static void shrinkBlit(byte *dst, const byte *src,
+                       const uint dstPitch, const uint srcPitch,
+                       const uint w, const uint h) {
+	const uint srcDelta = (srcPitch - w * 4);
+	const uint dstDelta = (dstPitch - w * 3);
+
+	for (uint y = 0; y < h; ++y) {
+		for (uint x = 0; x < w; ++x) {
+			const byte r = src[sR], g = src[sG], b = src[sB];
+			dst[dR] = r;
+			dst[dG] = g;
+			dst[dB] = b;
+			src += 4;
+			dst += 3;
+		}
+		src += srcDelta;
+		dst += dstDelta;
+	}
+}
+
+// Compile-time counterpart of the PixelFormat fields crossBlit() reads:
+// the channel bit counts and shifts are baked into the type. An alpha bit
+// count of 0 marks a missing alpha channel, which reads back as opaque,
+// just like PixelFormat::colorToARGB().
+template<typename Pixel,
+         int rBits, int gBits, int bBits, int aBits,
+         int rShift, int gShift, int bShift, int aShift>
+struct PixelLayout {
+	typedef Pixel PixelType;
+
+	static inline void colorToARGB(uint32 color, byte &a, byte &r, byte &g, byte &b) {
+		a = (aBits == 0) ? 0xFF : ColorComponent<aBits>::expand(color >> aShift);
+		r = ColorComponent<rBits>::expand(color >> rShift);
+		g = ColorComponent<gBits>::expand(color >> gShift);
+		b = ColorComponent<bBits>::expand(color >> bShift);
+	}
+
+	static inline uint32 ARGBToColor(byte a, byte r, byte g, byte b) {
+		return ((a >> (8 - aBits)) << aShift) |
+		       ((r >> (8 - rBits)) << rShift) |
+		       ((g >> (8 - gBits)) << gShift) |
+		       ((b >> (8 - bBits)) << bShift);
+	}
+};
+
+// Format conversion with every shift and channel width known at compile
+// time. The channel math matches PixelFormat::colorToARGB() and
+// ARGBToColor() bit for bit, so these kernels are drop-in replacements
+// for the format-generic crossBlit() loop. Widening conversions run from
+// bottom right to top left, so converting a buffer in place never
+// overwrites unread source pixels.
+template<typename SrcLayout, typename DstLayout>
+static void convBlit(byte *dst, const byte *src,
+                     const uint dstPitch, const uint srcPitch,
+                     const uint w, const uint h) {
+	typedef typename SrcLayout::PixelType SrcType;
+	typedef typename DstLayout::PixelType DstType;
+	const bool backward = sizeof(DstType) > sizeof(SrcType);
+
+	if (backward) {
+		src += (h - 1) * srcPitch + (w - 1) * sizeof(SrcType);
+		dst += (h - 1) * dstPitch + (w - 1) * sizeof(DstType);
+	}
+
+	for (uint y = 0; y < h; ++y) {
+		const SrcType *s = (const SrcType *)src;
+		DstType *d = (DstType *)dst;
+		for (uint x = 0; x < w; ++x) {
+			byte a, r, g, b;
+			SrcLayout::colorToARGB(*s, a, r, g, b);
+			*d = (DstType)DstLayout::ARGBToColor(a, r, g, b);
+			if (backward) {
+				--s;
+				--d;
+			} else {
+				++s;
+				++d;
+			}
+		}
+		if (backward) {
+			src -= srcPitch;
+			dst -= dstPitch;
+		} else {
+			src += srcPitch;
+			dst += dstPitch;
+		}
+	}
+}
+
+// The 16-bit layouts engines and backends actually negotiate, plus the
+// four 32-bit byte orders. Template arguments follow the PixelFormat
+// constructor: bit counts, then shifts.
+typedef PixelLayout<uint16, 5, 6, 5, 0, 11,  5,  0,  0> RGB565_Layout;
+typedef PixelLayout<uint16, 5, 5, 5, 0, 10,  5,  0,  0> RGB555_Layout;
+typedef PixelLayout<uint16, 5, 5, 5, 1, 10,  5,  0, 15> ARGB1555_Layout;
+typedef PixelLayout<uint16, 5, 5, 5, 1, 11,  6,  1,  0> RGBA5551_Layout;
+typedef PixelLayout<uint32, 8, 8, 8, 8, 16,  8,  0, 24> ARGB8888_Layout;
+typedef PixelLayout<uint32, 8, 8, 8, 8,  0,  8, 16, 24> ABGR8888_Layout;
+typedef PixelLayout<uint32, 8, 8, 8, 8, 24, 16,  8,  0> RGBA8888_Layout;
+typedef PixelLayout<uint32, 8, 8, 8, 8,  8, 16, 24,  0> BGRA8888_Layout;
+
 } // End of anonymous namespace
 
-// TODO: Add fast 24<->32bpp conversion
-// TODO: Add fast 16<->16bpp conversion
 struct FastBlitLookup {
 	FastBlitFunc func;
 	Graphics::PixelFormat srcFmt, dstFmt;
@@ -87,6 +222,85 @@ static const FastBlitLookup fastBlitFuncs_4to4[] = {
 	{ swapBlit<true,  24>, Graphics::PixelFormat(4, 8, 8, 8, 8,  8, 16, 24,  0), Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16,  8,  0) }  // BGRA8888 -> RGBA8888
 };
 
+// 24 -> 32 bit expansion; the destination alpha channel is set to opaque.
+// The plain byte-shuffle loops are simple enough for the compiler's
+// vectorizer, so no per-ISA kernels are needed here.
+static const FastBlitLookup fastBlitFuncs_3to4[] = {
+	{ expandBlit<CHAN_BYTE_24(16), CHAN_BYTE_24(8), CHAN_BYTE_24(0), CHAN_BYTE_32(16), CHAN_BYTE_32(8), CHAN_BYTE_32(0), CHAN_BYTE_32(24)>,
+	  Graphics::PixelFormat(3, 8, 8, 8, 0, 16,  8,  0,  0), Graphics::PixelFormat(4, 8, 8, 8, 8, 16,  8,  0, 24) }, // RGB888 -> ARGB8888
+	{ expandBlit<CHAN_BYTE_24(16), CHAN_BYTE_24(8), CHAN_BYTE_24(0), CHAN_BYTE_32(0), CHAN_BYTE_32(8), CHAN_BYTE_32(16), CHAN_BYTE_32(24)>,
+	  Graphics::PixelFormat(3, 8, 8, 8, 0, 16,  8,  0,  0), Graphics::PixelFormat(4, 8, 8, 8, 8,  0,  8, 16, 24) }, // RGB888 -> ABGR8888
+	{ expandBlit<CHAN_BYTE_24(16), CHAN_BYTE_24(8), CHAN_BYTE_24(0), CHAN_BYTE_32(24), CHAN_BYTE_32(16), CHAN_BYTE_32(8), CHAN_BYTE_32(0)>,
+	  Graphics::PixelFormat(3, 8, 8, 8, 0, 16,  8,  0,  0), Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16,  8,  0) }, // RGB888 -> RGBA8888
+	{ expandBlit<CHAN_BYTE_24(16), CHAN_BYTE_24(8), CHAN_BYTE_24(0), CHAN_BYTE_32(8), CHAN_BYTE_32(16), CHAN_BYTE_32(24), CHAN_BYTE_32(0)>,
+	  Graphics::PixelFormat(3, 8, 8, 8, 0, 16,  8,  0,  0), Graphics::PixelFormat(4, 8, 8, 8, 8,  8, 16, 24,  0) }, // RGB888 -> BGRA8888
+	{ expandBlit<CHAN_BYTE_24(0), CHAN_BYTE_24(8), CHAN_BYTE_24(16), CHAN_BYTE_32(16), CHAN_BYTE_32(8), CHAN_BYTE_32(0), CHAN_BYTE_32(24)>,
+	  Graphics::PixelFormat(3, 8, 8, 8, 0,  0,  8, 16,  0), Graphics::PixelFormat(4, 8, 8, 8, 8, 16,  8,  0, 24) }, // BGR888 -> ARGB8888
+	{ expandBlit<CHAN_BYTE_24(0), CHAN_BYTE_24(8), CHAN_BYTE_24(16), CHAN_BYTE_32(0), CHAN_BYTE_32(8), CHAN_BYTE_32(16), CHAN_BYTE_32(24)>,
+	  Graphics::PixelFormat(3, 8, 8, 8, 0,  0,  8, 16,  0), Graphics::PixelFormat(4, 8, 8, 8, 8,  0,  8, 16, 24) }, // BGR888 -> ABGR8888
+	{ expandBlit<CHAN_BYTE_24(0), CHAN_BYTE_24(8), CHAN_BYTE_24(16), CHAN_BYTE_32(24), CHAN_BYTE_32(16), CHAN_BYTE_32(8), CHAN_BYTE_32(0)>,
+	  Graphics::PixelFormat(3, 8, 8, 8, 0,  0,  8, 16,  0), Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16,  8,  0) }, // BGR888 -> RGBA8888
+	{ expandBlit<CHAN_BYTE_24(0), CHAN_BYTE_24(8), CHAN_BYTE_24(16), CHAN_BYTE_32(8), CHAN_BYTE_32(16), CHAN_BYTE_32(24), CHAN_BYTE_32(0)>,
+	  Graphics::PixelFormat(3, 8, 8, 8, 0,  0,  8, 16,  0), Graphics::PixelFormat(4, 8, 8, 8, 8,  8, 16, 24,  0) }  // BGR888 -> BGRA8888
+};
+
+// 32 -> 24 bit truncation, dropping the alpha channel.
+static const FastBlitLookup fastBlitFuncs_4to3[] = {
+	{ shrinkBlit<CHAN_BYTE_32(16), CHAN_BYTE_32(8), CHAN_BYTE_32(0), CHAN_BYTE_24(16), CHAN_BYTE_24(8), CHAN_BYTE_24(0)>,
+	  Graphics::PixelFormat(4, 8, 8, 8, 8, 16,  8,  0, 24), Graphics::PixelFormat(3, 8, 8, 8, 0, 16,  8,  0,  0) }, // ARGB8888 -> RGB888
+	{ shrinkBlit<CHAN_BYTE_32(0), CHAN_BYTE_32(8), CHAN_BYTE_32(16), CHAN_BYTE_24(16), CHAN_BYTE_24(8), CHAN_BYTE_24(0)>,
+	  Graphics::PixelFormat(4, 8, 8, 8, 8,  0,  8, 16, 24), Graphics::PixelFormat(3, 8, 8, 8, 0, 16,  8,  0,  0) }, // ABGR8888 -> RGB888
+	{ shrinkBlit<CHAN_BYTE_32(24), CHAN_BYTE_32(16), CHAN_BYTE_32(8), CHAN_BYTE_24(16), CHAN_BYTE_24(8), CHAN_BYTE_24(0)>,
+	  Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16,  8,  0), Graphics::PixelFormat(3, 8, 8, 8, 0, 16,  8,  0,  0) }, // RGBA8888 -> RGB888
+	{ shrinkBlit<CHAN_BYTE_32(8), CHAN_BYTE_32(16), CHAN_BYTE_32(24), CHAN_BYTE_24(16), CHAN_BYTE_24(8), CHAN_BYTE_24(0)>,
+	  Graphics::PixelFormat(4, 8, 8, 8, 8,  8, 16, 24,  0), Graphics::PixelFormat(3, 8, 8, 8, 0, 16,  8,  0,  0) }, // BGRA8888 -> RGB888
+	{ shrinkBlit<CHAN_BYTE_32(16), CHAN_BYTE_32(8), CHAN_BYTE_32(0), CHAN_BYTE_24(0), CHAN_BYTE_24(8), CHAN_BYTE_24(16)>,
+	  Graphics::PixelFormat(4, 8, 8, 8, 8, 16,  8,  0, 24), Graphics::PixelFormat(3, 8, 8, 8, 0,  0,  8, 16,  0) }, // ARGB8888 -> BGR888
+	{ shrinkBlit<CHAN_BYTE_32(0), CHAN_BYTE_32(8), CHAN_BYTE_32(16), CHAN_BYTE_24(0), CHAN_BYTE_24(8), CHAN_BYTE_24(16)>,
+	  Graphics::PixelFormat(4, 8, 8, 8, 8,  0,  8, 16, 24), Graphics::PixelFormat(3, 8, 8, 8, 0,  0,  8, 16,  0) }, // ABGR8888 -> BGR888
+	{ shrinkBlit<CHAN_BYTE_32(24), CHAN_BYTE_32(16), CHAN_BYTE_32(8), CHAN_BYTE_24(0), CHAN_BYTE_24(8), CHAN_BYTE_24(16)>,
+	  Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16,  8,  0), Graphics::PixelFormat(3, 8, 8, 8, 0,  0,  8, 16,  0) }, // RGBA8888 -> BGR888
+	{ shrinkBlit<CHAN_BYTE_32(8), CHAN_BYTE_32(16), CHAN_BYTE_32(24), CHAN_BYTE_24(0), CHAN_BYTE_24(8), CHAN_BYTE_24(16)>,
+	  Graphics::PixelFormat(4, 8, 8, 8, 8,  8, 16, 24,  0), Graphics::PixelFormat(3, 8, 8, 8, 0,  0,  8, 16,  0) }  // BGRA8888 -> BGR888
+};
+
+// Runtime formats served by the convBlit instantiations; these have to
+// stay in sync with the layout typedefs above.
+#define RGB565_FMT   Graphics::PixelFormat(2, 5, 6, 5, 0, 11,  5,  0,  0)
+#define RGB555_FMT   Graphics::PixelFormat(2, 5, 5, 5, 0, 10,  5,  0,  0)
+#define ARGB1555_FMT Graphics::PixelFormat(2, 5, 5, 5, 1, 10,  5,  0, 15)
+#define RGBA5551_FMT Graphics::PixelFormat(2, 5, 5, 5, 1, 11,  6,  1,  0)
+#define ARGB8888_FMT Graphics::PixelFormat(4, 8, 8, 8, 8, 16,  8,  0, 24)
+#define ABGR8888_FMT Graphics::PixelFormat(4, 8, 8, 8, 8,  0,  8, 16, 24)
+#define RGBA8888_FMT Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16,  8,  0)
+#define BGRA8888_FMT Graphics::PixelFormat(4, 8, 8, 8, 8,  8, 16, 24,  0)
+
+#define CONV_BLIT(src, dst) { convBlit<src##_Layout, dst##_Layout>, src##_FMT, dst##_FMT }
+
+// 16 -> 32 bit expansion for the common 16-bit layouts.
+static const FastBlitLookup fastBlitFuncs_2to4[] = {
+	CONV_BLIT(RGB565,   ARGB8888), CONV_BLIT(RGB565,   ABGR8888), CONV_BLIT(RGB565,   RGBA8888), CONV_BLIT(RGB565,   BGRA8888),
+	CONV_BLIT(RGB555,   ARGB8888), CONV_BLIT(RGB555,   ABGR8888), CONV_BLIT(RGB555,   RGBA8888), CONV_BLIT(RGB555,   BGRA8888),
+	CONV_BLIT(ARGB1555, ARGB8888), CONV_BLIT(ARGB1555, ABGR8888), CONV_BLIT(ARGB1555, RGBA8888), CONV_BLIT(ARGB1555, BGRA8888),
+	CONV_BLIT(RGBA5551, ARGB8888), CONV_BLIT(RGBA5551, ABGR8888), CONV_BLIT(RGBA5551, RGBA8888), CONV_BLIT(RGBA5551, BGRA8888)
+};
+
+// 32 -> 16 bit truncation.
+static const FastBlitLookup fastBlitFuncs_4to2[] = {
+	CONV_BLIT(ARGB8888, RGB565), CONV_BLIT(ABGR8888, RGB565), CONV_BLIT(RGBA8888, RGB565), CONV_BLIT(BGRA8888, RGB565),
+	CONV_BLIT(ARGB8888, RGB555), CONV_BLIT(ABGR8888, RGB555), CONV_BLIT(RGBA8888, RGB555), CONV_BLIT(BGRA8888, RGB555),
+	CONV_BLIT(ARGB8888, ARGB1555), CONV_BLIT(ABGR8888, ARGB1555), CONV_BLIT(RGBA8888, ARGB1555), CONV_BLIT(BGRA8888, ARGB1555),
+	CONV_BLIT(ARGB8888, RGBA5551), CONV_BLIT(ABGR8888, RGBA5551), CONV_BLIT(RGBA8888, RGBA5551), CONV_BLIT(BGRA8888, RGBA5551)
+};
+
+// 16 <-> 16 bit repacking.
+static const FastBlitLookup fastBlitFuncs_2to2[] = {
+	CONV_BLIT(RGB565,   RGB555),   CONV_BLIT(RGB565,   ARGB1555), CONV_BLIT(RGB565,   RGBA5551),
+	CONV_BLIT(RGB555,   RGB565),   CONV_BLIT(RGB555,   ARGB1555), CONV_BLIT(RGB555,   RGBA5551),
+	CONV_BLIT(ARGB1555, RGB565),   CONV_BLIT(ARGB1555, RGB555),   CONV_BLIT(ARGB1555, RGBA5551),
+	CONV_BLIT(RGBA5551, RGB565),   CONV_BLIT(RGBA5551, RGB555),   CONV_BLIT(RGBA5551, ARGB1555)
+};
+
 FastBlitFunc getFastBlitFunc(const PixelFormat &dstFmt, const PixelFormat &srcFmt) {
 	const uint dstBpp = dstFmt.bytesPerPixel;
 	const uint srcBpp = srcFmt.bytesPerPixel;
@@ -96,6 +310,21 @@ FastBlitFunc getFastBlitFunc(const PixelFormat &dstFmt, const PixelFormat &srcFm
 	if (srcBpp == 4 && dstBpp == 4) {
 		table = fastBlitFuncs_4to4;
 		length = ARRAYSIZE(fastBlitFuncs_4to4);
+	} else if (srcBpp == 3 && dstBpp == 4) {
+		table = fastBlitFuncs_3to4;
+		length = ARRAYSIZE(fastBlitFuncs_3to4);
+	} else if (srcBpp == 4 && dstBpp == 3) {
+		table = fastBlitFuncs_4to3;
+		length = ARRAYSIZE(fastBlitFuncs_4to3);
+	} else if (srcBpp == 2 && dstBpp == 4) {
+		table = fastBlitFuncs_2to4;
+		length = ARRAYSIZE(fastBlitFuncs_2to4);
+	} else if (srcBpp == 4 && dstBpp == 2) {
+		table = fastBlitFuncs_4to2;
+		length = ARRAYSIZE(fastBlitFuncs_4to2);
+	} else if (srcBpp == 2 && dstBpp == 2) {
+		table = fastBlitFuncs_2to2;
+		length = ARRAYSIZE(fastBlitFuncs_2to2);
 	} else {
 		return nullptr;
 	}
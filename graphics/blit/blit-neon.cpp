@@ -92,6 +92,31 @@ public:
 		src = vandq_u32(vmvnq_u32(alphaMask), src);
 		return vorrq_u32(dst, src);
 	}
+
+	inline uint32x4_t simdFill(uint32x4_t dst) const {
+		const uint32 ina = this->ca;
+		const uint32x4_t hold = vdupq_n_u32(255 - ina);
+
+		uint32x4_t dstB = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		uint32x4_t dstG = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		uint32x4_t dstR = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		if (rgbmod) {
+			dstB = vaddq_u32(vshrq_n_u32(vmulq_u32(dstB, hold), 8), vdupq_n_u32(255 * ina * this->cb >> 16));
+			dstG = vaddq_u32(vshrq_n_u32(vmulq_u32(dstG, hold), 8), vdupq_n_u32(255 * ina * this->cg >> 16));
+			dstR = vaddq_u32(vshrq_n_u32(vmulq_u32(dstR, hold), 8), vdupq_n_u32(255 * ina * this->cr >> 16));
+		} else {
+			const uint32x4_t full = vdupq_n_u32(255 * ina);
+			dstB = vshrq_n_u32(vaddq_u32(vmulq_u32(dstB, hold), full), 8);
+			dstG = vshrq_n_u32(vaddq_u32(vmulq_u32(dstG, hold), full), 8);
+			dstR = vshrq_n_u32(vaddq_u32(vmulq_u32(dstR, hold), full), 8);
+		}
+
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstB, BlendBlit::kBModShift), vmovq_n_u32(BlendBlit::kBModMask)), vmovq_n_u32(BlendBlit::kAModMask));
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstG, BlendBlit::kGModShift), vmovq_n_u32(BlendBlit::kGModMask)), dst);
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstR, BlendBlit::kRModShift), vmovq_n_u32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -141,6 +166,40 @@ public:
 		src = vandq_u32(vmvnq_u32(alphaMask), src);
 		return vorrq_u32(dst, src);
 	}
+
+	inline uint32x4_t simdFill(uint32x4_t dst) const {
+		const uint32 ina = this->ca;
+		if (ina == 0 || (ina == 255 && !rgbmod))
+			return dst;
+
+		uint32 fb, fg, fr;
+		if (ina == 255) {
+			fb = this->cb;
+			fg = this->cg;
+			fr = this->cr;
+		} else if (rgbmod) {
+			fb = (this->cb * ina) >> 8;
+			fg = (this->cg * ina) >> 8;
+			fr = (this->cr * ina) >> 8;
+		} else {
+			fb = fg = fr = ina;
+		}
+
+		uint32x4_t dstB = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		uint32x4_t dstG = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		uint32x4_t dstR = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		dstB = vshrq_n_u32(vmulq_u32(dstB, vdupq_n_u32(fb)), 8);
+		dstG = vshrq_n_u32(vmulq_u32(dstG, vdupq_n_u32(fg)), 8);
+		dstR = vshrq_n_u32(vmulq_u32(dstR, vdupq_n_u32(fr)), 8);
+
+		// The alpha channel is left untouched, like in the scalar version
+		dst = vandq_u32(dst, vmovq_n_u32(BlendBlit::kAModMask));
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstB, BlendBlit::kBModShift), vmovq_n_u32(BlendBlit::kBModMask)), dst);
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstG, BlendBlit::kGModShift), vmovq_n_u32(BlendBlit::kGModMask)), dst);
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstR, BlendBlit::kRModShift), vmovq_n_u32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -221,6 +280,28 @@ public:
 		src = vandq_u32(vmvnq_u32(alphaMask), src);
 		return vorrq_u32(dst, src);
 	}
+
+	inline uint32x4_t simdFill(uint32x4_t dst) const {
+		const uint32 ina = this->ca;
+		if (ina == 0)
+			return dst;
+
+		uint32 kb, kg, kr;
+		if (ina == 255) {
+			kb = rgbmod ? this->cb : 255;
+			kg = rgbmod ? this->cg : 255;
+			kr = rgbmod ? this->cr : 255;
+		} else {
+			kb = rgbmod ? ((this->cb * ina) >> 8) : ina;
+			kg = rgbmod ? ((this->cg * ina) >> 8) : ina;
+			kr = rgbmod ? ((this->cr * ina) >> 8) : ina;
+		}
+
+		// Per-byte wrapping add, matching the scalar version's byte stores;
+		// the alpha byte of the constant is zero so the channel is kept
+		const uint32x4_t k = vdupq_n_u32((kr << BlendBlit::kRModShift) | (kg << BlendBlit::kGModShift) | (kb << BlendBlit::kBModShift));
+		return vreinterpretq_u32_u8(vaddq_u8(vreinterpretq_u8_u32(dst), vreinterpretq_u8_u32(k)));
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -243,6 +324,27 @@ public:
 
 		return vorrq_u32(vmovq_n_u32(BlendBlit::kAModMask), vorrq_u32(srcb, vorrq_u32(srcg, srcr)));
 	}
+
+	inline uint32x4_t simdFill(uint32x4_t dst) const {
+		if (!rgbmod) {
+			// The scalar version zeroes the color channels and sets full alpha
+			return vmovq_n_u32(BlendBlit::kAModMask);
+		}
+
+		uint32x4_t dstB = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		uint32x4_t dstG = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		uint32x4_t dstR = vshrq_n_u32(vandq_u32(dst, vmovq_n_u32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		// out -= (c * out) >> 8 can never go below zero, so no clamp is needed
+		dstB = vsubq_u32(dstB, vshrq_n_u32(vmulq_u32(dstB, vdupq_n_u32(this->cb)), 8));
+		dstG = vsubq_u32(dstG, vshrq_n_u32(vmulq_u32(dstG, vdupq_n_u32(this->cg)), 8));
+		dstR = vsubq_u32(dstR, vshrq_n_u32(vmulq_u32(dstR, vdupq_n_u32(this->cr)), 8));
+
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstB, BlendBlit::kBModShift), vmovq_n_u32(BlendBlit::kBModMask)), vmovq_n_u32(BlendBlit::kAModMask));
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstG, BlendBlit::kGModShift), vmovq_n_u32(BlendBlit::kGModMask)), dst);
+		dst = vorrq_u32(vandq_u32(vshlq_n_u32(dstR, BlendBlit::kRModShift), vmovq_n_u32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 public:
@@ -318,12 +420,40 @@ static inline void blitInnerLoop(BlendBlit::Args &args) {
 	}
 }
 
+template<template <bool RGBMOD, bool ALPHAMOD> class PixelFunc, bool rgbmod, bool alphamod>
+static inline void fillInnerLoop(BlendBlit::Args &args) {
+	byte *out;
+
+	const PixelFunc<rgbmod, alphamod> pixelFunc(args.color);
+
+	for (uint32 i = 0; i < args.height; i++) {
+		out = args.outo;
+
+		uint32 j = 0;
+		for (; j + 4 <= args.width; j += 4) {
+			const uint32x4_t dstPixels = vld1q_u32((const uint32 *)out);
+			vst1q_u32((uint32 *)out, pixelFunc.simdFill(dstPixels));
+			out += 4 * 4;
+		}
+		for (; j < args.width; j++) {
+			pixelFunc.fill(out);
+
+			out += 4;
+		}
+		args.outo += args.dstPitch;
+	}
+}
+
 }; // end of class BlendBlitImpl_NEON
 
 void BlendBlit::blitNEON(Args &args, const TSpriteBlendMode &blendMode, const AlphaType &alphaType) {
 	blitT<BlendBlitImpl_NEON>(args, blendMode, alphaType);
 }
 
+void BlendBlit::fillNEON(Args &args, const TSpriteBlendMode &blendMode) {
+	fillT<BlendBlitImpl_NEON>(args, blendMode);
+}
+
 } // end of namespace Graphics
 
 #if !defined(__aarch64__) && !defined(__ARM_NEON)
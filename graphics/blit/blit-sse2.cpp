@@ -96,6 +96,31 @@ public:
 		src = _mm_andnot_si128(alphaMask, src);
 		return _mm_or_si128(dst, src);
 	}
+
+	inline __m128i simdFill(__m128i dst) const {
+		const uint32 ina = this->ca;
+		const __m128i hold = _mm_set1_epi32(255 - ina);
+
+		__m128i dstB = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		__m128i dstG = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		__m128i dstR = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		if (rgbmod) {
+			dstB = _mm_add_epi32(_mm_srli_epi32(_mm_mullo_epi16(dstB, hold), 8), _mm_set1_epi32(255 * ina * this->cb >> 16));
+			dstG = _mm_add_epi32(_mm_srli_epi32(_mm_mullo_epi16(dstG, hold), 8), _mm_set1_epi32(255 * ina * this->cg >> 16));
+			dstR = _mm_add_epi32(_mm_srli_epi32(_mm_mullo_epi16(dstR, hold), 8), _mm_set1_epi32(255 * ina * this->cr >> 16));
+		} else {
+			const __m128i full = _mm_set1_epi32(255 * ina);
+			dstB = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(dstB, hold), full), 8);
+			dstG = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(dstG, hold), full), 8);
+			dstR = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(dstR, hold), full), 8);
+		}
+
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstB, BlendBlit::kBModShift), _mm_set1_epi32(BlendBlit::kBModMask)), _mm_set1_epi32(BlendBlit::kAModMask));
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstG, BlendBlit::kGModShift), _mm_set1_epi32(BlendBlit::kGModMask)), dst);
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstR, BlendBlit::kRModShift), _mm_set1_epi32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -145,6 +170,40 @@ public:
 		src = _mm_andnot_si128(alphaMask, src);
 		return _mm_or_si128(dst, src);
 	}
+
+	inline __m128i simdFill(__m128i dst) const {
+		const uint32 ina = this->ca;
+		if (ina == 0 || (ina == 255 && !rgbmod))
+			return dst;
+
+		uint32 fb, fg, fr;
+		if (ina == 255) {
+			fb = this->cb;
+			fg = this->cg;
+			fr = this->cr;
+		} else if (rgbmod) {
+			fb = (this->cb * ina) >> 8;
+			fg = (this->cg * ina) >> 8;
+			fr = (this->cr * ina) >> 8;
+		} else {
+			fb = fg = fr = ina;
+		}
+
+		__m128i dstB = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		__m128i dstG = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		__m128i dstR = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		dstB = _mm_srli_epi32(_mm_mullo_epi16(dstB, _mm_set1_epi32(fb)), 8);
+		dstG = _mm_srli_epi32(_mm_mullo_epi16(dstG, _mm_set1_epi32(fg)), 8);
+		dstR = _mm_srli_epi32(_mm_mullo_epi16(dstR, _mm_set1_epi32(fr)), 8);
+
+		// The alpha channel is left untouched, like in the scalar version
+		dst = _mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kAModMask));
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstB, BlendBlit::kBModShift), _mm_set1_epi32(BlendBlit::kBModMask)), dst);
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstG, BlendBlit::kGModShift), _mm_set1_epi32(BlendBlit::kGModMask)), dst);
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstR, BlendBlit::kRModShift), _mm_set1_epi32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -225,6 +284,27 @@ public:
 		src = _mm_andnot_si128(alphaMask, src);
 		return _mm_or_si128(dst, src);
 	}
+
+	inline __m128i simdFill(__m128i dst) const {
+		const uint32 ina = this->ca;
+		if (ina == 0)
+			return dst;
+
+		uint32 kb, kg, kr;
+		if (ina == 255) {
+			kb = rgbmod ? this->cb : 255;
+			kg = rgbmod ? this->cg : 255;
+			kr = rgbmod ? this->cr : 255;
+		} else {
+			kb = rgbmod ? ((this->cb * ina) >> 8) : ina;
+			kg = rgbmod ? ((this->cg * ina) >> 8) : ina;
+			kr = rgbmod ? ((this->cr * ina) >> 8) : ina;
+		}
+
+		// Per-byte wrapping add, matching the scalar version's byte stores;
+		// the alpha byte of the constant is zero so the channel is kept
+		return _mm_add_epi8(dst, _mm_set1_epi32((kr << BlendBlit::kRModShift) | (kg << BlendBlit::kGModShift) | (kb << BlendBlit::kBModShift)));
+	}
 };
 
 template<bool rgbmod, bool alphamod>
@@ -247,6 +327,27 @@ public:
 
 		return _mm_or_si128(_mm_set1_epi32(BlendBlit::kAModMask), _mm_or_si128(srcb, _mm_or_si128(srcg, srcr)));
 	}
+
+	inline __m128i simdFill(__m128i dst) const {
+		if (!rgbmod) {
+			// The scalar version zeroes the color channels and sets full alpha
+			return _mm_set1_epi32(BlendBlit::kAModMask);
+		}
+
+		__m128i dstB = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kBModMask)), BlendBlit::kBModShift);
+		__m128i dstG = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kGModMask)), BlendBlit::kGModShift);
+		__m128i dstR = _mm_srli_epi32(_mm_and_si128(dst, _mm_set1_epi32(BlendBlit::kRModMask)), BlendBlit::kRModShift);
+
+		// out -= (c * out) >> 8 can never go below zero, so no clamp is needed
+		dstB = _mm_sub_epi32(dstB, _mm_srli_epi32(_mm_mullo_epi16(dstB, _mm_set1_epi32(this->cb)), 8));
+		dstG = _mm_sub_epi32(dstG, _mm_srli_epi32(_mm_mullo_epi16(dstG, _mm_set1_epi32(this->cg)), 8));
+		dstR = _mm_sub_epi32(dstR, _mm_srli_epi32(_mm_mullo_epi16(dstR, _mm_set1_epi32(this->cr)), 8));
+
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstB, BlendBlit::kBModShift), _mm_set1_epi32(BlendBlit::kBModMask)), _mm_set1_epi32(BlendBlit::kAModMask));
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstG, BlendBlit::kGModShift), _mm_set1_epi32(BlendBlit::kGModMask)), dst);
+		dst = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(dstR, BlendBlit::kRModShift), _mm_set1_epi32(BlendBlit::kRModMask)), dst);
+		return dst;
+	}
 };
 
 public:
@@ -320,12 +421,40 @@ static inline void blitInnerLoop(BlendBlit::Args &args) {
 	}
 }
 
+template<template <bool RGBMOD, bool ALPHAMOD> class PixelFunc, bool rgbmod, bool alphamod>
+static inline void fillInnerLoop(BlendBlit::Args &args) {
+	byte *out;
+
+	const PixelFunc<rgbmod, alphamod> pixelFunc(args.color);
+
+	for (uint32 i = 0; i < args.height; i++) {
+		out = args.outo;
+
+		uint32 j = 0;
+		for (; j + 4 <= args.width; j += 4) {
+			const __m128i dstPixels = _mm_loadu_si128((const __m128i *)out);
+			_mm_storeu_si128((__m128i *)out, pixelFunc.simdFill(dstPixels));
+			out += 4ULL * 4;
+		}
+		for (; j < args.width; j++) {
+			pixelFunc.fill(out);
+
+			out += 4;
+		}
+		args.outo += args.dstPitch;
+	}
+}
+
 }; // End of class BlendBlitImpl_SSE2
 
 void BlendBlit::blitSSE2(Args &args, const TSpriteBlendMode &blendMode, const AlphaType &alphaType) {
 	blitT<BlendBlitImpl_SSE2>(args, blendMode, alphaType);
 }
 
+void BlendBlit::fillSSE2(Args &args, const TSpriteBlendMode &blendMode) {
+	fillT<BlendBlitImpl_SSE2>(args, blendMode);
+}
+
 } // End of namespace Graphics
 
 #if !defined(__x86_64__)
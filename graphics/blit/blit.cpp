@@ -22,6 +22,9 @@
 #include "graphics/blit.h"
 #include "graphics/pixelformat.h"
 #include "common/endian.h"
+#ifdef SCUMMVM_AVX2
+#include "common/system.h"
+#endif
 
 namespace Graphics {
 
@@ -322,7 +325,7 @@ bool crossBlit(byte *dst, const byte *src,
 	}
 
 	// Attempt to use a faster method if possible
-	FastBlitFunc blitFunc = getFastBlitFunc(dstFmt, dstFmt);
+	FastBlitFunc blitFunc = getFastBlitFunc(dstFmt, srcFmt);
 	if (blitFunc) {
 		blitFunc(dst, src, dstPitch, srcPitch, w, h);
 		return true;
@@ -471,6 +474,20 @@ bool crossBlitMap(byte *dst, const byte *src,
 	if (!bytesPerPixel)
 		return false;
 
+#ifdef SCUMMVM_AVX2
+	// The 8bpp -> 32bpp palette expansion is the hot path of every paletted
+	// engine on a 32bpp backend, and has a gather kernel. It walks forward,
+	// so it is skipped for in-place conversions where dst and src overlap.
+	if (bytesPerPixel == 4 &&
+			(dst + dstPitch * h <= src || src + srcPitch * h <= dst)) {
+		static bool useAVX2 = g_system->hasFeature(OSystem::kFeatureCpuAVX2);
+		if (useAVX2) {
+			crossBlitMap8To32AVX2(dst, src, dstPitch, srcPitch, w, h, map);
+			return true;
+		}
+	}
+#endif
+
 	return crossBlitMapHelperLogic<false, false>(dst, src, nullptr, w, h, bytesPerPixel, map, srcPitch, dstPitch, 0, 0);
 }
 
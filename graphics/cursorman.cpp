@@ -160,6 +160,20 @@ void CursorManager::replaceCursor(const void *buf, uint w, uint h, int hotspotX,
 	replaceCursor(surf, hotspotX, hotspotY, keycolor, dontScale, mask);
 }
 
+// Compares the pixels of a stored (linear) cursor surface with an incoming
+// surface that may have a larger pitch.
+static bool cursorPixelsEqual(const Surface &stored, const Surface &incoming) {
+	if (!stored.getPixels() || !incoming.getPixels())
+		return false;
+
+	const uint rowSize = incoming.w * incoming.format.bytesPerPixel;
+	for (int y = 0; y < incoming.h; y++) {
+		if (memcmp(stored.getBasePtr(0, y), incoming.getBasePtr(0, y), rowSize) != 0)
+			return false;
+	}
+	return true;
+}
+
 void CursorManager::replaceCursor(const Surface &surf, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale, const byte *mask) {
 	if (!g_system->hasFeature(OSystem::kFeatureCursorMask))
 		mask = nullptr;
@@ -171,6 +185,21 @@ void CursorManager::replaceCursor(const Surface &surf, int hotspotX, int hotspot
 
 	Cursor *cur = _cursorStack.top();
 
+	// Engines that animate or periodically refresh their cursor often hand
+	// us the exact cursor we already show. Skip the backend update in that
+	// case: re-converting and re-scaling the cursor there is what shows up
+	// as spikes in backend traces. Cursors are small, so the comparison is
+	// far cheaper than the update it avoids.
+	if (cur->_surf.w == surf.w && cur->_surf.h == surf.h &&
+	    cur->_surf.format == surf.format &&
+	    cur->_hotspotX == hotspotX && cur->_hotspotY == hotspotY &&
+	    cur->_keycolor == keycolor && cur->_dontScale == dontScale &&
+	    ((mask == nullptr) == (cur->_mask == nullptr)) &&
+	    cursorPixelsEqual(cur->_surf, surf) &&
+	    (!mask || !memcmp(cur->_mask, mask, surf.w * surf.h))) {
+		return;
+	}
+
 	const uint size = surf.w * surf.h * surf.format.bytesPerPixel;
 
 	if (cur->_size < size) {
@@ -279,6 +308,14 @@ void CursorManager::replaceCursorPalette(const byte *colors, uint start, uint nu
 	Palette *pal = _cursorPaletteStack.top();
 	uint size = 3 * num;
 
+	// An unchanged palette doesn't need to reach the backend, where it
+	// forces a full cursor re-conversion. Only valid while the palette is
+	// active; when it is disabled, the backend call re-enables it.
+	if (!pal->_disabled && pal->_start == start && pal->_num == num &&
+	    (num == 0 || !memcmp(pal->_data, colors, size))) {
+		return;
+	}
+
 	if (pal->_size < size) {
 		// Could not re-use the old buffer. Create a new one.
 		delete[] pal->_data;
@@ -20,6 +20,7 @@
  */
 
 #include "graphics/font.h"
+#include "graphics/fontman.h"
 #include "graphics/managed_surface.h"
 
 #include "common/array.h"
@@ -27,6 +28,13 @@
 
 namespace Graphics {
 
+Font::~Font() {
+	// The singleton may already be gone when static fonts are destroyed
+	// during program exit.
+	if (FontManager::hasInstance())
+		FontMan.clearGlyphAtlases(this);
+}
+
 int Font::getFontAscent() const {
 	return -1;
 }
@@ -105,12 +113,45 @@ int getStringWidthImpl(const Font &font, const StringType &str) {
 	return space;
 }
 
+// Helpers for drawStringImpl to draw through a glyph atlas where one is
+// available. The ManagedSurface variants keep the transparent-color and
+// dirty-rect behavior of Font::drawChar().
+inline const GlyphAtlas *lookupGlyphAtlas(const Font &font, Surface *dst, uint32 color) {
+	if (!GlyphAtlas::isSupportedFormat(dst->format))
+		return nullptr;
+	return FontMan.getGlyphAtlas(&font, color, dst->format);
+}
+
+inline const GlyphAtlas *lookupGlyphAtlas(const Font &font, ManagedSurface *dst, uint32 color) {
+	// The transparent-color blending of drawChar(ManagedSurface *) is not
+	// representable in an atlas.
+	if (dst->hasTransparentColor())
+		return nullptr;
+	return lookupGlyphAtlas(font, dst->surfacePtr(), color);
+}
+
+inline bool atlasDrawChar(const GlyphAtlas *atlas, const Font &font, Surface *dst, uint32 chr, int x, int y) {
+	return atlas->drawChar(dst, chr, x, y);
+}
+
+inline bool atlasDrawChar(const GlyphAtlas *atlas, const Font &font, ManagedSurface *dst, uint32 chr, int x, int y) {
+	if (!atlas->drawChar(dst->surfacePtr(), chr, x, y))
+		return false;
+
+	Common::Rect charBox = font.getBoundingBox(chr);
+	charBox.translate(x, y);
+	dst->addDirtyRect(charBox);
+	return true;
+}
+
 template<class SurfaceType, class StringType>
 void drawStringImpl(const Font &font, SurfaceType *dst, const StringType &str, int x, int y, int w, uint32 color, TextAlign align, int deltax, bool alpha) {
 	// The logic in getBoundingImpl is the same as we use here. In case we
 	// ever change something here we will need to change it there too.
 	assert(dst != 0);
 
+	const GlyphAtlas *atlas = alpha ? nullptr : lookupGlyphAtlas(font, dst, color);
+
 	const int leftX = x, rightX = x + w + 1;
 	int width = font.getStringWidth(str);
 
@@ -132,7 +173,7 @@ void drawStringImpl(const Font &font, SurfaceType *dst, const StringType &str, i
 		if (x + charBox.right >= leftX) {
 			if (alpha)
 				font.drawAlphaChar(dst, cur, x, y, color);
-			else
+			else if (!atlas || !atlasDrawChar(atlas, font, dst, cur, x, y))
 				font.drawChar(dst, cur, x, y, color);
 		}
 
@@ -630,4 +671,199 @@ void Font::scaleSingleGlyph(Surface *scaleSurface, int *grayScaleMap, int graySc
 
 }
 
+GlyphAtlas::GlyphAtlas(const Font *font, uint32 color, const PixelFormat &format) :
+	_font(font), _color(color), _format(format), _image(nullptr), _trans(nullptr) {
+	assert(isSupportedFormat(format));
+
+	// ARGB byte lanes for the transmission strip; we only ever access it
+	// as raw uint32 values.
+	const PixelFormat laneFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);
+
+	// First pass: measure the glyphs to lay out the strips.
+	Common::Rect boxes[kNumChars];
+	int stripWidth = 0, stripHeight = 0;
+	for (int i = 0; i < kNumChars; ++i) {
+		Entry &entry = _entries[i];
+		entry.present = false;
+		entry.atlasX = 0;
+		entry.width = entry.height = 0;
+		entry.xOffset = entry.yOffset = 0;
+
+		const Common::Rect box = font->getBoundingBox((uint32)(kFirstChar + i));
+		if (box.width() <= 0 || box.height() <= 0) {
+			// Nothing to draw (e.g. a space); cache the glyph as empty.
+			entry.present = true;
+			continue;
+		}
+
+		boxes[i] = box;
+		stripWidth += box.width();
+		stripHeight = MAX<int>(stripHeight, box.height());
+	}
+
+	if (stripWidth == 0 || stripHeight == 0)
+		return;
+
+	_image = new Surface();
+	_image->create(stripWidth, stripHeight, format);
+	_trans = new Surface();
+	_trans->create(stripWidth, stripHeight, laneFormat);
+	// Unused atlas pixels let the background show through completely.
+	_trans->fillRect(Common::Rect(stripWidth, stripHeight), 0xFFFFFFFF);
+
+	const uint32 black = format.ARGBToColor(0x00, 0x00, 0x00, 0x00);
+	const uint32 white = format.ARGBToColor(0xFF, 0xFF, 0xFF, 0xFF);
+
+	int atlasX = 0;
+	for (int i = 0; i < kNumChars; ++i) {
+		if (_entries[i].present)
+			continue;
+
+		const uint32 chr = (uint32)(kFirstChar + i);
+		const Common::Rect &box = boxes[i];
+		const int w = box.width(), h = box.height();
+
+		// Render the glyph twice, onto a black and onto a white
+		// background. Pixels the glyph fully determines come out the same
+		// both times; for the others the difference of the two renders is
+		// exactly how much of the background shines through each channel,
+		// since drawChar() blends linearly with the background. That
+		// transmission is what drawGlyph() needs to reproduce the blend
+		// against arbitrary backgrounds.
+		const int drawX = MAX(0, -(int)box.left), drawY = MAX(0, -(int)box.top);
+
+		Surface onBlack, onWhite;
+		onBlack.create(drawX + box.right, drawY + box.bottom, format);
+		onBlack.fillRect(Common::Rect(onBlack.w, onBlack.h), black);
+		font->drawChar(&onBlack, chr, drawX, drawY, color);
+
+		onWhite.create(drawX + box.right, drawY + box.bottom, format);
+		onWhite.fillRect(Common::Rect(onWhite.w, onWhite.h), white);
+		font->drawChar(&onWhite, chr, drawX, drawY, color);
+
+		for (int y = 0; y < h; ++y) {
+			uint32 *transPos = (uint32 *)_trans->getBasePtr(atlasX, y);
+			for (int x = 0; x < w; ++x) {
+				uint32 cBlack, cWhite;
+				if (format.bytesPerPixel == 2) {
+					cBlack = *((const uint16 *)onBlack.getBasePtr(drawX + box.left + x, drawY + box.top + y));
+					cWhite = *((const uint16 *)onWhite.getBasePtr(drawX + box.left + x, drawY + box.top + y));
+					*((uint16 *)_image->getBasePtr(atlasX + x, y)) = (uint16)cBlack;
+				} else {
+					cBlack = *((const uint32 *)onBlack.getBasePtr(drawX + box.left + x, drawY + box.top + y));
+					cWhite = *((const uint32 *)onWhite.getBasePtr(drawX + box.left + x, drawY + box.top + y));
+					*((uint32 *)_image->getBasePtr(atlasX + x, y)) = cBlack;
+				}
+
+				uint8 bA, bR, bG, bB, wA, wR, wG, wB;
+				format.colorToARGB(cBlack, bA, bR, bG, bB);
+				format.colorToARGB(cWhite, wA, wR, wG, wB);
+
+				const uint8 tA = (wA > bA) ? (wA - bA) : 0;
+				const uint8 tR = (wR > bR) ? (wR - bR) : 0;
+				const uint8 tG = (wG > bG) ? (wG - bG) : 0;
+				const uint8 tB = (wB > bB) ? (wB - bB) : 0;
+				transPos[x] = ((uint32)tA << 24) | ((uint32)tR << 16) | ((uint32)tG << 8) | tB;
+			}
+		}
+
+		onBlack.free();
+		onWhite.free();
+
+		Entry &entry = _entries[i];
+		entry.present = true;
+		entry.atlasX = atlasX;
+		entry.width = w;
+		entry.height = h;
+		entry.xOffset = box.left;
+		entry.yOffset = box.top;
+
+		atlasX += w;
+	}
+}
+
+GlyphAtlas::~GlyphAtlas() {
+	if (_image) {
+		_image->free();
+		delete _image;
+	}
+	if (_trans) {
+		_trans->free();
+		delete _trans;
+	}
+}
+
+bool GlyphAtlas::drawChar(Surface *dst, uint32 chr, int x, int y) const {
+	if (chr < kFirstChar || chr > kLastChar)
+		return false;
+
+	const Entry &entry = _entries[chr - kFirstChar];
+	if (!entry.present)
+		return false;
+	if (entry.width == 0 || entry.height == 0)
+		return true; // nothing to draw
+	if (dst->format != _format)
+		return false;
+
+	if (_format.bytesPerPixel == 2)
+		drawGlyph<uint16>(dst, entry, x, y);
+	else
+		drawGlyph<uint32>(dst, entry, x, y);
+	return true;
+}
+
+template<typename PixelType>
+void GlyphAtlas::drawGlyph(Surface *dst, const Entry &entry, int x, int y) const {
+	x += entry.xOffset;
+	y += entry.yOffset;
+
+	int w = entry.width, h = entry.height;
+	int srcX = entry.atlasX, srcY = 0;
+
+	// Clip to the surface bounds, like the drawChar() implementations do.
+	if (x < 0) {
+		srcX -= x;
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		srcY -= y;
+		h += y;
+		y = 0;
+	}
+	if (x + w > dst->w)
+		w = dst->w - x;
+	if (y + h > dst->h)
+		h = dst->h - y;
+	if (w <= 0 || h <= 0)
+		return;
+
+	for (int cy = 0; cy < h; ++cy) {
+		const PixelType *src = (const PixelType *)_image->getBasePtr(srcX, srcY + cy);
+		const uint32 *trans = (const uint32 *)_trans->getBasePtr(srcX, srcY + cy);
+		PixelType *dstPos = (PixelType *)dst->getBasePtr(x, y + cy);
+
+		for (int cx = 0; cx < w; ++cx) {
+			const uint32 t = trans[cx];
+			if (t == 0xFFFFFFFF)
+				continue; // the background shows through completely
+			if (t == 0) {
+				dstPos[cx] = src[cx]; // the glyph pixel is opaque
+				continue;
+			}
+
+			uint8 sA, sR, sG, sB, dA, dR, dG, dB;
+			_format.colorToARGB(src[cx], sA, sR, sG, sB);
+			_format.colorToARGB(dstPos[cx], dA, dR, dG, dB);
+
+			dA = MIN<uint>(255, sA + (dA * ((t >> 24) & 0xFF)) / 255);
+			dR = MIN<uint>(255, sR + (dR * ((t >> 16) & 0xFF)) / 255);
+			dG = MIN<uint>(255, sG + (dG * ((t >>  8) & 0xFF)) / 255);
+			dB = MIN<uint>(255, sB + (dB * ( t        & 0xFF)) / 255);
+
+			dstPos[cx] = (PixelType)_format.ARGBToColor(dA, dR, dG, dB);
+		}
+	}
+}
+
 } // End of namespace Graphics
@@ -26,6 +26,8 @@
 #include "common/ustr.h"
 #include "common/rect.h"
 
+#include "graphics/pixelformat.h"
+
 namespace Common {
 template<class T> class Array;
 }
@@ -83,7 +85,7 @@ TextAlign convertTextAlignH(TextAlign alignH, bool rtl);
 class Font {
 public:
 	Font() {}
-	virtual ~Font() {}
+	virtual ~Font();
 
 	/**
 	 * Return the height of the font.
@@ -356,6 +358,66 @@ public:
 	void scaleSingleGlyph(Surface *scaleSurface, int *grayScaleMap, int grayScaleMapSize, int width, int height, int xOffset, int yOffset, int grayLevel, int chr, int srcheight, int srcwidth, float scale) const;
 
 };
+
+/**
+ * A cache of glyphs pre-rendered with a fixed color for a fixed target
+ * pixel format.
+ *
+ * Atlases are built lazily through FontManager::getGlyphAtlas() and
+ * consulted by Font::drawString(), which turns the per-pixel color
+ * conversion and alpha blending done by drawChar() into blits of
+ * pre-computed pixel data. Only 2 Bpp and 4 Bpp target formats are
+ * covered; for other formats, and for characters outside the Latin-1
+ * range, drawString() falls back to drawChar().
+ */
+class GlyphAtlas {
+public:
+	GlyphAtlas(const Font *font, uint32 color, const PixelFormat &format);
+	~GlyphAtlas();
+
+	/** Check whether an atlas can be built for the given target format. */
+	static bool isSupportedFormat(const PixelFormat &format) {
+		return format.bytesPerPixel == 2 || format.bytesPerPixel == 4;
+	}
+
+	const Font *getFont() const { return _font; }
+	uint32 getColor() const { return _color; }
+	const PixelFormat &getFormat() const { return _format; }
+
+	/**
+	 * Draw a cached glyph to the given surface, producing the same pixels
+	 * as Font::drawChar() with the atlas color would.
+	 *
+	 * @return False if the glyph is not part of the atlas and the caller
+	 *         has to fall back to Font::drawChar().
+	 */
+	bool drawChar(Surface *dst, uint32 chr, int x, int y) const;
+
+private:
+	enum {
+		kFirstChar = 32,
+		kLastChar  = 255,
+		kNumChars  = kLastChar - kFirstChar + 1
+	};
+
+	struct Entry {
+		bool present;
+		int atlasX;             ///< x position of the glyph pixels in the strips
+		int16 width, height;
+		int16 xOffset, yOffset; ///< position of the glyph relative to the draw point
+	};
+
+	template<typename PixelType>
+	void drawGlyph(Surface *dst, const Entry &entry, int x, int y) const;
+
+	const Font *_font;
+	uint32 _color;
+	PixelFormat _format;
+
+	Entry _entries[kNumChars];
+	Surface *_image; ///< glyphs rendered onto a black background, target format
+	Surface *_trans; ///< per-channel background transmission, ARGB byte lanes
+};
 /** @} */
 } // End of namespace Graphics
 
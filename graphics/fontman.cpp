@@ -45,6 +45,11 @@ FontManager::FontManager() {
 }
 
 FontManager::~FontManager() {
+	// Delete the atlases before the fonts they were built for.
+	for (uint i = 0; i < _glyphAtlases.size(); ++i)
+		delete _glyphAtlases[i];
+	_glyphAtlases.clear();
+
 	for (uint i = 0; i < _ownedFonts.size(); ++i) {
 		const Font *font = _ownedFonts[i];
 		if (font == g_sysfont || font == g_sysfont_big || font == g_consolefont)
@@ -164,6 +169,77 @@ const Font *FontManager::getFontByName(const Common::String &name) const {
 	return _fontMap[lowercaseName];
 }
 
+const GlyphAtlas *FontManager::getGlyphAtlas(const Font *font, uint32 color, const PixelFormat &format) {
+	// A handful of atlases covers the GUI and the text-heavy engines; more
+	// would mostly cache one-shot color combinations.
+	const uint kMaxAtlases = 8;
+	// Pending requests are kept short so that a burst of unique colors
+	// (e.g. fading text) cannot flush out combinations that do repeat.
+	const uint kMaxRequests = 16;
+
+	if (!GlyphAtlas::isSupportedFormat(format))
+		return nullptr;
+
+	for (uint i = 0; i < _glyphAtlases.size(); ++i) {
+		GlyphAtlas *atlas = _glyphAtlases[i];
+		if (atlas->getFont() == font && atlas->getColor() == color && atlas->getFormat() == format) {
+			// Move to the back, i.e. mark as most recently used.
+			_glyphAtlases.remove_at(i);
+			_glyphAtlases.push_back(atlas);
+			return atlas;
+		}
+	}
+
+	// Only build an atlas for combinations that are requested repeatedly;
+	// paying the build cost for a one-shot draw would be a net loss.
+	bool seenBefore = false;
+	for (uint i = 0; i < _glyphAtlasRequests.size(); ++i) {
+		const GlyphAtlasRequest &request = _glyphAtlasRequests[i];
+		if (request.font == font && request.color == color && request.format == format) {
+			_glyphAtlasRequests.remove_at(i);
+			seenBefore = true;
+			break;
+		}
+	}
+
+	if (!seenBefore) {
+		GlyphAtlasRequest request;
+		request.font = font;
+		request.color = color;
+		request.format = format;
+		if (_glyphAtlasRequests.size() >= kMaxRequests)
+			_glyphAtlasRequests.remove_at(0);
+		_glyphAtlasRequests.push_back(request);
+		return nullptr;
+	}
+
+	if (_glyphAtlases.size() >= kMaxAtlases) {
+		delete _glyphAtlases[0];
+		_glyphAtlases.remove_at(0);
+	}
+
+	GlyphAtlas *atlas = new GlyphAtlas(font, color, format);
+	_glyphAtlases.push_back(atlas);
+	return atlas;
+}
+
+void FontManager::clearGlyphAtlases(const Font *font) {
+	for (uint i = 0; i < _glyphAtlases.size(); ++i) {
+		if (_glyphAtlases[i]->getFont() == font) {
+			delete _glyphAtlases[i];
+			_glyphAtlases.remove_at(i);
+			--i;
+		}
+	}
+
+	for (uint i = 0; i < _glyphAtlasRequests.size(); ++i) {
+		if (_glyphAtlasRequests[i].font == font) {
+			_glyphAtlasRequests.remove_at(i);
+			--i;
+		}
+	}
+}
+
 const Font *FontManager::getFontByUsage(FontUsage usage) const {
 	switch (usage) {
 	case kConsoleFont:
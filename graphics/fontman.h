@@ -28,6 +28,8 @@
 #include "common/hashmap.h"
 #include "common/hash-str.h"
 
+#include "graphics/pixelformat.h"
+
 
 namespace Graphics {
 
@@ -42,6 +44,7 @@ namespace Graphics {
 
 class Font;
 class BdfFont;
+class GlyphAtlas;
 
 class FontManager : public Common::Singleton<FontManager> {
 public:
@@ -106,6 +109,28 @@ public:
 
 	//const Font *getFontBySize(int size???) const;
 
+	/**
+	 * Retrieve the glyph atlas for drawing with the given font, color and
+	 * target pixel format, building it on demand.
+	 *
+	 * Only a small number of atlases is kept, with the least recently used
+	 * one evicted when the cache is full. To avoid paying the build cost
+	 * for one-shot combinations (e.g. text fading through many colors), an
+	 * atlas is only built once the same combination has been requested
+	 * repeatedly; until then null is returned and the caller has to draw
+	 * through Font::drawChar().
+	 *
+	 * @return a pointer to the atlas, or null when no atlas is available
+	 *         for this combination (yet).
+	 */
+	const GlyphAtlas *getGlyphAtlas(const Font *font, uint32 color, const PixelFormat &format);
+
+	/**
+	 * Drop all cached glyph atlases built for the given font. Called from
+	 * ~Font() so that an atlas can never outlive its font.
+	 */
+	void clearGlyphAtlases(const Font *font);
+
 private:
 	friend class Common::Singleton<SingletonBaseType>;
 	FontManager();
@@ -114,6 +139,19 @@ private:
 	Common::HashMap<Common::String, const Font *> _fontMap;
 	Common::Array<const Font *> _ownedFonts;
 	Common::String _localizedFontName;
+
+	/**
+	 * Pending atlas build requests: combinations seen once which get an
+	 * atlas built when they are requested again.
+	 */
+	struct GlyphAtlasRequest {
+		const Font *font;
+		uint32 color;
+		PixelFormat format;
+	};
+
+	Common::Array<GlyphAtlas *> _glyphAtlases;            ///< most recently used last
+	Common::Array<GlyphAtlasRequest> _glyphAtlasRequests; ///< most recent last
 };
 
 /** @} */
@@ -25,6 +25,11 @@
 
 namespace Graphics {
 
+// A frame arriving later than this many frame durations after its deadline is
+// considered unrecoverable (pause, process suspension, ...): pacing restarts
+// from the current time instead of rushing several short frames to catch up.
+static const uint kMaxCatchUpFrames = 3;
+
 FrameLimiter::FrameLimiter(OSystem *system, const uint framerate, const bool deferToVsync) :
 	_system(system),
 	_deferToVsync(deferToVsync) {
@@ -37,7 +42,9 @@ void FrameLimiter::initialize() {
 }
 
 void FrameLimiter::initialize(const uint framerate) {
-	_frameLimit = (framerate > 0) ? 1000.0f / CLIP<uint>(framerate, 1, 120) : 0;
+	_frameLimitMicros = (framerate > 0) ? 1000000 / CLIP<uint>(framerate, 1, 120) : 0;
+	_frameLimit = _frameLimitMicros / 1000;
+	_deadline = 0;
 	initialize();
 }
 
@@ -55,18 +62,35 @@ bool FrameLimiter::delayBeforeSwap() {
 	_now = _system->getMillis();
 	_loopDuration = _now - _frameStart;
 	if (_enabled) {
-		//_delay = _frameLimit - _loopDuration;  // Original functionality, will tend to undershoot target framerate slightly due to finite screen.update() time.
-		_delay = _frameLimit - (_now - _drawStart); // Ensure that EXACTLY the specified frame duration has elapsed since last screen.update() was called.
-		if (_delay > 0)
-			_system->delayMillis(_delay);
+		const uint64 now = (uint64)_now * 1000;
+		if (_deadline == 0 || now > _deadline + (uint64)kMaxCatchUpFrames * _frameLimitMicros) {
+			// First frame, or too far behind to catch up: restart pacing here
+			_deadline = now;
+		}
+		// Advance the deadline by exactly one frame at full precision. A
+		// late frame leaves the deadline in the past, so the following
+		// frames come out shorter until the lost time is paid back.
+		_deadline += _frameLimitMicros;
+		_delay = ((int64)_deadline - (int64)now) / 1000;
+		if (_deadline > now) {
+			// Sleep the bulk of the wait, then spin the final millisecond:
+			// delayMillis() may oversleep by a scheduler tick, which is
+			// exactly the jitter a frame limiter is meant to remove.
+			const uint sleepMillis = (_deadline - now) / 1000;
+			if (sleepMillis > 1)
+				_system->delayMillis(sleepMillis - 1);
+			while ((uint64)_system->getMillis() * 1000 + 999 < _deadline) {}
+		}
 	}
 	_drawStart = _system->getMillis();
 	return (_delay < 0); // Check if frame is late
 }
 
 void FrameLimiter::pause(bool pause) {
-	if (!pause)
+	if (!pause) {
 		_frameStart = 0; // Ensure that the frame duration value is consistent when resuming
+		_deadline = 0; // Do not try to catch up on the time spent paused
+	}
 }
 
 } // End of namespace Graphics
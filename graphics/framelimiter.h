@@ -97,7 +97,9 @@ private:
 	bool _enabled;
 	bool _deferToVsync;
 	uint _frameStart = 0;  // Time at which screen update completed and startFrame() was called; start of next cycle of game logic
-	uint _frameLimit = 0;  // Target frame duration to achieve specified FPS
+	uint _frameLimit = 0;  // Target frame duration to achieve specified FPS, rounded to milliseconds
+	uint _frameLimitMicros = 0;  // Target frame duration at full precision, so 60 FPS paces at 16.67ms rather than 16ms
+	uint64 _deadline = 0;  // Absolute time in microseconds at which the next frame is due; 0 restarts pacing from 'now'
 	uint _frameDuration = 0; // Duration of previous frame between successive startFrame() calls; total game logic, delay (if any) and screen update time
 	uint _drawStart = 0;  // Time at which delayBeforeSwap() returns
 	uint _drawDuration = 0;  // Measured screen update time
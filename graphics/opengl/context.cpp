@@ -75,6 +75,8 @@ void Context::reset() {
 	packedPixelsSupported = false;
 	packedDepthStencilSupported = false;
 	unpackSubImageSupported = false;
+	pixelBufferObjectSupported = false;
+	mapBufferRangeSupported = false;
 	OESDepth24 = false;
 	textureEdgeClampSupported = false;
 	textureBorderClampSupported = false;
@@ -191,6 +193,10 @@ void Context::initialize(ContextType contextType) {
 			packedDepthStencilSupported = true;
 		} else if (token == "GL_EXT_unpack_subimage") {
 			unpackSubImageSupported = true;
+		} else if (token == "GL_ARB_pixel_buffer_object" || token == "GL_EXT_pixel_buffer_object" || token == "GL_NV_pixel_buffer_object") {
+			pixelBufferObjectSupported = true;
+		} else if (token == "GL_ARB_map_buffer_range" || token == "GL_EXT_map_buffer_range") {
+			mapBufferRangeSupported = true;
 		} else if (token == "GL_EXT_framebuffer_multisample") {
 			EXTFramebufferMultisample = true;
 		} else if (token == "GL_EXT_framebuffer_blit") {
@@ -244,6 +250,8 @@ void Context::initialize(ContextType contextType) {
 			packedDepthStencilSupported = true;
 			textureMaxLevelSupported = true;
 			unpackSubImageSupported = true;
+			pixelBufferObjectSupported = true;
+			mapBufferRangeSupported = true;
 			OESDepth24 = true;
 		}
 		// OpenGL ES 3.2 and later always has texture border clamp support
@@ -264,6 +272,10 @@ void Context::initialize(ContextType contextType) {
 		// ScummVM does not support multisample FBOs with GLES for now
 		framebufferObjectMultisampleSupported = false;
 
+		// No pixel buffer objects in GLES
+		pixelBufferObjectSupported = false;
+		mapBufferRangeSupported = false;
+
 		// GLES always has imaging support
 		imagingSupported = true;
 
@@ -304,6 +316,14 @@ void Context::initialize(ContextType contextType) {
 		if (isGLVersionOrHigher(1, 4)) {
 			textureMirrorRepeatSupported = true;
 		}
+		// OpenGL 2.1 adds pixel buffer object support
+		if (isGLVersionOrHigher(2, 1)) {
+			pixelBufferObjectSupported = true;
+		}
+		// OpenGL 3.0 adds buffer range mapping support
+		if (isGLVersionOrHigher(3, 0)) {
+			mapBufferRangeSupported = true;
+		}
 
 		// In OpenGL precision is always enough
 		textureLookupPrecision = UINT_MAX;
@@ -339,6 +359,8 @@ void Context::initialize(ContextType contextType) {
 	debug(5, "OpenGL: Packed pixels support: %d", packedPixelsSupported);
 	debug(5, "OpenGL: Packed depth stencil support: %d", packedDepthStencilSupported);
 	debug(5, "OpenGL: Unpack subimage support: %d", unpackSubImageSupported);
+	debug(5, "OpenGL: Pixel buffer object support: %d", pixelBufferObjectSupported);
+	debug(5, "OpenGL: Map buffer range support: %d", mapBufferRangeSupported);
 	debug(5, "OpenGL: OpenGL ES depth 24 support: %d", OESDepth24);
 	debug(5, "OpenGL: Texture edge clamping support: %d", textureEdgeClampSupported);
 	debug(5, "OpenGL: Texture border clamping support: %d", textureBorderClampSupported);
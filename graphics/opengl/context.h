@@ -111,6 +111,12 @@ public:
 	/** Whether specifying a pitch when uploading to textures is available or not */
 	bool unpackSubImageSupported;
 
+	/** Whether pixel buffer objects can be used for texture uploads or not. */
+	bool pixelBufferObjectSupported;
+
+	/** Whether mapping a buffer object range is available or not. */
+	bool mapBufferRangeSupported;
+
 	/** Whether depth component 24 is supported or not */
 	bool OESDepth24;
 
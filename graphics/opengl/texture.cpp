@@ -34,7 +34,11 @@
 namespace OpenGL {
 
 Texture::Texture(GLenum glIntFormat, GLenum glFormat, GLenum glType, bool autoCreate)
-	: _glIntFormat(glIntFormat), _glFormat(glFormat), _glType(glType),
+	:
+#if defined(USE_GLAD)
+	  _streamBuffers(), _streamBufferSizes(), _streamBufferIndex(0),
+#endif
+	  _glIntFormat(glIntFormat), _glFormat(glFormat), _glType(glType),
 	  _width(0), _height(0), _logicalWidth(0), _logicalHeight(0),
 	  _flip(false), _rotation(Common::kRotationNormal),
 	  _texCoords(), _glFilter(GL_NEAREST), _glTexture(0) {
@@ -43,6 +47,11 @@ Texture::Texture(GLenum glIntFormat, GLenum glFormat, GLenum glType, bool autoCr
 }
 
 Texture::~Texture() {
+#if defined(USE_GLAD)
+	if (_streamBuffers[0]) {
+		GL_CALL_SAFE(glDeleteBuffers, (kStreamBufferCount, _streamBuffers));
+	}
+#endif
 	GL_CALL_SAFE(glDeleteTextures, (1, &_glTexture));
 }
 
@@ -106,6 +115,17 @@ void Texture::setWrapMode(WrapMode wrapMode) {
 }
 
 void Texture::destroy() {
+#if defined(USE_GLAD)
+	if (_streamBuffers[0]) {
+		GL_CALL(glDeleteBuffers(kStreamBufferCount, _streamBuffers));
+
+		for (uint i = 0; i < kStreamBufferCount; ++i) {
+			_streamBuffers[i] = 0;
+			_streamBufferSizes[i] = 0;
+		}
+	}
+#endif
+
 	if (!_glTexture) {
 		return;
 	}
@@ -253,26 +273,175 @@ void Texture::updateArea(const Common::Rect &area, const Graphics::Surface &src)
 	}
 
 	// Update the actual texture.
-	// Although we have the area of the texture buffer we want to update we
-	// cannot take advantage of the left/right boundaries here because it is
-	// not possible to specify a pitch to glTexSubImage2D. To be precise, with
-	// plain OpenGL we could set GL_UNPACK_ROW_LENGTH to achieve this. However,
-	// OpenGL ES 1.0 does not support GL_UNPACK_ROW_LENGTH. Thus, we are left
-	// with the following options:
-	//
-	// 1) (As we do right now) Simply always update the whole texture lines of
-	//    rect changed. This is simplest to implement. In case performance is
-	//    really an issue we can think of switching to another method.
-	//
-	// 2) Copy the dirty rect to a temporary buffer and upload that by using
-	//    glTexSubImage2D. This is what the Android backend does. It is more
-	//    complicated though.
-	//
-	// 3) Use glTexSubImage2D per line changed. This is what the old OpenGL
-	//    graphics manager did but it is much slower! Thus, we do not use it.
+	// glTexSubImage2D cannot take a pitch, so uploading a sub-rectangle
+	// needs either a tightly packed staging copy, GL_UNPACK_ROW_LENGTH (not
+	// available on OpenGL ES before 3.0 / EXT_unpack_subimage), or one call
+	// per line (what the old OpenGL graphics manager did; much slower).
 	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+	// For rectangles narrower than the full row, transfer only the dirty
+	// pixels instead of widening the upload to whole texture lines. The
+	// saved transfer bandwidth matters most on tile-based mobile GPUs,
+	// where memory traffic is the thermal limiter.
+	if (area.width() < (int16)_width) {
+		const uint rowBytes = area.width() * src.format.bytesPerPixel;
+
+#if defined(USE_GLAD)
+		// Pack just the rectangle into the stream buffer; this needs no
+		// pitch support from the context.
+		if (uploadThroughStreamBufferStrided((const byte *)src.getBasePtr(area.left, area.top),
+		                                     rowBytes, src.pitch, area.height())) {
+			GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top,
+			                        area.width(), area.height(), _glFormat, _glType, nullptr));
+			GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+			return;
+		}
+#endif
+
+		if (OpenGLContext.unpackSubImageSupported) {
+			GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, src.pitch / src.format.bytesPerPixel));
+			GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top,
+			                        area.width(), area.height(), _glFormat, _glType,
+			                        src.getBasePtr(area.left, area.top)));
+			GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+			return;
+		}
+
+		// No way to express the pitch; fall through to full rows.
+	}
+
+	const void *pixels = src.getBasePtr(0, area.top);
+
+#if defined(USE_GLAD)
+	// Stage the data in a pixel unpack buffer when the context allows it, so
+	// the upload becomes an asynchronous transfer out of driver memory. This
+	// avoids stalls on drivers which consume the client copy synchronously,
+	// tile-based mobile GPUs in particular.
+	const bool streamed = uploadThroughStreamBuffer(pixels, src.pitch * area.height());
+	if (streamed) {
+		// With a bound unpack buffer the pixel pointer is an offset into it.
+		pixels = nullptr;
+	}
+#endif
+
 	GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, area.top, src.w, area.height(),
-	                       _glFormat, _glType, src.getBasePtr(0, area.top)));
+	                       _glFormat, _glType, pixels));
+
+#if defined(USE_GLAD)
+	if (streamed) {
+		GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	}
+#endif
+}
+
+#if defined(USE_GLAD)
+// Uploads smaller than this go directly from client memory: for a few
+// kilobytes the buffer management overhead exceeds the copy it hides.
+enum {
+	kMinStreamUploadSize = 4096
+};
+
+void *Texture::mapStreamBuffer(uint size) {
+	if (!OpenGLContext.pixelBufferObjectSupported || !OpenGLContext.mapBufferRangeSupported) {
+		return nullptr;
+	}
+
+	if (size < kMinStreamUploadSize) {
+		return nullptr;
+	}
+
+	if (!_streamBuffers[0]) {
+		GL_CALL(glGenBuffers(kStreamBufferCount, _streamBuffers));
+	}
+
+	// Advance the ring. By the time a buffer comes around again the transfer
+	// it fed has been consumed for several frames, so mapping it does not
+	// have to wait on the GPU.
+	_streamBufferIndex = (_streamBufferIndex + 1) % kStreamBufferCount;
+
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _streamBuffers[_streamBufferIndex]));
+
+	// Allocate storage the first time around and when the dirty area grows.
+	if (_streamBufferSizes[_streamBufferIndex] < size) {
+		GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW));
+		_streamBufferSizes[_streamBufferIndex] = size;
+	}
+
+	// Invalidate lets the driver hand out fresh storage in case the old
+	// contents are still in flight after all, and unsynchronized spares it
+	// the stall check, so the map is just a pointer into driver memory.
+	void *dst = nullptr;
+	GL_ASSIGN(dst, glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+	                                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+	if (!dst) {
+		GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	}
+
+	return dst;
+}
+
+bool Texture::unmapStreamBuffer() {
+	GLboolean unmapped = GL_FALSE;
+	GL_ASSIGN(unmapped, glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+	if (!unmapped) {
+		// The buffer storage was lost while it was mapped; upload directly.
+		GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+		return false;
+	}
+
+	return true;
+}
+
+bool Texture::uploadThroughStreamBuffer(const void *data, uint size) {
+	void *dst = mapStreamBuffer(size);
+	if (!dst) {
+		return false;
+	}
+
+	memcpy(dst, data, size);
+
+	return unmapStreamBuffer();
+}
+
+bool Texture::uploadThroughStreamBufferStrided(const byte *data, uint rowBytes, uint pitch, uint rows) {
+	byte *dst = (byte *)mapStreamBuffer(rowBytes * rows);
+	if (!dst) {
+		return false;
+	}
+
+	for (uint y = 0; y < rows; ++y) {
+		memcpy(dst, data, rowBytes);
+		dst += rowBytes;
+		data += pitch;
+	}
+
+	return unmapStreamBuffer();
+}
+#endif
+
+TextureUploadBatch::TextureUploadBatch() {
+	// Reset every unpack mode that could make the driver reinterpret client
+	// memory, so individual uploads don't have to. The exotic modes only
+	// exist on desktop GL; ES contexts are fixed to the tight defaults.
+	if (OpenGLContext.type == kContextGL) {
+		GL_CALL(glPixelStorei(GL_UNPACK_SWAP_BYTES, GL_FALSE));
+		GL_CALL(glPixelStorei(GL_UNPACK_LSB_FIRST, GL_FALSE));
+		GL_CALL(glPixelStorei(GL_UNPACK_SKIP_ROWS, 0));
+		GL_CALL(glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0));
+	}
+	if (OpenGLContext.unpackSubImageSupported) {
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+	}
+	GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+}
+
+const byte *TextureUploadBatch::zeroBuffer(uint size) {
+	if (_zeroBuffer.size() < size) {
+		_zeroBuffer.resize(size);
+		memset(_zeroBuffer.begin(), 0, _zeroBuffer.size());
+	}
+
+	return _zeroBuffer.begin();
 }
 
 } // End of namespace OpenGL
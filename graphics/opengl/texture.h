@@ -28,6 +28,7 @@
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 #include "common/rotationmode.h"
 
@@ -177,6 +178,37 @@ public:
 protected:
 	void computeTexCoords();
 
+#if defined(USE_GLAD)
+	/**
+	 * Copy the pixel data into a pixel unpack buffer and leave it bound.
+	 *
+	 * When this succeeds the following glTexSubImage2D sources from
+	 * driver-owned memory and returns while the transfer is still in flight,
+	 * instead of stalling until the client copy has been consumed.
+	 *
+	 * @return Whether a buffer could be used; false means the caller has to
+	 *         upload directly from client memory.
+	 */
+	bool uploadThroughStreamBuffer(const void *data, uint size);
+
+	/**
+	 * Like uploadThroughStreamBuffer, but packs @p rows rows of @p rowBytes
+	 * bytes each, spaced @p pitch bytes apart in client memory, tightly into
+	 * the buffer. Used to upload narrow dirty rectangles without
+	 * transferring the untouched pixels around them.
+	 */
+	bool uploadThroughStreamBufferStrided(const byte *data, uint rowBytes, uint pitch, uint rows);
+
+	void *mapStreamBuffer(uint size);
+	bool unmapStreamBuffer();
+
+	enum { kStreamBufferCount = 3 };
+
+	GLuint _streamBuffers[kStreamBufferCount];
+	uint _streamBufferSizes[kStreamBufferCount];
+	uint _streamBufferIndex;
+#endif
+
 	const GLenum _glIntFormat;
 	const GLenum _glFormat;
 	const GLenum _glType;
@@ -193,6 +225,33 @@ protected:
 	GLuint _glTexture;
 };
 
+/**
+ * Scoped helper for uploading a run of textures in one go, e.g. while
+ * loading a scene.
+ *
+ * Engines that manage their own texture names can keep one of these alive
+ * for the duration of the batch: the constructor configures tight pixel
+ * unpack state once for every upload in the batch, and zeroBuffer() hands
+ * out a reusable cleared scratch buffer for padding textures rounded up to
+ * power-of-two sizes, so per-texture state churn and scratch allocations
+ * are avoided.
+ */
+class TextureUploadBatch {
+public:
+	TextureUploadBatch();
+
+	/**
+	 * Obtain a zero-filled scratch buffer of at least @p size bytes.
+	 *
+	 * The buffer is owned by the batch, must not be written to, and stays
+	 * valid until the batch is destroyed or a larger buffer is requested.
+	 */
+	const byte *zeroBuffer(uint size);
+
+private:
+	Common::Array<byte> _zeroBuffer;
+};
+
 } // End of namespace OpenGL
 
 #endif
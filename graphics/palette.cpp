@@ -190,14 +190,25 @@ void Palette::grab(Palette &p, uint start, uint num) const {
 
 PaletteLookup::PaletteLookup(): _palette(256) {
 	_paletteSize = 0;
+	_lookupTable = nullptr;
+	_lookupState = nullptr;
+	_lookupMethod = kColorDistanceRedmean;
 }
 
 PaletteLookup::PaletteLookup(const byte *palette, uint len) : _palette(256) {
 	_paletteSize = len;
+	_lookupTable = nullptr;
+	_lookupState = nullptr;
+	_lookupMethod = kColorDistanceRedmean;
 
 	_palette.set(palette, 0, len);
 }
 
+PaletteLookup::~PaletteLookup() {
+	delete[] _lookupTable;
+	delete[] _lookupState;
+}
+
 bool PaletteLookup::setPalette(const byte *palette, uint len)  {
 	// Check if the passed palette matched the one we have
 	if (len == _paletteSize && !memcmp(_palette.data(), palette, len * 3))
@@ -207,6 +218,9 @@ bool PaletteLookup::setPalette(const byte *palette, uint len)  {
 	_palette.set(palette, 0, len);
 	_colorHash.clear();
 
+	if (_lookupState)
+		memset(_lookupState, kBucketUnset, 32 * 32 * 32);
+
 	return true;
 }
 
@@ -216,6 +230,26 @@ byte PaletteLookup::findBestColor(byte cr, byte cg, byte cb, ColorDistanceMethod
 		return 0;
 	}
 
+	// Try the inverse colormap first: a classified bucket answers without
+	// scanning the palette and without growing the per-color hash.
+	if (!_lookupTable) {
+		_lookupTable = new byte[32 * 32 * 32];
+		_lookupState = new byte[32 * 32 * 32]();
+	}
+
+	if (method != _lookupMethod) {
+		memset(_lookupState, kBucketUnset, 32 * 32 * 32);
+		_lookupMethod = method;
+	}
+
+	uint bucket = ((cr >> 3) << 10) | ((cg >> 3) << 5) | (cb >> 3);
+
+	if (_lookupState[bucket] == kBucketUnset)
+		classifyBucket(bucket, method);
+
+	if (_lookupState[bucket] == kBucketExact)
+		return _lookupTable[bucket];
+
 	uint32 color = cr << 16 | cg << 8 | cb;
 
 	if (_colorHash.contains(color))
@@ -227,6 +261,102 @@ byte PaletteLookup::findBestColor(byte cr, byte cg, byte cb, ColorDistanceMethod
 	return bestColor;
 }
 
+// Smallest squared deviation of p from the interval [x0, x1]
+static inline int minDevSq(int p, int x0, int x1) {
+	if (p < x0)
+		return (x0 - p) * (x0 - p);
+	if (p > x1)
+		return (p - x1) * (p - x1);
+	return 0;
+}
+
+// Largest squared deviation of p from the interval [x0, x1]
+static inline int maxDevSq(int p, int x0, int x1) {
+	int m = MAX(x1 - p, p - x0);
+	return m * m;
+}
+
+void PaletteLookup::classifyBucket(uint bucket, ColorDistanceMethod method) {
+	const int r0 = (bucket >> 10) << 3, r1 = r0 + 7;
+	const int g0 = ((bucket >> 5) & 0x1F) << 3, g1 = g0 + 7;
+	const int b0 = (bucket & 0x1F) << 3, b1 = b0 + 7;
+
+	const uint best = _palette.findBestColor(r0 + 4, g0 + 4, b0 + 4, method);
+	const byte *pal = _palette.data();
+	const int bestR = pal[3 * best + 0], bestG = pal[3 * best + 1], bestB = pal[3 * best + 2];
+
+	// Upper bound of the best entry's distance anywhere in the bucket. The
+	// redmean weights depend on the red of the colors being compared, so
+	// they are bounded over the bucket's red range per entry; the other
+	// methods use fixed weights.
+	double maxBest;
+	{
+		const int mr = maxDevSq(bestR, r0, r1);
+		const int mg = maxDevSq(bestG, g0, g1);
+		const int mb = maxDevSq(bestB, b0, b1);
+
+		switch (method) {
+		case kColorDistanceNaive:
+			maxBest = 3.0 * mr + 5.0 * mg + 2.0 * mb;
+			break;
+		case kColorDistanceRedmean: {
+			const int rmeanMin = (bestR + r0) / 2, rmeanMax = (bestR + r1) / 2;
+			maxBest = (512.0 + rmeanMax) / 256.0 * mr + 4.0 * mg + (767.0 - rmeanMin) / 256.0 * mb;
+			break;
+		}
+		default:
+			maxBest = (double)mr + mg + mb;
+			break;
+		}
+	}
+
+	_lookupTable[bucket] = best;
+	_lookupState[bucket] = kBucketExact;
+
+	for (uint i = 0; i < _paletteSize; i++) {
+		if (i == best)
+			continue;
+
+		const int pr = pal[3 * i + 0], pg = pal[3 * i + 1], pb = pal[3 * i + 2];
+
+		// Exact duplicates of the best entry lose every tie to it, since
+		// the exhaustive search keeps the lowest index among equals.
+		if (pr == bestR && pg == bestG && pb == bestB)
+			continue;
+
+		const int mr = minDevSq(pr, r0, r1);
+		const int mg = minDevSq(pg, g0, g1);
+		const int mb = minDevSq(pb, b0, b1);
+
+		double lo;
+		double slack = 0.0;
+
+		switch (method) {
+		case kColorDistanceNaive:
+			lo = 3.0 * mr + 5.0 * mg + 2.0 * mb;
+			break;
+		case kColorDistanceRedmean: {
+			const int rmeanMin = (pr + r0) / 2, rmeanMax = (pr + r1) / 2;
+			lo = (512.0 + rmeanMin) / 256.0 * mr + 4.0 * mg + (767.0 - rmeanMax) / 256.0 * mb;
+			// The redmean path truncates two terms when shifting, which
+			// can lower a squared distance by up to 2.
+			slack = 2.0;
+			break;
+		}
+		default:
+			lo = (double)mr + mg + mb;
+			break;
+		}
+
+		// If another entry can come at least as close as the best entry's
+		// worst case, the bucket cannot answer for every color in it.
+		if (lo - slack <= maxBest) {
+			_lookupState[bucket] = kBucketAmbiguous;
+			break;
+		}
+	}
+}
+
 uint32 *PaletteLookup::createMap(const byte *srcPalette, uint len, ColorDistanceMethod method) {
 	if (len <= _paletteSize && memcmp(_palette.data(), srcPalette, len * 3) == 0)
 		return nullptr;
@@ -193,6 +193,7 @@ public:
 	 * @param len       the number of palette entries to be read
 	 */
 	PaletteLookup(const byte *palette, uint len);
+	~PaletteLookup();
 
 	/**
 	 * @brief Pass palette to the look up. It also compares given palette
@@ -228,9 +229,27 @@ public:
 	uint32 *createMap(const byte *srcPalette, uint len, ColorDistanceMethod method = kColorDistanceRedmean);
 
 private:
+	enum {
+		kBucketUnset = 0,    ///< bucket not classified yet
+		kBucketExact = 1,    ///< one entry is provably best for the whole bucket
+		kBucketAmbiguous = 2 ///< entries too close, use the exact per-color path
+	};
+
 	Palette _palette;
 	uint _paletteSize;
 	Common::HashMap<int, byte> _colorHash;
+
+	/**
+	 * Inverse colormap with 5 bits per channel, populated lazily. A bucket
+	 * only caches a result when that entry is provably the best match for
+	 * every color falling into the bucket, so lookups through it return
+	 * exactly what the exhaustive search would.
+	 */
+	byte *_lookupTable;
+	byte *_lookupState;
+	ColorDistanceMethod _lookupMethod;
+
+	void classifyBucket(uint bucket, ColorDistanceMethod method);
 };
 
 } //  // end of namespace Graphics
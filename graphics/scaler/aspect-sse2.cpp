@@ -0,0 +1,106 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+#include "graphics/scaler/aspect.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Graphics {
+
+/** Multiplies 32-bit lanes by a small constant (1, 3, 5 or 7). */
+static FORCEINLINE __m128i sse2_mulSmallConst(__m128i v, int k) {
+	__m128i r = v;
+	if (k & 2)
+		r = _mm_add_epi32(r, _mm_slli_epi32(v, 1));
+	if (k & 4)
+		r = _mm_add_epi32(r, _mm_slli_epi32(v, 2));
+	return r;
+}
+
+/**
+ * Blends one masked field of two pixels held in 32-bit lanes with weights
+ * k1:k2 out of 8. The red/blue and green fields are blended separately so
+ * the channel sums cannot bleed into each other, the same way the scalar
+ * interpolate16_7_1() and interpolate16_5_3() keep their channels apart.
+ */
+static FORCEINLINE __m128i sse2_blendField(__m128i p1, __m128i p2, __m128i mask, int k1, int k2) {
+	__m128i f1 = _mm_and_si128(p1, mask);
+	__m128i f2 = _mm_and_si128(p2, mask);
+	__m128i sum = _mm_add_epi32(sse2_mulSmallConst(f1, k1), sse2_mulSmallConst(f2, k2));
+	return _mm_and_si128(_mm_srli_epi32(sum, 3), mask);
+}
+
+void interpolate5LineSSE2(uint16 *dst, const uint16 *srcA, const uint16 *srcB, int width, int k1, int k2, uint32 rbMask, uint32 gMask) {
+	const __m128i rbMask4 = _mm_set1_epi32(rbMask);
+	const __m128i gMask4 = _mm_set1_epi32(gMask);
+	const __m128i zero = _mm_setzero_si128();
+
+	while (width >= 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *)srcA);
+		__m128i b = _mm_loadu_si128((const __m128i *)srcB);
+
+		// As in the scalar loops, the srcB line carries weight k1
+		__m128i p1 = _mm_unpacklo_epi16(b, zero);
+		__m128i p2 = _mm_unpacklo_epi16(a, zero);
+		__m128i lo = _mm_or_si128(sse2_blendField(p1, p2, rbMask4, k1, k2),
+		                          sse2_blendField(p1, p2, gMask4, k1, k2));
+
+		p1 = _mm_unpackhi_epi16(b, zero);
+		p2 = _mm_unpackhi_epi16(a, zero);
+		__m128i hi = _mm_or_si128(sse2_blendField(p1, p2, rbMask4, k1, k2),
+		                          sse2_blendField(p1, p2, gMask4, k1, k2));
+
+		// The results fit in 16 bits, so sign-extending before the
+		// saturating pack keeps them intact.
+		lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+		hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+		_mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(lo, hi));
+
+		dst += 8;
+		srcA += 8;
+		srcB += 8;
+		width -= 8;
+	}
+}
+
+} // End of namespace Graphics
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
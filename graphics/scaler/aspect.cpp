@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/system.h"
 #include "graphics/scaler/intern.h"
 #include "graphics/scaler/aspect.h"
 
@@ -96,8 +97,21 @@ static void interpolate5LineNeon(uint16 *dst, const uint16 *srcA, const uint16 *
 
 template<typename ColorMask, int scale>
 static void interpolate5Line(uint16 *dst, const uint16 *srcA, const uint16 *srcB, int width) {
+#ifdef SCUMMVM_SSE2
+	static bool useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+	if (useSSE2) {
+		int width8 = width & ~7;
+		Graphics::interpolate5LineSSE2(dst, srcA, srcB, width8, scale == 1 ? 7 : 5, scale == 1 ? 1 : 3,
+		                               ColorMask::kRedBlueMask, ColorMask::kGreenMask);
+		srcA += width8;
+		srcB += width8;
+		dst += width8;
+		width -= width8;
+	}
+#endif // SCUMMVM_SSE2
+
 	if (scale == 1) {
-#ifdef USE_NEON_ASPECT_CORRECTOR
+#ifdef USE_ARM_NEON_ASPECT_CORRECTOR
 		int width4 = width & ~3;
 		interpolate5LineNeon<ColorMask>(dst, srcA, srcB, width4, 7, 1);
 		srcA += width4;
@@ -258,6 +272,48 @@ int stretch200To240Interpolated(uint8 *buf, uint32 pitch, int width, int height,
 	return 1 + maxDstY - srcY;
 }
 
+#if ASPECT_MODE != kSuperFastAndUglyAspectMode
+template<typename ColorMask>
+static void stretchRow200To240Interpolated(uint8 *dstPtr, const uint8 *srcPtr, const uint8 *prevSrcPtr, int width, int dstY) {
+	switch (dstY % 6) {
+	case 0:
+	case 5:
+		memcpy(dstPtr, srcPtr, sizeof(uint16) * width);
+		break;
+	case 1:
+		interpolate5Line<ColorMask, 1>((uint16 *)dstPtr, (const uint16 *)prevSrcPtr, (const uint16 *)srcPtr, width);
+		break;
+	case 2:
+		interpolate5Line<ColorMask, 2>((uint16 *)dstPtr, (const uint16 *)prevSrcPtr, (const uint16 *)srcPtr, width);
+		break;
+	case 3:
+		interpolate5Line<ColorMask, 2>((uint16 *)dstPtr, (const uint16 *)srcPtr, (const uint16 *)prevSrcPtr, width);
+		break;
+	case 4:
+		interpolate5Line<ColorMask, 1>((uint16 *)dstPtr, (const uint16 *)srcPtr, (const uint16 *)prevSrcPtr, width);
+		break;
+	default:
+		break;
+	}
+}
+#endif
+
+void stretchRow200To240(uint8 *dstPtr, const uint8 *srcPtr, const uint8 *prevSrcPtr, int width, int dstY, bool interpolate, const Graphics::PixelFormat &format) {
+#if ASPECT_MODE != kSuperFastAndUglyAspectMode
+	if (interpolate && format.bytesPerPixel == 2) {
+		if (format.gLoss == 2) {
+			stretchRow200To240Interpolated<Graphics::ColorMasks<565> >(dstPtr, srcPtr, prevSrcPtr, width, dstY);
+			return;
+		} else if (format.gLoss == 3) {
+			stretchRow200To240Interpolated<Graphics::ColorMasks<555> >(dstPtr, srcPtr, prevSrcPtr, width, dstY);
+			return;
+		}
+	}
+#endif
+
+	memcpy(dstPtr, srcPtr, format.bytesPerPixel * width);
+}
+
 int stretch200To240(uint8 *buf, uint32 pitch, int width, int height, int srcX, int srcY, int origSrcY, bool interpolate, const Graphics::PixelFormat &format) {
 #if ASPECT_MODE != kSuperFastAndUglyAspectMode
 	if (interpolate && format.bytesPerPixel == 2) {
@@ -44,6 +44,17 @@ FORCEINLINE int aspect2Real(int y) {
  */
 void makeRectStretchable(int &x, int &y, int &w, int &h, bool interpolate);
 
+#ifdef SCUMMVM_SSE2
+namespace Graphics {
+/**
+ * SSE2 kernel blending two 16bpp scanlines with weights k1:k2 out of 8,
+ * bit-identical to interpolate16_7_1() / interpolate16_5_3(). Processes
+ * multiples of eight pixels; the caller handles the remainder.
+ */
+void interpolate5LineSSE2(uint16 *dst, const uint16 *srcA, const uint16 *srcB, int width, int k1, int k2, uint32 rbMask, uint32 gMask);
+} // End of namespace Graphics
+#endif
+
 /**
  * TODO: explain
  */
@@ -60,4 +71,14 @@ int stretch200To240(uint8 *buf,
 
 int stretch200To240Nearest(uint8 *buf, uint32 pitch, int width, int height, int srcX, int srcY, int origSrcY, const Graphics::PixelFormat &format);
 
+/**
+ * Write a single output scanline of the 1.2x vertical stretch. dstY is the
+ * absolute destination y coordinate (it selects the blend phase), srcPtr
+ * points to the unstretched scanline at aspect2Real(dstY) and prevSrcPtr to
+ * the scanline above it. Used by Scaler::scaleAndStretch200To240() to emit
+ * rows straight from a band buffer instead of re-reading the destination
+ * surface, with output identical to an in-place stretch200To240().
+ */
+void stretchRow200To240(uint8 *dstPtr, const uint8 *srcPtr, const uint8 *prevSrcPtr, int width, int dstY, bool interpolate, const Graphics::PixelFormat &format);
+
 #endif
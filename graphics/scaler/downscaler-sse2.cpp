@@ -0,0 +1,128 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+#include "graphics/scaler/downscaler.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Graphics {
+
+/**
+ * Scalar tail of the 2x2 box filter, identical to
+ * interpolate16_1_1_1_1() but with the low-bits mask as a runtime value.
+ */
+static inline uint16 boxAverage16(uint16 c1, uint16 c2, uint16 c3, uint16 c4, uint32 low2Bits) {
+	const uint32 lowbits = ((c1 & low2Bits)
+	                     +  (c2 & low2Bits)
+	                     +  (c3 & low2Bits)
+	                     +  (c4 & low2Bits)) & low2Bits;
+	return ((uint32)c1 + c2 + c3 + c4 - lowbits) >> 2;
+}
+
+/**
+ * Sums horizontally adjacent pairs of unsigned 16-bit pixels into 32-bit
+ * lanes. _mm_madd_epi16() treats its input as signed, so the top bit of
+ * each pixel is split off and added back in afterwards.
+ */
+static FORCEINLINE __m128i sse2_pairSum(__m128i v, __m128i ones) {
+	__m128i lo = _mm_and_si128(v, _mm_set1_epi16(0x7FFF));
+	__m128i hi = _mm_srli_epi16(v, 15);
+	return _mm_add_epi32(_mm_madd_epi16(lo, ones), _mm_slli_epi32(_mm_madd_epi16(hi, ones), 15));
+}
+
+/**
+ * Computes four 2x2 box averages from eight pixels of two source rows,
+ * as 32-bit lanes. Mirrors interpolate16_1_1_1_1(): the summed low bits
+ * are subtracted before the shift so channels do not bleed into each
+ * other.
+ */
+static FORCEINLINE __m128i sse2_boxAverage(__m128i row0, __m128i row1, __m128i lowMask16, __m128i lowMask32, __m128i ones) {
+	__m128i sum = _mm_add_epi32(sse2_pairSum(row0, ones), sse2_pairSum(row1, ones));
+	__m128i low = _mm_add_epi32(sse2_pairSum(_mm_and_si128(row0, lowMask16), ones),
+	                            sse2_pairSum(_mm_and_si128(row1, lowMask16), ones));
+	low = _mm_and_si128(low, lowMask32);
+	return _mm_srli_epi32(_mm_sub_epi32(sum, low), 2);
+}
+
+void downscaleAllByHalfSSE2(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, uint32 low2Bits) {
+	const __m128i lowMask16 = _mm_set1_epi16((int16)low2Bits);
+	const __m128i lowMask32 = _mm_set1_epi32(low2Bits);
+	const __m128i ones = _mm_set1_epi16(1);
+
+	// Eight output pixels are produced per iteration, from sixteen input
+	// pixels of both source rows.
+	const int simdWidth = width & ~15;
+
+	while ((height -= 2) >= 0) {
+		const uint16 *src1 = (const uint16 *)srcPtr;
+		const uint16 *src2 = (const uint16 *)(srcPtr + srcPitch);
+		uint16 *dst = (uint16 *)dstPtr;
+
+		int x = 0;
+		for (; x < simdWidth; x += 16) {
+			__m128i a0 = _mm_loadu_si128((const __m128i *)(src1 + x));
+			__m128i a1 = _mm_loadu_si128((const __m128i *)(src2 + x));
+			__m128i b0 = _mm_loadu_si128((const __m128i *)(src1 + x + 8));
+			__m128i b1 = _mm_loadu_si128((const __m128i *)(src2 + x + 8));
+
+			__m128i ra = sse2_boxAverage(a0, a1, lowMask16, lowMask32, ones);
+			__m128i rb = sse2_boxAverage(b0, b1, lowMask16, lowMask32, ones);
+
+			// Pack the 32-bit lanes back to pixels. The values fit in
+			// 16 bits, so sign-extending before the saturating pack
+			// keeps them intact.
+			ra = _mm_srai_epi32(_mm_slli_epi32(ra, 16), 16);
+			rb = _mm_srai_epi32(_mm_slli_epi32(rb, 16), 16);
+			_mm_storeu_si128((__m128i *)(dst + x / 2), _mm_packs_epi32(ra, rb));
+		}
+
+		for (; x < width; x += 2) {
+			dst[x / 2] = boxAverage16(src1[x], src1[x + 1], src2[x], src2[x + 1], low2Bits);
+		}
+
+		srcPtr += 2 * srcPitch;
+		dstPtr += dstPitch;
+	}
+}
+
+} // End of namespace Graphics
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
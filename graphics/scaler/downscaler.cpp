@@ -19,6 +19,7 @@
  *
  */
 #include "common/debug.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "graphics/scaler/downscaler.h"
 #include "graphics/scaler/intern.h"
@@ -65,6 +66,16 @@ void downscaleAllByHalfTemplate(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 }
 
 void downscaleAllByHalf(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr, uint32 dstPitch, int width, int height, int gBitFormat) {
+#ifdef SCUMMVM_SSE2
+	static bool useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+	if (useSSE2) {
+		const uint32 low2Bits = (gBitFormat == 565) ? (uint32)Graphics::ColorMasks<565>::kLow2Bits
+		                                            : (uint32)Graphics::ColorMasks<555>::kLow2Bits;
+		downscaleAllByHalfSSE2(srcPtr, srcPitch, dstPtr, dstPitch, width, height, low2Bits);
+		return;
+	}
+#endif
+
 	if (gBitFormat == 565)
 		downscaleAllByHalfTemplate<Graphics::ColorMasks<565> >(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
 	else
@@ -33,6 +33,17 @@ namespace Graphics {
 extern void downscaleAllByHalf(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
 			       uint32 dstPitch, int width, int height, int gBits = 565);
 
+#ifdef SCUMMVM_SSE2
+/**
+ * SSE2 variant of the 2x2 box filter behind downscaleAllByHalf() and the
+ * thumbnail scaler. Produces bit-identical output to the scalar code.
+ * low2Bits is the packed mask of the two low bits of every channel
+ * (ColorMasks<>::kLow2Bits).
+ */
+void downscaleAllByHalfSSE2(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
+			    uint32 dstPitch, int width, int height, uint32 low2Bits);
+#endif
+
 void downscaleSurfaceByHalf(Surface *out, const Surface *in, const byte *palette);
 
 }
@@ -25,6 +25,7 @@
 
 #include "graphics/colormasks.h"
 #include "graphics/scaler.h"
+#include "graphics/scaler/downscaler.h"
 #include "graphics/scaler/intern.h"
 #include "graphics/paletteman.h"
 #include "graphics/managed_surface.h"
@@ -46,6 +47,14 @@ void createThumbnail_2(const uint8 *src, uint32 srcPitch, uint8 *dstPtr, uint32
 	width &= ~1;
 	height &= ~1;
 
+#ifdef SCUMMVM_SSE2
+	static bool useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+	if (useSSE2) {
+		Graphics::downscaleAllByHalfSSE2(src, srcPitch, dstPtr, dstPitch, width, height, ColorMask::kLow2Bits);
+		return;
+	}
+#endif
+
 	for (int y = 0; y < height; y += 2) {
 		for (int x = 0; x < width; x += 2, dstPtr += 2) {
 			*((uint16 *)dstPtr) = quadBlockInterpolate<ColorMask>(src + 2 * x, srcPitch);
@@ -61,6 +70,17 @@ void createThumbnail_4(const uint8 *src, uint32 srcPitch, uint8 *dstPtr, uint32
 	width &= ~3;
 	height &= ~3;
 
+#ifdef SCUMMVM_SSE2
+	// Scaling by a quarter is the same truncating 2x2 average applied
+	// twice, so the result stays bit-identical to the scalar loop below.
+	static bool useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+	if (useSSE2) {
+		Graphics::downscaleAllByHalfSSE2(src, srcPitch, dstPtr, dstPitch, width, height, ColorMask::kLow2Bits);
+		Graphics::downscaleAllByHalfSSE2(dstPtr, dstPitch, dstPtr, dstPitch, width / 2, height / 2, ColorMask::kLow2Bits);
+		return;
+	}
+#endif
+
 	for (int y = 0; y < height; y += 4) {
 		for (int x = 0; x < width; x += 4, dstPtr += 2) {
 			uint16 upleft = quadBlockInterpolate<ColorMask>(src + 2 * x, srcPitch);
@@ -180,31 +200,42 @@ static bool grabScreen565(Graphics::Surface *surf) {
 
 	surf->create(screen->w, screen->h, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
 
+	// This runs synchronously at save time, so avoid per-pixel format
+	// conversion calls where we can: paletted screens get a precomputed
+	// 256-entry RGB565 table, and screens already in RGB565 are copied
+	// row by row.
 	byte *palette = 0;
+	uint16 paletteLut[256];
 	if (screenFormat.bytesPerPixel == 1) {
 		palette = new byte[256 * 3];
 		assert(palette);
 		g_system->getPaletteManager()->grabPalette(palette, 0, 256);
+		for (uint i = 0; i < 256; ++i)
+			paletteLut[i] = surf->format.RGBToColor(palette[i * 3 + 0], palette[i * 3 + 1], palette[i * 3 + 2]);
 	}
 
 	for (int y = 0; y < screen->h; ++y) {
-		for (int x = 0; x < screen->w; ++x) {
-			byte r = 0, g = 0, b = 0;
-
-			if (screenFormat.bytesPerPixel == 1) {
-				uint8 pixel = *(uint8 *)screen->getBasePtr(x, y);
-				r = palette[pixel * 3 + 0];
-				g = palette[pixel * 3 + 1];
-				b = palette[pixel * 3 + 2];
-			} else if (screenFormat.bytesPerPixel == 2) {
-				uint16 col = READ_UINT16(screen->getBasePtr(x, y));
-				screenFormat.colorToRGB(col, r, g, b);
-			} else if (screenFormat.bytesPerPixel == 4) {
-				uint32 col = READ_UINT32(screen->getBasePtr(x, y));
-				screenFormat.colorToRGB(col, r, g, b);
-			}
+		if (screenFormat.bytesPerPixel == 1) {
+			const uint8 *src = (const uint8 *)screen->getBasePtr(0, y);
+			uint16 *dst = (uint16 *)surf->getBasePtr(0, y);
+			for (int x = 0; x < screen->w; ++x)
+				*dst++ = paletteLut[*src++];
+		} else if (screenFormat == surf->format) {
+			memcpy(surf->getBasePtr(0, y), screen->getBasePtr(0, y), screen->w * 2);
+		} else {
+			for (int x = 0; x < screen->w; ++x) {
+				byte r = 0, g = 0, b = 0;
+
+				if (screenFormat.bytesPerPixel == 2) {
+					uint16 col = READ_UINT16(screen->getBasePtr(x, y));
+					screenFormat.colorToRGB(col, r, g, b);
+				} else if (screenFormat.bytesPerPixel == 4) {
+					uint32 col = READ_UINT32(screen->getBasePtr(x, y));
+					screenFormat.colorToRGB(col, r, g, b);
+				}
 
-			*((uint16 *)surf->getBasePtr(x, y)) = surf->format.RGBToColor(r, g, b);
+				*((uint16 *)surf->getBasePtr(x, y)) = surf->format.RGBToColor(r, g, b);
+			}
 		}
 	}
 
@@ -289,12 +320,19 @@ bool createScreenShot(Graphics::Surface &surf) {
 			return false;
 		}
 		surf.create(screen->w, screen->h, Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
-		for (int y = 0; y < screen->h; ++y) {
-			for (int x = 0; x < screen->w; ++x) {
-				byte r = 0, g = 0, b = 0, a = 0;
-				uint32 col = READ_UINT32(screen->getBasePtr(x, y));
-				screenFormat.colorToARGB(col, a, r, g, b);
-				*((uint32 *)surf.getBasePtr(x, y)) = surf.format.ARGBToColor(a, r, g, b);
+		if (screenFormat == surf.format) {
+			// The screen is already in ARGB8888, so copy it row by row
+			// instead of converting every pixel.
+			for (int y = 0; y < screen->h; ++y)
+				memcpy(surf.getBasePtr(0, y), screen->getBasePtr(0, y), screen->w * 4);
+		} else {
+			for (int y = 0; y < screen->h; ++y) {
+				for (int x = 0; x < screen->w; ++x) {
+					byte r = 0, g = 0, b = 0, a = 0;
+					uint32 col = READ_UINT32(screen->getBasePtr(x, y));
+					screenFormat.colorToARGB(col, a, r, g, b);
+					*((uint32 *)surf.getBasePtr(x, y)) = surf.format.ARGBToColor(a, r, g, b);
+				}
 			}
 		}
 		g_system->unlockScreen();
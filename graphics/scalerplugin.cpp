@@ -20,7 +20,62 @@
 
 #include "graphics/scalerplugin.h"
 
+#include "common/config-manager.h"
+#include "common/threadpool.h"
+#include "common/util.h"
+
+#ifdef USE_ASPECT
+#include "graphics/scaler/aspect.h"
+#endif
+
 namespace {
+
+// Source rows below which slicing is not worth the synchronization cost.
+enum { kMinRowsPerSlice = 32 };
+
+/**
+ * Returns the worker pool used for sliced scaling, or nullptr if the
+ * user disabled it with scaler_threads=1 (0 or absence means one thread
+ * per logical CPU). The default case uses the shared process-wide pool;
+ * an explicit scaler_threads > 1 gets a private pool of that size.
+ */
+Common::ThreadPool *scalerThreadPool() {
+	static Common::ThreadPool *pool = nullptr;
+	static bool initialized = false;
+
+	if (!initialized) {
+		initialized = true;
+		const int threads = ConfMan.hasKey("scaler_threads") ? ConfMan.getInt("scaler_threads") : 0;
+		if (threads <= 0) {
+			Common::ThreadPool &shared = Common::ThreadPool::instance();
+			// No thread support leaves the shared pool empty; the serial
+			// path is just as good then.
+			if (shared.workerCount() > 0)
+				pool = &shared;
+		} else if (threads > 1) {
+			pool = new Common::ThreadPool(threads);
+			if (pool->workerCount() == 0) {
+				delete pool;
+				pool = nullptr;
+			}
+		}
+	}
+	return pool;
+}
+
+struct SliceArgs {
+	Scaler *scaler;
+	const uint8 *srcPtr;
+	uint32 srcPitch;
+	uint8 *dstPtr;
+	uint32 dstPitch;
+	int width, height;
+	int x, y;
+	int rowsPerSlice;
+	int sliceCount;
+	uint factor;
+};
+
 /**
  * Trivial 'scaler' - in fact it doesn't do any scaling but just copies the
  * source to the destination.
@@ -52,11 +107,100 @@ void Scaler::scale(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
 		} else {
 			Normal1x<uint32>(srcPtr, srcPitch, dstPtr, dstPitch, width, height);
 		}
+	} else if (canScaleSliced() && height >= 2 * kMinRowsPerSlice && scalerThreadPool() != nullptr) {
+		scaleSliced(srcPtr, srcPitch, dstPtr, dstPitch, width, height, x, y);
 	} else {
 		scaleIntern(srcPtr, srcPitch, dstPtr, dstPitch, width, height, x, y);
 	}
 }
 
+#ifdef USE_ASPECT
+int Scaler::scaleAndStretch200To240(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
+	                           uint32 dstPitch, int width, int height, int x, int y,
+	                           int origDstY, bool interpolate) {
+	const int bpp = _format.bytesPerPixel;
+	const int scaledWidth = width * _factor;
+	const uint32 bandPitch = scaledWidth * bpp;
+	const int dstY = real2Aspect(origDstY);
+	const int maxDstY = real2Aspect(origDstY + height * _factor - 1);
+
+	// The scaled rows are produced in bands small enough to stay cache
+	// resident until the stretch has consumed them. kBandSrcRows is in
+	// unscaled source rows; band row 0 always holds the scaled row just
+	// above the current band, for the blends that straddle band seams.
+	const int kBandSrcRows = 8;
+	_stretchBuffer.resize((kBandSrcRows * _factor + 1) * bandPitch);
+	byte *band = _stretchBuffer.begin();
+
+	// For the first band the row above the rect is the destination row
+	// above it, which is also what the in-place stretch blends with there.
+	if (dstY > 0)
+		memcpy(band, dstPtr - dstPitch, bandPitch);
+
+	int outY = dstY;
+	for (int sy = 0; sy < height; sy += kBandSrcRows) {
+		const int rows = MIN(kBandSrcRows, height - sy);
+		const int bandStart = origDstY + sy * _factor;
+		const int bandEnd = bandStart + rows * _factor;
+
+		scale(srcPtr + sy * srcPitch, srcPitch, band + bandPitch, bandPitch, width, rows, x, y + sy);
+
+		while (outY <= maxDstY) {
+			const int srcRow = aspect2Real(outY);
+			if (srcRow >= bandEnd)
+				break;
+			const byte *bandRow = band + (srcRow - bandStart + 1) * bandPitch;
+			stretchRow200To240(dstPtr, bandRow, bandRow - bandPitch, scaledWidth, outY, interpolate, _format);
+			dstPtr += dstPitch;
+			outY++;
+		}
+
+		// Carry the last scaled row over to the next band
+		memcpy(band, band + rows * _factor * bandPitch, bandPitch);
+	}
+
+	return 1 + maxDstY - dstY;
+}
+#endif
+
+void Scaler::scaleSliceProc(void *data, uint index) {
+	SliceArgs *args = (SliceArgs *)data;
+
+	const int startRow = index * args->rowsPerSlice;
+	int rows = args->rowsPerSlice;
+	if ((int)index == args->sliceCount - 1)
+		rows = args->height - startRow;
+
+	args->scaler->scaleIntern(args->srcPtr + startRow * args->srcPitch, args->srcPitch,
+	                          args->dstPtr + startRow * args->factor * args->dstPitch, args->dstPitch,
+	                          args->width, rows, args->x, args->y + startRow);
+}
+
+// Splits the rect into horizontal bands and scales them on the worker
+// pool. Only reached when canScaleSliced() returned true, i.e. the
+// concurrent scaleIntern() calls share nothing but read-only state and
+// the (disjoint) destination bands.
+void Scaler::scaleSliced(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
+                         uint32 dstPitch, int width, int height, int x, int y) {
+	Common::ThreadPool *pool = scalerThreadPool();
+
+	SliceArgs args;
+	args.scaler = this;
+	args.srcPtr = srcPtr;
+	args.srcPitch = srcPitch;
+	args.dstPtr = dstPtr;
+	args.dstPitch = dstPitch;
+	args.width = width;
+	args.height = height;
+	args.x = x;
+	args.y = y;
+	args.sliceCount = MIN<int>(pool->workerCount() + 1, height / kMinRowsPerSlice);
+	args.rowsPerSlice = height / args.sliceCount;
+	args.factor = _factor;
+
+	pool->runTasks(scaleSliceProc, &args, args.sliceCount);
+}
+
 SourceScaler::SourceScaler(const Graphics::PixelFormat &format) : Scaler(format), _width(0), _height(0), _oldSrc(NULL), _enable(false) {
 }
 
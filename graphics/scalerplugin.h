@@ -45,6 +45,28 @@ public:
 	void scale(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
 	           uint32 dstPitch, int width, int height, int x, int y);
 
+#ifdef USE_ASPECT
+	/**
+	 * Composed variant of scale() for aspect-ratio corrected output.
+	 * Scales into a small cache-resident band buffer and writes the
+	 * vertically stretched rows straight to dstPtr, so the scaled image
+	 * never makes a full round trip through the destination surface. The
+	 * output is identical to scale() followed by an in-place
+	 * stretch200To240().
+	 *
+	 * @param dstPtr      Destination of the first output row, i.e. at
+	 *                    y coordinate real2Aspect(origDstY).
+	 * @param origDstY    Absolute destination y coordinate the scaled rect
+	 *                    would have without aspect-ratio correction; it
+	 *                    selects the blend phase of the stretch.
+	 * @param interpolate Blend inserted lines instead of repeating them.
+	 * @return The height of the stretched output in rows.
+	 */
+	int scaleAndStretch200To240(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
+	           uint32 dstPitch, int width, int height, int x, int y,
+	           int origDstY, bool interpolate);
+#endif
+
 	/**
 	 * Increase the factor of scaling.
 	 * @return The new factor
@@ -101,8 +123,28 @@ protected:
 	virtual void scaleIntern(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
 	                         uint32 dstPitch, int width, int height, int x, int y) = 0;
 
+	/**
+	 * Whether scaleIntern() may safely be called concurrently on disjoint
+	 * horizontal bands of the same rect. Only scalers whose state is
+	 * read-only while scaling (e.g. lookup tables) should return true;
+	 * scalers with per-instance scratch buffers must keep the default.
+	 *
+	 * When true, scale() may split large rects into bands and process
+	 * them on a worker pool.
+	 */
+	virtual bool canScaleSliced() const { return false; }
+
 	uint _factor;
 	Graphics::PixelFormat _format;
+
+private:
+	void scaleSliced(const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
+	                 uint32 dstPitch, int width, int height, int x, int y);
+	static void scaleSliceProc(void *data, uint index);
+
+#ifdef USE_ASPECT
+	Common::Array<byte> _stretchBuffer;
+#endif
 };
 
 /**
@@ -137,9 +137,19 @@ void FontSJISBase::blitCharacter(const uint8 *glyph, const int w, const int h, u
 
 		bitPos &= _bitPosNewLineMask;
 		for (int x = 0; x < w; ++x) {
-			if (!(bitPos % 8))
+			if (!(bitPos % 8)) {
 				mask = *glyph++;
 
+				// Glyphs are mostly transparent; step over all 8 pixels
+				// of an empty byte at once.
+				if (!mask && x + 8 <= w) {
+					d += 8;
+					bitPos += 8;
+					x += 7;
+					continue;
+				}
+			}
+
 			if (mask & 0x80)
 				*d = c;
 
@@ -182,6 +192,20 @@ void FontSJISBase::createOutline(uint8 *outline, const uint8 *glyph, const int w
 	}
 }
 
+const uint8 *FontSJISBase::getOutline(uint16 ch, const uint8 *glyph, const int w, const int h) const {
+	OutlineCacheEntry &entry = _outlineCache[ch & (kOutlineCacheSize - 1)];
+	const uint32 key = ((uint32)ch << 2) | (_fatPrint ? 2 : 0) | (_flippedMode ? 1 : 0);
+
+	if (entry.key != key) {
+		assert(((w + 9) / 8) * (h + 2) <= (int)sizeof(entry.data));
+		memset(entry.data, 0, sizeof(entry.data));
+		createOutline(entry.data, glyph, w, h);
+		entry.key = key;
+	}
+
+	return entry.data;
+}
+
 #ifndef DISABLE_FLIPPED_MODE
 const uint8 *FontSJISBase::flipCharacter(const uint8 *glyph, const int w) const {
 	static const uint8 flipData[] = {
@@ -276,10 +300,17 @@ void FontSJISBase::drawChar(void *dst, uint16 ch, int pitch, int bpp, uint32 c1,
 #endif
 
 	int shadowOffset = bpp;
-	uint8 outline[18 * 18];
+	uint8 outlineBuf[18 * 18];
+	const uint8 *outline = outlineBuf;
 	if (_drawMode == kOutlineMode) {
-		memset(outline, 0, sizeof(outline));
-		createOutline(outline, glyphSource, width, height);
+		if (outlineXOffset || outlineYOffset) {
+			// Clipped characters get their outline composed ad hoc, the
+			// cache only holds full-size outlines.
+			memset(outlineBuf, 0, sizeof(outlineBuf));
+			createOutline(outlineBuf, glyphSource, width, height);
+		} else {
+			outline = getOutline(ch, glyphSource, width, height);
+		}
 	} else if (_drawMode == kShadowLeftMode) {
 		shadowOffset = -shadowOffset;
 	}
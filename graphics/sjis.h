@@ -174,6 +174,23 @@ private:
 	template<typename Color>
 	void blitCharacter(const uint8 *glyph, const int w, const int h, uint8 *dst, int pitch, Color c) const;
 	void createOutline(uint8 *outline, const uint8 *glyph, const int w, const int h) const;
+	const uint8 *getOutline(uint16 ch, const uint8 *glyph, const int w, const int h) const;
+
+	// Composed outline bitmaps, so that redrawing the same text (dialog
+	// boxes are typically redrawn every frame) does not redo the outline
+	// pass per character. Direct-mapped, keyed on character and print mode.
+	enum {
+		kOutlineCacheSize = 256
+	};
+
+	struct OutlineCacheEntry {
+		uint32 key;
+		uint8 data[18 * 3];
+
+		OutlineCacheEntry() : key(0xFFFFFFFF) {}
+	};
+
+	mutable OutlineCacheEntry _outlineCache[kOutlineCacheSize];
 
 #ifndef DISABLE_FLIPPED_MODE
 	// This is used in the FM-Towns version of Monkey Island 1
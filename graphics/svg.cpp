@@ -34,7 +34,7 @@
 namespace Graphics {
 
 SVGBitmap::SVGBitmap(Common::SeekableReadStream *in, int dw, int dh)
-	: ManagedSurface(dw, dh, PIXELFORMAT) {
+	: ManagedSurface(dw, dh, PIXELFORMAT), _svg(nullptr) {
 	if (dw == 0 || dh == 0)
 		return;
 
@@ -44,24 +44,37 @@ SVGBitmap::SVGBitmap(Common::SeekableReadStream *in, int dw, int dh)
 	in->read(data, size);
 	data[size] = '\0';
 
-	NSVGimage *svg = nsvgParse(data, "px", 96);
-	if (svg == NULL)
+	_svg = nsvgParse(data, "px", 96);
+	if (_svg == NULL)
 		error("Cannot parse SVG image");
 
 	delete[] data;
 	data = nullptr;
 
+	render(dw, dh);
+}
+
+SVGBitmap::~SVGBitmap() {
+	nsvgDelete(_svg);
+}
+
+void SVGBitmap::render(int dw, int dh) {
+	if (!_svg || dw == 0 || dh == 0)
+		return;
+
+	if (w != dw || h != dh)
+		create(dw, dh, PIXELFORMAT);
+
 	// Maintain aspect ratio
-	float xRatio = 1.0f * dw / svg->width;
-	float yRatio = 1.0f * dh / svg->height;
+	float xRatio = 1.0f * dw / _svg->width;
+	float yRatio = 1.0f * dh / _svg->height;
 	float ratio = xRatio < yRatio ? xRatio : yRatio;
 
 	NSVGrasterizer *rasterizer = nsvgCreateRasterizer();
 
-	nsvgRasterize(rasterizer, svg, 0, 0, ratio, (byte *)getPixels(), dw, dh, pitch);
+	nsvgRasterize(rasterizer, _svg, 0, 0, ratio, (byte *)getPixels(), dw, dh, pitch);
 
 	nsvgDeleteRasterizer(rasterizer);
-	nsvgDelete(svg);
 }
 
 } // end of namespace Graphics
@@ -23,6 +23,8 @@
 
 #include "graphics/managed_surface.h"
 
+struct NSVGimage;
+
 namespace Common {
 class SeekableReadStream;
 }
@@ -31,10 +33,20 @@ namespace Graphics {
 
 /**
  * A derived graphics surface, which renders bitmap data from a SVG stream.
+ *
+ * The parsed image is kept around, so the bitmap can be re-rendered at
+ * another size without going through the SVG parser again.
  */
 class SVGBitmap : public ManagedSurface {
 public:
 	SVGBitmap(Common::SeekableReadStream *in, int dw, int dh);
+	~SVGBitmap() override;
+
+	/** Rasterizes the parsed image again, resizing the surface to dw x dh. */
+	void render(int dw, int dh);
+
+private:
+	NSVGimage *_svg;
 };
 
 } // end of namespace Graphics
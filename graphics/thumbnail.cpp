@@ -257,27 +257,36 @@ bool saveThumbnail(Common::WriteStream &out, const Graphics::Surface &thumb) {
 	out.writeByte(thumb.format.bShift);
 	out.writeByte(thumb.format.aShift);
 
-	// Serialize the pixel data
+	// Serialize the pixel data. Each row is byte-swapped into a temporary
+	// buffer and written in one call; thumbnails are written during saves,
+	// so a stream call per pixel is a real cost.
+	const uint rowSize = thumb.w * thumb.format.bytesPerPixel;
+	byte *row = new byte[rowSize];
 	for (int y = 0; y < thumb.h; ++y) {
+		byte *dst = row;
 		switch (thumb.format.bytesPerPixel) {
 		case 2: {
 			const uint16 *pixels = (const uint16 *)thumb.getBasePtr(0, y);
 			for (int x = 0; x < thumb.w; ++x) {
-				out.writeUint16BE(*pixels++);
+				WRITE_BE_UINT16(dst, *pixels++);
+				dst += 2;
 			}
 			} break;
 
 		case 4: {
 			const uint32 *pixels = (const uint32 *)thumb.getBasePtr(0, y);
 			for (int x = 0; x < thumb.w; ++x) {
-				out.writeUint32BE(*pixels++);
+				WRITE_BE_UINT32(dst, *pixels++);
+				dst += 4;
 			}
 			} break;
 
 		default:
 			assert(0);
 		}
+		out.write(row, rowSize);
 	}
+	delete[] row;
 
 	return true;
 }
@@ -44,78 +44,89 @@ void GLContext::glopArrayElement(GLParam *param) {
 	int idx = param[1].i;
 
 	if (states & COLOR_ARRAY) {
-		GLParam p[5];
 		int size = color_array_size;
 		offset = idx * color_array_stride;
-		switch (color_array_type) {
-		case TGL_UNSIGNED_BYTE: {
-				TGLubyte *array = (TGLubyte *)color_array + offset;
-				p[1].f = NORLALIZE_UBYTE(array[0]);
-				p[2].f = NORLALIZE_UBYTE(array[1]);
-				p[3].f = NORLALIZE_UBYTE(array[2]);
-				p[4].f = size > 3 ? NORLALIZE_UBYTE(array[3]) : 1.0f;
-				break;
-			}
-		case TGL_BYTE: {
-				TGLbyte *array = (TGLbyte *)color_array + offset;
-				p[1].f = NORLALIZE_SBYTE(array[0]);
-				p[2].f = NORLALIZE_SBYTE(array[1]);
-				p[3].f = NORLALIZE_SBYTE(array[2]);
-				p[4].f = size > 3 ? NORLALIZE_SBYTE(array[3]) : 1.0f;
-				break;
-			}
-		case TGL_UNSIGNED_INT: {
-				TGLuint *array = (TGLuint *)((TGLbyte *)color_array + offset);
-				p[1].f = NORLALIZE_UINT(array[0]);
-				p[2].f = NORLALIZE_UINT(array[1]);
-				p[3].f = NORLALIZE_UINT(array[2]);
-				p[4].f = size > 3 ? NORLALIZE_UINT(array[3]) : 1.0f;
-				break;
-			}
-		case TGL_INT: {
-				TGLint *array = (TGLint *)((TGLbyte *)color_array + offset);
-				p[1].f = NORLALIZE_SINT(array[0]);
-				p[2].f = NORLALIZE_SINT(array[1]);
-				p[3].f = NORLALIZE_SINT(array[2]);
-				p[4].f = size > 3 ? NORLALIZE_SINT(array[3]) : 1.0f;
-				break;
-			}
-		case TGL_UNSIGNED_SHORT: {
-				TGLushort *array = (TGLushort *)((TGLbyte *)color_array + offset);
-				p[1].f = NORLALIZE_USHORT(array[0]);
-				p[2].f = NORLALIZE_USHORT(array[1]);
-				p[3].f = NORLALIZE_USHORT(array[2]);
-				p[4].f = size > 3 ? NORLALIZE_USHORT(array[3]) : 1.0f;
-				break;
-			}
-		case TGL_SHORT: {
-				TGLshort *array = (TGLshort *)((TGLbyte *)color_array + offset);
-				p[1].f = NORLALIZE_SSHORT(array[0]);
-				p[2].f = NORLALIZE_SSHORT(array[1]);
-				p[3].f = NORLALIZE_SSHORT(array[2]);
-				p[4].f = size > 3 ? NORLALIZE_SSHORT(array[3]) : 1.0f;
-				break;
-			}
-		case TGL_FLOAT: {
-				TGLfloat *array = (TGLfloat *)((TGLbyte *)color_array + offset);
-				p[1].f = array[0];
-				p[2].f = array[1];
-				p[3].f = array[2];
-				p[4].f = size > 3 ? array[3] : 1.0f;
-				break;
-			}
-		case TGL_DOUBLE: {
-				TGLdouble *array = (TGLdouble *)((TGLbyte *)color_array + offset);
-				p[1].f = array[0];
-				p[2].f = array[1];
-				p[3].f = array[2];
-				p[4].f = size > 3 ? array[3] : 1.0f;
-				break;
+		if (color_array_type == TGL_FLOAT && !color_material_enabled) {
+			// Float colors are what the 3D engines feed us; store them
+			// directly instead of packing a GLParam block and going through
+			// glopColor() for every vertex.
+			TGLfloat *array = (TGLfloat *)((TGLbyte *)color_array + offset);
+			current_color.X = array[0];
+			current_color.Y = array[1];
+			current_color.Z = array[2];
+			current_color.W = size > 3 ? array[3] : 1.0f;
+		} else {
+			GLParam p[5];
+			switch (color_array_type) {
+			case TGL_UNSIGNED_BYTE: {
+					TGLubyte *array = (TGLubyte *)color_array + offset;
+					p[1].f = NORLALIZE_UBYTE(array[0]);
+					p[2].f = NORLALIZE_UBYTE(array[1]);
+					p[3].f = NORLALIZE_UBYTE(array[2]);
+					p[4].f = size > 3 ? NORLALIZE_UBYTE(array[3]) : 1.0f;
+					break;
+				}
+			case TGL_BYTE: {
+					TGLbyte *array = (TGLbyte *)color_array + offset;
+					p[1].f = NORLALIZE_SBYTE(array[0]);
+					p[2].f = NORLALIZE_SBYTE(array[1]);
+					p[3].f = NORLALIZE_SBYTE(array[2]);
+					p[4].f = size > 3 ? NORLALIZE_SBYTE(array[3]) : 1.0f;
+					break;
+				}
+			case TGL_UNSIGNED_INT: {
+					TGLuint *array = (TGLuint *)((TGLbyte *)color_array + offset);
+					p[1].f = NORLALIZE_UINT(array[0]);
+					p[2].f = NORLALIZE_UINT(array[1]);
+					p[3].f = NORLALIZE_UINT(array[2]);
+					p[4].f = size > 3 ? NORLALIZE_UINT(array[3]) : 1.0f;
+					break;
+				}
+			case TGL_INT: {
+					TGLint *array = (TGLint *)((TGLbyte *)color_array + offset);
+					p[1].f = NORLALIZE_SINT(array[0]);
+					p[2].f = NORLALIZE_SINT(array[1]);
+					p[3].f = NORLALIZE_SINT(array[2]);
+					p[4].f = size > 3 ? NORLALIZE_SINT(array[3]) : 1.0f;
+					break;
+				}
+			case TGL_UNSIGNED_SHORT: {
+					TGLushort *array = (TGLushort *)((TGLbyte *)color_array + offset);
+					p[1].f = NORLALIZE_USHORT(array[0]);
+					p[2].f = NORLALIZE_USHORT(array[1]);
+					p[3].f = NORLALIZE_USHORT(array[2]);
+					p[4].f = size > 3 ? NORLALIZE_USHORT(array[3]) : 1.0f;
+					break;
+				}
+			case TGL_SHORT: {
+					TGLshort *array = (TGLshort *)((TGLbyte *)color_array + offset);
+					p[1].f = NORLALIZE_SSHORT(array[0]);
+					p[2].f = NORLALIZE_SSHORT(array[1]);
+					p[3].f = NORLALIZE_SSHORT(array[2]);
+					p[4].f = size > 3 ? NORLALIZE_SSHORT(array[3]) : 1.0f;
+					break;
+				}
+			case TGL_FLOAT: {
+					TGLfloat *array = (TGLfloat *)((TGLbyte *)color_array + offset);
+					p[1].f = array[0];
+					p[2].f = array[1];
+					p[3].f = array[2];
+					p[4].f = size > 3 ? array[3] : 1.0f;
+					break;
+				}
+			case TGL_DOUBLE: {
+					TGLdouble *array = (TGLdouble *)((TGLbyte *)color_array + offset);
+					p[1].f = array[0];
+					p[2].f = array[1];
+					p[3].f = array[2];
+					p[4].f = size > 3 ? array[3] : 1.0f;
+					break;
+				}
+			default:
+				assert(0);
 			}
-		default:
-			assert(0);
+			glopColor(p);
 		}
-		glopColor(p);
 	}
 	if (states & NORMAL_ARRAY) {
 		offset = idx * normal_array_stride;
@@ -259,22 +270,29 @@ void GLContext::glopDrawElements(GLParam *p) {
 	begin[1].i = p[1].i;
 
 	glopBegin(begin);
-	for (int i = 0; i < p[2].i; i++) {
-		switch (p[3].i) {
-		case TGL_UNSIGNED_BYTE:
+	// Dispatch on the index type once instead of once per vertex.
+	switch (p[3].i) {
+	case TGL_UNSIGNED_BYTE:
+		for (int i = 0; i < p[2].i; i++) {
 			array_element[1].i = ((TGLbyte *)indices)[i];
-			break;
-		case TGL_UNSIGNED_SHORT:
+			glopArrayElement(array_element);
+		}
+		break;
+	case TGL_UNSIGNED_SHORT:
+		for (int i = 0; i < p[2].i; i++) {
 			array_element[1].i = ((TGLshort *)indices)[i];
-			break;
-		case TGL_UNSIGNED_INT:
+			glopArrayElement(array_element);
+		}
+		break;
+	case TGL_UNSIGNED_INT:
+		for (int i = 0; i < p[2].i; i++) {
 			array_element[1].i = ((TGLint *)indices)[i];
-			break;
-		default:
-			assert(0);
-			break;
+			glopArrayElement(array_element);
 		}
-		glopArrayElement(array_element);
+		break;
+	default:
+		assert(0);
+		break;
 	}
 	glopEnd(nullptr);
 }
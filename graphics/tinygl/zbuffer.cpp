@@ -30,6 +30,8 @@
 #include "common/scummsys.h"
 #include "common/endian.h"
 #include "common/memory.h"
+#include "common/threadpool.h"
+#include "common/util.h"
 
 #include "graphics/tinygl/zbuffer.h"
 #include "graphics/tinygl/zgl.h"
@@ -56,13 +58,241 @@ FrameBuffer::FrameBuffer(int width, int height, const Graphics::PixelFormat &for
 	_currentTexture = nullptr;
 
 	_clippingEnabled = false;
+
+	_ownsBuffers = true;
+	_batchingTriangles = false;
+	_triangleBatchSize = 0;
+	_rasterPool = nullptr;
+	_triedRasterPool = false;
+	_bandCount = 0;
+}
+
+FrameBuffer::FrameBuffer(const FrameBuffer *master) {
+	_pbufWidth = master->_pbufWidth;
+	_pbufHeight = master->_pbufHeight;
+	_pbufFormat = master->_pbufFormat;
+	_pbufBpp = master->_pbufBpp;
+	_pbufPitch = master->_pbufPitch;
+	_offscreenBuffer = master->_offscreenBuffer;
+	_enableStencil = master->_enableStencil;
+
+	_ownsBuffers = false;
+	_batchingTriangles = false;
+	_triangleBatchSize = 0;
+	_rasterPool = nullptr;
+	_triedRasterPool = true;
+	_bandCount = 0;
+
+	TriangleRasterState state;
+	master->saveRasterState(state);
+	loadRasterState(state);
 }
 
 FrameBuffer::~FrameBuffer() {
-	gl_free(_pbuf);
-	gl_free(_zbuf);
-	if (_sbuf)
-		gl_free(_sbuf);
+	for (uint i = 0; i < _bandBuffers.size(); i++)
+		delete _bandBuffers[i];
+
+	if (_ownsBuffers) {
+		gl_free(_pbuf);
+		gl_free(_zbuf);
+		if (_sbuf)
+			gl_free(_sbuf);
+	}
+}
+
+void FrameBuffer::saveRasterState(TriangleRasterState &state) const {
+	state.pbuf = _pbuf;
+	state.zbuf = _zbuf;
+	state.sbuf = _sbuf;
+	state.clipRectangle = _clipRectangle;
+	state.clippingEnabled = _clippingEnabled;
+	state.texture = _currentTexture;
+	state.wrapS = _wrapS;
+	state.wrapT = _wrapT;
+	state.textureSize = _textureSize;
+	state.textureSizeMask = _textureSizeMask;
+	state.blendingEnabled = _blendingEnabled;
+	state.sourceBlendingFactor = _sourceBlendingFactor;
+	state.destinationBlendingFactor = _destinationBlendingFactor;
+	state.alphaTestEnabled = _alphaTestEnabled;
+	state.alphaTestFunc = _alphaTestFunc;
+	state.alphaTestRefVal = _alphaTestRefVal;
+	state.depthTestEnabled = _depthTestEnabled;
+	state.depthWrite = _depthWrite;
+	state.depthFunc = _depthFunc;
+	state.stencilTestEnabled = _stencilTestEnabled;
+	state.stencilTestFunc = _stencilTestFunc;
+	state.stencilRefVal = _stencilRefVal;
+	state.stencilMask = _stencilMask;
+	state.stencilWriteMask = _stencilWriteMask;
+	state.stencilSfail = _stencilSfail;
+	state.stencilDpfail = _stencilDpfail;
+	state.stencilDppass = _stencilDppass;
+	state.polygonStippleEnabled = _polygonStippleEnabled;
+	state.polygonStipplePattern = _polygonStipplePattern;
+	state.offsetStates = _offsetStates;
+	state.offsetFactor = _offsetFactor;
+	state.offsetUnits = _offsetUnits;
+	state.fogEnabled = _fogEnabled;
+	state.fogColorR = _fogColorR;
+	state.fogColorG = _fogColorG;
+	state.fogColorB = _fogColorB;
+}
+
+void FrameBuffer::loadRasterState(const TriangleRasterState &state) {
+	_pbuf = state.pbuf;
+	_zbuf = state.zbuf;
+	_sbuf = state.sbuf;
+	_clipRectangle = state.clipRectangle;
+	_clippingEnabled = state.clippingEnabled;
+	_currentTexture = state.texture;
+	_wrapS = state.wrapS;
+	_wrapT = state.wrapT;
+	_textureSize = state.textureSize;
+	_textureSizeMask = state.textureSizeMask;
+	_blendingEnabled = state.blendingEnabled;
+	_sourceBlendingFactor = state.sourceBlendingFactor;
+	_destinationBlendingFactor = state.destinationBlendingFactor;
+	_alphaTestEnabled = state.alphaTestEnabled;
+	_alphaTestFunc = state.alphaTestFunc;
+	_alphaTestRefVal = state.alphaTestRefVal;
+	_depthTestEnabled = state.depthTestEnabled;
+	_depthWrite = state.depthWrite;
+	_depthFunc = state.depthFunc;
+	_stencilTestEnabled = state.stencilTestEnabled;
+	_stencilTestFunc = state.stencilTestFunc;
+	_stencilRefVal = state.stencilRefVal;
+	_stencilMask = state.stencilMask;
+	_stencilWriteMask = state.stencilWriteMask;
+	_stencilSfail = state.stencilSfail;
+	_stencilDpfail = state.stencilDpfail;
+	_stencilDppass = state.stencilDppass;
+	_polygonStippleEnabled = state.polygonStippleEnabled;
+	_polygonStipplePattern = state.polygonStipplePattern;
+	_offsetStates = state.offsetStates;
+	_offsetFactor = state.offsetFactor;
+	_offsetUnits = state.offsetUnits;
+	_fogEnabled = state.fogEnabled;
+	_fogColorR = state.fogColorR;
+	_fogColorG = state.fogColorG;
+	_fogColorB = state.fogColorB;
+}
+
+void FrameBuffer::startTriangleBatch() {
+	if (!_triedRasterPool) {
+		_triedRasterPool = true;
+		// Use the shared pool so that rasterization does not oversubscribe
+		// the CPU against other sliced work in the same frame.
+		Common::ThreadPool &pool = Common::ThreadPool::instance();
+		if (pool.workerCount() > 0)
+			_rasterPool = &pool;
+	}
+
+	// Without a pool there is nothing to gain from the batching detour.
+	if (_rasterPool)
+		_batchingTriangles = true;
+}
+
+void FrameBuffer::batchTriangle(int kind, const ZBufferPoint *p0, const ZBufferPoint *p1, const ZBufferPoint *p2) {
+	if (_triangleBatchSize == _triangleBatch.size())
+		_triangleBatch.push_back(BatchedTriangle());
+	BatchedTriangle &tri = _triangleBatch[_triangleBatchSize++];
+	tri.kind = kind;
+	tri.p0 = *p0;
+	tri.p1 = *p1;
+	tri.p2 = *p2;
+	saveRasterState(tri.state);
+}
+
+void FrameBuffer::rasterizeBandTask(void *data, uint index) {
+	FrameBuffer *master = (FrameBuffer *)data;
+	int bandTop = master->_pbufHeight * index / master->_bandCount;
+	int bandBottom = master->_pbufHeight * (index + 1) / master->_bandCount;
+	master->_bandBuffers[index]->rasterizeBand(bandTop, bandBottom,
+			master->_triangleBatch.begin(), master->_triangleBatchSize);
+}
+
+void FrameBuffer::rasterizeBand(int bandTop, int bandBottom, const BatchedTriangle *batch, uint count) {
+	const Common::Rect bandRect(0, bandTop, _pbufWidth, bandBottom);
+
+	for (uint i = 0; i < count; i++) {
+		const BatchedTriangle &tri = batch[i];
+
+		// Early out for triangles that do not reach into this band, which
+		// is the common case once the framebuffer is split finely enough.
+		int minY = MIN(tri.p0.y, MIN(tri.p1.y, tri.p2.y));
+		int maxY = MAX(tri.p0.y, MAX(tri.p1.y, tri.p2.y));
+		if (maxY < bandTop || minY >= bandBottom)
+			continue;
+
+		loadRasterState(tri.state);
+		if (tri.state.clippingEnabled)
+			_clipRectangle = tri.state.clipRectangle.findIntersectingRect(bandRect);
+		else
+			_clipRectangle = bandRect;
+		if (_clipRectangle.isEmpty())
+			continue;
+		_clippingEnabled = true;
+
+		// The rasterizer scribbles on the temporary mapping coordinates of
+		// its input points, so hand it per-band copies.
+		ZBufferPoint p0 = tri.p0, p1 = tri.p1, p2 = tri.p2;
+		switch (tri.kind) {
+		case kTriangleDepthOnly:
+			fillTriangleDepthOnly(&p0, &p1, &p2);
+			break;
+		case kTriangleFlat:
+			fillTriangleFlat(&p0, &p1, &p2);
+			break;
+		case kTriangleSmooth:
+			fillTriangleSmooth(&p0, &p1, &p2);
+			break;
+		case kTriangleTextureSmooth:
+			fillTriangleTextureMappingPerspectiveSmooth(&p0, &p1, &p2);
+			break;
+		case kTriangleTextureFlat:
+			fillTriangleTextureMappingPerspectiveFlat(&p0, &p1, &p2);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+void FrameBuffer::flushTriangleBatch() {
+	if (_triangleBatchSize == 0)
+		return;
+
+	// The band buffers rasterize through the regular fillTriangle*()
+	// entry points; keep those from re-batching while we replay.
+	const bool wasBatching = _batchingTriangles;
+	_batchingTriangles = false;
+
+	uint bands = _rasterPool ? _rasterPool->workerCount() + 1 : 1;
+	// Very small buffers are not worth splitting.
+	const uint maxBands = MAX(1, _pbufHeight / 16);
+	if (bands > maxBands)
+		bands = maxBands;
+
+	if (bands <= 1) {
+		TriangleRasterState saved;
+		saveRasterState(saved);
+		rasterizeBand(0, _pbufHeight, _triangleBatch.begin(), _triangleBatchSize);
+		loadRasterState(saved);
+	} else {
+		while (_bandBuffers.size() < bands)
+			_bandBuffers.push_back(new FrameBuffer(this));
+		_bandCount = bands;
+		_rasterPool->runTasks(rasterizeBandTask, this, bands);
+	}
+
+	_triangleBatchSize = 0;
+	_batchingTriangles = wasBatching;
+}
+
+void FrameBuffer::endTriangleBatch() {
+	flushTriangleBatch();
+	_batchingTriangles = false;
 }
 
 Buffer *FrameBuffer::genOffscreenBuffer() {
@@ -80,6 +310,7 @@ void FrameBuffer::delOffscreenBuffer(Buffer *buf) {
 
 void FrameBuffer::clear(int clearZ, int z, int clearColor, int r, int g, int b,
                         bool clearStencil, int stencilValue) {
+	flushTriangleBatch();
 	if (_clippingEnabled) {
 		clearRegion(_clipRectangle.left, _clipRectangle.top,
 				_clipRectangle.width(), _clipRectangle.height(),
@@ -128,6 +359,7 @@ void FrameBuffer::clear(int clearZ, int z, int clearColor, int r, int g, int b,
 
 void FrameBuffer::clearRegion(int x, int y, int w, int h, bool clearZ, int z,
                               bool clearColor, int r, int g, int b, bool clearStencil, int stencilValue) {
+	flushTriangleBatch();
 	if (clearZ) {
 		int height = h;
 		uint *zbuf = _zbuf + (y * _pbufWidth) + x;
@@ -196,6 +428,7 @@ inline static void blitPixel(uint8 offset, uint *from_z, uint *to_z, uint z_leng
 }
 
 void FrameBuffer::blitOffscreenBuffer(Buffer *buf) {
+	flushTriangleBatch();
 	// TODO: could be faster, probably.
 #define UNROLL_COUNT 16
 	if (buf->used) {
@@ -251,6 +484,7 @@ void FrameBuffer::blitOffscreenBuffer(Buffer *buf) {
 }
 
 void FrameBuffer::selectOffscreenBuffer(Buffer *buf) {
+	flushTriangleBatch();
 	if (buf) {
 		_pbuf = buf->pbuf;
 		_zbuf = buf->zbuf;
@@ -262,6 +496,7 @@ void FrameBuffer::selectOffscreenBuffer(Buffer *buf) {
 }
 
 void FrameBuffer::clearOffscreenBuffer(Buffer *buf) {
+	flushTriangleBatch();
 	memset(buf->pbuf, 0, _pbufHeight * _pbufPitch);
 	memset(buf->zbuf, 0, _pbufHeight * _pbufWidth * sizeof(uint));
 	buf->used = false;
@@ -32,9 +32,14 @@
 #include "graphics/tinygl/texelbuffer.h"
 #include "graphics/tinygl/gl.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 #include "common/textconsole.h"
 
+namespace Common {
+class ThreadPool;
+}
+
 namespace TinyGL {
 
 // Z buffer
@@ -569,6 +574,32 @@ public:
 	void clearRegion(int x, int y, int w, int h, bool clearZ, int z,
 	                 bool clearColor, int r, int g, int b, bool clearStencil, int stencilValue);
 
+	/**
+	 * Start collecting filled triangles instead of rasterizing them right
+	 * away, so that a whole frame worth of them can be rasterized in
+	 * parallel by flushTriangleBatch(). While batching is active, any
+	 * operation that touches the buffers through another path (lines,
+	 * points, blits, clears) flushes the pending triangles first, which
+	 * keeps the pixel-level ordering identical to immediate rasterization.
+	 *
+	 * Batching stays disabled on single-core systems and on platforms
+	 * without thread support, in which case these calls are no-ops and
+	 * triangles are rasterized immediately as before.
+	 */
+	void startTriangleBatch();
+
+	/**
+	 * Rasterize all pending batched triangles. The framebuffer is split
+	 * into horizontal bands, one per thread; every thread walks the whole
+	 * batch in submission order and rasterizes the part of each triangle
+	 * that falls into its band, so each pixel is written by exactly one
+	 * thread and in the same order as with immediate rasterization.
+	 */
+	void flushTriangleBatch();
+
+	/** Flush any pending triangles and stop batching. */
+	void endTriangleBatch();
+
 	const Common::Rect &getClippingRectangle() const {
 		return _clipRectangle;
 	}
@@ -690,6 +721,69 @@ public:
 
 private:
 
+	/**
+	 * Snapshot of every piece of state the triangle rasterizer consumes,
+	 * taken when a triangle is batched and loaded again when it is
+	 * rasterized. The buffer pointers are part of the state because
+	 * shadow rendering redirects them mid-frame through
+	 * selectOffscreenBuffer().
+	 */
+	struct TriangleRasterState {
+		byte *pbuf;
+		uint *zbuf;
+		byte *sbuf;
+		Common::Rect clipRectangle;
+		bool clippingEnabled;
+		const TexelBuffer *texture;
+		uint wrapS, wrapT;
+		int textureSize, textureSizeMask;
+		bool blendingEnabled;
+		int sourceBlendingFactor;
+		int destinationBlendingFactor;
+		bool alphaTestEnabled;
+		int alphaTestFunc, alphaTestRefVal;
+		bool depthTestEnabled, depthWrite;
+		int depthFunc;
+		bool stencilTestEnabled;
+		int stencilTestFunc, stencilRefVal;
+		uint stencilMask, stencilWriteMask;
+		int stencilSfail, stencilDpfail, stencilDppass;
+		bool polygonStippleEnabled;
+		const byte *polygonStipplePattern;
+		int offsetStates;
+		float offsetFactor, offsetUnits;
+		bool fogEnabled;
+		float fogColorR, fogColorG, fogColorB;
+	};
+
+	enum TriangleKind {
+		kTriangleDepthOnly,
+		kTriangleFlat,
+		kTriangleSmooth,
+		kTriangleTextureSmooth,
+		kTriangleTextureFlat
+	};
+
+	struct BatchedTriangle {
+		int kind;
+		ZBufferPoint p0, p1, p2;
+		TriangleRasterState state;
+	};
+
+	/**
+	 * Band rasterizer constructor: shares the pixel, depth and stencil
+	 * buffers of the given framebuffer but carries its own rasterization
+	 * state, so that each band thread can replay the batched state
+	 * without touching the others.
+	 */
+	explicit FrameBuffer(const FrameBuffer *master);
+
+	void saveRasterState(TriangleRasterState &state) const;
+	void loadRasterState(const TriangleRasterState &state);
+	void batchTriangle(int kind, const ZBufferPoint *p0, const ZBufferPoint *p1, const ZBufferPoint *p2);
+	void rasterizeBand(int bandTop, int bandBottom, const BatchedTriangle *batch, uint count);
+	static void rasterizeBandTask(void *data, uint index);
+
 	/**
 	* Blit the buffer to the screen buffer, checking the depth of the pixels.
 	* Eack pixel is copied if and only if its depth value is bigger than the
@@ -773,6 +867,18 @@ private:
 	template <bool kInterpRGB, bool kInterpZ, bool kDepthWrite, bool kEnableScissor>
 	void drawLine(const ZBufferPoint *p1, const ZBufferPoint *p2);
 
+	template <bool kInterpRGB, bool kInterpZ, bool kDepthWrite, bool kEnableScissor>
+	void drawHorizontalLine(const ZBufferPoint *p1, const ZBufferPoint *p2);
+
+	bool _ownsBuffers;
+	bool _batchingTriangles;
+	Common::Array<BatchedTriangle> _triangleBatch; ///< storage reused between frames
+	uint _triangleBatchSize;
+	Common::ThreadPool *_rasterPool; ///< the shared pool, or nullptr when serial; not owned
+	bool _triedRasterPool;
+	Common::Array<FrameBuffer *> _bandBuffers;
+	uint _bandCount;
+
 	Buffer _offscreenBuffer;
 	byte *_pbuf;
 	int _pbufWidth;
@@ -190,7 +190,9 @@ void GLContext::presentBufferDirtyRects(Common::List<Common::Rect> &dirtyAreas)
 			dirtyAreas.push_back(rect.rectangle);
 		}
 
-		// Execute draw calls.
+		// Execute draw calls. Triangles are batched up and rasterized
+		// across multiple threads when the buffer is presented.
+		fb->startTriangleBatch();
 		for (auto &drawCall : _drawCallsQueue) {
 			Common::Rect drawCallRegion = drawCall->getDirtyRegion();
 			for (auto &rect : rectangles) {
@@ -200,6 +202,7 @@ void GLContext::presentBufferDirtyRects(Common::List<Common::Rect> &dirtyAreas)
 				}
 			}
 		}
+		fb->endTriangleBatch();
 
 		if (_debugRectsEnabled) {
 			// Draw debug rectangles.
@@ -236,10 +239,14 @@ void GLContext::presentBufferDirtyRects(Common::List<Common::Rect> &dirtyAreas)
 void GLContext::presentBufferSimple(Common::List<Common::Rect> &dirtyAreas) {
 	dirtyAreas.push_back(Common::Rect(fb->getPixelBufferWidth(), fb->getPixelBufferHeight()));
 
+	// Triangles are batched up and rasterized across multiple threads
+	// when the buffer is presented.
+	fb->startTriangleBatch();
 	for (const auto &drawCall : _drawCallsQueue) {
 		drawCall->execute(true);
 		delete drawCall;
 	}
+	fb->endTriangleBatch();
 
 	_drawCallsQueue.clear();
 
@@ -581,6 +588,10 @@ BlittingDrawCall::~BlittingDrawCall() {
 }
 
 void BlittingDrawCall::execute(bool restoreState, const Common::Rect *clippingRectangle) const {
+	// Blits write to the framebuffer directly, so any triangles batched
+	// by earlier draw calls have to be rasterized first.
+	gl_get_context()->fb->flushTriangleBatch();
+
 	BlittingState backupState;
 	if (restoreState) {
 		backupState = captureState();
@@ -58,14 +58,107 @@ FORCEINLINE void FrameBuffer::putPixel(uint pixelOffset, int color, int x, int y
 
 template <bool kInterpRGB, bool kInterpZ, bool kDepthWrite>
 void FrameBuffer::drawLine(const ZBufferPoint *p1, const ZBufferPoint *p2) {
-	if (_clippingEnabled)
-		drawLine<kInterpRGB, kInterpZ, kDepthWrite, true>(p1, p2);
-	else
+	if (_clippingEnabled) {
+		// A line whose endpoints are both inside the clip rectangle never
+		// leaves it, so the per-pixel scissor test can be dropped.
+		if (_clipRectangle.contains(p1->x, p1->y) && _clipRectangle.contains(p2->x, p2->y))
+			drawLine<kInterpRGB, kInterpZ, kDepthWrite, false>(p1, p2);
+		else
+			drawLine<kInterpRGB, kInterpZ, kDepthWrite, true>(p1, p2);
+	} else
 		drawLine<kInterpRGB, kInterpZ, kDepthWrite, false>(p1, p2);
 }
 
+// Horizontal lines cover contiguous pixels and depth values, so they are
+// clipped once up front and run without the per-pixel scissor test and
+// Bresenham bookkeeping. Wireframe-heavy scenes are dominated by them.
+template <bool kInterpRGB, bool kInterpZ, bool kDepthWrite, bool kEnableScissor>
+void FrameBuffer::drawHorizontalLine(const ZBufferPoint *p1, const ZBufferPoint *p2) {
+	const int y = p1->y;
+	const int inc_x = p1->x < p2->x ? 1 : -1;
+	int n = abs(p2->x - p1->x);
+
+	if (kInterpZ && n == 0)
+		return;
+
+	if (kEnableScissor && (y < _clipRectangle.top || y >= _clipRectangle.bottom))
+		return;
+
+	int r = p1->r >> (ZB_POINT_RED_BITS - 8);
+	int g = p1->g >> (ZB_POINT_GREEN_BITS - 8);
+	int b = p1->b >> (ZB_POINT_BLUE_BITS - 8);
+	unsigned int z = 0;
+	int sz = 0, sr = 0, sg = 0, sb = 0;
+
+	if (kInterpZ) {
+		sz = (p2->z - p1->z) / n;
+		z = p1->z;
+	}
+	if (kInterpRGB) {
+		sr = ((p2->r - p1->r) / n) >> (ZB_POINT_RED_BITS - 8);
+		sg = ((p2->g - p1->g) / n) >> (ZB_POINT_GREEN_BITS - 8);
+		sb = ((p2->b - p1->b) / n) >> (ZB_POINT_BLUE_BITS - 8);
+	}
+
+	// Trim the run to the clip rectangle, stepping the interpolants over
+	// the skipped pixels in one multiply each.
+	int x = p1->x;
+	if (kEnableScissor) {
+		int skip = 0;
+		if (inc_x > 0) {
+			if (x < _clipRectangle.left)
+				skip = _clipRectangle.left - x;
+			if (n > _clipRectangle.right - x)
+				n = _clipRectangle.right - x;
+		} else {
+			if (x >= _clipRectangle.right)
+				skip = x - (_clipRectangle.right - 1);
+			if (n > x - _clipRectangle.left + 1)
+				n = x - _clipRectangle.left + 1;
+		}
+		if (skip >= n)
+			return;
+		x += skip * inc_x;
+		n -= skip;
+		if (kInterpZ)
+			z += skip * sz;
+		if (kInterpRGB) {
+			r += skip * sr;
+			g += skip * sg;
+			b += skip * sb;
+		}
+	}
+
+	uint pixelOffset = y * _pbufWidth + x;
+	uint *pz = _zbuf + pixelOffset;
+	int color = RGB_TO_PIXEL(r, g, b);
+
+	while (n-- > 0) {
+		if (kInterpZ) {
+			if (compareDepth(z, *pz))
+				writePixel<true, true, kDepthWrite>(pixelOffset, color, z);
+			pz += inc_x;
+			z += sz;
+		} else {
+			writePixel<true, true>(pixelOffset, color);
+		}
+		pixelOffset += inc_x;
+		if (kInterpRGB) {
+			r += sr;
+			g += sg;
+			b += sb;
+			color = RGB_TO_PIXEL(r, g, b);
+		}
+	}
+}
+
 template <bool kInterpRGB, bool kInterpZ, bool kDepthWrite, bool kEnableScissor>
 void FrameBuffer::drawLine(const ZBufferPoint *p1, const ZBufferPoint *p2) {
+	if (p1->y == p2->y) {
+		drawHorizontalLine<kInterpRGB, kInterpZ, kDepthWrite, kEnableScissor>(p1, p2);
+		return;
+	}
+
 	// Based on Bresenham's line algorithm, as implemented in
 	// https://rosettacode.org/wiki/Bitmap/Bresenham%27s_line_algorithm#C
 	// with a loop exit condition based on the (unidimensional) taxicab
@@ -143,6 +236,8 @@ void FrameBuffer::drawLine(const ZBufferPoint *p1, const ZBufferPoint *p2) {
 }
 
 void FrameBuffer::plot(ZBufferPoint *p) {
+	// Points are not batched, so pending triangles have to land first.
+	flushTriangleBatch();
 	const uint pixelOffset = p->y * _pbufWidth + p->x;
 	const int col = RGB_TO_PIXEL(p->r, p->g, p->b);
 	const uint z = p->z;
@@ -183,6 +278,8 @@ void FrameBuffer::fillLineInterp(ZBufferPoint *p1, ZBufferPoint *p2) {
 }
 
 void FrameBuffer::fillLineZ(ZBufferPoint *p1, ZBufferPoint *p2) {
+	// Lines are not batched, so pending triangles have to land first.
+	flushTriangleBatch();
 	// choose if the line should have its color interpolated or not
 	if (p1->r == p2->r && p1->g == p2->g && p1->b == p2->b)
 		fillLineFlatZ(p1, p2);
@@ -191,6 +288,8 @@ void FrameBuffer::fillLineZ(ZBufferPoint *p1, ZBufferPoint *p2) {
 }
 
 void FrameBuffer::fillLine(ZBufferPoint *p1, ZBufferPoint *p2) {
+	// Lines are not batched, so pending triangles have to land first.
+	flushTriangleBatch();
 	// choose if the line should have its color interpolated or not
 	if (p1->r == p2->r && p1->g == p2->g && p1->b == p2->b)
 		fillLineFlat(p1, p2);
@@ -449,7 +449,10 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 		// we draw all the scan line of the part
 		while (nb_lines > 0) {
 			int x = x1;
-			if (!kInterpRGB) {
+			if (kEnableScissor && (y < _clipRectangle.top || y >= _clipRectangle.bottom)) {
+				// The whole scan line is clipped away; only the edge
+				// interpolators below need to be stepped.
+			} else if (!kInterpRGB) {
 				int n;
 				uint *pz;
 				byte *ps = nullptr;
@@ -749,6 +752,10 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 }
 
 void FrameBuffer::fillTriangleDepthOnly(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
+	if (_batchingTriangles) {
+		batchTriangle(kTriangleDepthOnly, p0, p1, p2);
+		return;
+	}
 	const bool interpZ = true;
 	const bool interpRGB = false;
 	const bool interpST = false;
@@ -761,6 +768,10 @@ void FrameBuffer::fillTriangleDepthOnly(ZBufferPoint *p0, ZBufferPoint *p1, ZBuf
 }
 
 void FrameBuffer::fillTriangleFlat(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
+	if (_batchingTriangles) {
+		batchTriangle(kTriangleFlat, p0, p1, p2);
+		return;
+	}
 	const bool interpZ = true;
 	const bool interpRGB = true;
 	const bool interpST = false;
@@ -774,6 +785,10 @@ void FrameBuffer::fillTriangleFlat(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPo
 
 // Smooth filled triangle.
 void FrameBuffer::fillTriangleSmooth(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
+	if (_batchingTriangles) {
+		batchTriangle(kTriangleSmooth, p0, p1, p2);
+		return;
+	}
 	const bool interpZ = true;
 	const bool interpRGB = true;
 	const bool interpST = false;
@@ -786,6 +801,10 @@ void FrameBuffer::fillTriangleSmooth(ZBufferPoint *p0, ZBufferPoint *p1, ZBuffer
 }
 
 void FrameBuffer::fillTriangleTextureMappingPerspectiveSmooth(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
+	if (_batchingTriangles) {
+		batchTriangle(kTriangleTextureSmooth, p0, p1, p2);
+		return;
+	}
 	const bool interpZ = true;
 	const bool interpRGB = true;
 	const bool interpST = true;
@@ -798,6 +817,10 @@ void FrameBuffer::fillTriangleTextureMappingPerspectiveSmooth(ZBufferPoint *p0,
 }
 
 void FrameBuffer::fillTriangleTextureMappingPerspectiveFlat(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
+	if (_batchingTriangles) {
+		batchTriangle(kTriangleTextureFlat, p0, p1, p2);
+		return;
+	}
 	const bool interpZ = true;
 	const bool interpRGB = true;
 	const bool interpST = false;
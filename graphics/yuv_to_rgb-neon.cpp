@@ -0,0 +1,216 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "graphics/yuv_to_rgb.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Graphics {
+
+/**
+ * Turn eight Y+chroma sums into eight clipped channel values, matching
+ * the scalar clip table bit for bit.
+ *
+ * For the full luminance scale the table is a plain [0, 255] clamp. For
+ * the ITU scale it clamps to [16, 235] and rescales with
+ * (x - 16) * 255 / 219; the division is done with a 16-bit multiply-high
+ * by 299 (~2^16 / 219), which can undershoot the exact quotient by one,
+ * so the remainder is checked and the quotient fixed up.
+ */
+template<bool kITU>
+static FORCEINLINE uint16x8_t neon_clipChannel(int16x8_t y, int16x8_t chroma, int16x8_t lossCount) {
+	int16x8_t x = vaddq_s16(y, chroma);
+	if (kITU) {
+		x = vmaxq_s16(x, vdupq_n_s16(16));
+		x = vminq_s16(x, vdupq_n_s16(235));
+		x = vsubq_s16(x, vdupq_n_s16(16));
+		uint16x8_t ux = vreinterpretq_u16_s16(x);
+		uint16x8_t x255 = vsubq_u16(vshlq_n_u16(ux, 8), ux);
+		uint32x4_t lo = vmull_u16(vget_low_u16(x255), vdup_n_u16(299));
+		uint32x4_t hi = vmull_u16(vget_high_u16(x255), vdup_n_u16(299));
+		uint16x8_t q = vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16));
+		uint16x8_t rem = vsubq_u16(x255, vmulq_u16(q, vdupq_n_u16(219)));
+		// The compare mask is all ones, so subtracting it adds the fixup
+		q = vsubq_u16(q, vcgtq_u16(rem, vdupq_n_u16(218)));
+		return vshlq_u16(q, lossCount);
+	} else {
+		x = vmaxq_s16(x, vdupq_n_s16(0));
+		x = vminq_s16(x, vdupq_n_s16(255));
+		return vshlq_u16(vreinterpretq_u16_s16(x), lossCount);
+	}
+}
+
+template<typename PixelInt>
+static FORCEINLINE void neon_storePixels(byte *dst, uint16x8_t r, uint16x8_t g, uint16x8_t b,
+                                         byte rShift, byte gShift, byte bShift, uint32 aMask);
+
+template<>
+FORCEINLINE void neon_storePixels<uint16>(byte *dst, uint16x8_t r, uint16x8_t g, uint16x8_t b,
+                                          byte rShift, byte gShift, byte bShift, uint32 aMask) {
+	uint16x8_t pix = vorrq_u16(vdupq_n_u16((uint16)aMask), vshlq_u16(r, vdupq_n_s16(rShift)));
+	pix = vorrq_u16(pix, vshlq_u16(g, vdupq_n_s16(gShift)));
+	pix = vorrq_u16(pix, vshlq_u16(b, vdupq_n_s16(bShift)));
+	vst1q_u16((uint16 *)dst, pix);
+}
+
+template<>
+FORCEINLINE void neon_storePixels<uint32>(byte *dst, uint16x8_t r, uint16x8_t g, uint16x8_t b,
+                                          byte rShift, byte gShift, byte bShift, uint32 aMask) {
+	uint32x4_t lo = vorrq_u32(vdupq_n_u32(aMask), vshlq_u32(vmovl_u16(vget_low_u16(r)), vdupq_n_s32(rShift)));
+	lo = vorrq_u32(lo, vshlq_u32(vmovl_u16(vget_low_u16(g)), vdupq_n_s32(gShift)));
+	lo = vorrq_u32(lo, vshlq_u32(vmovl_u16(vget_low_u16(b)), vdupq_n_s32(bShift)));
+	vst1q_u32((uint32 *)dst, lo);
+	uint32x4_t hi = vorrq_u32(vdupq_n_u32(aMask), vshlq_u32(vmovl_u16(vget_high_u16(r)), vdupq_n_s32(rShift)));
+	hi = vorrq_u32(hi, vshlq_u32(vmovl_u16(vget_high_u16(g)), vdupq_n_s32(gShift)));
+	hi = vorrq_u32(hi, vshlq_u32(vmovl_u16(vget_high_u16(b)), vdupq_n_s32(bShift)));
+	vst1q_u32((uint32 *)(dst + 16), hi);
+}
+
+template<typename PixelInt, bool kITU>
+static void convertYUV420ToRGBImpl(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	int halfHeight = yHeight >> 1;
+	int halfWidth = yWidth >> 1;
+
+	const int16 *Cr_r_raw = lookup->getRawColorTable();
+	const int16 *Cr_g_raw = Cr_r_raw + 256;
+	const int16 *Cb_g_raw = Cr_g_raw + 256;
+	const int16 *Cb_b_raw = Cb_g_raw + 256;
+
+	// The offset-folded tables and the clip table, for the scalar tail
+	const int16 *Cr_r_tab = lookup->getColorTable();
+	const int16 *Cr_g_tab = Cr_r_tab + 256;
+	const int16 *Cb_g_tab = Cr_g_tab + 256;
+	const int16 *Cb_b_tab = Cb_g_tab + 256;
+	const byte *clipTable = lookup->getClipTable();
+
+	const byte r_shift = lookup->getFormat().rShift;
+	const byte g_shift = lookup->getFormat().gShift;
+	const byte b_shift = lookup->getFormat().bShift;
+	const PixelInt a_mask = (0xFF >> lookup->getFormat().aLoss) << lookup->getFormat().aShift;
+
+	const int16x8_t rLoss = vdupq_n_s16(-(int16)lookup->getFormat().rLoss);
+	const int16x8_t gLoss = vdupq_n_s16(-(int16)lookup->getFormat().gLoss);
+	const int16x8_t bLoss = vdupq_n_s16(-(int16)lookup->getFormat().bLoss);
+
+	// Per-row staging buffers for the chroma contributions, computed once
+	// per chroma sample and then consumed two luma pixels at a time
+	int16 *chromaBuf = new int16[3 * halfWidth];
+	int16 *crr = chromaBuf;
+	int16 *crbg = chromaBuf + halfWidth;
+	int16 *cbb = chromaBuf + 2 * halfWidth;
+
+	for (int h = 0; h < halfHeight; h++) {
+		for (int i = 0; i < halfWidth; i++) {
+			crr[i] = Cr_r_raw[vSrc[i]];
+			crbg[i] = Cr_g_raw[vSrc[i]] + Cb_g_raw[uSrc[i]];
+			cbb[i] = Cb_b_raw[uSrc[i]];
+		}
+
+		int w = 0;
+		for (; w + 8 <= yWidth; w += 8) {
+			// Every chroma value covers two luma pixels
+			int16x4_t cr4 = vld1_s16(crr + (w >> 1));
+			int16x4x2_t crz = vzip_s16(cr4, cr4);
+			int16x8_t cr = vcombine_s16(crz.val[0], crz.val[1]);
+			int16x4_t cg4 = vld1_s16(crbg + (w >> 1));
+			int16x4x2_t cgz = vzip_s16(cg4, cg4);
+			int16x8_t cg = vcombine_s16(cgz.val[0], cgz.val[1]);
+			int16x4_t cb4 = vld1_s16(cbb + (w >> 1));
+			int16x4x2_t cbz = vzip_s16(cb4, cb4);
+			int16x8_t cb = vcombine_s16(cbz.val[0], cbz.val[1]);
+
+			for (int row = 0; row < 2; row++) {
+				int16x8_t y = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ySrc + row * yPitch + w)));
+				uint16x8_t r = neon_clipChannel<kITU>(y, cr, rLoss);
+				uint16x8_t g = neon_clipChannel<kITU>(y, cg, gLoss);
+				uint16x8_t b = neon_clipChannel<kITU>(y, cb, bLoss);
+				neon_storePixels<PixelInt>(dstPtr + row * dstPitch + w * sizeof(PixelInt), r, g, b, r_shift, g_shift, b_shift, a_mask);
+			}
+		}
+
+		// Convert the remaining pixel pairs with the lookup tables
+		for (; w < yWidth; w += 2) {
+			int i = w >> 1;
+			int16 cr_r  = Cr_r_tab[vSrc[i]];
+			int16 crb_g = Cr_g_tab[vSrc[i]] + Cb_g_tab[uSrc[i]];
+			int16 cb_b  = Cb_b_tab[uSrc[i]];
+
+			for (int row = 0; row < 2; row++) {
+				for (int col = 0; col < 2; col++) {
+					const byte *L = &clipTable[ySrc[row * yPitch + w + col]];
+					*(PixelInt *)(dstPtr + row * dstPitch + (w + col) * sizeof(PixelInt)) =
+							((PixelInt)L[cr_r] << r_shift) | ((PixelInt)L[crb_g] << g_shift) | ((PixelInt)L[cb_b] << b_shift) | a_mask;
+				}
+			}
+		}
+
+		dstPtr += dstPitch << 1;
+		ySrc += yPitch << 1;
+		uSrc += uvPitch;
+		vSrc += uvPitch;
+	}
+
+	delete[] chromaBuf;
+}
+
+void convertYUV420ToRGBNEON(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	const bool itu = lookup->getScale() == YUVToRGBManager::kScaleITU;
+	if (lookup->getFormat().bytesPerPixel == 2) {
+		if (itu)
+			convertYUV420ToRGBImpl<uint16, true>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+		else
+			convertYUV420ToRGBImpl<uint16, false>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+	} else {
+		if (itu)
+			convertYUV420ToRGBImpl<uint32, true>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+		else
+			convertYUV420ToRGBImpl<uint32, false>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+	}
+}
+
+} // End of namespace Graphics
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,211 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "graphics/yuv_to_rgb.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Graphics {
+
+/**
+ * Turn eight Y+chroma sums into eight clipped channel values, matching
+ * the scalar clip table bit for bit.
+ *
+ * For the full luminance scale the table is a plain [0, 255] clamp. For
+ * the ITU scale it clamps to [16, 235] and rescales with
+ * (x - 16) * 255 / 219; the division is done with a 16-bit multiply-high
+ * by 299 (~2^16 / 219), which can undershoot the exact quotient by one,
+ * so the remainder is checked and the quotient fixed up.
+ */
+template<bool kITU>
+static FORCEINLINE __m128i sse2_clipChannel(__m128i y, __m128i chroma, __m128i lossCount) {
+	__m128i x = _mm_add_epi16(y, chroma);
+	if (kITU) {
+		x = _mm_max_epi16(x, _mm_set1_epi16(16));
+		x = _mm_min_epi16(x, _mm_set1_epi16(235));
+		x = _mm_sub_epi16(x, _mm_set1_epi16(16));
+		__m128i x255 = _mm_sub_epi16(_mm_slli_epi16(x, 8), x);
+		__m128i q = _mm_mulhi_epu16(x255, _mm_set1_epi16(299));
+		__m128i rem = _mm_sub_epi16(x255, _mm_mullo_epi16(q, _mm_set1_epi16(219)));
+		x = _mm_sub_epi16(q, _mm_cmpgt_epi16(rem, _mm_set1_epi16(218)));
+	} else {
+		x = _mm_max_epi16(x, _mm_setzero_si128());
+		x = _mm_min_epi16(x, _mm_set1_epi16(255));
+	}
+	return _mm_srl_epi16(x, lossCount);
+}
+
+template<typename PixelInt>
+static FORCEINLINE void sse2_storePixels(byte *dst, __m128i r, __m128i g, __m128i b,
+                                         __m128i rShift, __m128i gShift, __m128i bShift, __m128i aMask);
+
+template<>
+FORCEINLINE void sse2_storePixels<uint16>(byte *dst, __m128i r, __m128i g, __m128i b,
+                                          __m128i rShift, __m128i gShift, __m128i bShift, __m128i aMask) {
+	__m128i pix = _mm_or_si128(aMask, _mm_sll_epi16(r, rShift));
+	pix = _mm_or_si128(pix, _mm_sll_epi16(g, gShift));
+	pix = _mm_or_si128(pix, _mm_sll_epi16(b, bShift));
+	_mm_storeu_si128((__m128i *)dst, pix);
+}
+
+template<>
+FORCEINLINE void sse2_storePixels<uint32>(byte *dst, __m128i r, __m128i g, __m128i b,
+                                          __m128i rShift, __m128i gShift, __m128i bShift, __m128i aMask) {
+	const __m128i zero = _mm_setzero_si128();
+	__m128i lo = _mm_or_si128(aMask, _mm_sll_epi32(_mm_unpacklo_epi16(r, zero), rShift));
+	lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(g, zero), gShift));
+	lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(b, zero), bShift));
+	_mm_storeu_si128((__m128i *)dst, lo);
+	__m128i hi = _mm_or_si128(aMask, _mm_sll_epi32(_mm_unpackhi_epi16(r, zero), rShift));
+	hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(g, zero), gShift));
+	hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(b, zero), bShift));
+	_mm_storeu_si128((__m128i *)(dst + 16), hi);
+}
+
+template<typename PixelInt, bool kITU>
+static void convertYUV420ToRGBImpl(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	int halfHeight = yHeight >> 1;
+	int halfWidth = yWidth >> 1;
+
+	const int16 *Cr_r_raw = lookup->getRawColorTable();
+	const int16 *Cr_g_raw = Cr_r_raw + 256;
+	const int16 *Cb_g_raw = Cr_g_raw + 256;
+	const int16 *Cb_b_raw = Cb_g_raw + 256;
+
+	// The offset-folded tables and the clip table, for the scalar tail
+	const int16 *Cr_r_tab = lookup->getColorTable();
+	const int16 *Cr_g_tab = Cr_r_tab + 256;
+	const int16 *Cb_g_tab = Cr_g_tab + 256;
+	const int16 *Cb_b_tab = Cb_g_tab + 256;
+	const byte *clipTable = lookup->getClipTable();
+
+	const byte r_shift = lookup->getFormat().rShift;
+	const byte g_shift = lookup->getFormat().gShift;
+	const byte b_shift = lookup->getFormat().bShift;
+	const PixelInt a_mask = (0xFF >> lookup->getFormat().aLoss) << lookup->getFormat().aShift;
+
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i rLoss = _mm_cvtsi32_si128(lookup->getFormat().rLoss);
+	const __m128i gLoss = _mm_cvtsi32_si128(lookup->getFormat().gLoss);
+	const __m128i bLoss = _mm_cvtsi32_si128(lookup->getFormat().bLoss);
+	const __m128i rShift = _mm_cvtsi32_si128(r_shift);
+	const __m128i gShift = _mm_cvtsi32_si128(g_shift);
+	const __m128i bShift = _mm_cvtsi32_si128(b_shift);
+	const __m128i aMask = (sizeof(PixelInt) == 2) ?
+			_mm_set1_epi16((int16)a_mask) : _mm_set1_epi32((int32)a_mask);
+
+	// Per-row staging buffers for the chroma contributions, computed once
+	// per chroma sample and then consumed two luma pixels at a time
+	int16 *chromaBuf = new int16[3 * halfWidth];
+	int16 *crr = chromaBuf;
+	int16 *crbg = chromaBuf + halfWidth;
+	int16 *cbb = chromaBuf + 2 * halfWidth;
+
+	for (int h = 0; h < halfHeight; h++) {
+		for (int i = 0; i < halfWidth; i++) {
+			crr[i] = Cr_r_raw[vSrc[i]];
+			crbg[i] = Cr_g_raw[vSrc[i]] + Cb_g_raw[uSrc[i]];
+			cbb[i] = Cb_b_raw[uSrc[i]];
+		}
+
+		int w = 0;
+		for (; w + 8 <= yWidth; w += 8) {
+			// Every chroma value covers two luma pixels
+			__m128i cr = _mm_loadl_epi64((const __m128i *)(crr + (w >> 1)));
+			cr = _mm_unpacklo_epi16(cr, cr);
+			__m128i cg = _mm_loadl_epi64((const __m128i *)(crbg + (w >> 1)));
+			cg = _mm_unpacklo_epi16(cg, cg);
+			__m128i cb = _mm_loadl_epi64((const __m128i *)(cbb + (w >> 1)));
+			cb = _mm_unpacklo_epi16(cb, cb);
+
+			for (int row = 0; row < 2; row++) {
+				__m128i y = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(ySrc + row * yPitch + w)), zero);
+				__m128i r = sse2_clipChannel<kITU>(y, cr, rLoss);
+				__m128i g = sse2_clipChannel<kITU>(y, cg, gLoss);
+				__m128i b = sse2_clipChannel<kITU>(y, cb, bLoss);
+				sse2_storePixels<PixelInt>(dstPtr + row * dstPitch + w * sizeof(PixelInt), r, g, b, rShift, gShift, bShift, aMask);
+			}
+		}
+
+		// Convert the remaining pixel pairs with the lookup tables
+		for (; w < yWidth; w += 2) {
+			int i = w >> 1;
+			int16 cr_r  = Cr_r_tab[vSrc[i]];
+			int16 crb_g = Cr_g_tab[vSrc[i]] + Cb_g_tab[uSrc[i]];
+			int16 cb_b  = Cb_b_tab[uSrc[i]];
+
+			for (int row = 0; row < 2; row++) {
+				for (int col = 0; col < 2; col++) {
+					const byte *L = &clipTable[ySrc[row * yPitch + w + col]];
+					*(PixelInt *)(dstPtr + row * dstPitch + (w + col) * sizeof(PixelInt)) =
+							((PixelInt)L[cr_r] << r_shift) | ((PixelInt)L[crb_g] << g_shift) | ((PixelInt)L[cb_b] << b_shift) | a_mask;
+				}
+			}
+		}
+
+		dstPtr += dstPitch << 1;
+		ySrc += yPitch << 1;
+		uSrc += uvPitch;
+		vSrc += uvPitch;
+	}
+
+	delete[] chromaBuf;
+}
+
+void convertYUV420ToRGBSSE2(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	const bool itu = lookup->getScale() == YUVToRGBManager::kScaleITU;
+	if (lookup->getFormat().bytesPerPixel == 2) {
+		if (itu)
+			convertYUV420ToRGBImpl<uint16, true>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+		else
+			convertYUV420ToRGBImpl<uint16, false>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+	} else {
+		if (itu)
+			convertYUV420ToRGBImpl<uint32, true>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+		else
+			convertYUV420ToRGBImpl<uint32, false>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+	}
+}
+
+} // End of namespace Graphics
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
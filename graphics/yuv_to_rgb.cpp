@@ -82,6 +82,9 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
+#include "common/system.h"
+#include "common/threadpool.h"
+#include "common/util.h"
 #include "graphics/surface.h"
 #include "graphics/yuv_to_rgb.h"
 
@@ -91,22 +94,6 @@ DECLARE_SINGLETON(Graphics::YUVToRGBManager);
 
 namespace Graphics {
 
-class YUVToRGBLookup {
-public:
-	YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::LuminanceScale scale);
-
-	Graphics::PixelFormat getFormat() const { return _format; }
-	YUVToRGBManager::LuminanceScale getScale() const { return _scale; }
-	const int16 *getColorTable() const { return _colorTab; }
-	const byte *getClipTable() const { return _clipTable; }
-
-private:
-	Graphics::PixelFormat _format;
-	YUVToRGBManager::LuminanceScale _scale;
-	int16 _colorTab[4 * 256]; // 2048 bytes
-	byte _clipTable[3 * 768];
-};
-
 YUVToRGBLookup::YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::LuminanceScale scale) {
 	_format = format;
 	_scale = scale;
@@ -169,20 +156,33 @@ YUVToRGBLookup::YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::Lu
 	int16 *Cb_g_tab = &_colorTab[2 * 256];
 	int16 *Cb_b_tab = &_colorTab[3 * 256];
 
+	int16 *Cr_r_raw = &_rawColorTab[0 * 256];
+	int16 *Cr_g_raw = &_rawColorTab[1 * 256];
+	int16 *Cb_g_raw = &_rawColorTab[2 * 256];
+	int16 *Cb_b_raw = &_rawColorTab[3 * 256];
+
 	for (int i = 0; i < 256; i++) {
 		// Gamma correction (luminescence table) and chroma correction
 		// would be done here. See the Berkeley mpeg_play sources.
 
 		int16 CR = (i - 128), CB = CR;
-		Cr_r_tab[i] = (int16) ( (0.419 / 0.299) * CR) + r_offset + 256;
-		Cr_g_tab[i] = (int16) (-(0.299 / 0.419) * CR) + g_offset + 256;
-		Cb_g_tab[i] = (int16) (-(0.114 / 0.331) * CB);
-		Cb_b_tab[i] = (int16) ( (0.587 / 0.331) * CB) + b_offset + 256;
+		Cr_r_raw[i] = (int16) ( (0.419 / 0.299) * CR);
+		Cr_g_raw[i] = (int16) (-(0.299 / 0.419) * CR);
+		Cb_g_raw[i] = (int16) (-(0.114 / 0.331) * CB);
+		Cb_b_raw[i] = (int16) ( (0.587 / 0.331) * CB);
+
+		Cr_r_tab[i] = Cr_r_raw[i] + r_offset + 256;
+		Cr_g_tab[i] = Cr_g_raw[i] + g_offset + 256;
+		Cb_g_tab[i] = Cb_g_raw[i];
+		Cb_b_tab[i] = Cb_b_raw[i] + b_offset + 256;
 	}
 }
 
 YUVToRGBManager::YUVToRGBManager() {
 	_lookup = 0;
+	_convert420Proc = nullptr;
+	_threadPool = nullptr;
+	_triedThreadPool = false;
 }
 
 YUVToRGBManager::~YUVToRGBManager() {
@@ -354,6 +354,46 @@ void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	}
 }
 
+static void convertYUV420ToRGBGeneric(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	// Use a templated function to avoid an if check on every pixel
+	if (lookup->getFormat().bytesPerPixel == 2)
+		convertYUV420ToRGB<uint16>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+	else
+		convertYUV420ToRGB<uint32>(dstPtr, dstPitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+}
+
+namespace {
+
+struct Convert420Task {
+	void (*proc)(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
+	byte *dstPtr;
+	int dstPitch;
+	const YUVToRGBLookup *lookup;
+	const byte *ySrc, *uSrc, *vSrc;
+	int yWidth, yHeight, yPitch, uvPitch;
+	uint bands;
+};
+
+void convert420BandTask(void *data, uint index) {
+	const Convert420Task &task = *(const Convert420Task *)data;
+
+	// Bands are made up of whole row pairs, since one chroma row drives
+	// two luma rows.
+	int pairCount = task.yHeight >> 1;
+	int startPair = pairCount * index / task.bands;
+	int endPair = pairCount * (index + 1) / task.bands;
+	if (startPair >= endPair)
+		return;
+
+	task.proc(task.dstPtr + startPair * 2 * task.dstPitch, task.dstPitch, task.lookup,
+	          task.ySrc + startPair * 2 * task.yPitch,
+	          task.uSrc + startPair * task.uvPitch,
+	          task.vSrc + startPair * task.uvPitch,
+	          task.yWidth, (endPair - startPair) * 2, task.yPitch, task.uvPitch);
+}
+
+} // end of anonymous namespace
+
 void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	// Sanity checks
 	assert(dst && dst->getPixels());
@@ -364,11 +404,47 @@ void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::Lumina
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
-	// Use a templated function to avoid an if check on every pixel
-	if (dst->format.bytesPerPixel == 2)
-		convertYUV420ToRGB<uint16>((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
-	else
-		convertYUV420ToRGB<uint32>((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+	// If no function has been selected yet, detect and select
+	if (!_convert420Proc) {
+		_convert420Proc = convertYUV420ToRGBGeneric;
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) _convert420Proc = convertYUV420ToRGBNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) _convert420Proc = convertYUV420ToRGBSSE2;
+#endif
+	}
+
+	if (!_triedThreadPool) {
+		_triedThreadPool = true;
+		// Use the shared pool so that video decoding does not oversubscribe
+		// the CPU against the scaler and other sliced work.
+		Common::ThreadPool &pool = Common::ThreadPool::instance();
+		if (pool.workerCount() > 0)
+			_threadPool = &pool;
+	}
+
+	// Split big frames into bands of row pairs, one per core; small ones
+	// are not worth the synchronization overhead.
+	uint bands = _threadPool ? MIN<uint>(_threadPool->workerCount() + 1, (yHeight >> 1) / 32) : 1;
+	if (bands > 1) {
+		Convert420Task task;
+		task.proc = _convert420Proc;
+		task.dstPtr = (byte *)dst->getPixels();
+		task.dstPitch = dst->pitch;
+		task.lookup = lookup;
+		task.ySrc = ySrc;
+		task.uSrc = uSrc;
+		task.vSrc = vSrc;
+		task.yWidth = yWidth;
+		task.yHeight = yHeight;
+		task.yPitch = yPitch;
+		task.uvPitch = uvPitch;
+		task.bands = bands;
+		_threadPool->runTasks(convert420BandTask, &task, bands);
+	} else {
+		_convert420Proc((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+	}
 }
 
 #define PUT_PIXELA(s, a, d) \
@@ -41,6 +41,10 @@
 #include "common/singleton.h"
 #include "graphics/surface.h"
 
+namespace Common {
+class ThreadPool;
+}
+
 namespace Graphics {
 
 class YUVToRGBLookup;
@@ -142,8 +146,48 @@ private:
 
 	const YUVToRGBLookup *getLookup(Graphics::PixelFormat format, LuminanceScale scale);
 
+	typedef void (*Convert420Proc)(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
+
 	YUVToRGBLookup *_lookup;
+	Convert420Proc _convert420Proc; ///< selected once at runtime, like the blending blit kernels
+	Common::ThreadPool *_threadPool; ///< the shared pool, or nullptr when serial; not owned
+	bool _triedThreadPool;
 };
+
+/**
+ * The lookup tables for a given destination format and luminance scale.
+ *
+ * The color tables fold the luminance clip table offsets into the chroma
+ * coefficients so that the scalar converters can go straight from a
+ * summed index to a clipped channel value. The raw color table contains
+ * the same coefficients without the folded offsets, which is what the
+ * SIMD converters work from.
+ */
+class YUVToRGBLookup {
+public:
+	YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::LuminanceScale scale);
+
+	Graphics::PixelFormat getFormat() const { return _format; }
+	YUVToRGBManager::LuminanceScale getScale() const { return _scale; }
+	const int16 *getColorTable() const { return _colorTab; }
+	const int16 *getRawColorTable() const { return _rawColorTab; }
+	const byte *getClipTable() const { return _clipTable; }
+
+private:
+	Graphics::PixelFormat _format;
+	YUVToRGBManager::LuminanceScale _scale;
+	int16 _colorTab[4 * 256];    // 2048 bytes
+	int16 _rawColorTab[4 * 256]; // 2048 bytes
+	byte _clipTable[3 * 768];
+};
+
+#ifdef SCUMMVM_SSE2
+void convertYUV420ToRGBSSE2(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
+#endif
+#ifdef SCUMMVM_NEON
+void convertYUV420ToRGBNEON(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
+#endif
+
  /** @} */
 } // End of namespace Graphics
 
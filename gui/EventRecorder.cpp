@@ -57,6 +57,10 @@ EventRecorder::EventRecorder() {
 	_needRedraw = false;
 	_processingMillis = false;
 	_fastPlayback = false;
+	_timeScale = 1;
+	_scaledMillis = 0;
+	_lastRealMillis = 0;
+	_timeScaleActive = false;
 	_lastTimeDate.tm_sec = 0;
 	_lastTimeDate.tm_min = 0;
 	_lastTimeDate.tm_hour = 0;
@@ -169,6 +173,15 @@ void EventRecorder::processTimeAndDate(TimeDate &td, bool skipRecord) {
 
 void EventRecorder::processMillis(uint32 &millis, bool skipRecord) {
 	if (!_initialized) {
+		if (_timeScaleActive && !skipRecord) {
+			// Fast-forward mode: report a clock that runs _timeScale times
+			// faster than the real one. The scaled clock keeps running even
+			// after the scale was set back to 1, since it is ahead of the
+			// real time by then and must never jump backwards.
+			_scaledMillis += (millis - _lastRealMillis) * _timeScale;
+			_lastRealMillis = millis;
+			millis = _scaledMillis;
+		}
 		return;
 	}
 	if (skipRecord || _processingMillis) {
@@ -232,7 +245,22 @@ void EventRecorder::processMillis(uint32 &millis, bool skipRecord) {
 }
 
 bool EventRecorder::processDelayMillis() {
-	return _fastPlayback;
+	return _fastPlayback || (!_initialized && _timeScale > 1);
+}
+
+void EventRecorder::setTimeScale(uint32 scale) {
+	if (scale < 1)
+		scale = 1;
+	if (scale == _timeScale)
+		return;
+	// Anchor the scaled clock at the current raw time, so the change only
+	// affects the rate from now on.
+	_lastRealMillis = g_system->getMillis(true);
+	if (!_timeScaleActive) {
+		_scaledMillis = _lastRealMillis;
+		_timeScaleActive = true;
+	}
+	_timeScale = scale;
 }
 
 bool EventRecorder::processAutosave() {
@@ -144,6 +144,24 @@ public:
 		_needRedraw = redraw;
 	}
 
+	/** Set the speed multiplier applied to the system clock while no
+	 *  recording or playback is active.
+	 *
+	 *  A scale of e.g. 10 makes getMillis() advance ten times faster than
+	 *  real time and turns delayMillis() into a no-op, so engines that pace
+	 *  themselves off the clock fast-forward deterministically. A scale of 1
+	 *  returns to real-time pacing; the clock stays monotonic across changes.
+	 */
+	void setTimeScale(uint32 scale);
+
+	/** Get the speed multiplier applied to the system clock
+	 *
+	 *  @see setTimeScale
+	 */
+	uint32 getTimeScale() const {
+		return _timeScale;
+	}
+
 	void registerMixerManager(MixerManager *mixerManager);
 	void registerTimerManager(DefaultTimerManager *timerManager);
 
@@ -249,6 +267,10 @@ private:
 	bool _fastPlayback;
 	bool _needRedraw;
 	bool _processingMillis;
+	uint32 _timeScale;
+	uint32 _scaledMillis;
+	uint32 _lastRealMillis;
+	bool _timeScaleActive;
 };
 
 } // End of namespace GUI
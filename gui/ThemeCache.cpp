@@ -0,0 +1,555 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "gui/ThemeCache.h"
+
+#include "base/version.h"
+
+#include "common/hash-str.h"
+#include "common/savefile.h"
+#include "common/system.h"
+
+#include "gui/ThemeEval.h"
+
+namespace GUI {
+
+enum {
+	kThemeCacheMagic = MKTAG('S', 'V', 'T', 'C'),
+	kThemeCacheVersion = 1
+};
+
+static const char *const kThemeCacheFileName = "gui-theme.cache";
+
+enum CacheOp {
+	kCacheOpSetVar = 0,
+	kCacheOpDialog,
+	kCacheOpLayout,
+	kCacheOpWidget,
+	kCacheOpImportedLayout,
+	kCacheOpSpace,
+	kCacheOpPadding,
+	kCacheOpCloseLayout,
+	kCacheOpCloseDialog,
+	kCacheOpDrawData,
+	kCacheOpDrawStep,
+	kCacheOpFont,
+	kCacheOpStoreFontNames,
+	kCacheOpTextColor,
+	kCacheOpTextData,
+	kCacheOpBitmap,
+	kCacheOpCursor
+};
+
+void ThemeCache::writeString(const Common::String &str) {
+	_ops.writeUint16LE(str.size());
+	_ops.write(str.c_str(), str.size());
+}
+
+static void writeStringTo(Common::WriteStream *out, const Common::String &str) {
+	out->writeUint16LE(str.size());
+	out->write(str.c_str(), str.size());
+}
+
+static bool readCacheString(Common::SeekableReadStream *in, Common::String &str) {
+	uint16 len = in->readUint16LE();
+	if (in->eos() || in->err())
+		return false;
+
+	str.clear();
+	if (len == 0)
+		return true;
+
+	if (in->pos() + len > in->size())
+		return false;
+
+	char *buf = new char[len];
+	in->read(buf, len);
+	str = Common::String(buf, len);
+	delete[] buf;
+
+	return !in->eos();
+}
+
+void ThemeCache::recordSetVar(const Common::String &name, int value) {
+	_ops.writeByte(kCacheOpSetVar);
+	writeString(name);
+	_ops.writeSint32LE(value);
+}
+
+void ThemeCache::recordDialog(const Common::String &name, const Common::String &overlays, int16 maxWidth, int16 maxHeight, int inset) {
+	_ops.writeByte(kCacheOpDialog);
+	writeString(name);
+	writeString(overlays);
+	_ops.writeSint16LE(maxWidth);
+	_ops.writeSint16LE(maxHeight);
+	_ops.writeSint16LE(inset);
+}
+
+void ThemeCache::recordLayout(ThemeLayout::LayoutType type, int spacing, ThemeLayout::ItemAlign itemAlign) {
+	_ops.writeByte(kCacheOpLayout);
+	_ops.writeByte(type);
+	_ops.writeSint16LE(spacing);
+	_ops.writeByte(itemAlign);
+}
+
+void ThemeCache::recordWidget(const Common::String &name, const Common::String &type, int w, int h, Graphics::TextAlign align, bool useRTL) {
+	_ops.writeByte(kCacheOpWidget);
+	writeString(name);
+	writeString(type);
+	_ops.writeSint16LE(w);
+	_ops.writeSint16LE(h);
+	_ops.writeByte(align);
+	_ops.writeByte(useRTL ? 1 : 0);
+}
+
+void ThemeCache::recordImportedLayout(const Common::String &name) {
+	_ops.writeByte(kCacheOpImportedLayout);
+	writeString(name);
+}
+
+void ThemeCache::recordSpace(int size) {
+	_ops.writeByte(kCacheOpSpace);
+	_ops.writeSint16LE(size);
+}
+
+void ThemeCache::recordPadding(int16 l, int16 r, int16 t, int16 b) {
+	_ops.writeByte(kCacheOpPadding);
+	_ops.writeSint16LE(l);
+	_ops.writeSint16LE(r);
+	_ops.writeSint16LE(t);
+	_ops.writeSint16LE(b);
+}
+
+void ThemeCache::recordCloseLayout() {
+	_ops.writeByte(kCacheOpCloseLayout);
+}
+
+void ThemeCache::recordCloseDialog() {
+	_ops.writeByte(kCacheOpCloseDialog);
+}
+
+void ThemeCache::recordDrawData(const Common::String &data, bool cached) {
+	_ops.writeByte(kCacheOpDrawData);
+	writeString(data);
+	_ops.writeByte(cached ? 1 : 0);
+}
+
+void ThemeCache::recordDrawStep(const Common::String &drawDataId, const Graphics::DrawStep &step, const Common::String &bitmapName) {
+	_ops.writeByte(kCacheOpDrawStep);
+	writeString(drawDataId);
+	_ops.writeSByte(getDrawingFunctionIndex(step.drawingCall));
+	writeString(bitmapName);
+	_ops.writeByte(step.alphaType);
+
+	const Graphics::DrawStep::Color *colors[] = {
+		&step.fgColor, &step.bgColor, &step.gradColor1, &step.gradColor2, &step.bevelColor
+	};
+	for (uint i = 0; i < ARRAYSIZE(colors); ++i) {
+		_ops.writeByte(colors[i]->r);
+		_ops.writeByte(colors[i]->g);
+		_ops.writeByte(colors[i]->b);
+		_ops.writeByte(colors[i]->set ? 1 : 0);
+	}
+
+	_ops.writeByte(step.autoWidth ? 1 : 0);
+	_ops.writeByte(step.autoHeight ? 1 : 0);
+	_ops.writeSint16LE(step.x);
+	_ops.writeSint16LE(step.y);
+	_ops.writeSint16LE(step.w);
+	_ops.writeSint16LE(step.h);
+
+	const Common::Rect *rects[] = { &step.padding, &step.clip };
+	for (uint i = 0; i < ARRAYSIZE(rects); ++i) {
+		_ops.writeSint16LE(rects[i]->left);
+		_ops.writeSint16LE(rects[i]->top);
+		_ops.writeSint16LE(rects[i]->right);
+		_ops.writeSint16LE(rects[i]->bottom);
+	}
+
+	_ops.writeByte(step.xAlign);
+	_ops.writeByte(step.yAlign);
+	_ops.writeByte(step.shadow);
+	_ops.writeByte(step.stroke);
+	_ops.writeByte(step.factor);
+	_ops.writeByte(step.radius);
+	_ops.writeByte(step.bevel);
+	_ops.writeByte(step.fillMode);
+	_ops.writeByte(step.shadowFillMode);
+	_ops.writeUint32LE(step.extraData);
+	_ops.writeUint32LE(step.scale);
+	_ops.writeUint32LE(step.shadowIntensity);
+	_ops.writeByte(step.autoscale);
+}
+
+void ThemeCache::recordFont(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize) {
+	_ops.writeByte(kCacheOpFont);
+	_ops.writeByte(textId);
+	writeString(language);
+	writeString(file);
+	writeString(scalableFile);
+	_ops.writeSint16LE(pointsize);
+}
+
+void ThemeCache::recordStoreFontNames(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize) {
+	_ops.writeByte(kCacheOpStoreFontNames);
+	_ops.writeByte(textId);
+	writeString(language);
+	writeString(file);
+	writeString(scalableFile);
+	_ops.writeSint16LE(pointsize);
+}
+
+void ThemeCache::recordTextColor(TextColor colorId, int r, int g, int b) {
+	_ops.writeByte(kCacheOpTextColor);
+	_ops.writeByte(colorId);
+	_ops.writeByte(r);
+	_ops.writeByte(g);
+	_ops.writeByte(b);
+}
+
+void ThemeCache::recordTextData(const Common::String &drawDataId, TextData textId, TextColor colorId, Graphics::TextAlign alignH, ThemeEngine::TextAlignVertical alignV) {
+	_ops.writeByte(kCacheOpTextData);
+	writeString(drawDataId);
+	_ops.writeByte(textId);
+	_ops.writeByte(colorId);
+	_ops.writeByte(alignH);
+	_ops.writeByte(alignV);
+}
+
+void ThemeCache::recordBitmap(const Common::String &filename, const Common::String &scalablefile, int width, int height) {
+	_ops.writeByte(kCacheOpBitmap);
+	writeString(filename);
+	writeString(scalablefile);
+	_ops.writeSint16LE(width);
+	_ops.writeSint16LE(height);
+}
+
+void ThemeCache::recordCursor(const Common::String &filename, int hotspotX, int hotspotY) {
+	_ops.writeByte(kCacheOpCursor);
+	writeString(filename);
+	_ops.writeSint16LE(hotspotX);
+	_ops.writeSint16LE(hotspotY);
+}
+
+bool ThemeCache::save(const Common::String &themeId, const Common::String &themeHeader, int16 baseWidth, int16 baseHeight, float scaleFactor) {
+	Common::OutSaveFile *out = g_system->getSavefileManager()->openForSaving(kThemeCacheFileName);
+	if (!out)
+		return false;
+
+	out->writeUint32BE(kThemeCacheMagic);
+	out->writeUint32LE(kThemeCacheVersion);
+	writeStringTo(out, gScummVMVersion);
+	writeStringTo(out, themeId);
+	writeStringTo(out, themeHeader);
+	out->writeSint16LE(baseWidth);
+	out->writeSint16LE(baseHeight);
+	out->writeUint32LE((uint32)(scaleFactor * 1000.0f + 0.5f));
+	out->writeUint32LE(_ops.size());
+	out->write(_ops.getData(), _ops.size());
+	out->finalize();
+
+	bool success = !out->err();
+	delete out;
+
+	if (success)
+		debug(1, "Wrote compiled theme cache for '%s' (%u bytes)", themeId.c_str(), (uint)_ops.size());
+
+	return success;
+}
+
+bool ThemeCache::load(ThemeEngine *theme, const Common::String &themeId, const Common::String &themeHeader, int16 baseWidth, int16 baseHeight, float scaleFactor) {
+	Common::InSaveFile *in = g_system->getSavefileManager()->openForLoading(kThemeCacheFileName);
+	if (!in)
+		return false;
+
+	// Verify the key: any mismatch means the cache belongs to a different
+	// theme, resolution, scale or build, and a full parse is needed.
+	Common::String str;
+	bool match = in->readUint32BE() == kThemeCacheMagic &&
+	             in->readUint32LE() == kThemeCacheVersion &&
+	             readCacheString(in, str) && str == gScummVMVersion &&
+	             readCacheString(in, str) && str == themeId &&
+	             readCacheString(in, str) && str == themeHeader &&
+	             in->readSint16LE() == baseWidth &&
+	             in->readSint16LE() == baseHeight &&
+	             in->readUint32LE() == (uint32)(scaleFactor * 1000.0f + 0.5f);
+
+	if (!match || in->eos()) {
+		delete in;
+		return false;
+	}
+
+	const uint32 opSize = in->readUint32LE();
+	if (in->eos() || in->pos() + opSize != in->size()) {
+		delete in;
+		return false;
+	}
+
+	ThemeEval *eval = theme->getEvaluator();
+
+	// Track the replay state so a damaged stream cannot trip the asserts
+	// in ThemeEval or ThemeEngine: the layout stack depth and the DrawData
+	// sets opened so far.
+	int layoutDepth = 0;
+	Common::StringMap drawDataIds;
+
+	bool ok = true;
+	while (ok && (uint32)in->pos() < (uint32)in->size()) {
+		const byte op = in->readByte();
+		if (in->eos()) {
+			ok = false;
+			break;
+		}
+
+		switch (op) {
+		case kCacheOpSetVar: {
+			Common::String name;
+			ok = readCacheString(in, name);
+			int32 value = in->readSint32LE();
+			if (ok && !in->eos())
+				eval->setVar(name, value);
+			else
+				ok = false;
+			break;
+		}
+		case kCacheOpDialog: {
+			Common::String name, overlays;
+			ok = readCacheString(in, name) && readCacheString(in, overlays);
+			int16 maxWidth = in->readSint16LE();
+			int16 maxHeight = in->readSint16LE();
+			int16 inset = in->readSint16LE();
+			if (ok && !in->eos()) {
+				eval->addDialog(name, overlays, maxWidth, maxHeight, inset);
+				layoutDepth++;
+			} else {
+				ok = false;
+			}
+			break;
+		}
+		case kCacheOpLayout: {
+			byte type = in->readByte();
+			int16 spacing = in->readSint16LE();
+			byte itemAlign = in->readByte();
+			if (in->eos() || layoutDepth < 1 ||
+					(type != ThemeLayout::kLayoutVertical && type != ThemeLayout::kLayoutHorizontal)) {
+				ok = false;
+			} else {
+				eval->addLayout((ThemeLayout::LayoutType)type, spacing, (ThemeLayout::ItemAlign)itemAlign);
+				layoutDepth++;
+			}
+			break;
+		}
+		case kCacheOpWidget: {
+			Common::String name, type;
+			ok = readCacheString(in, name) && readCacheString(in, type);
+			int16 w = in->readSint16LE();
+			int16 h = in->readSint16LE();
+			byte align = in->readByte();
+			byte useRTL = in->readByte();
+			if (ok && !in->eos() && layoutDepth > 0)
+				eval->addWidget(name, type, w, h, (Graphics::TextAlign)align, useRTL != 0);
+			else
+				ok = false;
+			break;
+		}
+		case kCacheOpImportedLayout: {
+			Common::String name;
+			ok = readCacheString(in, name) && layoutDepth > 0 && eval->hasDialog(name);
+			if (ok)
+				eval->addImportedLayout(name);
+			break;
+		}
+		case kCacheOpSpace: {
+			int16 size = in->readSint16LE();
+			if (in->eos() || layoutDepth < 1)
+				ok = false;
+			else
+				eval->addSpace(size);
+			break;
+		}
+		case kCacheOpPadding: {
+			int16 l = in->readSint16LE();
+			int16 r = in->readSint16LE();
+			int16 t = in->readSint16LE();
+			int16 b = in->readSint16LE();
+			if (in->eos() || layoutDepth < 1)
+				ok = false;
+			else
+				eval->addPadding(l, r, t, b);
+			break;
+		}
+		case kCacheOpCloseLayout:
+			if (layoutDepth < 1) {
+				ok = false;
+			} else {
+				eval->closeLayout();
+				layoutDepth--;
+			}
+			break;
+		case kCacheOpCloseDialog:
+			if (layoutDepth < 1) {
+				ok = false;
+			} else {
+				eval->closeDialog();
+				layoutDepth--;
+			}
+			break;
+		case kCacheOpDrawData: {
+			Common::String data;
+			byte cached = 0;
+			ok = readCacheString(in, data);
+			cached = in->readByte();
+			if (!ok || in->eos() || !theme->addDrawData(data, cached != 0))
+				ok = false;
+			else
+				drawDataIds[data] = "";
+			break;
+		}
+		case kCacheOpDrawStep: {
+			Common::String id, bitmapName;
+			ok = readCacheString(in, id);
+			int8 func = in->readSByte();
+			ok = ok && readCacheString(in, bitmapName);
+
+			Graphics::DrawStep step;
+			step.drawingCall = getDrawingFunctionByIndex(func);
+			step.alphaType = (Graphics::AlphaType)in->readByte();
+
+			Graphics::DrawStep::Color *colors[] = {
+				&step.fgColor, &step.bgColor, &step.gradColor1, &step.gradColor2, &step.bevelColor
+			};
+			for (uint i = 0; i < ARRAYSIZE(colors); ++i) {
+				colors[i]->r = in->readByte();
+				colors[i]->g = in->readByte();
+				colors[i]->b = in->readByte();
+				colors[i]->set = in->readByte() != 0;
+			}
+
+			step.autoWidth = in->readByte() != 0;
+			step.autoHeight = in->readByte() != 0;
+			step.x = in->readSint16LE();
+			step.y = in->readSint16LE();
+			step.w = in->readSint16LE();
+			step.h = in->readSint16LE();
+
+			Common::Rect *rects[] = { &step.padding, &step.clip };
+			for (uint i = 0; i < ARRAYSIZE(rects); ++i) {
+				rects[i]->left = in->readSint16LE();
+				rects[i]->top = in->readSint16LE();
+				rects[i]->right = in->readSint16LE();
+				rects[i]->bottom = in->readSint16LE();
+			}
+
+			step.xAlign = (Graphics::DrawStep::VectorAlignment)in->readByte();
+			step.yAlign = (Graphics::DrawStep::VectorAlignment)in->readByte();
+			step.shadow = in->readByte();
+			step.stroke = in->readByte();
+			step.factor = in->readByte();
+			step.radius = in->readByte();
+			step.bevel = in->readByte();
+			step.fillMode = in->readByte();
+			step.shadowFillMode = in->readByte();
+			step.extraData = in->readUint32LE();
+			step.scale = in->readUint32LE();
+			step.shadowIntensity = in->readUint32LE();
+			step.autoscale = (ThemeEngine::AutoScaleMode)in->readByte();
+
+			if (!bitmapName.empty()) {
+				step.blitSrc = theme->getImageSurface(bitmapName);
+				if (!step.blitSrc)
+					ok = false;
+			}
+
+			if (!ok || in->eos() || !step.drawingCall || !drawDataIds.contains(id))
+				ok = false;
+			else
+				theme->addDrawStep(id, step);
+			break;
+		}
+		case kCacheOpFont:
+		case kCacheOpStoreFontNames: {
+			byte textId = in->readByte();
+			Common::String language, file, scalableFile;
+			ok = readCacheString(in, language) && readCacheString(in, file) && readCacheString(in, scalableFile);
+			int16 pointsize = in->readSint16LE();
+			if (!ok || in->eos() || textId >= kTextDataMAX) {
+				ok = false;
+			} else if (op == kCacheOpStoreFontNames) {
+				theme->storeFontNames((TextData)textId, language, file, scalableFile, pointsize);
+			} else {
+				ok = theme->addFont((TextData)textId, language, file, scalableFile, pointsize);
+			}
+			break;
+		}
+		case kCacheOpTextColor: {
+			byte colorId = in->readByte();
+			byte r = in->readByte();
+			byte g = in->readByte();
+			byte b = in->readByte();
+			ok = !in->eos() && colorId < kTextColorMAX && theme->addTextColor((TextColor)colorId, r, g, b);
+			break;
+		}
+		case kCacheOpTextData: {
+			Common::String id;
+			ok = readCacheString(in, id);
+			byte textId = in->readByte();
+			byte colorId = in->readByte();
+			byte alignH = in->readByte();
+			byte alignV = in->readByte();
+			ok = ok && !in->eos() && textId < kTextDataMAX && colorId < kTextColorMAX &&
+			     theme->addTextData(id, (TextData)textId, (TextColor)colorId,
+			                        (Graphics::TextAlign)alignH, (ThemeEngine::TextAlignVertical)alignV);
+			break;
+		}
+		case kCacheOpBitmap: {
+			Common::String filename, scalablefile;
+			ok = readCacheString(in, filename) && readCacheString(in, scalablefile);
+			int16 width = in->readSint16LE();
+			int16 height = in->readSint16LE();
+			ok = ok && !in->eos() && theme->addBitmap(filename, scalablefile, width, height);
+			break;
+		}
+		case kCacheOpCursor: {
+			Common::String filename;
+			ok = readCacheString(in, filename);
+			int16 hotspotX = in->readSint16LE();
+			int16 hotspotY = in->readSint16LE();
+			ok = ok && !in->eos() && theme->createCursor(filename, hotspotX, hotspotY);
+			break;
+		}
+		default:
+			ok = false;
+			break;
+		}
+	}
+
+	if (ok && (layoutDepth != 0 || in->err()))
+		ok = false;
+
+	delete in;
+
+	if (!ok)
+		warning("Compiled theme cache for '%s' could not be replayed, re-parsing", themeId.c_str());
+
+	return ok;
+}
+
+} // End of namespace GUI
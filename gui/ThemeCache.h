@@ -0,0 +1,107 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef GUI_THEME_CACHE_H
+#define GUI_THEME_CACHE_H
+
+#include "common/memstream.h"
+#include "common/scummsys.h"
+#include "common/str.h"
+
+#include "graphics/VectorRenderer.h"
+
+#include "gui/ThemeEngine.h"
+#include "gui/ThemeLayout.h"
+
+namespace GUI {
+
+/**
+ * Lookup helpers, implemented next to the parser's drawing function table:
+ * draw steps reference renderer callbacks, which the cache stores as indices
+ * into that table.
+ */
+Graphics::DrawingFunctionCallback getDrawingFunctionByIndex(int index);
+int getDrawingFunctionIndex(Graphics::DrawingFunctionCallback callback);
+
+/**
+ * Compiled-theme binary cache.
+ *
+ * Parsing the STX files of a theme and re-evaluating all the layout
+ * expressions is by far the most expensive part of GUI startup. Since the
+ * parse result only depends on the theme version, the base resolution and
+ * the scale factor, it can be reused between runs: while the parser works,
+ * a ThemeCache records every state mutation it performs on ThemeEngine and
+ * ThemeEval as a compact binary op stream. The stream is written to a
+ * savefile together with a key describing the inputs; on later runs with a
+ * matching key the ops are simply replayed from a single read, skipping the
+ * XML parser entirely.
+ *
+ * Any mismatch or replay error falls back to a full parse, which rewrites
+ * the cache.
+ */
+class ThemeCache {
+public:
+	ThemeCache() : _ops(DisposeAfterUse::YES) {}
+
+	/** ThemeEval mutations, recorded from the parser callbacks. */
+	void recordSetVar(const Common::String &name, int value);
+	void recordDialog(const Common::String &name, const Common::String &overlays, int16 maxWidth, int16 maxHeight, int inset);
+	void recordLayout(ThemeLayout::LayoutType type, int spacing, ThemeLayout::ItemAlign itemAlign);
+	void recordWidget(const Common::String &name, const Common::String &type, int w, int h, Graphics::TextAlign align, bool useRTL);
+	void recordImportedLayout(const Common::String &name);
+	void recordSpace(int size);
+	void recordPadding(int16 l, int16 r, int16 t, int16 b);
+	void recordCloseLayout();
+	void recordCloseDialog();
+
+	/** ThemeEngine mutations, recorded from the parser callbacks. */
+	void recordDrawData(const Common::String &data, bool cached);
+	void recordDrawStep(const Common::String &drawDataId, const Graphics::DrawStep &step, const Common::String &bitmapName);
+	void recordFont(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize);
+	void recordStoreFontNames(TextData textId, const Common::String &language, const Common::String &file, const Common::String &scalableFile, int pointsize);
+	void recordTextColor(TextColor colorId, int r, int g, int b);
+	void recordTextData(const Common::String &drawDataId, TextData textId, TextColor colorId, Graphics::TextAlign alignH, ThemeEngine::TextAlignVertical alignV);
+	void recordBitmap(const Common::String &filename, const Common::String &scalablefile, int width, int height);
+	void recordCursor(const Common::String &filename, int hotspotX, int hotspotY);
+
+	/**
+	 * Writes the recorded op stream to the cache savefile, prefixed with a
+	 * key built from the given theme identity and resolution.
+	 */
+	bool save(const Common::String &themeId, const Common::String &themeHeader, int16 baseWidth, int16 baseHeight, float scaleFactor);
+
+	/**
+	 * Tries to rebuild the theme from the cache savefile. Returns false if
+	 * there is no cache, the key does not match or the stream is damaged;
+	 * in the latter case the partially applied state must be freed by the
+	 * caller before re-parsing.
+	 */
+	static bool load(ThemeEngine *theme, const Common::String &themeId, const Common::String &themeHeader, int16 baseWidth, int16 baseHeight, float scaleFactor);
+
+private:
+	void writeString(const Common::String &str);
+
+	Common::MemoryWriteStreamDynamic _ops;
+};
+
+} // End of namespace GUI
+
+#endif
@@ -41,6 +41,7 @@
 #include "image/png.h"
 
 #include "gui/widget.h"
+#include "gui/ThemeCache.h"
 #include "gui/ThemeEngine.h"
 #include "gui/ThemeEval.h"
 #include "gui/ThemeParser.h"
@@ -196,6 +197,7 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 
 	_system = g_system;
 	_parser = new ThemeParser(this);
+	_themeCache = nullptr;
 	_themeEval = new GUI::ThemeEval();
 	_themeEval->setScaleFactor(_scaleFactor);
 
@@ -243,6 +245,7 @@ ThemeEngine::~ThemeEngine() {
 	_screen.free();
 	_backBuffer.free();
 
+	discardThemeCacheRecording();
 	unloadTheme();
 	unloadExtraFont();
 
@@ -375,6 +378,10 @@ void ThemeEngine::clearAll() {
 	if (_initOk) {
 		_system->clearOverlay();
 		_system->grabOverlay(*_backBuffer.surfacePtr());
+
+		// The whole backbuffer was replaced, so the next
+		// copyBackBufferToScreen() has to copy all of it.
+		addDirtyRect(Common::Rect(0, 0, _screen.w, _screen.h));
 	}
 }
 
@@ -384,12 +391,20 @@ void ThemeEngine::refresh() {
 	if (_overlayFormat != _system->getOverlayFormat() || _needScaleRefresh) {
 		for (auto &bitmap : _bitmaps) {
 			Graphics::ManagedSurface *surf = bitmap._value;
+
+			// SVG bitmaps always rasterize into their own RGBA32 surface
+			// and keep the parsed image around, so they survive format and
+			// scale changes; addBitmap() re-renders them at the new size
+			// instead of running the SVG parser again.
+			if (dynamic_cast<Graphics::SVGBitmap *>(surf))
+				continue;
+
 			if (surf) {
 				surf->free();
 				delete surf;
 			}
+			bitmap._value = nullptr;
 		}
-		_bitmaps.clear();
 
 		_needScaleRefresh = false;
 	}
@@ -508,9 +523,27 @@ void ThemeEngine::addDrawStep(const Common::String &drawDataId, const Graphics::
 
 	assert(id != kDDNone && _widgets[id] != nullptr);
 	_widgets[id]->_steps.push_back(step);
+
+	if (_themeCache) {
+		// The cache stores bitmaps by name; look the name up from the
+		// resolved surface pointer.
+		Common::String bitmapName;
+		if (step.blitSrc) {
+			for (ImagesMap::const_iterator i = _bitmaps.begin(); i != _bitmaps.end(); ++i) {
+				if (i->_value == step.blitSrc) {
+					bitmapName = i->_key;
+					break;
+				}
+			}
+		}
+		_themeCache->recordDrawStep(drawDataId, step, bitmapName);
+	}
 }
 
 bool ThemeEngine::addTextData(const Common::String &drawDataId, TextData textId, TextColor colorId, Graphics::TextAlign alignH, TextAlignVertical alignV) {
+	if (_themeCache)
+		_themeCache->recordTextData(drawDataId, textId, colorId, alignH, alignV);
+
 	DrawData id = parseDrawDataId(drawDataId);
 
 	if (id == -1 || textId == -1 || colorId == kTextColorMAX || !_widgets[id])
@@ -528,6 +561,9 @@ bool ThemeEngine::addFont(TextData textId, const Common::String &language, const
 	if (textId == -1)
 		return false;
 
+	if (_themeCache)
+		_themeCache->recordFont(textId, language, file, scalableFile, pointsize);
+
 	if (!language.empty()) {
 #ifdef USE_TRANSLATION
 		Common::String cl = TransMan.getCurrentLanguage();
@@ -607,6 +643,9 @@ void ThemeEngine::storeFontNames(TextData textId, const Common::String &language
 	if (language.empty())
 		return;
 
+	if (_themeCache)
+		_themeCache->recordStoreFontNames(textId, language, file, scalableFile, pointsize);
+
 	Common::Array<Common::Language> langs = getLangIdentifiers(language);
 	if (langs.empty())
 		return;
@@ -633,6 +672,9 @@ bool ThemeEngine::addTextColor(TextColor colorId, int r, int g, int b) {
 	if (colorId >= kTextColorMAX)
 		return false;
 
+	if (_themeCache)
+		_themeCache->recordTextColor(colorId, r, g, b);
+
 	if (_textColors[colorId] != nullptr)
 		delete _textColors[colorId];
 
@@ -646,9 +688,18 @@ bool ThemeEngine::addTextColor(TextColor colorId, int r, int g, int b) {
 }
 
 bool ThemeEngine::addBitmap(const Common::String &filename, const Common::String &scalablefile, int width, int height) {
+	if (_themeCache)
+		_themeCache->recordBitmap(filename, scalablefile, width, height);
+
 	// Nothing has to be done if the bitmap already has been loaded.
 	Graphics::ManagedSurface *surf = _bitmaps[filename];
 	if (surf) {
+		// A retained SVG bitmap just needs re-rendering when the scale
+		// factor changed since it was rasterized.
+		Graphics::SVGBitmap *svg = dynamic_cast<Graphics::SVGBitmap *>(surf);
+		if (svg && (svg->w != (int16)(width * _scaleFactor) || svg->h != (int16)(height * _scaleFactor)))
+			svg->render(width * _scaleFactor, height * _scaleFactor);
+
 		return true;
 	}
 
@@ -673,6 +724,9 @@ bool ThemeEngine::addBitmap(const Common::String &filename, const Common::String
 		// Maybe it is PNG?
 #ifdef USE_PNG
 		Image::PNGDecoder decoder;
+		// Decode straight into the overlay format when it is one libpng can
+		// produce, so convertFrom below degrades to a plain copy.
+		decoder.setOutputPixelFormat(_overlayFormat);
 		Common::ArchiveMemberList members;
 		_themeFiles.listMatchingMembers(members, Common::Path(filename, '/'));
 		for (Common::ArchiveMemberList::const_iterator i = members.begin(), end = members.end(); i != end; ++i) {
@@ -743,6 +797,9 @@ bool ThemeEngine::addDrawData(const Common::String &data, bool cached) {
 	if (id == -1)
 		return false;
 
+	if (_themeCache)
+		_themeCache->recordDrawData(data, cached);
+
 	if (_widgets[id] != nullptr)
 		delete _widgets[id];
 
@@ -789,6 +846,10 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	freeThemeData();
+}
+
+void ThemeEngine::freeThemeData() {
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = nullptr;
@@ -880,9 +941,27 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 		return false;
 	}
 
+	//
+	// Try the compiled-theme cache first: when it was written for this
+	// exact theme version, resolution and scale, it replaces the whole
+	// XML parse below with a single read.
+	//
+	if (ConfMan.getBool("gui_theme_cache")) {
+		if (ThemeCache::load(this, themeId, stxHeader, _baseWidth, _baseHeight, _scaleFactor))
+			return true;
+
+		// A damaged cache may have been partially applied; start clean.
+		freeThemeData();
+
+		// Record the upcoming parse so it can be skipped next time.
+		_themeCache = new ThemeCache();
+		_themeEval->setThemeCache(_themeCache);
+	}
+
 	Common::ArchiveMemberList members;
 	if (0 == _themeArchive->listMatchingMembers(members, "*.stx")) {
 		warning("Found no STX files for theme '%s'.", themeId.c_str());
+		discardThemeCacheRecording();
 		return false;
 	}
 
@@ -895,22 +974,38 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 		if (_parser->loadStream(member->createReadStream()) == false) {
 			warning("Failed to load STX file '%s'", member->getName().c_str());
 			_parser->close();
+			discardThemeCacheRecording();
 			return false;
 		}
 
 		if (_parser->parse() == false) {
 			warning("Failed to parse STX file '%s'", member->getName().c_str());
 			_parser->close();
+			discardThemeCacheRecording();
 			return false;
 		}
 
 		_parser->close();
 	}
 
+	if (_themeCache) {
+		_themeCache->save(themeId, stxHeader, _baseWidth, _baseHeight, _scaleFactor);
+		discardThemeCacheRecording();
+	}
+
 	assert(!_themeName.empty());
 	return true;
 }
 
+void ThemeEngine::discardThemeCacheRecording() {
+	if (!_themeCache)
+		return;
+
+	_themeEval->setThemeCache(nullptr);
+	delete _themeCache;
+	_themeCache = nullptr;
+}
+
 
 
 /**********************************************************
@@ -1519,7 +1614,22 @@ void ThemeEngine::debugWidgetPosition(const char *name, const Common::Rect &r) {
  * Screen/overlay management
  *********************************************************/
 void ThemeEngine::copyBackBufferToScreen() {
-	memcpy(_screen.getPixels(), _backBuffer.getPixels(), (size_t)(_screen.pitch * _screen.h));
+	// Only copy over the regions that were actually repainted on the
+	// backbuffer instead of the whole surface; for a plain top dialog
+	// redraw that is just the dialog's own rectangle. The rects stay in
+	// the dirty list, so updateDirtyScreen() will flush these very same
+	// regions to the overlay afterwards.
+	for (const Common::Rect &r : _dirtyScreen) {
+		const byte *src = (const byte *)_backBuffer.getBasePtr(r.left, r.top);
+		byte *dst = (byte *)_screen.getBasePtr(r.left, r.top);
+		const uint32 lineSize = r.width() * _backBuffer.format.bytesPerPixel;
+
+		for (int y = r.top; y < r.bottom; ++y) {
+			memcpy(dst, src, lineSize);
+			src += _backBuffer.pitch;
+			dst += _screen.pitch;
+		}
+	}
 }
 
 void ThemeEngine::updateScreen() {
@@ -1585,6 +1695,9 @@ bool ThemeEngine::createCursor(const Common::String &filename, int hotspotX, int
 	if (!cursor)
 		return false;
 
+	if (_themeCache)
+		_themeCache->recordCursor(filename, hotspotX, hotspotY);
+
 	// Set up the cursor parameters
 	_cursorHotspotX = hotspotX;
 	_cursorHotspotY = hotspotY;
@@ -51,6 +51,7 @@ struct WidgetDrawData;
 struct TextDrawData;
 class Dialog;
 class GuiObject;
+class ThemeCache;
 class ThemeEval;
 class ThemeParser;
 
@@ -409,7 +410,7 @@ public:
 	void updateScreen();
 
 	/**
-	 * Copy the entire backbuffer surface to the screen surface
+	 * Copy the dirty regions of the backbuffer surface to the screen surface
 	 */
 	void copyBackBufferToScreen();
 
@@ -688,6 +689,15 @@ protected:
 	 */
 	void unloadTheme();
 
+	/**
+	 * Worker for unloadTheme(); also used to throw away the partial state
+	 * left behind when replaying a compiled theme cache fails.
+	 */
+	void freeThemeData();
+
+	/** Stops recording the current parse into the compiled theme cache. */
+	void discardThemeCacheRecording();
+
 	/**
 	 * Unload the language specific font loaded via loadExtraFont()
 	*/
@@ -756,6 +766,9 @@ protected:
 	/** Theme getEvaluator (changed from GUI::Eval to add functionality) */
 	GUI::ThemeEval *_themeEval;
 
+	/** Records the parse result while loading a theme from XML; null outside of that */
+	GUI::ThemeCache *_themeCache;
+
 	/** Main screen surface. This is blitted straight into the overlay. */
 	Graphics::ManagedSurface _screen;
 
@@ -19,6 +19,7 @@
  *
  */
 
+#include "gui/ThemeCache.h"
 #include "gui/ThemeEval.h"
 
 #include "graphics/scaler.h"
@@ -85,7 +86,22 @@ Graphics::TextAlign ThemeEval::getWidgetTextHAlign(const Common::String &widget)
 	return _layouts[dialogName]->getWidgetTextHAlign(widgetName);
 }
 
+void ThemeEval::recordSetVar(const Common::String &name, int val) {
+	_cache->recordSetVar(name, val);
+}
+
+void ThemeEval::recordCloseLayout() {
+	_cache->recordCloseLayout();
+}
+
+void ThemeEval::recordCloseDialog() {
+	_cache->recordCloseDialog();
+}
+
 ThemeEval &ThemeEval::addWidget(const Common::String &name, const Common::String &type, int w, int h, Graphics::TextAlign align, bool useRTL) {
+	if (_cache)
+		_cache->recordWidget(name, type, w, h, align, useRTL);
+
 	int typeW = -1;
 	int typeH = -1;
 	Graphics::TextAlign typeAlign = Graphics::kTextAlignInvalid;
@@ -122,6 +138,9 @@ ThemeEval &ThemeEval::addWidget(const Common::String &name, const Common::String
 }
 
 ThemeEval &ThemeEval::addDialog(const Common::String &name, const Common::String &overlays, int16 width, int16 height, int inset) {
+	if (_cache)
+		_cache->recordDialog(name, overlays, width, height, inset);
+
 	Common::String var = "Dialog." + name;
 
 	ThemeLayout *layout = new ThemeLayoutMain(name, overlays, width, height, inset);
@@ -145,6 +164,9 @@ ThemeEval &ThemeEval::addDialog(const Common::String &name, const Common::String
 }
 
 ThemeEval &ThemeEval::addLayout(ThemeLayout::LayoutType type, int spacing, ThemeLayout::ItemAlign itemAlign) {
+	if (_cache)
+		_cache->recordLayout(type, spacing, itemAlign);
+
 	ThemeLayout *layout = nullptr;
 
 	if (spacing == -1)
@@ -168,6 +190,9 @@ ThemeEval &ThemeEval::addLayout(ThemeLayout::LayoutType type, int spacing, Theme
 }
 
 ThemeEval &ThemeEval::addSpace(int size) {
+	if (_cache)
+		_cache->recordSpace(size);
+
 	ThemeLayout *space = new ThemeLayoutSpacing(_curLayout.top(), size);
 	_curLayout.top()->addChild(space);
 
@@ -177,6 +202,9 @@ ThemeEval &ThemeEval::addSpace(int size) {
 #define SCALEVALUE(val) (val > 0 ? val * _scaleFactor : val)
 
 ThemeEval &ThemeEval::addPadding(int16 l, int16 r, int16 t, int16 b) {
+	if (_cache)
+		_cache->recordPadding(l, r, t, b);
+
 	_curLayout.top()->setPadding(SCALEVALUE(l), SCALEVALUE(r), SCALEVALUE(t), SCALEVALUE(b));
 
 	return *this;
@@ -202,6 +230,9 @@ void ThemeEval::reflowDialogLayout(const Common::String &name, Widget *widgetCha
 }
 
 ThemeEval &ThemeEval::addImportedLayout(const Common::String &name) {
+	if (_cache)
+		_cache->recordImportedLayout(name);
+
 	ThemeLayout *importedLayout = _layouts[name];
 	assert(importedLayout);
 
@@ -34,13 +34,15 @@
 
 namespace GUI {
 
+class ThemeCache;
+
 class ThemeEval {
 
 	typedef Common::HashMap<Common::String, int> VariablesMap;
 	typedef Common::HashMap<Common::String, ThemeLayout *> LayoutsMap;
 
 public:
-	ThemeEval() : _scaleFactor(1.0f) {
+	ThemeEval() : _scaleFactor(1.0f), _cache(nullptr) {
 		buildBuiltinVars();
 	}
 
@@ -71,7 +73,11 @@ public:
 
 	void setScaleFactor(float s) { _scaleFactor = s; }
 
-	void setVar(const Common::String &name, int val) { _vars[name] = val; }
+	void setVar(const Common::String &name, int val) {
+		_vars[name] = val;
+		if (_cache)
+			recordSetVar(name, val);
+	}
 
 	bool hasVar(const Common::String &name) { return _vars.contains(name) || _builtin.contains(name); }
 
@@ -83,8 +89,26 @@ public:
 
 	ThemeEval &addPadding(int16 l, int16 r, int16 t, int16 b);
 
-	ThemeEval &closeLayout() { _curLayout.pop(); return *this; }
-	ThemeEval &closeDialog() { _curLayout.pop(); _curDialog.clear(); return *this; }
+	ThemeEval &closeLayout() {
+		if (_cache)
+			recordCloseLayout();
+		_curLayout.pop();
+		return *this;
+	}
+
+	ThemeEval &closeDialog() {
+		if (_cache)
+			recordCloseDialog();
+		_curLayout.pop();
+		_curDialog.clear();
+		return *this;
+	}
+
+	/**
+	 * Attaches (or detaches, with nullptr) a ThemeCache that records all
+	 * layout mutations while the theme parser runs.
+	 */
+	void setThemeCache(ThemeCache *cache) { _cache = cache; }
 
 	bool hasDialog(const Common::String &name);
 
@@ -112,6 +136,10 @@ public:
 	void reset();
 
 private:
+	void recordSetVar(const Common::String &name, int val);
+	void recordCloseLayout();
+	void recordCloseDialog();
+
 	VariablesMap _vars;
 	VariablesMap _builtin;
 
@@ -120,6 +148,7 @@ private:
 	Common::String _curDialog;
 
 	float _scaleFactor;
+	ThemeCache *_cache;
 };
 
 } // End of namespace GUI
@@ -162,6 +162,7 @@ AboutDialog::AboutDialog(bool inGame)
 	// Unload all MetaEnginesDetection if we're using uncached plugins to save extra memory.
 	if (!inGame) PluginMan.unloadDetectionPlugin();
 #endif
+	if (!inGame) PluginMan.loadDeferredPlugins();
 	if (!inGame) PluginMan.loadFirstPlugin();
 	do {
 		uint32 currentTime = g_system->getMillis(true);
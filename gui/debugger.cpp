@@ -25,6 +25,8 @@
 #include "common/file.h"
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/memory.h"
+#include "common/profiler.h"
 #include "common/system.h"
 
 #ifndef DISABLE_MD5
@@ -37,6 +39,9 @@
 #include "engines/engine.h"
 
 #include "gui/debugger.h"
+#ifdef ENABLE_EVENTRECORDER
+	#include "gui/EventRecorder.h"
+#endif
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 	#include "gui/console.h"
 #elif defined(USE_READLINE)
@@ -77,6 +82,13 @@ Debugger::Debugger() {
 	registerCmd("cls",			WRAP_METHOD(Debugger, cmdClearLog)); // alias
 	registerCmd("exec",				WRAP_METHOD(Debugger, cmdExecFile));
 
+	registerCmd("profiler",			WRAP_METHOD(Debugger, cmdProfiler));
+	registerCmd("alloctrack",		WRAP_METHOD(Debugger, cmdAllocTrack));
+	registerCmd("perf",				WRAP_METHOD(Debugger, cmdPerf));
+#ifdef ENABLE_EVENTRECORDER
+	registerCmd("timescale",		WRAP_METHOD(Debugger, cmdTimeScale));
+#endif
+
 	registerCmd("debuglevel",		WRAP_METHOD(Debugger, cmdDebugLevel));
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
 	registerCmd("debugflag_enable",	WRAP_METHOD(Debugger, cmdDebugFlagEnable));
@@ -757,6 +769,170 @@ bool Debugger::cmdMd5Mac(int argc, const char **argv) {
 }
 #endif
 
+bool Debugger::cmdProfiler(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("The profiler records timings of instrumented code zones (PROFILE_SCOPE).\n");
+		debugPrintf("It is currently %s.\n", Common::Profiler::instance().isEnabled() ? "enabled" : "disabled");
+		debugPrintf("Usage: %s on | off | reset | summary | frames | hud | dump [filename]\n", argv[0]);
+		return true;
+	}
+
+	if (!strcmp(argv[1], "on")) {
+		Common::Profiler::instance().setEnabled(true);
+		debugPrintf("Profiler enabled\n");
+	} else if (!strcmp(argv[1], "off")) {
+		Common::Profiler::instance().setEnabled(false);
+		debugPrintf("Profiler disabled\n");
+	} else if (!strcmp(argv[1], "reset")) {
+		Common::Profiler::instance().reset();
+		debugPrintf("Profiler data cleared\n");
+	} else if (!strcmp(argv[1], "summary")) {
+		Common::String summary;
+		Common::Profiler::instance().getSummary(summary);
+		if (summary.empty())
+			debugPrintf("No profiler data recorded\n");
+		else
+			debugPrintf("%s", summary.c_str());
+	} else if (!strcmp(argv[1], "frames")) {
+		Common::String summary;
+		Common::Profiler::instance().getFrameSummary(summary);
+		if (summary.empty())
+			debugPrintf("No presented frames recorded\n");
+		else
+			debugPrintf("%s", summary.c_str());
+	} else if (!strcmp(argv[1], "hud")) {
+		// Show the summary on top of the game screen, so timings can be
+		// read without leaving fullscreen or pausing via the console.
+		Common::String summary;
+		Common::Profiler::instance().getSummary(summary);
+		Common::Profiler::instance().getFrameSummary(summary);
+		if (summary.empty())
+			debugPrintf("No profiler data recorded\n");
+		else
+			g_system->displayMessageOnOSD(Common::U32String(summary));
+	} else if (!strcmp(argv[1], "dump")) {
+		Common::String filename = (argc > 2) ? argv[2] : "scummvm-trace.json";
+		if (Common::Profiler::instance().dumpTrace(filename))
+			debugPrintf("Trace written to '%s' (Chrome trace format)\n", filename.c_str());
+		else
+			debugPrintf("Failed to write '%s'\n", filename.c_str());
+	} else {
+		debugPrintf("Usage: %s on | off | reset | summary | frames | hud | dump [filename]\n", argv[0]);
+	}
+
+	return true;
+}
+
+bool Debugger::cmdAllocTrack(int argc, const char **argv) {
+	if (argc < 2) {
+		debugPrintf("The allocation tracker records instrumented allocation sites (ALLOC_TRACK).\n");
+		debugPrintf("It is currently %s.\n", Common::AllocTracker::instance().isEnabled() ? "enabled" : "disabled");
+		debugPrintf("Usage: %s on | off | reset | summary\n", argv[0]);
+		return true;
+	}
+
+	if (!strcmp(argv[1], "on")) {
+		Common::AllocTracker::instance().setEnabled(true);
+		debugPrintf("Allocation tracking enabled\n");
+	} else if (!strcmp(argv[1], "off")) {
+		Common::AllocTracker::instance().setEnabled(false);
+		debugPrintf("Allocation tracking disabled\n");
+	} else if (!strcmp(argv[1], "reset")) {
+		Common::AllocTracker::instance().reset();
+		debugPrintf("Allocation tracking data cleared\n");
+	} else if (!strcmp(argv[1], "summary")) {
+		Common::String summary;
+		Common::AllocTracker::instance().getSummary(summary);
+		if (summary.empty())
+			debugPrintf("No allocations recorded\n");
+		else
+			debugPrintf("%s", summary.c_str());
+	} else {
+		debugPrintf("Usage: %s on | off | reset | summary\n", argv[0]);
+	}
+
+	return true;
+}
+
+bool Debugger::cmdPerf(int argc, const char **argv) {
+	// One front door over the recorders, so a slow scene can be diagnosed
+	// in the field with a single command set in any engine's console. The
+	// individual "profiler" and "alloctrack" commands expose the less
+	// common subcommands (trace dumps, HUD, resets).
+	if (argc < 2) {
+		debugPrintf("Performance counters. Zone and allocation recording is %s.\n",
+			Common::Profiler::instance().isEnabled() ? "on" : "off");
+		debugPrintf("Usage: %s on | off | frame | zones | alloc | io [csv <file>]\n", argv[0]);
+		return true;
+	}
+
+	if (!strcmp(argv[1], "on")) {
+		Common::Profiler::instance().setEnabled(true);
+		Common::AllocTracker::instance().setEnabled(true);
+		debugPrintf("Zone and allocation recording enabled\n");
+	} else if (!strcmp(argv[1], "off")) {
+		Common::Profiler::instance().setEnabled(false);
+		Common::AllocTracker::instance().setEnabled(false);
+		debugPrintf("Zone and allocation recording disabled\n");
+	} else if (!strcmp(argv[1], "frame")) {
+		Common::String summary;
+		Common::Profiler::instance().getFrameSummary(summary);
+		if (summary.empty())
+			debugPrintf("No presented frames recorded (is recording on? try 'perf on')\n");
+		else
+			debugPrintf("%s", summary.c_str());
+	} else if (!strcmp(argv[1], "zones")) {
+		Common::String summary;
+		Common::Profiler::instance().getSummary(summary);
+		if (summary.empty())
+			debugPrintf("No profiler data recorded (is recording on? try 'perf on')\n");
+		else
+			debugPrintf("%s", summary.c_str());
+	} else if (!strcmp(argv[1], "alloc")) {
+		Common::String summary;
+		Common::AllocTracker::instance().getSummary(summary);
+		if (summary.empty())
+			debugPrintf("No allocations recorded (is recording on? try 'perf on')\n");
+		else
+			debugPrintf("%s", summary.c_str());
+	} else if (!strcmp(argv[1], "io")) {
+		if (argc >= 4 && !strcmp(argv[2], "csv")) {
+			if (Common::Profiler::instance().dumpIoCsv(argv[3]))
+				debugPrintf("I/O counters written to %s\n", argv[3]);
+			else
+				debugPrintf("Failed to write %s\n", argv[3]);
+		} else {
+			Common::String summary;
+			Common::Profiler::instance().getIoSummary(summary);
+			debugPrintf("%s", summary.c_str());
+		}
+	} else {
+		debugPrintf("Usage: %s on | off | frame | zones | alloc | io [csv <file>]\n", argv[0]);
+	}
+
+	return true;
+}
+
+#ifdef ENABLE_EVENTRECORDER
+bool Debugger::cmdTimeScale(int argc, const char **argv) {
+	if (argc == 1) {
+		debugPrintf("The system clock currently runs at %ux speed.\n", g_eventRec.getTimeScale());
+		debugPrintf("Usage: %s <n> where n is the speed multiplier (1 for real time)\n", argv[0]);
+		return true;
+	}
+
+	int scale = atoi(argv[1]);
+	if (scale < 1) {
+		debugPrintf("Invalid time scale '%s'\n", argv[1]);
+		return true;
+	}
+
+	g_eventRec.setTimeScale(scale);
+	debugPrintf("Time scale set to %dx\n", scale);
+	return true;
+}
+#endif
+
 bool Debugger::cmdDebugLevel(int argc, const char **argv) {
 	if (argc == 1) { // print level
 		debugPrintf("Debugging is currently %s (set at level %d)\n", (gDebugLevel >= 0) ? "enabled" : "disabled", gDebugLevel);
@@ -277,6 +277,12 @@ protected:
 	bool cmdDebugFlagDisable(int argc, const char **argv);
 	bool cmdClearLog(int argc, const char **argv);
 	bool cmdExecFile(int argc, const char **argv);
+	bool cmdProfiler(int argc, const char **argv);
+	bool cmdAllocTrack(int argc, const char **argv);
+	bool cmdPerf(int argc, const char **argv);
+#ifdef ENABLE_EVENTRECORDER
+	bool cmdTimeScale(int argc, const char **argv);
+#endif
 
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 private:
@@ -20,6 +20,7 @@
  */
 
 #include "common/events.h"
+#include "common/memorypool.h"
 #include "common/translation.h"
 #include "common/zip-set.h"
 #include "gui/EventRecorder.h"
@@ -549,6 +550,10 @@ void GuiManager::runLoop() {
 	while (!_dialogStack.empty() && activeDialog == getTopDialog() && !eventMan->shouldQuit() && (!g_engine || !eventMan->shouldReturnToLauncher())) {
 		uint32 frameStartTime = _system->getMillis(true);
 
+		// We own the main loop here, so frame-local temporaries from the
+		// previous iteration can be released in one go.
+		_system->getScratchArena().reset();
+
 		// Don't "tickle" the dialog until the theme has had a chance
 		// to re-allocate buffers in case of a scaler change.
 
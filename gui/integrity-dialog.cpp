@@ -19,14 +19,20 @@
  *
  */
 
+// Disable symbol overrides so that we can use the POSIX thread API for the
+// background checksum worker (pthread.h drags in time.h)
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
 #include "gui/integrity-dialog.h"
 
 #include "common/array.h"
 #include "common/config-manager.h"
 #include "common/debug.h"
 #include "common/file.h"
+#include "common/fs.h"
 #include "common/macresman.h"
 #include "common/md5.h"
+#include "common/threadpool.h"
 #include "common/tokenizer.h"
 #include "common/translation.h"
 
@@ -36,6 +42,11 @@
 #include "gui/message.h"
 #include "gui/widget.h"
 
+#if defined(POSIX)
+#define INTEGRITY_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 #define TESTING 0
 
 namespace GUI {
@@ -66,10 +77,16 @@ struct ChecksumDialogState {
 	IntegrityDialog *dialog;
 	ProcessState state;
 
-	int totalSize;
-	int calculatedSize;
+	int64 totalSize;
+	int64 calculatedSize;
 	uint32 lastUpdate;
 
+	// Checksums produced by the worker, consumed by generateJSONRequest()
+	// once calculation is complete.
+	Common::Array<Common::StringArray> fileChecksums;
+	bool checksumsReady;
+	bool cancelled;
+
 	Common::String endpoint;
 	Common::Path gamePath;
 	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> ignoredSubdirsMap;
@@ -79,19 +96,47 @@ struct ChecksumDialogState {
 	Common::String platform;
 	Common::String language;
 
+#ifdef INTEGRITY_USE_PTHREADS
+	pthread_mutex_t mutex;
+	pthread_t thread;
+	bool threadRunning;
+
+	void lock() { pthread_mutex_lock(&mutex); }
+	void unlock() { pthread_mutex_unlock(&mutex); }
+#else
+	void lock() {}
+	void unlock() {}
+#endif
+
 	ChecksumDialogState() {
 		state = kChecksumStateNone;
 		totalSize = calculatedSize = 0;
 		lastUpdate = 0;
 		dialog = nullptr;
+		checksumsReady = false;
+		cancelled = false;
+#ifdef INTEGRITY_USE_PTHREADS
+		pthread_mutex_init(&mutex, nullptr);
+		threadRunning = false;
+#endif
+	}
+
+	~ChecksumDialogState() {
+#ifdef INTEGRITY_USE_PTHREADS
+		pthread_mutex_destroy(&mutex);
+#endif
 	}
 } static *g_checksum_state;
 
+static void startChecksumWork();
+
 uint32 getCalculationProgress() {
 	if (!g_checksum_state || g_checksum_state->totalSize == 0)
 		return 0;
 
+	g_checksum_state->lock();
 	uint32 progress = (uint32)(100 * ((double)g_checksum_state->calculatedSize / (double)g_checksum_state->totalSize));
+	g_checksum_state->unlock();
 
 	return progress;
 }
@@ -181,6 +226,7 @@ IntegrityDialog::IntegrityDialog(Common::String endpoint, Common::String domain)
 		g_checksum_state->platform = ConfMan.get("platform", domain);
 		g_checksum_state->language = ConfMan.get("language", domain);
 		calculateTotalSize(g_checksum_state->gamePath, g_checksum_state->ignoredSubdirsMap);
+		startChecksumWork();
 	} else {
 		g_checksum_state->dialog = this;
 
@@ -194,8 +240,10 @@ IntegrityDialog::~IntegrityDialog() {
 
 
 bool IntegrityDialog::progressUpdate(int bytesProcessed) {
-	if (g_checksum_state->dialog->_close)
+	if (g_checksum_state->dialog->_close) {
+		g_checksum_state->cancelled = true;
 		return false;
+	}
 
 	g_checksum_state->calculatedSize += bytesProcessed;
 
@@ -221,6 +269,369 @@ static bool progressUpdateCallback(void *param, int bytesProcessed) {
 	return dialog->progressUpdate(bytesProcessed);
 };
 
+// Progress hook for checksum work running off the GUI thread: aggregate the
+// processed bytes and check for cancellation. The dialog picks the counters
+// up from handleTickle(), so no GUI code runs here.
+static bool backgroundProgressCallback(void *, int bytesProcessed) {
+	ChecksumDialogState *state = g_checksum_state;
+
+	state->lock();
+	state->calculatedSize += bytesProcessed;
+	bool keepGoing = !state->cancelled;
+	state->unlock();
+
+	return keepGoing;
+}
+
+static bool checksumWorkReady() {
+	ChecksumDialogState *state = g_checksum_state;
+
+	state->lock();
+	bool ready = state->checksumsReady;
+	state->unlock();
+
+	return ready;
+}
+
+static bool checksumWorkCancelled() {
+	ChecksumDialogState *state = g_checksum_state;
+
+	state->lock();
+	bool cancelled = state->cancelled;
+	state->unlock();
+
+	return cancelled;
+}
+
+// A single file to be checksummed. Regular files carry their FSNode and are
+// hashed in parallel on the worker's pool; Mac files resolve their forks
+// through MacResManager and the dialog's private FSDirectory, neither of
+// which may be used from several threads at once, so those are hashed
+// serially by the worker.
+struct ChecksumJob {
+	Common::FSNode node;
+	Common::Path filename; ///< relative to the game path
+	bool isMac;
+	Common::StringArray result;
+
+	ChecksumJob() : isMac(false) {}
+};
+
+// Size of the read chunks used when hashing. Large sequential reads keep the
+// disk streaming, and each chunk feeds every prefix context below.
+static const uint32 kChecksumReadChunkSize = 256 * 1024;
+
+static const uint32 kChecksizes[] = {0, 5000, 1024 * 1024};
+
+// Computes the MD5s of all three prefix views of the stream (full contents,
+// first 5000 bytes, first 1 MiB) in one sequential pass: reading the data
+// once and updating one context per view is far cheaper than re-reading the
+// file for every checksize. Returns false if the work was cancelled.
+static bool computePrefixMD5s(Common::SeekableReadStream &stream, Common::String checksums[3], ProgressUpdateCallback callback, void *callbackParameter) {
+	Common::MD5 ctx[3];
+	byte *buf = new byte[kChecksumReadChunkSize];
+	uint64 pos = 0;
+	uint32 n;
+
+	while ((n = stream.read(buf, kChecksumReadChunkSize)) > 0) {
+		if (callback != nullptr && !callback(callbackParameter, n)) {
+			delete[] buf;
+			return false;
+		}
+
+		for (int i = 0; i < 3; i++) {
+			if (kChecksizes[i] == 0)
+				ctx[i].update(buf, n);
+			else if (pos < kChecksizes[i])
+				ctx[i].update(buf, (uint32)MIN<uint64>(n, kChecksizes[i] - pos));
+		}
+
+		pos += n;
+	}
+
+	delete[] buf;
+
+	for (int i = 0; i < 3; i++)
+		checksums[i] = ctx[i].finishAsString();
+
+	return true;
+}
+
+static void hashFileJob(ChecksumJob &job, ProgressUpdateCallback callback, void *callbackParameter) {
+	Common::File file;
+	if (!file.open(job.node)) {
+		warning("Failed to open file: %s", job.filename.toString().c_str());
+		return;
+	}
+
+	Common::String prefixes[3];
+	if (!computePrefixMD5s(file, prefixes, callback, callbackParameter))
+		return;
+
+	Common::StringArray fileChecksum = {job.filename.toString()};
+	// Various checksizes
+	for (int i = 0; i < 3; i++) {
+		Common::String sz = kChecksizes[i] ? Common::String::format("-%d", kChecksizes[i]) : "";
+		fileChecksum.push_back(Common::String::format("md5%s", sz.c_str()));
+		fileChecksum.push_back(prefixes[i]);
+	}
+	// Tail checksums with checksize 5000
+	file.seek(-5000, SEEK_END);
+	fileChecksum.push_back("md5-t-5000");
+	fileChecksum.push_back(Common::computeStreamMD5AsString(file, 0, callback, callbackParameter));
+
+	fileChecksum.push_back("size");
+	fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)file.size()));
+
+	file.close();
+	job.result = fileChecksum;
+}
+
+static void hashMacJob(ChecksumJob &job, Common::Archive &gameDir, ProgressUpdateCallback callback, void *callbackParameter) {
+	Common::MacResManager macFile;
+	if (!macFile.open(job.filename, gameDir) || !macFile.isMacFile()) {
+		warning("Failed to open file: %s", job.filename.toString().c_str());
+		return;
+	}
+
+	Common::SeekableReadStream *dataForkStream = Common::MacResManager::openFileOrDataFork(job.filename, gameDir);
+
+	Common::String prefixes[3];
+	if (!computePrefixMD5s(*dataForkStream, prefixes, callback, callbackParameter)) {
+		delete dataForkStream;
+		return;
+	}
+
+	Common::StringArray fileChecksum = {job.filename.toString()};
+
+	// Data fork
+	// Various checksizes
+	for (int i = 0; i < 3; i++) {
+		Common::String sz = kChecksizes[i] ? Common::String::format("-%d", kChecksizes[i]) : "";
+		fileChecksum.push_back(Common::String::format("md5-d%s", sz.c_str()));
+		fileChecksum.push_back(prefixes[i]);
+	}
+	// Tail checksums with checksize 5000
+	dataForkStream->seek(-5000, SEEK_END);
+	fileChecksum.push_back("md5-dt-5000");
+	fileChecksum.push_back(Common::computeStreamMD5AsString(*dataForkStream, 0, callback, callbackParameter));
+
+	// Resource fork
+	if (macFile.hasResFork()) {
+		// Various checksizes
+		for (int i = 0; i < 3; i++) {
+			Common::String sz = kChecksizes[i] ? Common::String::format("-%d", kChecksizes[i]) : "";
+			fileChecksum.push_back(Common::String::format("md5-r%s", sz.c_str()));
+			fileChecksum.push_back(macFile.computeResForkMD5AsString(kChecksizes[i], false, callback, callbackParameter));
+		}
+		// Tail checksums with checksize 5000
+		fileChecksum.push_back("md5-rt-5000");
+		fileChecksum.push_back(macFile.computeResForkMD5AsString(5000, true, callback, callbackParameter));
+	}
+
+	fileChecksum.push_back("size");
+	fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getDataForkSize()));
+
+	fileChecksum.push_back("size-r");
+	fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getResForkSize()));
+
+	fileChecksum.push_back("size-rd");
+	fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getResForkDataSize()));
+
+	delete dataForkStream;
+	macFile.close();
+	job.result = fileChecksum;
+}
+
+// Walks the directory tree, classifies Mac files and collects one job per
+// file to be checksummed, in the same order the old serial walk processed
+// them. Runs on a single thread since MacResManager and the FSDirectory
+// cache are not thread-safe.
+static void collectChecksumJobs(const Common::Path &currentPath, const Common::Path &gamePath, Common::Archive &gameDir, Common::Array<ChecksumJob> &jobs) {
+	const Common::FSNode dir(currentPath);
+
+	if (!dir.exists() || !dir.isDirectory())
+		return;
+
+	Common::FSList fileList;
+	if (!dir.getChildren(fileList, Common::FSNode::kListAll))
+		return;
+
+	if (fileList.empty())
+		return;
+
+	// First, we go through the list and check any Mac files
+	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> macFiles;
+	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> toRemove;
+
+	for (const auto &entry : fileList) {
+		if (entry.isDirectory())
+			continue;
+
+		Common::Path filename(entry.getPath().relativeTo(gamePath));
+		const Common::Path originalFileName = filename;
+		filename.removeExtension(".bin");
+		filename.removeExtension(".rsrc");
+
+		auto macFile = Common::MacResManager();
+
+		if (macFile.open(filename, gameDir) && macFile.isMacFile()) {
+			macFiles[originalFileName] = true;
+
+			switch (macFile.getMode()) {
+			case Common::MacResManager::kResForkRaw:
+				toRemove[filename.append(".rsrc")] = true;
+				toRemove[filename.append(".data")] = true;
+				toRemove[filename.append(".finf")] = true;
+				break;
+			case Common::MacResManager::kResForkMacBinary:
+				toRemove[filename.append(".bin")] = true;
+				break;
+			case Common::MacResManager::kResForkAppleDouble:
+				toRemove[Common::MacResManager::constructAppleDoubleName(filename)] = true;
+				toRemove[filename.getParent().append("__MACOSX")] = true;
+				break;
+			default:
+				error("Unsupported MacResManager mode: %d", macFile.getMode());
+			}
+		}
+	}
+
+	// Then we collect the jobs, recursing into subdirectories
+	for (const auto &entry : fileList) {
+		Common::Path filename(entry.getPath().relativeTo(gamePath));
+		const bool isMac = macFiles.contains(filename);
+
+		if (isMac) {
+			filename.removeExtension(".bin");
+			filename.removeExtension(".rsrc");
+		}
+
+		if (toRemove.contains(filename))
+			continue;
+
+		if (entry.isDirectory()) {
+			if (!g_checksum_state->ignoredSubdirsMap.contains(entry.getPath()))
+				collectChecksumJobs(entry.getPath(), gamePath, gameDir, jobs);
+
+			continue;
+		}
+
+		ChecksumJob job;
+		job.node = entry;
+		job.filename = filename;
+		job.isMac = isMac;
+		jobs.push_back(job);
+	}
+}
+
+struct ChecksumWorkContext {
+	ChecksumJob *jobs;
+	ProgressUpdateCallback callback;
+	void *callbackParameter;
+};
+
+static void checksumTaskProc(void *data, uint index) {
+	ChecksumWorkContext *ctx = (ChecksumWorkContext *)data;
+	ChecksumJob &job = ctx->jobs[index];
+
+	if (job.isMac)
+		return; // handled serially by the worker below
+
+	if (checksumWorkCancelled())
+		return;
+
+	hashFileJob(job, ctx->callback, ctx->callbackParameter);
+}
+
+// Computes every checksum of the game directory. Runs on the background
+// worker thread where available; the fallback runs it directly on the GUI
+// thread with the event-pumping progress callback, in which case the shared
+// pool degrades to serial execution on this very thread.
+static void runChecksumWork(ProgressUpdateCallback callback, void *callbackParameter) {
+	ChecksumDialogState *state = g_checksum_state;
+
+	// Resolve Mac forks through a private view of the game directory
+	// rather than by registering it with SearchMan: the GUI thread keeps
+	// using SearchMan while the checksum worker runs, and SearchSet
+	// lookups mutate their result cache, so the global set must stay
+	// confined to one thread.
+	Common::FSDirectory gameDir(state->gamePath, 20);
+
+	Common::Array<ChecksumJob> jobs;
+	collectChecksumJobs(state->gamePath, state->gamePath, gameDir, jobs);
+
+	// Regular files are independent of each other: fan them out so that
+	// hashing saturates either the disk or the cores. The worker gets its
+	// own pool instead of the shared instance(), so long hash tasks never
+	// delay the GUI thread's frame-sized batches behind them. Each task
+	// does its own large sequential reads.
+	ChecksumWorkContext ctx = {jobs.data(), callback, callbackParameter};
+	if (callback == backgroundProgressCallback) {
+		Common::ThreadPool pool;
+		pool.runTasks(checksumTaskProc, &ctx, jobs.size());
+	} else {
+		// The event-pumping callback may only ever run on the GUI thread
+		for (uint i = 0; i < jobs.size(); i++)
+			checksumTaskProc(&ctx, i);
+	}
+
+	// Mac files are pinned to this thread (see ChecksumJob)
+	for (auto &job : jobs) {
+		if (!job.isMac)
+			continue;
+
+		if (checksumWorkCancelled())
+			break;
+
+		hashMacJob(job, gameDir, callback, callbackParameter);
+	}
+
+	state->lock();
+	if (!state->cancelled) {
+		for (auto &job : jobs) {
+			if (!job.result.empty())
+				state->fileChecksums.push_back(job.result);
+		}
+	}
+	state->checksumsReady = true;
+	state->unlock();
+}
+
+#ifdef INTEGRITY_USE_PTHREADS
+static void *checksumThreadMain(void *) {
+	runChecksumWork(backgroundProgressCallback, nullptr);
+	return nullptr;
+}
+#endif
+
+static void startChecksumWork() {
+#ifdef INTEGRITY_USE_PTHREADS
+	g_checksum_state->threadRunning =
+		(pthread_create(&g_checksum_state->thread, nullptr, checksumThreadMain, nullptr) == 0);
+#endif
+	// Without threads the work is done synchronously from handleTickle()
+}
+
+static bool checksumThreadActive() {
+#ifdef INTEGRITY_USE_PTHREADS
+	return g_checksum_state->threadRunning;
+#else
+	return false;
+#endif
+}
+
+// Waits for the background worker to wind down. Must be called before the
+// shared state is freed under it.
+static void finishChecksumWork() {
+#ifdef INTEGRITY_USE_PTHREADS
+	if (g_checksum_state->threadRunning) {
+		pthread_join(g_checksum_state->thread, nullptr);
+		g_checksum_state->threadRunning = false;
+	}
+#endif
+}
+
 
 void IntegrityDialog::open() {
 	Dialog::open();
@@ -230,6 +641,13 @@ void IntegrityDialog::open() {
 
 void IntegrityDialog::close() {
 	if (g_checksum_state) {
+		// Tell any in-flight checksum work to stop, and wait for the worker
+		// to wind down before the state is freed under it.
+		g_checksum_state->lock();
+		g_checksum_state->cancelled = true;
+		g_checksum_state->unlock();
+		finishChecksumWork();
+
 		g_checksum_state->dialog = nullptr;
 		delete g_checksum_state;
 		g_checksum_state = nullptr;
@@ -317,8 +735,18 @@ void IntegrityDialog::handleTickle() {
 		return;
 	}
 
-	if (g_checksum_state->state == kChecksumStateCalculating)
-		sendJSON();
+	if (g_checksum_state->state == kChecksumStateCalculating) {
+		// Serial fallback for when no worker thread could be started: the
+		// progress callback pumps events so the GUI does not freeze entirely
+		if (!checksumThreadActive() && !checksumWorkReady())
+			runChecksumWork(progressUpdateCallback, this);
+
+		if (checksumWorkReady() && !_close) {
+			finishChecksumWork();
+			setState(kChecksumComplete);
+			sendJSON();
+		}
+	}
 
 	int32 progress = getCalculationProgress();
 	if (_progressBar->getValue() != progress) {
@@ -383,170 +811,8 @@ void IntegrityDialog::calculateTotalSize(Common::Path gamePath, const Common::Ha
 	}
 }
 
-Common::Array<Common::StringArray> IntegrityDialog::generateChecksums(Common::Path currentPath, Common::Array<Common::StringArray> &fileChecksums, Common::Path gamePath) {
-	const Common::FSNode dir(currentPath);
-
-	if (!dir.exists() || !dir.isDirectory())
-		return {};
-
-	Common::FSList fileList;
-	if (!dir.getChildren(fileList, Common::FSNode::kListAll))
-		return {};
-
-	if (fileList.empty())
-		return {};
-
-	// First, we go through the list and check any Mac files
-	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> macFiles;
-	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> toRemove;
-	Common::List<Common::Path> tmpFileList;
-
-	for (const auto &entry : fileList) {
-		if (entry.isDirectory())
-			continue;
-
-		Common::Path filename(entry.getPath().relativeTo(gamePath));
-		const Common::Path originalFileName = filename;
-		filename.removeExtension(".bin");
-		filename.removeExtension(".rsrc");
-
-		auto macFile = Common::MacResManager();
-
-		if (macFile.open(filename) && macFile.isMacFile()) {
-			macFiles[originalFileName] = true;
-
-			switch (macFile.getMode()) {
-			case Common::MacResManager::kResForkRaw:
-				toRemove[filename.append(".rsrc")] = true;
-				toRemove[filename.append(".data")] = true;
-				toRemove[filename.append(".finf")] = true;
-				break;
-			case Common::MacResManager::kResForkMacBinary:
-				toRemove[filename.append(".bin")] = true;
-				break;
-			case Common::MacResManager::kResForkAppleDouble:
-				toRemove[Common::MacResManager::constructAppleDoubleName(filename)] = true;
-				toRemove[filename.getParent().append("__MACOSX")] = true;
-				break;
-			default:
-				error("Unsupported MacResManager mode: %d", macFile.getMode());
-			}
-
-			tmpFileList.push_back(filename);
-		} else {
-			if (!toRemove.contains(originalFileName))
-				tmpFileList.push_back(originalFileName);
-		}
-	}
-
-	// Process the files and subdirectories in the current directory recursively
-	for (const auto &entry : fileList) {
-		Common::Path filename(entry.getPath().relativeTo(gamePath));
-
-		if (macFiles.contains(filename)) {
-			filename.removeExtension(".bin");
-			filename.removeExtension(".rsrc");
-		}
-
-		if (toRemove.contains(filename))
-			continue;
-
-		if (entry.isDirectory()) {
-			if (!g_checksum_state->ignoredSubdirsMap.contains(entry.getPath()))
-				generateChecksums(entry.getPath(), fileChecksums, gamePath);
-
-			continue;
-		}
-
-		auto macFile = Common::MacResManager();
-
-		if (macFile.open(filename) && macFile.isMacFile()) {
-			auto dataForkStream = macFile.openFileOrDataFork(filename);
-
-			Common::Array<Common::String> fileChecksum = {filename.toString()};
-
-			// Data fork
-			// Various checksizes
-			for (auto size : {0, 5000, 1024 * 1024}) {
-				Common::String sz = size ? Common::String::format("-%d", size) : "";
-				fileChecksum.push_back(Common::String::format("md5-d%s", sz.c_str()));
-				fileChecksum.push_back(Common::computeStreamMD5AsString(*dataForkStream, size, progressUpdateCallback, this));
-				dataForkStream->seek(0);
-			}
-			// Tail checksums with checksize 5000
-			dataForkStream->seek(-5000, SEEK_END);
-			fileChecksum.push_back("md5-dt-5000");
-			fileChecksum.push_back(Common::computeStreamMD5AsString(*dataForkStream, 0, progressUpdateCallback, this).c_str());
-
-			// Resource fork
-			if (macFile.hasResFork()) {
-				// Various checksizes
-				for (auto size : {0, 5000, 1024 * 1024}) {
-					Common::String sz = size ? Common::String::format("-%d", size) : "";
-					fileChecksum.push_back(Common::String::format("md5-r%s", sz.c_str()));
-					fileChecksum.push_back(macFile.computeResForkMD5AsString(size, false, progressUpdateCallback, this));
-				}
-				// Tail checksums with checksize 5000
-				fileChecksum.push_back("md5-rt-5000");
-				fileChecksum.push_back(macFile.computeResForkMD5AsString(5000, true, progressUpdateCallback, this).c_str());
-			}
-
-			fileChecksum.push_back("size");
-			fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getDataForkSize()));
-
-			fileChecksum.push_back("size-r");
-			fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getResForkSize()));
-
-			fileChecksum.push_back("size-rd");
-			fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)macFile.getResForkDataSize()));
-
-			fileChecksums.push_back(fileChecksum);
-
-			g_checksum_state->calculatedSize += dataForkStream->size();
-
-			macFile.close();
-
-			continue;
-		}
-
-		Common::File file;
-		if (!file.open(filename)) {
-			warning("Failed to open file: %s", filename.toString().c_str());
-			continue;
-		}
-
-		Common::Array<Common::String> fileChecksum = {filename.toString()};
-		// Various checksizes
-		for (auto size : {0, 5000, 1024 * 1024}) {
-			Common::String sz = size ? Common::String::format("-%d", size) : "";
-			fileChecksum.push_back(Common::String::format("md5%s", sz.c_str()));
-			fileChecksum.push_back(Common::computeStreamMD5AsString(file, size, progressUpdateCallback, this).c_str());
-			file.seek(0);
-		}
-		// Tail checksums with checksize 5000
-		file.seek(-5000, SEEK_END);
-		fileChecksum.push_back("md5-t-5000");
-		fileChecksum.push_back(Common::computeStreamMD5AsString(file, 0, progressUpdateCallback, this).c_str());
-
-		fileChecksum.push_back("size");
-		fileChecksum.push_back(Common::String::format("%llu", (unsigned long long)file.size()));
-
-		file.close();
-		fileChecksums.push_back(fileChecksum);
-	}
-
-	if (currentPath == gamePath) // Enter "checksum complete" state only once the whole root directory has been processed
-		setState(kChecksumComplete);
-	return fileChecksums;
-}
-
 Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, Common::String gameid, Common::String engineid, Common::String extra, Common::String platform, Common::String language) {
-	Common::Array<Common::StringArray> fileChecksums = {};
-
-	// Add game path to SearchMan
-	SearchMan.addDirectory(gamePath.toString(), gamePath, 0, 20);
-
-	fileChecksums = generateChecksums(gamePath, fileChecksums, gamePath);
+	const Common::Array<Common::StringArray> &fileChecksums = g_checksum_state->fileChecksums;
 
 	Common::JSONObject requestObject;
 
@@ -588,8 +854,6 @@ Common::JSONValue *IntegrityDialog::generateJSONRequest(Common::Path gamePath, C
 
 	requestObject.setVal("files", new Common::JSONValue(filesObject));
 
-	SearchMan.remove(gamePath.toString());
-
 	Common::JSONValue *request = new Common::JSONValue(requestObject);
 	return request;
 }
@@ -76,6 +76,10 @@ public:
 	/**
 	 * Updates the progress bar every 500ms
 	 * Includes polling to avoid freezing when processing files
+	 *
+	 * Only used by the serial fallback path on ports without threads; with
+	 * the background checksum worker the dialog polls the aggregated
+	 * progress from handleTickle() instead.
 	 */
 	bool progressUpdate(int bytesProcessed);
 
@@ -85,7 +89,6 @@ public:
 
 	void calculateTotalSize(Common::Path gamePath, const Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> &ignoredSubdirsMap);
 
-	Common::Array<Common::StringArray> generateChecksums(Common::Path currentPath, Common::Array<Common::StringArray> &fileChecksums, Common::Path gamePath);
 	Common::JSONValue *generateJSONRequest(Common::Path gamePath, Common::String gameid, Common::String engineid, Common::String extra, Common::String platform, Common::String language);
 	void parseJSON(const Common::JSONValue *response);
 
@@ -1694,6 +1694,9 @@ void LauncherGrid::build() {
 
 	// Add list with game titles
 	_grid = new GridWidget(this, "LauncherGrid.IconArea");
+	// The grid needs tickles even when another widget is focused, so that
+	// it can pick up thumbnails decoded in the background
+	setTickleWidget(_grid);
 	// Populate the list
 	updateListing();
 
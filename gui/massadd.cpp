@@ -25,6 +25,7 @@
 #include "common/debug.h"
 #include "common/system.h"
 #include "common/taskbar.h"
+#include "common/threadpool.h"
 #include "common/translation.h"
 
 #include "engines/advancedDetector.h"
@@ -54,6 +55,38 @@ enum {
 	kCancelCmd = 'CNCL'
 };
 
+namespace {
+
+enum {
+	// Number of directories whose contents are listed in parallel per
+	// batch. Listing is what dominates a scan on high-latency mounts
+	// (network shares, optical media), so we overlap several of them.
+	kScanBatchSize = 8
+};
+
+struct DirListTask {
+	Common::FSNode dir;
+	Common::FSList files;
+	bool listed;
+
+	DirListTask() : listed(false) {}
+};
+
+void listDirProc(void *data, uint index) {
+	DirListTask *tasks = (DirListTask *)data;
+	tasks[index].listed = tasks[index].dir.getChildren(tasks[index].files, Common::FSNode::kListAll);
+}
+
+Common::ThreadPool &scanThreadPool() {
+	// Directory listing is I/O bound, so the pool size is fixed rather
+	// than per-CPU: extra workers still help when each request spends
+	// most of its time waiting on the filesystem.
+	static Common::ThreadPool *pool = new Common::ThreadPool(kScanBatchSize);
+	return *pool;
+}
+
+} // End of anonymous namespace
+
 
 
 MassAddDialog::MassAddDialog(const Common::FSNode &startDir)
@@ -184,20 +217,40 @@ void MassAddDialog::updateGameList() {
 }
 
 void MassAddDialog::handleTickle() {
-	if (_scanStack.empty())
+	if (_scanStack.empty() && _pendingListings.empty())
 		return;	// We have finished scanning
 
 	uint32 t = g_system->getMillis();
 
-	// Perform a breadth-first scan of the filesystem.
-	while (!_scanStack.empty() && (g_system->getMillis() - t) < kMaxScanTime) {
-		Common::FSNode dir = _scanStack.pop();
-
-		Common::FSList files;
-		if (!dir.getChildren(files, Common::FSNode::kListAll)) {
+	// Perform a breadth-first scan of the filesystem. Directory listing
+	// happens batch-wise on a worker pool; the detectors themselves run
+	// here on the GUI thread, since detection goes through shared state
+	// (SearchMan, the MD5 cache, ConfMan) that is not thread safe.
+	while ((!_scanStack.empty() || !_pendingListings.empty()) && (g_system->getMillis() - t) < kMaxScanTime) {
+		if (_pendingListings.empty()) {
+			DirListTask tasks[kScanBatchSize];
+			uint count = 0;
+			while (count < kScanBatchSize && !_scanStack.empty())
+				tasks[count++].dir = _scanStack.pop();
+
+			scanThreadPool().runTasks(listDirProc, tasks, count);
+
+			for (uint i = 0; i < count; ++i) {
+				if (tasks[i].listed) {
+					_pendingListings.push(DirListing());
+					_pendingListings.back().dir = tasks[i].dir;
+					_pendingListings.back().files = tasks[i].files;
+				} else {
+					_dirsScanned++;
+				}
+			}
 			continue;
 		}
 
+		Common::FSNode dir = _pendingListings.front().dir;
+		Common::FSList files = _pendingListings.front().files;
+		_pendingListings.pop();
+
 		// Run the detector on the dir
 		DetectionResults detectionResults = EngineMan.detectGames(files, (ADGF_WARNING | ADGF_UNSUPPORTED | ADGF_ADDON), true);
 
@@ -276,7 +329,7 @@ void MassAddDialog::handleTickle() {
 	// Update the dialog
 	Common::U32String buf;
 
-	if (_scanStack.empty()) {
+	if (_scanStack.empty() && _pendingListings.empty()) {
 		// Enable the OK button
 		_okButton->setEnabled(true);
 
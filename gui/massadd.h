@@ -26,6 +26,7 @@
 #include "gui/widgets/list.h"
 #include "common/fs.h"
 #include "common/hashmap.h"
+#include "common/queue.h"
 #include "common/stack.h"
 #include "common/str.h"
 
@@ -50,6 +51,18 @@ public:
 
 private:
 	Common::Stack<Common::FSNode>  _scanStack;
+
+	/**
+	 * Directories whose contents have already been listed (in parallel,
+	 * by a worker pool) but which have not been run through the game
+	 * detectors yet. Filled batch-wise from _scanStack in handleTickle().
+	 */
+	struct DirListing {
+		Common::FSNode dir;
+		Common::FSList files;
+	};
+	Common::Queue<DirListing> _pendingListings;
+
 	DetectedGames _games;
 
 	void updateGameList();
@@ -228,6 +228,8 @@ void OptionsDialog::init() {
 	_midiPopUpDesc = nullptr;
 	_oplPopUp = nullptr;
 	_oplPopUpDesc = nullptr;
+	_resamplerPopUp = nullptr;
+	_resamplerPopUpDesc = nullptr;
 	_enableMIDISettings = false;
 	_gmDevicePopUp = nullptr;
 	_gmDevicePopUpDesc = nullptr;
@@ -493,6 +495,10 @@ void OptionsDialog::build() {
 		_oplPopUp->setSelectedTag(id);
 	}
 
+	if (_resamplerPopUp) {
+		_resamplerPopUp->setSelectedTag(ConfMan.get("audio_resampler", _domain).equalsIgnoreCase("sinc") ? 1 : 0);
+	}
+
 	if (_multiMidiCheckbox) {
 		if (!loadMusicDeviceSetting(_gmDevicePopUp, "gm_device"))
 			_gmDevicePopUp->setSelected(1);
@@ -1020,6 +1026,16 @@ void OptionsDialog::apply() {
 		}
 	}
 
+	if (_resamplerPopUp) {
+		if (_enableAudioSettings) {
+			_resamplerPopUpDesc->setFontColor(ThemeEngine::FontColor::kFontColorNormal);
+			ConfMan.set("audio_resampler", _resamplerPopUp->getSelectedTag() == 1 ? "sinc" : "linear", _domain);
+		} else {
+			_resamplerPopUpDesc->setFontColor(ThemeEngine::FontColor::kFontColorNormal);
+			ConfMan.removeKey("audio_resampler", _domain);
+		}
+	}
+
 	// MIDI options
 	if (_multiMidiCheckbox) {
 		if (_enableMIDISettings) {
@@ -1347,6 +1363,9 @@ void OptionsDialog::setAudioSettingsState(bool enabled) {
 		_oplPopUpDesc->setEnabled(enabled);
 		_oplPopUp->setEnabled(enabled);
 	}
+
+	_resamplerPopUpDesc->setEnabled(enabled);
+	_resamplerPopUp->setEnabled(enabled);
 }
 
 void OptionsDialog::setMIDISettingsState(bool enabled) {
@@ -1800,6 +1819,14 @@ void OptionsDialog::addAudioControls(GuiObject *boss, const Common::String &pref
 		++ed;
 	}
 
+	// The resampling quality popup & a label
+	_resamplerPopUpDesc = new StaticTextWidget(boss, prefix + "auResamplerPopupDesc", _("Resampling:"), _("Interpolation quality used when resampling sounds to the output rate"));
+	if (ConfMan.isKeyTemporary("audio_resampler"))
+		_resamplerPopUpDesc->setFontColor(ThemeEngine::FontColor::kFontColorOverride);
+	_resamplerPopUp = new PopUpWidget(boss, prefix + "auResamplerPopup", _("Interpolation quality used when resampling sounds to the output rate"));
+	_resamplerPopUp->appendEntry(_("Linear (fast)"), 0);
+	_resamplerPopUp->appendEntry(_("Sinc (high quality)"), 1);
+
 	_enableAudioSettings = true;
 }
 
@@ -181,6 +181,8 @@ private:
 	PopUpWidget *_midiPopUp;
 	StaticTextWidget *_oplPopUpDesc;
 	PopUpWidget *_oplPopUp;
+	StaticTextWidget *_resamplerPopUpDesc;
+	PopUpWidget *_resamplerPopUp;
 
 	StaticTextWidget *_mt32DevicePopUpDesc;
 	PopUpWidget *_mt32DevicePopUp;
@@ -654,7 +654,11 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
+		// Reuse the cached descriptor when it already carries a thumbnail;
+		// listSaves() omits thumbnails, so the first selection of a slot
+		// queries the full meta info and later ones are free.
+		const bool cached = _saveList[selItem].getLocked() || (_thumbnailSupport && _saveList[selItem].getThumbnail());
+		SaveStateDescriptor desc = (cached ? _saveList[selItem] : _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
 		if (!_saveList[selItem].getLocked() && desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
 			_saveList[selItem] = desc;
 
@@ -1169,7 +1173,10 @@ void SaveLoadChooserGrid::updateSaves() {
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
 		const uint saveSlot = _saveList[i].getSaveSlot();
 
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+		// As in SaveLoadChooserSimple::updateSelection, only query the full
+		// meta info (with thumbnail) the first time a slot becomes visible.
+		const bool cached = _saveList[i].getLocked() || (_thumbnailSupport && _saveList[i].getThumbnail());
+		SaveStateDescriptor desc = (cached ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
 		if (!_saveList[i].getLocked() && desc.getSaveSlot() >= 0 && !desc.getDescription().empty())
 			_saveList[i] = desc;
 		SlotButton &curButton = _buttons[curNum];
@@ -19,6 +19,10 @@
  *
  */
 
+// Disable symbol overrides so that we can use the POSIX thread API for the
+// background thumbnail loader (pthread.h drags in time.h)
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
 #include "common/system.h"
 #include "common/file.h"
 #include "common/language.h"
@@ -31,8 +35,18 @@
 
 #include "gui/ThemeEval.h"
 
+#if defined(POSIX)
+#define GRID_LOADER_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 namespace GUI {
 
+// Upper bound on the number of decoded thumbnails kept in _loadedSurfaces.
+// At a typical thumbnail size this is a few MB and roughly ten screens
+// worth of tiles; anything older gets re-requested when scrolled back to.
+static const uint kMaxCachedThumbnails = 512;
+
 GridItemWidget::GridItemWidget(GridWidget *boss)
 	: ContainerWidget(boss, 0, 0, 0, 0), CommandSender(boss) {
 
@@ -400,6 +414,182 @@ Graphics::ManagedSurface *loadSurfaceFromFile(const Common::String &name, int re
 
 #pragma mark -
 
+struct GridThumbnailLoader::LoaderImpl {
+	struct Request {
+		Common::String path;
+		Common::String fallbackPath;
+		int width, height;
+	};
+
+	Common::List<Request> requests;
+	Common::Array<Result> results;
+	bool quit;
+	bool threadRunning;
+
+#ifdef GRID_LOADER_USE_PTHREADS
+	pthread_mutex_t mutex;
+	pthread_cond_t requestAvailable;
+	pthread_t thread;
+
+	static void *loaderMain(void *loader);
+#endif
+
+	static void processRequest(const Request &request, Result &result);
+};
+
+// Decode and rescale one thumbnail. Runs on the loader thread; the icons
+// set itself is protected by g_gui.lockIconsSet() inside loadSurfaceFromFile().
+void GridThumbnailLoader::LoaderImpl::processRequest(const Request &request, Result &result) {
+	result.path = request.path;
+	result.loadedPath = request.path;
+	result.surface = nullptr;
+	result.reqWidth = request.width;
+	result.reqHeight = request.height;
+
+	Graphics::ManagedSurface *surf = loadSurfaceFromFile(request.path);
+	if (!surf && !request.fallbackPath.empty()) {
+		surf = loadSurfaceFromFile(request.fallbackPath);
+		result.loadedPath = request.fallbackPath;
+	}
+	if (!surf)
+		return;
+
+	const Graphics::ManagedSurface *scSurf = scaleGfx(surf, request.width, request.height, true);
+	if (surf != scSurf) {
+		surf->free();
+		delete surf;
+	}
+	result.surface = scSurf;
+}
+
+#ifdef GRID_LOADER_USE_PTHREADS
+
+void *GridThumbnailLoader::LoaderImpl::loaderMain(void *loader) {
+	LoaderImpl *impl = (LoaderImpl *)loader;
+
+	pthread_mutex_lock(&impl->mutex);
+	while (!impl->quit) {
+		if (impl->requests.empty()) {
+			pthread_cond_wait(&impl->requestAvailable, &impl->mutex);
+			continue;
+		}
+
+		Request request = impl->requests.front();
+		impl->requests.pop_front();
+
+		// Decode with the queue unlocked so the GUI thread can keep
+		// queueing and polling meanwhile.
+		pthread_mutex_unlock(&impl->mutex);
+		Result result;
+		processRequest(request, result);
+		pthread_mutex_lock(&impl->mutex);
+
+		impl->results.push_back(result);
+	}
+	pthread_mutex_unlock(&impl->mutex);
+	return nullptr;
+}
+
+#endif
+
+GridThumbnailLoader::GridThumbnailLoader() {
+	_impl = new LoaderImpl();
+	_impl->quit = false;
+	_impl->threadRunning = false;
+
+#ifdef GRID_LOADER_USE_PTHREADS
+	pthread_mutex_init(&_impl->mutex, nullptr);
+	pthread_cond_init(&_impl->requestAvailable, nullptr);
+	_impl->threadRunning = (pthread_create(&_impl->thread, nullptr, LoaderImpl::loaderMain, _impl) == 0);
+#endif
+}
+
+GridThumbnailLoader::~GridThumbnailLoader() {
+#ifdef GRID_LOADER_USE_PTHREADS
+	if (_impl->threadRunning) {
+		pthread_mutex_lock(&_impl->mutex);
+		_impl->quit = true;
+		pthread_cond_signal(&_impl->requestAvailable);
+		pthread_mutex_unlock(&_impl->mutex);
+		pthread_join(_impl->thread, nullptr);
+	}
+	pthread_mutex_destroy(&_impl->mutex);
+	pthread_cond_destroy(&_impl->requestAvailable);
+#endif
+
+	// Free any results nobody picked up.
+	for (uint i = 0; i < _impl->results.size(); ++i)
+		delete _impl->results[i].surface;
+
+	delete _impl;
+}
+
+void GridThumbnailLoader::requestThumbnail(const Common::String &path, const Common::String &fallbackPath, int width, int height) {
+#ifdef GRID_LOADER_USE_PTHREADS
+	if (_impl->threadRunning) {
+		pthread_mutex_lock(&_impl->mutex);
+		// Build the queued strings from c_str() while holding the lock:
+		// String refcounts are not atomic, so the queue must never share
+		// a buffer with strings the GUI thread keeps using.
+		_impl->requests.push_back(LoaderImpl::Request());
+		LoaderImpl::Request &queued = _impl->requests.back();
+		queued.path = path.c_str();
+		queued.fallbackPath = fallbackPath.c_str();
+		queued.width = width;
+		queued.height = height;
+		pthread_cond_signal(&_impl->requestAvailable);
+		pthread_mutex_unlock(&_impl->mutex);
+		return;
+	}
+#endif
+
+	// No thread support (or the thread failed to start): decode on the
+	// calling thread, as the grid did before.
+	LoaderImpl::Request request;
+	request.path = path;
+	request.fallbackPath = fallbackPath;
+	request.width = width;
+	request.height = height;
+	Result result;
+	LoaderImpl::processRequest(request, result);
+	_impl->results.push_back(result);
+}
+
+bool GridThumbnailLoader::pollResults(Common::Array<Result> &results) {
+#ifdef GRID_LOADER_USE_PTHREADS
+	if (_impl->threadRunning)
+		pthread_mutex_lock(&_impl->mutex);
+#endif
+
+	for (uint i = 0; i < _impl->results.size(); ++i)
+		results.push_back(_impl->results[i]);
+	_impl->results.clear();
+
+#ifdef GRID_LOADER_USE_PTHREADS
+	if (_impl->threadRunning)
+		pthread_mutex_unlock(&_impl->mutex);
+#endif
+	return !results.empty();
+}
+
+void GridThumbnailLoader::dropPendingRequests(Common::Array<Common::String> &droppedPaths) {
+#ifdef GRID_LOADER_USE_PTHREADS
+	if (_impl->threadRunning)
+		pthread_mutex_lock(&_impl->mutex);
+#endif
+
+	for (Common::List<LoaderImpl::Request>::iterator i = _impl->requests.begin(); i != _impl->requests.end(); ++i)
+		droppedPaths.push_back(i->path);
+	_impl->requests.clear();
+
+#ifdef GRID_LOADER_USE_PTHREADS
+	if (_impl->threadRunning)
+		pthread_mutex_unlock(&_impl->mutex);
+#endif
+}
+
+#pragma mark -
+
 GridWidget::GridWidget(GuiObject *boss, const Common::String &name)
 	: ContainerWidget(boss, name), CommandSender(boss) {
 
@@ -445,9 +635,15 @@ GridWidget::GridWidget(GuiObject *boss, const Common::String &name)
 
 	_selectedEntry = nullptr;
 	_isGridInvalid = true;
+
+	// Thumbnails are decoded on a background thread; handleTickle() picks
+	// up the finished surfaces.
+	_thumbnailLoader = new GridThumbnailLoader();
+	setFlags(WIDGET_WANT_TICKLE);
 }
 
 GridWidget::~GridWidget() {
+	delete _thumbnailLoader;
 	unloadSurfaces(_platformIcons);
 	unloadSurfaces(_languageIcons);
 	unloadSurfaces(_extraIcons);
@@ -472,7 +668,7 @@ void GridWidget::unloadSurfaces(Common::HashMap<T, const Graphics::ManagedSurfac
 }
 
 const Graphics::ManagedSurface *GridWidget::filenameToSurface(const Common::String &name) {
-	if (name.empty())
+	if (name.empty() || !_loadedSurfaces.contains(name))
 		return nullptr;
 	return _loadedSurfaces[name];
 }
@@ -700,45 +896,137 @@ void GridWidget::setGroupHeaderFormat(const Common::U32String &prefix, const Com
 void GridWidget::reloadThumbnails() {
 	const int thumbnailWidth = MAX(_thumbnailWidth - 2 * _thumbnailMargin, 0);
 	const int thumbnailHeight = MAX(_thumbnailHeight - 2 * _thumbnailMargin, 0);
+
+	// Stale requests from a previous visible set only delay the tiles the
+	// user is looking at now, so drop everything the loader has not
+	// started on yet; whatever is still visible is re-requested below.
+	Common::Array<Common::String> dropped;
+	_thumbnailLoader->dropPendingRequests(dropped);
+	for (uint i = 0; i < dropped.size(); ++i)
+		_pendingSurfaces.erase(dropped[i]);
+
 	for (Common::Array<GridItemInfo *>::iterator iter = _visibleEntryList.begin(); iter != _visibleEntryList.end(); ++iter) {
 		GridItemInfo *entry = *iter;
 		if (entry->thumbPath.empty())
 			continue;
 
-		if (!_loadedSurfaces.contains(entry->thumbPath)) {
-			_loadedSurfaces[entry->thumbPath] = nullptr;
-			Common::String path = Common::String::format("icons/%s-%s.png", entry->engineid.c_str(), entry->gameid.c_str());
-			Graphics::ManagedSurface *surf = loadSurfaceFromFile(path);
-			if (!surf) {
-				path = Common::String::format("icons/%s.png", entry->engineid.c_str());
-				if (!_loadedSurfaces.contains(path)) {
-					surf = loadSurfaceFromFile(path);
-				} else {
-					const Graphics::ManagedSurface *scSurf = _loadedSurfaces[path];
-					// TODO: Use SharedPtr instead of duplicating the surface
-					Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
-					thSurf->copyFrom(*scSurf);
-					_loadedSurfaces[entry->thumbPath] = thSurf;
-				}
+		if (_loadedSurfaces.contains(entry->thumbPath)) {
+			touchThumbnail(entry->thumbPath);
+			continue;
+		}
+
+		if (_pendingSurfaces.contains(entry->thumbPath))
+			continue;
+
+		Common::String fallbackPath = Common::String::format("icons/%s.png", entry->engineid.c_str());
+		if (_loadedSurfaces.contains(fallbackPath)) {
+			// The shared per-engine icon is already decoded, so there is
+			// nothing for the loader to do.
+			const Graphics::ManagedSurface *scSurf = _loadedSurfaces[fallbackPath];
+			if (scSurf) {
+				// TODO: Use SharedPtr instead of duplicating the surface
+				Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
+				thSurf->copyFrom(*scSurf);
+				cacheThumbnail(entry->thumbPath, thSurf);
+			} else {
+				cacheThumbnail(entry->thumbPath, nullptr);
 			}
+			continue;
+		}
 
-			if (surf) {
-				const Graphics::ManagedSurface *scSurf(scaleGfx(surf, thumbnailWidth, thumbnailHeight, true));
-				_loadedSurfaces[entry->thumbPath] = scSurf;
+		_pendingSurfaces[entry->thumbPath] = true;
+		_thumbnailLoader->requestThumbnail(entry->thumbPath, fallbackPath, thumbnailWidth, thumbnailHeight);
+	}
 
-				if (path != entry->thumbPath) {
-					// TODO: Use SharedPtr instead of duplicating the surface
-					Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
-					thSurf->copyFrom(*scSurf);
-					_loadedSurfaces[path] = thSurf;
-				}
+	trimThumbnailCache();
+}
 
-				if (surf != scSurf) {
-					surf->free();
-					delete surf;
-				}
-			}
+void GridWidget::cacheThumbnail(const Common::String &path, const Graphics::ManagedSurface *surface) {
+	// A nullptr surface is cached too: it records that the icon is known
+	// to be missing, so it is not searched for again on every scroll.
+	_loadedSurfaces[path] = surface;
+	_thumbnailLRU.push_back(path);
+}
+
+void GridWidget::touchThumbnail(const Common::String &path) {
+	for (Common::List<Common::String>::iterator i = _thumbnailLRU.begin(); i != _thumbnailLRU.end(); ++i) {
+		if (*i == path) {
+			_thumbnailLRU.erase(i);
+			break;
+		}
+	}
+	_thumbnailLRU.push_back(path);
+}
+
+void GridWidget::trimThumbnailCache() {
+	if (_loadedSurfaces.size() <= kMaxCachedThumbnails)
+		return;
+
+	// Entries still on screen must survive no matter how old they are.
+	Common::HashMap<Common::String, bool> visiblePaths;
+	for (uint i = 0; i < _visibleEntryList.size(); ++i)
+		visiblePaths[_visibleEntryList[i]->thumbPath] = true;
+
+	Common::List<Common::String>::iterator i = _thumbnailLRU.begin();
+	while (i != _thumbnailLRU.end() && _loadedSurfaces.size() > kMaxCachedThumbnails) {
+		if (visiblePaths.contains(*i)) {
+			++i;
+			continue;
+		}
+		if (_loadedSurfaces.contains(*i)) {
+			delete _loadedSurfaces[*i];
+			_loadedSurfaces.erase(*i);
 		}
+		i = _thumbnailLRU.erase(i);
+	}
+}
+
+void GridWidget::handleTickle() {
+	Common::Array<GridThumbnailLoader::Result> results;
+	if (!_thumbnailLoader->pollResults(results))
+		return;
+
+	const int thumbnailWidth = MAX(_thumbnailWidth - 2 * _thumbnailMargin, 0);
+	const int thumbnailHeight = MAX(_thumbnailHeight - 2 * _thumbnailMargin, 0);
+	bool anyLoaded = false;
+
+	for (uint i = 0; i < results.size(); ++i) {
+		const GridThumbnailLoader::Result &result = results[i];
+		_pendingSurfaces.erase(result.path);
+
+		// A reflow may have changed the thumbnail size while this result
+		// was in flight; it was scaled for the old size, so discard it.
+		if (result.reqWidth != thumbnailWidth || result.reqHeight != thumbnailHeight) {
+			delete result.surface;
+			continue;
+		}
+
+		// Duplicate delivery: the request was re-queued while the first
+		// one was already being decoded.
+		if (_loadedSurfaces.contains(result.path)) {
+			delete result.surface;
+			continue;
+		}
+
+		cacheThumbnail(result.path, result.surface);
+
+		// Keep the shared per-engine icon around so games without an
+		// individual thumbnail do not decode it again.
+		if (result.surface && result.loadedPath != result.path && !_loadedSurfaces.contains(result.loadedPath)) {
+			// TODO: Use SharedPtr instead of duplicating the surface
+			Graphics::ManagedSurface *thSurf = new Graphics::ManagedSurface();
+			thSurf->copyFrom(*result.surface);
+			cacheThumbnail(result.loadedPath, thSurf);
+		}
+
+		if (result.surface)
+			anyLoaded = true;
+	}
+
+	if (anyLoaded) {
+		trimThumbnailCache();
+		updateGrid();
+		markAsDirty();
 	}
 }
 
@@ -1073,6 +1361,12 @@ void GridWidget::reflowLayout() {
 		unloadSurfaces(_platformIcons);
 		unloadSurfaces(_languageIcons);
 		unloadSurfaces(_loadedSurfaces);
+		_thumbnailLRU.clear();
+		// Queued requests would deliver surfaces scaled for the old size;
+		// handleTickle() also rejects any that are already in flight.
+		Common::Array<Common::String> dropped;
+		_thumbnailLoader->dropPendingRequests(dropped);
+		_pendingSurfaces.clear();
 		_platformIconsAlpha.clear();
 		_languageIconsAlpha.clear();
 		_extraIconsAlpha.clear();
@@ -24,6 +24,7 @@
 
 #include "gui/dialog.h"
 #include "gui/widgets/scrollbar.h"
+#include "common/list.h"
 #include "common/str.h"
 
 #include "image/bmp.h"
@@ -75,6 +76,54 @@ struct GridItemInfo {
 	}
 };
 
+/* GridThumbnailLoader */
+
+/**
+ * Decodes and rescales grid thumbnails on a background thread.
+ *
+ * Decoding a PNG and rescaling it takes ~10ms per tile, which is far too
+ * much to do synchronously in a scroll handler once a library holds a few
+ * thousand entries. The grid queues a request per visible tile, keeps
+ * drawing the title placeholder, and picks up finished surfaces from
+ * pollResults() on the GUI thread.
+ *
+ * On platforms without thread support requests are served synchronously
+ * on the calling thread, so the grid needs no separate fallback path.
+ */
+class GridThumbnailLoader {
+public:
+	/** A finished request, ready to be moved into the grid's surface cache. */
+	struct Result {
+		Common::String path;			///< path the grid asked for
+		Common::String loadedPath;		///< path actually decoded (may be the fallback)
+		const Graphics::ManagedSurface *surface;	///< scaled surface, nullptr if nothing was found
+		int reqWidth, reqHeight;		///< target size the surface was scaled for
+	};
+
+	GridThumbnailLoader();
+	~GridThumbnailLoader();
+
+	/**
+	 * Queue a decode of path, trying fallbackPath if it is missing, scaled
+	 * to fit width x height. Completion is reported through pollResults().
+	 */
+	void requestThumbnail(const Common::String &path, const Common::String &fallbackPath, int width, int height);
+
+	/** Move all finished requests into results. Returns true if there were any. */
+	bool pollResults(Common::Array<Result> &results);
+
+	/**
+	 * Drop every queued request the loader has not started on yet and
+	 * return their paths. A request already being decoded still delivers
+	 * its result.
+	 */
+	void dropPendingRequests(Common::Array<Common::String> &droppedPaths);
+
+private:
+	struct LoaderImpl;
+	LoaderImpl *_impl;
+};
+
 /* GridItemTray */
 class GridItemTray: public Dialog, public CommandSender {
 	int				_entryID;
@@ -108,6 +157,14 @@ protected:
 	Graphics::ManagedSurface *_disabledIconOverlay;
 	// Images are mapped by filename -> surface.
 	Common::HashMap<Common::String, const Graphics::ManagedSurface *> _loadedSurfaces;
+	// Keys of _loadedSurfaces in least-recently-used order (oldest first),
+	// so the cache can be trimmed once it outgrows kMaxCachedThumbnails.
+	Common::List<Common::String> _thumbnailLRU;
+	// Paths queued on the loader but not delivered yet, so a path is never
+	// requested twice.
+	Common::HashMap<Common::String, bool> _pendingSurfaces;
+
+	GridThumbnailLoader *_thumbnailLoader;
 
 	Common::Array<GridItemInfo>			_dataEntryList;
 	Common::Array<GridItemInfo>			_headerEntryList;
@@ -198,6 +255,9 @@ public:
 	void saveClosedGroups(const Common::U32String &groupName);
 
 	void reloadThumbnails();
+	void cacheThumbnail(const Common::String &path, const Graphics::ManagedSurface *surface);
+	void touchThumbnail(const Common::String &path);
+	void trimThumbnailCache();
 	void loadFlagIcons();
 	void loadPlatformIcons();
 	void loadExtraIcons();
@@ -219,6 +279,7 @@ public:
 
 	void handleMouseWheel(int x, int y, int direction) override;
 	void handleCommand(CommandSender *sender, uint32 cmd, uint32 data) override;
+	void handleTickle() override;
 	void reflowLayout() override;
 
 	bool wantsFocus() override { return true; }
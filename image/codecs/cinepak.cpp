@@ -63,11 +63,12 @@ inline uint16 createDitherTableIndex(const byte *clipTable, byte y, int8 u, int8
 struct CodebookConverterRGB {
 	template<typename PixelInt>
 	static inline void decodeBlock1(byte codebookIndex, const CinepakStrip &strip, PixelInt *dst, size_t dstPitch, const byte *clipTable, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook = strip.v1_codebook[codebookIndex];
-		const int8 u = codebook.u, v = codebook.v;
+		// The four colors of every codebook entry were converted when the
+		// codebook was loaded, so expanding a block is just stores.
+		const uint32 *rgb = strip.v1_rgb + codebookIndex * 4;
 
-		const PixelInt rgb0 = convertYUVToColor(clipTable, format, codebook.y[0], u, v);
-		const PixelInt rgb1 = convertYUVToColor(clipTable, format, codebook.y[1], u, v);
+		const PixelInt rgb0 = (PixelInt)rgb[0];
+		const PixelInt rgb1 = (PixelInt)rgb[1];
 
 		dst[0] = dst[1] = rgb0;
 		dst[2] = dst[3] = rgb1;
@@ -77,8 +78,8 @@ struct CodebookConverterRGB {
 		dst[2] = dst[3] = rgb1;
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		const PixelInt rgb2 = convertYUVToColor(clipTable, format, codebook.y[2], u, v);
-		const PixelInt rgb3 = convertYUVToColor(clipTable, format, codebook.y[3], u, v);
+		const PixelInt rgb2 = (PixelInt)rgb[2];
+		const PixelInt rgb3 = (PixelInt)rgb[3];
 
 		dst[0] = dst[1] = rgb2;
 		dst[2] = dst[3] = rgb3;
@@ -91,34 +92,34 @@ struct CodebookConverterRGB {
 
 	template<typename PixelInt>
 	static inline void decodeBlock4(const byte (&codebookIndex)[4], const CinepakStrip &strip, PixelInt *dst, size_t dstPitch, const byte *clipTable, const Graphics::PixelFormat &format) {
-		const CinepakCodebook &codebook1 = strip.v4_codebook[codebookIndex[0]];
-		const CinepakCodebook &codebook2 = strip.v4_codebook[codebookIndex[1]];
+		const uint32 *rgb1 = strip.v4_rgb + codebookIndex[0] * 4;
+		const uint32 *rgb2 = strip.v4_rgb + codebookIndex[1] * 4;
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook1.y[0], codebook1.u, codebook1.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook1.y[1], codebook1.u, codebook1.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook2.y[0], codebook2.u, codebook2.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook2.y[1], codebook2.u, codebook2.v);
+		dst[0] = (PixelInt)rgb1[0];
+		dst[1] = (PixelInt)rgb1[1];
+		dst[2] = (PixelInt)rgb2[0];
+		dst[3] = (PixelInt)rgb2[1];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook1.y[2], codebook1.u, codebook1.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook1.y[3], codebook1.u, codebook1.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook2.y[2], codebook2.u, codebook2.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook2.y[3], codebook2.u, codebook2.v);
+		dst[0] = (PixelInt)rgb1[2];
+		dst[1] = (PixelInt)rgb1[3];
+		dst[2] = (PixelInt)rgb2[2];
+		dst[3] = (PixelInt)rgb2[3];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		const CinepakCodebook &codebook3 = strip.v4_codebook[codebookIndex[2]];
-		const CinepakCodebook &codebook4 = strip.v4_codebook[codebookIndex[3]];
+		const uint32 *rgb3 = strip.v4_rgb + codebookIndex[2] * 4;
+		const uint32 *rgb4 = strip.v4_rgb + codebookIndex[3] * 4;
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook3.y[0], codebook3.u, codebook3.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook3.y[1], codebook3.u, codebook3.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook4.y[0], codebook4.u, codebook4.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook4.y[1], codebook4.u, codebook4.v);
+		dst[0] = (PixelInt)rgb3[0];
+		dst[1] = (PixelInt)rgb3[1];
+		dst[2] = (PixelInt)rgb4[0];
+		dst[3] = (PixelInt)rgb4[1];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 
-		dst[0] = convertYUVToColor(clipTable, format, codebook3.y[2], codebook3.u, codebook3.v);
-		dst[1] = convertYUVToColor(clipTable, format, codebook3.y[3], codebook3.u, codebook3.v);
-		dst[2] = convertYUVToColor(clipTable, format, codebook4.y[2], codebook4.u, codebook4.v);
-		dst[3] = convertYUVToColor(clipTable, format, codebook4.y[3], codebook4.u, codebook4.v);
+		dst[0] = (PixelInt)rgb3[2];
+		dst[1] = (PixelInt)rgb3[3];
+		dst[2] = (PixelInt)rgb4[2];
+		dst[3] = (PixelInt)rgb4[3];
 		dst = (PixelInt *)((uint8 *)dst + dstPitch);
 	}
 };
@@ -362,7 +363,9 @@ const Graphics::Surface *CinepakDecoder::decodeFrame(Common::SeekableReadStream
 				_curFrame.strips[i].v4_codebook[j] = _curFrame.strips[i - 1].v4_codebook[j];
 			}
 
-			// Copy the dither tables
+			// Copy the converted RGB codebooks and the dither tables
+			memcpy(_curFrame.strips[i].v1_rgb, _curFrame.strips[i - 1].v1_rgb, 256 * 4 * sizeof(uint32));
+			memcpy(_curFrame.strips[i].v4_rgb, _curFrame.strips[i - 1].v4_rgb, 256 * 4 * sizeof(uint32));
 			memcpy(_curFrame.strips[i].v1_dither, _curFrame.strips[i - 1].v1_dither, 256 * 4 * 4 * sizeof(uint32));
 			memcpy(_curFrame.strips[i].v4_dither, _curFrame.strips[i - 1].v4_dither, 256 * 4 * 4 * sizeof(uint32));
 		}
@@ -441,9 +444,27 @@ void CinepakDecoder::initializeCodebook(uint16 strip, byte codebookType) {
 			ditherCodebookQT(strip, codebookType, i);
 		else if (_ditherType == kDitherTypeVFW)
 			ditherCodebookVFW(strip, codebookType, i);
+		else if (_bitsPerPixel == 24)
+			convertCodebookToRGB(strip, codebookType, i);
 	}
 }
 
+void CinepakDecoder::convertCodebookToRGB(uint16 strip, byte codebookType, uint16 codebookIndex) {
+	const CinepakCodebook &codebook = (codebookType == 1) ?
+			_curFrame.strips[strip].v1_codebook[codebookIndex] :
+			_curFrame.strips[strip].v4_codebook[codebookIndex];
+	uint32 *output = ((codebookType == 1) ?
+			_curFrame.strips[strip].v1_rgb :
+			_curFrame.strips[strip].v4_rgb) + codebookIndex * 4;
+
+	// The surface carries the format actually used for decoding, but does
+	// not exist yet when the codebooks are first initialized.
+	const Graphics::PixelFormat &format = _curFrame.surface ? _curFrame.surface->format : _pixelFormat;
+
+	for (int i = 0; i < 4; i++)
+		output[i] = convertYUVToColor(_clipTable, format, codebook.y[i], codebook.u, codebook.v);
+}
+
 void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 strip, byte codebookType, byte chunkID, uint32 chunkSize) {
 	CinepakCodebook *codebook = (codebookType == 1) ? _curFrame.strips[strip].v1_codebook : _curFrame.strips[strip].v4_codebook;
 
@@ -477,11 +498,14 @@ void CinepakDecoder::loadCodebook(Common::SeekableReadStream &stream, uint16 str
 				codebook[i].v = 0;
 			}
 
-			// Dither the codebook if we're dithering for QuickTime
+			// Dither the codebook if we're dithering for QuickTime,
+			// otherwise convert the entry for RGB output right away
 			if (_ditherType == kDitherTypeQT)
 				ditherCodebookQT(strip, codebookType, i);
 			else if (_ditherType == kDitherTypeVFW)
 				ditherCodebookVFW(strip, codebookType, i);
+			else if (_bitsPerPixel == 24)
+				convertCodebookToRGB(strip, codebookType, i);
 		}
 	}
 }
@@ -46,6 +46,10 @@ struct CinepakStrip {
 	uint16 length;
 	Common::Rect rect;
 	CinepakCodebook v1_codebook[256], v4_codebook[256];
+	// Codebook entries converted to the output pixel format when they are
+	// loaded, four pixels per entry. Only maintained for RGB output; the
+	// dither tables below are the 8bpp equivalent.
+	uint32 v1_rgb[256 * 4], v4_rgb[256 * 4];
 	uint32 v1_dither[256 * 4 * 4], v4_dither[256 * 4 * 4];
 };
 
@@ -97,6 +101,7 @@ private:
 
 	void initializeCodebook(uint16 strip, byte codebookType);
 	void loadCodebook(Common::SeekableReadStream &stream, uint16 strip, byte codebookType, byte chunkID, uint32 chunkSize);
+	void convertCodebookToRGB(uint16 strip, byte codebookType, uint16 codebookIndex);
 	void decodeVectors8(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize);
 	void decodeVectors24(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize);
 
@@ -529,7 +529,7 @@ void IndeoDSP::ffIviPutDcPixel8x8(const int32 *in, int16 *out, uint32 pitch,
 		memset(out, 0, 8 * sizeof(out[0]));
 }
 
-#define IVI_MC_TEMPLATE(size, suffix, OP) \
+#define IVI_MC_TEMPLATE(size, suffix, OP, FULLPEL_ROW) \
 static void iviMc ## size ##x## size ## suffix(int16 *buf, \
 												 uint32 dpitch, \
 												 const int16 *refBuf, \
@@ -540,9 +540,7 @@ static void iviMc ## size ##x## size ## suffix(int16 *buf, \
 	switch (mcType) { \
 	case 0: /* fullpel (no interpolation) */ \
 		for (int i = 0; i < size; i++, buf += dpitch, refBuf += pitch) { \
-			for (int j = 0; j < size; j++) {\
-				OP(buf[j], refBuf[j]); \
-			} \
+			FULLPEL_ROW(buf, refBuf, size); \
 		} \
 		break; \
 	case 1: /* horizontal halfpel interpolation */ \
@@ -594,10 +592,17 @@ void IndeoDSP::ffIviMcAvg ## size ##x## size ## suffix(int16 *buf, \
 #define OP_PUT(a, b)  (a) = (b)
 #define OP_ADD(a, b)  (a) += (b)
 
-IVI_MC_TEMPLATE(8, NoDelta, OP_PUT)
-IVI_MC_TEMPLATE(8, Delta,   OP_ADD)
-IVI_MC_TEMPLATE(4, NoDelta, OP_PUT)
-IVI_MC_TEMPLATE(4, Delta,   OP_ADD)
+// Fullpel motion compensation without a delta is a plain row copy, so
+// hand those rows to memcpy instead of moving the pixels one by one.
+#define FULLPEL_ROW_PUT(dst, src, n) memcpy(dst, src, (n) * sizeof(int16))
+#define FULLPEL_ROW_ADD(dst, src, n) \
+	for (int j = 0; j < (n); j++) \
+		OP_ADD((dst)[j], (src)[j])
+
+IVI_MC_TEMPLATE(8, NoDelta, OP_PUT, FULLPEL_ROW_PUT)
+IVI_MC_TEMPLATE(8, Delta,   OP_ADD, FULLPEL_ROW_ADD)
+IVI_MC_TEMPLATE(4, NoDelta, OP_PUT, FULLPEL_ROW_PUT)
+IVI_MC_TEMPLATE(4, Delta,   OP_ADD, FULLPEL_ROW_ADD)
 IVI_MC_AVG_TEMPLATE(8, NoDelta, OP_PUT)
 IVI_MC_AVG_TEMPLATE(8, Delta,   OP_ADD)
 IVI_MC_AVG_TEMPLATE(4, NoDelta, OP_PUT)
@@ -45,7 +45,8 @@ PNGDecoder::PNGDecoder() :
 		_skipSignature(false),
 		_keepTransparencyPaletted(false),
 		_hasTransparentColor(false),
-		_transparentColor(0) {
+		_transparentColor(0),
+		_requestedFormat() {
 }
 
 PNGDecoder::~PNGDecoder() {
@@ -62,6 +63,19 @@ void PNGDecoder::destroy() {
 	_hasTransparentColor = false;
 }
 
+bool PNGDecoder::setOutputPixelFormat(const Graphics::PixelFormat &format) {
+	// libpng can reorder the color bytes and synthesize an opaque alpha
+	// byte on the fly, which covers exactly the four 8888 byte orders.
+	if (format != Graphics::PixelFormat::createFormatRGBA32() &&
+	    format != Graphics::PixelFormat::createFormatBGRA32() &&
+	    format != Graphics::PixelFormat::createFormatARGB32() &&
+	    format != Graphics::PixelFormat::createFormatABGR32())
+		return false;
+
+	_requestedFormat = format;
+	return true;
+}
+
 Graphics::PixelFormat PNGDecoder::getByteOrderRgbaPixelFormat(bool isAlpha) const {
 	if (isAlpha)
 		return Graphics::PixelFormat::createFormatRGBA32();
@@ -198,7 +212,8 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 		}
 
 		_outputSurface->create(width, height,
-			hasRgbaPalette ? getByteOrderRgbaPixelFormat(true) : Graphics::PixelFormat::createFormatCLUT8());
+			hasRgbaPalette ? (_requestedFormat.bytesPerPixel == 4 ? _requestedFormat : getByteOrderRgbaPixelFormat(true))
+			               : Graphics::PixelFormat::createFormatCLUT8());
 		png_set_packing(pngPtr);
 
 		if (hasRgbaPalette) {
@@ -220,7 +235,25 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			png_set_expand(pngPtr);
 		}
 
-		_outputSurface->create(width, height, getByteOrderRgbaPixelFormat(isAlpha));
+		Graphics::PixelFormat outFormat = getByteOrderRgbaPixelFormat(isAlpha);
+		if (_requestedFormat.bytesPerPixel == 4) {
+			// Let libpng produce the requested byte order directly.
+			outFormat = _requestedFormat;
+			const bool bgr = (_requestedFormat == Graphics::PixelFormat::createFormatBGRA32()) ||
+			                 (_requestedFormat == Graphics::PixelFormat::createFormatABGR32());
+			const bool alphaFirst = (_requestedFormat == Graphics::PixelFormat::createFormatARGB32()) ||
+			                        (_requestedFormat == Graphics::PixelFormat::createFormatABGR32());
+			if (bgr)
+				png_set_bgr(pngPtr);
+			if (isAlpha) {
+				if (alphaFirst)
+					png_set_swap_alpha(pngPtr);
+			} else {
+				png_set_filler(pngPtr, 0xff, alphaFirst ? PNG_FILLER_BEFORE : PNG_FILLER_AFTER);
+			}
+		}
+
+		_outputSurface->create(width, height, outFormat);
 		if (!_outputSurface->getPixels()) {
 			error("Could not allocate memory for output image.");
 		}
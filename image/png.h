@@ -67,11 +67,25 @@ public:
 	uint32 getTransparentColor() const override { return _transparentColor; }
 	void setSkipSignature(bool skip) { _skipSignature = skip; }
 	void setKeepTransparencyPaletted(bool keep) { _keepTransparencyPaletted = keep; }
+
+	/**
+	 * Request decoding directly into the given pixel format, so callers do
+	 * not need a separate convert pass over the finished image. Only the
+	 * four 32-bit 8888 byte orders can be produced by libpng's transform
+	 * pipeline; for anything else this returns false and the decoder keeps
+	 * its default output format. Paletted images stay CLUT8 regardless.
+	 *
+	 * Call before loadStream().
+	 */
+	bool setOutputPixelFormat(const Graphics::PixelFormat &format);
 private:
 	Graphics::PixelFormat getByteOrderRgbaPixelFormat(bool isAlpha) const;
 
 	Graphics::Palette _palette;
 
+	// Requested output format; zero bytesPerPixel when unset
+	Graphics::PixelFormat _requestedFormat;
+
 	// flag to skip the png signature check for headless png files
 	bool _skipSignature;
 
@@ -0,0 +1,118 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "math/fft.h"
+#include "math/utils.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Math {
+
+// Negate the imaginary (odd) or real (even) lane of each re/im pair.
+static inline float32x4_t flipOdd(float32x4_t x) {
+	const uint32x4_t mask = vreinterpretq_u32_u64(vdupq_n_u64(0x8000000000000000ULL));
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(x), mask));
+}
+
+static inline float32x4_t flipEven(float32x4_t x) {
+	const uint32x4_t mask = vreinterpretq_u32_u64(vdupq_n_u64(0x0000000080000000ULL));
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(x), mask));
+}
+
+/**
+ * One radix-4 butterfly over two adjacent complex values in each of the
+ * four sub-blocks. wr and wi hold the two twiddle factors splatted per
+ * pair. Performs the same arithmetic as the scalar TRANSFORM macro in
+ * fft.cpp; all inputs are loaded before anything is stored, like the
+ * BUTTERFLIES_BIG variant, so the kernel is also safe for the large
+ * power-of-two strides that alias in the store queue.
+ */
+static inline void passPair(float *z0, float *z1, float *z2, float *z3, float32x4_t wr, float32x4_t wi) {
+	const float32x4_t a0 = vld1q_f32(z0);
+	const float32x4_t a1 = vld1q_f32(z1);
+	const float32x4_t a2 = vld1q_f32(z2);
+	const float32x4_t a3 = vld1q_f32(z3);
+
+	// {re, im} -> {im, re}
+	const float32x4_t a2s = vrev64q_f32(a2);
+	const float32x4_t a3s = vrev64q_f32(a3);
+
+	// t12 = {t1, t2} = a2 rotated by -w, t56 = {t5, t6} = a3 rotated by w
+	const float32x4_t t12 = vaddq_f32(vmulq_f32(a2, wr), flipOdd(vmulq_f32(a2s, wi)));
+	const float32x4_t t56 = vaddq_f32(vmulq_f32(a3, wr), flipEven(vmulq_f32(a3s, wi)));
+
+	// {t5 + t1, t2 + t6} and {t2 - t6, t5 - t1} of the BUTTERFLIES macro
+	const float32x4_t sum = vaddq_f32(t12, t56);
+	const float32x4_t diff = flipOdd(vrev64q_f32(vsubq_f32(t12, t56)));
+
+	vst1q_f32(z0, vaddq_f32(a0, sum));
+	vst1q_f32(z2, vsubq_f32(a0, sum));
+	vst1q_f32(z1, vaddq_f32(a1, diff));
+	vst1q_f32(z3, vsubq_f32(a1, diff));
+}
+
+void fftPassNEON(Complex *z, const float *wre, unsigned int n) {
+	const float *wim = wre + 2 * n;
+	float *p0 = (float *)z;
+	float *p1 = p0 + 4 * n;
+	float *p2 = p0 + 8 * n;
+	float *p3 = p0 + 12 * n;
+
+	// The k = 0 twiddle is exactly (1, 0)
+	passPair(p0, p1, p2, p3,
+	         vcombine_f32(vdup_n_f32(1.0f), vdup_n_f32(wre[1])),
+	         vcombine_f32(vdup_n_f32(0.0f), vdup_n_f32(wim[-1])));
+
+	for (unsigned int k = 2; k < 2 * n; k += 2) {
+		const float32x4_t wr = vcombine_f32(vdup_n_f32(wre[k]), vdup_n_f32(wre[k + 1]));
+		const float32x4_t wi = vcombine_f32(vdup_n_f32(wim[-(int)k]), vdup_n_f32(wim[-(int)k - 1]));
+		passPair(p0 + 2 * k, p1 + 2 * k, p2 + 2 * k, p3 + 2 * k, wr, wi);
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
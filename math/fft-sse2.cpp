@@ -0,0 +1,117 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include "math/fft.h"
+#include "math/utils.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Math {
+
+// Negate the imaginary (odd) or real (even) lane of each re/im pair.
+static inline __m128 flipOdd(__m128 x) {
+	return _mm_xor_ps(x, _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0x80000000, 0)));
+}
+
+static inline __m128 flipEven(__m128 x) {
+	return _mm_xor_ps(x, _mm_castsi128_ps(_mm_set_epi32(0, 0x80000000, 0, 0x80000000)));
+}
+
+/**
+ * One radix-4 butterfly over two adjacent complex values in each of the
+ * four sub-blocks. wr and wi hold the two twiddle factors splatted per
+ * pair. Performs the same arithmetic as the scalar TRANSFORM macro in
+ * fft.cpp; all inputs are loaded before anything is stored, like the
+ * BUTTERFLIES_BIG variant, so the kernel is also safe for the large
+ * power-of-two strides that alias in the store queue.
+ */
+static inline void passPair(float *z0, float *z1, float *z2, float *z3, __m128 wr, __m128 wi) {
+	const __m128 a0 = _mm_loadu_ps(z0);
+	const __m128 a1 = _mm_loadu_ps(z1);
+	const __m128 a2 = _mm_loadu_ps(z2);
+	const __m128 a3 = _mm_loadu_ps(z3);
+
+	// {re, im} -> {im, re}
+	const __m128 a2s = _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 3, 0, 1));
+	const __m128 a3s = _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(2, 3, 0, 1));
+
+	// t12 = {t1, t2} = a2 rotated by -w, t56 = {t5, t6} = a3 rotated by w
+	const __m128 t12 = _mm_add_ps(_mm_mul_ps(a2, wr), flipOdd(_mm_mul_ps(a2s, wi)));
+	const __m128 t56 = _mm_add_ps(_mm_mul_ps(a3, wr), flipEven(_mm_mul_ps(a3s, wi)));
+
+	// {t5 + t1, t2 + t6} and {t2 - t6, t5 - t1} of the BUTTERFLIES macro
+	const __m128 sum = _mm_add_ps(t12, t56);
+	const __m128 d = _mm_sub_ps(t12, t56);
+	const __m128 diff = flipOdd(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	_mm_storeu_ps(z0, _mm_add_ps(a0, sum));
+	_mm_storeu_ps(z2, _mm_sub_ps(a0, sum));
+	_mm_storeu_ps(z1, _mm_add_ps(a1, diff));
+	_mm_storeu_ps(z3, _mm_sub_ps(a1, diff));
+}
+
+void fftPassSSE2(Complex *z, const float *wre, unsigned int n) {
+	const float *wim = wre + 2 * n;
+	float *p0 = (float *)z;
+	float *p1 = p0 + 4 * n;
+	float *p2 = p0 + 8 * n;
+	float *p3 = p0 + 12 * n;
+
+	// The k = 0 twiddle is exactly (1, 0)
+	passPair(p0, p1, p2, p3,
+	         _mm_set_ps(wre[1], wre[1], 1.0f, 1.0f),
+	         _mm_set_ps(wim[-1], wim[-1], 0.0f, 0.0f));
+
+	for (unsigned int k = 2; k < 2 * n; k += 2) {
+		const __m128 wr = _mm_set_ps(wre[k + 1], wre[k + 1], wre[k], wre[k]);
+		const __m128 wi = _mm_set_ps(wim[-(int)k - 1], wim[-(int)k - 1], wim[-(int)k], wim[-(int)k]);
+		passPair(p0 + 2 * k, p1 + 2 * k, p2 + 2 * k, p3 + 2 * k, wr, wi);
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // SCUMMVM_SSE2
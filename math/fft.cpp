@@ -28,6 +28,7 @@
 #include "math/fft.h"
 #include "math/cosinetables.h"
 #include "math/utils.h"
+#include "common/system.h"
 #include "common/util.h"
 
 namespace Math {
@@ -44,6 +45,16 @@ FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 
 	_splitRadix = 1;
 
+	_passFunc = nullptr;
+#ifdef SCUMMVM_NEON
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		_passFunc = fftPassNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		_passFunc = fftPassSSE2;
+#endif
+
 	for (int i = 0; i < n; i++)
 		_revTab[-splitRadixPermutation(i, n, _inverse) & (n - 1)] = i;
 
@@ -244,7 +255,9 @@ void FFT::fft(int n, int logn, Complex *z) {
 		fft((n / 4), logn - 2, z + (n / 4) * 2);
 		fft((n / 4), logn - 2, z + (n / 4) * 3);
 		assert(_cosTables[logn - 4]);
-		if (n > 1024)
+		if (_passFunc)
+			_passFunc(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+		else if (n > 1024)
 			pass_big(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
 		else
 			pass(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
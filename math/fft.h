@@ -82,12 +82,32 @@ private:
 
 	CosineTable *_cosTables[13];
 
+	/**
+	 * Split-radix combination pass over the recursion's sub-transforms,
+	 * the hot loop of calc(). Points to one of the SIMD kernels below
+	 * when the CPU supports it, or is null for the scalar code in
+	 * fft.cpp. Selected once, in the constructor, from the CPU features
+	 * the backend reports - the same scheme the Bink and rate converter
+	 * kernels use.
+	 */
+	void (*_passFunc)(Complex *z, const float *wre, unsigned int n);
+
 	void fft4(Complex *z);
 	void fft8(Complex *z);
 	void fft16(Complex *z);
 	void fft(int n, int logn, Complex *z);
 };
 
+#ifdef SCUMMVM_SSE2
+// SSE2 split-radix combination pass, see math/fft-sse2.cpp
+void fftPassSSE2(Complex *z, const float *wre, unsigned int n);
+#endif
+
+#ifdef SCUMMVM_NEON
+// NEON split-radix combination pass, see math/fft-neon.cpp
+void fftPassNEON(Complex *z, const float *wre, unsigned int n);
+#endif
+
 /** @} */
 
 } // End of namespace Math
@@ -0,0 +1,138 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "math/rdft.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Math {
+
+// Swap the two complex pairs of a vector.
+static inline float32x4_t swapPairs(float32x4_t x) {
+	return vextq_f32(x, x, 2);
+}
+
+// Negate the imaginary (odd) or real (even) lane of each re/im pair.
+static inline float32x4_t flipOdd(float32x4_t x) {
+	const uint32x4_t mask = { 0, 0x80000000, 0, 0x80000000 };
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(x), mask));
+}
+
+static inline float32x4_t flipEven(float32x4_t x) {
+	const uint32x4_t mask = { 0x80000000, 0, 0x80000000, 0 };
+	return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(x), mask));
+}
+
+// Even lanes from 'even', odd lanes from 'odd'.
+static inline float32x4_t blendEvenOdd(float32x4_t even, float32x4_t odd) {
+	const uint32x4_t oddMask = { 0, 0xFFFFFFFF, 0, 0xFFFFFFFF };
+	return vbslq_f32(oddMask, odd, even);
+}
+
+/**
+ * The even/odd separation and twiddle loop of RDFT::calc(), the NEON
+ * counterpart of rdftEvenOddSSE2() with the same lane arithmetic: two
+ * complex values per vector, the mirrored load with its pair order
+ * swapped so the lanes line up, and plain mul/add so the rounding
+ * matches the scalar loop.
+ */
+void rdftEvenOddNEON(float *data, const float *tCos, const float *tSin,
+                     int n, float k1, float k2) {
+	const float32x4_t vk1 = vdupq_n_f32(k1);
+	const float32x4_t vk2 = vdupq_n_f32(k2);
+
+	int i = 1;
+	for (; i + 1 < (n >> 2); i += 2) {
+		const int i1 = 2 * i;
+		const int i2 = n - i1;
+
+		const float32x4_t f = vld1q_f32(data + i1);
+		const float32x4_t b = swapPairs(vld1q_f32(data + i2 - 2));
+
+		const float32x4_t sum = vaddq_f32(f, b);
+		const float32x4_t dif = vsubq_f32(f, b);
+
+		// ev = (k1 * sum.re, k1 * dif.im), od = (k2 * sum.im, -k2 * dif.re)
+		const float32x4_t ev = vmulq_f32(vk1, blendEvenOdd(sum, dif));
+		const float32x4_t od = blendEvenOdd(vmulq_f32(vk2, vrev64q_f32(sum)),
+		                                    flipOdd(vmulq_f32(vk2, vrev64q_f32(dif))));
+
+		const float32x2_t cs2 = vld1_f32(tCos + i);
+		const float32x2_t ss2 = vld1_f32(tSin + i);
+		const float32x4_t c = vcombine_f32(vdup_lane_f32(cs2, 0), vdup_lane_f32(cs2, 1));
+		const float32x4_t s = vcombine_f32(vdup_lane_f32(ss2, 0), vdup_lane_f32(ss2, 1));
+
+		const float32x4_t odc = vmulq_f32(od, c);
+		const float32x4_t odsSwap = vrev64q_f32(vmulq_f32(od, s));
+
+		// out1 = (ev.re + od.re*c - od.im*s, ev.im + od.im*c + od.re*s)
+		const float32x4_t out1 = vaddq_f32(vaddq_f32(ev, odc), flipEven(odsSwap));
+		// out2 = (ev.re - od.re*c + od.im*s, -ev.im + od.im*c + od.re*s)
+		const float32x4_t out2 = vaddq_f32(vaddq_f32(flipOdd(ev), flipEven(odc)), odsSwap);
+
+		vst1q_f32(data + i1, out1);
+		vst1q_f32(data + i2 - 2, swapPairs(out2));
+	}
+
+	for (; i < (n >> 2); i++) {
+		const int i1 = 2 * i;
+		const int i2 = n - i1;
+
+		const float evre =  k1 * (data[i1    ] + data[i2   ]);
+		const float odim = -k2 * (data[i1    ] - data[i2   ]);
+		const float evim =  k1 * (data[i1 + 1] - data[i2 + 1]);
+		const float odre =  k2 * (data[i1 + 1] + data[i2 + 1]);
+
+		data[i1    ] =  evre + odre * tCos[i] - odim * tSin[i];
+		data[i1 + 1] =  evim + odim * tCos[i] + odre * tSin[i];
+		data[i2    ] =  evre - odre * tCos[i] + odim * tSin[i];
+		data[i2 + 1] = -evim + odim * tCos[i] + odre * tSin[i];
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,138 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include "math/rdft.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Math {
+
+// Swap the re/im lanes of each complex pair.
+static inline __m128 swapReIm(__m128 x) {
+	return _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+// Negate the imaginary (odd) or real (even) lane of each re/im pair.
+static inline __m128 flipOdd(__m128 x) {
+	return _mm_xor_ps(x, _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0x80000000, 0)));
+}
+
+static inline __m128 flipEven(__m128 x) {
+	return _mm_xor_ps(x, _mm_castsi128_ps(_mm_set_epi32(0, 0x80000000, 0, 0x80000000)));
+}
+
+// Even lanes from 'even', odd lanes from 'odd'.
+static inline __m128 blendEvenOdd(__m128 even, __m128 odd) {
+	const __m128 oddMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, -1, 0));
+	return _mm_or_ps(_mm_andnot_ps(oddMask, even), _mm_and_ps(oddMask, odd));
+}
+
+/**
+ * The even/odd separation and twiddle loop of RDFT::calc() over
+ * i = 1 .. n/4 - 1, two complex values per vector: one load runs forward
+ * from data[2i], its mirror runs backward from data[n - 2i], and the pair
+ * order of the mirrored vector is swapped so the lanes line up. The
+ * forward stores stay below the middle of the buffer and the mirrored
+ * ones above it, so iterations are independent. Same arithmetic, in the
+ * same order, as the scalar loop in rdft.cpp.
+ */
+void rdftEvenOddSSE2(float *data, const float *tCos, const float *tSin,
+                     int n, float k1, float k2) {
+	const __m128 vk1 = _mm_set1_ps(k1);
+	const __m128 vk2 = _mm_set1_ps(k2);
+
+	int i = 1;
+	for (; i + 1 < (n >> 2); i += 2) {
+		const int i1 = 2 * i;
+		const int i2 = n - i1;
+
+		const __m128 f = _mm_loadu_ps(data + i1);
+		__m128 b = _mm_loadu_ps(data + i2 - 2);
+		b = _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2));
+
+		const __m128 sum = _mm_add_ps(f, b);
+		const __m128 dif = _mm_sub_ps(f, b);
+
+		// ev = (k1 * sum.re, k1 * dif.im), od = (k2 * sum.im, -k2 * dif.re)
+		const __m128 ev = _mm_mul_ps(vk1, blendEvenOdd(sum, dif));
+		const __m128 od = blendEvenOdd(_mm_mul_ps(vk2, swapReIm(sum)),
+		                               flipOdd(_mm_mul_ps(vk2, swapReIm(dif))));
+
+		const __m128 c = _mm_setr_ps(tCos[i], tCos[i], tCos[i + 1], tCos[i + 1]);
+		const __m128 s = _mm_setr_ps(tSin[i], tSin[i], tSin[i + 1], tSin[i + 1]);
+
+		const __m128 odc = _mm_mul_ps(od, c);
+		const __m128 odsSwap = swapReIm(_mm_mul_ps(od, s));
+
+		// out1 = (ev.re + od.re*c - od.im*s, ev.im + od.im*c + od.re*s)
+		const __m128 out1 = _mm_add_ps(_mm_add_ps(ev, odc), flipEven(odsSwap));
+		// out2 = (ev.re - od.re*c + od.im*s, -ev.im + od.im*c + od.re*s)
+		__m128 out2 = _mm_add_ps(_mm_add_ps(flipOdd(ev), flipEven(odc)), odsSwap);
+
+		_mm_storeu_ps(data + i1, out1);
+		out2 = _mm_shuffle_ps(out2, out2, _MM_SHUFFLE(1, 0, 3, 2));
+		_mm_storeu_ps(data + i2 - 2, out2);
+	}
+
+	for (; i < (n >> 2); i++) {
+		const int i1 = 2 * i;
+		const int i2 = n - i1;
+
+		const float evre =  k1 * (data[i1    ] + data[i2   ]);
+		const float odim = -k2 * (data[i1    ] - data[i2   ]);
+		const float evim =  k1 * (data[i1 + 1] - data[i2 + 1]);
+		const float odre =  k2 * (data[i1 + 1] + data[i2 + 1]);
+
+		data[i1    ] =  evre + odre * tCos[i] - odim * tSin[i];
+		data[i1 + 1] =  evim + odim * tCos[i] + odre * tSin[i];
+		data[i2    ] =  evre - odre * tCos[i] + odim * tSin[i];
+		data[i2 + 1] = -evim + odim * tCos[i] + odre * tSin[i];
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // SCUMMVM_SSE2
@@ -27,6 +27,8 @@
 #include "math/fft.h"
 #include "math/utils.h"
 
+#include "common/system.h"
+
 namespace Math {
 
 RDFT::RDFT(int bits, TransformType trans) : _bits(bits), _sin(1 << bits), _cos(1 << bits), _fft(nullptr) {
@@ -37,6 +39,16 @@ RDFT::RDFT(int bits, TransformType trans) : _bits(bits), _sin(1 << bits), _cos(1
 
 	_fft = new FFT(bits - 1, trans == IDFT_C2R || trans == IDFT_R2C);
 
+	_evenOddFunc = nullptr;
+#ifdef SCUMMVM_NEON
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		_evenOddFunc = rdftEvenOddNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		_evenOddFunc = rdftEvenOddSSE2;
+#endif
+
 	int n = 1 << bits;
 
 	_tSin = _sin.getTable() + (trans == DFT_R2C || trans == DFT_C2R) * (n >> 2);
@@ -68,25 +80,28 @@ void RDFT::calc(float *data) {
 	data[0] = ev.re + data[1];
 	data[1] = ev.re - data[1];
 
-	int i;
-	for (i = 1; i < (n >> 2); i++) {
-		int i1 = 2 * i;
-		int i2 = n - i1;
-
-		/* Separate even and odd FFTs */
-		ev.re =  k1 * (data[i1    ] + data[i2   ]);
-		od.im = -k2 * (data[i1    ] - data[i2   ]);
-		ev.im =  k1 * (data[i1 + 1] - data[i2 + 1]);
-		od.re =  k2 * (data[i1 + 1] + data[i2 + 1]);
-
-		/* Apply twiddle factors to the odd FFT and add to the even FFT */
-		data[i1    ] =  ev.re + od.re * _tCos[i] - od.im * _tSin[i];
-		data[i1 + 1] =  ev.im + od.im * _tCos[i] + od.re * _tSin[i];
-		data[i2    ] =  ev.re - od.re * _tCos[i] + od.im * _tSin[i];
-		data[i2 + 1] = -ev.im + od.im * _tCos[i] + od.re * _tSin[i];
+	if (_evenOddFunc) {
+		_evenOddFunc(data, _tCos, _tSin, n, k1, k2);
+	} else {
+		for (int i = 1; i < (n >> 2); i++) {
+			int i1 = 2 * i;
+			int i2 = n - i1;
+
+			/* Separate even and odd FFTs */
+			ev.re =  k1 * (data[i1    ] + data[i2   ]);
+			od.im = -k2 * (data[i1    ] - data[i2   ]);
+			ev.im =  k1 * (data[i1 + 1] - data[i2 + 1]);
+			od.re =  k2 * (data[i1 + 1] + data[i2 + 1]);
+
+			/* Apply twiddle factors to the odd FFT and add to the even FFT */
+			data[i1    ] =  ev.re + od.re * _tCos[i] - od.im * _tSin[i];
+			data[i1 + 1] =  ev.im + od.im * _tCos[i] + od.re * _tSin[i];
+			data[i2    ] =  ev.re - od.re * _tCos[i] + od.im * _tSin[i];
+			data[i2 + 1] = -ev.im + od.im * _tCos[i] + od.re * _tSin[i];
+		}
 	}
 
-	data[2 * i + 1] = _signConvention * data[2 * i + 1];
+	data[(n >> 1) + 1] = _signConvention * data[(n >> 1) + 1];
 
 	if (_inverse) {
 		data[0] *= k1;
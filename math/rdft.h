@@ -111,8 +111,30 @@ private:
 	const float *_tCos;
 
 	FFT *_fft;
+
+	/**
+	 * The even/odd separation and twiddle loop of calc(), the only part
+	 * of the transform outside the FFT itself that scales with n. Points
+	 * to one of the SIMD kernels below when the CPU supports it, or is
+	 * null for the scalar loop in rdft.cpp. Selected once, in the
+	 * constructor, the same way the FFT combination pass is.
+	 */
+	void (*_evenOddFunc)(float *data, const float *tCos, const float *tSin,
+	                     int n, float k1, float k2);
 };
 
+#ifdef SCUMMVM_SSE2
+// SSE2 even/odd separation pass, see math/rdft-sse2.cpp
+void rdftEvenOddSSE2(float *data, const float *tCos, const float *tSin,
+                     int n, float k1, float k2);
+#endif
+
+#ifdef SCUMMVM_NEON
+// NEON even/odd separation pass, see math/rdft-neon.cpp
+void rdftEvenOddNEON(float *data, const float *tCos, const float *tSin,
+                     int n, float k1, float k2);
+#endif
+
 /** @} */
 
 } // End of namespace Math
@@ -0,0 +1,322 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Microbenchmarks for core kernels, built by `make bench`.
+ *
+ * Inputs are deterministic (fixed-seed LCG), buffer sizes are fixed, and
+ * each kernel reports the best of several timed runs, so numbers from the
+ * same machine are comparable across commits. Each run is auto-calibrated
+ * to last at least ~200 ms to get past timer granularity.
+ */
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+#include <stdio.h>
+
+#include "common/scummsys.h"
+#include "common/system.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/str.h"
+#include "graphics/blit.h"
+#include "graphics/pixelformat.h"
+#include "graphics/scalerplugin.h"
+#include "graphics/scaler/normal.h"
+#ifdef USE_SCALERS
+#include "graphics/scaler/sai.h"
+#include "graphics/scaler/scalebit.h"
+#include "graphics/scaler/tv.h"
+#endif
+#include "audio/audiostream.h"
+#include "audio/decoders/floatdsp.h"
+#include "audio/rate.h"
+
+#include "../null_osystem.h"
+
+namespace {
+
+// Deterministic pseudo-random bytes; independent of Common::RandomSource
+// so reseeding elsewhere can never change the corpus.
+struct Lcg {
+	uint32 state;
+	explicit Lcg(uint32 seed) : state(seed) {}
+	uint32 next() {
+		state = state * 1664525 + 1013904223;
+		return state;
+	}
+	void fill(byte *buf, uint32 len) {
+		for (uint32 i = 0; i < len; i += 4) {
+			uint32 v = next();
+			for (uint32 j = 0; j < 4 && i + j < len; j++)
+				buf[i + j] = (byte)(v >> (8 * j));
+		}
+	}
+};
+
+/**
+ * Time fn() and print its throughput. unitsPerIter is how much work one
+ * fn() call does, in the given unit (pixels, samples, operations).
+ */
+template<typename Fn>
+void runBench(const char *name, double unitsPerIter, const char *unit, Fn fn) {
+	const int kRuns = 5;
+	const uint32 kMinRunMs = 200;
+
+	// Calibrate the iteration count so a run outlasts timer granularity.
+	uint32 iters = 1;
+	for (;;) {
+		uint32 start = g_system->getMillis();
+		for (uint32 i = 0; i < iters; i++)
+			fn();
+		uint32 elapsed = g_system->getMillis() - start;
+		if (elapsed >= kMinRunMs)
+			break;
+		iters *= (elapsed * 8 < kMinRunMs) ? 8 : 2;
+	}
+
+	double bestMsPerIter = 0.0;
+	for (int run = 0; run < kRuns; run++) {
+		uint32 start = g_system->getMillis();
+		for (uint32 i = 0; i < iters; i++)
+			fn();
+		uint32 elapsed = g_system->getMillis() - start;
+		double msPerIter = (double)elapsed / iters;
+		if (run == 0 || msPerIter < bestMsPerIter)
+			bestMsPerIter = msPerIter;
+	}
+
+	double unitsPerSec = unitsPerIter * 1000.0 / bestMsPerIter;
+	printf("%-48s %9.2f M%s/s  (%u iters, best of %d)\n",
+	       name, unitsPerSec / 1000000.0, unit, iters, kRuns);
+	fflush(stdout);
+}
+
+// --- graphics/blit -------------------------------------------------------
+
+const uint kBlitW = 640;
+const uint kBlitH = 480;
+
+void benchCrossBlit(const char *name, const Graphics::PixelFormat &dstFmt, const Graphics::PixelFormat &srcFmt) {
+	byte *src = new byte[kBlitW * kBlitH * srcFmt.bytesPerPixel];
+	byte *dst = new byte[kBlitW * kBlitH * dstFmt.bytesPerPixel];
+	Lcg lcg(0x1234567);
+	lcg.fill(src, kBlitW * kBlitH * srcFmt.bytesPerPixel);
+
+	runBench(name, (double)kBlitW * kBlitH, "pix", [&]() {
+		Graphics::crossBlit(dst, src,
+		                    kBlitW * dstFmt.bytesPerPixel, kBlitW * srcFmt.bytesPerPixel,
+		                    kBlitW, kBlitH, dstFmt, srcFmt);
+	});
+
+	delete[] src;
+	delete[] dst;
+}
+
+void benchCrossBlitMap() {
+	byte *src = new byte[kBlitW * kBlitH];
+	byte *dst = new byte[kBlitW * kBlitH * 4];
+	uint32 map[256];
+	Lcg lcg(0x89abcde);
+	lcg.fill(src, kBlitW * kBlitH);
+	lcg.fill((byte *)map, sizeof(map));
+
+	runBench("crossBlitMap CLUT8 -> 32bpp", (double)kBlitW * kBlitH, "pix", [&]() {
+		Graphics::crossBlitMap(dst, src, kBlitW * 4, kBlitW, kBlitW, kBlitH, 4, map);
+	});
+
+	delete[] src;
+	delete[] dst;
+}
+
+// --- graphics/scaler -----------------------------------------------------
+
+const int kScaleW = 320;
+const int kScaleH = 200;
+const int kScalePad = 4;   // border so neighbor-reading scalers stay in bounds
+
+void benchScaler(const char *name, Scaler *scaler, uint factor) {
+	const uint32 srcPitch = (kScaleW + 2 * kScalePad) * 2;
+	const uint32 dstPitch = kScaleW * factor * 2;
+	byte *src = new byte[srcPitch * (kScaleH + 2 * kScalePad)];
+	byte *dst = new byte[dstPitch * kScaleH * factor];
+	Lcg lcg(0xfeed);
+	lcg.fill(src, srcPitch * (kScaleH + 2 * kScalePad));
+
+	scaler->setFactor(factor);
+	const byte *srcStart = src + srcPitch * kScalePad + kScalePad * 2;
+
+	runBench(name, (double)kScaleW * kScaleH, "pix", [&]() {
+		scaler->scale(srcStart, srcPitch, dst, dstPitch, kScaleW, kScaleH, 0, 0);
+	});
+
+	delete[] src;
+	delete[] dst;
+	delete scaler;
+}
+
+// --- audio/rate ----------------------------------------------------------
+
+// Endless deterministic noise, so the converter cost is all we measure.
+class NoiseStream : public Audio::AudioStream {
+public:
+	NoiseStream(int rate, bool stereo) : _rate(rate), _stereo(stereo), _lcg(0xa5a5a5) {}
+
+	int readBuffer(int16 *buffer, const int numSamples) override {
+		for (int i = 0; i < numSamples; i++)
+			buffer[i] = (int16)(_lcg.next() >> 16);
+		return numSamples;
+	}
+	bool isStereo() const override { return _stereo; }
+	int getRate() const override { return _rate; }
+	bool endOfData() const override { return false; }
+
+private:
+	int _rate;
+	bool _stereo;
+	Lcg _lcg;
+};
+
+void benchRateConverter(const char *name, int inRate, int outRate, bool inStereo) {
+	const int kSamples = 4096;
+	NoiseStream input(inRate, inStereo);
+	Audio::RateConverter *converter = Audio::makeRateConverter(inRate, outRate, inStereo, true, false);
+	int16 *out = new int16[kSamples * 2];
+
+	runBench(name, (double)kSamples, "smp", [&]() {
+		converter->convert(input, out, kSamples, 256, 256);
+	});
+
+	delete[] out;
+	delete converter;
+}
+
+// --- audio/decoders/floatdsp ---------------------------------------------
+
+void benchFloatDsp() {
+	// One WMA high-rate block worth of samples per call.
+	const int kLen = 2048;
+	float *a = new float[kLen];
+	float *b = new float[kLen];
+	float *c = new float[kLen];
+
+	Lcg rng(0xf10a7d5f);
+	for (int i = 0; i < kLen; i++) {
+		a[i] = (float)(int32)rng.next() / 2147483648.0f;
+		b[i] = (float)(int32)rng.next() / 2147483648.0f;
+		c[i] = 0.0f;
+	}
+
+	const Audio::VectorFMulAddFunc fmulAdd = Audio::getVectorFMulAddFunc();
+	runBench("FloatDsp fmul-add 2048 (MDCT overlap)", (double)kLen, "smp", [&]() {
+		fmulAdd(c, a, b, c, kLen);
+	});
+
+	const Audio::VectorFMulReverseFunc fmulReverse = Audio::getVectorFMulReverseFunc();
+	runBench("FloatDsp fmul-reverse 2048 (MDCT window)", (double)kLen, "smp", [&]() {
+		fmulReverse(c, a, b, kLen);
+	});
+
+	delete[] a;
+	delete[] b;
+	delete[] c;
+}
+
+// --- common/hashmap ------------------------------------------------------
+
+void benchHashMap() {
+	const uint kKeys = 10000;
+	Common::Array<Common::String> keys;
+	for (uint i = 0; i < kKeys; i++)
+		keys.push_back(Common::String::format("resource/room%04u.dat", i));
+
+	Common::HashMap<Common::String, uint32> map;
+	for (uint i = 0; i < kKeys; i++)
+		map[keys[i]] = i;
+
+	uint32 sink = 0;
+	runBench("HashMap<String> lookup (hits)", (double)kKeys, "op", [&]() {
+		for (uint i = 0; i < kKeys; i++)
+			sink += map[keys[i]];
+	});
+
+	runBench("HashMap<String> insert+clear", (double)kKeys, "op", [&]() {
+		Common::HashMap<Common::String, uint32> fresh;
+		for (uint i = 0; i < kKeys; i++)
+			fresh[keys[i]] = i;
+	});
+
+	Common::HashMap<uint32, uint32> intMap;
+	for (uint i = 0; i < kKeys; i++)
+		intMap[i * 2654435761u] = i;
+
+	runBench("HashMap<uint32> lookup (hits)", (double)kKeys, "op", [&]() {
+		for (uint i = 0; i < kKeys; i++)
+			sink += intMap[i * 2654435761u];
+	});
+
+	// Keep the compiler from discarding the lookups.
+	if (sink == 0xdeadbeef)
+		printf("(unlikely)\n");
+}
+
+} // end of anonymous namespace
+
+int main(int argc, char *argv[]) {
+#if NULL_OSYSTEM_IS_AVAILABLE
+	Common::install_null_g_system();
+#else
+	fprintf(stderr, "bench: no null OSystem available on this platform\n");
+	return 1;
+#endif
+
+	printf("ScummVM microbenchmarks (fixed corpora, deterministic seeds)\n");
+	printf("blit: %ux%u, scalers: %dx%d RGB565, rate: 4096-sample blocks\n\n",
+	       kBlitW, kBlitH, kScaleW, kScaleH);
+
+	const Graphics::PixelFormat rgb565(2, 5, 6, 5, 0, 11, 5, 0, 0);
+	const Graphics::PixelFormat rgb555(2, 5, 5, 5, 0, 10, 5, 0, 0);
+	const Graphics::PixelFormat rgba8888(4, 8, 8, 8, 8, 24, 16, 8, 0);
+	const Graphics::PixelFormat bgra8888(4, 8, 8, 8, 8, 8, 16, 24, 0);
+
+	benchCrossBlit("crossBlit RGB565 -> RGBA8888", rgba8888, rgb565);
+	benchCrossBlit("crossBlit RGBA8888 -> RGB565", rgb565, rgba8888);
+	benchCrossBlit("crossBlit RGB555 -> RGB565", rgb565, rgb555);
+	benchCrossBlit("crossBlit RGBA8888 -> BGRA8888", bgra8888, rgba8888);
+	benchCrossBlitMap();
+
+	benchScaler("NormalScaler 2x", new NormalScaler(rgb565), 2);
+#ifdef USE_SCALERS
+	benchScaler("AdvMameScaler 2x", new AdvMameScaler(rgb565), 2);
+	benchScaler("SAIScaler 2x", new SAIScaler(rgb565), 2);
+	benchScaler("TVScaler 2x", new TVScaler(rgb565), 2);
+#endif
+
+	benchRateConverter("RateConverter 11025 -> 44100 mono", 11025, 44100, false);
+	benchRateConverter("RateConverter 22050 -> 44100 stereo", 22050, 44100, true);
+	benchRateConverter("RateConverter 44100 -> 44100 stereo", 44100, 44100, true);
+	benchRateConverter("RateConverter 48000 -> 44100 stereo", 48000, 44100, true);
+
+	benchFloatDsp();
+
+	benchHashMap();
+
+	return 0;
+}
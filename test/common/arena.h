@@ -0,0 +1,89 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memorypool.h"
+
+class ArenaTestSuite : public CxxTest::TestSuite {
+public:
+	void test_alloc_and_alignment() {
+		Common::Arena arena(64);
+
+		byte *a = (byte *)arena.alloc(3, 1);
+		byte *b = (byte *)arena.alloc(4, 4);
+		byte *c = (byte *)arena.alloc(8, 8);
+
+		TS_ASSERT(a != nullptr);
+		TS_ASSERT(b != nullptr);
+		TS_ASSERT(c != nullptr);
+		TS_ASSERT_EQUALS((uintptr)b % 4, (uintptr)0);
+		TS_ASSERT_EQUALS((uintptr)c % 8, (uintptr)0);
+
+		// Allocations must not overlap
+		memset(a, 0xAA, 3);
+		memset(b, 0xBB, 4);
+		memset(c, 0xCC, 8);
+		TS_ASSERT_EQUALS(a[0], 0xAA);
+		TS_ASSERT_EQUALS(b[0], 0xBB);
+		TS_ASSERT_EQUALS(c[0], 0xCC);
+	}
+
+	void test_grows_beyond_block_size() {
+		Common::Arena arena(32);
+
+		// More than one block's worth of allocations
+		for (int i = 0; i < 100; ++i) {
+			byte *p = (byte *)arena.alloc(16);
+			TS_ASSERT(p != nullptr);
+			memset(p, i, 16);
+		}
+
+		// An allocation larger than the block size
+		byte *big = (byte *)arena.alloc(1000);
+		TS_ASSERT(big != nullptr);
+		memset(big, 0x42, 1000);
+	}
+
+	void test_reset_reuses_memory() {
+		Common::Arena arena(64);
+
+		byte *first = (byte *)arena.alloc(16);
+		arena.alloc(16);
+		arena.reset();
+
+		// After a reset the first allocation starts over at the same spot
+		byte *again = (byte *)arena.alloc(16);
+		TS_ASSERT_EQUALS(first, again);
+	}
+
+	void test_scope_rewinds() {
+		Common::Arena arena(64);
+
+		byte *outer = (byte *)arena.alloc(8);
+		byte *inner1;
+		{
+			Common::ArenaScope scope(arena);
+			inner1 = (byte *)arena.alloc(8);
+			arena.alloc(8);
+		}
+		{
+			Common::ArenaScope scope(arena);
+			// The scope above released its allocations
+			byte *inner2 = (byte *)arena.alloc(8);
+			TS_ASSERT_EQUALS(inner1, inner2);
+		}
+
+		// The outer allocation is untouched by the scopes
+		TS_ASSERT(outer != nullptr);
+	}
+
+	void test_free_blocks() {
+		Common::Arena arena(32);
+
+		for (int i = 0; i < 10; ++i)
+			arena.alloc(16);
+		arena.freeBlocks();
+
+		// The arena is usable again afterwards
+		byte *p = (byte *)arena.alloc(16);
+		TS_ASSERT(p != nullptr);
+	}
+};
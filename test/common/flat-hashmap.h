@@ -0,0 +1,149 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/flat-hashmap.h"
+#include "common/hash-str.h"
+
+class FlatHashMapTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_empty_clear() {
+		Common::FlatHashMap<int, int> container;
+		TS_ASSERT(container.empty());
+		container[0] = 17;
+		container[1] = 33;
+		TS_ASSERT(!container.empty());
+		container.clear();
+		TS_ASSERT(container.empty());
+	}
+
+	void test_contains() {
+		Common::FlatHashMap<Common::String, Common::String> container;
+		container["foo"] = "bar";
+		container["quux"] = "blub";
+		TS_ASSERT(container.contains("foo"));
+		TS_ASSERT(container.contains("quux"));
+		TS_ASSERT(!container.contains("bar"));
+		TS_ASSERT(!container.contains("asdf"));
+	}
+
+	void test_add_remove() {
+		Common::FlatHashMap<int, int> container;
+		container[0] = 17;
+		container[1] = 33;
+		container[2] = 45;
+		TS_ASSERT(container.contains(1));
+		container.erase(1);
+		TS_ASSERT(!container.contains(1));
+		// Reinserting an erased key must recycle the tombstone.
+		container[1] = 42;
+		TS_ASSERT(container.contains(1));
+		TS_ASSERT_EQUALS(container[1], 42);
+		container.erase(0);
+		container.erase(1);
+		container.erase(2);
+		TS_ASSERT(container.empty());
+	}
+
+	void test_get_set_val() {
+		Common::FlatHashMap<int, int> container;
+		container.setVal(5, 42);
+		TS_ASSERT(container.contains(5));
+		TS_ASSERT_EQUALS(container.getVal(5), 42);
+		TS_ASSERT_EQUALS(container.getValOrDefault(5, -1), 42);
+		TS_ASSERT_EQUALS(container.getValOrDefault(6, -1), -1);
+
+		int out = 0;
+		TS_ASSERT(container.tryGetVal(5, out));
+		TS_ASSERT_EQUALS(out, 42);
+		TS_ASSERT(!container.tryGetVal(6, out));
+	}
+
+	void test_grow() {
+		// Push the table through several rehashes and verify that all
+		// entries survive the moves.
+		Common::FlatHashMap<int, int> container;
+		for (int i = 0; i < 1000; ++i)
+			container[i] = 7 * i;
+		TS_ASSERT_EQUALS(container.size(), (Common::FlatHashMap<int, int>::size_type)1000);
+		for (int i = 0; i < 1000; ++i) {
+			TS_ASSERT(container.contains(i));
+			TS_ASSERT_EQUALS(container[i], 7 * i);
+		}
+	}
+
+	void test_iterator() {
+		Common::FlatHashMap<int, int> container;
+		container[2] = 4;
+		container[3] = 9;
+		container[4] = 16;
+
+		int sumKeys = 0, sumValues = 0;
+		for (Common::FlatHashMap<int, int>::iterator it = container.begin(); it != container.end(); ++it) {
+			sumKeys += it->_key;
+			sumValues += it->_value;
+		}
+		TS_ASSERT_EQUALS(sumKeys, 9);
+		TS_ASSERT_EQUALS(sumValues, 29);
+	}
+
+	void test_erase_while_iterating() {
+		// HashMap users erase through an iterator and keep iterating;
+		// the flat map must support the same pattern.
+		Common::FlatHashMap<int, int> container;
+		for (int i = 0; i < 100; ++i)
+			container[i] = i;
+
+		for (Common::FlatHashMap<int, int>::iterator it = container.begin(); it != container.end(); ++it) {
+			if (it->_key & 1)
+				container.erase(it);
+		}
+
+		TS_ASSERT_EQUALS(container.size(), (Common::FlatHashMap<int, int>::size_type)50);
+		for (int i = 0; i < 100; ++i)
+			TS_ASSERT_EQUALS(container.contains(i), (i & 1) == 0);
+	}
+
+	void test_copy() {
+		Common::FlatHashMap<int, int> container;
+		container[1] = 2;
+		container[3] = 4;
+
+		Common::FlatHashMap<int, int> copy(container);
+		TS_ASSERT_EQUALS(copy.size(), container.size());
+		TS_ASSERT_EQUALS(copy[1], 2);
+		TS_ASSERT_EQUALS(copy[3], 4);
+
+		copy[5] = 6;
+		TS_ASSERT(!container.contains(5));
+
+		container = copy;
+		TS_ASSERT(container.contains(5));
+	}
+
+	void test_copy_after_erase() {
+		// A copy must not mirror the source's tombstones: keys whose probe
+		// chain passed through an erased slot have to stay reachable.
+		Common::FlatHashMap<int, int> container;
+		for (int i = 0; i < 64; ++i)
+			container[i] = i * 3;
+		for (int i = 0; i < 64; i += 2)
+			container.erase(i);
+
+		Common::FlatHashMap<int, int> copy(container);
+		TS_ASSERT_EQUALS(copy.size(), container.size());
+		for (int i = 0; i < 64; ++i) {
+			TS_ASSERT_EQUALS(copy.contains(i), (i & 1) == 1);
+			if (i & 1)
+				TS_ASSERT_EQUALS(copy[i], i * 3);
+		}
+
+		// Same through assignment.
+		Common::FlatHashMap<int, int> assigned;
+		assigned[1000] = 1;
+		assigned = container;
+		TS_ASSERT_EQUALS(assigned.size(), container.size());
+		TS_ASSERT(!assigned.contains(1000));
+		for (int i = 1; i < 64; i += 2)
+			TS_ASSERT_EQUALS(assigned[i], i * 3);
+	}
+};
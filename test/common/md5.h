@@ -47,4 +47,52 @@ class MD5TestSuite : public CxxTest::TestSuite {
 		}
 	}
 
+	void test_incrementalMD5() {
+		for (int i = 0; i < 7; i++) {
+			Common::MD5 ctx;
+
+			// Feed the message one byte at a time; the digest must match
+			// the one-shot computation.
+			for (const char *p = md5_test_string[i]; *p; p++)
+				ctx.update((const uint8 *)p, 1);
+
+			TS_ASSERT_EQUALS(ctx.finishAsString(), md5_test_digest[i]);
+		}
+	}
+
+	void test_batchMD5() {
+		const byte *buffers[7];
+		uint32 lengths[7];
+		uint8 digests[7][16];
+		char output[33];
+
+		for (int i = 0; i < 7; i++) {
+			buffers[i] = (const byte *)md5_test_string[i];
+			lengths[i] = strlen(md5_test_string[i]);
+		}
+
+		// More than one lane group, with uneven lengths; each digest must
+		// match the scalar result.
+		Common::computeBatchMD5(buffers, lengths, 7, digests);
+
+		for (int i = 0; i < 7; i++) {
+			for (int j = 0; j < 16; j++) {
+				snprintf(output + j * 2, 3, "%02x", digests[i][j]);
+			}
+
+			Common::String tmp(output);
+			TS_ASSERT_EQUALS(tmp, md5_test_digest[i]);
+		}
+	}
+
+	void test_incrementalMD5Reset() {
+		Common::MD5 ctx;
+
+		ctx.update((const uint8 *)"garbage", 7);
+		ctx.reset();
+		ctx.update((const uint8 *)md5_test_string[2], strlen(md5_test_string[2]));
+
+		TS_ASSERT_EQUALS(ctx.finishAsString(), md5_test_digest[2]);
+	}
+
 };
@@ -393,6 +393,26 @@ class PathTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(Common::Path("foo^..^bar/", '^').normalize().toString('^'), "bar/");
 	}
 
+	void test_is_normalized() {
+		TS_ASSERT(Common::Path("", '/').isNormalized());
+		TS_ASSERT(Common::Path("/", '/').isNormalized());
+		TS_ASSERT(Common::Path("/foo/bar", '/').isNormalized());
+		TS_ASSERT(Common::Path("foo/.bar", '/').isNormalized());
+		TS_ASSERT(Common::Path("..", '/').isNormalized());
+		TS_ASSERT(Common::Path("/..", '/').isNormalized());
+		TS_ASSERT(Common::Path("../../foo/bar", '/').isNormalized());
+
+		TS_ASSERT(!Common::Path("///", '/').isNormalized());
+		TS_ASSERT(!Common::Path("/foo/bar/", '/').isNormalized());
+		TS_ASSERT(!Common::Path("foo//bar", '/').isNormalized());
+		TS_ASSERT(!Common::Path("foo/./bar", '/').isNormalized());
+		TS_ASSERT(!Common::Path("foo/../bar", '/').isNormalized());
+		TS_ASSERT(!Common::Path("foo/../../bar", '/').isNormalized());
+
+		// Escaped paths are always left to normalize()
+		TS_ASSERT(!Common::Path("foo/^..^bar", '^').isNormalized());
+	}
+
 	void test_punycode() {
 		Common::Path p;
 		Common::Path p2 = p.punycodeDecode();
@@ -600,4 +620,19 @@ class PathTestSuite : public CxxTest::TestSuite
 		p15.removeExtension(".dir");
 		TS_ASSERT_EQUALS(p15.toString(), "");
 	}
+
+	void test_move() {
+		Common::Path p("foo/bar/baz");
+		Common::Path q(static_cast<Common::Path &&>(p));
+		TS_ASSERT_EQUALS(q.toString(), "foo/bar/baz");
+
+		Common::Path r;
+		r = static_cast<Common::Path &&>(q);
+		TS_ASSERT_EQUALS(r.toString(), "foo/bar/baz");
+
+		// Moving out of a String without a separator change
+		Common::String s("some/dir/file");
+		Common::Path fromStr(static_cast<Common::String &&>(s), '/');
+		TS_ASSERT_EQUALS(fromStr.toString(), "some/dir/file");
+	}
 };
@@ -0,0 +1,110 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/memstream.h"
+
+namespace {
+
+// A tiny archive with a single member, counting how often it is queried.
+class MockArchive : public Common::Archive {
+public:
+	Common::Path _member;
+	mutable int _hasFileCalls;
+	mutable int _createStreamCalls;
+
+	explicit MockArchive(const Common::Path &member)
+		: _member(member), _hasFileCalls(0), _createStreamCalls(0) {}
+
+	bool hasFile(const Common::Path &path) const override {
+		_hasFileCalls++;
+		return path == _member;
+	}
+
+	int listMembers(Common::ArchiveMemberList &list) const override {
+		list.push_back(getMember(_member));
+		return 1;
+	}
+
+	const Common::ArchiveMemberPtr getMember(const Common::Path &path) const override {
+		if (path != _member)
+			return Common::ArchiveMemberPtr();
+		return Common::ArchiveMemberPtr(new Common::GenericArchiveMember(path, *this));
+	}
+
+	Common::SeekableReadStream *createReadStreamForMember(const Common::Path &path) const override {
+		_createStreamCalls++;
+		if (path != _member)
+			return nullptr;
+		return new Common::MemoryReadStream((const byte *)"x", 1);
+	}
+};
+
+} // End of anonymous namespace
+
+class SearchSetTestSuite : public CxxTest::TestSuite {
+public:
+	void test_lookup_cache_positive() {
+		Common::SearchSet set;
+		MockArchive *a = new MockArchive("a.txt");
+		MockArchive *b = new MockArchive("b.txt");
+		set.add("a", a, 0);
+		set.add("b", b, 0);
+
+		TS_ASSERT(set.hasFile("b.txt"));
+		const int aCalls = a->_hasFileCalls;
+		const int bCalls = b->_hasFileCalls;
+
+		// A repeated query must be answered from the cache
+		TS_ASSERT(set.hasFile("b.txt"));
+		TS_ASSERT_EQUALS(a->_hasFileCalls, aCalls);
+		TS_ASSERT_EQUALS(b->_hasFileCalls, bCalls);
+	}
+
+	void test_lookup_cache_negative() {
+		Common::SearchSet set;
+		MockArchive *a = new MockArchive("a.txt");
+		set.add("a", a, 0);
+
+		TS_ASSERT(!set.hasFile("missing.txt"));
+		TS_ASSERT(set.createReadStreamForMember("missing.txt") == nullptr);
+		const int calls = a->_hasFileCalls + a->_createStreamCalls;
+
+		// Neither probe may reach the archive again
+		TS_ASSERT(!set.hasFile("missing.txt"));
+		TS_ASSERT(set.createReadStreamForMember("missing.txt") == nullptr);
+		TS_ASSERT_EQUALS(a->_hasFileCalls + a->_createStreamCalls, calls);
+	}
+
+	void test_lookup_cache_invalidation() {
+		Common::SearchSet set;
+		MockArchive *a = new MockArchive("a.txt");
+		set.add("a", a, 0);
+
+		TS_ASSERT(!set.hasFile("b.txt"));
+
+		// Adding an archive must drop the cached miss
+		set.add("b", new MockArchive("b.txt"), 0);
+		TS_ASSERT(set.hasFile("b.txt"));
+
+		// Removing it must drop the cached hit
+		set.remove("b");
+		TS_ASSERT(!set.hasFile("b.txt"));
+	}
+
+	void test_stream_resolution_uses_cache() {
+		Common::SearchSet set;
+		MockArchive *a = new MockArchive("a.txt");
+		set.add("a", a, 0);
+
+		Common::SeekableReadStream *stream = set.createReadStreamForMember("a.txt");
+		TS_ASSERT(stream != nullptr);
+		delete stream;
+		const int calls = a->_createStreamCalls;
+
+		stream = set.createReadStreamForMember("a.txt");
+		TS_ASSERT(stream != nullptr);
+		delete stream;
+		// The cached resolution goes straight to the right archive
+		TS_ASSERT_EQUALS(a->_createStreamCalls, calls + 1);
+	}
+};
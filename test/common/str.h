@@ -29,6 +29,18 @@ class StringTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(str2, "  This is a s tring with spaces  ");
 	}
 
+	void test_reserve() {
+		Common::String str;
+		str.reserve(100);
+		TS_ASSERT_EQUALS(str.size(), (uint)0);
+		const char *p = str.c_str();
+		for (int i = 0; i < 100; ++i)
+			str += 'x';
+		// No reallocation may have happened while appending
+		TS_ASSERT_EQUALS(str.c_str(), p);
+		TS_ASSERT_EQUALS(str.size(), (uint)100);
+	}
+
 	void test_chop() {
 		Common::String str("test-string");
 		Common::String str2 = str;
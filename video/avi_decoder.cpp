@@ -118,6 +118,30 @@ bool AVIDecoder::seekToFrame(uint frame) {
 	return seek(time);
 }
 
+bool AVIDecoder::seekIntraFrameOnly(uint frame) {
+	// Snapping to the preceding keyframe means seekIntern() has no delta
+	// frames to decode forward through
+	return seekToFrame(getNearestIntraFrame(frame));
+}
+
+uint AVIDecoder::getNearestIntraFrame(uint frame) const {
+	if (_videoKeyFrames.empty())
+		return frame;
+
+	// Binary search for the last keyframe at or before the frame. The
+	// first entry is always frame 0, so the search cannot underflow.
+	uint low = 0, high = _videoKeyFrames.size();
+	while (high - low > 1) {
+		uint mid = (low + high) / 2;
+		if (_videoKeyFrames[mid] <= frame)
+			low = mid;
+		else
+			high = mid;
+	}
+
+	return _videoKeyFrames[low] <= frame ? _videoKeyFrames[low] : frame;
+}
+
 void AVIDecoder::initCommon() {
 	_decodedHeader = false;
 	_foundMovieList = false;
@@ -496,6 +520,9 @@ bool AVIDecoder::loadStream(Common::SeekableReadStream *stream) {
 	if (_transparencyTrack.track)
 		eraseTrack(_transparencyTrack.track);
 
+	// Distill the index into per-track lookup tables for fast seeking
+	buildFrameIndex();
+
 	// Check if this is a special Duck Truemotion video
 	checkTruemotion1();
 
@@ -513,6 +540,10 @@ void AVIDecoder::close() {
 	_movieListEnd = 0;
 
 	_indexEntries.clear();
+	_videoFrameEntries.clear();
+	_videoKeyFrames.clear();
+	_videoPaletteEntries.clear();
+	_audioChunkEntries.clear();
 	memset(&_header, 0, sizeof(_header));
 
 	_videoTracks.clear();
@@ -680,7 +711,6 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 
 	// Get our video
 	AVIVideoTrack *videoTrack = (AVIVideoTrack *)_videoTracks[0].track;
-	uint32 videoIndex = _videoTracks[0].index;
 
 	if (time == getDuration()) {
 		videoTrack->setCurFrame(videoTrack->getFrameCount() - 1);
@@ -703,55 +733,29 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 	// Reset any palette, if necessary
 	videoTrack->useInitialPalette();
 
-	int lastKeyFrame = -1;
-	int frameIndex = -1;
-	uint curFrame = 0;
-
-	// Go through and figure out where we should be
-	// If there's a palette, we need to find the palette too
-	for (uint32 i = 0; i < _indexEntries.size(); i++) {
-		const OldIndex &index = _indexEntries[i];
-
-		// We don't care about RECs
-		if (index.id == ID_REC)
-			continue;
-
-		// We're only looking at entries for this track
-		if (getStreamIndex(index.id) != videoIndex)
-			continue;
+	if (frame >= _videoFrameEntries.size()) // This shouldn't happen.
+		return false;
 
-		uint16 streamType = getStreamType(index.id);
+	// Look up the target frame and the keyframe to decode from in the
+	// tables built on load
+	uint32 frameIndex = _videoFrameEntries[frame];
+	uint keyFrame = getNearestIntraFrame(frame);
 
-		if (streamType == kStreamTypePaletteChange) {
-			// We need to handle any palette change we see since there's no
-			// flag to tell if this is a "key" palette.
-			// Decode the palette
-			_fileStream->seek(_indexEntries[i].offset + 8);
-			Common::SeekableReadStream *chunk = 0;
+	// We need to handle any palette change before the target frame since
+	// there's no flag to tell if this is a "key" palette
+	for (uint32 i = 0; i < _videoPaletteEntries.size() && _videoPaletteEntries[i] < frameIndex; i++) {
+		const OldIndex &index = _indexEntries[_videoPaletteEntries[i]];
 
-			if (_indexEntries[i].size != 0)
-				chunk = _fileStream->readStream(_indexEntries[i].size);
+		// Decode the palette
+		_fileStream->seek(index.offset + 8);
+		Common::SeekableReadStream *chunk = 0;
 
-			videoTrack->loadPaletteFromChunk(chunk);
-		} else {
-			// Check to see if this is a keyframe
-			// The first frame has to be a keyframe
-			if ((_indexEntries[i].flags & AVIIF_INDEX) || curFrame == 0)
-				lastKeyFrame = i;
-
-			// Did we find the target frame?
-			if (frame == curFrame) {
-				frameIndex = i;
-				break;
-			}
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
-			curFrame++;
-		}
+		videoTrack->loadPaletteFromChunk(chunk);
 	}
 
-	if (frameIndex < 0) // This shouldn't happen.
-		return false;
-
 	// Update all the audio tracks
 	for (uint32 i = 0; i < _audioTracks.size(); i++) {
 		AVIAudioTrack *audioTrack = (AVIAudioTrack *)_audioTracks[i].track;
@@ -762,51 +766,29 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 		// Set the chunk index for the track
 		audioTrack->setCurChunk(frame);
 
-		uint32 chunksFound = 0;
-		for (uint32 j = 0; j < _indexEntries.size(); j++) {
-			const OldIndex &index = _indexEntries[j];
-
-			// Continue ignoring RECs
-			if (index.id == ID_REC)
-				continue;
-
-			if (getStreamIndex(index.id) == _audioTracks[i].index) {
-				if (chunksFound == frame) {
-					_fileStream->seek(index.offset + 8);
-					Common::SeekableReadStream *audioChunk = _fileStream->readStream(index.size);
-					audioTrack->queueSound(audioChunk);
-					_audioTracks[i].chunkSearchOffset = (j == _indexEntries.size() - 1) ? _movieListEnd : _indexEntries[j + 1].offset;
-					break;
-				}
+		const Common::Array<uint32> &chunks = _audioChunkEntries[i];
+		if (frame < chunks.size()) {
+			const OldIndex &index = _indexEntries[chunks[frame]];
 
-				chunksFound++;
-			}
+			_fileStream->seek(index.offset + 8);
+			Common::SeekableReadStream *audioChunk = _fileStream->readStream(index.size);
+			audioTrack->queueSound(audioChunk);
+			_audioTracks[i].chunkSearchOffset = (chunks[frame] == _indexEntries.size() - 1) ? _movieListEnd : _indexEntries[chunks[frame] + 1].offset;
 		}
 
 		// Skip any audio to bring us to the right time
 		audioTrack->skipAudio(time, videoTrack->getFrameTime(frame));
 	}
 
-	// Decode from keyFrame to curFrame - 1
-	for (int i = lastKeyFrame; i < frameIndex; i++) {
-		if (_indexEntries[i].id == ID_REC)
-			continue;
-
-		if (getStreamIndex(_indexEntries[i].id) != videoIndex)
-			continue;
-
-		uint16 streamType = getStreamType(_indexEntries[i].id);
-
-		// Ignore palettes, they were already handled
-		if (streamType == kStreamTypePaletteChange)
-			continue;
+	// Decode from the keyframe up to, but not including, the target frame
+	for (uint i = keyFrame; i < frame; i++) {
+		const OldIndex &index = _indexEntries[_videoFrameEntries[i]];
 
-		// Frame, hopefully
-		_fileStream->seek(_indexEntries[i].offset + 8);
 		Common::SeekableReadStream *chunk = 0;
+		_fileStream->seek(index.offset + 8);
 
-		if (_indexEntries[i].size != 0)
-			chunk = _fileStream->readStream(_indexEntries[i].size);
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
 		videoTrack->decodeFrame(chunk);
 	}
@@ -911,6 +893,53 @@ void AVIDecoder::readOldIndex(uint32 size) {
 	}
 }
 
+void AVIDecoder::buildFrameIndex() {
+	_videoFrameEntries.clear();
+	_videoKeyFrames.clear();
+	_videoPaletteEntries.clear();
+	_audioChunkEntries.clear();
+	_audioChunkEntries.resize(_audioTracks.size());
+
+	if (_videoTracks.empty())
+		return;
+
+	uint32 videoIndex = _videoTracks[0].index;
+
+	for (uint32 i = 0; i < _indexEntries.size(); i++) {
+		const OldIndex &index = _indexEntries[i];
+
+		// We don't care about RECs
+		if (index.id == ID_REC)
+			continue;
+
+		byte streamIndex = getStreamIndex(index.id);
+
+		if (streamIndex == videoIndex) {
+			if (getStreamType(index.id) == kStreamTypePaletteChange) {
+				_videoPaletteEntries.push_back(i);
+				continue;
+			}
+
+			// The first frame has to be a keyframe, flagged or not
+			if ((index.flags & AVIIF_INDEX) || _videoFrameEntries.empty())
+				_videoKeyFrames.push_back(_videoFrameEntries.size());
+
+			_videoFrameEntries.push_back(i);
+			continue;
+		}
+
+		for (uint32 j = 0; j < _audioTracks.size(); j++) {
+			if (streamIndex == _audioTracks[j].index) {
+				_audioChunkEntries[j].push_back(i);
+				break;
+			}
+		}
+	}
+
+	debugC(6, kDebugLevelGVideo, "Frame index: %d frames, %d keyframes",
+			_videoFrameEntries.size(), _videoKeyFrames.size());
+}
+
 void AVIDecoder::checkTruemotion1() {
 	// If we got here from loadStream(), we know the track is valid
 	assert(!_videoTracks.empty());
@@ -328,6 +328,23 @@ protected:
 	void readOldIndex(uint32 size);
 	IndexEntries _indexEntries;
 
+	/**
+	 * Flat lookup tables distilled from the old-style index once
+	 * loadStream() has identified the tracks, so that seeking does not
+	 * have to re-walk all index entries.
+	 *
+	 * _videoFrameEntries maps a frame number of the primary video track
+	 * to the position of its chunk in _indexEntries, _videoKeyFrames
+	 * holds the sorted frame numbers of the intra frames, and
+	 * _videoPaletteEntries the positions of the palette change chunks.
+	 * _audioChunkEntries is laid out parallel to _audioTracks.
+	 */
+	void buildFrameIndex();
+	Common::Array<uint32> _videoFrameEntries;
+	Common::Array<uint32> _videoKeyFrames;
+	Common::Array<uint32> _videoPaletteEntries;
+	Common::Array<Common::Array<uint32> > _audioChunkEntries;
+
 	Common::SeekableReadStream *_fileStream;
 	bool _decodedHeader;
 	bool _foundMovieList;
@@ -368,6 +385,21 @@ public:
 	 * This calls seek() internally.
 	 */
 	virtual bool seekToFrame(uint frame);
+
+	/**
+	 * Seek to the nearest intra frame (keyframe) at or before the given
+	 * frame, without decoding the delta frames that follow it.
+	 *
+	 * This is the fast path for scrubbing: the displayed frame may be up
+	 * to one keyframe interval early, but no forward decoding is needed.
+	 */
+	bool seekIntraFrameOnly(uint frame);
+
+	/**
+	 * Get the nearest intra frame at or before the given frame, from the
+	 * keyframe index built on load.
+	 */
+	virtual uint getNearestIntraFrame(uint frame) const;
 };
 
 } // End of namespace Video
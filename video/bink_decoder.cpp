@@ -24,6 +24,7 @@
 // Many thanks to Kostya Shishkov for doing the hard work.
 
 #include "audio/audiostream.h"
+#include "audio/decoders/floatdsp.h"
 #include "audio/decoders/raw.h"
 
 #include "common/util.h"
@@ -63,6 +64,44 @@ static const uint32 kDCStartBits = 11;
 
 namespace Video {
 
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+// Vector kernels for the hot block reconstruction paths, implemented in
+// bink_decoder_sse2.cpp / bink_decoder_neon.cpp.
+struct BinkBlockKernels {
+	void (*idctPut)(byte *dest, uint32 pitch, const int32 *block);
+	void (*idctAdd)(byte *dest, uint32 pitch, const int32 *block);
+	void (*residueAdd)(byte *dest, uint32 pitch, const int16 *block);
+};
+
+// Picks the kernel set once, based on the CPU features the backend
+// reports; nullptr selects the portable scalar code.
+static const BinkBlockKernels *getBlockKernels() {
+	static BinkBlockKernels kernels;
+	static const BinkBlockKernels *selected = nullptr;
+	static bool checked = false;
+	if (!checked) {
+		checked = true;
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) {
+			kernels.idctPut = binkIDCTPutSSE2;
+			kernels.idctAdd = binkIDCTAddSSE2;
+			kernels.residueAdd = binkResidueAddSSE2;
+			selected = &kernels;
+		}
+#endif
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) {
+			kernels.idctPut = binkIDCTPutNEON;
+			kernels.idctAdd = binkIDCTAddNEON;
+			kernels.residueAdd = binkResidueAddNEON;
+			selected = &kernels;
+		}
+#endif
+	}
+	return selected;
+}
+#endif
+
 BinkDecoder::BinkDecoder() {
 	_bink = 0;
 }
@@ -943,6 +982,14 @@ void BinkDecoder::BinkVideoTrack::blockResidue(DecodeContext &ctx) {
 
 	readResidue(*ctx.video, block, v);
 
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+	const BinkBlockKernels *kernels = getBlockKernels();
+	if (kernels) {
+		kernels->residueAdd(ctx.dest, ctx.pitch, block);
+		return;
+	}
+#endif
+
 	byte  *dst = ctx.dest;
 	int16 *src = block;
 	for (int i = 0; i < 8; i++, dst += ctx.pitch, src += 8)
@@ -1473,6 +1520,14 @@ void BinkDecoder::BinkVideoTrack::IDCT(int32 *block) {
 void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int32 *block) {
 	int i, j;
 
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+	const BinkBlockKernels *kernels = getBlockKernels();
+	if (kernels) {
+		kernels->idctAdd(ctx.dest, ctx.pitch, block);
+		return;
+	}
+#endif
+
 	IDCT(block);
 	byte *dest = ctx.dest;
 	for (i = 0; i < 8; i++, dest += ctx.pitch, block += 8)
@@ -1483,6 +1538,15 @@ void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int32 *block) {
 void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int32 *block) {
 	int i;
 	int32 temp[64];
+
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+	const BinkBlockKernels *kernels = getBlockKernels();
+	if (kernels) {
+		kernels->idctPut(ctx.dest, ctx.pitch, block);
+		return;
+	}
+#endif
+
 	for (i = 0; i < 8; i++)
 		IDCTCol(&temp[i], &block[i]);
 	for (i = 0; i < 8; i++) {
@@ -1653,10 +1717,9 @@ static inline int floatToInt16One(float src) {
 
 void BinkDecoder::BinkAudioTrack::floatToInt16Interleave(int16 *dst, const float **src, uint32 length, uint8 channels) {
 	if (channels == 2) {
-		for (uint32 i = 0; i < length; i++) {
-			dst[2 * i    ] = floatToInt16One(src[0][i]);
-			dst[2 * i + 1] = floatToInt16One(src[1][i]);
-		}
+		Audio::getFloatToInt16InterleaveStereoFunc()(dst, src[0], src[1], length);
+	} else if (channels == 1) {
+		Audio::getFloatToInt16Func()(dst, src[0], length);
 	} else {
 		for(uint8 c = 0; c < channels; c++)
 			for(uint32 i = 0, j = c; i < length; i++, j += channels)
@@ -385,6 +385,20 @@ private:
 	void initAudioTrack(AudioInfo &audio);
 };
 
+#ifdef SCUMMVM_SSE2
+// SSE2 block reconstruction kernels, see video/bink_decoder_sse2.cpp
+void binkIDCTPutSSE2(byte *dest, uint32 pitch, const int32 *block);
+void binkIDCTAddSSE2(byte *dest, uint32 pitch, const int32 *block);
+void binkResidueAddSSE2(byte *dest, uint32 pitch, const int16 *block);
+#endif
+
+#ifdef SCUMMVM_NEON
+// NEON block reconstruction kernels, see video/bink_decoder_neon.cpp
+void binkIDCTPutNEON(byte *dest, uint32 pitch, const int32 *block);
+void binkIDCTAddNEON(byte *dest, uint32 pitch, const int32 *block);
+void binkResidueAddNEON(byte *dest, uint32 pitch, const int16 *block);
+#endif
+
 } // End of namespace Video
 
 #endif // VIDEO_BINK_DECODER_H
@@ -0,0 +1,182 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(USE_BINK) && defined(SCUMMVM_NEON)
+
+#include "video/bink_decoder.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Video {
+
+// Constants of the scalar IDCT in bink_decoder.cpp
+#define A1  2896 /* (1/sqrt(2))<<12 */
+#define A2  2217
+#define A3  3784
+#define A4 -5352
+
+// One 8-point Bink IDCT over v[0..7], computed on all four lanes at once.
+// Mirrors IDCT_TRANSFORM in bink_decoder.cpp without the munge step.
+static inline void idct8(int32x4_t *v) {
+	const int32x4_t a0 = vaddq_s32(v[0], v[4]);
+	const int32x4_t a1 = vsubq_s32(v[0], v[4]);
+	const int32x4_t a2 = vaddq_s32(v[2], v[6]);
+	const int32x4_t a3 = vshrq_n_s32(vmulq_n_s32(vsubq_s32(v[2], v[6]), A1), 11);
+	const int32x4_t a4 = vaddq_s32(v[5], v[3]);
+	const int32x4_t a5 = vsubq_s32(v[5], v[3]);
+	const int32x4_t a6 = vaddq_s32(v[1], v[7]);
+	const int32x4_t a7 = vsubq_s32(v[1], v[7]);
+
+	const int32x4_t b0 = vaddq_s32(a4, a6);
+	const int32x4_t b1 = vshrq_n_s32(vmulq_n_s32(vaddq_s32(a5, a7), A3), 11);
+	const int32x4_t b2 = vaddq_s32(vsubq_s32(vshrq_n_s32(vmulq_n_s32(a5, A4), 11), b0), b1);
+	const int32x4_t b3 = vsubq_s32(vshrq_n_s32(vmulq_n_s32(vsubq_s32(a6, a4), A1), 11), b2);
+	const int32x4_t b4 = vsubq_s32(vaddq_s32(vshrq_n_s32(vmulq_n_s32(a7, A2), 11), b3), b1);
+
+	const int32x4_t p0 = vaddq_s32(a0, a2); // a0+a2
+	const int32x4_t p1 = vsubq_s32(a0, a2); // a0-a2
+	const int32x4_t p2 = vsubq_s32(vaddq_s32(a1, a3), a2); // a1+a3-a2
+	const int32x4_t p3 = vaddq_s32(vsubq_s32(a1, a3), a2); // a1-a3+a2
+
+	v[0] = vaddq_s32(p0, b0);
+	v[1] = vaddq_s32(p2, b2);
+	v[2] = vaddq_s32(p3, b3);
+	v[3] = vsubq_s32(p1, b4);
+	v[4] = vaddq_s32(p1, b4);
+	v[5] = vsubq_s32(p3, b3);
+	v[6] = vsubq_s32(p2, b2);
+	v[7] = vsubq_s32(p0, b0);
+}
+
+static inline void transpose4x4(int32x4_t &r0, int32x4_t &r1, int32x4_t &r2, int32x4_t &r3) {
+	const int32x4x2_t t01 = vtrnq_s32(r0, r1);
+	const int32x4x2_t t23 = vtrnq_s32(r2, r3);
+	r0 = vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0]));
+	r1 = vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1]));
+	r2 = vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0]));
+	r3 = vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1]));
+}
+
+// Full 8x8 IDCT including the row-pass rounding ((x + 0x7F) >> 8). The
+// result is row-major: lo[i]/hi[i] hold the left/right half of row i.
+// The scalar zero-column shortcut is skipped; with every column computed
+// in two vector transforms it no longer pays for the branch, and the
+// transform of an all-zero column yields the same values.
+static inline void idct8x8(const int32 *block, int32x4_t *lo, int32x4_t *hi) {
+	for (int i = 0; i < 8; i++) {
+		lo[i] = vld1q_s32(block + i * 8);
+		hi[i] = vld1q_s32(block + i * 8 + 4);
+	}
+
+	// Column pass: lanes are columns, one vector per row.
+	idct8(lo);
+	idct8(hi);
+
+	// Transpose so the row pass can reuse the same vertical transform.
+	transpose4x4(lo[0], lo[1], lo[2], lo[3]);
+	transpose4x4(hi[0], hi[1], hi[2], hi[3]);
+	transpose4x4(lo[4], lo[5], lo[6], lo[7]);
+	transpose4x4(hi[4], hi[5], hi[6], hi[7]);
+
+	int32x4_t top[8] = { lo[0], lo[1], lo[2], lo[3], hi[0], hi[1], hi[2], hi[3] }; // lanes: rows 0-3
+	int32x4_t bot[8] = { lo[4], lo[5], lo[6], lo[7], hi[4], hi[5], hi[6], hi[7] }; // lanes: rows 4-7
+
+	idct8(top);
+	idct8(bot);
+
+	const int32x4_t round = vdupq_n_s32(0x7F);
+	for (int i = 0; i < 8; i++) {
+		top[i] = vshrq_n_s32(vaddq_s32(top[i], round), 8);
+		bot[i] = vshrq_n_s32(vaddq_s32(bot[i], round), 8);
+	}
+
+	// Transpose back to row-major for the stores.
+	transpose4x4(top[0], top[1], top[2], top[3]);
+	transpose4x4(top[4], top[5], top[6], top[7]);
+	transpose4x4(bot[0], bot[1], bot[2], bot[3]);
+	transpose4x4(bot[4], bot[5], bot[6], bot[7]);
+
+	for (int i = 0; i < 4; i++) {
+		lo[i] = top[i];
+		hi[i] = top[i + 4];
+		lo[i + 4] = bot[i];
+		hi[i + 4] = bot[i + 4];
+	}
+}
+
+// Truncate eight int32 row values to bytes, like the scalar assignment to
+// a byte destination does.
+static inline uint8x8_t rowToBytes(int32x4_t lo, int32x4_t hi) {
+	const int16x8_t w = vcombine_s16(vmovn_s32(lo), vmovn_s32(hi));
+	return vreinterpret_u8_s8(vmovn_s16(w));
+}
+
+void binkIDCTPutNEON(byte *dest, uint32 pitch, const int32 *block) {
+	int32x4_t lo[8], hi[8];
+	idct8x8(block, lo, hi);
+
+	for (int i = 0; i < 8; i++, dest += pitch)
+		vst1_u8(dest, rowToBytes(lo[i], hi[i]));
+}
+
+void binkIDCTAddNEON(byte *dest, uint32 pitch, const int32 *block) {
+	int32x4_t lo[8], hi[8];
+	idct8x8(block, lo, hi);
+
+	for (int i = 0; i < 8; i++, dest += pitch)
+		vst1_u8(dest, vadd_u8(vld1_u8(dest), rowToBytes(lo[i], hi[i])));
+}
+
+// The residue add in blockResidue(): dest[j] += block[j] on bytes, which
+// wraps modulo 256, so only the low byte of each coefficient matters.
+void binkResidueAddNEON(byte *dest, uint32 pitch, const int16 *block) {
+	for (int i = 0; i < 8; i++, dest += pitch, block += 8) {
+		const uint8x8_t src = vreinterpret_u8_s8(vmovn_s16(vld1q_s16(block)));
+		vst1_u8(dest, vadd_u8(vld1_u8(dest), src));
+	}
+}
+
+} // End of namespace Video
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // defined(USE_BINK) && defined(SCUMMVM_NEON)
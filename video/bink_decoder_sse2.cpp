@@ -0,0 +1,203 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef USE_BINK
+
+#include "video/bink_decoder.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Video {
+
+// Constants of the scalar IDCT in bink_decoder.cpp
+#define A1  2896 /* (1/sqrt(2))<<12 */
+#define A2  2217
+#define A3  3784
+#define A4 -5352
+
+// Signed low 32 bits of a lane-wise multiplication by a constant. SSE2 has
+// no full 32-bit multiply; _mm_mul_epu32 only covers the even lanes, so the
+// odd lanes are shifted down and multiplied separately. The low 32 bits of
+// the product are the same for signed and unsigned operands.
+static inline __m128i mulConst(__m128i a, int32 b) {
+	const __m128i bv = _mm_set1_epi32(b);
+	const __m128i even = _mm_mul_epu32(a, bv);
+	const __m128i odd  = _mm_mul_epu32(_mm_srli_si128(a, 4), bv);
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+	                          _mm_shuffle_epi32(odd,  _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+// One 8-point Bink IDCT over v[0..7], computed on all four lanes at once.
+// Mirrors IDCT_TRANSFORM in bink_decoder.cpp without the munge step.
+static inline void idct8(__m128i *v) {
+	const __m128i a0 = _mm_add_epi32(v[0], v[4]);
+	const __m128i a1 = _mm_sub_epi32(v[0], v[4]);
+	const __m128i a2 = _mm_add_epi32(v[2], v[6]);
+	const __m128i a3 = _mm_srai_epi32(mulConst(_mm_sub_epi32(v[2], v[6]), A1), 11);
+	const __m128i a4 = _mm_add_epi32(v[5], v[3]);
+	const __m128i a5 = _mm_sub_epi32(v[5], v[3]);
+	const __m128i a6 = _mm_add_epi32(v[1], v[7]);
+	const __m128i a7 = _mm_sub_epi32(v[1], v[7]);
+
+	const __m128i b0 = _mm_add_epi32(a4, a6);
+	const __m128i b1 = _mm_srai_epi32(mulConst(_mm_add_epi32(a5, a7), A3), 11);
+	const __m128i b2 = _mm_add_epi32(_mm_sub_epi32(_mm_srai_epi32(mulConst(a5, A4), 11), b0), b1);
+	const __m128i b3 = _mm_sub_epi32(_mm_srai_epi32(mulConst(_mm_sub_epi32(a6, a4), A1), 11), b2);
+	const __m128i b4 = _mm_sub_epi32(_mm_add_epi32(_mm_srai_epi32(mulConst(a7, A2), 11), b3), b1);
+
+	const __m128i p0 = _mm_add_epi32(a0, a2); // a0+a2
+	const __m128i p1 = _mm_sub_epi32(a0, a2); // a0-a2
+	const __m128i p2 = _mm_sub_epi32(_mm_add_epi32(a1, a3), a2); // a1+a3-a2
+	const __m128i p3 = _mm_add_epi32(_mm_sub_epi32(a1, a3), a2); // a1-a3+a2
+
+	v[0] = _mm_add_epi32(p0, b0);
+	v[1] = _mm_add_epi32(p2, b2);
+	v[2] = _mm_add_epi32(p3, b3);
+	v[3] = _mm_sub_epi32(p1, b4);
+	v[4] = _mm_add_epi32(p1, b4);
+	v[5] = _mm_sub_epi32(p3, b3);
+	v[6] = _mm_sub_epi32(p2, b2);
+	v[7] = _mm_sub_epi32(p0, b0);
+}
+
+static inline void transpose4x4(__m128i &r0, __m128i &r1, __m128i &r2, __m128i &r3) {
+	const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+	const __m128i t1 = _mm_unpackhi_epi32(r0, r1);
+	const __m128i t2 = _mm_unpacklo_epi32(r2, r3);
+	const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+	r0 = _mm_unpacklo_epi64(t0, t2);
+	r1 = _mm_unpackhi_epi64(t0, t2);
+	r2 = _mm_unpacklo_epi64(t1, t3);
+	r3 = _mm_unpackhi_epi64(t1, t3);
+}
+
+// Full 8x8 IDCT including the row-pass rounding ((x + 0x7F) >> 8). The
+// result is row-major: lo[i]/hi[i] hold the left/right half of row i.
+// The scalar zero-column shortcut is skipped; with every column computed
+// in two vector transforms it no longer pays for the branch, and the
+// transform of an all-zero column yields the same values.
+static inline void idct8x8(const int32 *block, __m128i *lo, __m128i *hi) {
+	for (int i = 0; i < 8; i++) {
+		lo[i] = _mm_loadu_si128((const __m128i *)(block + i * 8));
+		hi[i] = _mm_loadu_si128((const __m128i *)(block + i * 8 + 4));
+	}
+
+	// Column pass: lanes are columns, one vector per row.
+	idct8(lo);
+	idct8(hi);
+
+	// Transpose so the row pass can reuse the same vertical transform.
+	transpose4x4(lo[0], lo[1], lo[2], lo[3]);
+	transpose4x4(hi[0], hi[1], hi[2], hi[3]);
+	transpose4x4(lo[4], lo[5], lo[6], lo[7]);
+	transpose4x4(hi[4], hi[5], hi[6], hi[7]);
+
+	__m128i top[8] = { lo[0], lo[1], lo[2], lo[3], hi[0], hi[1], hi[2], hi[3] }; // lanes: rows 0-3
+	__m128i bot[8] = { lo[4], lo[5], lo[6], lo[7], hi[4], hi[5], hi[6], hi[7] }; // lanes: rows 4-7
+
+	idct8(top);
+	idct8(bot);
+
+	const __m128i round = _mm_set1_epi32(0x7F);
+	for (int i = 0; i < 8; i++) {
+		top[i] = _mm_srai_epi32(_mm_add_epi32(top[i], round), 8);
+		bot[i] = _mm_srai_epi32(_mm_add_epi32(bot[i], round), 8);
+	}
+
+	// Transpose back to row-major for the stores.
+	transpose4x4(top[0], top[1], top[2], top[3]);
+	transpose4x4(top[4], top[5], top[6], top[7]);
+	transpose4x4(bot[0], bot[1], bot[2], bot[3]);
+	transpose4x4(bot[4], bot[5], bot[6], bot[7]);
+
+	for (int i = 0; i < 4; i++) {
+		lo[i] = top[i];
+		hi[i] = top[i + 4];
+		lo[i + 4] = bot[i];
+		hi[i + 4] = bot[i + 4];
+	}
+}
+
+// Truncate eight int32 row values to bytes, like the scalar assignment to
+// a byte destination does. Masking to the low byte first keeps the
+// saturating packs exact.
+static inline __m128i rowToBytes(__m128i lo, __m128i hi) {
+	const __m128i byteMask = _mm_set1_epi32(0xFF);
+	const __m128i w = _mm_packs_epi32(_mm_and_si128(lo, byteMask), _mm_and_si128(hi, byteMask));
+	return _mm_packus_epi16(w, w);
+}
+
+void binkIDCTPutSSE2(byte *dest, uint32 pitch, const int32 *block) {
+	__m128i lo[8], hi[8];
+	idct8x8(block, lo, hi);
+
+	for (int i = 0; i < 8; i++, dest += pitch)
+		_mm_storel_epi64((__m128i *)dest, rowToBytes(lo[i], hi[i]));
+}
+
+void binkIDCTAddSSE2(byte *dest, uint32 pitch, const int32 *block) {
+	__m128i lo[8], hi[8];
+	idct8x8(block, lo, hi);
+
+	for (int i = 0; i < 8; i++, dest += pitch) {
+		const __m128i dst = _mm_loadl_epi64((const __m128i *)dest);
+		_mm_storel_epi64((__m128i *)dest, _mm_add_epi8(dst, rowToBytes(lo[i], hi[i])));
+	}
+}
+
+// The residue add in blockResidue(): dest[j] += block[j] on bytes, which
+// wraps modulo 256, so only the low byte of each coefficient matters.
+void binkResidueAddSSE2(byte *dest, uint32 pitch, const int16 *block) {
+	const __m128i byteMask = _mm_set1_epi16(0xFF);
+
+	for (int i = 0; i < 8; i++, dest += pitch, block += 8) {
+		const __m128i src = _mm_and_si128(_mm_loadu_si128((const __m128i *)block), byteMask);
+		const __m128i dst = _mm_loadl_epi64((const __m128i *)dest);
+		_mm_storel_epi64((__m128i *)dest, _mm_add_epi8(dst, _mm_packus_epi16(src, src)));
+	}
+}
+
+} // End of namespace Video
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // USE_BINK
@@ -508,6 +508,18 @@ void HNMDecoder::HNM4VideoTrack::decodeInterframe(byte *data, uint32 size) {
 
 			int src_inc = backward ? -2 : 2;
 
+			// The most common block is a plain forward copy. When it can't
+			// self-overlap it is a single contiguous run, so copy it in one
+			// go instead of pixel pair by pixel pair.
+			if (!backward && !backline && !swap) {
+				uint32 len = count * 2;
+				if (previous || (uint32)offset + len <= currentPos) {
+					memcpy(&_frameBufferC[currentPos], &ptr[offset], len);
+					currentPos += len;
+					continue;
+				}
+			}
+
 			while (count--) {
 				byte b0 = ptr[offset + shft1];
 				byte b1 = ptr[offset + shft2];
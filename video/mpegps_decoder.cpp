@@ -584,18 +584,34 @@ int MPEGPSDecoder::MPEGPSDemuxer::findNextStartCode(uint32 &size) {
 	size = MAX_SYNC_SIZE;
 	int32 state = 0xFF;
 
+	// Scan buffered chunks rather than issuing one stream call per byte;
+	// this loop walks every byte of the file between packet headers.
+	byte buf[2048];
+
 	while (size > 0) {
-		byte v = _stream->readByte();
+		uint32 chunk = MIN<uint32>(size, sizeof(buf));
+		uint32 n = _stream->read(buf, chunk);
 
-		if (_stream->eos())
+		if (n == 0)
 			return -1;
 
-		size--;
+		for (uint32 i = 0; i < n; i++) {
+			byte v = buf[i];
 
-		if (state == 0x1)
-			return ((state << 8) | v) & 0xFFFFFF;
+			if (state == 0x1) {
+				// Seek back over the bytes read beyond the start code
+				_stream->seek(-(int64)(n - i - 1), SEEK_CUR);
+				size -= i + 1;
+				return ((state << 8) | v) & 0xFFFFFF;
+			}
 
-		state = ((state << 8) | v) & 0xFFFFFF;
+			state = ((state << 8) | v) & 0xFFFFFF;
+		}
+
+		size -= n;
+
+		if (n < chunk)
+			return -1;
 	}
 
 	return -1;
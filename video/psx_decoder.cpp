@@ -554,15 +554,18 @@ int PSXStreamDecoder::PSXVideoTrack::readSignedCoefficient(Common::BitStreamMemo
 // IDCT table built with :
 // _idct8x8[x][y] = cos(((2 * x + 1) * y) * (M_PI / 16.0)) * 0.5;
 // _idct8x8[x][y] /= sqrt(2.0) if y == 0
-static const double s_idct8x8[8][8] = {
-	{ 0.353553390593274,  0.490392640201615,  0.461939766255643,  0.415734806151273,  0.353553390593274,  0.277785116509801,  0.191341716182545,  0.097545161008064 },
-	{ 0.353553390593274,  0.415734806151273,  0.191341716182545, -0.097545161008064, -0.353553390593274, -0.490392640201615, -0.461939766255643, -0.277785116509801 },
-	{ 0.353553390593274,  0.277785116509801, -0.191341716182545, -0.490392640201615, -0.353553390593274,  0.097545161008064,  0.461939766255643,  0.415734806151273 },
-	{ 0.353553390593274,  0.097545161008064, -0.461939766255643, -0.277785116509801,  0.353553390593274,  0.415734806151273, -0.191341716182545, -0.490392640201615 },
-	{ 0.353553390593274, -0.097545161008064, -0.461939766255643,  0.277785116509801,  0.353553390593274, -0.415734806151273, -0.191341716182545,  0.490392640201615 },
-	{ 0.353553390593274, -0.277785116509801, -0.191341716182545,  0.490392640201615, -0.353553390593273, -0.097545161008064,  0.461939766255643, -0.415734806151273 },
-	{ 0.353553390593274, -0.415734806151273,  0.191341716182545,  0.097545161008064, -0.353553390593274,  0.490392640201615, -0.461939766255643,  0.277785116509801 },
-	{ 0.353553390593274, -0.490392640201615,  0.461939766255643, -0.415734806151273,  0.353553390593273, -0.277785116509801,  0.191341716182545, -0.097545161008064 }
+// The table is kept in single precision: the data being transformed is
+// float, and a double table would silently promote every multiply in the
+// inner loops to double.
+static const float s_idct8x8[8][8] = {
+	{ 0.353553390593274f,  0.490392640201615f,  0.461939766255643f,  0.415734806151273f,  0.353553390593274f,  0.277785116509801f,  0.191341716182545f,  0.097545161008064f },
+	{ 0.353553390593274f,  0.415734806151273f,  0.191341716182545f, -0.097545161008064f, -0.353553390593274f, -0.490392640201615f, -0.461939766255643f, -0.277785116509801f },
+	{ 0.353553390593274f,  0.277785116509801f, -0.191341716182545f, -0.490392640201615f, -0.353553390593274f,  0.097545161008064f,  0.461939766255643f,  0.415734806151273f },
+	{ 0.353553390593274f,  0.097545161008064f, -0.461939766255643f, -0.277785116509801f,  0.353553390593274f,  0.415734806151273f, -0.191341716182545f, -0.490392640201615f },
+	{ 0.353553390593274f, -0.097545161008064f, -0.461939766255643f,  0.277785116509801f,  0.353553390593274f, -0.415734806151273f, -0.191341716182545f,  0.490392640201615f },
+	{ 0.353553390593274f, -0.277785116509801f, -0.191341716182545f,  0.490392640201615f, -0.353553390593273f, -0.097545161008064f,  0.461939766255643f, -0.415734806151273f },
+	{ 0.353553390593274f, -0.415734806151273f,  0.191341716182545f,  0.097545161008064f, -0.353553390593274f,  0.490392640201615f, -0.461939766255643f,  0.277785116509801f },
+	{ 0.353553390593274f, -0.490392640201615f,  0.461939766255643f, -0.415734806151273f,  0.353553390593273f, -0.277785116509801f,  0.191341716182545f, -0.097545161008064f }
 };
 
 void PSXStreamDecoder::PSXVideoTrack::idct(float *dequantData, float *result) {
@@ -574,6 +577,18 @@ void PSXStreamDecoder::PSXVideoTrack::idct(float *dequantData, float *result) {
 
 	// Apply 1D IDCT to rows
 	for (int y = 0; y < 8; y++) {
+		// Most blocks carry only a handful of low-frequency coefficients,
+		// so rows past the first few are usually all zero and contribute
+		// nothing to the columns pass.
+		if (dequantData[0] == 0.0f && dequantData[1] == 0.0f && dequantData[2] == 0.0f && dequantData[3] == 0.0f &&
+				dequantData[4] == 0.0f && dequantData[5] == 0.0f && dequantData[6] == 0.0f && dequantData[7] == 0.0f) {
+			for (int x = 0; x < 8; x++)
+				tmp[y + x * 8] = 0.0f;
+
+			dequantData += 8;
+			continue;
+		}
+
 		for (int x = 0; x < 8; x++) {
 			tmp[y + x * 8] = dequantData[0] * s_idct8x8[x][0]
 							+ dequantData[1] * s_idct8x8[x][1]
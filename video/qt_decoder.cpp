@@ -344,6 +344,9 @@ QuickTimeDecoder::VideoTrackHandler::VideoTrackHandler(QuickTimeDecoder *decoder
 	_curPalette = 0;
 	_dirtyPalette = false;
 	_reversed = false;
+	buildSampleMap();
+	_packetBuffer = nullptr;
+	_packetBufferCapacity = 0;
 }
 
 // FIXME: This check breaks valid QuickTime movies, such as the KQ6 Mac opening.
@@ -388,6 +391,8 @@ QuickTimeDecoder::VideoTrackHandler::~VideoTrackHandler() {
 		_scaledSurface->free();
 		delete _scaledSurface;
 	}
+
+	free(_packetBuffer);
 }
 
 bool QuickTimeDecoder::VideoTrackHandler::endOfTrack() const {
@@ -697,49 +702,65 @@ Common::Rational QuickTimeDecoder::VideoTrackHandler::getScaledHeight() const {
 	return Common::Rational(_parent->height) / _parent->scaleFactorY;
 }
 
-Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePacket(uint32 &descId) {
-	// First, we have to track down which chunk holds the sample and which sample in the chunk contains the frame we are looking for.
-	int32 totalSampleCount = 0;
-	int32 sampleInChunk = 0;
-	int32 actualChunk = -1;
+void QuickTimeDecoder::VideoTrackHandler::buildSampleMap() {
+	// Flatten the sample-to-chunk and sample size tables into one file
+	// offset per frame. Walking the chunk tables per frame made every
+	// backwards seek rescan them from the start of the movie.
 	uint32 sampleToChunkIndex = 0;
+	uint32 frame = 0;
 
-	for (uint32 i = 0; i < _parent->chunkCount; i++) {
+	_sampleOffsets.resize(_parent->frameCount);
+	_sampleDescIds.resize(_parent->frameCount);
+
+	for (uint32 i = 0; i < _parent->chunkCount && frame < _parent->frameCount; i++) {
 		if (sampleToChunkIndex < _parent->sampleToChunkCount && i >= _parent->sampleToChunk[sampleToChunkIndex].first)
 			sampleToChunkIndex++;
 
-		totalSampleCount += _parent->sampleToChunk[sampleToChunkIndex - 1].count;
+		const SampleToChunkEntry &entry = _parent->sampleToChunk[sampleToChunkIndex - 1];
+		uint32 offset = _parent->chunkOffsets[i];
 
-		if (totalSampleCount > _curFrame) {
-			actualChunk = i;
-			descId = _parent->sampleToChunk[sampleToChunkIndex - 1].id;
-			sampleInChunk = _parent->sampleToChunk[sampleToChunkIndex - 1].count - totalSampleCount + _curFrame;
-			break;
+		for (uint32 j = 0; j < entry.count && frame < _parent->frameCount; j++) {
+			_sampleOffsets[frame] = offset;
+			_sampleDescIds[frame] = entry.id;
+			offset += (_parent->sampleSize != 0) ? _parent->sampleSize : _parent->sampleSizes[frame];
+			frame++;
 		}
 	}
 
-	if (actualChunk < 0)
+	// Leave frames the chunk tables do not cover out of the map, so
+	// requesting one of them errors out like the table walk used to
+	_sampleOffsets.resize(frame);
+	_sampleDescIds.resize(frame);
+}
+
+Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePacket(uint32 &descId) {
+	if (_curFrame < 0 || (uint32)_curFrame >= _sampleOffsets.size())
 		error("Could not find data for frame %d", _curFrame);
 
-	// Next seek to that frame
-	Common::SeekableReadStream *stream = _decoder->_fd;
-	stream->seek(_parent->chunkOffsets[actualChunk]);
+	descId = _sampleDescIds[_curFrame];
 
-	// Then, if the chunk holds more than one frame, seek to where the frame we want is located
-	for (int32 i = _curFrame - sampleInChunk; i < _curFrame; i++) {
-		if (_parent->sampleSize != 0)
-			stream->skip(_parent->sampleSize);
-		else
-			stream->skip(_parent->sampleSizes[i]);
-	}
+	// Seek directly to the frame
+	Common::SeekableReadStream *stream = _decoder->_fd;
+	stream->seek(_sampleOffsets[_curFrame]);
 
 	// Finally, read in the raw data for the frame
 	//debug("Frame Data[%d]: Offset = %d, Size = %d", _curFrame, stream->pos(), _parent->sampleSizes[_curFrame]);
 
-	if (_parent->sampleSize != 0)
-		return stream->readStream(_parent->sampleSize);
+	uint32 frameSize = (_parent->sampleSize != 0) ? _parent->sampleSize : _parent->sampleSizes[_curFrame];
+
+	// Read the packet into a buffer reused across frames; allocating a
+	// fresh buffer per frame caused constant heap churn, in particular
+	// when several decoders play short ambient loops at once.
+	if (frameSize > _packetBufferCapacity) {
+		free(_packetBuffer);
+		_packetBuffer = (byte *)malloc(frameSize);
+		_packetBufferCapacity = frameSize;
+	}
+
+	if (!_packetBuffer || stream->read(_packetBuffer, frameSize) != frameSize)
+		return nullptr;
 
-	return stream->readStream(_parent->sampleSizes[_curFrame]);
+	return new Common::MemoryReadStream(_packetBuffer, frameSize, DisposeAfterUse::NO);
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::getCurFrameDuration() {
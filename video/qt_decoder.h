@@ -369,6 +369,19 @@ private:
 		mutable bool _dirtyPalette;
 		bool _reversed;
 
+		// Per-frame file offsets and sample description ids, flattened
+		// once from the chunk tables. Any frame can then be located in
+		// constant time, no matter which direction a seek went; engines
+		// like Pegasus hop backwards constantly to replay movie segments.
+		Common::Array<uint32> _sampleOffsets;
+		Common::Array<uint32> _sampleDescIds;
+
+		// Grow-only buffer the compressed frame packets are read into,
+		// so sequential decoding does not allocate per frame.
+		byte *_packetBuffer;
+		uint32 _packetBufferCapacity;
+
+		void buildSampleMap();
 		Common::SeekableReadStream *getNextFramePacket(uint32 &descId);
 		uint32 getCurFrameDuration();            // media time
 		uint32 findKeyFrame(uint32 frame) const;
@@ -166,14 +166,23 @@ private:
 		SMK_NODE = 0x80000000
 	};
 
+	// The prefix look-up resolves all codes up to this many bits in a single
+	// peek. The big trees carry 16-bit pixel pairs and easily grow deeper
+	// than 8 bits, so they get a wider table than the small trees; it is
+	// only built once per video.
+	enum {
+		kPrefixBits = 12,
+		kPrefixCount = 1 << kPrefixBits
+	};
+
 	uint32 decodeTree(uint32 prefix, int length);
 
 	uint32  _treeSize;
 	uint32 *_tree;
 	uint32  _last[3];
 
-	uint32 _prefixtree[256];
-	byte _prefixlength[256];
+	uint32 _prefixtree[kPrefixCount];
+	byte _prefixlength[kPrefixCount];
 
 	/* Used during construction */
 	SmackerBitStream &_bs;
@@ -189,10 +198,15 @@ BigHuffmanTree::BigHuffmanTree(SmackerBitStream &bs, int allocSize)
 		_tree = new uint32[1];
 		_tree[0] = 0;
 		_last[0] = _last[1] = _last[2] = 0;
+
+		// Make getCode() resolve to the one empty leaf without consuming
+		// any bits.
+		for (uint32 i = 0; i < kPrefixCount; ++i)
+			_prefixtree[i] = _prefixlength[i] = 0;
 		return;
 	}
 
-	for (uint32 i = 0; i < 256; ++i)
+	for (uint32 i = 0; i < kPrefixCount; ++i)
 		_prefixtree[i] = _prefixlength[i] = 0;
 
 	_loBytes = new SmallHuffmanTree(_bs);
@@ -239,8 +253,8 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 
 		_tree[_treeSize] = v;
 
-		if (length <= 8) {
-			for (int i = 0; i < 256; i += (1 << length)) {
+		if (length <= kPrefixBits) {
+			for (int i = 0; i < kPrefixCount; i += (1 << length)) {
 				_prefixtree[prefix | i] = _treeSize;
 				_prefixlength[prefix | i] = length;
 			}
@@ -259,9 +273,9 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 
 	uint32 t = _treeSize++;
 
-	if (length == 8) {
+	if (length == kPrefixBits) {
 		_prefixtree[prefix] = t;
-		_prefixlength[prefix] = 8;
+		_prefixlength[prefix] = kPrefixBits;
 	}
 
 	uint32 r1 = decodeTree(prefix, length + 1);
@@ -276,7 +290,7 @@ uint32 BigHuffmanTree::getCode(SmackerBitStream &bs) {
 	// Peeking data out of bounds is well-defined and returns 0 bits.
 	// This is for convenience when using speed-up techniques reading
 	// more bits than actually available.
-	byte peek = bs.peekBits<8>();
+	uint32 peek = bs.peekBits<kPrefixBits>();
 	uint32 *p = &_tree[_prefixtree[peek]];
 	bs.skip(_prefixlength[peek]);
 
@@ -657,6 +671,14 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 	uint stride = getWidth();
 	uint block = 0, blocks = bw*bh;
 
+	// Walk the blocks in raster order with an incrementally advanced output
+	// pointer instead of dividing the block index back into coordinates for
+	// every block of a run.
+	byte *const pixels = (byte *)_surface->getPixels();
+	const uint rowPitch = stride * 4 * doubleY;
+	byte *rowStart = pixels;
+	uint col = 0;
+
 	byte *out;
 	uint type, run, j, mode;
 	uint32 p1, p2, clr, map;
@@ -672,7 +694,7 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 			while (run-- && block < blocks) {
 				clr = _MClrTree->getCode(bs);
 				map = _MMapTree->getCode(bs);
-				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
+				out = rowStart + col * 4;
 				hi = clr >> 8;
 				lo = clr & 0xff;
 				for (i = 0; i < 4; i++) {
@@ -687,6 +709,10 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 				}
 				_dirtyBlocks.set(block);
 				++block;
+				if (++col == bw) {
+					col = 0;
+					rowStart += rowPitch;
+				}
 			}
 			break;
 		case SMK_BLOCK_FULL:
@@ -706,7 +732,7 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 			}
 
 			while (run-- && block < blocks) {
-				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
+				out = rowStart + col * 4;
 				switch (mode) {
 					case 0:
 						for (i = 0; i < 4; ++i) {
@@ -765,24 +791,37 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 				}
 				_dirtyBlocks.set(block);
 				++block;
+				if (++col == bw) {
+					col = 0;
+					rowStart += rowPitch;
+				}
 			}
 			break;
 		case SMK_BLOCK_SKIP:
-			while (run-- && block < blocks)
+			while (run-- && block < blocks) {
 				block++;
+				if (++col == bw) {
+					col = 0;
+					rowStart += rowPitch;
+				}
+			}
 			break;
 		case SMK_BLOCK_FILL:
-			uint32 col;
+			uint32 fill;
 			mode = type >> 8;
 			while (run-- && block < blocks) {
-				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
-				col = mode * 0x01010101;
+				out = rowStart + col * 4;
+				fill = mode * 0x01010101;
 				for (i = 0; i < 4 * doubleY; ++i) {
-					out[0] = out[1] = out[2] = out[3] = col;
+					out[0] = out[1] = out[2] = out[3] = fill;
 					out += stride;
 				}
 				_dirtyBlocks.set(block);
 				++block;
+				if (++col == bw) {
+					col = 0;
+					rowStart += rowPitch;
+				}
 			}
 			break;
 		default:
@@ -916,28 +955,47 @@ void SmackerDecoder::SmackerAudioTrack::queueCompressedBuffer(byte *buffer, uint
 	// are stored as little endian
 	// We store the unpacked bytes in big endian format
 
-	while (curPos < unpackedSize) {
-		// If the sample is stereo, the data is stored for the left and right channel, respectively
-		// (the exact opposite to the base values)
-		if (!is16Bits) {
-			for (int k = 0; k < (isStereo ? 2 : 1); k++) {
+	// If the sample is stereo, the data is stored for the left and right channel, respectively
+	// (the exact opposite to the base values). The layout cannot change within a chunk, so
+	// pick the matching unpack loop once up front instead of re-deciding it per sample.
+	if (!is16Bits && !isStereo) {
+		while (curPos < unpackedSize) {
+			int8 delta = (int8) ((int16) audioTrees[0]->getCode(audioBS));
+			bases[0] = (bases[0] + delta) & 0xFF;
+			*curPointer++ = bases[0] ^ 0x80;
+			curPos++;
+		}
+	} else if (!is16Bits) {
+		while (curPos < unpackedSize) {
+			for (int k = 0; k < 2; k++) {
 				int8 delta = (int8) ((int16) audioTrees[k]->getCode(audioBS));
 				bases[k] = (bases[k] + delta) & 0xFF;
 				*curPointer++ = bases[k] ^ 0x80;
-				curPos++;
 			}
-		} else {
-			for (int k = 0; k < (isStereo ? 2 : 1); k++) {
+			curPos += 2;
+		}
+	} else if (!isStereo) {
+		while (curPos < unpackedSize) {
+			byte lo = audioTrees[0]->getCode(audioBS);
+			byte hi = audioTrees[1]->getCode(audioBS);
+			bases[0] += (int16) (lo | (hi << 8));
+
+			WRITE_BE_UINT16(curPointer, bases[0]);
+			curPointer += 2;
+			curPos += 2;
+		}
+	} else {
+		while (curPos < unpackedSize) {
+			for (int k = 0; k < 2; k++) {
 				byte lo = audioTrees[k * 2]->getCode(audioBS);
 				byte hi = audioTrees[k * 2 + 1]->getCode(audioBS);
 				bases[k] += (int16) (lo | (hi << 8));
 
 				WRITE_BE_UINT16(curPointer, bases[k]);
 				curPointer += 2;
-				curPos += 2;
 			}
+			curPos += 4;
 		}
-
 	}
 
 	for (int k = 0; k < numBytes; k++)
@@ -231,7 +231,7 @@ Common::String SRTParser::getSubtitle(uint32 timestamp) const {
 #define SHADOW 1
 
 Subtitles::Subtitles() : _loaded(false), _font(nullptr), _hPad(0), _vPad(0), _overlayHasAlpha(true),
-	_lastOverlayWidth(-1), _lastOverlayHeight(-1) {
+	_lastOverlayWidth(-1), _lastOverlayHeight(-1), _surfaceStale(true) {
 	_surface = new Graphics::Surface();
 	_subtitleDev = ConfMan.getBool("subtitle_dev");
 }
@@ -269,6 +269,7 @@ void Subtitles::setFont(const char *fontname, int height) {
 		_font = FontMan.getFontByUsage(Graphics::FontManager::kBigGUIFont);
 	}
 
+	_surfaceStale = true;
 }
 
 void Subtitles::loadSRTFile(const Common::Path &fname) {
@@ -289,17 +290,20 @@ void Subtitles::setBBox(const Common::Rect &bbox) {
 	// Force recalculation of real bounding box
 	_lastOverlayWidth = -1;
 	_lastOverlayHeight = -1;
+	_surfaceStale = true;
 }
 
 void Subtitles::setColor(byte r, byte g, byte b) {
 	_color = _surface->format.ARGBToColor(255, r, g, b);
 	_blackColor = _surface->format.ARGBToColor(255, 0, 0, 0);
 	_transparentColor = _surface->format.ARGBToColor(0, 0, 0, 0);
+	_surfaceStale = true;
 }
 
 void Subtitles::setPadding(uint16 horizontal, uint16 vertical) {
 	_hPad = horizontal;
 	_vPad = vertical;
+	_surfaceStale = true;
 }
 
 bool Subtitles::drawSubtitle(uint32 timestamp, bool force) const {
@@ -351,16 +355,20 @@ bool Subtitles::drawSubtitle(uint32 timestamp, bool force) const {
 		}
 
 		force = true;
+		_surfaceStale = true;
 	}
 
-	if (!force && _overlayHasAlpha && subtitle == _subtitle)
+	if (!force && _overlayHasAlpha && !_surfaceStale && subtitle == _subtitle)
 		return false;
 
-	if (force || subtitle != _subtitle) {
+	// A forced draw of an unchanged cue only needs the blit below; the
+	// rendered surface stays valid until the text or the style changes.
+	if (_surfaceStale || subtitle != _subtitle) {
 		debug(1, "%d: %s", timestamp, subtitle.c_str());
 
 		_subtitle = subtitle;
 		renderSubtitle();
+		_surfaceStale = false;
 	}
 
 	if (_overlayHasAlpha) {
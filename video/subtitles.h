@@ -64,7 +64,7 @@ public:
 	~Subtitles();
 
 	void loadSRTFile(const Common::Path &fname);
-	void close() { _loaded = false; _subtitle.clear(); _fname.clear(); _srtParser.cleanup(); }
+	void close() { _loaded = false; _subtitle.clear(); _fname.clear(); _srtParser.cleanup(); _surfaceStale = true; }
 	void setFont(const char *fontname, int height = 18);
 	void setBBox(const Common::Rect &bbox);
 	void setColor(byte r, byte g, byte b);
@@ -92,6 +92,10 @@ private:
 
 	Common::Path _fname;
 	mutable Common::String _subtitle;
+	// Whether _surface no longer matches _subtitle and the current style,
+	// and must be re-rendered before the next blit. Kept so forced redraws
+	// of a static cue only cost the overlay copy, not a full re-render.
+	mutable bool _surfaceStale;
 	uint32 _color;
 	uint32 _blackColor;
 	uint32 _transparentColor;
@@ -33,6 +33,10 @@
  *
  */
 
+// pthread.h pulls in time.h, which the forbidden symbol mechanism would
+// otherwise reject.
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
 #include "video/theora_decoder.h"
 
 #include "audio/audiostream.h"
@@ -45,6 +49,14 @@
 #include "graphics/yuv_to_rgb.h"
 #include "image/codecs/codec.h"
 
+// The pipelined decode mode needs a worker thread, and OSystem has no
+// portable thread API, so it is limited to POSIX platforms for now.
+// Everywhere else the decoder keeps working synchronously.
+#if defined(POSIX)
+#define THEORA_USE_PTHREADS
+#include <pthread.h>
+#endif
+
 namespace Video {
 
 TheoraDecoder::TheoraDecoder() {
@@ -231,7 +243,11 @@ void TheoraDecoder::readNextPacket() {
 				if (_videoTrack->decodePacket(_oggPacket))
 					break;
 			} else if (_theoraOut.e_o_s || _fileStream->eos()) {
-				// If we can't get any more frames, we're done.
+				// No more packets. Present the frame still sitting in the
+				// decode pipeline first; only when that is drained too are
+				// we really done.
+				if (_videoTrack->finishPendingFrame())
+					break;
 				_videoTrack->setEndOfVideo();
 			} else {
 				// Queue more data
@@ -282,50 +298,86 @@ TheoraDecoder::TheoraVideoTrack::TheoraVideoTrack(th_info &theoraInfo, th_setup_
 	_endOfVideo = false;
 	_nextFrameStartTime = 0.0;
 	_curFrame = -1;
-	_surface = nullptr;
+	_frameBuffer[0] = _frameBuffer[1] = nullptr;
+	_displayBuffer[0] = _displayBuffer[1] = nullptr;
+	_backBuffer = 0;
 	_displaySurface = nullptr;
+	_pipeline = nullptr;
+
+	startWorker();
 }
 
 TheoraDecoder::TheoraVideoTrack::~TheoraVideoTrack() {
+	stopWorker();
+
 	th_decode_free(_theoraDecode);
 
-	if (_surface) {
-		_surface->free();
-		delete _surface;
-		_surface = nullptr;
-	}
+	for (uint i = 0; i < 2; ++i) {
+		if (_frameBuffer[i]) {
+			_frameBuffer[i]->free();
+			delete _frameBuffer[i];
+			_frameBuffer[i] = nullptr;
+		}
 
-	if (_displaySurface) {
-		_displaySurface->setPixels(0);
-		delete _displaySurface;
-		_displaySurface = nullptr;
+		if (_displayBuffer[i]) {
+			_displayBuffer[i]->setPixels(0);
+			delete _displayBuffer[i];
+			_displayBuffer[i] = nullptr;
+		}
 	}
+
+	_displaySurface = nullptr;
 }
 
 bool TheoraDecoder::TheoraVideoTrack::decodePacket(ogg_packet &oggPacket) {
-	if (th_decode_packetin(_theoraDecode, &oggPacket, 0) == 0) {
-		_curFrame++;
+#ifdef THEORA_USE_PTHREADS
+	if (_pipeline) {
+		// Present the frame the worker prepared from the previous packet,
+		// then hand it this one. Decoding and converting the new frame thus
+		// overlaps with the caller displaying the presented one and
+		// sleeping off the frame delay.
+		bool presented = finishPendingFrame();
+		submitPacket(oggPacket);
+		return presented;
+	}
+#endif
 
-		// Convert YUV data to RGB data
-		th_ycbcr_buffer yuv;
-		th_decode_ycbcr_out(_theoraDecode, yuv);
-		translateYUVtoRGBA(yuv);
+	double granuleTime;
+	if (!processPacket(oggPacket, granuleTime))
+		return false;
 
-		double time = th_granule_time(_theoraDecode, oggPacket.granulepos);
+	presentFrame(granuleTime);
+	return true;
+}
 
-		// We need to calculate when the next frame should be shown
-		// This is all in floating point because that's what the Ogg code gives us
-		// Ogg is a lossy container format, so it doesn't always list the time to the
-		// next frame. In such cases, we need to calculate it ourselves.
-		if (time == -1.0)
-			_nextFrameStartTime += _frameRate.getInverse().toDouble();
-		else
-			_nextFrameStartTime = time;
+bool TheoraDecoder::TheoraVideoTrack::processPacket(ogg_packet &oggPacket, double &granuleTime) {
+	if (th_decode_packetin(_theoraDecode, &oggPacket, 0) != 0)
+		return false;
 
-		return true;
-	}
+	// Convert YUV data to RGB data
+	th_ycbcr_buffer yuv;
+	th_decode_ycbcr_out(_theoraDecode, yuv);
+	translateYUVtoRGBA(yuv);
 
-	return false;
+	granuleTime = th_granule_time(_theoraDecode, oggPacket.granulepos);
+	return true;
+}
+
+void TheoraDecoder::TheoraVideoTrack::presentFrame(double granuleTime) {
+	_curFrame++;
+
+	// We need to calculate when the next frame should be shown
+	// This is all in floating point because that's what the Ogg code gives us
+	// Ogg is a lossy container format, so it doesn't always list the time to the
+	// next frame. In such cases, we need to calculate it ourselves.
+	if (granuleTime == -1.0)
+		_nextFrameStartTime += _frameRate.getInverse().toDouble();
+	else
+		_nextFrameStartTime = granuleTime;
+
+	// The buffer that was just filled becomes the visible one.
+	_displaySurface = _displayBuffer[_backBuffer];
+	_backBuffer ^= 1;
 }
 
 enum TheoraYUVBuffers {
@@ -334,6 +386,12 @@ enum TheoraYUVBuffers {
 	kBufferV = 2
 };
 
+#ifdef THEORA_USE_PTHREADS
+// The YUV converter keeps lazily built lookup tables in a singleton, so two
+// decode workers must not run a conversion at the same time.
+static pthread_mutex_t s_convertMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 void TheoraDecoder::TheoraVideoTrack::translateYUVtoRGBA(th_ycbcr_buffer &YUVBuffer) {
 	// Width and height of all buffers have to be divisible by 2.
 	assert((YUVBuffer[kBufferY].width & 1) == 0);
@@ -347,31 +405,212 @@ void TheoraDecoder::TheoraVideoTrack::translateYUVtoRGBA(th_ycbcr_buffer &YUVBuf
 	assert((YUVBuffer[kBufferU].height == YUVBuffer[kBufferY].height >> 1) || (YUVBuffer[kBufferU].height == YUVBuffer[kBufferY].height));
 	assert((YUVBuffer[kBufferV].height == YUVBuffer[kBufferY].height >> 1) || (YUVBuffer[kBufferV].height == YUVBuffer[kBufferY].height));
 
-	if (!_surface) {
-		_surface = new Graphics::Surface();
-		_surface->create(_surfaceWidth, _surfaceHeight, _pixelFormat);
+	// Convert into the back buffer; the front one may still be read by the
+	// client while this runs on the worker.
+	Graphics::Surface *surface = _frameBuffer[_backBuffer];
+	if (!surface) {
+		surface = new Graphics::Surface();
+		surface->create(_surfaceWidth, _surfaceHeight, _pixelFormat);
+		_frameBuffer[_backBuffer] = surface;
 	}
 
 	// Set up a display surface
-	if (!_displaySurface) {
-		_displaySurface = new Graphics::Surface();
-		_displaySurface->init(_width, _height, _surface->pitch,
-		                      _surface->getBasePtr(_x, _y), _surface->format);
+	if (!_displayBuffer[_backBuffer]) {
+		_displayBuffer[_backBuffer] = new Graphics::Surface();
+		_displayBuffer[_backBuffer]->init(_width, _height, surface->pitch,
+		                                  surface->getBasePtr(_x, _y), surface->format);
 	}
 
+#ifdef THEORA_USE_PTHREADS
+	pthread_mutex_lock(&s_convertMutex);
+#endif
+
 	switch (_theoraPixelFormat) {
 	case TH_PF_420:
-		YUVToRGBMan.convert420(_surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
+		YUVToRGBMan.convert420(surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
 		break;
 	case TH_PF_422:
-		YUVToRGBMan.convert422(_surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
+		YUVToRGBMan.convert422(surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
 		break;
 	case TH_PF_444:
-		YUVToRGBMan.convert444(_surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
+		YUVToRGBMan.convert444(surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
 		break;
 	default:
 		error("Unsupported Theora pixel format");
 	}
+
+#ifdef THEORA_USE_PTHREADS
+	pthread_mutex_unlock(&s_convertMutex);
+#endif
+}
+
+#ifdef THEORA_USE_PTHREADS
+
+// Hand-off state between the demuxing thread and the decode worker. There is
+// at most one packet in flight; the demuxer does not submit the next one
+// before it has collected the result of the previous one.
+struct TheoraDecoder::TheoraVideoTrack::PipelineState {
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t workCond;
+	pthread_cond_t doneCond;
+
+	// The packet payload is deep copied because the ogg buffer it points
+	// into is recycled as soon as the demuxer pulls the next page.
+	ogg_packet packet;
+	byte *packetData;
+	uint packetDataSize;
+
+	int jobState;
+	bool producedFrame;
+	double granuleTime;
+	bool quit;
+};
+
+enum {
+	kPipelineIdle = 0,
+	kPipelineQueued,
+	kPipelineDone
+};
+
+#endif
+
+void TheoraDecoder::TheoraVideoTrack::startWorker() {
+#ifdef THEORA_USE_PTHREADS
+	// Instantiate the converter singleton from this thread; creating it
+	// lazily from the worker would not be thread safe.
+	(void)YUVToRGBMan;
+
+	PipelineState *p = new PipelineState();
+	p->packetData = nullptr;
+	p->packetDataSize = 0;
+	p->jobState = kPipelineIdle;
+	p->producedFrame = false;
+	p->granuleTime = -1.0;
+	p->quit = false;
+
+	pthread_mutex_init(&p->mutex, nullptr);
+	pthread_cond_init(&p->workCond, nullptr);
+	pthread_cond_init(&p->doneCond, nullptr);
+
+	_pipeline = p;
+	if (pthread_create(&p->thread, nullptr, workerEntry, this) != 0) {
+		// No worker, no pipelining; decodePacket() falls back to the
+		// synchronous path.
+		_pipeline = nullptr;
+		pthread_mutex_destroy(&p->mutex);
+		pthread_cond_destroy(&p->workCond);
+		pthread_cond_destroy(&p->doneCond);
+		delete p;
+	}
+#endif
+}
+
+void TheoraDecoder::TheoraVideoTrack::stopWorker() {
+#ifdef THEORA_USE_PTHREADS
+	PipelineState *p = _pipeline;
+	if (!p)
+		return;
+
+	pthread_mutex_lock(&p->mutex);
+	p->quit = true;
+	pthread_cond_signal(&p->workCond);
+	pthread_mutex_unlock(&p->mutex);
+
+	pthread_join(p->thread, nullptr);
+
+	pthread_mutex_destroy(&p->mutex);
+	pthread_cond_destroy(&p->workCond);
+	pthread_cond_destroy(&p->doneCond);
+
+	free(p->packetData);
+	delete p;
+	_pipeline = nullptr;
+#endif
+}
+
+#ifdef THEORA_USE_PTHREADS
+
+void TheoraDecoder::TheoraVideoTrack::submitPacket(ogg_packet &oggPacket) {
+	PipelineState *p = _pipeline;
+
+	if (p->packetDataSize < (uint)oggPacket.bytes) {
+		free(p->packetData);
+		p->packetData = (byte *)malloc(oggPacket.bytes);
+		assert(p->packetData);
+		p->packetDataSize = oggPacket.bytes;
+	}
+	if (oggPacket.bytes > 0)
+		memcpy(p->packetData, oggPacket.packet, oggPacket.bytes);
+
+	p->packet = oggPacket;
+	p->packet.packet = p->packetData;
+
+	pthread_mutex_lock(&p->mutex);
+	p->jobState = kPipelineQueued;
+	pthread_cond_signal(&p->workCond);
+	pthread_mutex_unlock(&p->mutex);
+}
+
+void TheoraDecoder::TheoraVideoTrack::workerLoop() {
+	PipelineState *p = _pipeline;
+
+	pthread_mutex_lock(&p->mutex);
+	while (true) {
+		while (p->jobState != kPipelineQueued && !p->quit)
+			pthread_cond_wait(&p->workCond, &p->mutex);
+		if (p->quit)
+			break;
+
+		pthread_mutex_unlock(&p->mutex);
+
+		// The hand-off fields are stable here: the demuxer does not touch
+		// them again before it has collected this result.
+		double granuleTime = -1.0;
+		bool produced = processPacket(p->packet, granuleTime);
+
+		pthread_mutex_lock(&p->mutex);
+		p->producedFrame = produced;
+		p->granuleTime = granuleTime;
+		p->jobState = kPipelineDone;
+		pthread_cond_signal(&p->doneCond);
+	}
+	pthread_mutex_unlock(&p->mutex);
+}
+
+void *TheoraDecoder::TheoraVideoTrack::workerEntry(void *track) {
+	((TheoraVideoTrack *)track)->workerLoop();
+	return nullptr;
+}
+
+#endif
+
+bool TheoraDecoder::TheoraVideoTrack::finishPendingFrame() {
+#ifdef THEORA_USE_PTHREADS
+	PipelineState *p = _pipeline;
+
+	// Only this thread moves the job state away from idle, so the unlocked
+	// check is safe.
+	if (!p || p->jobState == kPipelineIdle)
+		return false;
+
+	pthread_mutex_lock(&p->mutex);
+	while (p->jobState != kPipelineDone)
+		pthread_cond_wait(&p->doneCond, &p->mutex);
+
+	bool produced = p->producedFrame;
+	double granuleTime = p->granuleTime;
+	p->jobState = kPipelineIdle;
+	pthread_mutex_unlock(&p->mutex);
+
+	if (!produced)
+		return false;
+
+	presentFrame(granuleTime);
+	return true;
+#else
+	return false;
+#endif
 }
 
 static vorbis_info *info = 0;
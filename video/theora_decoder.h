@@ -99,6 +99,16 @@ private:
 		const Graphics::Surface *decodeNextFrame() { return _displaySurface; }
 
 		bool decodePacket(ogg_packet &oggPacket);
+
+		/**
+		 * Present the frame still sitting in the decode pipeline, if any.
+		 * Called when the stream runs out of packets so the last submitted
+		 * frame is not lost.
+		 *
+		 * @return true if a frame was made available.
+		 */
+		bool finishPendingFrame();
+
 		void setEndOfVideo() { _endOfVideo = true; }
 
 	private:
@@ -107,7 +117,13 @@ private:
 		Common::Rational _frameRate;
 		double _nextFrameStartTime;
 
-		Graphics::Surface *_surface;
+		// The converted output is double buffered so that the worker can
+		// convert the next frame while the client still reads the current
+		// one. _displaySurface points at the front display buffer.
+		Graphics::Surface *_frameBuffer[2];
+		Graphics::Surface *_displayBuffer[2];
+		uint _backBuffer;
+
 		Graphics::Surface *_displaySurface;
 		Graphics::PixelFormat _pixelFormat;
 		int _x;
@@ -120,7 +136,21 @@ private:
 		th_dec_ctx *_theoraDecode;
 		th_pixel_fmt _theoraPixelFormat;
 
+		// State of the pipelined decode worker; only allocated on platforms
+		// with thread support. See theora_decoder.cpp.
+		struct PipelineState;
+		PipelineState *_pipeline;
+
 		void translateYUVtoRGBA(th_ycbcr_buffer &YUVBuffer);
+
+		bool processPacket(ogg_packet &oggPacket, double &granuleTime);
+		void presentFrame(double granuleTime);
+
+		void startWorker();
+		void stopWorker();
+		void submitPacket(ogg_packet &oggPacket);
+		void workerLoop();
+		static void *workerEntry(void *track);
 	};
 
 	class VorbisAudioTrack : public AudioTrack {
@@ -19,6 +19,10 @@
  *
  */
 
+// Disable symbol overrides so that we can use the POSIX thread API
+// for the background decoder (pthread.h drags in time.h)
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
 #include "video/video_decoder.h"
 
 #include "audio/audiostream.h"
@@ -26,10 +30,241 @@
 
 #include "common/rational.h"
 #include "common/file.h"
+#include "common/queue.h"
 #include "common/system.h"
 
+#include "graphics/surface.h"
+
+#if defined(POSIX)
+#include <pthread.h>
+#endif
+
 namespace Video {
 
+#if defined(POSIX)
+
+/**
+ * The decoder thread behind setDecodeAhead(): decodes frames ahead of
+ * playback into a bounded queue of deep-copied surfaces. While the
+ * thread is running the tracks belong to it; the playing thread only
+ * touches the queue (and the members pullFrame() updates for it).
+ */
+struct VideoDecoder::BackgroundDecoder {
+	struct QueuedFrame {
+		Graphics::Surface surface;
+		bool hasSurface;
+		byte palette[768];
+		bool paletteDirty;
+		uint32 startTime;	// getNextFrameStartTime() of this frame
+		int frameNumber;
+
+		QueuedFrame() : hasSurface(false), paletteDirty(false), startTime(0), frameNumber(-1) {}
+		~QueuedFrame() { surface.free(); }
+	};
+
+	BackgroundDecoder(VideoDecoder *decoder, uint maxFrames) :
+			_decoder(decoder), _maxFrames(MAX<uint>(maxFrames, 1)),
+			_quit(false), _atEnd(false), _started(false), _lastPulled(nullptr) {
+		pthread_mutex_init(&_mutex, nullptr);
+		pthread_cond_init(&_frameReady, nullptr);
+		pthread_cond_init(&_slotFree, nullptr);
+		_started = pthread_create(&_thread, nullptr, threadMain, this) == 0;
+	}
+
+	~BackgroundDecoder() {
+		if (_started) {
+			pthread_mutex_lock(&_mutex);
+			_quit = true;
+			pthread_cond_broadcast(&_slotFree);
+			pthread_mutex_unlock(&_mutex);
+			pthread_join(_thread, nullptr);
+		}
+		while (!_queue.empty())
+			delete _queue.pop();
+		for (auto *frame : _freeFrames)
+			delete frame;
+		delete _lastPulled;
+		pthread_cond_destroy(&_slotFree);
+		pthread_cond_destroy(&_frameReady);
+		pthread_mutex_destroy(&_mutex);
+	}
+
+	bool started() const { return _started; }
+
+	/** Has the decoder thread finished and the queue been drained? */
+	bool done() {
+		pthread_mutex_lock(&_mutex);
+		const bool d = _queue.empty() && _atEnd;
+		pthread_mutex_unlock(&_mutex);
+		return d;
+	}
+
+	/** Start time of the buffered frame next in line, if there is one. */
+	bool peekStartTime(uint32 &startTime) {
+		pthread_mutex_lock(&_mutex);
+		const bool has = !_queue.empty();
+		if (has)
+			startTime = _queue.front()->startTime;
+		pthread_mutex_unlock(&_mutex);
+		return has;
+	}
+
+	/**
+	 * Pull the next buffered frame, waiting for the decoder thread if
+	 * the queue is empty. The returned surface stays valid until the
+	 * next pull. Returns nullptr at the end of the video.
+	 */
+	const Graphics::Surface *pullFrame() {
+		pthread_mutex_lock(&_mutex);
+		while (_queue.empty() && !_atEnd)
+			pthread_cond_wait(&_frameReady, &_mutex);
+		QueuedFrame *frame = nullptr;
+		if (!_queue.empty()) {
+			frame = _queue.pop();
+			pthread_cond_signal(&_slotFree);
+		}
+		// The frame shown until now goes back to the pool, buffer and
+		// all, so the decoder thread can fill it again.
+		if (_lastPulled)
+			_freeFrames.push_back(_lastPulled);
+		pthread_mutex_unlock(&_mutex);
+
+		_lastPulled = frame;
+
+		if (!frame)
+			return nullptr;
+
+		_decoder->_bgCurFrame = frame->frameNumber;
+		if (frame->paletteDirty) {
+			memcpy(_decoder->_bgPalette, frame->palette, sizeof(frame->palette));
+			_decoder->_palette = _decoder->_bgPalette;
+			_decoder->_dirtyPalette = true;
+		}
+
+		return frame->hasSurface ? &frame->surface : nullptr;
+	}
+
+private:
+	static void *threadMain(void *arg) {
+		((BackgroundDecoder *)arg)->run();
+		return nullptr;
+	}
+
+	// copyFrom() would free and reallocate the destination every frame;
+	// a recycled entry almost always already carries a buffer of the
+	// right size and format, which is reused here.
+	static void copyFrameData(Graphics::Surface &dst, const Graphics::Surface &src) {
+		if (dst.w != src.w || dst.h != src.h || dst.format != src.format) {
+			dst.copyFrom(src);
+			return;
+		}
+		const byte *srcP = (const byte *)src.getPixels();
+		byte *dstP = (byte *)dst.getPixels();
+		const uint32 rowBytes = src.w * src.format.bytesPerPixel;
+		for (int y = 0; y < src.h; y++) {
+			memcpy(dstP, srcP, rowBytes);
+			srcP += src.pitch;
+			dstP += dst.pitch;
+		}
+	}
+
+	void run() {
+		for (;;) {
+			pthread_mutex_lock(&_mutex);
+			while (!_quit && (uint)_queue.size() >= _maxFrames)
+				pthread_cond_wait(&_slotFree, &_mutex);
+			const bool quit = _quit;
+			QueuedFrame *entry = nullptr;
+			if (!quit && !_freeFrames.empty()) {
+				entry = _freeFrames.back();
+				_freeFrames.pop_back();
+			}
+			pthread_mutex_unlock(&_mutex);
+			if (quit)
+				break;
+
+			// Decode outside the lock. This mirrors decodeNextFrame(),
+			// but stashes the frame, palette and frame number in the
+			// queue entry instead of the decoder's members, which stay
+			// owned by the playing thread. Entries are recycled through
+			// _freeFrames, so after the first few frames no allocation
+			// happens here at all.
+			if (!entry)
+				entry = new QueuedFrame();
+			entry->hasSurface = false;
+			entry->paletteDirty = false;
+			entry->frameNumber = -1;
+			entry->startTime = _decoder->_nextVideoTrack ? _decoder->_nextVideoTrack->getNextFrameStartTime() : 0;
+
+			_decoder->readNextPacket();
+
+			VideoTrack *track = _decoder->_nextVideoTrack;
+			if (track) {
+				const Graphics::Surface *frame = track->decodeNextFrame();
+				if (frame) {
+					copyFrameData(entry->surface, *frame);
+					entry->hasSurface = true;
+				}
+
+				if (track->hasDirtyPalette()) {
+					const byte *palette = track->getPalette();
+					if (palette) {
+						memcpy(entry->palette, palette, sizeof(entry->palette));
+						entry->paletteDirty = true;
+					}
+				}
+
+				_decoder->findNextVideoTrack();
+			}
+
+			int frameNumber = -1;
+			for (auto &t : _decoder->_tracks)
+				if (t->getTrackType() == Track::kTrackTypeVideo)
+					frameNumber += ((VideoTrack *)t)->getCurFrame() + 1;
+			entry->frameNumber = frameNumber;
+
+			const bool ended = _decoder->endOfVideoTracks();
+
+			pthread_mutex_lock(&_mutex);
+			_queue.push(entry);
+			if (ended)
+				_atEnd = true;
+			pthread_cond_signal(&_frameReady);
+			pthread_mutex_unlock(&_mutex);
+
+			// Nothing left to decode; done() turning true tells the
+			// playing thread the tracks are safe to touch again.
+			if (ended)
+				break;
+		}
+	}
+
+	VideoDecoder *_decoder;
+	pthread_t _thread;
+	pthread_mutex_t _mutex;
+	pthread_cond_t _frameReady;
+	pthread_cond_t _slotFree;
+	Common::Queue<QueuedFrame *> _queue;
+	Common::Array<QueuedFrame *> _freeFrames;
+	uint _maxFrames;
+	bool _quit;
+	bool _atEnd;
+	bool _started;
+	QueuedFrame *_lastPulled;
+};
+
+#else // !defined(POSIX)
+
+// Stub so that the _backgroundDecoder branches compile; never
+// instantiated, since setDecodeAhead() fails on these platforms.
+struct VideoDecoder::BackgroundDecoder {
+	bool done() { return true; }
+	bool peekStartTime(uint32 &) { return false; }
+	const Graphics::Surface *pullFrame() { return nullptr; }
+};
+
+#endif // defined(POSIX)
+
 VideoDecoder::VideoDecoder() {
 	_startTime = 0;
 	_dirtyPalette = false;
@@ -48,12 +283,23 @@ VideoDecoder::VideoDecoder() {
 	_canSetDither = true;
 	_canSetDefaultFormat = true;
 	_videoCodecAccuracy = Image::CodecAccuracy::Default;
+	_backgroundDecoder = nullptr;
+	_decodeAheadFrames = 0;
+	_bgCurFrame = -1;
+}
+
+VideoDecoder::~VideoDecoder() {
+	stopBackgroundDecoding();
 }
 
 void VideoDecoder::close() {
 	if (isPlaying())
 		stop();
 
+	stopBackgroundDecoding();
+	_decodeAheadFrames = 0;
+	_bgCurFrame = -1;
+
 	for (auto *track : _tracks)
 		delete track;
 
@@ -91,6 +337,9 @@ bool VideoDecoder::loadFile(const Common::Path &filename) {
 }
 
 bool VideoDecoder::needsUpdate() const {
+	if (_backgroundDecoder)
+		return !_backgroundDecoder->done() && getTimeToNextFrame() == 0;
+
 	bool hasVideo = false;
 	bool hasAudio = false;
 	for (auto &track : _tracks) {
@@ -209,6 +458,10 @@ Graphics::PixelFormat VideoDecoder::getPixelFormat() const {
 
 const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	_needsUpdate = false;
+
+	if (_backgroundDecoder)
+		return _backgroundDecoder->pullFrame();
+
 	_canSetDither = false;
 	_canSetDefaultFormat = false;
 
@@ -237,6 +490,10 @@ bool VideoDecoder::setReverse(bool reverse) {
 	if (reverse && hasAudio())
 		return false;
 
+	// Reverse playback and decoding ahead do not mix
+	if (reverse && _backgroundDecoder)
+		return false;
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (auto &track : _tracks) {
 		if (track->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)track)->isReversed() != reverse) {
@@ -257,6 +514,11 @@ const byte *VideoDecoder::getPalette() {
 }
 
 int VideoDecoder::getCurFrame() const {
+	// With background decoding the tracks run ahead of playback; report
+	// the frame that was last handed out instead.
+	if (_backgroundDecoder)
+		return _bgCurFrame;
+
 	int32 frame = -1;
 
 	for (const auto &track : _tracks)
@@ -298,6 +560,21 @@ uint32 VideoDecoder::getTime() const {
 }
 
 uint32 VideoDecoder::getTimeToNextFrame() const {
+	if (_backgroundDecoder) {
+		// Pace playback on the buffered frame next in line. An empty
+		// queue means either the end of the video or a decoder thread
+		// that has fallen behind; both want an immediate update.
+		uint32 nextFrameStartTime;
+		if (!_backgroundDecoder->peekStartTime(nextFrameStartTime))
+			return 0;
+
+		uint32 curTime = getTime();
+		if (nextFrameStartTime <= curTime)
+			return 0;
+
+		return nextFrameStartTime - curTime;
+	}
+
 	if (endOfVideo() || _needsUpdate || !_nextVideoTrack)
 		return 0;
 
@@ -320,6 +597,12 @@ uint32 VideoDecoder::getTimeToNextFrame() const {
 }
 
 bool VideoDecoder::endOfVideo() const {
+	// Not over while decoded frames are still buffered. Once done()
+	// returns true the decoder thread has finished with the tracks, so
+	// falling through to the regular per-track check is safe.
+	if (_backgroundDecoder && !_backgroundDecoder->done())
+		return false;
+
 	for (const auto &track : _tracks) {
 		bool videoEndTimeReached = _endTimeSet && track->getTrackType() == Track::kTrackTypeVideo && ((const VideoTrack *)track)->getNextFrameStartTime() >= (uint)_endTime.msecs();
 		bool endReached = track->endOfTrack() || (isPlaying() && videoEndTimeReached);
@@ -345,6 +628,11 @@ bool VideoDecoder::rewind() {
 	if (!isRewindable())
 		return false;
 
+	// The tracks cannot be rewound under the decoder thread; stop it
+	// (discarding buffered frames) and restart it afterwards.
+	const bool restartBackground = _backgroundDecoder != nullptr;
+	stopBackgroundDecoding();
+
 	// Stop all tracks so they can be rewound
 	if (isPlaying())
 		stopAudio();
@@ -361,6 +649,10 @@ bool VideoDecoder::rewind() {
 	_startTime = g_system->getMillis();
 	resetPauseStartTime();
 	findNextVideoTrack();
+
+	if (restartBackground)
+		startBackgroundDecoding();
+
 	return true;
 }
 
@@ -379,6 +671,11 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	if (!isSeekable())
 		return false;
 
+	// The tracks cannot be seeked under the decoder thread; stop it
+	// (discarding buffered frames) and restart it afterwards.
+	const bool restartBackground = _backgroundDecoder != nullptr;
+	stopBackgroundDecoding();
+
 	// Stop all tracks so they can be seek'ed
 	if (isPlaying())
 		stopAudio();
@@ -404,6 +701,10 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	resetPauseStartTime();
 	findNextVideoTrack();
 	_needsUpdate = true;
+
+	if (restartBackground)
+		startBackgroundDecoding();
+
 	return true;
 }
 
@@ -439,12 +740,17 @@ bool VideoDecoder::seekToFrame(uint frame) {
 void VideoDecoder::start() {
 	if (!isPlaying())
 		setRate(1);
+
+	if (_decodeAheadFrames > 0 && !_backgroundDecoder)
+		startBackgroundDecoding();
 }
 
 void VideoDecoder::stop() {
 	if (!isPlaying())
 		return;
 
+	stopBackgroundDecoding();
+
 	// Stop audio here so we don't have it affect getTime()
 	stopAudio();
 
@@ -468,6 +774,44 @@ void VideoDecoder::stop() {
 		track->pause(false);
 }
 
+bool VideoDecoder::setDecodeAhead(uint frames) {
+#if defined(POSIX)
+	if (_backgroundDecoder)
+		return false;
+
+	_decodeAheadFrames = frames;
+	return true;
+#else
+	_decodeAheadFrames = 0;
+	return frames == 0;
+#endif
+}
+
+void VideoDecoder::startBackgroundDecoding() {
+#if defined(POSIX)
+	// The decoder thread serves frames in whatever format the tracks
+	// are in now, so lock the output format and dithering settings.
+	_canSetDither = false;
+	_canSetDefaultFormat = false;
+	findNextVideoTrack();
+
+	_backgroundDecoder = new BackgroundDecoder(this, _decodeAheadFrames);
+	if (!_backgroundDecoder->started()) {
+		// Could not spawn a thread; fall back to synchronous decoding.
+		delete _backgroundDecoder;
+		_backgroundDecoder = nullptr;
+	}
+#endif
+}
+
+void VideoDecoder::stopBackgroundDecoding() {
+#if defined(POSIX)
+	// Joins the decoder thread and discards any buffered frames.
+	delete _backgroundDecoder;
+	_backgroundDecoder = nullptr;
+#endif
+}
+
 void VideoDecoder::setRate(const Common::Rational &rate) {
 	if (!isVideoLoaded() || _playbackRate == rate)
 		return;
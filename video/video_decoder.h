@@ -53,7 +53,7 @@ namespace Video {
 class VideoDecoder {
 public:
 	VideoDecoder();
-	virtual ~VideoDecoder() {}
+	virtual ~VideoDecoder();
 
 	/////////////////////////////////////////
 	// Opening/Closing a Video
@@ -185,6 +185,16 @@ public:
 	 */
 	virtual bool seekToFrame(uint frame);
 
+	/**
+	 * Get the nearest intra frame (keyframe) at or before the given frame.
+	 *
+	 * Decoders that keep a keyframe index (such as AVIDecoder) override
+	 * this so callers can cheaply align seeks to frames that are decodable
+	 * on their own. The default implementation knows nothing about
+	 * keyframes and returns the frame unchanged.
+	 */
+	virtual uint getNearestIntraFrame(uint frame) const { return frame; }
+
 	/**
 	 * Pause or resume the video. This should stop/resume any audio playback
 	 * and other stuff. The initial pause time is kept so that any timing
@@ -365,6 +375,33 @@ public:
 	 */
 	virtual const Graphics::Surface *decodeNextFrame();
 
+	/**
+	 * Request that frames be decoded on a background thread.
+	 *
+	 * When enabled, a decoder thread started by start() stays up to
+	 * @p frames decoded frames ahead of playback in a bounded queue,
+	 * and needsUpdate() / decodeNextFrame() serve frames from that
+	 * queue. This hides decode spikes of expensive codecs behind the
+	 * frame interval; a frame that takes longer than its display slot
+	 * only stalls playback once the buffer has drained.
+	 *
+	 * This is opt-in and only works for decoders that go through the
+	 * base class' decodeNextFrame() pipeline. While the decoder thread
+	 * is running, the video must be driven solely through the playback
+	 * API (needsUpdate(), decodeNextFrame(), getPalette(), seek() and
+	 * friends); frame-accurate track queries reflect the frame last
+	 * returned, not the decode position. Seeking, rewinding and
+	 * stopping discard any buffered frames.
+	 *
+	 * Call this after loadStream() but before start(). Passing 0
+	 * disables the mode again.
+	 *
+	 * @param frames Number of frames to buffer ahead
+	 * @return true on success, false if background decoding is not
+	 *         supported on this platform
+	 */
+	bool setDecodeAhead(uint frames);
+
 	/**
 	 * Set the video to decode frames in reverse.
 	 *
@@ -1014,6 +1051,16 @@ private:
 	bool _canSetDither;
 	bool _canSetDefaultFormat;
 
+	// Background decoding (see setDecodeAhead())
+	struct BackgroundDecoder;
+	BackgroundDecoder *_backgroundDecoder;
+	uint _decodeAheadFrames;
+	int _bgCurFrame;
+	byte _bgPalette[768];
+
+	void startBackgroundDecoding();
+	void stopBackgroundDecoding();
+
 protected:
 	// Internal helper functions
 	void stopAudio();